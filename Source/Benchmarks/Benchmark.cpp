@@ -0,0 +1,56 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Benchmark.h"
+
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace Benchmark
+{
+namespace
+{
+std::vector<Entry>& GetMutableBenchmarks()
+{
+  static std::vector<Entry> s_benchmarks;
+  return s_benchmarks;
+}
+}  // namespace
+
+std::string Context::GetFullName(std::string_view variant) const
+{
+  if (variant.empty())
+    return m_benchmark_name;
+  return fmt::format("{}/{}", m_benchmark_name, variant);
+}
+
+void Context::AddResult(std::string name, u64 iterations, Clock::duration elapsed,
+                        u64 bytes_per_iteration)
+{
+  const double ns_per_iteration =
+      std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+
+  if (bytes_per_iteration != 0)
+  {
+    const double mib_per_second = bytes_per_iteration / ns_per_iteration * 1e9 / (1024 * 1024);
+    fmt::print("{:<48} {:>14.1f} ns {:>12.1f} MiB/s\n", name, ns_per_iteration, mib_per_second);
+  }
+  else
+  {
+    fmt::print("{:<48} {:>14.1f} ns\n", name, ns_per_iteration);
+  }
+
+  m_results.push_back(Result{std::move(name), iterations, ns_per_iteration, bytes_per_iteration});
+}
+
+const std::vector<Entry>& GetBenchmarks()
+{
+  return GetMutableBenchmarks();
+}
+
+Registration::Registration(const char* name, Function function)
+{
+  GetMutableBenchmarks().push_back(Entry{name, function});
+}
+}  // namespace Benchmark
@@ -0,0 +1,106 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Benchmark
+{
+struct Result
+{
+  std::string name;
+  u64 iterations;
+  double ns_per_iteration;
+  // How much data one iteration processes, or 0 if that doesn't apply.
+  u64 bytes_per_iteration;
+};
+
+// Passed to every benchmark, which does its setup and then measures one or more variants with Run.
+class Context
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  Context(std::string_view benchmark_name, std::string_view filter, Clock::duration min_time)
+      : m_benchmark_name(benchmark_name), m_filter(filter), m_min_time(min_time)
+  {
+  }
+
+  // Calls body once to warm up (e.g. to compile JIT code), and then repeatedly, doubling the number
+  // of calls until they take at least the minimum time. Variants whose full name doesn't contain
+  // the filter are skipped.
+  template <typename Body>
+  void Run(std::string_view variant, u64 bytes_per_iteration, Body&& body)
+  {
+    std::string name = GetFullName(variant);
+    if (name.find(m_filter) == std::string::npos)
+      return;
+
+    body();
+    for (u64 iterations = 1;; iterations *= 2)
+    {
+      const Clock::time_point start = Clock::now();
+      for (u64 i = 0; i < iterations; ++i)
+        body();
+      const Clock::duration elapsed = Clock::now() - start;
+
+      if (elapsed >= m_min_time)
+      {
+        AddResult(std::move(name), iterations, elapsed, bytes_per_iteration);
+        return;
+      }
+    }
+  }
+
+  std::vector<Result>& GetResults() { return m_results; }
+
+private:
+  std::string GetFullName(std::string_view variant) const;
+  void AddResult(std::string name, u64 iterations, Clock::duration elapsed,
+                 u64 bytes_per_iteration);
+
+  std::string m_benchmark_name;
+  std::string m_filter;
+  Clock::duration m_min_time;
+  std::vector<Result> m_results;
+};
+
+using Function = void (*)(Context& context);
+
+struct Entry
+{
+  const char* name;
+  Function function;
+};
+
+const std::vector<Entry>& GetBenchmarks();
+
+// Used by DOLPHIN_BENCHMARK.
+struct Registration
+{
+  Registration(const char* name, Function function);
+};
+
+// Keeps the compiler from optimizing away the computation of value.
+template <typename T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  static const void* volatile s_sink;
+  s_sink = &value;
+#else
+  asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+}  // namespace Benchmark
+
+#define DOLPHIN_BENCHMARK(name)                                                                    \
+  static void Benchmark_##name(Benchmark::Context& context);                                       \
+  static const Benchmark::Registration s_registration_##name(#name, &Benchmark_##name);            \
+  static void Benchmark_##name(Benchmark::Context& context)
@@ -0,0 +1,103 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <picojson.h>
+
+#include "Benchmark.h"
+#include "Common/JsonUtil.h"
+#include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
+#include "Common/Version.h"
+
+namespace
+{
+bool BenchmarkMsgHandler(const char* caption, const char* text, bool yes_no, Common::MsgType style)
+{
+  fmt::print(stderr, "{}\n", text);
+  return true;
+}
+
+void PrintUsage()
+{
+  fmt::print(stderr, "Usage: benchmarks [--filter=<substring>] [--json=<path>] "
+                     "[--min-time=<milliseconds>]\n");
+}
+
+picojson::value ResultsToJson(const std::vector<Benchmark::Result>& results)
+{
+  picojson::array benchmarks;
+  for (const Benchmark::Result& result : results)
+  {
+    picojson::object benchmark;
+    benchmark.emplace("name", result.name);
+    benchmark.emplace("iterations", static_cast<double>(result.iterations));
+    benchmark.emplace("ns_per_iteration", result.ns_per_iteration);
+    if (result.bytes_per_iteration != 0)
+    {
+      benchmark.emplace("bytes_per_second",
+                        result.bytes_per_iteration / result.ns_per_iteration * 1e9);
+    }
+    benchmarks.emplace_back(std::move(benchmark));
+  }
+
+  picojson::object root;
+  root.emplace("version", Common::GetScmDescStr());
+  root.emplace("revision", Common::GetScmRevStr());
+  root.emplace("benchmarks", std::move(benchmarks));
+  return picojson::value(std::move(root));
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  Common::RegisterMsgAlertHandler(BenchmarkMsgHandler);
+
+  std::string filter;
+  std::optional<std::string> json_path;
+  u32 min_time_ms = 500;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string_view arg = argv[i];
+    if (arg.starts_with("--filter="))
+    {
+      filter = arg.substr(9);
+    }
+    else if (arg.starts_with("--json="))
+    {
+      json_path = arg.substr(7);
+    }
+    else if (!arg.starts_with("--min-time=") ||
+             !TryParse(std::string(arg.substr(11)), &min_time_ms) || min_time_ms == 0)
+    {
+      PrintUsage();
+      return 1;
+    }
+  }
+
+  std::vector<Benchmark::Result> results;
+  for (const Benchmark::Entry& entry : Benchmark::GetBenchmarks())
+  {
+    Benchmark::Context context(entry.name, filter, std::chrono::milliseconds(min_time_ms));
+    entry.function(context);
+    std::ranges::move(context.GetResults(), std::back_inserter(results));
+  }
+
+  if (json_path && !JsonToFile(*json_path, ResultsToJson(results), true))
+  {
+    fmt::print(stderr, "Failed to write {}\n", *json_path);
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,46 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Benchmark.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VideoConfig.h"
+
+DOLPHIN_BENCHMARK(IndexGenerator)
+{
+  constexpr u32 VERTEX_COUNT = 0x3000;
+
+  // Strips and fans may need a primitive restart index, and a quad two triangles, per vertex.
+  std::vector<u16> indices(VERTEX_COUNT * 3);
+
+  using OpcodeDecoder::Primitive;
+  for (bool primitive_restart : {false, true})
+  {
+    g_backend_info.bSupportsPrimitiveRestart = primitive_restart;
+    IndexGenerator generator;
+    generator.Init();
+
+    for (Primitive primitive : {Primitive::GX_DRAW_QUADS, Primitive::GX_DRAW_TRIANGLES,
+                                Primitive::GX_DRAW_TRIANGLE_STRIP, Primitive::GX_DRAW_TRIANGLE_FAN,
+                                Primitive::GX_DRAW_LINES, Primitive::GX_DRAW_POINTS})
+    {
+      // Primitive restart doesn't change how lines and points are generated.
+      if (primitive_restart && primitive >= Primitive::GX_DRAW_LINES)
+        continue;
+
+      const std::string variant =
+          fmt::format("{}{}", primitive, primitive_restart ? "/PrimitiveRestart" : "");
+      context.Run(variant, 0, [&] {
+        generator.Start(indices.data());
+        generator.AddIndices(primitive, VERTEX_COUNT);
+        Benchmark::DoNotOptimize(indices);
+      });
+    }
+  }
+}
@@ -0,0 +1,67 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <SFML/Network/Packet.hpp>
+
+#include "Benchmark.h"
+#include "Common/CommonTypes.h"
+#include "Core/HW/WiimoteEmu/DesiredWiimoteState.h"
+#include "Core/NetPlayPadFrames.h"
+#include "Core/NetPlayWiimoteDelta.h"
+#include "InputCommon/GCPadStatus.h"
+
+DOLPHIN_BENCHMARK(NetPlayPadFrames)
+{
+  NetPlay::PadFrameHistory history;
+  for (u32 frame = 0; frame < 64; ++frame)
+  {
+    GCPadStatus status;
+    status.button = static_cast<u16>(frame / 4);
+    status.stickX = static_cast<u8>(frame);
+    status.stickY = static_cast<u8>(frame * 3);
+    status.triggerLeft = 0x20;
+    history.Push(status);
+  }
+
+  sf::Packet packet;
+  NetPlay::WriteRedundantPadFrames(packet, 0, history);
+  const u64 size = packet.getDataSize();
+
+  context.Run("Write", size, [&] {
+    packet.clear();
+    NetPlay::WriteRedundantPadFrames(packet, 0, history);
+    Benchmark::DoNotOptimize(packet);
+  });
+
+  context.Run("Read", size, [&] {
+    sf::Packet copy = packet;
+    NetPlay::PadFrames frames;
+    NetPlay::ReadPadFrames(copy, &frames);
+    Benchmark::DoNotOptimize(frames);
+  });
+}
+
+DOLPHIN_BENCHMARK(NetPlayWiimoteDelta)
+{
+  WiimoteEmu::SerializedWiimoteState previous{};
+  previous.length = static_cast<u8>(previous.data.size());
+  WiimoteEmu::SerializedWiimoteState state = previous;
+  // The accelerometer and a few camera bytes change from one state to the next.
+  for (u32 i : {2, 3, 4, 6, 7, 11})
+    state.data[i] = static_cast<u8>(i * 17);
+
+  context.Run("Write", sizeof(state.data), [&] {
+    sf::Packet packet;
+    NetPlay::WriteWiimoteStateDelta(packet, NetPlay::WiimoteStateDelta::Make(previous, state));
+    Benchmark::DoNotOptimize(packet);
+  });
+
+  sf::Packet packet;
+  NetPlay::WriteWiimoteStateDelta(packet, NetPlay::WiimoteStateDelta::Make(previous, state));
+  context.Run("Read", sizeof(state.data), [&] {
+    sf::Packet copy = packet;
+    NetPlay::WiimoteStateDelta delta;
+    NetPlay::ReadWiimoteStateDelta(copy, &delta);
+    Benchmark::DoNotOptimize(delta.Apply(previous));
+  });
+}
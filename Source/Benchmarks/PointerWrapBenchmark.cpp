@@ -0,0 +1,73 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+
+namespace
+{
+// Shaped like the state of a HW module: a bulk buffer, registers and a few containers.
+struct TestState
+{
+  std::vector<u8> memory = std::vector<u8>(0x100000, 0xAB);
+  std::array<u32, 64> registers{};
+  std::vector<u32> queue = std::vector<u32>(1024, 7);
+  std::map<u32, std::string> names;
+  u64 ticks = 0;
+  bool flag = false;
+
+  TestState()
+  {
+    for (u32 i = 0; i < 64; ++i)
+      names.emplace(i, "name");
+  }
+
+  void DoState(PointerWrap& p)
+  {
+    p.Do(memory);
+    p.DoArray(registers);
+    p.Do(queue);
+    p.Do(names);
+    p.Do(ticks);
+    p.Do(flag);
+    p.DoMarker("TestState");
+  }
+};
+
+size_t MeasureSize(TestState& state)
+{
+  u8* ptr = nullptr;
+  PointerWrap p(&ptr, 0, PointerWrap::Mode::Measure);
+  state.DoState(p);
+  return reinterpret_cast<size_t>(ptr);
+}
+}  // namespace
+
+DOLPHIN_BENCHMARK(PointerWrap)
+{
+  TestState state;
+  const size_t size = MeasureSize(state);
+  std::vector<u8> buffer(size);
+
+  context.Run("Measure", 0, [&] { Benchmark::DoNotOptimize(MeasureSize(state)); });
+
+  context.Run("Write", size, [&] {
+    u8* ptr = buffer.data();
+    PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
+    state.DoState(p);
+    Benchmark::DoNotOptimize(buffer);
+  });
+
+  context.Run("Read", size, [&] {
+    u8* ptr = buffer.data();
+    PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
+    state.DoState(p);
+    Benchmark::DoNotOptimize(state);
+  });
+}
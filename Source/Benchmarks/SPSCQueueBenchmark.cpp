@@ -0,0 +1,93 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <limits>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+#include "Benchmark.h"
+#include "Common/CommonTypes.h"
+#include "Common/SPSCQueue.h"
+
+namespace
+{
+constexpr u32 ITEM_COUNT = 1024;
+constexpr u32 STOP_ITEM = std::numeric_limits<u32>::max();
+
+template <typename Queue>
+void Push(Queue& queue, u32 value)
+{
+  // Pushing to a full ring queue fails.
+  if constexpr (std::is_same_v<decltype(queue.Push(value)), bool>)
+  {
+    while (!queue.Push(value))
+      std::this_thread::yield();
+  }
+  else
+  {
+    queue.Push(value);
+  }
+}
+
+template <typename Queue>
+void RunPushAndPop(Benchmark::Context& context, std::string_view variant, Queue& queue)
+{
+  context.Run(variant, ITEM_COUNT * sizeof(u32), [&] {
+    for (u32 i = 0; i < ITEM_COUNT; ++i)
+      Push(queue, i);
+
+    u32 value;
+    while (queue.Pop(value))
+      Benchmark::DoNotOptimize(value);
+  });
+}
+
+// Passes items to a second thread, which is what the queues are for.
+template <typename Queue>
+void RunTwoThreads(Benchmark::Context& context, std::string_view variant, Queue& queue)
+{
+  std::thread consumer([&] {
+    while (true)
+    {
+      queue.WaitForData();
+      const u32 value = queue.Front();
+      queue.Pop();
+      if (value == STOP_ITEM)
+        return;
+    }
+  });
+
+  context.Run(variant, ITEM_COUNT * sizeof(u32), [&] {
+    for (u32 i = 0; i < ITEM_COUNT; ++i)
+      Push(queue, i);
+    queue.WaitForEmpty();
+  });
+
+  Push(queue, STOP_ITEM);
+  consumer.join();
+}
+}  // namespace
+
+DOLPHIN_BENCHMARK(SPSCQueue)
+{
+  Common::SPSCQueue<u32> queue;
+  RunPushAndPop(context, "PushPop", queue);
+
+  Common::RingSPSCQueue<u32, ITEM_COUNT> ring_queue;
+  RunPushAndPop(context, "Ring/PushPop", ring_queue);
+
+  std::array<u32, ITEM_COUNT> values{};
+  context.Run("Ring/PushNPopN", ITEM_COUNT * sizeof(u32), [&] {
+    ring_queue.PushN(values);
+    ring_queue.PopN(values);
+    Benchmark::DoNotOptimize(values);
+  });
+
+  Common::WaitableSPSCQueue<u32> waitable_queue;
+  RunTwoThreads(context, "Waitable/TwoThreads", waitable_queue);
+
+  Common::WaitableRingSPSCQueue<u32, 256> waitable_ring_queue;
+  RunTwoThreads(context, "WaitableRing/TwoThreads", waitable_ring_queue);
+}
@@ -0,0 +1,40 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Benchmark.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+
+DOLPHIN_BENCHMARK(TexDecoder)
+{
+  constexpr int WIDTH = 512;
+  constexpr int HEIGHT = 512;
+
+  // Noise, so that the decoders don't hit uniform fast paths.
+  std::vector<u8> src(TexDecoder_GetTextureSizeInBytes(WIDTH, HEIGHT, TextureFormat::RGBA8));
+  u32 seed = 1;
+  for (u8& byte : src)
+  {
+    seed = seed * 1103515245 + 12345;
+    byte = static_cast<u8>(seed >> 16);
+  }
+  std::vector<u8> tlut(TexDecoder_GetPaletteSize(TextureFormat::C14X2) * sizeof(u16), 0x5A);
+  std::vector<u8> dst(WIDTH * HEIGHT * 4);
+
+  for (TextureFormat format :
+       {TextureFormat::I4, TextureFormat::I8, TextureFormat::IA4, TextureFormat::IA8,
+        TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+        TextureFormat::C8, TextureFormat::C14X2, TextureFormat::CMPR})
+  {
+    const u64 size = TexDecoder_GetTextureSizeInBytes(WIDTH, HEIGHT, format);
+    context.Run(fmt::format("{}", format), size, [&] {
+      TexDecoder_Decode(dst.data(), src.data(), WIDTH, HEIGHT, format, tlut.data(),
+                        TLUTFormat::RGB5A3);
+      Benchmark::DoNotOptimize(dst);
+    });
+  }
+}
@@ -0,0 +1,82 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Benchmark.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderManager.h"
+
+namespace
+{
+constexpr int VERTEX_COUNT = 10000;
+
+void RunLoader(Benchmark::Context& context, std::string_view variant, const TVtxDesc& vtx_desc,
+               const VAT& vtx_attr)
+{
+  // Creates the JIT loader of the host (VertexLoaderX64 or VertexLoaderARM64) where there is one.
+  const std::unique_ptr<VertexLoaderBase> loader =
+      VertexLoaderBase::CreateVertexLoader(vtx_desc, vtx_attr);
+
+  std::vector<u8> src(loader->m_vertex_size * VERTEX_COUNT);
+  std::vector<u8> dst(loader->m_native_vtx_decl.stride * VERTEX_COUNT);
+  for (int i = 0; i < NUM_VERTEX_COMPONENT_ARRAYS; i++)
+  {
+    VertexLoaderManager::cached_arraybases[static_cast<CPArray>(i)] = src.data();
+    g_main_cp_state.array_strides[static_cast<CPArray>(i)] = 129;
+  }
+
+  context.Run(variant, src.size(), [&] {
+    loader->RunVertices(src.data(), dst.data(), VERTEX_COUNT);
+    Benchmark::DoNotOptimize(dst);
+  });
+}
+}  // namespace
+
+DOLPHIN_BENCHMARK(VertexLoader)
+{
+  for (ComponentFormat format : {ComponentFormat::UByte, ComponentFormat::Byte,
+                                 ComponentFormat::UShort, ComponentFormat::Short,
+                                 ComponentFormat::Float})
+  {
+    TVtxDesc vtx_desc;
+    VAT vtx_attr;
+    vtx_desc.low.Position = VertexComponentFormat::Direct;
+    vtx_attr.g0.PosFormat = format;
+    vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+    RunLoader(context, fmt::format("PositionDirect/{}", format), vtx_desc, vtx_attr);
+
+    vtx_desc.high.Tex0Coord = VertexComponentFormat::Direct;
+    vtx_attr.g0.Tex0CoordFormat = format;
+    vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+    RunLoader(context, fmt::format("PositionTexCoordDirect/{}", format), vtx_desc, vtx_attr);
+  }
+
+  // Most attributes, in floating point indexed mode.
+  TVtxDesc vtx_desc;
+  VAT vtx_attr;
+  vtx_desc.low.PosMatIdx = true;
+  vtx_desc.low.Tex0MatIdx = true;
+  vtx_desc.low.Tex1MatIdx = true;
+  vtx_desc.low.Position = VertexComponentFormat::Index16;
+  vtx_desc.low.Normal = VertexComponentFormat::Index16;
+  vtx_desc.low.Color0 = VertexComponentFormat::Index16;
+  vtx_desc.high.Tex0Coord = VertexComponentFormat::Index16;
+  vtx_desc.high.Tex1Coord = VertexComponentFormat::Index16;
+  vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  vtx_attr.g0.NormalElements = NormalComponentCount::NTB;
+  vtx_attr.g0.NormalFormat = ComponentFormat::Float;
+  vtx_attr.g0.Color0Elements = ColorComponentCount::RGBA;
+  vtx_attr.g0.Color0Comp = ColorFormat::RGBA8888;
+  vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  vtx_attr.g0.Tex0CoordFormat = ComponentFormat::Float;
+  vtx_attr.g1.Tex1CoordElements = TexComponentCount::ST;
+  vtx_attr.g1.Tex1CoordFormat = ComponentFormat::Float;
+  RunLoader(context, "LargeIndexedFloat", vtx_desc, vtx_attr);
+}
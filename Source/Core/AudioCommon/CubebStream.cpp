@@ -3,6 +3,8 @@
 
 #include "AudioCommon/CubebStream.h"
 
+#include <algorithm>
+
 #include <cubeb/cubeb.h>
 
 #include "AudioCommon/CubebUtils.h"
@@ -18,6 +20,7 @@
 
 // ~10 ms - needs to be at least 240 for surround
 constexpr u32 BUFFER_SAMPLES = 512;
+constexpr u32 MIN_SURROUND_BUFFER_SAMPLES = 240;
 
 long CubebStream::DataCallback(cubeb_stream* stream, void* user_data, const void* /*input_buffer*/,
                                void* output_buffer, long num_frames)
@@ -84,10 +87,14 @@ bool CubebStream::Init()
         ERROR_LOG_FMT(AUDIO, "Error getting minimum latency");
       INFO_LOG_FMT(AUDIO, "Minimum latency: {} frames", minimum_latency);
 
-      return_value =
-          cubeb_stream_init(m_ctx.get(), &m_stream, "Dolphin Audio Output", nullptr, nullptr,
-                            nullptr, &params, std::max(BUFFER_SAMPLES, minimum_latency),
-                            DataCallback, StateCallback, this) == CUBEB_OK;
+      // In low latency mode, ask for the smallest buffer the device can take
+      u32 latency = std::max(BUFFER_SAMPLES, minimum_latency);
+      if (Config::Get(Config::MAIN_AUDIO_LOW_LATENCY) && minimum_latency != 0)
+        latency = std::max(m_stereo ? 0 : MIN_SURROUND_BUFFER_SAMPLES, minimum_latency);
+
+      return_value = cubeb_stream_init(m_ctx.get(), &m_stream, "Dolphin Audio Output", nullptr,
+                                       nullptr, nullptr, &params, latency, DataCallback,
+                                       StateCallback, this) == CUBEB_OK;
     }
 
 #ifdef _WIN32
@@ -107,7 +114,17 @@ bool CubebStream::SetRunning(bool running)
   m_work_queue.PushBlocking([this, running, &return_value] {
 #endif
     if (running)
+    {
       return_value = cubeb_stream_start(m_stream) == CUBEB_OK;
+
+      u32 latency = 0;
+      if (return_value && cubeb_stream_get_latency(m_stream, &latency) == CUBEB_OK)
+      {
+        INFO_LOG_FMT(AUDIO, "Stream latency: {} frames", latency);
+        m_mixer->SetOutputLatency(std::chrono::duration_cast<DT>(
+            DT_s(static_cast<double>(latency) / m_mixer->GetSampleRate())));
+      }
+    }
     else
       return_value = cubeb_stream_stop(m_stream) == CUBEB_OK;
 #ifdef _WIN32
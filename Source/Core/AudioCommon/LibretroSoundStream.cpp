@@ -6,8 +6,15 @@
 #include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <mutex>
 #include <vector>
 
+#if defined(_M_X86_64)
+#include "Common/Intrinsics.h"
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "Common/Logging/Log.h"
 #include "Common/Thread.h"
 
@@ -16,13 +23,37 @@ namespace AudioCommon
 namespace
 {
 std::atomic<LibretroAudioSampleBatch> s_audio_batch{nullptr};
+std::atomic<bool> s_frame_paced{false};
+std::atomic<bool> s_suppressed{false};
+// The stream is destroyed on the emulation thread while the frontend thread may be draining it.
+std::mutex s_paced_stream_mutex;
+LibretroSoundStream* s_paced_stream = nullptr;
 constexpr std::size_t BUFFER_FRAMES = 512;
 constexpr std::size_t CHANNELS = 2;
 
-int16_t ApplyVolume(int16_t sample, int volume)
+// Scales the samples by volume / 100 in Q15 fixed point.
+void ApplyVolume(int16_t* samples, std::size_t count, int volume)
 {
-  const int scaled = static_cast<int>(sample) * volume / 100;
-  return static_cast<int16_t>(std::clamp(scaled, -32768, 32767));
+  const int16_t factor = static_cast<int16_t>(std::clamp(volume, 0, 100) * 32767 / 100);
+  std::size_t i = 0;
+#if defined(_M_X86_64)
+  const __m128i factor_vec = _mm_set1_epi16(factor);
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+    const __m128i lo = _mm_mullo_epi16(in, factor_vec);
+    const __m128i hi = _mm_mulhi_epi16(in, factor_vec);
+    const __m128i low_products = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 15);
+    const __m128i high_products = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 15);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(samples + i),
+                     _mm_packs_epi32(low_products, high_products));
+  }
+#elif defined(_M_ARM_64)
+  for (; i + 8 <= count; i += 8)
+    vst1q_s16(samples + i, vqdmulhq_n_s16(vld1q_s16(samples + i), factor));
+#endif
+  for (; i < count; ++i)
+    samples[i] = static_cast<int16_t>((static_cast<int>(samples[i]) * factor) >> 15);
 }
 }  // namespace
 
@@ -36,10 +67,33 @@ LibretroAudioSampleBatch GetLibretroAudioSampleBatch()
   return s_audio_batch.load();
 }
 
+void SetLibretroAudioFramePaced(bool frame_paced)
+{
+  s_frame_paced.store(frame_paced);
+}
+
+void DrainLibretroAudio(double frame_rate)
+{
+  std::lock_guard lk(s_paced_stream_mutex);
+  if (s_paced_stream)
+    s_paced_stream->Drain(frame_rate);
+}
+
+void SetLibretroAudioSuppressed(bool suppressed)
+{
+  s_suppressed.store(suppressed, std::memory_order_relaxed);
+}
+
 LibretroSoundStream::LibretroSoundStream() = default;
 
 LibretroSoundStream::~LibretroSoundStream()
 {
+  if (m_frame_paced)
+  {
+    std::lock_guard lk(s_paced_stream_mutex);
+    s_paced_stream = nullptr;
+  }
+
   m_run_thread.Clear();
   if (m_thread.joinable())
     m_thread.join();
@@ -58,6 +112,15 @@ bool LibretroSoundStream::Init()
     return false;
   }
 
+  m_buffer.resize(BUFFER_FRAMES * CHANNELS);
+  m_frame_paced = s_frame_paced.load();
+  if (m_frame_paced)
+  {
+    std::lock_guard lk(s_paced_stream_mutex);
+    s_paced_stream = this;
+    return true;
+  }
+
   m_run_thread.Set();
   m_thread = std::thread(&LibretroSoundStream::SoundLoop, this);
   return true;
@@ -74,11 +137,55 @@ void LibretroSoundStream::SetVolume(int volume)
   m_volume.store(volume);
 }
 
+void LibretroSoundStream::Drain(double frame_rate)
+{
+  const uint32_t sample_rate = m_mixer->GetSampleRate();
+  if (!m_running.load() || frame_rate <= 0.0 || sample_rate == 0)
+    return;
+
+  // Carry the fractional part over so that the average matches the sample rate exactly.
+  m_pending_frames += sample_rate / frame_rate;
+  std::size_t frames = static_cast<std::size_t>(m_pending_frames);
+  m_pending_frames -= frames;
+
+  while (frames > 0)
+  {
+    const std::size_t mixed = MixAndSend(std::min(frames, BUFFER_FRAMES));
+    if (mixed == 0)
+      break;
+    frames -= mixed;
+  }
+}
+
+std::size_t LibretroSoundStream::MixAndSend(std::size_t frames)
+{
+  auto cb = GetLibretroAudioSampleBatch();
+  if (!cb)
+    return 0;
+
+  if (s_suppressed.load(std::memory_order_relaxed))
+  {
+    m_mixer->Skip(frames);
+    return frames;
+  }
+
+  frames = m_mixer->Mix(m_buffer.data(), frames);
+  if (frames == 0)
+    return 0;
+
+  const int volume = m_volume.load();
+  if (volume != 100)
+    ApplyVolume(m_buffer.data(), frames * CHANNELS, volume);
+
+  cb(m_buffer.data(), frames);
+  return frames;
+}
+
 void LibretroSoundStream::SoundLoop()
 {
   Common::SetCurrentThreadName("Audio thread - libretro");
+  Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
 
-  std::vector<int16_t> buffer(BUFFER_FRAMES * CHANNELS);
   const uint32_t sample_rate = m_mixer->GetSampleRate();
   const double buffer_seconds =
       sample_rate ? static_cast<double>(BUFFER_FRAMES) / sample_rate : 0.0;
@@ -86,36 +193,18 @@ void LibretroSoundStream::SoundLoop()
 
   while (m_run_thread.IsSet())
   {
-    if (!m_running.load())
+    if (!m_running.load() || !GetLibretroAudioSampleBatch())
     {
       std::this_thread::sleep_for(std::chrono::milliseconds(5));
       continue;
     }
 
-    auto cb = GetLibretroAudioSampleBatch();
-    if (!cb)
-    {
-      std::this_thread::sleep_for(std::chrono::milliseconds(5));
-      continue;
-    }
-
-    const std::size_t frames = m_mixer->Mix(buffer.data(), BUFFER_FRAMES);
-    if (frames == 0)
+    if (MixAndSend(BUFFER_FRAMES) == 0)
     {
       std::this_thread::sleep_for(std::chrono::milliseconds(1));
       continue;
     }
 
-    const int volume = m_volume.load();
-    if (volume != 100)
-    {
-      const std::size_t samples = frames * CHANNELS;
-      for (std::size_t i = 0; i < samples; ++i)
-        buffer[i] = ApplyVolume(buffer[i], volume);
-    }
-
-    cb(buffer.data(), frames);
-
     if (buffer_seconds > 0.0)
     {
       next_wake += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
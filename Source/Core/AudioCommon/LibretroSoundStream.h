@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <thread>
+#include <vector>
 
 #include "AudioCommon/SoundStream.h"
 #include "Common/Flag.h"
@@ -18,6 +19,17 @@ using LibretroAudioSampleBatch = std::size_t (*)(const int16_t* data, std::size_
 void SetLibretroAudioSampleBatch(LibretroAudioSampleBatch cb);
 LibretroAudioSampleBatch GetLibretroAudioSampleBatch();
 
+// When frame paced, no audio thread is started and the frontend thread pulls the samples for each
+// emulated frame with DrainLibretroAudio() instead. Applied when the stream is initialized.
+void SetLibretroAudioFramePaced(bool frame_paced);
+// Mixes the samples for one frame at frame_rate and hands them to the batch callback. Does nothing
+// unless a frame paced stream is running.
+void DrainLibretroAudio(double frame_rate);
+// While set, the input is consumed without being mixed or sent, for frames the frontend discards.
+// Set it before DrainLibretroAudio so that it covers exactly that frame. Without frame pacing the
+// audio thread runs on its own clock, so it only applies from its next buffer.
+void SetLibretroAudioSuppressed(bool suppressed);
+
 class LibretroSoundStream final : public SoundStream
 {
 public:
@@ -29,12 +41,19 @@ public:
   bool SetRunning(bool running) override;
   void SetVolume(int volume) override;
 
+  void Drain(double frame_rate);
+
 private:
   void SoundLoop();
+  // Mixes up to frames samples into m_buffer and sends them, returns the number of frames mixed.
+  std::size_t MixAndSend(std::size_t frames);
 
   std::thread m_thread;
   Common::Flag m_run_thread{false};
   std::atomic<bool> m_running{false};
   std::atomic<int> m_volume{100};
+  std::vector<int16_t> m_buffer;
+  bool m_frame_paced = false;
+  double m_pending_frames = 0.0;
 };
 }  // namespace AudioCommon
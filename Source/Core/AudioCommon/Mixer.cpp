@@ -10,12 +10,14 @@
 #include "AudioCommon/Enums.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/FrameProfiler.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/System.h"
+#include "VideoCommon/PerformanceMetrics.h"
 
 static u32 DPL2QualityToFrameBlockSize(AudioCommon::DPL2Quality quality)
 {
@@ -58,15 +60,8 @@ void Mixer::DoState(PointerWrap& p)
     mixer.DoState(p);
 }
 
-// Executed from sound stream thread
-void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
+double Mixer::MixerFifo::GetInputSampleRate() const
 {
-  constexpr u32 INDEX_HALF = 0x80000000;
-  constexpr DT_s FADE_IN_RC = DT_s(0.008);
-  constexpr DT_s FADE_OUT_RC = DT_s(0.064);
-
-  // We need at least a double because the index jump has 24 bits of fractional precision.
-  const double out_sample_rate = m_mixer->m_output_sample_rate;
   double in_sample_rate =
       static_cast<double>(FIXED_SAMPLE_RATE_DIVIDEND) / m_input_sample_rate_divisor;
 
@@ -74,8 +69,27 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
   if (0 < emulation_speed && emulation_speed != 1.0)
     in_sample_rate *= emulation_speed;
 
+  return in_sample_rate;
+}
+
+u32 Mixer::MixerFifo::GetIndexJump(double in_sample_rate) const
+{
+  // We need at least a double because the index jump has 24 bits of fractional precision.
+  const double out_sample_rate = m_mixer->m_output_sample_rate;
   const double base = static_cast<double>(1 << GRANULE_FRAC_BITS);
-  const u32 index_jump = std::lround(base * in_sample_rate / out_sample_rate);
+  return std::lround(base * in_sample_rate / out_sample_rate);
+}
+
+// Executed from sound stream thread
+void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
+{
+  constexpr u32 INDEX_HALF = 0x80000000;
+  constexpr DT_s FADE_IN_RC = DT_s(0.008);
+  constexpr DT_s FADE_OUT_RC = DT_s(0.064);
+
+  const double out_sample_rate = m_mixer->m_output_sample_rate;
+  const double in_sample_rate = GetInputSampleRate();
+  const u32 index_jump = GetIndexJump(in_sample_rate);
 
   // These fade in / out multiplier are tuned to match a constant
   // fade speed regardless of the input or the output sample rate.
@@ -85,7 +99,9 @@ void Mixer::MixerFifo::Mix(s16* samples, std::size_t num_samples)
   const StereoPair volume{m_LVolume.load() / 256.0f, m_RVolume.load() / 256.0f};
 
   // Calculate the ideal length of the granule queue.
-  const std::size_t buffer_size_ms = m_mixer->m_config_audio_buffer_ms;
+  double buffer_size_ms = m_mixer->m_config_audio_buffer_ms;
+  if (m_mixer->m_config_audio_low_latency)
+    buffer_size_ms = std::min(buffer_size_ms, m_mixer->m_low_latency_buffer_ms);
   const std::size_t buffer_size_samples = std::llround(buffer_size_ms * in_sample_rate / 1000.0);
 
   // Limit the possible queue sizes to any number between 4 and 64.
@@ -165,8 +181,13 @@ std::size_t Mixer::Mix(s16* samples, std::size_t num_samples)
   if (!samples)
     return 0;
 
+  Common::FrameProfiler::Scope profiler_scope(Common::FrameProfiler::Stage::AudioMix);
+
   memset(samples, 0, num_samples * 2 * sizeof(s16));
 
+  if (m_config_audio_low_latency && IsOutputSampleRateValid())
+    UpdateLowLatencyBuffer(num_samples);
+
   m_dma_mixer.Mix(samples, num_samples);
   m_streaming_mixer.Mix(samples, num_samples);
   m_wiimote_speaker_mixer.Mix(samples, num_samples);
@@ -174,9 +195,39 @@ std::size_t Mixer::Mix(s16* samples, std::size_t num_samples)
   for (auto& mixer : m_gba_mixers)
     mixer.Mix(samples, num_samples);
 
+  g_perf_metrics.SetAudioLatency(m_dma_mixer.GetQueuedDuration() +
+                                 m_output_latency.load(std::memory_order_relaxed));
+
   return num_samples;
 }
 
+// Executed from sound stream thread
+void Mixer::MixerFifo::Skip(std::size_t num_samples)
+{
+  constexpr u32 INDEX_HALF = 0x80000000;
+
+  // Walk the indexes exactly like Mix() does, so the queue drains at the same rate.
+  const u32 index_jump = GetIndexJump(GetInputSampleRate());
+  while (num_samples-- > 0)
+  {
+    m_current_index += index_jump;
+    if (m_current_index < index_jump)
+      Dequeue(&m_front);
+    else if (m_current_index + INDEX_HALF < index_jump)
+      Dequeue(&m_back);
+  }
+}
+
+void Mixer::Skip(std::size_t num_samples)
+{
+  m_dma_mixer.Skip(num_samples);
+  m_streaming_mixer.Skip(num_samples);
+  m_wiimote_speaker_mixer.Skip(num_samples);
+  m_skylander_portal_mixer.Skip(num_samples);
+  for (auto& mixer : m_gba_mixers)
+    mixer.Skip(num_samples);
+}
+
 std::size_t Mixer::MixSurround(float* samples, std::size_t num_samples)
 {
   if (!num_samples)
@@ -233,6 +284,21 @@ void Mixer::PushSamples(const s16* samples, std::size_t num_samples)
     m_dma_mixer.PushSamples(samples, num_samples);
   }
 
+  if (m_config_audio_low_latency)
+  {
+    const TimePoint now = Clock::now();
+    if (m_last_push_time)
+    {
+      const double interval_ms = DT_ms(now - *m_last_push_time).count();
+      const double peak_ms = m_push_interval_peak_ms.load(std::memory_order_relaxed);
+      m_push_interval_peak_ms.store(
+          std::max(std::min<double>(interval_ms, m_config_audio_buffer_ms),
+                   peak_ms * std::exp(-interval_ms / LOW_LATENCY_PEAK_DECAY_MS)),
+          std::memory_order_relaxed);
+    }
+    m_last_push_time = now;
+  }
+
   if (m_log_dsp_audio)
   {
     const s32 sample_rate_divisor = m_dma_mixer.GetInputSampleRateDivisor();
@@ -427,11 +493,41 @@ void Mixer::StopLogDSPAudio()
   }
 }
 
+// Executed from sound stream thread
+void Mixer::UpdateLowLatencyBuffer(std::size_t num_samples)
+{
+  const TimePoint now = Clock::now();
+  if (m_last_mix_time)
+  {
+    // A long gap (like a pause) is only held on to for as long as the buffer size, and a peak
+    // decays over a few seconds, so that a single hiccup doesn't keep the latency up for long.
+    const double interval_ms = DT_ms(now - *m_last_mix_time).count();
+    m_mix_interval_peak_ms =
+        std::max(std::min<double>(interval_ms, m_config_audio_buffer_ms),
+                 m_mix_interval_peak_ms * std::exp(-interval_ms / LOW_LATENCY_PEAK_DECAY_MS));
+
+    // Each callback also takes its samples all at once.
+    const double request_ms = 1000.0 * num_samples / m_output_sample_rate;
+    m_low_latency_buffer_ms = m_mix_interval_peak_ms + request_ms + LOW_LATENCY_MARGIN_MS +
+                              m_push_interval_peak_ms.load(std::memory_order_relaxed);
+  }
+  m_last_mix_time = now;
+}
+
 void Mixer::RefreshConfig()
 {
   m_config_emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
   m_config_fill_audio_gaps = Config::Get(Config::MAIN_AUDIO_FILL_GAPS);
   m_config_audio_buffer_ms = Config::Get(Config::MAIN_AUDIO_BUFFER_SIZE);
+  m_config_audio_low_latency = Config::Get(Config::MAIN_AUDIO_LOW_LATENCY);
+}
+
+DT Mixer::MixerFifo::GetQueuedDuration() const
+{
+  const std::size_t head = m_queue_head.load(std::memory_order_acquire);
+  const std::size_t tail = m_queue_tail.load(std::memory_order_acquire);
+  const double queued_samples = ((head - tail) & GRANULE_QUEUE_MASK) * GRANULE_OVERLAP;
+  return std::chrono::duration_cast<DT>(DT_s(queued_samples / GetInputSampleRate()));
 }
 
 void Mixer::MixerFifo::DoState(PointerWrap& p)
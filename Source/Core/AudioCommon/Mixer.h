@@ -6,6 +6,8 @@
 #include <array>
 #include <atomic>
 #include <bit>
+#include <limits>
+#include <optional>
 
 #include "AudioCommon/SurroundDecoder.h"
 #include "AudioCommon/WaveFile.h"
@@ -25,6 +27,9 @@ public:
   // Called from audio threads
   std::size_t Mix(s16* samples, std::size_t numSamples);
   std::size_t MixSurround(float* samples, std::size_t num_samples);
+  // Consumes num_samples output samples worth of input without resampling it, for frames whose
+  // audio is never played (e.g. speculative frames when a libretro frontend runs ahead).
+  void Skip(std::size_t num_samples);
 
   // Called from main thread
   void PushSamples(const s16* samples, std::size_t num_samples);
@@ -40,6 +45,9 @@ public:
   // Note: NullSoundStream sets the sample rate to 0.
   bool IsOutputSampleRateValid() const { return m_output_sample_rate != 0; }
 
+  // Called by the backend with how long it takes for mixed samples to be played.
+  void SetOutputLatency(DT latency) { m_output_latency.store(latency, std::memory_order_relaxed); }
+
   void SetDMAInputSampleRateDivisor(u32 rate_divisor);
   void SetStreamInputSampleRateDivisor(u32 rate_divisor);
   void SetGBAInputSampleRateDivisors(std::size_t device_number, u32 rate_divisor);
@@ -59,6 +67,8 @@ public:
 
 private:
   const std::size_t SURROUND_CHANNELS = 6;
+  static constexpr double LOW_LATENCY_PEAK_DECAY_MS = 5000;
+  static constexpr double LOW_LATENCY_MARGIN_MS = 4;
 
   class MixerFifo final
   {
@@ -108,10 +118,12 @@ private:
     void DoState(PointerWrap& p);
     void PushSamples(const s16* samples, std::size_t num_samples);
     void Mix(s16* samples, std::size_t num_samples);
+    void Skip(std::size_t num_samples);
     void SetInputSampleRateDivisor(u32 rate_divisor);
     u32 GetInputSampleRateDivisor() const;
     void SetVolume(u32 lvolume, u32 rvolume);
     std::pair<s32, s32> GetVolume() const;
+    DT GetQueuedDuration() const;
 
   private:
     Mixer* m_mixer;
@@ -134,6 +146,8 @@ private:
 
     void Enqueue();
     bool Dequeue(Granule* granule);
+    double GetInputSampleRate() const;
+    u32 GetIndexJump(double in_sample_rate) const;
 
     // Volume ranges from 0-256
     std::atomic<s32> m_LVolume{256};
@@ -143,6 +157,7 @@ private:
   };
 
   void RefreshConfig();
+  void UpdateLowLatencyBuffer(std::size_t num_samples);
 
   MixerFifo m_dma_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 32000, false};
   MixerFifo m_streaming_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 48000, false};
@@ -165,6 +180,18 @@ private:
   float m_config_emulation_speed;
   bool m_config_fill_audio_gaps;
   int m_config_audio_buffer_ms;
+  bool m_config_audio_low_latency;
+
+  // Low latency mode buffers just enough to get through the longest recent gap between two audio
+  // callbacks plus the longest recent gap between two pushes of DMA samples, instead of the audio
+  // buffer size, which it never goes over.
+  std::optional<TimePoint> m_last_mix_time;
+  double m_mix_interval_peak_ms = 0;
+  double m_low_latency_buffer_ms = std::numeric_limits<double>::infinity();
+  std::optional<TimePoint> m_last_push_time;
+  std::atomic<double> m_push_interval_peak_ms{0};
+
+  std::atomic<DT> m_output_latency{};
 
   Config::ConfigChangedCallbackID m_config_changed_callback_id;
 };
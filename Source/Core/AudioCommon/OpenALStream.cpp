@@ -210,6 +210,7 @@ static bool IsCreativeXFi()
 void OpenALStream::SoundLoop()
 {
   Common::SetCurrentThreadName("Audio thread - openal");
+  Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
 
   bool const float32_capable = palIsExtensionPresent("AL_EXT_float32") != 0;
   bool const surround_capable = palIsExtensionPresent("AL_EXT_MCFORMATS") || IsCreativeXFi();
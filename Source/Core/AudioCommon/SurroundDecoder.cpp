@@ -33,7 +33,9 @@ size_t SurroundDecoder::QueryFramesNeededForSurroundOutput(const size_t output_f
   {
     // Output stereo frames needed to have at least the desired number of surround frames
     size_t const frames_needed = output_frames - m_decoded_fifo.size() / SURROUND_CHANNELS;
-    return frames_needed + m_frame_block_size - frames_needed % m_frame_block_size;
+
+    // Round up to whole blocks. Decoding a block more than that would only add latency.
+    return (frames_needed + m_frame_block_size - 1) / m_frame_block_size * m_frame_block_size;
   }
 
   return 0;
@@ -48,12 +50,11 @@ void SurroundDecoder::PutFrames(const short* in, const size_t num_frames_in)
 
   while (remaining_frames > 0)
   {
-    // Convert to float
+    // Convert to float, multiplying being cheaper than dividing every sample
+    constexpr float scale = 1.0f / std::numeric_limits<short>::max();
+    const short* block = in + frame_index * STEREO_CHANNELS;
     for (size_t i = 0, end = m_frame_block_size * STEREO_CHANNELS; i < end; ++i)
-    {
-      m_float_conversion_buffer[i] = in[i + frame_index * STEREO_CHANNELS] /
-                                     static_cast<float>(std::numeric_limits<short>::max());
-    }
+      m_float_conversion_buffer[i] = block[i] * scale;
 
     // Decode
     const float* dpl2_fs = m_fsdecoder->decode(m_float_conversion_buffer.data());
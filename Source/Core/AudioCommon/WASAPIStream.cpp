@@ -8,6 +8,7 @@
 // clang-format off
 #include <initguid.h>
 #include <Audioclient.h>
+#include <avrt.h>
 #include <mmdeviceapi.h>
 #include <functiondiscoverykeys_devpkey.h>
 #include <wil/resource.h>
@@ -18,6 +19,7 @@
 #include "Common/Assert.h"
 #include "Common/HRWrap.h"
 #include "Common/Logging/Log.h"
+#include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
 #include "Core/Config/MainSettings.h"
@@ -219,9 +221,13 @@ bool WASAPIStream::SetRunning(bool running)
 
     REFERENCE_TIME device_period = 0;
 
+    // This is the minimum period of the device. Low latency mode leaves the rest of the buffering
+    // to the mixer, which sizes it from the measured timing of the callbacks.
     result = audio_client->GetDevicePeriod(nullptr, &device_period);
 
-    device_period += Config::Get(Config::MAIN_AUDIO_LATENCY) * (10000 / m_format.Format.nChannels);
+    const bool low_latency = Config::Get(Config::MAIN_AUDIO_LOW_LATENCY);
+    const int extra_latency_ms = low_latency ? 0 : Config::Get(Config::MAIN_AUDIO_LATENCY);
+    device_period += extra_latency_ms * (10000 / m_format.Format.nChannels);
     INFO_LOG_FMT(AUDIO, "Audio period set to {}", device_period);
 
     if (!HandleWinAPI("Failed to obtain device period", result))
@@ -257,7 +263,7 @@ bool WASAPIStream::SetRunning(bool running)
       device_period =
           static_cast<REFERENCE_TIME>(
               10000.0 * 1000 * m_frames_in_buffer / m_format.Format.nSamplesPerSec + 0.5) +
-          Config::Get(Config::MAIN_AUDIO_LATENCY) * 10000;
+          extra_latency_ms * 10000;
 
       result = audio_client->Initialize(
           AUDCLNT_SHAREMODE_EXCLUSIVE,
@@ -273,6 +279,17 @@ bool WASAPIStream::SetRunning(bool running)
     if (!HandleWinAPI("Failed to get buffer size from IAudioClient", result))
       return false;
 
+    // In exclusive mode, the buffer is played by the device directly, on top of its own latency.
+    REFERENCE_TIME stream_latency = 0;
+    if (FAILED(audio_client->GetStreamLatency(&stream_latency)))
+      stream_latency = 0;
+    const DT_s buffer_duration(static_cast<double>(m_frames_in_buffer) /
+                               m_format.Format.nSamplesPerSec);
+    GetMixer()->SetOutputLatency(
+        std::chrono::duration_cast<DT>(buffer_duration + DT_s(stream_latency / 10000000.0)));
+    INFO_LOG_FMT(AUDIO, "WASAPI: {} frames in buffer, stream latency {}", m_frames_in_buffer,
+                 stream_latency);
+
     ComPtr<IAudioRenderClient> audio_renderer;
 
     result = audio_client->GetService(IID_PPV_ARGS(&audio_renderer));
@@ -318,6 +335,18 @@ bool WASAPIStream::SetRunning(bool running)
 void WASAPIStream::SoundLoop()
 {
   Common::SetCurrentThreadName("WASAPI Handler");
+
+  // Have MMCSS schedule the thread ahead of everything else that isn't audio, so that a busy
+  // system doesn't make it miss the short periods of exclusive mode.
+  DWORD task_index = 0;
+  const HANDLE mmcss_handle = AvSetMmThreadCharacteristicsW(L"Pro Audio", &task_index);
+  if (!mmcss_handle)
+    WARN_LOG_FMT(AUDIO, "WASAPI: Failed to register with MMCSS: {}", GetLastError());
+  Common::ScopeGuard mmcss_guard([mmcss_handle] {
+    if (mmcss_handle)
+      AvRevertMmThreadCharacteristics(mmcss_handle);
+  });
+
   BYTE* data;
 
   m_audio_renderer->GetBuffer(m_frames_in_buffer, &data);
@@ -3,7 +3,9 @@
 
 #include "AudioCommon/WaveFile.h"
 
+#include <functional>
 #include <string>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -18,8 +20,6 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 
-constexpr size_t WaveFileWriter::BUFFER_SIZE;
-
 WaveFileWriter::WaveFileWriter()
 {
 }
@@ -30,6 +30,33 @@ WaveFileWriter::~WaveFileWriter()
 }
 
 bool WaveFileWriter::Start(const std::string& filename, u32 sample_rate_divisor)
+{
+  if (m_started)
+  {
+    PanicAlertFmtT("The file {0} was already open, the file header will not be written.", filename);
+    return false;
+  }
+
+  if (!Open(filename, sample_rate_divisor))
+    return false;
+
+  m_started = true;
+  m_writer.Reset("Audio Dumper", std::bind_front(&WaveFileWriter::WriteChunk, this));
+  return true;
+}
+
+void WaveFileWriter::Stop()
+{
+  if (!m_started)
+    return;
+
+  // Writes everything that was added before closing the file
+  m_writer.Shutdown();
+  m_started = false;
+  Close();
+}
+
+bool WaveFileWriter::Open(const std::string& filename, u32 sample_rate_divisor)
 {
   // Ask to delete file
   if (File::Exists(filename))
@@ -46,13 +73,6 @@ bool WaveFileWriter::Start(const std::string& filename, u32 sample_rate_divisor)
     }
   }
 
-  // Check if the file is already open
-  if (m_file)
-  {
-    PanicAlertFmtT("The file {0} was already open, the file header will not be written.", filename);
-    return false;
-  }
-
   m_file.Open(filename, "wb");
   if (!m_file)
   {
@@ -96,8 +116,11 @@ bool WaveFileWriter::Start(const std::string& filename, u32 sample_rate_divisor)
   return true;
 }
 
-void WaveFileWriter::Stop()
+void WaveFileWriter::Close()
 {
+  if (!m_file)
+    return;
+
   m_file.Seek(4, File::SeekOrigin::Begin);
   Write(m_audio_size + 36);
 
@@ -120,18 +143,12 @@ void WaveFileWriter::Write4(const char* ptr)
 void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count,
                                         u32 sample_rate_divisor, int l_volume, int r_volume)
 {
-  if (!m_file)
+  if (!m_started)
   {
     ERROR_LOG_FMT(AUDIO, "WaveFileWriter - file not open.");
     return;
   }
 
-  if (count * 2 > BUFFER_SIZE)
-  {
-    ERROR_LOG_FMT(AUDIO, "WaveFileWriter - buffer too small (count = {}).", count);
-    return;
-  }
-
   if (m_skip_silence)
   {
     bool all_zero = true;
@@ -146,27 +163,37 @@ void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count,
       return;
   }
 
+  Chunk chunk{std::vector<short>(count * 2), sample_rate_divisor};
   for (u32 i = 0; i < count; i++)
   {
     // Flip the audio channels from RL to LR
-    m_conv_buffer[2 * i] = Common::swap16((u16)sample_data[2 * i + 1]);
-    m_conv_buffer[2 * i + 1] = Common::swap16((u16)sample_data[2 * i]);
+    chunk.samples[2 * i] = Common::swap16((u16)sample_data[2 * i + 1]);
+    chunk.samples[2 * i + 1] = Common::swap16((u16)sample_data[2 * i]);
 
     // Apply volume (volume ranges from 0 to 256)
-    m_conv_buffer[2 * i] = m_conv_buffer[2 * i] * l_volume / 256;
-    m_conv_buffer[2 * i + 1] = m_conv_buffer[2 * i + 1] * r_volume / 256;
+    chunk.samples[2 * i] = chunk.samples[2 * i] * l_volume / 256;
+    chunk.samples[2 * i + 1] = chunk.samples[2 * i + 1] * r_volume / 256;
   }
 
-  if (sample_rate_divisor != m_current_sample_rate_divisor)
+  m_writer.Push(std::move(chunk));
+}
+
+void WaveFileWriter::WriteChunk(Chunk chunk)
+{
+  if (chunk.sample_rate_divisor != m_current_sample_rate_divisor)
   {
-    Stop();
+    Close();
     m_file_index++;
     const std::string filename =
         fmt::format("{}{}{}.wav", File::GetUserPath(D_DUMPAUDIO_IDX), m_basename, m_file_index);
-    Start(filename, sample_rate_divisor);
-    m_current_sample_rate_divisor = sample_rate_divisor;
+    Open(filename, chunk.sample_rate_divisor);
+    m_current_sample_rate_divisor = chunk.sample_rate_divisor;
   }
 
-  m_file.WriteBytes(m_conv_buffer.data(), count * 4);
-  m_audio_size += count * 4;
+  if (!m_file)
+    return;
+
+  const u32 size = static_cast<u32>(chunk.samples.size() * sizeof(short));
+  m_file.WriteBytes(chunk.samples.data(), size);
+  m_audio_size.fetch_add(size, std::memory_order_relaxed);
 }
@@ -9,15 +9,19 @@
 // The float variant will convert from -1.0-1.0 range and clamp.
 // Alternatively, AddSamplesBE for big endian wave data.
 // If Stop is not called when it destructs, the destructor will call Stop().
+// The samples are written to disk on a separate thread, so that a slow disk can't hold up the
+// thread adding them.
 // ---------------------------------------------------------------------------------
 
 #pragma once
 
-#include <array>
+#include <atomic>
 #include <string>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/WorkQueueThread.h"
 
 class WaveFileWriter
 {
@@ -37,21 +41,32 @@ public:
   // big endian
   void AddStereoSamplesBE(const short* sample_data, u32 count, u32 sample_rate_divisor,
                           int l_volume, int r_volume);
-  u32 GetAudioSize() const { return m_audio_size; }
+  u32 GetAudioSize() const { return m_audio_size.load(std::memory_order_relaxed); }
 
 private:
-  static constexpr size_t BUFFER_SIZE = 32 * 1024;
+  struct Chunk
+  {
+    std::vector<short> samples;
+    u32 sample_rate_divisor;
+  };
+
+  bool Open(const std::string& filename, u32 sample_rate_divisor);
+  void Close();
+  void WriteChunk(Chunk chunk);
 
   void Write(u32 value);
   void Write4(const char* ptr);
 
+  // Everything but m_started and m_skip_silence belongs to the writer thread while it's running.
+  Common::WorkQueueThreadSP<Chunk> m_writer;
+  bool m_started = false;
+
   File::IOFile m_file;
   std::string m_basename;
   u32 m_file_index = 0;
-  u32 m_audio_size = 0;
+  std::atomic<u32> m_audio_size = 0;
 
   u32 m_current_sample_rate_divisor;
-  std::array<short, BUFFER_SIZE> m_conv_buffer{};
 
   bool m_skip_silence = false;
 };
@@ -0,0 +1,86 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/ChunkFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include "Common/WorkQueueThread.h"
+
+namespace
+{
+struct CopyBatch
+{
+  std::span<const PointerWrap::DeferredCopy> pieces;
+  std::latch* done;
+};
+
+void CopyPieces(std::span<const PointerWrap::DeferredCopy> pieces)
+{
+  for (const PointerWrap::DeferredCopy& piece : pieces)
+    std::memcpy(piece.destination, piece.source, piece.size);
+}
+
+// The copy threads are started on the first flush and kept for later savestates. The calling
+// thread does a share of the copies itself, so there is one thread fewer than there are cores.
+std::mutex s_copy_threads_lock;
+std::vector<std::unique_ptr<Common::WorkQueueThreadSP<CopyBatch>>> s_copy_threads;
+
+void StartCopyThreads()
+{
+  const size_t thread_count = std::max<size_t>(std::thread::hardware_concurrency(), 1) - 1;
+  for (size_t i = s_copy_threads.size(); i < thread_count; ++i)
+  {
+    s_copy_threads.push_back(std::make_unique<Common::WorkQueueThreadSP<CopyBatch>>(
+        fmt::format("Savestate Copy {}", i), [](CopyBatch batch) {
+          CopyPieces(batch.pieces);
+          batch.done->count_down();
+        }));
+  }
+}
+}  // namespace
+
+void PointerWrap::FlushDeferredCopies()
+{
+  if (m_deferred_copies.empty())
+    return;
+
+  // Split the copies into pieces, so that a single large array is spread over all threads too.
+  constexpr size_t PIECE_SIZE = MIN_DEFERRED_COPY_SIZE;
+  std::vector<DeferredCopy> pieces;
+  for (const DeferredCopy& copy : m_deferred_copies)
+  {
+    for (size_t offset = 0; offset < copy.size; offset += PIECE_SIZE)
+    {
+      pieces.push_back({copy.destination + offset, copy.source + offset,
+                        std::min(PIECE_SIZE, copy.size - offset)});
+    }
+  }
+  m_deferred_copies.clear();
+
+  // One flush at a time, since the copy threads only take work from a single producer.
+  std::lock_guard lk(s_copy_threads_lock);
+  StartCopyThreads();
+
+  const size_t part_count = std::min(pieces.size(), s_copy_threads.size() + 1);
+  const std::span<const DeferredCopy> all_pieces(pieces);
+
+  std::latch done(static_cast<std::ptrdiff_t>(part_count - 1));
+  for (size_t i = 1; i < part_count; ++i)
+  {
+    const size_t start = i * pieces.size() / part_count;
+    const size_t end = (i + 1) * pieces.size() / part_count;
+    s_copy_threads[i - 1]->Push({all_pieces.subspan(start, end - start), &done});
+  }
+
+  CopyPieces(all_pieces.first(pieces.size() / part_count));
+  done.wait();
+}
@@ -45,10 +45,22 @@ public:
     Verify,
   };
 
+  struct DeferredCopy
+  {
+    u8* destination;
+    const u8* source;
+    size_t size;
+  };
+
+  // Arrays at least this large may be deferred by DoDeferrableArray.
+  static constexpr size_t MIN_DEFERRED_COPY_SIZE = 1024 * 1024;
+
 private:
   u8** m_ptr_current;
   u8* m_ptr_end;
   Mode m_mode;
+  bool m_defer_copies = false;
+  std::vector<DeferredCopy> m_deferred_copies;
 
 public:
   PointerWrap(u8** ptr, size_t size, Mode mode)
@@ -63,6 +75,12 @@ public:
   bool IsMeasureMode() const { return m_mode == Mode::Measure; }
   bool IsVerifyMode() const { return m_mode == Mode::Verify; }
 
+  // While enabled, DoDeferrableArray() only claims the space for large arrays and queues the
+  // actual copy. FlushDeferredCopies() then runs all queued copies concurrently; it must be called
+  // before anything reads the copied data, and before the PointerWrap goes away.
+  void EnableDeferredCopies() { m_defer_copies = true; }
+  void FlushDeferredCopies();
+
   template <typename K, class V>
   void Do(std::map<K, V>& x)
   {
@@ -72,12 +90,13 @@ public:
     switch (m_mode)
     {
     case Mode::Read:
+      // The elements were saved in order, so every one of them is inserted at the end.
       for (x.clear(); count != 0; --count)
       {
         std::pair<K, V> pair;
         Do(pair.first);
         Do(pair.second);
-        x.insert(pair);
+        x.insert(x.end(), std::move(pair));
       }
       break;
 
@@ -106,7 +125,7 @@ public:
       {
         V value = {};
         Do(value);
-        x.insert(value);
+        x.insert(x.end(), std::move(value));
       }
       break;
 
@@ -201,6 +220,34 @@ public:
     DoVoid(x, count * sizeof(T));
   }
 
+  template <typename T>
+  requires(std::is_trivially_copyable_v<T>)
+  void DoDeferrableArray(T* x, u32 count)
+  {
+    const size_t size = static_cast<size_t>(count) * sizeof(T);
+    if (!m_defer_copies || size < MIN_DEFERRED_COPY_SIZE || !(IsReadMode() || IsWriteMode()))
+    {
+      DoArray(x, count);
+      return;
+    }
+
+    if ((*m_ptr_current + size) > m_ptr_end)
+    {
+      // trying to read/write past the end of the buffer, prevent this
+      SetMeasureMode();
+    }
+    else if (IsReadMode())
+    {
+      m_deferred_copies.push_back({reinterpret_cast<u8*>(x), *m_ptr_current, size});
+    }
+    else
+    {
+      m_deferred_copies.push_back({*m_ptr_current, reinterpret_cast<const u8*>(x), size});
+    }
+
+    *m_ptr_current += size;
+  }
+
   template <typename T>
   requires(!std::is_trivially_copyable_v<T>)
   void DoArray(T* x, u32 count)
@@ -346,10 +393,19 @@ private:
 
   DOLPHIN_FORCE_INLINE void DoVoid(void* data, u32 size)
   {
-    if (!IsMeasureMode() && (*m_ptr_current + size) > m_ptr_end)
+    // The measure pass runs DoState over the whole state too, so it only advances the pointer.
+    if (IsMeasureMode())
+    {
+      *m_ptr_current += size;
+      return;
+    }
+
+    if ((*m_ptr_current + size) > m_ptr_end)
     {
       // trying to read/write past the end of the buffer, prevent this
       SetMeasureMode();
+      *m_ptr_current += size;
+      return;
     }
 
     switch (m_mode)
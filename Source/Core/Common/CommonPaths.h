@@ -59,6 +59,7 @@
 #define LOAD_DIR "Load"
 #define HIRES_TEXTURES_DIR "Textures"
 #define RIIVOLUTION_DIR "Riivolution"
+#define SHADERUIDS_DIR "ShaderUIDs"
 #define DUMP_DIR "Dump"
 #define DUMP_TEXTURES_DIR "Textures"
 #define DUMP_FRAMES_DIR "Frames"
@@ -124,6 +125,7 @@
 // Files in the directory returned by GetUserPath(D_MEMORYWATCHER_IDX)
 #define MEMORYWATCHER_LOCATIONS "Locations.txt"
 #define MEMORYWATCHER_SOCKET "MemoryWatcher"
+#define MEMORYWATCHER_RING "MemoryWatcherRing"
 
 // Sys files
 #define TOTALDB "totaldb.dsy"
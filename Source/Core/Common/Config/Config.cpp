@@ -29,6 +29,72 @@ static std::recursive_mutex s_callbacks_lock;
 using ReadLock = std::shared_lock<std::shared_mutex>;
 using WriteLock = std::unique_lock<std::shared_mutex>;
 
+namespace
+{
+struct ResolvedValue
+{
+  std::string value;
+  LayerType layer;
+};
+
+// The value of every location that is set in any layer, from the first layer in SEARCH_ORDER that
+// sets it. It is never modified after it's published, so that readers don't need to lock it.
+struct ResolvedConfig
+{
+  u64 config_version;
+  std::map<Location, ResolvedValue> values;
+};
+}  // namespace
+
+// Rebuilt when it's read after the config changed, so that a batch of changes rebuilds it once.
+// Each thread keeps a reference to the one it last read, and only takes the lock to get a new one.
+static std::mutex s_resolved_config_lock;
+static std::shared_ptr<const ResolvedConfig> s_resolved_config;
+static thread_local std::shared_ptr<const ResolvedConfig> t_resolved_config;
+
+static std::shared_ptr<const ResolvedConfig> BuildResolvedConfig(u64 config_version)
+{
+  auto resolved = std::make_shared<ResolvedConfig>();
+  resolved->config_version = config_version;
+
+  ReadLock lock(s_layers_rw_lock);
+
+  for (auto layer : SEARCH_ORDER)
+  {
+    const auto it = s_layers.find(layer);
+    if (it == s_layers.end())
+      continue;
+
+    for (const auto& [location, value] : it->second->GetLayerMap())
+    {
+      if (value.has_value())
+        resolved->values.try_emplace(location, ResolvedValue{*value, layer});
+    }
+  }
+
+  return resolved;
+}
+
+static const ResolvedConfig& GetResolvedConfig()
+{
+  const u64 config_version = s_config_version.load(std::memory_order_acquire);
+  if (t_resolved_config && t_resolved_config->config_version >= config_version) [[likely]]
+    return *t_resolved_config;
+
+  std::lock_guard lock(s_resolved_config_lock);
+
+  if (!s_resolved_config || s_resolved_config->config_version < config_version)
+    s_resolved_config = BuildResolvedConfig(config_version);
+  t_resolved_config = s_resolved_config;
+  return *t_resolved_config;
+}
+
+// Invalidates the cached and resolved values without calling the callbacks.
+static void IncrementConfigVersion()
+{
+  s_config_version.fetch_add(1, std::memory_order_acq_rel);
+}
+
 static void AddLayerInternal(std::shared_ptr<Layer> layer)
 {
   {
@@ -95,7 +161,7 @@ void OnConfigChanged()
   // Increment the config version to invalidate caches.
   // To ensure that getters do not return stale data, this should always be done
   // even when callbacks are suppressed.
-  s_config_version.fetch_add(1, std::memory_order_relaxed);
+  IncrementConfigVersion();
 
   if (s_callback_guards)
     return;
@@ -142,16 +208,26 @@ void Init()
 
 void Shutdown()
 {
-  WriteLock lock(s_layers_rw_lock);
+  {
+    WriteLock lock(s_layers_rw_lock);
 
-  s_layers.clear();
+    s_layers.clear();
+  }
+  IncrementConfigVersion();
+
+  std::lock_guard lock(s_resolved_config_lock);
+  s_resolved_config.reset();
 }
 
 void ClearCurrentRunLayer()
 {
-  WriteLock lock(s_layers_rw_lock);
+  {
+    WriteLock lock(s_layers_rw_lock);
 
-  s_layers.insert_or_assign(LayerType::CurrentRun, std::make_shared<Layer>(LayerType::CurrentRun));
+    s_layers.insert_or_assign(LayerType::CurrentRun,
+                              std::make_shared<Layer>(LayerType::CurrentRun));
+  }
+  IncrementConfigVersion();
 }
 
 static const std::map<System, std::string> system_to_name = {
@@ -198,39 +274,21 @@ const std::string& GetLayerName(LayerType layer)
 
 LayerType GetActiveLayerForConfig(const Location& config)
 {
-  ReadLock lock(s_layers_rw_lock);
-
-  for (auto layer : SEARCH_ORDER)
-  {
-    const auto it = s_layers.find(layer);
-    if (it != s_layers.end())
-    {
-      if (it->second->Exists(config))
-        return layer;
-    }
-  }
+  const ResolvedConfig& resolved = GetResolvedConfig();
+  const auto it = resolved.values.find(config);
 
   // If config is not present in any layer, base layer is considered active.
-  return LayerType::Base;
+  return it != resolved.values.end() ? it->second.layer : LayerType::Base;
 }
 
 std::optional<std::string> GetAsString(const Location& config)
 {
-  std::optional<std::string> result;
-  ReadLock lock(s_layers_rw_lock);
-
-  for (auto layer : SEARCH_ORDER)
-  {
-    const auto it = s_layers.find(layer);
-    if (it != s_layers.end())
-    {
-      result = it->second->Get<std::string>(config);
-      if (result.has_value())
-        break;
-    }
-  }
+  const ResolvedConfig& resolved = GetResolvedConfig();
+  const auto it = resolved.values.find(config);
+  if (it == resolved.values.end())
+    return std::nullopt;
 
-  return result;
+  return it->second.value;
 }
 
 ConfigChangeCallbackGuard::ConfigChangeCallbackGuard()
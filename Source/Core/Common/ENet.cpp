@@ -3,6 +3,9 @@
 
 #include "Common/ENet.h"
 
+#include <bit>
+#include <cstring>
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 
@@ -37,7 +40,7 @@ int ENET_CALLBACK InterceptCallback(ENetHost* host, ENetEvent* event)
   return 0;
 }
 
-bool SendPacket(ENetPeer* socket, const sf::Packet& packet, u8 channel_id)
+bool SendPacket(ENetPeer* socket, const sf::Packet& packet, u8 channel_id, u32 flags)
 {
   if (!socket)
   {
@@ -45,8 +48,7 @@ bool SendPacket(ENetPeer* socket, const sf::Packet& packet, u8 channel_id)
     return false;
   }
 
-  ENetPacket* epac =
-      enet_packet_create(packet.getData(), packet.getDataSize(), ENET_PACKET_FLAG_RELIABLE);
+  ENetPacket* epac = enet_packet_create(packet.getData(), packet.getDataSize(), flags);
   if (!epac)
   {
     ERROR_LOG_FMT(NETPLAY, "Failed to create ENetPacket ({} bytes).", packet.getDataSize());
@@ -62,4 +64,102 @@ bool SendPacket(ENetPeer* socket, const sf::Packet& packet, u8 channel_id)
 
   return true;
 }
+
+bool SendPacket(ENetPeer* socket, ENetPacket* packet, u8 channel_id)
+{
+  const int result = socket ? enet_peer_send(socket, channel_id, packet) : -1;
+  if (result != 0)
+  {
+    ERROR_LOG_FMT(NETPLAY, "Failed to send ENetPacket (error code {}).", result);
+    if (packet->referenceCount == 0)
+      enet_packet_destroy(packet);
+    return false;
+  }
+
+  return true;
+}
+
+ENetPacket* PacketPool::CreatePacket(const WirePacket& packet, u32 flags)
+{
+  if (!packet.IsValid())
+  {
+    ERROR_LOG_FMT(NETPLAY, "Packet exceeds {} bytes.", WirePacket::CAPACITY);
+    return nullptr;
+  }
+
+  const std::span<const u8> data = packet.GetData();
+  u8* const buffer = data.size() <= BUFFER_SIZE ? Acquire() : nullptr;
+  if (!buffer)
+    return enet_packet_create(data.data(), data.size(), flags);
+
+  std::memcpy(buffer, data.data(), data.size());
+  ENetPacket* epac = enet_packet_create(buffer, data.size(), flags | ENET_PACKET_FLAG_NO_ALLOCATE);
+  if (!epac)
+  {
+    Release(buffer);
+    return nullptr;
+  }
+
+  epac->freeCallback = &PacketPool::FreePacket;
+  epac->userData = this;
+  return epac;
+}
+
+void ENET_CALLBACK PacketPool::FreePacket(ENetPacket* packet)
+{
+  static_cast<PacketPool*>(packet->userData)->Release(packet->data);
+}
+
+u8* PacketPool::Acquire()
+{
+  u64 used = m_used_buffers.load(std::memory_order_relaxed);
+  while (used != ~u64{0})
+  {
+    const int index = std::countr_one(used);
+    if (m_used_buffers.compare_exchange_weak(used, used | (u64{1} << index),
+                                             std::memory_order_acquire))
+    {
+      return m_buffers[index].data();
+    }
+  }
+  return nullptr;
+}
+
+void PacketPool::Release(u8* buffer)
+{
+  const size_t index = (buffer - m_buffers[0].data()) / BUFFER_SIZE;
+  m_used_buffers.fetch_and(~(u64{1} << index), std::memory_order_release);
+}
+
+bool PacketQueue::Push(ENetPacket* packet, u8 channel_id)
+{
+  const size_t write_index = m_write_index.load(std::memory_order_relaxed);
+  if (write_index - m_read_index.load(std::memory_order_acquire) == SIZE)
+    return false;
+
+  m_entries[write_index % SIZE] = {packet, channel_id};
+  m_write_index.store(write_index + 1, std::memory_order_release);
+  return true;
+}
+
+bool PacketQueue::Pop(ENetPacket** packet, u8* channel_id)
+{
+  const size_t read_index = m_read_index.load(std::memory_order_relaxed);
+  if (read_index == m_write_index.load(std::memory_order_acquire))
+    return false;
+
+  const Entry& entry = m_entries[read_index % SIZE];
+  *packet = entry.packet;
+  *channel_id = entry.channel_id;
+  m_read_index.store(read_index + 1, std::memory_order_release);
+  return true;
+}
+
+void PacketQueue::Clear()
+{
+  ENetPacket* packet;
+  u8 channel_id;
+  while (Pop(&packet, &channel_id))
+    enet_packet_destroy(packet);
+}
 }  // namespace Common::ENet
@@ -3,12 +3,15 @@
 //
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
 
 #include <SFML/Network/Packet.hpp>
 #include <enet/enet.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/WirePacket.h"
 
 namespace Common::ENet
 {
@@ -20,7 +23,69 @@ using ENetHostPtr = std::unique_ptr<ENetHost, ENetHostDeleter>;
 
 void WakeupThread(ENetHost* host);
 int ENET_CALLBACK InterceptCallback(ENetHost* host, ENetEvent* event);
-bool SendPacket(ENetPeer* socket, const sf::Packet& packet, u8 channel_id);
+bool SendPacket(ENetPeer* socket, const sf::Packet& packet, u8 channel_id,
+                u32 flags = ENET_PACKET_FLAG_RELIABLE);
+// Destroys the packet if it couldn't be sent.
+bool SendPacket(ENetPeer* socket, ENetPacket* packet, u8 channel_id);
+
+// Buffers that ENet sends straight from (ENET_PACKET_FLAG_NO_ALLOCATE) instead of copying the
+// data into one it allocates. ENet still allocates the small ENetPacket that refers to the buffer.
+// A buffer returns to the pool when ENet destroys the packet, which may happen on another thread
+// than the one that created it. The pool has to outlive the host.
+class PacketPool
+{
+public:
+  static constexpr size_t SIZE = 64;
+  static constexpr size_t BUFFER_SIZE = 1024;
+
+  PacketPool() = default;
+  PacketPool(const PacketPool&) = delete;
+  PacketPool& operator=(const PacketPool&) = delete;
+
+  // Falls back to a packet that ENet allocates if the data is too large or all buffers are in
+  // use. Returns nullptr if the packet overflowed.
+  ENetPacket* CreatePacket(const WirePacket& packet, u32 flags);
+
+private:
+  static void ENET_CALLBACK FreePacket(ENetPacket* packet);
+
+  u8* Acquire();
+  void Release(u8* buffer);
+
+  std::array<std::array<u8, BUFFER_SIZE>, SIZE> m_buffers;
+  std::atomic<u64> m_used_buffers = 0;
+};
+
+// Hands packets created on one thread to the thread that services the host through a fixed ring,
+// instead of a queue that allocates a node per packet.
+class PacketQueue
+{
+public:
+  static constexpr size_t SIZE = 256;
+
+  PacketQueue() = default;
+  PacketQueue(const PacketQueue&) = delete;
+  PacketQueue& operator=(const PacketQueue&) = delete;
+  ~PacketQueue() { Clear(); }
+
+  // Producer thread. Returns false if the queue is full.
+  bool Push(ENetPacket* packet, u8 channel_id);
+  // Consumer thread.
+  bool Pop(ENetPacket** packet, u8* channel_id);
+  // Consumer thread. Destroys the packets that weren't sent.
+  void Clear();
+
+private:
+  struct Entry
+  {
+    ENetPacket* packet;
+    u8 channel_id;
+  };
+
+  std::array<Entry, SIZE> m_entries{};
+  std::atomic<size_t> m_read_index = 0;
+  std::atomic<size_t> m_write_index = 0;
+};
 
 // used for traversal packets and wake-up packets
 constexpr int SKIPPABLE_EVENT = 42;
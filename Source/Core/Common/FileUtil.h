@@ -46,6 +46,7 @@ enum
   D_SCREENSHOTS_IDX,
   D_HIRESTEXTURES_IDX,
   D_RIIVOLUTION_IDX,
+  D_SHADERUIDS_IDX,
   D_DUMP_IDX,
   D_DUMPFRAMES_IDX,
   D_DUMPOBJECTS_IDX,
@@ -93,6 +94,7 @@ enum
   F_GCSRAM_IDX,
   F_MEMORYWATCHERLOCATIONS_IDX,
   F_MEMORYWATCHERSOCKET_IDX,
+  F_MEMORYWATCHERRING_IDX,
   F_WIISDCARDIMAGE_IDX,
   F_WIISYSCONF_IDX,
   F_DUALSHOCKUDPCLIENTCONFIG_IDX,
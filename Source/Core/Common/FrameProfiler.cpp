@@ -0,0 +1,289 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/FrameProfiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+
+namespace Common::FrameProfiler
+{
+namespace detail
+{
+std::atomic<bool> s_enabled = false;
+}
+
+namespace
+{
+// Bounds the memory of a trace to about 24 MiB. Later events are dropped.
+constexpr std::size_t MAX_TRACE_EVENTS = 1 << 20;
+
+struct TraceEvent
+{
+  TimePoint start;
+  DT duration;
+  int thread_id;
+  Stage stage;
+};
+
+std::array<std::atomic<s64>, NUM_STAGES> s_frame_times_ns{};
+
+std::atomic<bool> s_tracing = false;
+std::mutex s_trace_lock;
+std::vector<TraceEvent> s_trace_events;
+TimePoint s_trace_start;
+
+// About 1 MiB per thread. The GPU thread fills it the fastest, with a few seconds of events.
+constexpr u64 RECENT_EVENTS_PER_THREAD = 1 << 16;
+
+// The fields are atomic so that a dump can read the ring while its thread overwrites it. A slot
+// that was overwritten during the dump is recognized by the count and dropped.
+struct RecentEvent
+{
+  std::atomic<s64> start_ns;
+  // The duration in nanoseconds, shifted left by 8, and the stage.
+  std::atomic<u64> duration_and_stage;
+};
+
+struct ThreadEvents
+{
+  std::array<RecentEvent, RECENT_EVENTS_PER_THREAD> events{};
+  std::atomic<u64> count = 0;
+  int thread_id = 0;
+  // Cleared when the thread exits, so that the next new thread reuses the ring.
+  std::atomic<bool> in_use = false;
+};
+
+struct ThreadEventsOwner
+{
+  ~ThreadEventsOwner()
+  {
+    if (events)
+      events->in_use.store(false, std::memory_order_release);
+  }
+
+  ThreadEvents* events = nullptr;
+};
+
+std::atomic<bool> s_keeping_recent_events = false;
+// Taken to hand out rings and to dump them, never while recording an event.
+std::mutex s_thread_events_lock;
+std::vector<std::unique_ptr<ThreadEvents>> s_thread_events;
+thread_local ThreadEventsOwner t_thread_events;
+
+ThreadEvents* AcquireThreadEvents()
+{
+  std::lock_guard lk(s_thread_events_lock);
+
+  ThreadEvents* events = nullptr;
+  const auto unused = std::ranges::find_if(s_thread_events, [](const auto& thread_events) {
+    return !thread_events->in_use.load(std::memory_order_acquire);
+  });
+  if (unused != s_thread_events.end())
+    events = unused->get();
+  else
+    events = s_thread_events.emplace_back(std::make_unique<ThreadEvents>()).get();
+
+  events->count.store(0, std::memory_order_relaxed);
+  events->thread_id = CurrentThreadId();
+  events->in_use.store(true, std::memory_order_relaxed);
+  return events;
+}
+
+void RecordRecentEvent(Stage stage, TimePoint start, DT duration)
+{
+  ThreadEvents* events = t_thread_events.events;
+  if (!events) [[unlikely]]
+    events = t_thread_events.events = AcquireThreadEvents();
+
+  const u64 index = events->count.load(std::memory_order_relaxed);
+  RecentEvent& event = events->events[index % RECENT_EVENTS_PER_THREAD];
+  const auto to_ns = [](auto time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+  };
+  event.start_ns.store(to_ns(start.time_since_epoch()), std::memory_order_relaxed);
+  event.duration_and_stage.store(static_cast<u64>(to_ns(duration)) << 8 | static_cast<u64>(stage),
+                                 std::memory_order_relaxed);
+  events->count.store(index + 1, std::memory_order_release);
+}
+
+// Must be called with s_thread_events_lock held.
+void CollectRecentEvents(const ThreadEvents& thread_events, std::vector<TraceEvent>* out)
+{
+  const u64 end = thread_events.count.load(std::memory_order_acquire);
+  const u64 begin = end > RECENT_EVENTS_PER_THREAD ? end - RECENT_EVENTS_PER_THREAD : 0;
+
+  const std::size_t first_collected = out->size();
+  for (u64 i = begin; i < end; ++i)
+  {
+    const RecentEvent& event = thread_events.events[i % RECENT_EVENTS_PER_THREAD];
+    const TimePoint start{std::chrono::duration_cast<DT>(
+        std::chrono::nanoseconds(event.start_ns.load(std::memory_order_relaxed)))};
+    const u64 duration_and_stage = event.duration_and_stage.load(std::memory_order_relaxed);
+    const DT duration =
+        std::chrono::duration_cast<DT>(std::chrono::nanoseconds(duration_and_stage >> 8));
+    out->push_back({start, duration, thread_events.thread_id,
+                    static_cast<Stage>(duration_and_stage & 0xff)});
+  }
+
+  // Drop the events whose slots the thread started overwriting while they were read.
+  std::atomic_thread_fence(std::memory_order_acquire);
+  const u64 new_end = thread_events.count.load(std::memory_order_relaxed);
+  if (new_end >= begin + RECENT_EVENTS_PER_THREAD)
+  {
+    const u64 overwritten = std::min(new_end - RECENT_EVENTS_PER_THREAD + 1, end) - begin;
+    const auto collected = out->begin() + first_collected;
+    out->erase(collected, collected + static_cast<std::ptrdiff_t>(overwritten));
+  }
+}
+
+bool WriteTrace(const std::string& path, std::span<const TraceEvent> events, TimePoint trace_start)
+{
+  const auto to_us = [](DT duration) {
+    return std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(duration).count();
+  };
+
+  std::string json = "{\"traceEvents\":[\n";
+  for (std::size_t i = 0; i < events.size(); ++i)
+  {
+    const TraceEvent& event = events[i];
+    fmt::format_to(std::back_inserter(json),
+                   "{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},"
+                   "\"dur\":{:.3f}}}{}\n",
+                   GetStageName(event.stage), event.thread_id, to_us(event.start - trace_start),
+                   to_us(event.duration), i + 1 != events.size() ? "," : "");
+  }
+  json += "],\"displayTimeUnit\":\"ms\"}\n";
+
+  File::IOFile file(path, "wb");
+  if (!file.WriteString(json))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to write frame timing trace to '{}'", path);
+    return false;
+  }
+
+  NOTICE_LOG_FMT(VIDEO, "Wrote {} frame timing events to '{}'", events.size(), path);
+  return true;
+}
+}  // namespace
+
+const char* GetStageName(Stage stage)
+{
+  static constexpr std::array<const char*, NUM_STAGES> names = {
+      "JIT Compile",         "FIFO Decode",        "Vertex Loading", "Texture Decode",
+      "Shader Compile Wait", "Backend Submit",     "Audio Mix",      "DVD Read",
+      "NetPlay Packet",      "NetPlay Input Wait", "Host GPU",
+  };
+  return names[static_cast<u32>(stage)];
+}
+
+void SetEnabled(bool enabled)
+{
+  detail::s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void AddTime(Stage stage, TimePoint start, TimePoint end)
+{
+  AddTime(stage, end - start);
+
+  if (s_keeping_recent_events.load(std::memory_order_relaxed))
+    RecordRecentEvent(stage, start, end - start);
+
+  if (!s_tracing.load(std::memory_order_relaxed))
+    return;
+
+  std::lock_guard lk(s_trace_lock);
+  if (s_trace_events.size() < MAX_TRACE_EVENTS)
+    s_trace_events.push_back({start, end - start, CurrentThreadId(), stage});
+}
+
+void AddTime(Stage stage, DT duration)
+{
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+  s_frame_times_ns[static_cast<u32>(stage)].fetch_add(ns, std::memory_order_relaxed);
+}
+
+FrameTimes TakeFrameTimes()
+{
+  FrameTimes times;
+  for (u32 i = 0; i < NUM_STAGES; ++i)
+  {
+    times[i] = std::chrono::duration_cast<DT>(
+        std::chrono::nanoseconds(s_frame_times_ns[i].exchange(0, std::memory_order_relaxed)));
+  }
+  return times;
+}
+
+bool IsTracing()
+{
+  return s_tracing.load(std::memory_order_relaxed);
+}
+
+void StartTrace()
+{
+  std::lock_guard lk(s_trace_lock);
+  s_trace_events.clear();
+  s_trace_start = Clock::now();
+  s_tracing.store(true, std::memory_order_relaxed);
+}
+
+bool StopTrace(const std::string& path)
+{
+  std::vector<TraceEvent> events;
+  TimePoint trace_start;
+  {
+    std::lock_guard lk(s_trace_lock);
+    s_tracing.store(false, std::memory_order_relaxed);
+    events = std::move(s_trace_events);
+    s_trace_events = {};
+    trace_start = s_trace_start;
+  }
+
+  if (events.size() == MAX_TRACE_EVENTS)
+  {
+    WARN_LOG_FMT(VIDEO, "Frame timing trace reached {} events, later ones were dropped",
+                 events.size());
+  }
+
+  return WriteTrace(path, events, trace_start);
+}
+
+bool IsKeepingRecentEvents()
+{
+  return s_keeping_recent_events.load(std::memory_order_relaxed);
+}
+
+void SetKeepingRecentEvents(bool keep)
+{
+  s_keeping_recent_events.store(keep, std::memory_order_relaxed);
+}
+
+bool DumpRecentEvents(const std::string& path, DT duration)
+{
+  const TimePoint now = Clock::now();
+  std::vector<TraceEvent> events;
+  {
+    std::lock_guard lk(s_thread_events_lock);
+    for (const auto& thread_events : s_thread_events)
+      CollectRecentEvents(*thread_events, &events);
+  }
+
+  std::erase_if(events, [since = now - duration](const TraceEvent& event) {
+    return event.start < since;
+  });
+
+  std::ranges::sort(events, {}, &TraceEvent::start);
+  return WriteTrace(path, events, events.empty() ? now : events.front().start);
+}
+}  // namespace Common::FrameProfiler
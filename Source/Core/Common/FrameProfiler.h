@@ -0,0 +1,102 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Measures where the time of each frame goes, across the CPU, GPU and host GPU threads. Scopes
+// only read the clock while the profiler is enabled, so they can stay in hot paths.
+//
+// The time of each stage is summed until TakeFrameTimes, which the presenter calls once per
+// frame. While a trace is recording, every scope is also kept as an event, and the trace can be
+// written as Chrome trace JSON (chrome://tracing, Perfetto) for offline analysis.
+//
+// Independently of traces, the most recent events of every thread can be kept in a ring buffer per
+// thread, which doesn't take a lock. That costs little enough to leave on, so that what happened
+// during a stutter can still be written out after it was noticed.
+namespace Common::FrameProfiler
+{
+enum class Stage : u32
+{
+  JitCompile,
+  FifoDecode,
+  VertexLoading,
+  TextureDecode,
+  ShaderCompileWait,
+  BackendSubmit,
+  AudioMix,
+  DVDRead,
+  NetPlayPacket,
+  NetPlayInputWait,
+  // Reported by the backend from timestamp queries, without a trace event.
+  HostGPU,
+  Count,
+};
+
+constexpr u32 NUM_STAGES = static_cast<u32>(Stage::Count);
+
+using FrameTimes = std::array<DT, NUM_STAGES>;
+
+const char* GetStageName(Stage stage);
+
+namespace detail
+{
+extern std::atomic<bool> s_enabled;
+}
+
+inline bool IsEnabled()
+{
+  return detail::s_enabled.load(std::memory_order_relaxed);
+}
+
+void SetEnabled(bool enabled);
+
+// Call from any thread.
+void AddTime(Stage stage, TimePoint start, TimePoint end);
+void AddTime(Stage stage, DT duration);
+
+// Returns the time of each stage since the last call, and starts counting again.
+FrameTimes TakeFrameTimes();
+
+bool IsTracing();
+void StartTrace();
+// Writes the events recorded since StartTrace to the file and stops recording.
+bool StopTrace(const std::string& path);
+
+bool IsKeepingRecentEvents();
+// The profiler needs to be enabled as well for scopes to record events.
+void SetKeepingRecentEvents(bool keep);
+// Writes the events of roughly the last duration, as far as the ring buffers reach back, as a trace
+// to the file. Can be called from any thread.
+bool DumpRecentEvents(const std::string& path, DT duration);
+
+class Scope final
+{
+public:
+  explicit Scope(Stage stage) : m_stage(stage)
+  {
+    if (IsEnabled()) [[unlikely]]
+      m_start = Clock::now();
+  }
+
+  ~Scope()
+  {
+    if (m_start != TimePoint{}) [[unlikely]]
+      AddTime(m_stage, m_start, Clock::now());
+  }
+
+  Scope(const Scope&) = delete;
+  Scope(Scope&&) = delete;
+  Scope& operator=(const Scope&) = delete;
+  Scope& operator=(Scope&&) = delete;
+
+private:
+  Stage m_stage;
+  TimePoint m_start{};
+};
+}  // namespace Common::FrameProfiler
@@ -640,6 +640,7 @@ PFNDOLDRAWARRAYSINSTANCEDPROC dolDrawArraysInstanced;
 PFNDOLDRAWELEMENTSINSTANCEDPROC dolDrawElementsInstanced;
 PFNDOLPRIMITIVERESTARTINDEXPROC dolPrimitiveRestartIndex;
 PFNDOLTEXBUFFERPROC dolTexBuffer;
+PFNDOLCOPYBUFFERSUBDATAPROC dolCopyBufferSubData;
 
 // gl_3_2
 PFNDOLFRAMEBUFFERTEXTUREPROC dolFramebufferTexture;
@@ -907,6 +908,11 @@ PFNDOLTEXSTORAGE3DPROC dolTexStorage3D;
 PFNDOLTEXSTORAGE2DMULTISAMPLEPROC dolTexStorage2DMultisample;
 PFNDOLTEXSTORAGE3DMULTISAMPLEPROC dolTexStorage3DMultisample;
 
+// ARB_timer_query
+PFNDOLQUERYCOUNTERPROC dolQueryCounter;
+PFNDOLGETQUERYOBJECTI64VPROC dolGetQueryObjecti64v;
+PFNDOLGETQUERYOBJECTUI64VPROC dolGetQueryObjectui64v;
+
 // ARB_ES2_compatibility
 PFNDOLCLEARDEPTHFPROC dolClearDepthf;
 PFNDOLDEPTHRANGEFPROC dolDepthRangef;
@@ -1646,6 +1652,7 @@ const GLFunc gl_function_array[] = {
     GLFUNC_REQUIRES(glDrawArraysInstanced, "VERSION_3_1 |VERSION_GLES_3"),
     GLFUNC_REQUIRES(glDrawElementsInstanced, "VERSION_3_1 |VERSION_GLES_3"),
     GLFUNC_REQUIRES(glTexBuffer, "VERSION_3_1 |VERSION_GLES_3_2"),
+    GLFUNC_REQUIRES(glCopyBufferSubData, "VERSION_3_1 |VERSION_GLES_3"),
 
     // gl_3_2
     GLFUNC_REQUIRES(glGetBufferParameteri64v, "VERSION_3_2 |VERSION_GLES_3"),
@@ -1952,6 +1959,11 @@ const GLFunc gl_function_array[] = {
     GLFUNC_SUFFIX(glTexStorage3DMultisample, OES,
                   "GL_OES_texture_storage_multisample_2d_array !VERSION_GLES_3_2"),
 
+    // ARB_timer_query
+    GLFUNC_REQUIRES(glQueryCounter, "GL_ARB_timer_query"),
+    GLFUNC_REQUIRES(glGetQueryObjecti64v, "GL_ARB_timer_query"),
+    GLFUNC_REQUIRES(glGetQueryObjectui64v, "GL_ARB_timer_query"),
+
     // ARB_ES2_compatibility
     GLFUNC_REQUIRES(glClearDepthf, "GL_ARB_ES2_compatibility |VERSION_GLES_2"),
     GLFUNC_REQUIRES(glDepthRangef, "GL_ARB_ES2_compatibility |VERSION_GLES_2"),
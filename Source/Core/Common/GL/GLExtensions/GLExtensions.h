@@ -30,6 +30,7 @@
 #include "Common/GL/GLExtensions/ARB_texture_multisample.h"
 #include "Common/GL/GLExtensions/ARB_texture_storage.h"
 #include "Common/GL/GLExtensions/ARB_texture_storage_multisample.h"
+#include "Common/GL/GLExtensions/ARB_timer_query.h"
 #include "Common/GL/GLExtensions/ARB_uniform_buffer_object.h"
 #include "Common/GL/GLExtensions/ARB_vertex_array_object.h"
 #include "Common/GL/GLExtensions/ARB_viewport_array.h"
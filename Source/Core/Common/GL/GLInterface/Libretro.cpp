@@ -3,15 +3,17 @@
 
 #include "Common/GL/GLInterface/Libretro.h"
 
-#if defined(_WIN32)
 #include <array>
+#include <atomic>
+
+#if defined(_WIN32)
 #include <windows.h>
 #elif defined(HAVE_X11)
 #include <GL/glx.h>
 #include <X11/Xlib.h>
 #endif
 
-#include "Common/GL/GLExtensions/gl_1_1.h"
+#include "Common/GL/GLExtensions/GLExtensions.h"
 #include "Common/Logging/Log.h"
 
 #if defined(_WIN32) && !defined(WGL_ARB_create_context)
@@ -61,6 +63,118 @@ typedef BOOL(WINAPI* PFNWGLCHOOSEPIXELFORMATARBPROC)(HDC, const int*, const floa
 namespace
 {
 LibretroGLCallbacks s_callbacks;
+
+// A frame of the triple-buffered queue. The texture is shared between the video thread's context
+// and the frontend's; framebuffer objects are not, so each side has its own.
+struct QueuedFrame
+{
+  GLuint texture = 0;
+  GLuint draw_fbo = 0;
+  GLuint read_fbo = 0;
+  // Bumped whenever the texture is recreated, so the frontend side knows to reattach it.
+  u32 generation = 0;
+  u32 read_generation = 0;
+  // Signalled once the video thread finished rendering the frame.
+  GLsync render_fence = nullptr;
+  // Signalled once the frontend finished copying the frame.
+  GLsync read_fence = nullptr;
+  unsigned width = 0;
+  unsigned height = 0;
+};
+
+// The video thread owns s_frames[s_back_frame], the frontend owns s_frames[s_front_frame], and the
+// remaining frame is handed over through s_middle_frame. FRAME_READY_BIT is set there while it
+// holds a completed frame the frontend hasn't taken yet; an untaken frame is simply overwritten.
+constexpr u32 FRAME_READY_BIT = 0x100;
+std::array<QueuedFrame, 3> s_frames;
+std::atomic<u32> s_middle_frame{1};
+u32 s_back_frame = 0;
+u32 s_front_frame = 2;
+u32 s_frame_generation = 0;
+
+GLuint AcquireBackFrame(unsigned width, unsigned height)
+{
+  QueuedFrame& frame = s_frames[s_back_frame];
+  if (frame.read_fence)
+  {
+    glWaitSync(frame.read_fence, 0, GL_TIMEOUT_IGNORED);
+    glDeleteSync(frame.read_fence);
+    frame.read_fence = nullptr;
+  }
+  if (frame.render_fence)
+  {
+    // The frontend never took this frame.
+    glDeleteSync(frame.render_fence);
+    frame.render_fence = nullptr;
+  }
+
+  if (frame.texture && frame.width == width && frame.height == height)
+    return frame.draw_fbo;
+
+  GLint previous_texture = 0;
+  GLint previous_fbo = 0;
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous_texture);
+  glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_fbo);
+
+  if (frame.texture)
+    glDeleteTextures(1, &frame.texture);
+  glGenTextures(1, &frame.texture);
+  glBindTexture(GL_TEXTURE_2D, frame.texture);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+  if (!frame.draw_fbo)
+    glGenFramebuffers(1, &frame.draw_fbo);
+  glBindFramebuffer(GL_FRAMEBUFFER, frame.draw_fbo);
+  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, frame.texture, 0);
+
+  glBindTexture(GL_TEXTURE_2D, previous_texture);
+  glBindFramebuffer(GL_FRAMEBUFFER, previous_fbo);
+
+  frame.width = width;
+  frame.height = height;
+  frame.generation = ++s_frame_generation;
+  return frame.draw_fbo;
+}
+
+void PublishBackFrame()
+{
+  QueuedFrame& frame = s_frames[s_back_frame];
+  if (!frame.texture)
+    return;
+
+  frame.render_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  // The frontend's context can only wait for the fence once it has been submitted.
+  glFlush();
+  s_back_frame = s_middle_frame.exchange(s_back_frame | FRAME_READY_BIT) & ~FRAME_READY_BIT;
+}
+
+void DestroyBackFrames()
+{
+  for (QueuedFrame& frame : s_frames)
+  {
+    if (frame.render_fence)
+      glDeleteSync(frame.render_fence);
+    if (frame.read_fence)
+      glDeleteSync(frame.read_fence);
+    if (frame.draw_fbo)
+      glDeleteFramebuffers(1, &frame.draw_fbo);
+    if (frame.texture)
+      glDeleteTextures(1, &frame.texture);
+
+    frame.render_fence = nullptr;
+    frame.read_fence = nullptr;
+    frame.draw_fbo = 0;
+    frame.texture = 0;
+    frame.width = 0;
+    frame.height = 0;
+  }
+
+  s_back_frame = 0;
+  s_middle_frame.store(1);
+  s_front_frame = 2;
+}
 #if defined(_WIN32)
 PFNWGLCREATECONTEXTATTRIBSARBPROC s_wglCreateContextAttribsARB = nullptr;
 PFNWGLCHOOSEPIXELFORMATARBPROC s_wglChoosePixelFormatARB = nullptr;
@@ -174,6 +288,52 @@ HGLRC CreateCoreContext(HDC dc, HGLRC share_context)
 #endif
 }  // namespace
 
+bool LibretroBlitQueuedFrame(uintptr_t framebuffer, unsigned* width, unsigned* height)
+{
+  if (!(s_middle_frame.load() & FRAME_READY_BIT))
+    return false;
+
+  s_front_frame = s_middle_frame.exchange(s_front_frame) & ~FRAME_READY_BIT;
+  QueuedFrame& frame = s_frames[s_front_frame];
+  if (frame.render_fence)
+  {
+    glWaitSync(frame.render_fence, 0, GL_TIMEOUT_IGNORED);
+    glDeleteSync(frame.render_fence);
+    frame.render_fence = nullptr;
+  }
+
+  if (!frame.read_fbo)
+    glGenFramebuffers(1, &frame.read_fbo);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, frame.read_fbo);
+  if (frame.read_generation != frame.generation)
+  {
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, frame.texture,
+                           0);
+    frame.read_generation = frame.generation;
+  }
+
+  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, static_cast<GLuint>(framebuffer));
+  glBlitFramebuffer(0, 0, frame.width, frame.height, 0, 0, frame.width, frame.height,
+                    GL_COLOR_BUFFER_BIT, GL_NEAREST);
+  glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(framebuffer));
+  frame.read_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+  *width = frame.width;
+  *height = frame.height;
+  return true;
+}
+
+void LibretroReleaseQueuedFrames()
+{
+  for (QueuedFrame& frame : s_frames)
+  {
+    if (frame.read_fbo)
+      glDeleteFramebuffers(1, &frame.read_fbo);
+    frame.read_fbo = 0;
+    frame.read_generation = 0;
+  }
+}
+
 void LibretroSetGLCallbacks(const LibretroGLCallbacks& callbacks)
 {
   s_callbacks = callbacks;
@@ -234,6 +394,9 @@ const LibretroGLCallbacks& LibretroGetGLCallbacks()
 
 GLContextLibretro::~GLContextLibretro()
 {
+  if (m_triple_buffer)
+    DestroyBackFrames();
+
 #if defined(_WIN32)
   if (m_context && m_owns_context)
     wglDeleteContext(static_cast<HGLRC>(m_context));
@@ -258,6 +421,7 @@ bool GLContextLibretro::Initialize(const WindowSystemInfo&, bool, bool)
   m_opengl_mode = callbacks.is_gles ? Mode::OpenGLES : Mode::OpenGL;
   m_backbuffer_width = callbacks.base_width ? callbacks.base_width : 640;
   m_backbuffer_height = callbacks.base_height ? callbacks.base_height : 528;
+  m_triple_buffer = callbacks.triple_buffer;
 
 #if defined(_WIN32)
   if (!callbacks.native_display || !callbacks.native_context)
@@ -400,6 +564,9 @@ void GLContextLibretro::Update()
 
 void GLContextLibretro::Swap()
 {
+  if (m_triple_buffer)
+    PublishBackFrame();
+
   UpdateBackbuffer();
   const auto& callbacks = LibretroGetGLCallbacks();
   if (callbacks.present)
@@ -408,6 +575,9 @@ void GLContextLibretro::Swap()
 
 uintptr_t GLContextLibretro::GetDefaultFramebuffer() const
 {
+  if (m_triple_buffer)
+    return AcquireBackFrame(m_backbuffer_width, m_backbuffer_height);
+
   const auto& callbacks = LibretroGetGLCallbacks();
   if (!callbacks.get_current_framebuffer)
     return 0;
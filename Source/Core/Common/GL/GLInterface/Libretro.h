@@ -20,6 +20,9 @@ struct LibretroGLCallbacks
   unsigned base_width = 0;
   unsigned base_height = 0;
   bool is_gles = false;
+  // Render into a queue of three core-owned frames instead of the frontend's framebuffer, see
+  // LibretroBlitQueuedFrame().
+  bool triple_buffer = false;
   void* native_display = nullptr;
   void* native_context = nullptr;
   uintptr_t native_drawable = 0;
@@ -28,6 +31,13 @@ struct LibretroGLCallbacks
 void LibretroSetGLCallbacks(const LibretroGLCallbacks& callbacks);
 const LibretroGLCallbacks& LibretroGetGLCallbacks();
 
+// Frontend thread side of the triple-buffered frame queue. Copies the newest frame completed by the
+// video thread into framebuffer and stores its size. Returns false if no new frame was completed
+// since the last call. Never waits on the CPU for the video thread or the GPU.
+bool LibretroBlitQueuedFrame(uintptr_t framebuffer, unsigned* width, unsigned* height);
+// Deletes the objects LibretroBlitQueuedFrame() created in the frontend's context.
+void LibretroReleaseQueuedFrames();
+
 class GLContextLibretro final : public GLContext
 {
 public:
@@ -49,6 +59,7 @@ protected:
 private:
   void UpdateBackbuffer();
   bool m_owns_context = true;
+  bool m_triple_buffer = false;
 
 #if defined(_WIN32)
   void* m_dc = nullptr;
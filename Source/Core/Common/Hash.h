@@ -14,7 +14,8 @@ u32 HashAdler32(const u8* data, size_t len);
 // JUNK. DO NOT USE FOR NEW THINGS
 u32 HashEctor(const u8* data, size_t len);
 
-// Specialized hash function used for the texture cache
+// Specialized hash function used for the texture cache. Hashes only about samples words spread
+// over the data, or all of it if samples is 0.
 u64 GetHash64(const u8* src, u32 len, u32 samples);
 
 u32 StartCRC32();
@@ -9,10 +9,12 @@
 
 #ifdef _WIN32
 #include <io.h>
+#include <windows.h>
 
 #include "Common/CommonFuncs.h"
 #include "Common/StringUtil.h"
 #else
+#include <sys/file.h>
 #include <unistd.h>
 #endif
 
@@ -78,6 +80,11 @@ bool IOFile::Open(const std::string& filename, const char openmode[],
     m_file = _tfsopen(UTF8ToTStr(filename).c_str(), UTF8ToTStr(openmode).c_str(), SH_DENYWR);
     m_good = m_file != nullptr;
   }
+  else if (sh == SharedAccess::ReadWrite)
+  {
+    m_file = _tfsopen(UTF8ToTStr(filename).c_str(), UTF8ToTStr(openmode).c_str(), SH_DENYNO);
+    m_good = m_file != nullptr;
+  }
 #else
 #ifdef ANDROID
   if (IsPathAndroidContent(filename))
@@ -169,4 +176,22 @@ bool IOFile::Resize(u64 size)
   return m_good;
 }
 
+bool IOFile::TryLock()
+{
+  if (!IsOpen())
+    return false;
+
+#ifdef _WIN32
+  // Byte range locks on Windows also block reads and writes through other handles, so a byte
+  // far past the end of the file is locked instead of the whole file.
+  OVERLAPPED overlapped{};
+  overlapped.OffsetHigh = MAXDWORD;
+  const HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(m_file)));
+  return LockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY, 0, 1, 0,
+                    &overlapped) != 0;
+#else
+  return flock(fileno(m_file), LOCK_EX | LOCK_NB) == 0;
+#endif
+}
+
 }  // namespace File
@@ -24,6 +24,7 @@ enum class SharedAccess
 {
   Default,
   Read,
+  ReadWrite,
 };
 
 // simple wrapper for cstdlib file functions to
@@ -109,6 +110,11 @@ public:
   bool Resize(u64 size);
   bool Flush();
 
+  // Takes an exclusive lock that other processes opening the same file can't take until this
+  // one is closed. Returns false if another process holds it. Reading and writing the file
+  // isn't blocked by the lock, so it only works between users that take it.
+  bool TryLock();
+
   // clear error state
   void ClearError()
   {
@@ -3,17 +3,21 @@
 
 #include "Common/JitRegister.h"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
 #include "Common/StringUtil.h"
+#include "Common/WorkQueueThread.h"
 
 #ifdef _WIN32
 #include <process.h>
@@ -21,6 +25,13 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <elf.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
 #if defined USE_VTUNE
 #include <jitprofiling.h>
 #pragma comment(lib, "jitprofiling.lib")
@@ -32,9 +43,144 @@ namespace Common::JitRegister
 {
 static bool s_is_enabled = false;
 
-void Init(const std::string& perf_dir)
+// The jitdump file is only touched from this thread once it's running.
+static Common::AsyncWorkThread s_writer;
+
+#ifdef __linux__
+// The format is described in tools/perf/Documentation/jitdump-specification.txt of the kernel.
+namespace JitDump
+{
+constexpr u32 MAGIC = 0x4A695444;
+constexpr u32 VERSION = 1;
+
+enum RecordType : u32
+{
+  JIT_CODE_LOAD = 0,
+  JIT_CODE_CLOSE = 3,
+};
+
+struct FileHeader
+{
+  u32 magic;
+  u32 version;
+  u32 total_size;
+  u32 elf_mach;
+  u32 pad1;
+  u32 pid;
+  u64 timestamp;
+  u64 flags;
+};
+
+struct RecordHeader
+{
+  u32 id;
+  u32 total_size;
+  u64 timestamp;
+};
+
+struct CodeLoad
+{
+  RecordHeader header;
+  u32 pid;
+  u32 tid;
+  u64 vma;
+  u64 code_addr;
+  u64 code_size;
+  u64 code_index;
+  // Followed by the null-terminated name and the code.
+};
+
+#if defined(_M_X86_64)
+constexpr u32 ELF_MACH = EM_X86_64;
+#elif defined(_M_ARM_64)
+constexpr u32 ELF_MACH = EM_AARCH64;
+#else
+constexpr u32 ELF_MACH = EM_NONE;
+#endif
+}  // namespace JitDump
+
+static File::IOFile s_jitdump_file;
+// perf only picks the file up from the mmap of it it sees in the trace.
+static void* s_jitdump_marker = nullptr;
+static std::atomic<u64> s_jitdump_code_index = 0;
+
+// perf has to be told to use the same clock, with "perf record -k mono".
+static u64 GetJitDumpTimestamp()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<u64>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+static void OpenJitDump(const std::string& dir)
+{
+  const std::string filename = fmt::format("{}/jit-{}.dump", dir, getpid());
+  if (!s_jitdump_file.Open(filename, "w+b"))
+    return;
+
+  s_jitdump_marker = mmap(nullptr, sysconf(_SC_PAGESIZE), PROT_READ | PROT_EXEC, MAP_PRIVATE,
+                          fileno(s_jitdump_file.GetHandle()), 0);
+  if (s_jitdump_marker == MAP_FAILED)
+  {
+    s_jitdump_marker = nullptr;
+    s_jitdump_file.Close();
+    return;
+  }
+
+  const JitDump::FileHeader header{.magic = JitDump::MAGIC,
+                                   .version = JitDump::VERSION,
+                                   .total_size = sizeof(JitDump::FileHeader),
+                                   .elf_mach = JitDump::ELF_MACH,
+                                   .pad1 = 0,
+                                   .pid = static_cast<u32>(getpid()),
+                                   .timestamp = GetJitDumpTimestamp(),
+                                   .flags = 0};
+  s_jitdump_file.WriteBytes(&header, sizeof(header));
+}
+
+static void CloseJitDump()
+{
+  if (!s_jitdump_file.IsOpen())
+    return;
+
+  const JitDump::RecordHeader close{JitDump::JIT_CODE_CLOSE, sizeof(close), GetJitDumpTimestamp()};
+  s_jitdump_file.WriteBytes(&close, sizeof(close));
+
+  munmap(s_jitdump_marker, sysconf(_SC_PAGESIZE));
+  s_jitdump_marker = nullptr;
+  s_jitdump_file.Close();
+}
+
+// Builds the record on the calling thread. The code has to be copied right away, since it's gone
+// once the JIT cache is cleared, and the timestamp has to be from before the code first runs.
+static std::vector<u8> MakeCodeLoadRecord(const void* base_address, u32 code_size,
+                                          const std::string& symbol_name)
+{
+  const u32 total_size = sizeof(JitDump::CodeLoad) + symbol_name.size() + 1 + code_size;
+  const u64 address = reinterpret_cast<uintptr_t>(base_address);
+  const JitDump::RecordHeader header{JitDump::JIT_CODE_LOAD, total_size, GetJitDumpTimestamp()};
+  const JitDump::CodeLoad load{.header = header,
+                               .pid = static_cast<u32>(getpid()),
+                               .tid = static_cast<u32>(syscall(SYS_gettid)),
+                               .vma = address,
+                               .code_addr = address,
+                               .code_size = code_size,
+                               .code_index = s_jitdump_code_index++};
+
+  std::vector<u8> record(total_size);
+  u8* ptr = record.data();
+  std::memcpy(ptr, &load, sizeof(load));
+  ptr += sizeof(load);
+  std::memcpy(ptr, symbol_name.c_str(), symbol_name.size() + 1);
+  ptr += symbol_name.size() + 1;
+  std::memcpy(ptr, base_address, code_size);
+  return record;
+}
+#endif
+
+void Init(const std::string& perf_dir, bool jitdump)
 {
-  if (!perf_dir.empty() || getenv("PERF_BUILDID_DIR"))
+  if (!perf_dir.empty() || getenv("PERF_BUILDID_DIR") || jitdump)
   {
     const std::string dir = perf_dir.empty() ? "/tmp" : perf_dir;
     const std::string filename = fmt::format("{}/perf-{}.map", dir, getpid());
@@ -42,6 +188,11 @@ void Init(const std::string& perf_dir)
     // Disable buffering in order to avoid missing some mappings
     // if the event of a crash:
     std::setvbuf(s_perf_map_file.GetHandle(), nullptr, _IONBF, 0);
+#ifdef __linux__
+    if (jitdump)
+      OpenJitDump(dir);
+#endif
+    s_writer.Reset("JitRegister", Common::ThreadPriority::Background);
     s_is_enabled = true;
   }
 }
@@ -52,9 +203,16 @@ void Shutdown()
   iJIT_NotifyEvent(iJVM_EVENT_TYPE_SHUTDOWN, nullptr);
 #endif
 
+  // Writes whatever is still queued.
+  s_writer.Shutdown();
+
   if (s_perf_map_file.IsOpen())
     s_perf_map_file.Close();
 
+#ifdef __linux__
+  CloseJitDump();
+#endif
+
   s_is_enabled = false;
 }
 
@@ -83,7 +241,21 @@ void Register(const void* base_address, u32 code_size, const std::string& symbol
   if (!s_perf_map_file.IsOpen())
     return;
 
+  // Written right away, like the file is unbuffered, so that a crash doesn't lose the mapping of
+  // the code that crashed.
   const auto entry = fmt::format("{} {:x} {}\n", fmt::ptr(base_address), code_size, symbol_name);
   s_perf_map_file.WriteBytes(entry.data(), entry.size());
+
+#ifdef __linux__
+  // Linux perf jit-$pid.dump. Code that is compiled again at an address after the JIT cache was
+  // cleared gets a new load record, which replaces the old one from its timestamp on. The records
+  // carry a copy of the code, so they are written in the background.
+  if (s_jitdump_file.IsOpen())
+  {
+    s_writer.Push([record = MakeCodeLoadRecord(base_address, code_size, symbol_name)] {
+      s_jitdump_file.WriteBytes(record.data(), record.size());
+    });
+  }
+#endif
 }
 }  // namespace Common::JitRegister
@@ -11,7 +11,11 @@
 
 namespace Common::JitRegister
 {
-void Init(const std::string& perf_dir);
+// Writes perf-<pid>.map to perf_dir, or to /tmp if it's empty, when perf_dir or PERF_BUILDID_DIR is
+// set or jitdump is enabled. With jitdump, also writes jit-<pid>.dump next to it (Linux only). It
+// holds the code of every region, so perf can annotate it after "perf inject --jit". The files are
+// written on a background thread.
+void Init(const std::string& perf_dir, bool jitdump);
 void Shutdown();
 void Register(const void* base_address, u32 code_size, const std::string& symbol_name);
 bool IsEnabled();
@@ -5,12 +5,14 @@
 
 #include <algorithm>
 #include <cstring>
-#include <memory>
+#include <span>
 #include <string>
 #include <type_traits>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "Common/Version.h"
 
 // On disk format:
@@ -58,63 +60,69 @@ public:
     // Since we're reading/writing directly to the storage of K instances,
     // K must be trivially copyable.
     static_assert(std::is_trivially_copyable<K>::value, "K must be a trivially copyable type");
+    // Values are passed to the reader straight from the file data, and value_size counts bytes.
+    static_assert(sizeof(V) == 1, "V must be a byte type");
 
     // close any currently opened file
     Close();
     m_num_entries = 0;
 
-    // try opening for reading/writing
-    m_file.Open(filename, "r+b");
-
-    const u64 file_size = m_file.GetSize();
-
     m_header.Init();
-    if (m_file.IsOpen() && ValidateHeader())
-    {
-      // good header, read some key/value pairs
-      K key;
 
-      std::unique_ptr<V[]> value = nullptr;
-      u32 value_size = 0;
-      u32 entry_number = 0;
-      u64 last_valid_value_start = m_file.Tell();
-
-      while (m_file.ReadArray(&value_size, 1))
+    // Other instances of Dolphin may share the cache directory, so only the one holding the lock
+    // of the file writes to it. The others read the entries it has, but don't append any.
+    if (!File::Exists(filename))
+      File::IOFile(filename, "ab", File::SharedAccess::ReadWrite);
+    if (!m_file.Open(filename, "r+b", File::SharedAccess::ReadWrite))
+      return 0;
+    const bool locked = m_file.TryLock();
+
+    // The entries are passed to the reader from a mapping of the file when possible, so that
+    // loading a large cache doesn't take an allocation and a copy per entry. Anything else gets
+    // the whole file read at once.
+    u64 valid_size = 0;
+    {
+      MappedFile mapping;
+      std::string buffer;
+      std::span<const u8> data;
+      if (MappedFile::IsOnLocalDrive(filename) && mapping.Open(filename))
       {
-        const u64 next_extent = m_file.Tell() + sizeof(value_size) + value_size;
-        if (next_extent > file_size)
-          break;
-
-        value = std::make_unique_for_overwrite<V[]>(value_size);
-
-        // read key/value and pass to reader
-        if (m_file.ReadArray(&key, 1) && m_file.ReadArray(value.get(), value_size) &&
-            m_file.ReadArray(&entry_number, 1) && entry_number == m_num_entries + 1)
-        {
-          last_valid_value_start = m_file.Tell();
-          reader.Read(key, value.get(), value_size);
-        }
-        else
-        {
-          break;
-        }
-
-        m_num_entries++;
+        data = mapping.GetData();
+        mapping.Advise(0, data.size(), MappedFile::AccessHint::WillNeed);
+      }
+      else
+      {
+        buffer.resize(m_file.GetSize());
+        if (m_file.ReadBytes(buffer.data(), buffer.size()))
+          data = {reinterpret_cast<const u8*>(buffer.data()), buffer.size()};
+        m_file.ClearError();
       }
-      m_file.ClearError();
-      m_file.Seek(last_valid_value_start, File::SeekOrigin::Begin);
 
+      valid_size = ReadEntries(data, reader);
+    }
+
+    if (!locked)
+    {
+      Close();
       return m_num_entries;
     }
 
-    // failed to open file for reading or bad header
-    // close and recreate file
-    Close();
-    m_file.Open(filename, "wb");
+    // Appending continues after the last valid entry, which overwrites any partial one.
+    if (valid_size != 0 && m_file.Seek(valid_size, File::SeekOrigin::Begin))
+      return m_num_entries;
+
+    // bad header, so recreate the file
+    m_num_entries = 0;
+    m_file.Resize(0);
+    m_file.Seek(0, File::SeekOrigin::Begin);
     WriteHeader();
     return 0;
   }
 
+  // Whether entries can be appended, which isn't the case when another instance of Dolphin has
+  // the file open.
+  bool IsWritable() const { return m_file.IsOpen(); }
+
   void Sync() { m_file.Flush(); }
   void Close()
   {
@@ -136,12 +144,39 @@ public:
 
 private:
   void WriteHeader() { m_file.WriteArray(&m_header, 1); }
-  bool ValidateHeader()
+
+  // Returns the size of the header and the valid entries, or 0 if the header doesn't match.
+  u64 ReadEntries(std::span<const u8> data, LinearDiskCacheReader<K, V>& reader)
   {
-    char file_header[sizeof(Header)];
+    if (data.size() < sizeof(Header) || std::memcmp(&m_header, data.data(), sizeof(Header)) != 0)
+      return 0;
+
+    u64 offset = sizeof(Header);
+    u32 value_size;
+    while (data.size() - offset >= sizeof(value_size))
+    {
+      std::memcpy(&value_size, data.data() + offset, sizeof(value_size));
+      const u64 entry_size = sizeof(value_size) + sizeof(K) + u64{value_size} + sizeof(u32);
+      if (data.size() - offset < entry_size)
+        break;
+
+      const u8* const key = data.data() + offset + sizeof(value_size);
+      const u8* const value = key + sizeof(K);
+      u32 entry_number;
+      std::memcpy(&entry_number, value + value_size, sizeof(entry_number));
+      if (entry_number != m_num_entries + 1)
+        break;
+
+      // The key is copied out, since entries aren't aligned.
+      K aligned_key;
+      std::memcpy(&aligned_key, key, sizeof(K));
+      reader.Read(aligned_key, reinterpret_cast<const V*>(value), value_size);
+
+      m_num_entries++;
+      offset += entry_size;
+    }
 
-    return (m_file.ReadArray(file_header, sizeof(Header)) &&
-            !memcmp((const char*)&m_header, file_header, sizeof(Header)));
+    return offset;
   }
 
   struct Header
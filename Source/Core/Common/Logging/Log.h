@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <fmt/format.h>
 #include <string_view>
+#include "Common/CommonTypes.h"
 #include "Common/FormatUtil.h"
 
 namespace Common::Log
@@ -89,6 +91,22 @@ constexpr auto MAX_EFFECTIVE_LOGLEVEL = Common::Log::LogLevel::LINFO;
 
 static const char LOG_LEVEL_TO_CHAR[7] = "-NEWID";
 
+static_assert(static_cast<int>(LogType::NUMBER_OF_LOGS) <= 64, "s_logged_types is too small");
+
+namespace detail
+{
+// Kept up to date by the LogManager, so that the log macros can skip formatting without a call.
+// The level is 0 while there is no LogManager or it has no enabled listener.
+extern std::atomic<int> s_logged_level;
+extern std::atomic<u64> s_logged_types;
+}  // namespace detail
+
+inline bool IsLogged(LogType type, LogLevel level)
+{
+  return static_cast<int>(level) <= detail::s_logged_level.load(std::memory_order_relaxed) &&
+         ((detail::s_logged_types.load(std::memory_order_relaxed) >> static_cast<int>(type)) & 1);
+}
+
 void GenericLogFmtImpl(LogLevel level, LogType type, const char* file, int line,
                        fmt::string_view format, const fmt::format_args& args);
 
@@ -114,7 +132,7 @@ void GenericLogFmt(LogLevel level, LogType type, const char* file, int line, con
 #define GENERIC_LOG_FMT(t, v, format, ...)                                                         \
   do                                                                                               \
   {                                                                                                \
-    if (v <= Common::Log::MAX_EFFECTIVE_LOGLEVEL)                                                  \
+    if (v <= Common::Log::MAX_EFFECTIVE_LOGLEVEL && Common::Log::IsLogged(t, v))                   \
     {                                                                                              \
       /* Use a macro-like name to avoid shadowing warnings */                                      \
       constexpr auto GENERIC_LOG_FMT_N = Common::CountFmtReplacementFields(format);                \
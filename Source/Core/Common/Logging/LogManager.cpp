@@ -13,6 +13,7 @@
 #include <mutex>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include <fmt/chrono.h>
 #include <fmt/format.h>
@@ -23,9 +24,70 @@
 #include "Common/Logging/ConsoleListener.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 
 namespace Common::Log
 {
+namespace detail
+{
+std::atomic<int> s_logged_level = 0;
+std::atomic<u64> s_logged_types = 0;
+}  // namespace detail
+
+// How long the writer thread collects messages before handing them to the listeners. Errors are
+// written right away.
+constexpr auto WRITER_INTERVAL = std::chrono::milliseconds(10);
+// A message that a thread logs over and over is only written once, followed by how many times it
+// was repeated, at most this often.
+constexpr auto REPEAT_REPORT_INTERVAL = std::chrono::seconds(1);
+
+namespace detail
+{
+// The last message a thread logged, and how many times it was repeated since then.
+struct LastMessage
+{
+  LastMessage();
+  ~LastMessage();
+
+  const char* file = nullptr;
+  int line = 0;
+  LogLevel level{};
+  LogType type{};
+  std::string message;
+  u32 repeats = 0;
+  TimePoint reported;
+  // Held by the thread that logs, and by the writer thread while it reports the repeats.
+  std::mutex lock;
+};
+}  // namespace detail
+
+namespace
+{
+// The LastMessage of every thread, so that the repeats of a message are reported even if its
+// thread doesn't log anything else. s_repeat_reporter is the LogManager while it exists.
+std::mutex s_last_messages_lock;
+std::vector<detail::LastMessage*> s_last_messages;
+LogManager* s_repeat_reporter = nullptr;
+
+thread_local detail::LastMessage t_last_message;
+}  // namespace
+
+detail::LastMessage::LastMessage()
+{
+  std::lock_guard lk(s_last_messages_lock);
+  s_last_messages.push_back(this);
+}
+
+detail::LastMessage::~LastMessage()
+{
+  std::lock_guard lk(s_last_messages_lock);
+  if (s_repeat_reporter)
+  {
+    std::lock_guard message_lk(lock);
+    s_repeat_reporter->ReportRepeats(*this, Clock::now());
+  }
+  std::erase(s_last_messages, this);
+}
 const Config::Info<bool> LOGGER_WRITE_TO_FILE{{Config::System::Logger, "Options", "WriteToFile"},
                                               false};
 const Config::Info<bool> LOGGER_WRITE_TO_CONSOLE{
@@ -172,11 +234,29 @@ LogManager::LogManager()
 
   m_config_changed_callback_id =
       Config::AddConfigChangedCallback([this]() { SetEffectiveLogLevel(); });
+
+  {
+    std::lock_guard lk(s_last_messages_lock);
+    s_repeat_reporter = this;
+  }
+
+  m_writer_running.Set();
+  m_writer_thread = std::thread(&LogManager::WriterThreadFunc, this);
+
+  UpdateLoggedTypes();
 }
 
 LogManager::~LogManager()
 {
+  detail::s_logged_level.store(0, std::memory_order_relaxed);
   Config::RemoveConfigChangedCallback(m_config_changed_callback_id);
+
+  m_writer_running.Clear();
+  m_writer_event.Set();
+  m_writer_thread.join();
+
+  std::lock_guard lk(s_last_messages_lock);
+  s_repeat_reporter = nullptr;
 }
 
 void LogManager::SaveSettings()
@@ -221,15 +301,92 @@ std::string LogManager::GetTimestamp()
 void LogManager::LogWithFullPath(LogLevel level, LogType type, const char* file, int line,
                                  const char* message)
 {
-  const std::string msg =
-      fmt::format("{} {}:{} {}[{}]: {}\n", GetTimestamp(), file, line,
-                  LOG_LEVEL_TO_CHAR[static_cast<int>(level)], GetShortName(type), message);
+  detail::LastMessage& last = t_last_message;
+  std::lock_guard lk(last.lock);
+  const TimePoint now = Clock::now();
+  const bool repeated = last.file == file && last.line == line && last.message == message;
+  if (repeated)
+  {
+    ++last.repeats;
+    if (now - last.reported < REPEAT_REPORT_INTERVAL)
+      return;
+  }
+
+  ReportRepeats(last, now);
+  if (repeated)
+    return;
+
+  last.file = file;
+  last.line = line;
+  last.level = level;
+  last.type = type;
+  last.message = message;
+  last.reported = now;
+
+  QueueMessage(level, type, file, line, message);
+}
+
+void LogManager::QueueMessage(LogLevel level, LogType type, const char* file, int line,
+                              std::string_view message)
+{
+  m_queue.Push({level, fmt::format("{} {}:{} {}[{}]: {}\n", GetTimestamp(), file, line,
+                                   LOG_LEVEL_TO_CHAR[static_cast<int>(level)], GetShortName(type),
+                                   message)});
+
+  if (level <= LogLevel::LERROR)
+    m_writer_event.Set();
+}
+
+void LogManager::ReportRepeats(detail::LastMessage& last, TimePoint now)
+{
+  if (last.repeats == 0)
+    return;
+
+  QueueMessage(last.level, last.type, last.file, last.line,
+               fmt::format("(last message repeated {} times)", last.repeats));
+  last.repeats = 0;
+  last.reported = now;
+}
+
+void LogManager::ReportPendingRepeats(bool all)
+{
+  const TimePoint now = Clock::now();
+  std::lock_guard lk(s_last_messages_lock);
+  for (detail::LastMessage* last : s_last_messages)
+  {
+    std::lock_guard message_lk(last->lock);
+    if (all || now - last->reported >= REPEAT_REPORT_INTERVAL)
+      ReportRepeats(*last, now);
+  }
+}
+
+void LogManager::WriterThreadFunc()
+{
+  Common::SetCurrentThreadName("Log writer");
+  Common::SetCurrentThreadPriority(Common::ThreadPriority::Background);
 
-  for (const auto listener_id : m_listener_ids)
+  while (m_writer_running.IsSet())
   {
-    if (m_listeners[listener_id])
-      m_listeners[listener_id]->Log(level, msg.c_str());
+    m_writer_event.WaitFor(WRITER_INTERVAL);
+    ReportPendingRepeats(false);
+    WriteQueuedMessages();
   }
+
+  ReportPendingRepeats(true);
+  WriteQueuedMessages();
+}
+
+void LogManager::WriteQueuedMessages()
+{
+  std::lock_guard lk(m_listeners_lock);
+
+  m_queue.PopAll([this](QueuedMessage&& message) {
+    for (const auto listener_id : m_listener_ids)
+    {
+      if (m_listeners[listener_id])
+        m_listeners[listener_id]->Log(message.level, message.text.c_str());
+    }
+  });
 }
 
 LogLevel LogManager::GetEffectiveLogLevel() const
@@ -248,11 +405,27 @@ void LogManager::SetEffectiveLogLevel()
   const LogLevel clamped_level =
       std::clamp(Config::Get(LOGGER_VERBOSITY), LogLevel::LNOTICE, MAX_EFFECTIVE_LOGLEVEL);
   m_effective_level.store(clamped_level, std::memory_order_relaxed);
+  UpdateLoggedTypes();
+}
+
+void LogManager::UpdateLoggedTypes()
+{
+  u64 logged_types = 0;
+  for (int i = 0; i < static_cast<int>(LogType::NUMBER_OF_LOGS); ++i)
+  {
+    if (m_log[static_cast<LogType>(i)].m_enable)
+      logged_types |= u64{1} << i;
+  }
+
+  detail::s_logged_types.store(logged_types, std::memory_order_relaxed);
+  detail::s_logged_level.store(m_listener_ids ? static_cast<int>(GetEffectiveLogLevel()) : 0,
+                               std::memory_order_relaxed);
 }
 
 void LogManager::SetEnable(LogType type, bool enable)
 {
   m_log[type].m_enable = enable;
+  UpdateLoggedTypes();
 }
 
 bool LogManager::IsEnabled(LogType type, LogLevel level) const
@@ -283,12 +456,14 @@ const char* LogManager::GetFullName(LogType type) const
 
 void LogManager::RegisterListener(LogListener::LISTENER id, std::unique_ptr<LogListener> listener)
 {
+  std::lock_guard lk(m_listeners_lock);
   m_listeners[id] = std::move(listener);
 }
 
 void LogManager::EnableListener(LogListener::LISTENER id, bool enable)
 {
   m_listener_ids[id] = enable;
+  UpdateLoggedTypes();
 }
 
 bool LogManager::IsListenerEnabled(LogListener::LISTENER id) const
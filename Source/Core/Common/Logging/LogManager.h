@@ -7,23 +7,34 @@
 #include <atomic>
 #include <cstdarg>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "Common/BitSet.h"
+#include "Common/CommonTypes.h"
 #include "Common/Config/Config.h"
 #include "Common/EnumMap.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
 #include "Common/Logging/Log.h"
+#include "Common/MPSCQueue.h"
 
 namespace Common::Log
 {
+namespace detail
+{
+struct LastMessage;
+}  // namespace detail
+
 // This variable should only be read to update the effective log level, and its base layer should
 // only be set when the user selects a new verbosity. Everything else should use the effective log
 // level instead. When running a release build this prevents overwriting the LDEBUG config value
 // with the clamped LINFO level.
 extern const Config::Info<LogLevel> LOGGER_VERBOSITY;
 
-// pure virtual interface
+// pure virtual interface. Listeners are called on the log writer thread.
 class LogListener
 {
 public:
@@ -86,8 +97,28 @@ private:
   LogManager(LogManager&&) = delete;
   LogManager& operator=(LogManager&&) = delete;
 
+  friend struct detail::LastMessage;
+
+  struct QueuedMessage
+  {
+    LogLevel level;
+    std::string text;
+  };
+
   static std::string GetTimestamp();
   void SetEffectiveLogLevel();
+  void UpdateLoggedTypes();
+
+  void QueueMessage(LogLevel level, LogType type, const char* file, int line,
+                    std::string_view message);
+  // Queues how many times the last message of a thread was repeated, if it was. The message has
+  // to be locked.
+  void ReportRepeats(detail::LastMessage& last, TimePoint now);
+  // Writer thread. Reports the repeats of the threads that haven't logged anything else for a
+  // while, or of all of them.
+  void ReportPendingRepeats(bool all);
+  void WriterThreadFunc();
+  void WriteQueuedMessages();
 
   std::atomic<LogLevel> m_effective_level;
   Config::ConfigChangedCallbackID m_config_changed_callback_id;
@@ -95,5 +126,14 @@ private:
   std::array<std::unique_ptr<LogListener>, LogListener::NUMBER_OF_LISTENERS> m_listeners{};
   BitSet32 m_listener_ids;
   size_t m_path_cutoff_point = 0;
+
+  // Messages are formatted on the thread that logs them, and handed to the listeners by the
+  // writer thread, so that logging never waits on a file or console.
+  Common::MPSCQueue<QueuedMessage> m_queue;
+  std::thread m_writer_thread;
+  Common::Event m_writer_event;
+  Common::Flag m_writer_running;
+  // Held while the listeners are called, so that they aren't replaced meanwhile.
+  std::mutex m_listeners_lock;
 };
 }  // namespace Common::Log
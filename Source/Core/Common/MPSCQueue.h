@@ -0,0 +1,80 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// a lock-free, multiple producer, single consumer queue
+//
+// Producers push onto a linked stack with a single compare-and-swap. The consumer takes the whole
+// stack with one exchange and reverses it, so values come out in the order they were pushed.
+
+#include <atomic>
+#include <utility>
+
+namespace Common
+{
+template <typename T>
+class MPSCQueue final
+{
+public:
+  MPSCQueue() = default;
+  ~MPSCQueue() { Clear(); }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+  // Safe from any thread:
+  void Push(const T& arg) { PushNode(new Node{arg, nullptr}); }
+  void Push(T&& arg) { PushNode(new Node{std::move(arg), nullptr}); }
+
+  // The following are only safe from the "consumer thread":
+  bool Empty() const { return m_head.load(std::memory_order_relaxed) == nullptr; }
+
+  // Calls func on every value pushed so far, in the order they were pushed.
+  template <typename Func>
+  void PopAll(Func func)
+  {
+    Node* node = m_head.exchange(nullptr, std::memory_order_acquire);
+
+    Node* reversed = nullptr;
+    while (node != nullptr)
+    {
+      Node* const next = node->next;
+      node->next = reversed;
+      reversed = node;
+      node = next;
+    }
+
+    while (reversed != nullptr)
+    {
+      Node* const next = reversed->next;
+      func(std::move(reversed->value));
+      delete reversed;
+      reversed = next;
+    }
+  }
+
+  void Clear()
+  {
+    PopAll([](T&&) {});
+  }
+
+private:
+  struct Node
+  {
+    T value;
+    Node* next;
+  };
+
+  void PushNode(Node* node)
+  {
+    node->next = m_head.load(std::memory_order_relaxed);
+    while (!m_head.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                         std::memory_order_relaxed))
+    {
+    }
+  }
+
+  std::atomic<Node*> m_head = nullptr;
+};
+}  // namespace Common
@@ -0,0 +1,210 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/MappedFile.h"
+
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__) || defined(__ANDROID__)
+#include <sys/statfs.h>
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#include <sys/mount.h>
+#include <sys/param.h>
+#endif
+#endif
+
+#include "Common/CommonFuncs.h"
+#include "Common/Logging/Log.h"
+#ifdef _WIN32
+#include "Common/StringUtil.h"
+#endif
+
+namespace Common
+{
+MappedFile::~MappedFile()
+{
+  Close();
+}
+
+#ifdef _WIN32
+bool MappedFile::Open(const std::string& path)
+{
+  Close();
+
+  // Files that are open for writing elsewhere, like disk caches that get appended to, can be
+  // mapped as well.
+  const HANDLE file =
+      CreateFileW(UTF8ToWString(path).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size))
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  if (size.QuadPart == 0)
+  {
+    CloseHandle(file);
+    m_is_open = true;
+    return true;
+  }
+
+  // The view keeps the mapping alive, so neither handle is needed past this point.
+  const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (!mapping)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to map '{}': {}", path, GetLastErrorString());
+    return false;
+  }
+
+  void* const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (!view)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to map '{}': {}", path, GetLastErrorString());
+    return false;
+  }
+
+  m_data = static_cast<const u8*>(view);
+  m_size = static_cast<std::size_t>(size.QuadPart);
+  m_is_open = true;
+  return true;
+}
+
+void MappedFile::Close()
+{
+  if (m_data)
+    UnmapViewOfFile(m_data);
+
+  m_data = nullptr;
+  m_size = 0;
+  m_is_open = false;
+}
+
+void MappedFile::Advise(std::size_t offset, std::size_t size, AccessHint hint) const
+{
+  if (!m_data || offset >= m_size || hint != AccessHint::WillNeed)
+    return;
+
+  WIN32_MEMORY_RANGE_ENTRY range;
+  range.VirtualAddress = const_cast<u8*>(m_data + offset);
+  range.NumberOfBytes = std::min(size, m_size - offset);
+  PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+bool MappedFile::IsOnLocalDrive(const std::string& path)
+{
+  wchar_t volume_path[MAX_PATH];
+  if (!GetVolumePathNameW(UTF8ToWString(path).c_str(), volume_path, MAX_PATH))
+    return false;
+
+  return GetDriveTypeW(volume_path) == DRIVE_FIXED;
+}
+#else
+bool MappedFile::Open(const std::string& path)
+{
+  Close();
+
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0)
+  {
+    close(fd);
+    return false;
+  }
+
+  if (st.st_size == 0)
+  {
+    close(fd);
+    m_is_open = true;
+    return true;
+  }
+
+  // The mapping stays valid after the descriptor is closed.
+  void* const view = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (view == MAP_FAILED)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to map '{}': {}", path, LastStrerrorString());
+    return false;
+  }
+
+  m_data = static_cast<const u8*>(view);
+  m_size = static_cast<std::size_t>(st.st_size);
+  m_is_open = true;
+  return true;
+}
+
+void MappedFile::Close()
+{
+  if (m_data)
+    munmap(const_cast<u8*>(m_data), m_size);
+
+  m_data = nullptr;
+  m_size = 0;
+  m_is_open = false;
+}
+
+void MappedFile::Advise(std::size_t offset, std::size_t size, AccessHint hint) const
+{
+  if (!m_data || offset >= m_size)
+    return;
+
+  size = std::min(size, m_size - offset);
+
+  // madvise takes a page aligned address
+  static const std::size_t page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  const std::size_t aligned_offset = offset / page_size * page_size;
+
+  madvise(const_cast<u8*>(m_data) + aligned_offset, size + offset - aligned_offset,
+          hint == AccessHint::Random ? MADV_RANDOM : MADV_WILLNEED);
+}
+
+bool MappedFile::IsOnLocalDrive(const std::string& path)
+{
+#if defined(__linux__) || defined(__ANDROID__)
+  struct statfs fs;
+  if (statfs(path.c_str(), &fs) != 0)
+    return false;
+
+  switch (static_cast<u32>(fs.f_type))
+  {
+  case 0x6969:      // NFS
+  case 0x517B:      // SMB
+  case 0xFF534D42:  // CIFS
+  case 0xFE534D42:  // SMB2
+  case 0x65735546:  // FUSE, which is how sshfs and most network filesystems are mounted
+  case 0x01021997:  // 9P
+  case 0x00C36400:  // Ceph
+  case 0x5346414F:  // AFS
+    return false;
+  default:
+    return true;
+  }
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+  struct statfs fs;
+  if (statfs(path.c_str(), &fs) != 0)
+    return false;
+
+  return (fs.f_flags & MNT_LOCAL) != 0;
+#else
+  return true;
+#endif
+}
+#endif
+}  // namespace Common
@@ -0,0 +1,53 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// A read-only view of a whole file, mapped into memory so that it can be parsed in place instead of
+// being copied into a buffer first.
+class MappedFile final
+{
+public:
+  enum class AccessHint
+  {
+    // The OS shouldn't read ahead of what is accessed.
+    Random,
+    // The range will be accessed soon, so the OS can start reading it in.
+    WillNeed,
+  };
+
+  MappedFile() = default;
+  ~MappedFile();
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&&) = delete;
+
+  // Maps the file at the path, replacing any file mapped before.
+  // Empty files succeed with an empty view.
+  bool Open(const std::string& path);
+  void Close();
+
+  bool IsOpen() const { return m_is_open; }
+  std::span<const u8> GetData() const { return {m_data, m_size}; }
+
+  // Only a hint, which the OS is free to ignore. The range is clamped to the file.
+  void Advise(std::size_t offset, std::size_t size, AccessHint hint) const;
+
+  // Whether the file is on a local drive. Mapping files on network or removable drives is a bad
+  // idea, because an I/O error while accessing the mapping crashes instead of failing a read.
+  static bool IsOnLocalDrive(const std::string& path);
+
+private:
+  const u8* m_data = nullptr;
+  std::size_t m_size = 0;
+  bool m_is_open = false;
+};
+}  // namespace Common
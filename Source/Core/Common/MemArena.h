@@ -115,6 +115,20 @@ public:
   ///
   void UnmapFromMemoryRegion(void* view, size_t size);
 
+  ///
+  /// Ask the OS to back a view or a mapped section with pages larger than the base page size, to
+  /// take pressure off the TLB. Only the parts that are aligned to HUGE_PAGE_SIZE in both the
+  /// address space and the memory segment can get them.
+  ///
+  /// @param view Pointer returned by CreateView() or MapInMemoryRegion().
+  /// @param size Size passed to the corresponding call.
+  ///
+  /// @return False if this platform doesn't support it for shared memory, or the OS refused.
+  ///
+  bool AdviseHugePages(void* view, size_t size);
+
+  static constexpr size_t HUGE_PAGE_SIZE = 0x200000;
+
 private:
 #ifdef _WIN32
   WindowsMemoryRegion* EnsureSplitRegionForMapping(void* address, size_t size);
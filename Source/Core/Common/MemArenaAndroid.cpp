@@ -144,6 +144,19 @@ void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
     NOTICE_LOG_FMT(MEMMAP, "mmap failed");
 }
 
+bool MemArena::AdviseHugePages(void* view, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+  // Shared memory gets huge pages from the kernel's shmem_enabled setting, which has to be at least
+  // "advise" for this to do anything.
+  if (madvise(view, size, MADV_HUGEPAGE) == 0)
+    return true;
+
+  NOTICE_LOG_FMT(MEMMAP, "madvise(MADV_HUGEPAGE) failed: {}", LastStrerrorString());
+#endif
+  return false;
+}
+
 LazyMemoryRegion::LazyMemoryRegion() = default;
 
 LazyMemoryRegion::~LazyMemoryRegion()
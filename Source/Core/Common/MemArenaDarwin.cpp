@@ -144,6 +144,13 @@ void* MemArena::MapInMemoryRegion(s64 offset, size_t size, void* base)
   return reinterpret_cast<void*>(address);
 }
 
+bool MemArena::AdviseHugePages(void* view, size_t size)
+{
+  // Superpages can only be requested when allocating anonymous memory, and not at all on arm64,
+  // so the shared memory entry the views map can't have them.
+  return false;
+}
+
 void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
 {
   vm_address_t address = reinterpret_cast<vm_address_t>(view);
@@ -418,6 +418,13 @@ bool MemArena::JoinRegionsAfterUnmap(void* start_address, size_t size)
   return true;
 }
 
+bool MemArena::AdviseHugePages(void* view, size_t size)
+{
+  // Large pages for file mappings need SEC_LARGE_PAGES when creating the section, which needs the
+  // SeLockMemoryPrivilege that normal users don't have.
+  return false;
+}
+
 void MemArena::UnmapFromMemoryRegion(void* view, size_t size)
 {
   if (m_memory_functions.m_api_ms_win_core_memory_l1_1_6_handle.IsOpen())
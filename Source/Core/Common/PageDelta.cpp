@@ -0,0 +1,135 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/PageDelta.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Common::PageDelta
+{
+namespace
+{
+size_t GetPageBytes(size_t image_size, u32 page)
+{
+  const size_t offset = static_cast<size_t>(page) * PAGE_SIZE;
+  return offset >= image_size ? 0 : std::min(PAGE_SIZE, image_size - offset);
+}
+
+// Calls func(first_page, page_count) for every run of consecutive page indices.
+template <typename Func>
+void ForEachRun(std::span<const u32> pages, Func func)
+{
+  size_t i = 0;
+  while (i < pages.size())
+  {
+    const u32 first_page = pages[i];
+    u32 page_count = 1;
+    while (i + page_count < pages.size() && pages[i + page_count] == first_page + page_count)
+      ++page_count;
+
+    func(first_page, page_count);
+    i += page_count;
+  }
+}
+}  // namespace
+
+void FindChangedPages(std::span<const u8> reference, std::span<const u8> current,
+                      std::vector<u32>* pages)
+{
+  const size_t page_count = GetPageCount(current.size());
+  for (size_t page = 0; page < page_count; ++page)
+  {
+    const size_t offset = page * PAGE_SIZE;
+    const size_t size = std::min(PAGE_SIZE, current.size() - offset);
+    if (offset + size > reference.size() ||
+        std::memcmp(reference.data() + offset, current.data() + offset, size) != 0)
+    {
+      pages->push_back(static_cast<u32>(page));
+    }
+  }
+}
+
+size_t GetEncodedSize(size_t image_size, std::span<const u32> pages)
+{
+  size_t size = 0;
+  ForEachRun(pages, [&](u32 first_page, u32 page_count) {
+    size += sizeof(RunHeader);
+    for (u32 page = first_page; page < first_page + page_count; ++page)
+      size += GetPageBytes(image_size, page);
+  });
+  return size;
+}
+
+size_t Encode(std::span<const u8> image, std::span<const u32> pages, std::span<u8> out)
+{
+  if (GetEncodedSize(image.size(), pages) > out.size())
+    return 0;
+
+  u8* ptr = out.data();
+  ForEachRun(pages, [&](u32 first_page, u32 page_count) {
+    const RunHeader header{first_page, page_count};
+    std::memcpy(ptr, &header, sizeof(header));
+    ptr += sizeof(header);
+
+    const size_t offset = static_cast<size_t>(first_page) * PAGE_SIZE;
+    size_t size = 0;
+    for (u32 page = first_page; page < first_page + page_count; ++page)
+      size += GetPageBytes(image.size(), page);
+    std::memcpy(ptr, image.data() + offset, size);
+    ptr += size;
+  });
+
+  return ptr - out.data();
+}
+
+bool Apply(std::span<const u8> delta, std::span<u8> target, std::vector<u32>* pages)
+{
+  size_t position = 0;
+  while (position < delta.size())
+  {
+    RunHeader header;
+    if (delta.size() - position < sizeof(header))
+      return false;
+    std::memcpy(&header, delta.data() + position, sizeof(header));
+    position += sizeof(header);
+
+    if (header.page_count == 0 ||
+        static_cast<size_t>(header.first_page) + header.page_count > GetPageCount(target.size()))
+    {
+      return false;
+    }
+
+    const size_t offset = static_cast<size_t>(header.first_page) * PAGE_SIZE;
+    const size_t size =
+        std::min(static_cast<size_t>(header.page_count) * PAGE_SIZE, target.size() - offset);
+    if (delta.size() - position < size)
+      return false;
+
+    std::memcpy(target.data() + offset, delta.data() + position, size);
+    position += size;
+
+    if (pages)
+    {
+      for (u32 i = 0; i < header.page_count; ++i)
+        pages->push_back(header.first_page + i);
+    }
+  }
+
+  return true;
+}
+
+void CopyPages(std::span<const u8> source, std::span<u8> target, std::span<const u32> pages)
+{
+  const size_t image_size = std::min(source.size(), target.size());
+  ForEachRun(pages, [&](u32 first_page, u32 page_count) {
+    const size_t offset = static_cast<size_t>(first_page) * PAGE_SIZE;
+    if (offset >= image_size)
+      return;
+
+    const size_t size =
+        std::min(static_cast<size_t>(page_count) * PAGE_SIZE, image_size - offset);
+    std::memcpy(target.data() + offset, source.data() + offset, size);
+  });
+}
+}  // namespace Common::PageDelta
@@ -0,0 +1,52 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Page-granular binary deltas between two images of the same buffer.
+//
+// An encoded delta is a sequence of runs. Each run starts with a RunHeader and is followed by the
+// contents of run.page_count consecutive pages, where the final page of the image may be shorter
+// than PAGE_SIZE. The delta does not store the size of the image it applies to; callers are
+// expected to keep that alongside the delta.
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Common::PageDelta
+{
+constexpr size_t PAGE_SIZE = 0x1000;
+
+struct RunHeader
+{
+  u32 first_page;
+  u32 page_count;
+};
+
+constexpr size_t GetPageCount(size_t image_size)
+{
+  return (image_size + PAGE_SIZE - 1) / PAGE_SIZE;
+}
+
+// Appends the indices of all pages of current that differ from reference to pages, in ascending
+// order. Pages that lie (partially) past the end of reference always count as changed.
+void FindChangedPages(std::span<const u8> reference, std::span<const u8> current,
+                      std::vector<u32>* pages);
+
+// Returns the number of bytes Encode() needs for the given pages of an image of image_size bytes.
+size_t GetEncodedSize(size_t image_size, std::span<const u32> pages);
+
+// Writes the given pages of image into out. pages must be sorted in ascending order.
+// Returns the number of bytes written, or 0 if out is too small.
+size_t Encode(std::span<const u8> image, std::span<const u32> pages, std::span<u8> out);
+
+// Copies the pages stored in delta over target. If pages isn't null, the indices of all pages that
+// were written are appended to it. Returns false if the delta is malformed or doesn't fit target.
+bool Apply(std::span<const u8> delta, std::span<u8> target, std::vector<u32>* pages = nullptr);
+
+// Copies the given pages from source to target, which must have the same size.
+void CopyPages(std::span<const u8> source, std::span<u8> target, std::span<const u32> pages);
+}  // namespace Common::PageDelta
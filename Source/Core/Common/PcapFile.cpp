@@ -52,8 +52,12 @@ void PCAP::AddHeader(u32 link_type)
 // Not thread-safe, concurrency between multiple calls to IOFile::WriteBytes.
 void PCAP::AddPacket(const u8* bytes, size_t size)
 {
-  std::chrono::system_clock::time_point now(std::chrono::system_clock::now());
-  auto ts = now.time_since_epoch();
+  AddPacket(bytes, size, std::chrono::system_clock::now());
+}
+
+void PCAP::AddPacket(const u8* bytes, size_t size, std::chrono::system_clock::time_point time)
+{
+  auto ts = time.time_since_epoch();
   PCAPRecordHeader rec_hdr = {
       (u32)std::chrono::duration_cast<std::chrono::seconds>(ts).count(),
       (u32)(std::chrono::duration_cast<std::chrono::microseconds>(ts).count() % 1000000), (u32)size,
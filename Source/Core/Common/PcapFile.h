@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 
@@ -42,6 +43,8 @@ public:
   }
 
   void AddPacket(const u8* bytes, size_t size);
+  // For packets that were captured earlier than they are written.
+  void AddPacket(const u8* bytes, size_t size, std::chrono::system_clock::time_point time);
 
 private:
   void AddHeader(u32 link_type);
@@ -0,0 +1,125 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/RelayClient.h"
+
+#include <cstring>
+
+#include "Common/Assert.h"
+#include "Common/ENet.h"
+#include "Common/Logging/Log.h"
+#include "Common/Random.h"
+
+namespace Common
+{
+namespace
+{
+RelayClient* s_relay_client = nullptr;
+
+// How often the registration is sent while there is no session.
+constexpr u32 RELAY_RETRY_INTERVAL = 500;
+}  // namespace
+
+RelayClient::RelayClient(ENetHost* host, const std::string& server, u16 port)
+    : m_host(host), m_server(server), m_session_key(Random::GenerateValue<u64>())
+{
+  ASSERT(!s_relay_client);
+  s_relay_client = this;
+  host->intercept = RelayClient::InterceptCallback;
+
+  m_resolved = enet_address_set_host(&m_server_address, server.c_str()) == 0;
+  m_server_address.port = port;
+  if (!m_resolved)
+    ERROR_LOG_FMT(NETPLAY, "Couldn't resolve the relay server {}.", server);
+
+  m_last_register = enet_time_get() - RELAY_RETRY_INTERVAL;
+}
+
+RelayClient::~RelayClient()
+{
+  m_host->intercept = ENet::InterceptCallback;
+  s_relay_client = nullptr;
+}
+
+void RelayClient::Update()
+{
+  if (!m_resolved)
+    return;
+
+  const u32 now = enet_time_get();
+  if (m_session_port != 0 && now - m_last_reply > RELAY_TIMEOUT)
+  {
+    WARN_LOG_FMT(NETPLAY, "Lost the session on the relay server {}.", m_server);
+    m_session_port = 0;
+  }
+
+  const u32 interval = m_session_port != 0 ? RELAY_REGISTER_INTERVAL : RELAY_RETRY_INTERVAL;
+  if (now - m_last_register < interval)
+    return;
+
+  m_last_register = now;
+  Send(RelayPacketType::Register, 0);
+}
+
+bool RelayClient::HandlePacket(const u8* data, size_t size, const ENetAddress& from)
+{
+  if (from.host != m_server_address.host || from.port != m_server_address.port ||
+      size != sizeof(RelayPacket))
+  {
+    return false;
+  }
+
+  RelayPacket packet;
+  std::memcpy(&packet, data, sizeof(packet));
+  if (packet.magic != RELAY_MAGIC || packet.session_key != m_session_key)
+    return false;
+
+  switch (packet.type)
+  {
+  case RelayPacketType::Registered:
+    if (packet.port == 0)
+    {
+      ERROR_LOG_FMT(NETPLAY, "The relay server {} refused the session.", m_server);
+      break;
+    }
+    if (packet.port != m_session_port)
+      INFO_LOG_FMT(NETPLAY, "Relaying through {}:{}.", m_server, packet.port);
+    m_session_port = packet.port;
+    m_last_reply = enet_time_get();
+    break;
+  case RelayPacketType::PeerJoined:
+    // Opens the host's NAT for the port standing in for the player.
+    Send(RelayPacketType::Punch, packet.port);
+    break;
+  default:
+    break;
+  }
+  return true;
+}
+
+void RelayClient::Send(RelayPacketType type, u16 port)
+{
+  const RelayPacket packet{RELAY_MAGIC, type, RelayProtoVersion, port, m_session_key};
+
+  ENetAddress address = m_server_address;
+  if (type == RelayPacketType::Punch)
+    address.port = port;
+
+  ENetBuffer buf;
+  buf.data = const_cast<RelayPacket*>(&packet);
+  buf.dataLength = sizeof(packet);
+  if (enet_socket_send(m_host->socket, &address, &buf, 1) == -1)
+    ERROR_LOG_FMT(NETPLAY, "Failed to send to the relay server {}.", m_server);
+}
+
+int ENET_CALLBACK RelayClient::InterceptCallback(ENetHost* host, ENetEvent* event)
+{
+  if (s_relay_client && s_relay_client->HandlePacket(host->receivedData, host->receivedDataLength,
+                                                     host->receivedAddress))
+  {
+    event->type = static_cast<ENetEventType>(ENet::SKIPPABLE_EVENT);
+    return 1;
+  }
+  return ENet::InterceptCallback(host, event);
+}
+}  // namespace Common
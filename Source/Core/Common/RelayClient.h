@@ -0,0 +1,49 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+
+#include <enet/enet.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/RelayProto.h"
+
+namespace Common
+{
+// Keeps a NetPlay host registered with a relay server, see RelayProto.h. Only one can exist at a
+// time, since it intercepts the packets of the host. Everything but the constructor and the
+// destructor is called from the thread that services the host.
+class RelayClient
+{
+public:
+  RelayClient(ENetHost* host, const std::string& server, u16 port);
+  ~RelayClient();
+
+  RelayClient(const RelayClient&) = delete;
+  RelayClient& operator=(const RelayClient&) = delete;
+
+  // Registers with the relay when it's due.
+  void Update();
+
+  const std::string& GetServer() const { return m_server; }
+  // The port on the relay that players connect to, or 0 while there is no session.
+  u16 GetSessionPort() const { return m_session_port; }
+
+private:
+  bool HandlePacket(const u8* data, size_t size, const ENetAddress& from);
+  void Send(RelayPacketType type, u16 port);
+
+  static int ENET_CALLBACK InterceptCallback(ENetHost* host, ENetEvent* event);
+
+  ENetHost* m_host;
+  std::string m_server;
+  ENetAddress m_server_address{};
+  bool m_resolved = false;
+  u64 m_session_key;
+  u16 m_session_port = 0;
+  u32 m_last_register = 0;
+  u32 m_last_reply = 0;
+};
+}  // namespace Common
@@ -0,0 +1,53 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// The protocol between a NetPlay host and a relay server (relay_server), for players that can
+// reach neither the host nor each other through traversal.
+//
+// The host registers from the socket of its ENet host and is given a session port, which players
+// connect to like to any other host. For every player sending to it, the relay opens a port that
+// stands in for the player and asks the host to send a Punch to it, so that the host's NAT lets
+// the packets from there through. From then on the relay forwards the player's datagrams to the
+// host from that port, and the host's replies to the player from the session port, without
+// looking into them.
+constexpr u16 RELAY_DEFAULT_PORT = 6263;
+constexpr u32 RELAY_MAGIC = 0x59524c44;  // "DLRY"
+constexpr u8 RelayProtoVersion = 0;
+
+// Milliseconds.
+constexpr u32 RELAY_REGISTER_INTERVAL = 5000;
+constexpr u32 RELAY_TIMEOUT = 30000;
+
+enum class RelayPacketType : u8
+{
+  // [h->r] Opens the session, or keeps it open.
+  Register = 0,
+  // [r->h] port is the session port, or 0 if the relay can't take the session.
+  Registered = 1,
+  // [r->h] A player sent to the session port, port is the one standing in for them. Repeated
+  // until the host punched it.
+  PeerJoined = 2,
+  // [h->r] Sent to the port of a PeerJoined.
+  Punch = 3,
+};
+
+#pragma pack(push, 1)
+struct RelayPacket
+{
+  u32 magic;
+  RelayPacketType type;
+  u8 version;
+  // In host byte order.
+  u16 port;
+  // Chosen at random by the host. Only it and the relay know it, so nobody else can take over
+  // the session or the ports of its players.
+  u64 session_key;
+};
+#pragma pack(pop)
+}  // namespace Common
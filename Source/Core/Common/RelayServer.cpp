@@ -0,0 +1,479 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The relay server, see RelayProto.h. It forwards datagrams between NetPlay hosts and their
+// players without decoding them, so one process serves several hundred sessions on a core. Run
+// one per core, each on its own port, to use more of them.
+#include <arpa/inet.h>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+
+#ifdef HAVE_LIBSYSTEMD
+#include <systemd/sd-daemon.h>
+#endif
+
+#include "Common/CommonTypes.h"
+#include "Common/RelayProto.h"
+
+namespace
+{
+constexpr size_t MAX_SESSIONS = 1024;
+constexpr size_t MAX_PEERS_PER_SESSION = 16;
+// How long a player waits for the host to punch its port before being asked for again.
+constexpr u64 PEER_JOINED_RESEND_INTERVAL = 250;
+constexpr size_t BATCH_SIZE = 64;
+// Larger than any datagram ENet sends.
+constexpr size_t MAX_DATAGRAM_SIZE = 4096;
+
+u64 s_now;
+
+struct AddressKey
+{
+  std::array<u8, 16> address;
+  u16 port;
+
+  bool operator==(const AddressKey&) const = default;
+};
+
+struct AddressKeyHash
+{
+  size_t operator()(const AddressKey& key) const noexcept
+  {
+    u64 low, high;
+    std::memcpy(&low, key.address.data(), sizeof(low));
+    std::memcpy(&high, key.address.data() + sizeof(low), sizeof(high));
+    return std::hash<u64>()(low ^ (high * 0x9e3779b97f4a7c15) ^ key.port);
+  }
+};
+
+AddressKey MakeKey(const sockaddr_in6& addr)
+{
+  AddressKey key;
+  std::memcpy(key.address.data(), &addr.sin6_addr, key.address.size());
+  key.port = addr.sin6_port;
+  return key;
+}
+
+struct Session;
+
+// A player of a session, and the port standing in for them.
+struct Peer
+{
+  Session* session;
+  int fd;
+  sockaddr_in6 player;
+  // Where the host's NAT maps the port to, once the host punched it.
+  sockaddr_in6 host;
+  bool punched = false;
+  u64 last_peer_joined = 0;
+  u64 last_active;
+};
+
+struct Session
+{
+  u64 key;
+  int fd;
+  u16 port;
+  sockaddr_in6 host_control;
+  u64 last_register;
+  std::unordered_map<AddressKey, std::unique_ptr<Peer>, AddressKeyHash> peers;
+};
+
+enum class SocketKind
+{
+  Unused,
+  Control,
+  Session,
+  Peer,
+};
+
+// What a socket belongs to, indexed by its fd, so that finding it doesn't cost a lookup.
+struct SocketOwner
+{
+  SocketKind kind = SocketKind::Unused;
+  Session* session = nullptr;
+  Peer* peer = nullptr;
+};
+
+int s_epoll;
+int s_control;
+std::unordered_map<u64, std::unique_ptr<Session>> s_sessions;
+std::vector<SocketOwner> s_owners;
+
+// The buffers recvmmsg() fills.
+std::array<std::array<u8, MAX_DATAGRAM_SIZE>, BATCH_SIZE> s_buffers;
+std::array<sockaddr_in6, BATCH_SIZE> s_addresses;
+std::array<iovec, BATCH_SIZE> s_iovecs;
+std::array<mmsghdr, BATCH_SIZE> s_messages;
+std::array<iovec, BATCH_SIZE> s_send_iovecs;
+std::array<mmsghdr, BATCH_SIZE> s_send_messages;
+
+u64 GetTime()
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+const char* SenderName(const sockaddr_in6& addr)
+{
+  static char buf[INET6_ADDRSTRLEN + 10]{};
+  inet_ntop(PF_INET6, &addr.sin6_addr, buf, sizeof(buf));
+  fmt::format_to(buf + strlen(buf), ":{}", ntohs(addr.sin6_port));
+  return buf;
+}
+
+// Opens a dual-stack UDP socket on the port, or any port if it's 0, and adds it to the epoll set.
+int OpenSocket(u16 port, SocketOwner owner)
+{
+  const int fd = socket(PF_INET6, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+  if (fd == -1)
+  {
+    perror("socket");
+    return -1;
+  }
+
+  int no = 0;
+  if (setsockopt(fd, IPPROTO_IPV6, IPV6_V6ONLY, &no, sizeof(no)) < 0)
+  {
+    perror("setsockopt IPV6_V6ONLY");
+    close(fd);
+    return -1;
+  }
+
+  sockaddr_in6 addr{};
+#ifdef SIN6_LEN
+  addr.sin6_len = sizeof(addr);
+#endif
+  addr.sin6_family = AF_INET6;
+  addr.sin6_port = htons(port);
+  addr.sin6_addr = in6addr_any;
+  if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0)
+  {
+    perror("bind");
+    close(fd);
+    return -1;
+  }
+
+  epoll_event event{};
+  event.events = EPOLLIN;
+  event.data.fd = fd;
+  if (epoll_ctl(s_epoll, EPOLL_CTL_ADD, fd, &event) < 0)
+  {
+    perror("epoll_ctl");
+    close(fd);
+    return -1;
+  }
+
+  if (s_owners.size() <= static_cast<size_t>(fd))
+    s_owners.resize(fd + 1);
+  s_owners[fd] = owner;
+  return fd;
+}
+
+void CloseSocket(int fd)
+{
+  // Closing the fd also removes it from the epoll set.
+  close(fd);
+  s_owners[fd] = {};
+}
+
+u16 GetSocketPort(int fd)
+{
+  sockaddr_in6 addr{};
+  socklen_t addr_len = sizeof(addr);
+  if (getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &addr_len) < 0)
+    return 0;
+  return ntohs(addr.sin6_port);
+}
+
+void SendTo(int fd, const void* data, size_t size, const sockaddr_in6& addr)
+{
+  if (sendto(fd, data, size, 0, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) < 0 &&
+      errno != EAGAIN && errno != EWOULDBLOCK)
+  {
+    perror("sendto");
+  }
+}
+
+void SendControlPacket(Common::RelayPacketType type, u16 port, const Session& session)
+{
+  const Common::RelayPacket packet{Common::RELAY_MAGIC, type, Common::RelayProtoVersion, port,
+                                   session.key};
+  SendTo(s_control, &packet, sizeof(packet), session.host_control);
+}
+
+bool IsRelayPacket(const u8* data, size_t size, Common::RelayPacketType type)
+{
+  if (size != sizeof(Common::RelayPacket))
+    return false;
+
+  Common::RelayPacket packet;
+  std::memcpy(&packet, data, sizeof(packet));
+  return packet.magic == Common::RELAY_MAGIC && packet.type == type;
+}
+
+void ClosePeer(Peer* peer)
+{
+  CloseSocket(peer->fd);
+  peer->session->peers.erase(MakeKey(peer->player));
+}
+
+void CloseSession(u64 key)
+{
+  const auto it = s_sessions.find(key);
+  Session* const session = it->second.get();
+  for (const auto& peer : session->peers)
+    CloseSocket(peer.second->fd);
+  CloseSocket(session->fd);
+
+  fmt::print("closed session on port {}\n", session->port);
+  s_sessions.erase(it);
+}
+
+void HandleRegister(const Common::RelayPacket& packet, const sockaddr_in6& from)
+{
+  const auto it = s_sessions.find(packet.session_key);
+  if (it != s_sessions.end())
+  {
+    // The host's NAT might have moved it to another port.
+    it->second->host_control = from;
+    it->second->last_register = s_now;
+    SendControlPacket(Common::RelayPacketType::Registered, it->second->port, *it->second);
+    return;
+  }
+
+  auto session = std::make_unique<Session>();
+  session->key = packet.session_key;
+  session->host_control = from;
+  session->last_register = s_now;
+  session->fd = -1;
+
+  if (packet.version == Common::RelayProtoVersion && s_sessions.size() < MAX_SESSIONS)
+    session->fd = OpenSocket(0, {SocketKind::Session, session.get(), nullptr});
+
+  if (session->fd == -1)
+  {
+    SendControlPacket(Common::RelayPacketType::Registered, 0, *session);
+    return;
+  }
+
+  session->port = GetSocketPort(session->fd);
+  fmt::print("opened session on port {} for {}\n", session->port, SenderName(from));
+  SendControlPacket(Common::RelayPacketType::Registered, session->port, *session);
+  s_sessions.emplace(session->key, std::move(session));
+}
+
+void HandleControl()
+{
+  const int count = recvmmsg(s_control, s_messages.data(), BATCH_SIZE, 0, nullptr);
+  for (int i = 0; i < count; ++i)
+  {
+    const u8* const data = s_buffers[i].data();
+    if (!IsRelayPacket(data, s_messages[i].msg_len, Common::RelayPacketType::Register))
+      continue;
+
+    Common::RelayPacket packet;
+    std::memcpy(&packet, data, sizeof(packet));
+    HandleRegister(packet, s_addresses[i]);
+  }
+}
+
+// A player sent to the session port.
+void HandleSession(Session* session)
+{
+  const int count = recvmmsg(session->fd, s_messages.data(), BATCH_SIZE, 0, nullptr);
+  for (int i = 0; i < count; ++i)
+  {
+    const AddressKey key = MakeKey(s_addresses[i]);
+    auto it = session->peers.find(key);
+    if (it == session->peers.end())
+    {
+      if (session->peers.size() >= MAX_PEERS_PER_SESSION)
+        continue;
+
+      auto peer = std::make_unique<Peer>();
+      peer->session = session;
+      peer->player = s_addresses[i];
+      peer->fd = OpenSocket(0, {SocketKind::Peer, session, peer.get()});
+      if (peer->fd == -1)
+        continue;
+
+      it = session->peers.emplace(key, std::move(peer)).first;
+    }
+
+    Peer* const peer = it->second.get();
+    peer->last_active = s_now;
+    if (peer->punched)
+    {
+      SendTo(peer->fd, s_buffers[i].data(), s_messages[i].msg_len, peer->host);
+    }
+    else if (s_now - peer->last_peer_joined >= PEER_JOINED_RESEND_INTERVAL)
+    {
+      // ENet retries connecting, so the datagrams until then can be dropped.
+      peer->last_peer_joined = s_now;
+      SendControlPacket(Common::RelayPacketType::PeerJoined, GetSocketPort(peer->fd), *session);
+    }
+  }
+}
+
+// The host sent to the port standing in for a player.
+void HandlePeer(Peer* peer)
+{
+  const int count = recvmmsg(peer->fd, s_messages.data(), BATCH_SIZE, 0, nullptr);
+  unsigned int send_count = 0;
+  for (int i = 0; i < count; ++i)
+  {
+    const u8* const data = s_buffers[i].data();
+    const size_t size = s_messages[i].msg_len;
+    if (IsRelayPacket(data, size, Common::RelayPacketType::Punch))
+    {
+      Common::RelayPacket packet;
+      std::memcpy(&packet, data, sizeof(packet));
+      if (packet.session_key == peer->session->key)
+      {
+        peer->host = s_addresses[i];
+        peer->punched = true;
+      }
+      continue;
+    }
+
+    if (!peer->punched || MakeKey(s_addresses[i]) != MakeKey(peer->host))
+      continue;
+
+    // They all go to the same player, so they are sent together.
+    s_send_iovecs[send_count] = {s_buffers[i].data(), size};
+    msghdr& header = s_send_messages[send_count].msg_hdr;
+    header = {};
+    header.msg_name = &peer->player;
+    header.msg_namelen = sizeof(peer->player);
+    header.msg_iov = &s_send_iovecs[send_count];
+    header.msg_iovlen = 1;
+    ++send_count;
+  }
+
+  if (send_count == 0)
+    return;
+
+  peer->last_active = s_now;
+  if (sendmmsg(peer->session->fd, s_send_messages.data(), send_count, 0) < 0 && errno != EAGAIN &&
+      errno != EWOULDBLOCK)
+  {
+    perror("sendmmsg");
+  }
+}
+
+void ExpireSessions()
+{
+  std::vector<u64> expired_sessions;
+  std::vector<Peer*> expired_peers;
+  for (const auto& [key, session] : s_sessions)
+  {
+    if (s_now - session->last_register > Common::RELAY_TIMEOUT)
+    {
+      expired_sessions.push_back(key);
+      continue;
+    }
+
+    for (const auto& peer : session->peers)
+    {
+      if (s_now - peer.second->last_active > Common::RELAY_TIMEOUT)
+        expired_peers.push_back(peer.second.get());
+    }
+  }
+
+  for (Peer* peer : expired_peers)
+    ClosePeer(peer);
+  for (u64 key : expired_sessions)
+    CloseSession(key);
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const u16 port = argc > 1 ? static_cast<u16>(std::strtoul(argv[1], nullptr, 10)) :
+                              Common::RELAY_DEFAULT_PORT;
+
+  for (size_t i = 0; i < BATCH_SIZE; ++i)
+  {
+    s_iovecs[i] = {s_buffers[i].data(), s_buffers[i].size()};
+    msghdr& header = s_messages[i].msg_hdr;
+    header.msg_name = &s_addresses[i];
+    header.msg_namelen = sizeof(s_addresses[i]);
+    header.msg_iov = &s_iovecs[i];
+    header.msg_iovlen = 1;
+  }
+
+  s_epoll = epoll_create1(0);
+  if (s_epoll == -1)
+  {
+    perror("epoll_create1");
+    return 1;
+  }
+
+  s_control = OpenSocket(port, {SocketKind::Control, nullptr, nullptr});
+  if (s_control == -1)
+    return 1;
+
+#ifdef HAVE_LIBSYSTEMD
+  sd_notifyf(0, "READY=1\nSTATUS=Listening on port %d", port);
+#endif
+
+  std::array<epoll_event, BATCH_SIZE> events;
+  u64 last_expiry = GetTime();
+  while (true)
+  {
+    const int count = epoll_wait(s_epoll, events.data(), static_cast<int>(events.size()), 1000);
+    if (count < 0 && errno != EINTR)
+    {
+      perror("epoll_wait");
+      return 1;
+    }
+
+    s_now = GetTime();
+    for (int i = 0; i < count; ++i)
+    {
+      // recvmmsg() overwrites it.
+      for (size_t j = 0; j < BATCH_SIZE; ++j)
+        s_messages[j].msg_hdr.msg_namelen = sizeof(s_addresses[j]);
+
+      const SocketOwner owner = s_owners[events[i].data.fd];
+      switch (owner.kind)
+      {
+      case SocketKind::Control:
+        HandleControl();
+        break;
+      case SocketKind::Session:
+        HandleSession(owner.session);
+        break;
+      case SocketKind::Peer:
+        HandlePeer(owner.peer);
+        break;
+      case SocketKind::Unused:
+        break;
+      }
+    }
+
+    if (s_now - last_expiry >= 1000)
+    {
+      last_expiry = s_now;
+      ExpireSessions();
+#ifdef HAVE_LIBSYSTEMD
+      sd_notifyf(0, "WATCHDOG=1\nSTATUS=%zu sessions", s_sessions.size());
+#endif
+    }
+  }
+}
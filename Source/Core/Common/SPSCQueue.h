@@ -6,8 +6,12 @@
 // a simple lockless thread-safe,
 // single producer, single consumer queue
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <bit>
 #include <cassert>
+#include <span>
 
 #include "Common/TypeUtils.h"
 
@@ -111,6 +115,162 @@ private:
 
   std::atomic<std::size_t> m_size = 0;
 };
+
+// A bounded variant that never allocates. Pushing to a full queue fails.
+// The producer and the consumer each only write to their own cache line.
+template <typename T, std::size_t Capacity, bool IncludeWaitFunctionality>
+class RingSPSCQueueBase final
+{
+  static_assert(std::has_single_bit(Capacity), "Capacity must be a power of two");
+
+public:
+  RingSPSCQueueBase() = default;
+  ~RingSPSCQueueBase() { Clear(); }
+
+  RingSPSCQueueBase(const RingSPSCQueueBase&) = delete;
+  RingSPSCQueueBase& operator=(const RingSPSCQueueBase&) = delete;
+
+  std::size_t Size() const
+  {
+    const std::size_t read_index = m_consumer.index.load(std::memory_order_acquire);
+    return m_producer.index.load(std::memory_order_acquire) - read_index;
+  }
+  bool Empty() const { return Size() == 0; }
+
+  // The following are only safe from the "producer thread":
+  bool Push(const T& arg) { return Emplace(arg); }
+  bool Push(T&& arg) { return Emplace(std::move(arg)); }
+  template <typename... Args>
+  bool Emplace(Args&&... args)
+  {
+    const std::size_t write_index = m_producer.index.load(std::memory_order_relaxed);
+    if (GetFreeSpace(write_index) == 0)
+      return false;
+
+    m_values[write_index % Capacity].Construct(std::forward<Args>(args)...);
+    PublishWrite(write_index + 1);
+    return true;
+  }
+
+  // Pushes as many of the values as fit. Returns how many were pushed.
+  std::size_t PushN(std::span<const T> values)
+  {
+    const std::size_t write_index = m_producer.index.load(std::memory_order_relaxed);
+    const std::size_t count = std::min(values.size(), GetFreeSpace(write_index, values.size()));
+    for (std::size_t i = 0; i != count; ++i)
+      m_values[(write_index + i) % Capacity].Construct(values[i]);
+
+    if (count != 0)
+      PublishWrite(write_index + count);
+    return count;
+  }
+
+  void WaitForEmpty() requires(IncludeWaitFunctionality)
+  {
+    const std::size_t write_index = m_producer.index.load(std::memory_order_relaxed);
+    std::size_t read_index;
+    while ((read_index = m_consumer.index.load(std::memory_order_acquire)) != write_index)
+      m_consumer.index.wait(read_index, std::memory_order_acquire);
+  }
+
+  // The following are only safe from the "consumer thread":
+  T& Front() { return m_values[m_consumer.index.load(std::memory_order_relaxed) % Capacity].Ref(); }
+  const T& Front() const
+  {
+    return m_values[m_consumer.index.load(std::memory_order_relaxed) % Capacity].Ref();
+  }
+
+  void Pop()
+  {
+    assert(!Empty());
+
+    const std::size_t read_index = m_consumer.index.load(std::memory_order_relaxed);
+    m_values[read_index % Capacity].Destroy();
+    PublishRead(read_index + 1);
+  }
+
+  bool Pop(T& result)
+  {
+    const std::size_t read_index = m_consumer.index.load(std::memory_order_relaxed);
+    if (GetAvailable(read_index) == 0)
+      return false;
+
+    result = std::move(m_values[read_index % Capacity].Ref());
+    m_values[read_index % Capacity].Destroy();
+    PublishRead(read_index + 1);
+    return true;
+  }
+
+  // Pops as many values as are available and fit. Returns how many were popped.
+  std::size_t PopN(std::span<T> results)
+  {
+    const std::size_t read_index = m_consumer.index.load(std::memory_order_relaxed);
+    const std::size_t count = std::min(results.size(), GetAvailable(read_index, results.size()));
+    for (std::size_t i = 0; i != count; ++i)
+    {
+      auto& value = m_values[(read_index + i) % Capacity];
+      results[i] = std::move(value.Ref());
+      value.Destroy();
+    }
+
+    if (count != 0)
+      PublishRead(read_index + count);
+    return count;
+  }
+
+  void WaitForData() requires(IncludeWaitFunctionality)
+  {
+    const std::size_t read_index = m_consumer.index.load(std::memory_order_relaxed);
+    m_producer.index.wait(read_index, std::memory_order_acquire);
+  }
+
+  void Clear()
+  {
+    while (!Empty())
+      Pop();
+  }
+
+private:
+  // Each side caches the other side's index, so that it only reads the other cache line when the
+  // queue looks too full or too empty.
+  struct alignas(64) Side
+  {
+    std::atomic<std::size_t> index = 0;
+    std::size_t cached_other_index = 0;
+  };
+
+  std::size_t GetFreeSpace(std::size_t write_index, std::size_t wanted = 1)
+  {
+    if (Capacity - (write_index - m_producer.cached_other_index) < wanted)
+      m_producer.cached_other_index = m_consumer.index.load(std::memory_order_acquire);
+    return Capacity - (write_index - m_producer.cached_other_index);
+  }
+
+  std::size_t GetAvailable(std::size_t read_index, std::size_t wanted = 1)
+  {
+    if (m_consumer.cached_other_index - read_index < wanted)
+      m_consumer.cached_other_index = m_producer.index.load(std::memory_order_acquire);
+    return m_consumer.cached_other_index - read_index;
+  }
+
+  void PublishWrite(std::size_t write_index)
+  {
+    m_producer.index.store(write_index, std::memory_order_release);
+    if constexpr (IncludeWaitFunctionality)
+      m_producer.index.notify_one();
+  }
+
+  void PublishRead(std::size_t read_index)
+  {
+    m_consumer.index.store(read_index, std::memory_order_release);
+    if constexpr (IncludeWaitFunctionality)
+      m_consumer.index.notify_one();
+  }
+
+  Side m_producer;
+  Side m_consumer;
+  std::array<ManuallyConstructedValue<T>, Capacity> m_values;
+};
 }  // namespace detail
 
 template <typename T>
@@ -119,4 +279,10 @@ using SPSCQueue = detail::SPSCQueueBase<T, false>;
 template <typename T>
 using WaitableSPSCQueue = detail::SPSCQueueBase<T, true>;
 
+template <typename T, std::size_t Capacity>
+using RingSPSCQueue = detail::RingSPSCQueueBase<T, Capacity, false>;
+
+template <typename T, std::size_t Capacity>
+using WaitableRingSPSCQueue = detail::RingSPSCQueueBase<T, Capacity, true>;
+
 }  // namespace Common
@@ -83,6 +83,17 @@ public:
     return data()[i];
   }
 
+  value_type& back()
+  {
+    assert(m_size > 0);
+    return data()[m_size - 1];
+  }
+  const value_type& back() const
+  {
+    assert(m_size > 0);
+    return data()[m_size - 1];
+  }
+
   auto data() { return m_array.data()->Ptr(); }
   auto begin() { return data(); }
   auto end() { return data() + m_size; }
@@ -107,7 +118,11 @@ public:
       pop_back();
   }
 
-  void clear() { resize(0); }
+  void clear()
+  {
+    while (!empty())
+      pop_back();
+  }
 
 private:
   std::array<ManuallyConstructedValue<T>, MaxSize> m_array;
@@ -3,6 +3,14 @@
 
 #include "Common/Thread.h"
 
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
 #ifdef _WIN32
 #include <Windows.h>
 #include <processthreadsapi.h>
@@ -11,6 +19,14 @@
 #include <unistd.h>
 #endif
 
+#if defined __linux__
+#include <fstream>
+
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
+
 #ifdef __APPLE__
 #include <mach/mach.h>
 #elif defined BSD4_4 || defined __FreeBSD__ || defined __OpenBSD__
@@ -28,10 +44,83 @@
 
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 
 namespace Common
 {
+namespace
+{
+// The logical CPUs of each kind, as the OS identifies them to set affinities. Both are empty
+// unless the CPU has cores of different kinds.
+struct CpuTopology
+{
+  std::vector<u32> performance_cpus;
+  std::vector<u32> efficiency_cpus;
+};
+
+// Takes the relative performance and the ID of every CPU. Cores within 80% of the fastest one, like
+// the big and the prime cores of phones, count as performance cores.
+CpuTopology SplitCpusByPerformance(const std::vector<std::pair<u64, u32>>& cpus)
+{
+  u64 max_performance = 0;
+  for (const auto& [performance, id] : cpus)
+    max_performance = std::max(max_performance, performance);
+
+  CpuTopology topology;
+  for (const auto& [performance, id] : cpus)
+  {
+    if (performance * 5 >= max_performance * 4)
+      topology.performance_cpus.push_back(id);
+    else
+      topology.efficiency_cpus.push_back(id);
+  }
+  return topology;
+}
+
+CpuTopology DetectCpuTopology();
+void SetCurrentThreadOSPriority(ThreadPriority priority);
+void SetCurrentThreadCpus(const std::vector<u32>& cpus);
+
+const CpuTopology& GetCpuTopology()
+{
+  static const CpuTopology topology = [] {
+    CpuTopology result = DetectCpuTopology();
+    if (result.performance_cpus.empty() || result.efficiency_cpus.empty())
+    {
+      INFO_LOG_FMT(COMMON, "All CPU cores are of the same kind");
+      return CpuTopology{};
+    }
+
+    INFO_LOG_FMT(COMMON, "Found performance cores {} and efficiency cores {}",
+                 fmt::join(result.performance_cpus, ","), fmt::join(result.efficiency_cpus, ","));
+    return result;
+  }();
+  return topology;
+}
+}  // namespace
+
+void SetCurrentThreadPriority(ThreadPriority priority)
+{
+  SetCurrentThreadOSPriority(priority);
+  if (priority == ThreadPriority::Normal)
+    return;
+
+  const CpuTopology& topology = GetCpuTopology();
+  const bool is_background = priority == ThreadPriority::Background;
+  const std::vector<u32>& cpus =
+      is_background ? topology.efficiency_cpus : topology.performance_cpus;
+  const char* const name = is_background ? "background" : "high";
+  if (cpus.empty())
+  {
+    INFO_LOG_FMT(COMMON, "Running thread at {} priority", name);
+    return;
+  }
+
+  SetCurrentThreadCpus(cpus);
+  INFO_LOG_FMT(COMMON, "Running thread at {} priority on cores {}", name, fmt::join(cpus, ","));
+}
+
 int CurrentThreadId()
 {
 #ifdef _WIN32
@@ -116,6 +205,51 @@ void SetCurrentThreadName(const char* name)
   SetCurrentThreadNameViaApi(name);
 }
 
+namespace
+{
+CpuTopology DetectCpuTopology()
+{
+  ULONG size = 0;
+  GetSystemCpuSetInformation(nullptr, 0, &size, GetCurrentProcess(), 0);
+  std::vector<u8> buffer(size);
+  if (size == 0 ||
+      !GetSystemCpuSetInformation(reinterpret_cast<PSYSTEM_CPU_SET_INFORMATION>(buffer.data()),
+                                  size, &size, GetCurrentProcess(), 0))
+  {
+    return {};
+  }
+
+  // Faster cores have a higher efficiency class.
+  std::vector<std::pair<u64, u32>> cpu_sets;
+  for (ULONG offset = 0; offset < size;)
+  {
+    const auto* const info =
+        reinterpret_cast<const SYSTEM_CPU_SET_INFORMATION*>(buffer.data() + offset);
+    if (info->Type == CpuSetInformation)
+      cpu_sets.emplace_back(info->CpuSet.EfficiencyClass, info->CpuSet.Id);
+    offset += info->Size;
+  }
+  return SplitCpusByPerformance(cpu_sets);
+}
+
+void SetCurrentThreadOSPriority(ThreadPriority priority)
+{
+  int os_priority = THREAD_PRIORITY_NORMAL;
+  if (priority == ThreadPriority::Background)
+    os_priority = THREAD_PRIORITY_BELOW_NORMAL;
+  else if (priority == ThreadPriority::High)
+    os_priority = THREAD_PRIORITY_ABOVE_NORMAL;
+  SetThreadPriority(GetCurrentThread(), os_priority);
+}
+
+void SetCurrentThreadCpus(const std::vector<u32>& cpus)
+{
+  const std::vector<ULONG> cpu_set_ids(cpus.begin(), cpus.end());
+  SetThreadSelectedCpuSets(GetCurrentThread(), cpu_set_ids.data(),
+                           static_cast<ULONG>(cpu_set_ids.size()));
+}
+}  // namespace
+
 #else  // !WIN32, so must be POSIX threads
 
 void SetThreadAffinity(std::thread::native_handle_type thread, u32 mask)
@@ -186,6 +320,95 @@ void SetCurrentThreadName(const char* name)
 #endif
 }
 
+namespace
+{
+#ifdef __linux__
+// Parses a list like "0-3,8".
+std::vector<u32> ReadCpuList(const char* path)
+{
+  std::ifstream file(path);
+  std::vector<u32> cpus;
+  u32 first;
+  while (file >> first)
+  {
+    u32 last = first;
+    if (file.peek() == '-')
+    {
+      file.ignore();
+      file >> last;
+    }
+    for (u32 cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu)
+      cpus.push_back(cpu);
+    if (file.peek() == ',')
+      file.ignore();
+  }
+  return cpus;
+}
+#endif
+
+CpuTopology DetectCpuTopology()
+{
+#ifdef __linux__
+  // Hybrid Intel CPUs have a PMU for each kind of core.
+  CpuTopology topology{ReadCpuList("/sys/devices/cpu_core/cpus"),
+                       ReadCpuList("/sys/devices/cpu_atom/cpus")};
+  if (!topology.performance_cpus.empty())
+    return topology;
+
+  // ARM CPUs report the relative performance of each core. Differences in the maximum frequency
+  // alone are not used, as non-hybrid CPUs boost some of their cores higher than the others.
+  std::vector<std::pair<u64, u32>> capacities;
+  const long cpu_count = sysconf(_SC_NPROCESSORS_CONF);
+  for (u32 cpu = 0; cpu < cpu_count && cpu < CPU_SETSIZE; ++cpu)
+  {
+    std::ifstream file(fmt::format("/sys/devices/system/cpu/cpu{}/cpu_capacity", cpu));
+    u64 capacity;
+    if (!(file >> capacity))
+      return {};
+    capacities.emplace_back(capacity, cpu);
+  }
+  return SplitCpusByPerformance(capacities);
+#else
+  // Left to the OS. On macOS, it picks the kind of core based on the QoS class.
+  return {};
+#endif
+}
+
+void SetCurrentThreadOSPriority(ThreadPriority priority)
+{
+#ifdef __APPLE__
+  qos_class_t qos_class = QOS_CLASS_DEFAULT;
+  if (priority == ThreadPriority::Background)
+    qos_class = QOS_CLASS_UTILITY;
+  else if (priority == ThreadPriority::High)
+    qos_class = QOS_CLASS_USER_INTERACTIVE;
+  pthread_set_qos_class_self_np(qos_class, 0);
+#elif defined __linux__
+  int nice = 0;
+  if (priority == ThreadPriority::Background)
+    nice = 10;
+  else if (priority == ThreadPriority::High)
+    nice = -5;
+
+  // The nice value is per thread on Linux. Lowering it usually needs CAP_SYS_NICE, so boosting
+  // may fail, which is fine.
+  if (setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), nice) != 0)
+    DEBUG_LOG_FMT(COMMON, "Failed to set the nice value of a thread to {}", nice);
+#endif
+}
+
+void SetCurrentThreadCpus([[maybe_unused]] const std::vector<u32>& cpus)
+{
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (u32 cpu : cpus)
+    CPU_SET(cpu, &cpu_set);
+  sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+#endif
+}
+}  // namespace
+
 std::tuple<void*, size_t> GetCurrentThreadStack()
 {
   void* stack_addr;
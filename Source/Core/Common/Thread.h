@@ -39,6 +39,21 @@ inline void YieldCPU()
 
 void SetCurrentThreadName(const char* name);
 
+enum class ThreadPriority
+{
+  Normal,
+  // For work nothing waits on, like writing files. Such threads yield to the emulation threads
+  // and may be scheduled on efficiency cores.
+  Background,
+  // For the threads emulation speed and latency depend on: the CPU, GPU, audio and netplay threads.
+  // Such threads are boosted where the OS allows, and kept on the performance cores.
+  High,
+};
+
+// On CPUs with both performance and efficiency cores (hybrid Intel CPUs or ARM big.LITTLE), this
+// also restricts the current thread to the matching kind of core. Logs the result.
+void SetCurrentThreadPriority(ThreadPriority priority);
+
 #ifndef _WIN32
 // Returns the lowest address of the stack and the size of the stack
 std::tuple<void*, size_t> GetCurrentThreadStack();
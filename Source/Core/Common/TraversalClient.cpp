@@ -388,7 +388,8 @@ void TraversalClient::HandleTraversalTest()
     {
       // success, we can stop now
       m_ttlReady = true;
-      m_Client->OnTtlDetermined(m_ttl);
+      if (m_Client)
+        m_Client->OnTtlDetermined(m_ttl);
     }
     else
     {
@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: CC0-1.0
 
 // The central server implementation.
+#include <algorithm>
 #include <arpa/inet.h>
+#include <array>
 #include <cerrno>
 #include <chrono>
 #include <cstdio>
@@ -32,6 +34,9 @@
 #define PORT 6262
 #define PORT_ALT 6226
 
+// The most packets received or sent with one call.
+static constexpr size_t BATCH_SIZE = 64;
+
 static u64 currentTime;
 
 struct OutgoingPacketInfo
@@ -44,90 +49,112 @@ struct OutgoingPacketInfo
   u64 sendTime;
 };
 
-template <typename T>
-struct EvictEntry
-{
-  u64 updateTime;
-  T value;
-};
-
-template <typename V>
-struct EvictFindResult
+// The connected hosts by their ID, in an open addressing table with linear probing, so that
+// looking one up usually touches a single cache line. A host that didn't ping for EXPIRY_TIME
+// counts as gone, and its slot is reused.
+class HostTable
 {
-  bool found;
-  V* value;
-};
+public:
+  Common::TraversalInetAddress* Find(const Common::TraversalHostId& hostId, bool refresh = false)
+  {
+    if (slots.empty())
+      return nullptr;
 
-template <typename K, typename V>
-EvictFindResult<V> EvictFind(std::unordered_map<K, EvictEntry<V>>& map, const K& key,
-                             bool refresh = false)
-{
-retry:
-  const u64 expiryTime = 30 * 1000000;  // 30s
-  EvictFindResult<V> result;
-  if (map.bucket_count())
-  {
-    auto bucket = map.bucket(key);
-    auto it = map.begin(bucket);
-    for (; it != map.end(bucket); ++it)
+    for (size_t i = Index(hostId);; i = (i + 1) & (slots.size() - 1))
     {
-      if (currentTime - it->second.updateTime > expiryTime)
-      {
-        map.erase(it->first);
-        goto retry;
-      }
-      if (it->first == key)
+      Slot& slot = slots[i];
+      if (!slot.used)
+        return nullptr;
+      if (slot.hostId == hostId && IsLive(slot))
       {
         if (refresh)
-          it->second.updateTime = currentTime;
-        result.found = true;
-        result.value = &it->second.value;
-        return result;
+          slot.updateTime = currentTime;
+        return &slot.value;
       }
     }
   }
-#if DEBUG
-  fmt::print("failed to find key '");
-  for (size_t i = 0; i < sizeof(key); i++)
+
+  // The host must not be in the table.
+  Common::TraversalInetAddress* Insert(const Common::TraversalHostId& hostId)
   {
-    fmt::print("{:02x}", ((u8*)&key)[i]);
+    if ((usedCount + 1) * 4 > slots.size() * 3)
+      Rehash();
+
+    Slot& slot = FreeSlot(hostId);
+    slot.hostId = hostId;
+    slot.updateTime = currentTime;
+    slot.value = {};
+    return &slot.value;
   }
-  fmt::print("'\n");
-#endif
-  result.found = false;
-  return result;
-}
 
-template <typename K, typename V>
-V* EvictSet(std::unordered_map<K, EvictEntry<V>>& map, const K& key)
-{
-  // can't use a local_iterator to emplace...
-  auto& result = map[key];
-  result.updateTime = currentTime;
-  return &result.value;
-}
+private:
+  static constexpr u64 EXPIRY_TIME = 30 * 1000000;  // 30s
+  static constexpr size_t MIN_SIZE = 1024;
 
-namespace std
-{
-template <>
-struct hash<Common::TraversalHostId>
-{
-  size_t operator()(const Common::TraversalHostId& id) const noexcept
+  struct Slot
+  {
+    u64 updateTime;
+    Common::TraversalHostId hostId;
+    bool used;
+    Common::TraversalInetAddress value;
+  };
+
+  static bool IsLive(const Slot& slot) { return currentTime - slot.updateTime <= EXPIRY_TIME; }
+
+  size_t Index(const Common::TraversalHostId& hostId) const
+  {
+    u64 key;
+    memcpy(&key, hostId.data(), sizeof(key));
+    return static_cast<size_t>((key * 0x9e3779b97f4a7c15) >> 32) & (slots.size() - 1);
+  }
+
+  // Drops the expired hosts, and grows the table so that it's at most a quarter full.
+  void Rehash()
+  {
+    std::vector<Slot> oldSlots = std::move(slots);
+    size_t liveCount = 0;
+    for (const Slot& slot : oldSlots)
+      liveCount += slot.used && IsLive(slot);
+
+    size_t size = MIN_SIZE;
+    while (size < liveCount * 4)
+      size *= 2;
+    slots.assign(size, Slot{});
+    usedCount = 0;
+
+    for (const Slot& slot : oldSlots)
+    {
+      if (slot.used && IsLive(slot))
+        FreeSlot(slot.hostId) = slot;
+    }
+  }
+
+  // The first slot for the host that is unused or only holds an expired one.
+  Slot& FreeSlot(const Common::TraversalHostId& hostId)
   {
-    auto p = (u32*)id.data();
-    return p[0] ^ ((p[1] << 13) | (p[1] >> 19));
+    for (size_t i = Index(hostId);; i = (i + 1) & (slots.size() - 1))
+    {
+      Slot& slot = slots[i];
+      if (slot.used && IsLive(slot))
+        continue;
+
+      if (!slot.used)
+        ++usedCount;
+      slot.used = true;
+      return slot;
+    }
   }
+
+  std::vector<Slot> slots;
+  size_t usedCount = 0;
 };
-}  // namespace std
 
-using ConnectedClients =
-    std::unordered_map<Common::TraversalHostId, EvictEntry<Common::TraversalInetAddress>>;
 using OutgoingPackets = std::unordered_map<Common::TraversalRequestId, OutgoingPacketInfo>;
 
 static int sock;
 static int sockAlt;
 static OutgoingPackets outgoingPackets;
-static ConnectedClients connectedClients;
+static HostTable connectedClients;
 
 static Common::TraversalInetAddress MakeInetAddress(const sockaddr_in6& addr)
 {
@@ -193,6 +220,68 @@ static const char* SenderName(sockaddr_in6* addr)
   return buf;
 }
 
+static void UpdateTime()
+{
+  currentTime = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+}
+
+// The packets to send from a socket, which go out together once the received ones are handled.
+struct SendQueue
+{
+  std::array<Common::TraversalPacket, BATCH_SIZE> packets;
+  std::array<sockaddr_in6, BATCH_SIZE> addresses;
+  size_t count = 0;
+};
+
+static SendQueue sendQueue;
+static SendQueue sendQueueAlt;
+
+static void FlushSends(SendQueue& queue, int fd)
+{
+#ifdef __linux__
+  std::array<iovec, BATCH_SIZE> iovecs;
+  std::array<mmsghdr, BATCH_SIZE> messages{};
+  for (size_t i = 0; i < queue.count; i++)
+  {
+    iovecs[i] = {&queue.packets[i], sizeof(queue.packets[i])};
+    messages[i].msg_hdr.msg_name = &queue.addresses[i];
+    messages[i].msg_hdr.msg_namelen = sizeof(queue.addresses[i]);
+    messages[i].msg_hdr.msg_iov = &iovecs[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  size_t sent = 0;
+  while (sent < queue.count)
+  {
+    const int rv = sendmmsg(fd, messages.data() + sent, queue.count - sent, 0);
+    if (rv < 0)
+    {
+      perror("sendmmsg");
+      break;
+    }
+    sent += rv;
+  }
+#else
+  for (size_t i = 0; i < queue.count; i++)
+  {
+    if (sendto(fd, &queue.packets[i], sizeof(queue.packets[i]), 0,
+               (sockaddr*)&queue.addresses[i], sizeof(queue.addresses[i])) < 0)
+    {
+      perror("sendto");
+    }
+  }
+#endif
+  queue.count = 0;
+}
+
+static void FlushSends()
+{
+  FlushSends(sendQueue, sock);
+  FlushSends(sendQueueAlt, sockAlt);
+}
+
 static void TrySend(const void* buffer, size_t size, sockaddr_in6* addr, bool fromAlt)
 {
 #if DEBUG
@@ -200,11 +289,13 @@ static void TrySend(const void* buffer, size_t size, sockaddr_in6* addr, bool fr
   fmt::print("{}-> {} {} {}\n", fromAlt ? "alt " : "", static_cast<int>(packet->type),
              static_cast<long long>(packet->requestId), SenderName(addr));
 #endif
-  if ((size_t)sendto(fromAlt ? sockAlt : sock, buffer, size, 0, (sockaddr*)addr, sizeof(*addr)) !=
-      size)
-  {
-    perror("sendto");
-  }
+  SendQueue& queue = fromAlt ? sendQueueAlt : sendQueue;
+  if (queue.count == BATCH_SIZE)
+    FlushSends(queue, fromAlt ? sockAlt : sock);
+
+  memcpy(&queue.packets[queue.count], buffer, std::min(size, sizeof(queue.packets[0])));
+  queue.addresses[queue.count] = *addr;
+  queue.count++;
 }
 
 static Common::TraversalPacket* AllocPacket(const sockaddr_in6& dest, bool fromAlt,
@@ -307,8 +398,7 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
   }
   case Common::TraversalPacketType::Ping:
   {
-    auto r = EvictFind(connectedClients, packet->ping.hostId, true);
-    packetOk = r.found;
+    packetOk = connectedClients.Find(packet->ping.hostId, true) != nullptr;
     break;
   }
   case Common::TraversalPacketType::HelloFromClient:
@@ -326,10 +416,9 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
       while (true)
       {
         GetRandomHostId(&hostId);
-        auto r = EvictFind(connectedClients, hostId);
-        if (!r.found)
+        if (!connectedClients.Find(hostId))
         {
-          iaddr = EvictSet(connectedClients, hostId);
+          iaddr = connectedClients.Insert(hostId);
           break;
         }
       }
@@ -344,8 +433,8 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
   case Common::TraversalPacketType::ConnectPlease:
   {
     Common::TraversalHostId& hostId = packet->connectPlease.hostId;
-    auto r = EvictFind(connectedClients, hostId);
-    if (!r.found)
+    Common::TraversalInetAddress* hostAddress = connectedClients.Find(hostId);
+    if (!hostAddress)
     {
       Common::TraversalPacket* reply = AllocPacket(*addr, toAlt);
       reply->type = Common::TraversalPacketType::ConnectFailed;
@@ -355,7 +444,7 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
     else
     {
       Common::TraversalPacket* please =
-          AllocPacket(MakeSinAddr(*r.value), toAlt, packet->requestId);
+          AllocPacket(MakeSinAddr(*hostAddress), toAlt, packet->requestId);
       please->type = Common::TraversalPacketType::PleaseSendPacket;
       please->pleaseSendPacket.address = MakeInetAddress(*addr);
     }
@@ -364,14 +453,14 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
   case Common::TraversalPacketType::TestPlease:
   {
     Common::TraversalHostId& hostId = packet->testPlease.hostId;
-    auto r = EvictFind(connectedClients, hostId);
-    if (r.found)
+    Common::TraversalInetAddress* hostAddress = connectedClients.Find(hostId);
+    if (hostAddress)
     {
       Common::TraversalPacket ack = {};
       ack.type = Common::TraversalPacketType::Ack;
       ack.requestId = packet->requestId;
       ack.ack.ok = true;
-      sockaddr_in6 mainAddr = MakeSinAddr(*r.value);
+      sockaddr_in6 mainAddr = MakeSinAddr(*hostAddress);
       TrySend(&ack, sizeof(ack), &mainAddr, toAlt);
     }
     break;
@@ -392,6 +481,55 @@ static void HandlePacket(Common::TraversalPacket* packet, sockaddr_in6* addr, bo
   }
 }
 
+static std::array<Common::TraversalPacket, BATCH_SIZE> recvPackets;
+static std::array<sockaddr_in6, BATCH_SIZE> recvAddresses;
+
+// Handles up to BATCH_SIZE of the packets waiting on the socket. Returns false on failure.
+static bool ReceivePackets(int recvsock)
+{
+  std::array<size_t, BATCH_SIZE> sizes;
+#ifdef __linux__
+  std::array<iovec, BATCH_SIZE> iovecs;
+  std::array<mmsghdr, BATCH_SIZE> messages{};
+  for (size_t i = 0; i < BATCH_SIZE; i++)
+  {
+    iovecs[i] = {&recvPackets[i], sizeof(recvPackets[i])};
+    messages[i].msg_hdr.msg_name = &recvAddresses[i];
+    messages[i].msg_hdr.msg_namelen = sizeof(recvAddresses[i]);
+    messages[i].msg_hdr.msg_iov = &iovecs[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+  }
+  const int count = recvmmsg(recvsock, messages.data(), BATCH_SIZE, MSG_DONTWAIT, nullptr);
+  for (int i = 0; i < count; i++)
+    sizes[i] = messages[i].msg_len;
+#else
+  socklen_t addrLen = sizeof(recvAddresses[0]);
+  const int rv = recvfrom(recvsock, &recvPackets[0], sizeof(recvPackets[0]), 0,
+                          (sockaddr*)&recvAddresses[0], &addrLen);
+  const int count = rv < 0 ? -1 : 1;
+  sizes[0] = rv;
+#endif
+  UpdateTime();
+  if (count < 0)
+  {
+    if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+      perror("recvfrom");
+      return false;
+    }
+    return true;
+  }
+
+  for (int i = 0; i < count; i++)
+  {
+    if (sizes[i] < sizeof(recvPackets[i]))
+      fmt::print(stderr, "received short packet from {}\n", SenderName(&recvAddresses[i]));
+    else
+      HandlePacket(&recvPackets[i], &recvAddresses[i], recvsock == sockAlt);
+  }
+  return true;
+}
+
 int main()
 {
   int rv;
@@ -483,46 +621,14 @@ int main()
       }
     }
 
-    int recvsock;
-    if (FD_ISSET(sock, &readSet))
-    {
-      recvsock = sock;
-    }
-    else if (FD_ISSET(sockAlt, &readSet))
-    {
-      recvsock = sockAlt;
-    }
-    else
-    {
-      ResendPackets();
-      continue;
-    }
-    sockaddr_in6 raddr;
-    socklen_t addrLen = sizeof(raddr);
-    Common::TraversalPacket packet{};
-    // note: switch to recvmmsg (yes, mmsg) if this becomes
-    // expensive
-    rv = recvfrom(recvsock, &packet, sizeof(packet), 0, (sockaddr*)&raddr, &addrLen);
-    currentTime = std::chrono::duration_cast<std::chrono::microseconds>(
-                      std::chrono::system_clock::now().time_since_epoch())
-                      .count();
-    if (rv < 0)
-    {
-      if (errno != EINTR && errno != EAGAIN)
-      {
-        perror("recvfrom");
-        return 1;
-      }
-    }
-    else if ((size_t)rv < sizeof(packet))
-    {
-      fmt::print(stderr, "received short packet from {}\n", SenderName(&raddr));
-    }
-    else
-    {
-      HandlePacket(&packet, &raddr, recvsock == sockAlt);
-    }
+    if (FD_ISSET(sock, &readSet) && !ReceivePackets(sock))
+      return 1;
+    if (FD_ISSET(sockAlt, &readSet) && !ReceivePackets(sockAlt))
+      return 1;
+
+    UpdateTime();
     ResendPackets();
+    FlushSends();
 #ifdef HAVE_LIBSYSTEMD
     sd_notify(0, "WATCHDOG=1");
 #endif
@@ -0,0 +1,69 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <span>
+
+#include "Common/CommonTypes.h"
+#include "Common/EnumUtils.h"
+#include "Common/Swap.h"
+#include "Common/TypeUtils.h"
+
+namespace Common
+{
+// A packet with a fixed capacity that doesn't allocate, meant to live on the stack. The data is
+// laid out exactly like sf::Packet does it, so the receiving side reads it with an sf::Packet.
+class WirePacket
+{
+public:
+  static constexpr size_t CAPACITY = 4096;
+
+  std::span<const u8> GetData() const { return {m_data.data(), m_size}; }
+  // False once something didn't fit.
+  bool IsValid() const { return m_valid; }
+
+  WirePacket& operator<<(bool data) { return *this << static_cast<u8>(data); }
+  WirePacket& operator<<(u8 data) { return AppendBigEndian(data); }
+  WirePacket& operator<<(s8 data) { return AppendBigEndian(data); }
+  WirePacket& operator<<(u16 data) { return AppendBigEndian(data); }
+  WirePacket& operator<<(s16 data) { return AppendBigEndian(data); }
+  WirePacket& operator<<(u32 data) { return AppendBigEndian(data); }
+  WirePacket& operator<<(s32 data) { return AppendBigEndian(data); }
+  WirePacket& operator<<(u64 data) { return AppendBigEndian(data); }
+  WirePacket& operator<<(s64 data) { return AppendBigEndian(data); }
+
+  template <Common::Enum Enum>
+  WirePacket& operator<<(Enum e)
+  {
+    return *this << Common::ToUnderlying(e);
+  }
+
+private:
+  template <typename T>
+  WirePacket& AppendBigEndian(T data)
+  {
+    const T value = Common::FromBigEndian(data);
+    return Append(&value, sizeof(value));
+  }
+
+  WirePacket& Append(const void* data, size_t size)
+  {
+    if (!m_valid || size > CAPACITY - m_size)
+    {
+      m_valid = false;
+      return *this;
+    }
+
+    std::memcpy(m_data.data() + m_size, data, size);
+    m_size += size;
+    return *this;
+  }
+
+  std::array<u8, CAPACITY> m_data;
+  size_t m_size = 0;
+  bool m_valid = true;
+};
+}  // namespace Common
@@ -24,20 +24,22 @@ public:
   using FunctionType = std::function<void(T)>;
 
   WorkQueueThreadBase() = default;
-  WorkQueueThreadBase(std::string name, FunctionType function)
+  WorkQueueThreadBase(std::string name, FunctionType function,
+                      ThreadPriority priority = ThreadPriority::Normal)
   {
-    Reset(std::move(name), std::move(function));
+    Reset(std::move(name), std::move(function), priority);
   }
   ~WorkQueueThreadBase() { Shutdown(); }
 
   // Shuts the current work thread down (if any) and starts a new thread with the given function
   // Note: Some consumers of this API push items to the queue before starting the thread.
-  void Reset(std::string name, FunctionType function)
+  void Reset(std::string name, FunctionType function,
+             ThreadPriority priority = ThreadPriority::Normal)
   {
     auto lg = GetLockGuard();
     Shutdown();
     m_thread = std::thread(std::bind_front(&WorkQueueThreadBase::ThreadLoop, this), std::move(name),
-                           std::move(function));
+                           std::move(function), priority);
   }
 
   // Adds an item to the work queue
@@ -144,9 +146,12 @@ private:
 
   bool IsRunning() { return m_thread.joinable(); }
 
-  void ThreadLoop(const std::string& thread_name, const FunctionType& function)
+  void ThreadLoop(const std::string& thread_name, const FunctionType& function,
+                  ThreadPriority priority)
   {
     Common::SetCurrentThreadName(thread_name.c_str());
+    if (priority != ThreadPriority::Normal)
+      Common::SetCurrentThreadPriority(priority);
 
     while (true)
     {
@@ -190,11 +195,15 @@ public:
   using FuncType = std::function<void()>;
 
   AsyncWorkThreadBase() = default;
-  explicit AsyncWorkThreadBase(std::string thread_name) { Reset(std::move(thread_name)); }
+  explicit AsyncWorkThreadBase(std::string thread_name,
+                               ThreadPriority priority = ThreadPriority::Normal)
+  {
+    Reset(std::move(thread_name), priority);
+  }
 
-  void Reset(std::string thread_name)
+  void Reset(std::string thread_name, ThreadPriority priority = ThreadPriority::Normal)
   {
-    m_worker.Reset(std::move(thread_name), std::invoke<FuncType>);
+    m_worker.Reset(std::move(thread_name), std::invoke<FuncType>, priority);
   }
 
   void Push(FuncType func) { m_worker.Push(std::move(func)); }
@@ -6,6 +6,7 @@
 #include "Core/AchievementManager.h"
 
 #include <cctype>
+#include <cstring>
 #include <memory>
 
 #include <fmt/format.h>
@@ -36,6 +37,7 @@
 #include "Core/Host.h"
 #include "Core/PatchEngine.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 #include "DiscIO/Blob.h"
 #include "UICommon/DiscordPresence.h"
@@ -324,7 +326,21 @@ void AchievementManager::DoFrame()
     return;
   {
     std::lock_guard lg{m_lock};
+
+    // rcheevos peeks at every memory reference on every frame, so let those reads skip the MMU
+    auto& system = Core::System::GetInstance();
+    if (!system.GetPPCState().m_enable_dcache)
+    {
+      auto& memory = system.GetMemory();
+      if (memory.GetRAM())
+        m_frame_ram = {memory.GetRAM(), memory.GetRamSizeReal()};
+      if (memory.GetEXRAM())
+        m_frame_exram = {memory.GetEXRAM(), memory.GetExRamSizeReal()};
+    }
+
     rc_client_do_frame(m_client);
+    m_frame_ram = {};
+    m_frame_exram = {};
   }
   auto current_time = std::chrono::steady_clock::now();
   if (current_time - m_last_rp_time > std::chrono::seconds{10})
@@ -1332,6 +1348,22 @@ u32 AchievementManager::MemoryPeeker(u32 address, u8* buffer, u32 num_bytes, rc_
 {
   if (buffer == nullptr)
     return 0u;
+
+  // The same ranges as MMU::IsPhysicalRAMAddress
+  const AchievementManager& instance = GetInstance();
+  const auto read_directly = [&](std::span<const u8> memory, u32 offset) {
+    if (offset >= memory.size() || num_bytes > memory.size() - offset)
+      return false;
+    std::memcpy(buffer, memory.data() + offset, num_bytes);
+    return true;
+  };
+  const u32 segment = address >> 28;
+  if ((segment == 0x0 && read_directly(instance.m_frame_ram, address)) ||
+      (segment == 0x1 && read_directly(instance.m_frame_exram, address & 0x0FFFFFFF)))
+  {
+    return num_bytes;
+  }
+
   auto& system = Core::System::GetInstance();
   Core::CPUThreadGuard thread_guard(system);
   for (u32 num_read = 0; num_read < num_bytes; num_read++)
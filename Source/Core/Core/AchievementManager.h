@@ -13,6 +13,7 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <span>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -291,6 +292,11 @@ private:
   std::unordered_set<AchievementId> m_active_challenges;
   std::vector<rc_client_leaderboard_tracker_t> m_active_leaderboards;
 
+  // MEM1 and MEM2, which MemoryPeeker reads from directly while DoFrame runs rc_client_do_frame.
+  // Empty at other times, or when the data cache is emulated.
+  std::span<const u8> m_frame_ram;
+  std::span<const u8> m_frame_exram;
+
   bool m_dll_found = false;
 #ifdef RC_CLIENT_SUPPORTS_RAINTEGRATION
   std::string m_title_estimate;
@@ -23,8 +23,11 @@
 #include <algorithm>
 #include <atomic>
 #include <bit>
+#include <cstring>
 #include <iterator>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <string>
 #include <utility>
 #include <variant>
@@ -32,18 +35,24 @@
 
 #include <fmt/format.h>
 
+#include "Common/Align.h"
 #include "Common/CommonTypes.h"
 #include "Common/Config/Config.h"
 #include "Common/IniFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/Swap.h"
 
 #include "Core/ARDecrypt.h"
 #include "Core/AchievementManager.h"
 #include "Core/CheatCodes.h"
 #include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
 #include "Core/Debugger/PPCDebugInterface.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 namespace ActionReplay
 {
@@ -93,6 +102,34 @@ static std::atomic<bool> s_use_internal_log{false};
 static const ARCode* s_current_code = nullptr;
 static bool s_disable_logging = false;
 
+// A line of a code that only does RAM writes and conditionals, decoded ahead of time.
+struct CompiledOp
+{
+  enum class Kind : u8
+  {
+    End,
+    EndIf,
+    Nop,
+    Write,
+    Compare,
+  };
+
+  Kind kind = Kind::Nop;
+  // The size of each value in bytes.
+  u8 size = 0;
+  u8 compare_type = 0;
+  // What to set the skip count to if the comparison fails.
+  s8 skip_count = 0;
+  u32 address = 0;
+  u32 value = 0;
+  // How many consecutive values a write fills.
+  u32 count = 0;
+};
+
+// Once a code has run (and been logged) by the interpreter, it runs from here if it could be
+// compiled. Has an entry for each of s_active_codes, and is cleared whenever they change.
+static std::vector<std::optional<std::vector<CompiledOp>>> s_compiled_codes;
+
 struct ARAddr
 {
   union
@@ -122,6 +159,7 @@ void ApplyCodes(std::span<const ARCode> codes, const std::string& game_id, u16 r
   std::lock_guard guard(s_lock);
   s_disable_logging = false;
   s_active_codes.clear();
+  s_compiled_codes.clear();
 
   const auto should_be_activated = [&game_id, &revision](const ARCode& code) {
     return AchievementManager::GetInstance().ShouldARCodeBeActivated(code, game_id, revision);
@@ -132,6 +170,7 @@ void ApplyCodes(std::span<const ARCode> codes, const std::string& game_id, u16 r
 
 void SetSyncedCodesAsActive()
 {
+  s_compiled_codes.clear();
   s_active_codes.clear();
   s_active_codes.reserve(s_synced_codes.size());
   s_active_codes = s_synced_codes;
@@ -153,6 +192,7 @@ std::vector<ARCode> ApplyAndReturnCodes(std::span<const ARCode> codes)
     std::lock_guard guard(s_lock);
     s_disable_logging = false;
     s_active_codes.clear();
+    s_compiled_codes.clear();
     std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                  [](const ARCode& code) { return code.enabled; });
   }
@@ -171,6 +211,7 @@ void AddCode(ARCode code)
     std::lock_guard guard(s_lock);
     s_disable_logging = false;
     s_active_codes.emplace_back(std::move(code));
+    s_compiled_codes.clear();
   }
 }
 
@@ -1004,6 +1045,234 @@ static bool RunCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcod
   return true;
 }
 
+// Returns nullopt for codes that use anything the interpreter has to handle, including the lines
+// it would fail on, so that compiled codes can't fail.
+static std::optional<std::vector<CompiledOp>> CompileCode(const ARCode& arcode)
+{
+  std::vector<CompiledOp> ops;
+  ops.reserve(arcode.ops.size());
+
+  for (const AREntry& entry : arcode.ops)
+  {
+    const ARAddr addr(entry.cmd_addr);
+    const u32 data = entry.value;
+    CompiledOp& op = ops.emplace_back();
+
+    if (0x0 == addr)
+    {
+      switch (data >> 29)
+      {
+      case ZCODE_END:
+        op.kind = CompiledOp::Kind::End;
+        break;
+      case ZCODE_NORM:
+        op.kind = 0x40000000 == data ? CompiledOp::Kind::EndIf : CompiledOp::Kind::Nop;
+        break;
+      default:
+        return std::nullopt;
+      }
+      continue;
+    }
+
+    if (addr >= 0x00002000 && addr < 0x00003000)
+      return std::nullopt;
+
+    op.address = addr.GCAddress();
+    switch (addr.size)
+    {
+    case DATATYPE_8BIT:
+      op.size = 1;
+      op.value = data & 0xFF;
+      op.count = (data >> 8) + 1;
+      break;
+    case DATATYPE_16BIT:
+      op.size = 2;
+      op.value = data & 0xFFFF;
+      op.count = (data >> 16) + 1;
+      break;
+    default:
+      op.size = 4;
+      op.value = data;
+      op.count = 1;
+      break;
+    }
+
+    if (addr.type == 0x00)
+    {
+      if (addr.subtype != SUB_RAM_WRITE)
+        return std::nullopt;
+      op.kind = CompiledOp::Kind::Write;
+    }
+    else
+    {
+      op.kind = CompiledOp::Kind::Compare;
+      op.compare_type = static_cast<u8>(addr.type);
+      if (addr.subtype == CONDTIONAL_ONE_LINE || addr.subtype == CONDTIONAL_TWO_LINES)
+        op.skip_count = static_cast<s8>(addr.subtype + 1);
+      else
+        op.skip_count = -static_cast<s8>(addr.subtype);
+    }
+  }
+
+  return ops;
+}
+
+// Returns where an effective address is in host memory, if it can be accessed there directly
+// with the same result as through the MMU.
+static u8* GetHostPointer(const Core::CPUThreadGuard& guard, u32 address)
+{
+  auto& system = guard.GetSystem();
+  const auto& ppc_state = system.GetPPCState();
+  if (ppc_state.m_enable_dcache)
+    return nullptr;
+
+  u32 physical_address = address;
+  if (ppc_state.msr.DR)
+  {
+    const std::optional<u32> translated_address = system.GetMMU().GetTranslatedAddress(address);
+    if (!translated_address)
+      return nullptr;
+    physical_address = *translated_address;
+  }
+
+  auto& memory = system.GetMemory();
+  if (memory.GetRAM() && (physical_address & 0xF8000000) == 0x00000000)
+    return &memory.GetRAM()[physical_address & memory.GetRamMask()];
+  if (memory.GetEXRAM() && (physical_address >> 28) == 0x1 &&
+      (physical_address & 0x0FFFFFFF) < memory.GetExRamSizeReal())
+  {
+    return &memory.GetEXRAM()[physical_address & 0x0FFFFFFF];
+  }
+  return nullptr;
+}
+
+// Does what ApplyMemoryPatch does, to memory that is known to be RAM.
+static void PatchHostMemory(PowerPC::PowerPCManager& power_pc, u8* host, std::span<const u8> value,
+                            u32 address)
+{
+  bool should_invalidate_cache = false;
+  for (u32 offset = 0; offset < value.size(); ++offset)
+  {
+    if (host[offset] != value[offset])
+    {
+      host[offset] = value[offset];
+      should_invalidate_cache = true;
+    }
+
+    if (((address + offset) % 4) == 3)
+    {
+      if (should_invalidate_cache)
+        power_pc.ScheduleInvalidateCacheThreadSafe(Common::AlignDown(address + offset, 4));
+      should_invalidate_cache = false;
+    }
+  }
+  if (should_invalidate_cache)
+  {
+    power_pc.ScheduleInvalidateCacheThreadSafe(
+        Common::AlignDown(address + static_cast<u32>(value.size()) - 1, 4));
+  }
+}
+
+template <std::unsigned_integral T>
+static void RunCompiledWrite(const Core::CPUThreadGuard& guard, const CompiledOp& op)
+{
+  auto& power_pc = guard.GetSystem().GetPowerPC();
+  const T value = static_cast<T>(op.value);
+  const Common::BigEndianValue<T> big_endian{value};
+  const std::span<const u8> bytes{reinterpret_cast<const u8*>(&big_endian), sizeof(T)};
+
+  // Fills are written a page at a time, since the page is all that needs to be translated.
+  u32 i = 0;
+  while (i < op.count)
+  {
+    const u32 address = op.address + i * sizeof(T);
+    const u32 in_page = std::min<u32>(
+        op.count - i, (PowerPC::HW_PAGE_SIZE - (address & PowerPC::HW_PAGE_MASK)) / sizeof(T));
+    u8* const host = in_page != 0 ? GetHostPointer(guard, address) : nullptr;
+    if (!host)
+    {
+      ApplyMemoryPatch<T>(guard, value, address);
+      ++i;
+      continue;
+    }
+
+    for (u32 j = 0; j < in_page; ++j)
+      PatchHostMemory(power_pc, host + j * sizeof(T), bytes, address + j * sizeof(T));
+    i += in_page;
+  }
+}
+
+template <std::unsigned_integral T>
+static T RunCompiledRead(const Core::CPUThreadGuard& guard, u32 address)
+{
+  if ((address & PowerPC::HW_PAGE_MASK) + sizeof(T) <= PowerPC::HW_PAGE_SIZE)
+  {
+    if (const u8* host = GetHostPointer(guard, address))
+    {
+      T value;
+      std::memcpy(&value, host, sizeof(T));
+      return Common::FromBigEndian(value);
+    }
+  }
+  return PowerPC::MMU::HostRead<T>(guard, address);
+}
+
+// The same as RunCodeLocked for a compiled code, while logging is disabled.
+static void RunCompiledCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcode,
+                                  std::span<const CompiledOp> ops)
+{
+  int skip_count = 0;
+
+  s_current_code = &arcode;
+
+  for (const CompiledOp& op : ops)
+  {
+    if (skip_count)
+    {
+      if (skip_count > 0)
+        --skip_count;
+      else if (-CONDTIONAL_ALL_LINES == skip_count)
+        return;
+      else if (op.kind == CompiledOp::Kind::EndIf)
+        skip_count = 0;
+      continue;
+    }
+
+    switch (op.kind)
+    {
+    case CompiledOp::Kind::End:
+      return;
+
+    case CompiledOp::Kind::EndIf:
+    case CompiledOp::Kind::Nop:
+      break;
+
+    case CompiledOp::Kind::Write:
+      if (op.size == 1)
+        RunCompiledWrite<u8>(guard, op);
+      else if (op.size == 2)
+        RunCompiledWrite<u16>(guard, op);
+      else
+        RunCompiledWrite<u32>(guard, op);
+      break;
+
+    case CompiledOp::Kind::Compare:
+    {
+      u32 value;
+      if (op.size == 1)
+        value = RunCompiledRead<u8>(guard, op.address);
+      else if (op.size == 2)
+        value = RunCompiledRead<u16>(guard, op.address);
+      else
+        value = RunCompiledRead<u32>(guard, op.address);
+      if (!CompareValues(value, op.value, op.compare_type))
+        skip_count = op.skip_count;
+      break;
+    }
+    }
+  }
+}
+
 void RunAllActive(const Core::CPUThreadGuard& cpu_guard)
 {
   if (!Config::AreCheatsEnabled())
@@ -1013,11 +1282,37 @@ void RunAllActive(const Core::CPUThreadGuard& cpu_guard)
   // are only atomic ops unless contested. It should be rare for this to
   // be contested.
   std::lock_guard guard(s_lock);
-  std::erase_if(s_active_codes, [&cpu_guard](const ARCode& code) {
-    const bool success = RunCodeLocked(cpu_guard, code);
-    LogInfo("\n");
-    return !success;
-  });
+  if (s_compiled_codes.size() != s_active_codes.size())
+  {
+    s_compiled_codes.clear();
+    s_compiled_codes.reserve(s_active_codes.size());
+    std::ranges::transform(s_active_codes, std::back_inserter(s_compiled_codes), CompileCode);
+  }
+
+  size_t kept = 0;
+  for (size_t i = 0; i < s_active_codes.size(); ++i)
+  {
+    if (s_disable_logging && s_compiled_codes[i])
+    {
+      RunCompiledCodeLocked(cpu_guard, s_active_codes[i], *s_compiled_codes[i]);
+    }
+    else
+    {
+      const bool success = RunCodeLocked(cpu_guard, s_active_codes[i]);
+      LogInfo("\n");
+      if (!success)
+        continue;
+    }
+
+    if (kept != i)
+    {
+      s_active_codes[kept] = std::move(s_active_codes[i]);
+      s_compiled_codes[kept] = std::move(s_compiled_codes[i]);
+    }
+    ++kept;
+  }
+  s_active_codes.erase(s_active_codes.begin() + kept, s_active_codes.end());
+  s_compiled_codes.erase(s_compiled_codes.begin() + kept, s_compiled_codes.end());
   s_disable_logging = true;
 }
 
@@ -140,6 +140,11 @@ IOS::HLE::FS::FileSystem* BootSessionData::GetWiiSyncFS() const
   return m_wii_sync_fs.get();
 }
 
+const std::string& BootSessionData::GetWiiSyncFSRoot() const
+{
+  return m_wii_sync_fs_root;
+}
+
 const std::vector<u64>& BootSessionData::GetWiiSyncTitles() const
 {
   return m_wii_sync_titles;
@@ -157,10 +162,11 @@ void BootSessionData::InvokeWiiSyncCleanup() const
 }
 
 void BootSessionData::SetWiiSyncData(std::unique_ptr<IOS::HLE::FS::FileSystem> fs,
-                                     std::vector<u64> titles, std::string redirect_folder,
-                                     WiiSyncCleanupFunction cleanup)
+                                     std::string fs_root, std::vector<u64> titles,
+                                     std::string redirect_folder, WiiSyncCleanupFunction cleanup)
 {
   m_wii_sync_fs = std::move(fs);
+  m_wii_sync_fs_root = std::move(fs_root);
   m_wii_sync_titles = std::move(titles);
   m_wii_sync_redirect_folder = std::move(redirect_folder);
   m_wii_sync_cleanup = std::move(cleanup);
@@ -320,10 +326,11 @@ BootParameters::IPL::IPL(DiscIO::Region region_, Disc&& disc_) : IPL(region_)
 // because DVDThread can do whatever it wants to the disc after that.
 static const DiscIO::VolumeDisc* SetDisc(DVD::DVDInterface& dvd_interface,
                                          std::unique_ptr<DiscIO::VolumeDisc> disc,
+                                         const std::string& path,
                                          std::vector<std::string> auto_disc_change_paths = {})
 {
   const DiscIO::VolumeDisc* pointer = disc.get();
-  dvd_interface.SetDisc(std::move(disc), auto_disc_change_paths);
+  dvd_interface.SetDisc(std::move(disc), path, auto_disc_change_paths);
   return pointer;
 }
 
@@ -469,7 +476,7 @@ static void SetDefaultDisc(DVD::DVDInterface& dvd_interface)
 {
   const std::string default_iso = Config::Get(Config::MAIN_DEFAULT_ISO);
   if (!default_iso.empty())
-    SetDisc(dvd_interface, DiscIO::CreateDiscForCore(default_iso));
+    SetDisc(dvd_interface, DiscIO::CreateDiscForCore(default_iso), default_iso);
 }
 
 static void CopyDefaultExceptionHandlers(Core::System& system)
@@ -507,7 +514,8 @@ bool CBoot::BootUp(Core::System& system, const Core::CPUThreadGuard& guard,
     {
       NOTICE_LOG_FMT(BOOT, "Booting from disc: {}", disc.path);
       const DiscIO::VolumeDisc* volume =
-          SetDisc(system.GetDVDInterface(), std::move(disc.volume), disc.auto_disc_change_paths);
+          SetDisc(system.GetDVDInterface(), std::move(disc.volume), disc.path,
+                  disc.auto_disc_change_paths);
 
       if (!volume)
         return false;
@@ -630,7 +638,7 @@ bool CBoot::BootUp(Core::System& system, const Core::CPUThreadGuard& guard,
       {
         NOTICE_LOG_FMT(BOOT, "Inserting disc: {}", ipl.disc->path);
         SetDisc(system.GetDVDInterface(), DiscIO::CreateDiscForCore(ipl.disc->path),
-                ipl.disc->auto_disc_change_paths);
+                ipl.disc->path, ipl.disc->auto_disc_change_paths);
       }
       else
       {
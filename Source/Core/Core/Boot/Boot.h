@@ -83,11 +83,15 @@ public:
   using WiiSyncCleanupFunction = std::function<void()>;
 
   IOS::HLE::FS::FileSystem* GetWiiSyncFS() const;
+  // The host directory of the sync FS, if it is a temporary copy that is deleted by the cleanup
+  // function. Its saves are then moved into the session NAND rather than copied.
+  const std::string& GetWiiSyncFSRoot() const;
   const std::vector<u64>& GetWiiSyncTitles() const;
   const std::string& GetWiiSyncRedirectFolder() const;
   void InvokeWiiSyncCleanup() const;
-  void SetWiiSyncData(std::unique_ptr<IOS::HLE::FS::FileSystem> fs, std::vector<u64> titles,
-                      std::string redirect_folder, WiiSyncCleanupFunction cleanup);
+  void SetWiiSyncData(std::unique_ptr<IOS::HLE::FS::FileSystem> fs, std::string fs_root,
+                      std::vector<u64> titles, std::string redirect_folder,
+                      WiiSyncCleanupFunction cleanup);
 
   const NetPlay::NetSettings* GetNetplaySettings() const;
   void SetNetplaySettings(std::unique_ptr<NetPlay::NetSettings> netplay_settings);
@@ -97,6 +101,7 @@ private:
   DeleteSavestateAfterBoot m_delete_savestate = DeleteSavestateAfterBoot::No;
 
   std::unique_ptr<IOS::HLE::FS::FileSystem> m_wii_sync_fs;
+  std::string m_wii_sync_fs_root;
   std::vector<u64> m_wii_sync_titles;
   std::string m_wii_sync_redirect_folder;
   WiiSyncCleanupFunction m_wii_sync_cleanup;
@@ -3,11 +3,15 @@
 
 #include "Core/CheatSearch.h"
 
+#include <algorithm>
 #include <bit>
+#include <cstring>
 #include <functional>
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <variant>
 #include <vector>
@@ -15,6 +19,7 @@
 #include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/Core.h"
@@ -108,17 +113,73 @@ TryReadValueFromEmulatedMemory(const Core::CPUThreadGuard& guard, u32 addr,
   return PowerPC::MMU::HostTryRead<T>(guard, addr, space);
 }
 
+namespace
+{
+// Where a page of emulated memory is in host memory, if it is RAM that can be read directly.
+struct HostPage
+{
+  const u8* data = nullptr;
+  bool translated = false;
+};
+
+HostPage GetHostPage(const Core::CPUThreadGuard& guard, u32 page_address,
+                     PowerPC::RequestedAddressSpace space)
+{
+  auto& system = guard.GetSystem();
+  const auto& ppc_state = system.GetPPCState();
+
+  // With the data cache emulated, reads may not return what is in RAM.
+  if (ppc_state.m_enable_dcache)
+    return {};
+
+  u32 physical_address = page_address;
+  const bool translated = space != PowerPC::RequestedAddressSpace::Physical && ppc_state.msr.DR;
+  if (translated)
+  {
+    const std::optional<u32> translated_address =
+        system.GetMMU().GetTranslatedAddress(page_address);
+    if (!translated_address)
+      return {};
+    physical_address = *translated_address;
+  }
+
+  // The same checks as MMU::ReadFromHardware. Anything else goes through the MMU.
+  auto& memory = system.GetMemory();
+  if (memory.GetRAM() && (physical_address & 0xF8000000) == 0x00000000)
+    return {&memory.GetRAM()[physical_address & memory.GetRamMask()], translated};
+  if (memory.GetEXRAM() && (physical_address >> 28) == 0x1 &&
+      (physical_address & 0x0FFFFFFF) < memory.GetExRamSizeReal())
+  {
+    return {&memory.GetEXRAM()[physical_address & 0x0FFFFFFF], translated};
+  }
+  return {};
+}
+
 template <typename T>
-auto Cheats::NewSearch(const Core::CPUThreadGuard& guard,
-                       const std::vector<Cheats::MemoryRange>& memory_ranges,
-                       PowerPC::RequestedAddressSpace address_space, bool aligned,
-                       const std::function<bool(const T& value)>& validator)
-    -> Common::Result<std::vector<SearchResult<T>>, SearchErrorCode>
+T ReadHostValue(const u8* data)
+{
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return Common::FromBigEndian(value);
+}
+
+template <typename T>
+Cheats::SearchResult<T> MakeSearchResult(u32 address, const PowerPC::ReadResult<T>& value)
+{
+  Cheats::SearchResult<T> r;
+  r.m_value = value.value;
+  r.m_value_state = value.translated ? Cheats::SearchResultValueState::ValueFromVirtualMemory :
+                                       Cheats::SearchResultValueState::ValueFromPhysicalMemory;
+  r.m_address = address;
+  return r;
+}
+
+Cheats::SearchErrorCode CheckSearchPossible(const Core::CPUThreadGuard& guard,
+                                            PowerPC::RequestedAddressSpace address_space)
 {
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
     return Cheats::SearchErrorCode::DisabledInHardcoreMode;
   auto& system = guard.GetSystem();
-  std::vector<Cheats::SearchResult<T>> results;
   const Core::State core_state = Core::GetState(system);
   if (core_state != Core::State::Running && core_state != Core::State::Paused)
     return Cheats::SearchErrorCode::NoEmulationActive;
@@ -127,12 +188,60 @@ auto Cheats::NewSearch(const Core::CPUThreadGuard& guard,
   if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
     return Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
 
+  return Cheats::SearchErrorCode::Success;
+}
+
+// The validators are template parameters, rather than std::functions, so that the comparison is
+// inlined into the loops over memory.
+template <typename T, typename Validator>
+auto RunNewSearch(const Core::CPUThreadGuard& guard,
+                  const std::vector<Cheats::MemoryRange>& memory_ranges,
+                  PowerPC::RequestedAddressSpace address_space, bool aligned,
+                  const Validator& validator)
+    -> Common::Result<std::vector<Cheats::SearchResult<T>>, Cheats::SearchErrorCode>
+{
+  if (const Cheats::SearchErrorCode error = CheckSearchPossible(guard, address_space);
+      error != Cheats::SearchErrorCode::Success)
+  {
+    return error;
+  }
+
+  // The values to search are split into pieces. Those in RAM that can be read directly are
+  // searched on all cores, the rest (data == nullptr) is read through the MMU on this thread.
+  struct Piece
+  {
+    u32 address;
+    u64 count;
+    const u8* data;
+    bool translated;
+  };
+  constexpr u64 PIECE_SIZE = 0x10000;
+
+  const u32 increment_per_loop = aligned ? sizeof(T) : 1;
+  std::vector<Piece> pieces;
+  const auto add_values = [&](u32 address, u64 count, const u8* data, bool translated) {
+    if (count == 0)
+      return;
+    if (!pieces.empty())
+    {
+      Piece& last = pieces.back();
+      const u64 last_size = last.count * increment_per_loop;
+      if (last.count < PIECE_SIZE && static_cast<u32>(last.address + last_size) == address &&
+          (data ? last.data && last.data + last_size == data && last.translated == translated :
+                  !last.data))
+      {
+        last.count += count;
+        return;
+      }
+    }
+    pieces.push_back({address, count, data, translated});
+  };
+
   for (const Cheats::MemoryRange& range : memory_ranges)
   {
     if (range.m_length < sizeof(T))
       continue;
 
-    const u32 increment_per_loop = aligned ? sizeof(T) : 1;
     const u32 start_address = aligned ? Common::AlignUp(range.m_start, sizeof(T)) : range.m_start;
     const u64 aligned_length = range.m_length - (start_address - range.m_start);
 
@@ -140,50 +249,150 @@ auto Cheats::NewSearch(const Core::CPUThreadGuard& guard,
       continue;
 
     const u64 length = aligned_length - (sizeof(T) - 1);
-    for (u64 i = 0; i < length; i += increment_per_loop)
+    u32 address = start_address;
+    u64 count = (length + increment_per_loop - 1) / increment_per_loop;
+    std::optional<HostPage> next_page;
+    while (count != 0)
     {
-      const u32 addr = start_address + i;
-      const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
-      if (!current_value)
-        continue;
+      const u32 page_address = address & ~PowerPC::HW_PAGE_MASK;
+      const HostPage page =
+          next_page ? *next_page : GetHostPage(guard, page_address, address_space);
+      next_page.reset();
+
+      // The values that start in this page, and how many of them also end in it.
+      const u64 page_end = u64{page_address} + PowerPC::HW_PAGE_SIZE;
+      const u64 starting =
+          std::min(count, (page_end - address + increment_per_loop - 1) / increment_per_loop);
+      const u64 ending =
+          page_end - address < sizeof(T) ?
+              0 :
+              std::min(starting, (page_end - address - sizeof(T)) / increment_per_loop + 1);
+      add_values(address, ending, page.data ? page.data + (address - page_address) : nullptr,
+                 page.translated);
+
+      if (ending != starting)
+      {
+        next_page = GetHostPage(guard, static_cast<u32>(page_end), address_space);
+        const u32 crossing_address = static_cast<u32>(address + ending * increment_per_loop);
+        const bool contiguous = page.data &&
+                                next_page->data == page.data + PowerPC::HW_PAGE_SIZE &&
+                                next_page->translated == page.translated;
+        add_values(crossing_address, starting - ending,
+                   contiguous ? page.data + (crossing_address - page_address) : nullptr,
+                   page.translated);
+      }
 
-      if (validator(current_value->value))
+      address = static_cast<u32>(address + starting * increment_per_loop);
+      count -= starting;
+    }
+  }
+
+  std::vector<std::vector<Cheats::SearchResult<T>>> piece_results(pieces.size());
+  const auto search_piece = [&](size_t index) {
+    const Piece& piece = pieces[index];
+    std::vector<Cheats::SearchResult<T>>& results = piece_results[index];
+    for (u64 i = 0; i < piece.count; ++i)
+    {
+      const u32 addr = static_cast<u32>(piece.address + i * increment_per_loop);
+      if (piece.data)
       {
-        auto& r = results.emplace_back();
-        r.m_value = current_value->value;
-        r.m_value_state = current_value->translated ?
-                              Cheats::SearchResultValueState::ValueFromVirtualMemory :
-                              Cheats::SearchResultValueState::ValueFromPhysicalMemory;
-        r.m_address = addr;
+        const T value = ReadHostValue<T>(piece.data + i * increment_per_loop);
+        if (validator(value))
+        {
+          results.push_back(
+              MakeSearchResult(addr, PowerPC::ReadResult<T>(piece.translated, value)));
+        }
+        continue;
       }
+
+      const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+      if (current_value && validator(current_value->value))
+        results.push_back(MakeSearchResult(addr, *current_value));
     }
+  };
+
+  std::vector<size_t> direct_pieces;
+  for (size_t i = 0; i < pieces.size(); ++i)
+  {
+    if (pieces[i].data)
+      direct_pieces.push_back(i);
+  }
+
+  const size_t threads =
+      std::min(direct_pieces.size(), std::max<size_t>(1, std::thread::hardware_concurrency()));
+  std::vector<std::future<void>> futures(threads);
+  for (size_t i = 0; i < threads; ++i)
+  {
+    futures[i] = std::async(
+        std::launch::async,
+        [&](size_t start, size_t end) {
+          for (size_t j = start; j < end; ++j)
+            search_piece(direct_pieces[j]);
+        },
+        i * direct_pieces.size() / threads, (i + 1) * direct_pieces.size() / threads);
+  }
+
+  for (size_t i = 0; i < pieces.size(); ++i)
+  {
+    if (!pieces[i].data)
+      search_piece(i);
+  }
+
+  for (std::future<void>& future : futures)
+    future.get();
+
+  size_t result_count = 0;
+  for (const auto& results : piece_results)
+    result_count += results.size();
+
+  std::vector<Cheats::SearchResult<T>> results;
+  results.reserve(result_count);
+  for (auto& piece : piece_results)
+  {
+    results.insert(results.end(), piece.begin(), piece.end());
+    piece = {};
   }
   return results;
 }
 
-template <typename T>
-auto Cheats::NextSearch(
-    const Core::CPUThreadGuard& guard, const std::vector<Cheats::SearchResult<T>>& previous_results,
-    PowerPC::RequestedAddressSpace address_space,
-    const std::function<bool(const T& new_value, const T& old_value)>& validator)
-    -> Common::Result<std::vector<SearchResult<T>>, SearchErrorCode>
+template <typename T, typename Validator>
+auto RunNextSearch(const Core::CPUThreadGuard& guard,
+                   const std::vector<Cheats::SearchResult<T>>& previous_results,
+                   PowerPC::RequestedAddressSpace address_space, const Validator& validator)
+    -> Common::Result<std::vector<Cheats::SearchResult<T>>, Cheats::SearchErrorCode>
 {
-  if (AchievementManager::GetInstance().IsHardcoreModeActive())
-    return Cheats::SearchErrorCode::DisabledInHardcoreMode;
-  auto& system = guard.GetSystem();
-  std::vector<Cheats::SearchResult<T>> results;
-  const Core::State core_state = Core::GetState(system);
-  if (core_state != Core::State::Running && core_state != Core::State::Paused)
-    return Cheats::SearchErrorCode::NoEmulationActive;
+  if (const Cheats::SearchErrorCode error = CheckSearchPossible(guard, address_space);
+      error != Cheats::SearchErrorCode::Success)
+  {
+    return error;
+  }
 
-  const auto& ppc_state = system.GetPPCState();
-  if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
-    return Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
+  // The results are sorted by address, so the translation of the last page is reused.
+  std::optional<u32> last_page_address;
+  HostPage last_page;
 
+  std::vector<Cheats::SearchResult<T>> results;
   for (const auto& previous_result : previous_results)
   {
     const u32 addr = previous_result.m_address;
-    const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+    std::optional<PowerPC::ReadResult<T>> current_value;
+    if ((addr & PowerPC::HW_PAGE_MASK) + sizeof(T) <= PowerPC::HW_PAGE_SIZE)
+    {
+      const u32 page_address = addr & ~PowerPC::HW_PAGE_MASK;
+      if (last_page_address != page_address)
+      {
+        last_page = GetHostPage(guard, page_address, address_space);
+        last_page_address = page_address;
+      }
+      if (last_page.data)
+      {
+        const u8* const data = last_page.data + (addr & PowerPC::HW_PAGE_MASK);
+        current_value.emplace(last_page.translated, ReadHostValue<T>(data));
+      }
+    }
+    if (!current_value)
+      current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+
     if (!current_value)
     {
       auto& r = results.emplace_back();
@@ -195,17 +404,31 @@ auto Cheats::NextSearch(
     // if the previous state was invalid we always update the value to avoid getting stuck in an
     // invalid state
     if (!previous_result.IsValueValid() || validator(current_value->value, previous_result.m_value))
-    {
-      auto& r = results.emplace_back();
-      r.m_value = current_value->value;
-      r.m_value_state = current_value->translated ?
-                            Cheats::SearchResultValueState::ValueFromVirtualMemory :
-                            Cheats::SearchResultValueState::ValueFromPhysicalMemory;
-      r.m_address = addr;
-    }
+      results.push_back(MakeSearchResult(addr, *current_value));
   }
   return results;
 }
+}  // namespace
+
+template <typename T>
+auto Cheats::NewSearch(const Core::CPUThreadGuard& guard,
+                       const std::vector<Cheats::MemoryRange>& memory_ranges,
+                       PowerPC::RequestedAddressSpace address_space, bool aligned,
+                       const std::function<bool(const T& value)>& validator)
+    -> Common::Result<std::vector<SearchResult<T>>, SearchErrorCode>
+{
+  return RunNewSearch<T>(guard, memory_ranges, address_space, aligned, validator);
+}
+
+template <typename T>
+auto Cheats::NextSearch(
+    const Core::CPUThreadGuard& guard, const std::vector<Cheats::SearchResult<T>>& previous_results,
+    PowerPC::RequestedAddressSpace address_space,
+    const std::function<bool(const T& new_value, const T& old_value)>& validator)
+    -> Common::Result<std::vector<SearchResult<T>>, SearchErrorCode>
+{
+  return RunNextSearch<T>(guard, previous_results, address_space, validator);
+}
 
 Cheats::CheatSearchSessionBase::~CheatSearchSessionBase() = default;
 
@@ -282,51 +505,29 @@ void Cheats::CheatSearchSession<T>::ResetResults()
   m_search_results.clear();
 }
 
-template <typename T>
-static std::function<bool(const T& new_value)>
-MakeCompareFunctionForSpecificValue(Cheats::CompareType op, const T& old_value)
+// Calls f with the function object for the comparison, so that the searches are instantiated for
+// each comparison.
+template <typename T, typename F>
+static Common::Result<std::vector<Cheats::SearchResult<T>>, Cheats::SearchErrorCode>
+VisitCompareFunction(Cheats::CompareType op, F&& f)
 {
   switch (op)
   {
   case Cheats::CompareType::Equal:
-    return [&](const T& new_value) { return new_value == old_value; };
+    return f(std::equal_to<T>());
   case Cheats::CompareType::NotEqual:
-    return [&](const T& new_value) { return new_value != old_value; };
+    return f(std::not_equal_to<T>());
   case Cheats::CompareType::Less:
-    return [&](const T& new_value) { return new_value < old_value; };
+    return f(std::less<T>());
   case Cheats::CompareType::LessOrEqual:
-    return [&](const T& new_value) { return new_value <= old_value; };
+    return f(std::less_equal<T>());
   case Cheats::CompareType::Greater:
-    return [&](const T& new_value) { return new_value > old_value; };
+    return f(std::greater<T>());
   case Cheats::CompareType::GreaterOrEqual:
-    return [&](const T& new_value) { return new_value >= old_value; };
+    return f(std::greater_equal<T>());
   default:
     DEBUG_ASSERT(false);
-    return nullptr;
-  }
-}
-
-template <typename T>
-static std::function<bool(const T& old_value, const T& new_value)>
-MakeCompareFunctionForLastValue(Cheats::CompareType op)
-{
-  switch (op)
-  {
-  case Cheats::CompareType::Equal:
-    return std::equal_to<T>();
-  case Cheats::CompareType::NotEqual:
-    return std::not_equal_to<T>();
-  case Cheats::CompareType::Less:
-    return std::less<T>();
-  case Cheats::CompareType::LessOrEqual:
-    return std::less_equal<T>();
-  case Cheats::CompareType::Greater:
-    return std::greater<T>();
-  case Cheats::CompareType::GreaterOrEqual:
-    return std::greater_equal<T>();
-  default:
-    DEBUG_ASSERT(false);
-    return nullptr;
+    return Cheats::SearchErrorCode::InvalidParameters;
   }
 }
 
@@ -342,37 +543,38 @@ Cheats::SearchErrorCode Cheats::CheatSearchSession<T>::RunSearch(const Core::CPU
     if (!m_value)
       return Cheats::SearchErrorCode::InvalidParameters;
 
-    auto func = MakeCompareFunctionForSpecificValue<T>(m_compare_type, *m_value);
-    if (m_first_search_done)
-    {
-      result = Cheats::NextSearch<T>(
-          guard, m_search_results, m_address_space,
-          [&func](const T& new_value, const T& old_value) { return func(new_value); });
-    }
-    else
-    {
-      result = Cheats::NewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned, func);
-    }
+    const T value = *m_value;
+    result = VisitCompareFunction<T>(m_compare_type, [&](auto compare) {
+      if (m_first_search_done)
+      {
+        return RunNextSearch<T>(
+            guard, m_search_results, m_address_space,
+            [&](const T& new_value, const T& old_value) { return compare(new_value, value); });
+      }
+      return RunNewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned,
+                             [&](const T& new_value) { return compare(new_value, value); });
+    });
   }
   else if (m_filter_type == FilterType::CompareAgainstLastValue)
   {
     if (!m_first_search_done)
       return Cheats::SearchErrorCode::InvalidParameters;
 
-    result = Cheats::NextSearch<T>(guard, m_search_results, m_address_space,
-                                   MakeCompareFunctionForLastValue<T>(m_compare_type));
+    result = VisitCompareFunction<T>(m_compare_type, [&](auto compare) {
+      return RunNextSearch<T>(guard, m_search_results, m_address_space, compare);
+    });
   }
   else if (m_filter_type == FilterType::DoNotFilter)
   {
     if (m_first_search_done)
     {
-      result = Cheats::NextSearch<T>(guard, m_search_results, m_address_space,
-                                     [](const T& v1, const T& v2) { return true; });
+      result = RunNextSearch<T>(guard, m_search_results, m_address_space,
+                                [](const T& v1, const T& v2) { return true; });
     }
     else
     {
-      result = Cheats::NewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned,
-                                    [](const T& v) { return true; });
+      result = RunNewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned,
+                               [](const T& v) { return true; });
     }
   }
 
@@ -48,9 +48,17 @@ extern const Info<bool> GFX_SHOW_VTIMES;
 extern const Info<bool> GFX_SHOW_GRAPHS;
 extern const Info<bool> GFX_SHOW_SPEED;
 extern const Info<bool> GFX_SHOW_SPEED_COLORS;
+extern const Info<bool> GFX_SHOW_FRAME_TIMINGS;
+// While enabled, every profiled scope is recorded, and written to the frame dump directory as
+// Chrome trace JSON when it is disabled again or emulation stops.
+extern const Info<bool> GFX_TRACE_FRAME_TIMINGS;
+// Keeps the last seconds of profiled scopes, which the "Dump Recent Frame Timings" hotkey writes as
+// a trace.
+extern const Info<bool> GFX_KEEP_RECENT_FRAME_TIMINGS;
 extern const Info<bool> GFX_MOVABLE_PERFORMANCE_METRICS;
 extern const Info<int> GFX_PERF_SAMP_WINDOW;
 extern const Info<bool> GFX_SHOW_NETPLAY_PING;
+extern const Info<bool> GFX_SHOW_NETPLAY_STATS;
 extern const Info<bool> GFX_SHOW_NETPLAY_MESSAGES;
 extern const Info<bool> GFX_LOG_RENDER_TIME_TO_FILE;
 extern const Info<bool> GFX_OVERLAY_STATS;
@@ -62,6 +70,13 @@ extern const Info<bool> GFX_DUMP_BASE_TEXTURES;
 extern const Info<int> GFX_TEXTURE_PNG_COMPRESSION_LEVEL;
 extern const Info<bool> GFX_HIRES_TEXTURES;
 extern const Info<bool> GFX_CACHE_HIRES_TEXTURES;
+// In MiB, 0 chooses one from the system memory.
+extern const Info<int> GFX_CUSTOM_RESOURCES_MEMORY_BUDGET;
+// In MiB, how much of the budget assets that haven't been used recently may keep.
+// 0 allows a quarter of the budget.
+extern const Info<int> GFX_CUSTOM_RESOURCES_UNUSED_MEMORY_BUDGET;
+// 0 chooses a number from the CPU.
+extern const Info<int> GFX_CUSTOM_ASSET_LOADER_THREADS;
 extern const Info<bool> GFX_DUMP_EFB_TARGET;
 extern const Info<bool> GFX_DUMP_XFB_TARGET;
 extern const Info<bool> GFX_DUMP_FRAMES_AS_IMAGES;
@@ -75,6 +90,7 @@ extern const Info<int> GFX_BITRATE_KBPS;
 extern const Info<FrameDumpResolutionType> GFX_FRAME_DUMPS_RESOLUTION_TYPE;
 extern const Info<int> GFX_PNG_COMPRESSION_LEVEL;
 extern const Info<bool> GFX_ENABLE_GPU_TEXTURE_DECODING;
+extern const Info<bool> GFX_AUTO_GPU_TEXTURE_DECODING;
 extern const Info<bool> GFX_ENABLE_PIXEL_LIGHTING;
 extern const Info<bool> GFX_FAST_DEPTH_CALC;
 extern const Info<u32> GFX_MSAA;
@@ -92,11 +108,14 @@ extern const Info<int> GFX_COMMAND_BUFFER_EXECUTE_INTERVAL;
 extern const Info<bool> GFX_SHADER_CACHE;
 extern const Info<bool> GFX_WAIT_FOR_SHADERS_BEFORE_STARTING;
 extern const Info<ShaderCompilationMode> GFX_SHADER_COMPILATION_MODE;
+extern const Info<bool> GFX_STAGE_SPECIALIZED_UBERSHADERS;
 extern const Info<int> GFX_SHADER_COMPILER_THREADS;
 extern const Info<int> GFX_SHADER_PRECOMPILER_THREADS;
 extern const Info<bool> GFX_SAVE_TEXTURE_CACHE_TO_STATE;
 extern const Info<bool> GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION;
 extern const Info<bool> GFX_CPU_CULL;
+extern const Info<int> GFX_VERTEX_LOADER_THREADS;
+extern const Info<int> GFX_TEXTURE_DECODER_THREADS;
 
 extern const Info<TriState> GFX_MTL_MANUALLY_UPLOAD_BUFFERS;
 extern const Info<TriState> GFX_MTL_USE_PRESENT_DRAWABLE;
@@ -104,8 +123,12 @@ extern const Info<TriState> GFX_MTL_USE_PRESENT_DRAWABLE;
 extern const Info<bool> GFX_SW_DUMP_OBJECTS;
 extern const Info<bool> GFX_SW_DUMP_TEV_STAGES;
 extern const Info<bool> GFX_SW_DUMP_TEV_TEX_FETCHES;
+extern const Info<int> GFX_SW_RASTERIZER_THREADS;
+
+extern const Info<bool> GFX_NULL_SKIP_GX_PROCESSING;
 
 extern const Info<bool> GFX_PREFER_GLES;
+extern const Info<std::string> GFX_OGL_STREAM_BUFFER_TYPE;
 
 extern const Info<bool> GFX_MODS_ENABLE;
 
@@ -162,6 +185,7 @@ extern const Info<bool> GFX_HACK_EFB_ACCESS_ENABLE;
 extern const Info<bool> GFX_HACK_EFB_DEFER_INVALIDATION;
 extern const Info<int> GFX_HACK_EFB_ACCESS_TILE_SIZE;
 extern const Info<bool> GFX_HACK_BBOX_ENABLE;
+extern const Info<bool> GFX_HACK_BBOX_DEFERRED_READBACK;
 extern const Info<bool> GFX_HACK_FORCE_PROGRESSIVE;
 extern const Info<bool> GFX_HACK_SKIP_EFB_COPY_TO_RAM;
 extern const Info<bool> GFX_HACK_SKIP_XFB_COPY_TO_RAM;
@@ -184,6 +208,7 @@ extern const Info<bool> GFX_HACK_NO_MIPMAPPING;
 // Graphics.GameSpecific
 
 extern const Info<bool> GFX_PERF_QUERIES_ENABLE;
+extern const Info<bool> GFX_PERF_QUERIES_EXACT;
 
 // Android custom GPU drivers
 
@@ -57,8 +57,12 @@ namespace Config
 extern const Info<bool> MAIN_SKIP_IPL;
 extern const Info<PowerPC::CPUCore> MAIN_CPU_CORE;
 extern const Info<bool> MAIN_JIT_FOLLOW_BRANCH;
+extern const Info<bool> MAIN_JIT_DISK_CACHE;
+extern const Info<bool> MAIN_JIT_TIERED_COMPILATION;
+extern const Info<bool> MAIN_JIT_SUPERBLOCKS;
 extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_FASTMEM_ARENA;
+extern const Info<bool> MAIN_FASTMEM_HUGE_PAGES;
 extern const Info<bool> MAIN_LARGE_ENTRY_POINTS_MAP;
 extern const Info<bool> MAIN_ACCURATE_CPU_CACHE;
 // Should really be in the DSP section, but we're kind of stuck with bad decisions made in the past.
@@ -70,7 +74,10 @@ extern const Info<bool> MAIN_RUSH_FRAME_PRESENTATION;
 extern const Info<bool> MAIN_SMOOTH_EARLY_PRESENTATION;
 extern const Info<bool> MAIN_CPU_THREAD;
 extern const Info<bool> MAIN_LOAD_GAME_INTO_MEMORY;
+extern const Info<bool> MAIN_MEMORY_MAP_DISC_IMAGES;
+extern const Info<int> MAIN_COMPRESSED_CHUNK_CACHE_SIZE;
 extern const Info<bool> MAIN_SYNC_ON_SKIP_IDLE;
+extern const Info<bool> MAIN_MEMORY_WATCHER_SHARED_MEMORY;
 extern const Info<std::string> MAIN_DEFAULT_ISO;
 extern const Info<bool> MAIN_ENABLE_CHEATS;
 extern const Info<int> MAIN_GC_LANGUAGE;
@@ -80,6 +87,7 @@ extern const Info<AudioCommon::DPL2Quality> MAIN_DPL2_QUALITY;
 extern const Info<int> MAIN_AUDIO_LATENCY;
 extern const Info<int> MAIN_AUDIO_BUFFER_SIZE;
 extern const Info<bool> MAIN_AUDIO_FILL_GAPS;
+extern const Info<bool> MAIN_AUDIO_LOW_LATENCY;
 extern const Info<std::string> MAIN_MEMCARD_A_PATH;
 extern const Info<std::string> MAIN_MEMCARD_B_PATH;
 const Info<std::string>& GetInfoForMemcardPath(ExpansionInterface::Slot slot);
@@ -124,6 +132,7 @@ extern const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE;
 extern const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE;
 extern const Info<float> MAIN_SYNC_GPU_OVERCLOCK;
 extern const Info<bool> MAIN_FAST_DISC_SPEED;
+extern const Info<bool> MAIN_DVD_READ_AHEAD;
 extern const Info<bool> MAIN_LOW_DCBZ_HACK;
 extern const Info<bool> MAIN_FLOAT_EXCEPTIONS;
 extern const Info<bool> MAIN_DIVIDE_BY_ZERO_EXCEPTIONS;
@@ -156,11 +165,14 @@ extern const Info<std::string> MAIN_GPU_DETERMINISM_MODE;
 GPUDeterminismMode GetGPUDeterminismMode();
 
 extern const Info<std::string> MAIN_PERF_MAP_DIR;
+extern const Info<bool> MAIN_PERF_JITDUMP;
 extern const Info<bool> MAIN_CUSTOM_RTC_ENABLE;
 extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
 extern const Info<bool> MAIN_ALLOW_SD_WRITES;
 extern const Info<bool> MAIN_ENABLE_SAVESTATES;
+// 0 compresses savestates with LZ4, anything higher selects zstd at that level.
+extern const Info<int> MAIN_SAVESTATE_ZSTD_LEVEL;
 extern const Info<DiscIO::Region> MAIN_FALLBACK_REGION;
 extern const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS;
 extern const Info<s32> MAIN_OVERRIDE_BOOT_IOS;
@@ -237,6 +249,9 @@ extern const Info<bool> MAIN_NETWORK_SSL_DUMP_ROOT_CA;
 extern const Info<bool> MAIN_NETWORK_SSL_DUMP_PEER_CERT;
 extern const Info<bool> MAIN_NETWORK_DUMP_BBA;
 extern const Info<bool> MAIN_NETWORK_DUMP_AS_PCAP;
+// In MiB. When not 0, PCAP dumps only keep this much of the latest traffic in memory, and write it
+// to a file when asked to or when a connection is closed by the other end.
+extern const Info<int> MAIN_NETWORK_DUMP_RING_BUFFER_SIZE;
 extern const Info<int> MAIN_NETWORK_TIMEOUT;
 
 // Main.Interface
@@ -316,6 +331,8 @@ extern const Info<bool> MAIN_GAMELIST_COLUMN_TAGS;
 
 extern const Info<bool> MAIN_FIFOPLAYER_LOOP_REPLAY;
 extern const Info<bool> MAIN_FIFOPLAYER_EARLY_MEMORY_UPDATES;
+extern const Info<bool> MAIN_FIFOPLAYER_BENCHMARK;
+extern const Info<bool> MAIN_FIFOPLAYER_COMPRESS;
 
 // Main.AutoUpdate
 
@@ -332,6 +349,10 @@ extern const Info<bool> MAIN_MOVIE_SHOW_INPUT_DISPLAY;
 extern const Info<bool> MAIN_MOVIE_SHOW_RTC;
 extern const Info<bool> MAIN_MOVIE_SHOW_RERECORD;
 extern const Info<bool> MAIN_MOVIE_SHOW_OSD;
+extern const Info<bool> MAIN_MOVIE_SAVE_KEYFRAMES;
+// Whether DTM files are written with the inputs encoded, see Movie::InputLog. Off by default, as
+// other versions of Dolphin and programs that parse DTM files only read the older layout.
+extern const Info<bool> MAIN_MOVIE_ENCODE_INPUTS;
 
 // Main.Input
 
@@ -28,6 +28,8 @@ const Info<std::string> NETPLAY_INDEX_REGION{{System::Main, "NetPlay", "IndexReg
 const Info<std::string> NETPLAY_INDEX_PASSWORD{{System::Main, "NetPlay", "IndexPassword"}, ""};
 
 const Info<std::string> NETPLAY_HOST_CODE{{System::Main, "NetPlay", "HostCode"}, "00000000"};
+const Info<std::string> NETPLAY_RELAY_SERVER{{System::Main, "NetPlay", "RelayServer"}, ""};
+const Info<u16> NETPLAY_RELAY_PORT{{System::Main, "NetPlay", "RelayPort"}, 6263};
 
 const Info<u16> NETPLAY_HOST_PORT{{System::Main, "NetPlay", "HostPort"}, DEFAULT_LISTEN_PORT};
 const Info<std::string> NETPLAY_ADDRESS{{System::Main, "NetPlay", "Address"}, "127.0.0.1"};
@@ -45,11 +47,24 @@ const Info<u32> NETPLAY_CHUNKED_UPLOAD_LIMIT{{System::Main, "NetPlay", "ChunkedU
 
 const Info<u32> NETPLAY_BUFFER_SIZE{{System::Main, "NetPlay", "BufferSize"}, 5};
 const Info<u32> NETPLAY_CLIENT_BUFFER_SIZE{{System::Main, "NetPlay", "BufferSizeClient"}, 1};
+const Info<bool> NETPLAY_AUTO_BUFFER{{System::Main, "NetPlay", "AutoBuffer"}, false};
+const Info<bool> NETPLAY_REDUNDANT_PAD_DATA{{System::Main, "NetPlay", "RedundantPadData"},
+                                          false};
+const Info<bool> NETPLAY_STATE_FINGERPRINTS{{System::Main, "NetPlay", "StateFingerprints"},
+                                          false};
+const Info<u32> NETPLAY_WIIMOTE_BATCH_SIZE{{System::Main, "NetPlay", "WiimoteBatchSize"}, 1};
+const Info<bool> NETPLAY_DELAYED_SPECTATORS{{System::Main, "NetPlay", "DelayedSpectators"},
+                                          false};
+const Info<u32> NETPLAY_SPECTATOR_DELAY{{System::Main, "NetPlay", "SpectatorDelay"}, 180};
+const Info<bool> NETPLAY_ALLOW_LATE_JOIN{{System::Main, "NetPlay", "AllowLateJoin"}, false};
 
 const Info<bool> NETPLAY_SAVEDATA_LOAD{{System::Main, "NetPlay", "SyncSaves"}, true};
 const Info<bool> NETPLAY_SAVEDATA_WRITE{{System::Main, "NetPlay", "WriteSaveData"}, true};
 const Info<bool> NETPLAY_SAVEDATA_SYNC_ALL_WII{{System::Main, "NetPlay", "SyncAllWiiSaves"}, false};
 const Info<bool> NETPLAY_SYNC_CODES{{System::Main, "NetPlay", "SyncCodes"}, true};
+const Info<bool> NETPLAY_TRANSFER_GAMES{{System::Main, "NetPlay", "TransferGames"}, false};
+const Info<bool> NETPLAY_ACCEPT_GAME_TRANSFERS{{System::Main, "NetPlay", "AcceptGameTransfers"},
+                                               false};
 const Info<bool> NETPLAY_RECORD_INPUTS{{System::Main, "NetPlay", "RecordInputs"}, false};
 const Info<bool> NETPLAY_STRICT_SETTINGS_SYNC{{System::Main, "NetPlay", "StrictSettingsSync"},
                                               false};
@@ -57,5 +72,6 @@ const Info<std::string> NETPLAY_NETWORK_MODE{{System::Main, "NetPlay", "NetworkM
                                              "fixeddelay"};
 const Info<bool> NETPLAY_GOLF_MODE_OVERLAY{{System::Main, "NetPlay", "GolfModeOverlay"}, true};
 const Info<bool> NETPLAY_HIDE_REMOTE_GBAS{{System::Main, "NetPlay", "HideRemoteGBAs"}, false};
+const Info<bool> NETPLAY_ROLLBACK{{System::Main, "NetPlay", "Rollback"}, false};
 
 }  // namespace Config
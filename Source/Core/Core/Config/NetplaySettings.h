@@ -19,6 +19,9 @@ extern const Info<u16> NETPLAY_TRAVERSAL_PORT;
 extern const Info<u16> NETPLAY_TRAVERSAL_PORT_ALT;
 extern const Info<std::string> NETPLAY_TRAVERSAL_CHOICE;
 extern const Info<std::string> NETPLAY_HOST_CODE;
+// A relay server (relay_server) to host through instead of directly, empty for none.
+extern const Info<std::string> NETPLAY_RELAY_SERVER;
+extern const Info<u16> NETPLAY_RELAY_PORT;
 extern const Info<std::string> NETPLAY_INDEX_URL;
 
 extern const Info<u16> NETPLAY_HOST_PORT;
@@ -41,15 +44,25 @@ extern const Info<u32> NETPLAY_CHUNKED_UPLOAD_LIMIT;
 
 extern const Info<u32> NETPLAY_BUFFER_SIZE;
 extern const Info<u32> NETPLAY_CLIENT_BUFFER_SIZE;
+extern const Info<bool> NETPLAY_AUTO_BUFFER;
+extern const Info<bool> NETPLAY_REDUNDANT_PAD_DATA;
+extern const Info<bool> NETPLAY_STATE_FINGERPRINTS;
+extern const Info<u32> NETPLAY_WIIMOTE_BATCH_SIZE;
+extern const Info<bool> NETPLAY_DELAYED_SPECTATORS;
+extern const Info<u32> NETPLAY_SPECTATOR_DELAY;
+extern const Info<bool> NETPLAY_ALLOW_LATE_JOIN;
 
 extern const Info<bool> NETPLAY_SAVEDATA_LOAD;
 extern const Info<bool> NETPLAY_SAVEDATA_WRITE;
 extern const Info<bool> NETPLAY_SAVEDATA_SYNC_ALL_WII;
 extern const Info<bool> NETPLAY_SYNC_CODES;
+extern const Info<bool> NETPLAY_TRANSFER_GAMES;
+extern const Info<bool> NETPLAY_ACCEPT_GAME_TRANSFERS;
 extern const Info<bool> NETPLAY_RECORD_INPUTS;
 extern const Info<bool> NETPLAY_STRICT_SETTINGS_SYNC;
 extern const Info<std::string> NETPLAY_NETWORK_MODE;
 extern const Info<bool> NETPLAY_GOLF_MODE_OVERLAY;
 extern const Info<bool> NETPLAY_HIDE_REMOTE_GBAS;
+extern const Info<bool> NETPLAY_ROLLBACK;
 
 }  // namespace Config
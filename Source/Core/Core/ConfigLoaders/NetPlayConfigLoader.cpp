@@ -102,6 +102,10 @@ public:
 
     layer->Set(Config::MAIN_BLUETOOTH_PASSTHROUGH_ENABLED, false);
 
+    // The values deferred readbacks return depend on how far the GPU is behind.
+    layer->Set(Config::GFX_HACK_BBOX_DEFERRED_READBACK, false);
+    layer->Set(Config::GFX_PERF_QUERIES_EXACT, true);
+
     if (m_settings.strict_settings_sync)
     {
       layer->Set(Config::GFX_HACK_VERTEX_ROUNDING, m_settings.vertex_rounding);
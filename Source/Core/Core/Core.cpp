@@ -90,6 +90,7 @@
 #include "VideoCommon/FrameDumper.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/PerformanceMetrics.h"
+#include "VideoCommon/Present.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoEvents.h"
 
@@ -329,6 +330,7 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
     Common::SetCurrentThreadName("CPU thread");
   else
     Common::SetCurrentThreadName("CPU-GPU thread");
+  Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
 
   // This needs to be delayed until after the video backend is ready.
   DolphinAnalytics::Instance().ReportGameStart();
@@ -352,6 +354,10 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
       File::Delete(*savestate_path);
   }
 
+  // A player joining a running NetPlay game starts from the state the host sent.
+  if (NetPlay::IsNetPlayRunning())
+    NetPlay::NetPlayClient::LoadJoinState(system);
+
   {
     std::unique_lock core_lock(s_core_mutex);
 
@@ -473,6 +479,7 @@ static void FifoPlayerThread(Core::System& system, const std::optional<std::stri
     // Spawn the GPU thread.
     std::thread gpu_thread{[&] {
       Common::SetCurrentThreadName("Video thread");
+      Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
 
       const bool is_init = init_video();
       init_from_thread.set_value(is_init);
@@ -527,6 +534,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   }};
 
   Common::SetCurrentThreadName("Emuthread - Starting");
+  const TimePoint boot_start = Clock::now();
 
   // This will become the CPU thread.
   DeclareAsCPUThread();
@@ -601,22 +609,29 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     system.GetPowerPC().GetDebugInterface().Clear(guard);
   }};
 
+  if (cpu_info.HTT)
+    Config::SetBaseOrCurrent(Config::MAIN_DSP_THREAD, cpu_info.num_cores > 4);
+  else
+    Config::SetBaseOrCurrent(Config::MAIN_DSP_THREAD, cpu_info.num_cores > 2);
+
+  // The DSP doesn't depend on the video backend, so its ROMs are loaded (and its JIT is set up)
+  // while the video backend is created and loads the shader cache.
+  std::future<bool> dsp_init = std::async(std::launch::async, [&system] {
+    return system.GetDSP().GetDSPEmulator()->Initialize(system.IsWii(),
+                                                        Config::Get(Config::MAIN_DSP_THREAD));
+  });
+
   // In single-core mode: This holds a video backend shutdown function.
   // In dual-core mode: This holds a GPU thread stopping function (which does the backend shutdown).
   const auto video_guard = GetInitializedVideoGuard(system, wsi);
+  const bool dsp_initialized = dsp_init.get();
   if (!video_guard)
   {
     PanicAlertFmt("Failed to initialize video backend!");
     return;
   }
 
-  if (cpu_info.HTT)
-    Config::SetBaseOrCurrent(Config::MAIN_DSP_THREAD, cpu_info.num_cores > 4);
-  else
-    Config::SetBaseOrCurrent(Config::MAIN_DSP_THREAD, cpu_info.num_cores > 2);
-
-  if (!system.GetDSP().GetDSPEmulator()->Initialize(system.IsWii(),
-                                                    Config::Get(Config::MAIN_DSP_THREAD)))
+  if (!dsp_initialized)
   {
     PanicAlertFmt("Failed to initialize DSP emulation!");
     return;
@@ -675,6 +690,10 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
 
   UpdateTitle(system);
 
+  const DT boot_time = Clock::now() - boot_start;
+  g_perf_metrics.SetBootTime(boot_time);
+  INFO_LOG_FMT(BOOT, "Booted in {:.0f} ms", DT_ms(boot_time).count());
+
   // Become the CPU thread.
   cpu_thread_func(system, savestate_path, delete_savestate);
 }
@@ -893,6 +912,8 @@ void Callback_FramePresented(const PresentInfo& present_info)
 // Called from VideoInterface::Update (CPU thread) at emulated field boundaries
 void Callback_NewField(Core::System& system)
 {
+  VideoCommon::LatchPresentationSuppressed();
+
   if (s_frame_step)
   {
     // To ensure that s_stop_frame_step is up to date, wait for the GPU thread queue to empty,
@@ -4,17 +4,17 @@
 #include "Core/CoreTiming.h"
 
 #include <algorithm>
-#include <mutex>
+#include <array>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include <fmt/format.h>
+#include <xxhash.h>
 
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/Logging/Log.h"
-#include "Common/SPSCQueue.h"
 #include "Common/ScopeGuard.h"
 
 #include "Core/AchievementManager.h"
@@ -22,6 +22,7 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/HW/SystemTimers.h"
+#include "Core/HW/VideoInterface.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
@@ -40,6 +41,76 @@ static void EmptyTimedCallback(Core::System& system, u64 userdata, s64 cyclesLat
 {
 }
 
+// The event queue is a 4-ary min-heap. It's half as deep as a binary heap, so an event that is
+// pushed or popped moves through half as many levels, and the children compared at each level
+// sit next to each other in memory. Events are totally ordered, so the order they are popped in
+// doesn't depend on the layout of the heap.
+static constexpr size_t EVENT_HEAP_ARITY = 4;
+
+static void SiftEventUp(std::vector<Event>& heap, size_t index)
+{
+  Event ev = std::move(heap[index]);
+  while (index != 0)
+  {
+    const size_t parent = (index - 1) / EVENT_HEAP_ARITY;
+    if (!(ev < heap[parent]))
+      break;
+    heap[index] = std::move(heap[parent]);
+    index = parent;
+  }
+  heap[index] = std::move(ev);
+}
+
+static void SiftEventDown(std::vector<Event>& heap, size_t index)
+{
+  const size_t size = heap.size();
+  Event ev = std::move(heap[index]);
+  while (true)
+  {
+    const size_t first_child = index * EVENT_HEAP_ARITY + 1;
+    if (first_child >= size)
+      break;
+
+    const size_t last_child = std::min(first_child + EVENT_HEAP_ARITY, size);
+    size_t min_child = first_child;
+    for (size_t child = first_child + 1; child < last_child; ++child)
+    {
+      if (heap[child] < heap[min_child])
+        min_child = child;
+    }
+
+    if (!(heap[min_child] < ev))
+      break;
+    heap[index] = std::move(heap[min_child]);
+    index = min_child;
+  }
+  heap[index] = std::move(ev);
+}
+
+static void PushEvent(std::vector<Event>& heap, Event ev)
+{
+  heap.push_back(std::move(ev));
+  SiftEventUp(heap, heap.size() - 1);
+}
+
+static Event PopEvent(std::vector<Event>& heap)
+{
+  Event ev = std::move(heap.front());
+  heap.front() = std::move(heap.back());
+  heap.pop_back();
+  if (!heap.empty())
+    SiftEventDown(heap, 0);
+  return ev;
+}
+
+static void MakeEventHeap(std::vector<Event>& heap)
+{
+  if (heap.size() < 2)
+    return;
+  for (size_t index = (heap.size() - 2) / EVENT_HEAP_ARITY + 1; index-- != 0;)
+    SiftEventDown(heap, index);
+}
+
 CoreTimingManager::CoreTimingManager(Core::System& system) : m_system(system)
 {
 }
@@ -97,6 +168,11 @@ void CoreTimingManager::Init()
 
   // Reset data used by the throttling system
   ResetThrottle(0);
+  {
+    std::lock_guard lk(m_host_pacing_lock);
+    m_host_paced_fields = 0;
+    m_host_paced_cycle = 0;
+  }
 
   m_event_fifo_id = 0;
   m_ev_lost = RegisterEvent("_lost_event", &EmptyTimedCallback);
@@ -126,7 +202,6 @@ void CoreTimingManager::Shutdown()
 {
   m_core_state_changed_hook.reset();
 
-  std::lock_guard lk(m_ts_write_lock);
   MoveEvents();
   ClearPendingEvents();
   UnregisterAllEvents();
@@ -171,7 +246,6 @@ void CoreTimingManager::RefreshConfig()
 
 void CoreTimingManager::DoState(PointerWrap& p)
 {
-  std::lock_guard lk(m_ts_write_lock);
   p.Do(m_globals.slice_length);
   p.Do(m_globals.global_timer);
   p.Do(m_idled_cycles);
@@ -224,11 +298,12 @@ void CoreTimingManager::DoState(PointerWrap& p)
     // When loading from a save state, we must assume the Event order is random and meaningless.
     // The exact layout of the heap in memory is implementation defined, therefore it is platform
     // and library version specific.
-    std::ranges::make_heap(m_event_queue, std::ranges::greater{});
+    MakeEventHeap(m_event_queue);
 
     // The stave state has changed the time, so our previous Throttle targets are invalid.
     // Especially when global_time goes down; So we create a fake throttle update.
     ResetThrottle(m_globals.global_timer);
+    m_host_paced_cycle = m_globals.global_timer;
   }
 }
 
@@ -281,8 +356,7 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
     if (!m_is_global_timer_sane)
       ForceExceptionCheck(cycles_into_future);
 
-    m_event_queue.emplace_back(Event{timeout, m_event_fifo_id++, userdata, event_type});
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
+    PushEvent(m_event_queue, Event{timeout, m_event_fifo_id++, userdata, event_type});
   }
   else
   {
@@ -294,7 +368,6 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
                     *event_type->name);
     }
 
-    std::lock_guard lk(m_ts_write_lock);
     m_ts_queue.Push(Event{cycles_into_future, 0, userdata, event_type});
   }
 }
@@ -307,7 +380,7 @@ void CoreTimingManager::RemoveEvent(EventType* event_type)
   // Removing random items breaks the invariant so we have to re-establish it.
   if (erased != 0)
   {
-    std::ranges::make_heap(m_event_queue, std::ranges::greater{});
+    MakeEventHeap(m_event_queue);
   }
 }
 
@@ -332,16 +405,14 @@ void CoreTimingManager::ForceExceptionCheck(s64 cycles)
 
 void CoreTimingManager::MoveEvents()
 {
-  while (!m_ts_queue.Empty())
-  {
-    auto& ev = m_event_queue.emplace_back(m_ts_queue.Front());
-    m_ts_queue.Pop();
+  if (m_ts_queue.Empty())
+    return;
 
+  m_ts_queue.PopAll([this](Event&& ev) {
     ev.fifo_order = m_event_fifo_id++;
     ev.time += m_globals.global_timer;
-
-    std::ranges::push_heap(m_event_queue, std::ranges::greater{});
-  }
+    PushEvent(m_event_queue, std::move(ev));
+  });
 }
 
 void CoreTimingManager::Advance()
@@ -363,9 +434,7 @@ void CoreTimingManager::Advance()
 
   while (!m_event_queue.empty() && m_event_queue.front().time <= m_globals.global_timer)
   {
-    Event evt = std::move(m_event_queue.front());
-    std::ranges::pop_heap(m_event_queue, std::ranges::greater{});
-    m_event_queue.pop_back();
+    const Event evt = PopEvent(m_event_queue);
     evt.type->callback(m_system, evt.userdata, m_globals.global_timer - evt.time);
   }
 
@@ -435,6 +504,18 @@ void CoreTimingManager::SleepUntil(TimePoint time_point)
 
 void CoreTimingManager::Throttle(const s64 target_cycle)
 {
+  if (m_host_pacing.load(std::memory_order_relaxed))
+  {
+    WaitForHostPacing(target_cycle);
+
+    // Don't catch up on the time spent waiting if the host stops pacing.
+    ResetThrottle(target_cycle);
+    m_throttle_disable_vi_int = false;
+    g_perf_metrics.CountPerformanceMarker(target_cycle,
+                                          m_system.GetSystemTimers().GetTicksPerSecond());
+    return;
+  }
+
   const TimePoint time = Clock::now();
 
   const bool already_throttled =
@@ -494,6 +575,74 @@ void CoreTimingManager::Throttle(const s64 target_cycle)
   SleepUntil(target_time);
 }
 
+void CoreTimingManager::SetHostPacing(bool enabled)
+{
+  std::lock_guard lk(m_host_pacing_lock);
+  m_host_pacing.store(enabled, std::memory_order_relaxed);
+  m_host_paced_fields = 0;
+  m_host_pacing_cvar.notify_one();
+  m_host_pacing_idle_cvar.notify_all();
+}
+
+void CoreTimingManager::AllowHostPacedField()
+{
+  std::lock_guard lk(m_host_pacing_lock);
+  // If the CPU thread falls behind, it only catches up on one field, like the throttle does
+  // within its fallback.
+  m_host_paced_fields = std::min(m_host_paced_fields + 1, 2u);
+  m_host_pacing_cvar.notify_one();
+}
+
+bool CoreTimingManager::RunHostPacedField(DT timeout)
+{
+  std::unique_lock lk(m_host_pacing_lock);
+  if (!m_host_pacing.load(std::memory_order_relaxed))
+    return false;
+
+  m_host_paced_fields = std::min(m_host_paced_fields + 1, 2u);
+  m_host_pacing_waiting = false;
+  m_host_pacing_cvar.notify_one();
+
+  return m_host_pacing_idle_cvar.wait_for(lk, timeout, [this] {
+    return (m_host_pacing_waiting && m_host_paced_fields == 0) ||
+           !m_host_pacing.load(std::memory_order_relaxed);
+  });
+}
+
+void CoreTimingManager::InterruptHostPacing()
+{
+  std::lock_guard lk(m_host_pacing_lock);
+  m_host_pacing_interrupted = true;
+  m_host_pacing_cvar.notify_one();
+}
+
+void CoreTimingManager::WaitForHostPacing(s64 target_cycle)
+{
+  const s64 ticks_per_field = m_system.GetVideoInterface().GetTicksPerField();
+
+  std::unique_lock lk(m_host_pacing_lock);
+  while (target_cycle > m_host_paced_cycle && !m_host_pacing_interrupted &&
+         m_host_pacing.load(std::memory_order_relaxed))
+  {
+    if (m_host_paced_fields == 0)
+    {
+      m_host_pacing_waiting = true;
+      m_host_pacing_idle_cvar.notify_all();
+      m_host_pacing_cvar.wait(lk);
+      m_host_pacing_waiting = false;
+      continue;
+    }
+
+    // The CPU thread normally waits at the first Throttle past the cycle it may emulate up to, but
+    // it's further behind right after pacing was turned on.
+    --m_host_paced_fields;
+    if (target_cycle - m_host_paced_cycle > ticks_per_field)
+      m_host_paced_cycle = target_cycle;
+    m_host_paced_cycle += ticks_per_field;
+  }
+  m_host_pacing_interrupted = false;
+}
+
 void CoreTimingManager::UpdateSpeedLimit(s64 cycle, double new_speed)
 {
   m_emulation_speed = new_speed;
@@ -531,7 +680,8 @@ void CoreTimingManager::UpdateVISkip(TimePoint current_time, TimePoint target_ti
 
 bool CoreTimingManager::GetVISkip() const
 {
-  return m_throttle_disable_vi_int && g_ActiveConfig.bVISkip && !Core::WantsDeterminism();
+  return m_throttle_disable_vi_int.load(std::memory_order_relaxed) && g_ActiveConfig.bVISkip &&
+         !Core::WantsDeterminism();
 }
 
 float CoreTimingManager::GetOverclock() const
@@ -601,6 +751,20 @@ std::string CoreTimingManager::GetScheduledEventsSummary() const
   return text;
 }
 
+u64 CoreTimingManager::GetEventQueueHash() const
+{
+  // The heap layout doesn't matter, so this adds up the hashes of the events.
+  u64 hash = XXH3_64bits_withSeed(&m_globals.global_timer, sizeof(m_globals.global_timer), 0);
+  for (const Event& ev : m_event_queue)
+  {
+    const std::string& name = *ev.type->name;
+    const std::array<u64, 3> values{static_cast<u64>(ev.time), ev.userdata,
+                                    XXH3_64bits(name.data(), name.size())};
+    hash += XXH3_64bits(values.data(), sizeof(values));
+  }
+  return hash;
+}
+
 u32 CoreTimingManager::GetFakeDecStartValue() const
 {
   return m_fake_dec_start_value;
@@ -16,6 +16,8 @@
 // inside callback:
 //   ScheduleEvent(periodInCycles - cyclesLate, callback, "whatever")
 
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <string>
 #include <tuple>
@@ -24,7 +26,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/HookableEvent.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPSCQueue.h"
 #include "Common/Timer.h"
 #include "Core/CPUThreadConfigCallback.h"
 
@@ -140,6 +142,8 @@ public:
   void LogPendingEvents() const;
 
   std::string GetScheduledEventsSummary() const;
+  // Changes whenever the scheduled events do, see NetPlay::StateFingerprint.
+  u64 GetEventQueueHash() const;
 
   void AdjustEventQueueTimes(u32 new_ppc_clock, u32 old_ppc_clock);
 
@@ -160,10 +164,23 @@ public:
   // Throttle the CPU to the specified target cycle.
   void Throttle(const s64 target_cycle);
 
+  // Lets a host that paces the emulation itself, like a libretro frontend that calls retro_run
+  // once per frame, take over from the throttle so that the two clocks don't fight. While enabled,
+  // Throttle doesn't wait for the host time of the target cycle, but for the host to allow
+  // emulating another field with AllowHostPacedField. Safe from any thread.
+  void SetHostPacing(bool enabled);
+  void AllowHostPacedField();
+  // Like AllowHostPacedField, but also waits until the CPU thread emulated the field and waits for
+  // the next one. Returns false if that didn't happen within the timeout, for example because the
+  // CPU thread was paused.
+  bool RunHostPacedField(DT timeout);
+  // Makes Throttle stop waiting for the host, so that the CPU thread can be paused.
+  void InterruptHostPacing();
+
   // May be used from CPU or GPU thread.
   void SleepUntil(TimePoint time_point);
 
-  // Used by VideoInterface
+  // Used by VideoInterface, and by the Presenter on the GPU thread to drop XFB copies.
   bool GetVISkip() const;
 
   float GetOverclock() const;
@@ -180,17 +197,16 @@ private:
   std::unordered_map<std::string, EventType> m_event_types;
 
   // STATE_TO_SAVE
-  // The queue is a min-heap using std::ranges::make_heap/push_heap/pop_heap.
+  // The queue is a 4-ary min-heap, see PushEvent/PopEvent/MakeEventHeap in CoreTiming.cpp.
   // We don't use std::priority_queue because we need to be able to serialize, unserialize and
   // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't accommodated
   // by the standard adaptor class.
   std::vector<Event> m_event_queue;
   u64 m_event_fifo_id = 0;
-  std::mutex m_ts_write_lock;
 
   // Event objects created from other threads.
   // The time value of each Event here is a cycles_into_future value.
-  Common::SPSCQueue<Event> m_ts_queue;
+  Common::MPSCQueue<Event> m_ts_queue;
 
   float m_last_oc_factor = 0.0f;
 
@@ -212,7 +228,7 @@ private:
   s64 m_throttle_reference_cycle = 0;
   TimePoint m_throttle_reference_time = Clock::now();
   u32 m_throttle_adj_clock_per_sec = 0;
-  bool m_throttle_disable_vi_int = false;
+  std::atomic<bool> m_throttle_disable_vi_int = false;
 
   DT m_max_fallback = {};
   DT m_max_variance = {};
@@ -224,6 +240,7 @@ private:
   void ResetThrottle(s64 cycle);
   TimePoint CalculateTargetHostTimeInternal(s64 target_cycle);
   void UpdateVISkip(TimePoint current_time, TimePoint target_time);
+  void WaitForHostPacing(s64 target_cycle);
 
   int DowncountToCycles(int downcount) const;
   int CyclesToDowncount(int cycles) const;
@@ -235,6 +252,18 @@ private:
   Common::EventHook m_core_state_changed_hook;
   Common::EventHook m_frame_hook;
 
+  std::mutex m_host_pacing_lock;
+  std::condition_variable m_host_pacing_cvar;
+  std::condition_variable m_host_pacing_idle_cvar;
+  std::atomic_bool m_host_pacing = false;
+  bool m_host_pacing_interrupted = false;
+  // Whether the CPU thread waits for the host to allow another field.
+  bool m_host_pacing_waiting = false;
+  // How many fields the host allowed that the CPU thread hasn't started yet.
+  u32 m_host_paced_fields = 0;
+  // The cycle the CPU thread may emulate up to without waiting. Only used on the CPU thread.
+  s64 m_host_paced_cycle = 0;
+
   // Used to optionally minimize throttling for improving input latency.
   std::atomic_bool m_throttled_after_presentation = false;
   DT m_max_throttle_skip_time{};
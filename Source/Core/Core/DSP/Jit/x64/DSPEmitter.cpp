@@ -6,6 +6,9 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <utility>
+
+#include <xxhash.h>
 
 #include "Common/Assert.h"
 #include "Common/BitSet.h"
@@ -25,7 +28,9 @@ using namespace Gen;
 
 namespace DSP::JIT::x64
 {
-constexpr size_t COMPILED_CODE_SIZE = 2097152;
+// Room for the blocks of several ucodes. Loading one when less than a quarter of this is left
+// throws away everything that was compiled.
+constexpr size_t COMPILED_CODE_SIZE = 8388608;
 constexpr size_t MAX_BLOCK_SIZE = 250;
 constexpr u16 DSP_IDLE_SKIP_CYCLES = 0x1000;
 
@@ -73,14 +78,27 @@ void DSPEmitter::DoState(PointerWrap& p)
 
 void DSPEmitter::ClearIRAM()
 {
-  for (size_t i = 0; i < DSP_IRAM_SIZE; i++)
+  // The blocks only depend on IRAM (and IROM, which doesn't change), so reloading the same ucode
+  // doesn't invalidate them.
+  const u64 iram_hash = XXH3_64bits(m_dsp_core.DSPState().iram, DSP_IRAM_BYTE_SIZE);
+  if (iram_hash == m_iram_hash)
+    return;
+
+  // IROM blocks can link to IRAM blocks, so every block is swapped out along with the ucode.
+  if (m_iram_hash)
+    SaveBlocks(*m_iram_hash);
+  m_iram_hash = iram_hash;
+  ResetBlocks();
+
+  // This may be running from a block, so the code space itself is only reset in RunCycles.
+  if (GetSpaceLeft() < COMPILED_CODE_SIZE / 4)
   {
-    m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
-    m_block_links[i] = nullptr;
-    m_block_size[i] = 0;
-    m_unresolved_jumps[i].clear();
+    m_cached_ucodes.clear();
+    m_dsp_core.DSPState().reset_dspjit_codespace = true;
+    return;
   }
-  m_dsp_core.DSPState().reset_dspjit_codespace = true;
+
+  RestoreBlocks(iram_hash);
 }
 
 void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
@@ -89,6 +107,13 @@ void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
   CompileDispatcher();
   m_stub_entry_point = CompileStub();
 
+  m_cached_ucodes.clear();
+  ResetBlocks();
+  m_dsp_core.DSPState().reset_dspjit_codespace = false;
+}
+
+void DSPEmitter::ResetBlocks()
+{
   for (size_t i = 0; i < MAX_BLOCKS; i++)
   {
     m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
@@ -96,7 +121,42 @@ void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
     m_block_size[i] = 0;
     m_unresolved_jumps[i].clear();
   }
-  m_dsp_core.DSPState().reset_dspjit_codespace = false;
+}
+
+void DSPEmitter::SaveBlocks(u64 iram_hash)
+{
+  // Which one goes doesn't matter much, games rarely switch between this many ucodes.
+  if (m_cached_ucodes.size() >= MAX_CACHED_UCODES && !m_cached_ucodes.contains(iram_hash))
+    m_cached_ucodes.erase(m_cached_ucodes.begin());
+
+  std::vector<CachedBlock>& blocks = m_cached_ucodes[iram_hash];
+  blocks.clear();
+  for (size_t i = 0; i < MAX_BLOCKS; i++)
+  {
+    if (m_blocks[i] == (DSPCompiledCode)m_stub_entry_point && m_unresolved_jumps[i].empty())
+      continue;
+
+    blocks.push_back(CachedBlock{static_cast<u16>(i), m_blocks[i], m_block_size[i],
+                                 m_block_links[i], std::move(m_unresolved_jumps[i])});
+  }
+}
+
+void DSPEmitter::RestoreBlocks(u64 iram_hash)
+{
+  const auto it = m_cached_ucodes.find(iram_hash);
+  if (it == m_cached_ucodes.end())
+    return;
+
+  for (CachedBlock& block : it->second)
+  {
+    m_blocks[block.address] = block.code;
+    m_block_size[block.address] = block.size;
+    m_block_links[block.address] = block.link;
+    m_unresolved_jumps[block.address] = std::move(block.unresolved_jumps);
+  }
+  m_cached_ucodes.erase(it);
+
+  NOTICE_LOG_FMT(DSPLLE, "Reusing the blocks compiled for ucode {:016x}", iram_hash);
 }
 
 static u32 CheckExceptionsThunk(DSPCore& dsp)
@@ -6,6 +6,8 @@
 #include <array>
 #include <cstddef>
 #include <list>
+#include <map>
+#include <optional>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -202,6 +204,9 @@ private:
 
   void EmitInstruction(UDSPInstruction inst);
   void ClearIRAMandDSPJITCodespaceReset();
+  void ResetBlocks();
+  void SaveBlocks(u64 iram_hash);
+  void RestoreBlocks(u64 iram_hash);
 
   void CompileDispatcher();
   Block CompileStub();
@@ -323,6 +328,21 @@ private:
 
   std::array<std::list<u16>, MAX_BLOCKS> m_unresolved_jumps;
 
+  // The blocks compiled for the other ucodes loaded this session, by hash of the IRAM they were
+  // compiled from, so that switching back to one doesn't compile them again. Only the entries that
+  // differ from an empty block table are kept.
+  struct CachedBlock
+  {
+    u16 address;
+    DSPCompiledCode code;
+    u16 size;
+    Block link;
+    std::list<u16> unresolved_jumps;
+  };
+  static constexpr size_t MAX_CACHED_UCODES = 8;
+  std::map<u64, std::vector<CachedBlock>> m_cached_ucodes;
+  std::optional<u64> m_iram_hash;
+
   u16 m_cycles_left = 0;
 
   // The index of the last stored ext value (compile time).
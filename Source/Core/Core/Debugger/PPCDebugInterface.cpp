@@ -524,13 +524,19 @@ std::shared_ptr<Core::NetworkCaptureLogger> PPCDebugInterface::NetworkLogger()
     return Core::NetworkCaptureType::None;
   }();
 
-  if (m_network_logger && m_network_logger->GetCaptureType() == current_capture_type)
+  const int ring_buffer_mib = is_pcap ? Config::Get(Config::MAIN_NETWORK_DUMP_RING_BUFFER_SIZE) : 0;
+  const std::size_t ring_buffer_size = static_cast<std::size_t>(std::max(ring_buffer_mib, 0)) << 20;
+
+  if (m_network_logger && m_network_logger->GetCaptureType() == current_capture_type &&
+      m_network_logger->GetRingBufferSize() == ring_buffer_size)
+  {
     return m_network_logger;
+  }
 
   switch (current_capture_type)
   {
   case Core::NetworkCaptureType::PCAP:
-    m_network_logger = std::make_shared<Core::PCAPSSLCaptureLogger>();
+    m_network_logger = std::make_shared<Core::PCAPSSLCaptureLogger>(ring_buffer_size);
     break;
   case Core::NetworkCaptureType::Raw:
     m_network_logger = std::make_shared<Core::BinarySSLCaptureLogger>();
@@ -6,9 +6,12 @@
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include <zstd.h>
+
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
@@ -16,11 +19,13 @@
 #include "Core/System.h"
 
 constexpr u32 FILE_ID = 0x0d01f1f0;
-constexpr u32 VERSION_NUMBER = 5;
+constexpr u32 VERSION_NUMBER = 6;
 constexpr u32 MIN_LOADER_VERSION = 1;
 // This value is only used if the DFF file was created with overridden RAM sizes.
 // If the MIN_LOADER_VERSION ever exceeds this, it's alright to remove it.
 constexpr u32 MIN_LOADER_VERSION_FOR_RAM_OVERRIDE = 5;
+// Likewise, this is only used for compressed DFF files.
+constexpr u32 MIN_LOADER_VERSION_FOR_COMPRESSION = 6;
 
 #pragma pack(push, 1)
 
@@ -58,7 +63,10 @@ struct FileFrameInfo
   u32 fifoEnd;
   u64 memoryUpdatesOffset;
   u32 numMemoryUpdates;
-  u8 reserved[32];
+  // In compressed files, fifoDataOffset points to a zstd frame of this size. It contains the FIFO
+  // data followed by the data of the memory updates, whose dataOffset is relative to that block.
+  u32 compressedSize;
+  u8 reserved[28];
 };
 static_assert(sizeof(FileFrameInfo) == 64, "FileFrameInfo should be 64 bytes");
 
@@ -104,7 +112,7 @@ void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
   m_Frames.push_back(frameInfo);
 }
 
-bool FifoDataFile::Save(const std::string& filename)
+bool FifoDataFile::Save(const std::string& filename, bool compress)
 {
   File::IOFile file;
   if (!file.Open(filename, "wb"))
@@ -141,6 +149,8 @@ bool FifoDataFile::Save(const std::string& filename)
     header.min_loader_version = MIN_LOADER_VERSION_FOR_RAM_OVERRIDE;
   else
     header.min_loader_version = MIN_LOADER_VERSION;
+  if (compress)
+    header.min_loader_version = MIN_LOADER_VERSION_FOR_COMPRESSION;
 
   header.bpMemOffset = bpMemOffset;
   header.bpMemSize = BP_MEM_SIZE;
@@ -160,6 +170,7 @@ bool FifoDataFile::Save(const std::string& filename)
   header.frameListOffset = frameListOffset;
   header.frameCount = (u32)m_Frames.size();
 
+  SetFlag(FLAG_COMPRESSED, compress);
   header.flags = m_Flags;
 
   auto& system = Core::System::GetInstance();
@@ -178,17 +189,39 @@ bool FifoDataFile::Save(const std::string& filename)
     // Write FIFO data
     file.Seek(0, File::SeekOrigin::End);
     u64 dataOffset = file.Tell();
-    file.WriteBytes(srcFrame.fifoData.data(), srcFrame.fifoData.size());
-
-    u64 memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file);
-
-    FileFrameInfo dstFrame;
+    u64 memoryUpdatesOffset;
+    u32 compressedSize = 0;
+    if (compress)
+    {
+      std::vector<u8> block = srcFrame.fifoData;
+      for (const MemoryUpdate& update : srcFrame.memoryUpdates)
+        block.insert(block.end(), update.data.begin(), update.data.end());
+
+      std::vector<u8> compressed(ZSTD_compressBound(block.size()));
+      const size_t result = ZSTD_compress(compressed.data(), compressed.size(), block.data(),
+                                          block.size(), ZSTD_CLEVEL_DEFAULT);
+      if (ZSTD_isError(result))
+        return false;
+      compressedSize = static_cast<u32>(result);
+      file.WriteBytes(compressed.data(), compressedSize);
+
+      memoryUpdatesOffset =
+          WriteMemoryUpdates(srcFrame.memoryUpdates, file, srcFrame.fifoData.size());
+    }
+    else
+    {
+      file.WriteBytes(srcFrame.fifoData.data(), srcFrame.fifoData.size());
+      memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file, std::nullopt);
+    }
+
+    FileFrameInfo dstFrame{};
     dstFrame.fifoDataSize = static_cast<u32>(srcFrame.fifoData.size());
     dstFrame.fifoDataOffset = dataOffset;
     dstFrame.fifoStart = srcFrame.fifoStart;
     dstFrame.fifoEnd = srcFrame.fifoEnd;
     dstFrame.memoryUpdatesOffset = memoryUpdatesOffset;
     dstFrame.numMemoryUpdates = static_cast<u32>(srcFrame.memoryUpdates.size());
+    dstFrame.compressedSize = compressedSize;
 
     // Write frame info
     u64 frameOffset = frameListOffset + (i * sizeof(FileFrameInfo));
@@ -331,10 +364,39 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
     dstFrame.fifoEnd = srcFrame.fifoEnd;
 
     file.Seek(srcFrame.fifoDataOffset, File::SeekOrigin::Begin);
-    file.ReadBytes(dstFrame.fifoData.data(), srcFrame.fifoDataSize);
-
-    ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
-                      dstFrame.memoryUpdates, file);
+    if (dataFile->GetFlag(FLAG_COMPRESSED))
+    {
+      std::vector<u8> compressed(srcFrame.compressedSize);
+      if (!file.ReadBytes(compressed.data(), compressed.size()))
+        return panic_failed_to_read();
+
+      const unsigned long long block_size =
+          ZSTD_getFrameContentSize(compressed.data(), compressed.size());
+      if (block_size == ZSTD_CONTENTSIZE_UNKNOWN || block_size == ZSTD_CONTENTSIZE_ERROR ||
+          block_size < srcFrame.fifoDataSize)
+      {
+        return panic_failed_to_read();
+      }
+
+      std::vector<u8> block(block_size);
+      const size_t result =
+          ZSTD_decompress(block.data(), block.size(), compressed.data(), compressed.size());
+      if (ZSTD_isError(result) || result != block.size())
+        return panic_failed_to_read();
+
+      std::copy_n(block.begin(), srcFrame.fifoDataSize, dstFrame.fifoData.begin());
+      if (!ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
+                             dstFrame.memoryUpdates, file, &block))
+      {
+        return panic_failed_to_read();
+      }
+    }
+    else
+    {
+      file.ReadBytes(dstFrame.fifoData.data(), srcFrame.fifoDataSize);
+      ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
+                        dstFrame.memoryUpdates, file, nullptr);
+    }
 
     if (!file.IsGood())
       return panic_failed_to_read();
@@ -365,7 +427,7 @@ bool FifoDataFile::GetFlag(u32 flag) const
 }
 
 u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates,
-                                     File::IOFile& file)
+                                     File::IOFile& file, std::optional<u64> block_offset)
 {
   // Add space for memory update list
   u64 updateListOffset = file.Tell();
@@ -376,9 +438,18 @@ u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates
     const MemoryUpdate& srcUpdate = memUpdates[i];
 
     // Write memory
-    file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
+    u64 dataOffset;
+    if (block_offset)
+    {
+      dataOffset = *block_offset;
+      *block_offset += srcUpdate.data.size();
+    }
+    else
+    {
+      file.Seek(0, File::SeekOrigin::End);
+      dataOffset = file.Tell();
+      file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
+    }
 
     FileMemoryUpdate dstUpdate;
     dstUpdate.address = srcUpdate.address;
@@ -395,8 +466,9 @@ u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates
   return updateListOffset;
 }
 
-void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
-                                     std::vector<MemoryUpdate>& memUpdates, File::IOFile& file)
+bool FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
+                                     std::vector<MemoryUpdate>& memUpdates, File::IOFile& file,
+                                     const std::vector<u8>* block)
 {
   memUpdates.resize(numUpdates);
 
@@ -413,7 +485,22 @@ void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
     dstUpdate.data.resize(srcUpdate.dataSize);
     dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
 
-    file.Seek(srcUpdate.dataOffset, File::SeekOrigin::Begin);
-    file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize);
+    if (block)
+    {
+      if (srcUpdate.dataOffset > block->size() ||
+          srcUpdate.dataSize > block->size() - srcUpdate.dataOffset)
+      {
+        return false;
+      }
+      std::copy_n(block->begin() + srcUpdate.dataOffset, srcUpdate.dataSize,
+                  dstUpdate.data.begin());
+    }
+    else
+    {
+      file.Seek(srcUpdate.dataOffset, File::SeekOrigin::Begin);
+      file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize);
+    }
   }
+
+  return true;
 }
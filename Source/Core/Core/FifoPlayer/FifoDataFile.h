@@ -5,6 +5,7 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -75,14 +76,16 @@ public:
   void AddFrame(const FifoFrameInfo& frameInfo);
   const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
   u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
-  bool Save(const std::string& filename);
+  // If compress is set, the frames are compressed with zstd, which needs version 6 to be loaded.
+  bool Save(const std::string& filename, bool compress = false);
 
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
 
 private:
   enum
   {
-    FLAG_IS_WII = 1
+    FLAG_IS_WII = 1,
+    FLAG_COMPRESSED = 2,
   };
 
   static void PadFile(size_t numBytes, File::IOFile& file);
@@ -90,9 +93,14 @@ private:
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
-  u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
-  static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
-                                std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
+  // If block_offset is set, the data is part of the frame's compressed block at that offset,
+  // and it isn't written.
+  u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file,
+                         std::optional<u64> block_offset);
+  // If block is set, the data is read from the frame's decompressed block instead of the file.
+  static bool ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
+                                std::vector<MemoryUpdate>& memUpdates, File::IOFile& file,
+                                const std::vector<u8>* block);
 
   std::array<u32, BP_MEM_SIZE> m_BPMem{};
   std::array<u32, CP_MEM_SIZE> m_CPMem{};
@@ -6,10 +6,15 @@
 #include <algorithm>
 #include <cstring>
 #include <mutex>
+#include <string>
 #include <type_traits>
 
+#include <fmt/format.h>
+
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
@@ -227,9 +232,19 @@ public:
 
     m_parent->m_CurrentFrame = m_parent->m_FrameRangeStart;
     m_parent->LoadMemory();
+
+    m_parent->m_benchmark_frames.clear();
+    m_disabled_throttler = m_parent->m_benchmark;
+    if (m_disabled_throttler)
+      Core::SetIsThrottlerTempDisabled(true);
   }
 
-  void Shutdown() override { IsPlayingBackFifologWithBrokenEFBCopies = false; }
+  void Shutdown() override
+  {
+    IsPlayingBackFifologWithBrokenEFBCopies = false;
+    if (m_disabled_throttler)
+      Core::SetIsThrottlerTempDisabled(false);
+  }
   void ClearCache() override
   {
     // Nothing to clear.
@@ -267,12 +282,19 @@ public:
 
 private:
   FifoPlayer* m_parent;
+  bool m_disabled_throttler = false;
 };
 
 CPU::State FifoPlayer::AdvanceFrame()
 {
   if (m_CurrentFrame > m_FrameRangeEnd)
   {
+    if (m_benchmark)
+    {
+      WriteBenchmarkSummary();
+      return CPU::State::PowerDown;
+    }
+
     if (!m_Loop)
       return CPU::State::PowerDown;
 
@@ -291,7 +313,10 @@ CPU::State FifoPlayer::AdvanceFrame()
   if (m_EarlyMemoryUpdates && m_CurrentFrame == m_FrameRangeStart)
     WriteAllMemoryUpdates();
 
-  WriteFrame(m_File->GetFrame(m_CurrentFrame), m_FrameInfo[m_CurrentFrame]);
+  const TimePoint frame_start = Clock::now();
+  const u32 draw_count = WriteFrame(m_File->GetFrame(m_CurrentFrame), m_FrameInfo[m_CurrentFrame]);
+  if (m_benchmark)
+    m_benchmark_frames.push_back({m_CurrentFrame, Clock::now() - frame_start, draw_count});
 
   ++m_CurrentFrame;
   return CPU::State::Running;
@@ -309,6 +334,35 @@ void FifoPlayer::RefreshConfig()
 {
   m_Loop = Config::Get(Config::MAIN_FIFOPLAYER_LOOP_REPLAY);
   m_EarlyMemoryUpdates = Config::Get(Config::MAIN_FIFOPLAYER_EARLY_MEMORY_UPDATES);
+  m_benchmark = Config::Get(Config::MAIN_FIFOPLAYER_BENCHMARK);
+}
+
+void FifoPlayer::WriteBenchmarkSummary() const
+{
+  if (m_benchmark_frames.empty())
+    return;
+
+  std::string summary = "{\n  \"frames\": [\n";
+  DT total_time{};
+  for (const BenchmarkFrame& frame : m_benchmark_frames)
+  {
+    total_time += frame.time;
+    summary += fmt::format("    {{\"frame\": {}, \"time_ms\": {:.3f}, \"draws\": {}}}{}\n",
+                           frame.frame, DT_ms(frame.time).count(), frame.draw_count,
+                           &frame == &m_benchmark_frames.back() ? "" : ",");
+  }
+  const double average_ms = DT_ms(total_time).count() / m_benchmark_frames.size();
+  summary += fmt::format("  ],\n  \"average_time_ms\": {:.3f}\n}}\n", average_ms);
+
+  const std::string path = File::GetUserPath(D_DUMP_IDX) + "FifoBenchmark.json";
+  if (!File::CreateFullPath(path) || !File::WriteStringToFile(path, summary))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to write the FIFO benchmark summary to {}", path);
+    return;
+  }
+
+  NOTICE_LOG_FMT(VIDEO, "FIFO benchmark: {} frames, {:.3f} ms on average, written to {}",
+                 m_benchmark_frames.size(), average_ms, path);
 }
 
 void FifoPlayer::SetFileLoadedCallback(CallbackFunc callback)
@@ -393,7 +447,7 @@ void FifoPlayer::SetFrameRangeEnd(u32 end)
   }
 }
 
-void FifoPlayer::WriteFrame(const FifoFrameInfo& frame, const AnalyzedFrameInfo& info)
+u32 FifoPlayer::WriteFrame(const FifoFrameInfo& frame, const AnalyzedFrameInfo& info)
 {
   // Core timing information
   auto& vi = m_system.GetVideoInterface();
@@ -404,6 +458,7 @@ void FifoPlayer::WriteFrame(const FifoFrameInfo& frame, const AnalyzedFrameInfo&
 
   u32 memory_update = 0;
   u32 object_num = 0;
+  u32 draw_count = 0;
 
   // Skip all memory updates if early memory updates are enabled, as we already wrote them
   if (m_EarlyMemoryUpdates)
@@ -419,6 +474,8 @@ void FifoPlayer::WriteFrame(const FifoFrameInfo& frame, const AnalyzedFrameInfo&
     {
       show_part = m_ObjectRangeStart <= object_num && object_num <= m_ObjectRangeEnd;
       object_num++;
+      if (show_part)
+        draw_count++;
     }
     else
     {
@@ -433,6 +490,7 @@ void FifoPlayer::WriteFrame(const FifoFrameInfo& frame, const AnalyzedFrameInfo&
 
   FlushWGP();
   WaitForGPUInactive();
+  return draw_count;
 }
 
 void FifoPlayer::WriteFramePart(const FramePart& part, u32* next_mem_update,
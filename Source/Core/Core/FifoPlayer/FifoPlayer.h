@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "Common/Assert.h"
+#include "Common/CommonTypes.h"
 #include "Common/Config/Config.h"
 #include "Core/FifoPlayer/FifoDataFile.h"
 #include "Core/PowerPC/CPUCoreBase.h"
@@ -145,7 +146,8 @@ private:
 
   CPU::State AdvanceFrame();
 
-  void WriteFrame(const FifoFrameInfo& frame, const AnalyzedFrameInfo& info);
+  // Returns how many objects were drawn.
+  u32 WriteFrame(const FifoFrameInfo& frame, const AnalyzedFrameInfo& info);
   void WriteFramePart(const FramePart& part, u32* next_mem_update, const FifoFrameInfo& frame);
 
   void WriteAllMemoryUpdates();
@@ -181,11 +183,24 @@ private:
 
   void RefreshConfig();
 
+  void WriteBenchmarkSummary() const;
+
   Core::System& m_system;
 
   bool m_Loop = true;
   // If enabled then all memory updates happen at once before the first frame
   bool m_EarlyMemoryUpdates = false;
+  // If enabled then the frame range is played once unthrottled, and the time every frame took is
+  // written to a summary
+  bool m_benchmark = false;
+
+  struct BenchmarkFrame
+  {
+    u32 frame;
+    DT time;
+    u32 draw_count;
+  };
+  std::vector<BenchmarkFrame> m_benchmark_frames;
 
   u32 m_CurrentFrame = 0;
   u32 m_FrameRangeStart = 0;
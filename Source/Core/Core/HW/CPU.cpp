@@ -16,6 +16,7 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/CoreTiming.h"
 #include "Core/Host.h"
 #include "Core/PowerPC/GDBStub.h"
 #include "Core/PowerPC/PowerPC.h"
@@ -239,6 +240,7 @@ void CPUManager::Stop()
   std::unique_lock state_lock(m_state_change_lock);
   m_state = State::PowerDown;
   m_state_cpu_cvar.notify_one();
+  m_system.GetCoreTiming().InterruptHostPacing();
 
   while (m_state_cpu_thread_active)
   {
@@ -310,6 +312,7 @@ void CPUManager::SetStepping(bool stepping)
 
     if (!Core::IsCPUThread())
     {
+      m_system.GetCoreTiming().InterruptHostPacing();
       while (m_state_cpu_thread_active)
         m_state_cpu_idle_cvar.wait(state_lock);
     }
@@ -359,6 +362,8 @@ bool CPUManager::PauseAndLock()
   const bool was_unpaused = m_state == State::Running;
   SetStateLocked(State::Stepping);
 
+  // The CPU thread may be waiting for the host to allow the next field.
+  m_system.GetCoreTiming().InterruptHostPacing();
   while (m_state_cpu_thread_active)
   {
     m_state_cpu_idle_cvar.wait(state_lock);
@@ -0,0 +1,165 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/ZeldaMixing.h"
+
+#include <algorithm>
+
+#if defined(_M_X86_64)
+#include "Common/Intrinsics.h"
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+namespace DSP::HLE::ZeldaMixing
+{
+namespace Generic
+{
+void ApplyVolumeInPlace(s16* buf, size_t count, u16 vol, u32 fraction_bits)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    s32 tmp = (u32)buf[i] * (u32)vol;
+    tmp >>= fraction_bits;
+
+    buf[i] = (s16)std::clamp(tmp, -0x8000, 0x7FFF);
+  }
+}
+
+s32 AddBuffersWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 vol, s32 step)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    dst[i] += ((vol >> 16) * src[i]) >> 16;
+    vol += step;
+  }
+
+  return vol;
+}
+
+void AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol)
+{
+  while (count--)
+  {
+    s32 vol_src = ((s32)*src++ * (s32)vol) >> 15;
+    *dst++ += std::clamp(vol_src, -0x8000, 0x7FFF);
+  }
+}
+}  // namespace Generic
+
+// The product of an s16 sample and a u16 volume always fits in 32 bits. Shifting it and packing it
+// back into 16 bits with saturation gives the clamped result of the scalar code.
+#if defined(_M_X86_64)
+static __m128i ApplyVolume(__m128i samples, u16 vol, u32 fraction_bits)
+{
+  // _mm_mulhi_epi16 takes the volume as signed, which is off by the sample when its top bit is
+  // set.
+  const __m128i vols = _mm_set1_epi16(static_cast<s16>(vol));
+  const __m128i lo = _mm_mullo_epi16(samples, vols);
+  const __m128i hi = _mm_add_epi16(_mm_mulhi_epi16(samples, vols),
+                                   vol & 0x8000 ? samples : _mm_setzero_si128());
+  const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(fraction_bits));
+  return _mm_packs_epi32(_mm_sra_epi32(_mm_unpacklo_epi16(lo, hi), shift),
+                         _mm_sra_epi32(_mm_unpackhi_epi16(lo, hi), shift));
+}
+#elif defined(_M_ARM_64)
+static int16x8_t ApplyVolume(int16x8_t samples, u16 vol, u32 fraction_bits)
+{
+  const int32x4_t vols = vdupq_n_s32(vol);
+  const int32x4_t shift = vdupq_n_s32(-static_cast<s32>(fraction_bits));
+  const int32x4_t lo = vmulq_s32(vmovl_s16(vget_low_s16(samples)), vols);
+  const int32x4_t hi = vmulq_s32(vmovl_s16(vget_high_s16(samples)), vols);
+  return vcombine_s16(vqmovn_s32(vshlq_s32(lo, shift)), vqmovn_s32(vshlq_s32(hi, shift)));
+}
+#endif
+
+void ApplyVolumeInPlace(s16* buf, size_t count, u16 vol, u32 fraction_bits)
+{
+  size_t i = 0;
+#if defined(_M_X86_64)
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128i* const vec = reinterpret_cast<__m128i*>(buf + i);
+    _mm_storeu_si128(vec, ApplyVolume(_mm_loadu_si128(vec), vol, fraction_bits));
+  }
+#elif defined(_M_ARM_64)
+  for (; i + 8 <= count; i += 8)
+    vst1q_s16(buf + i, ApplyVolume(vld1q_s16(buf + i), vol, fraction_bits));
+#endif
+
+  Generic::ApplyVolumeInPlace(buf + i, count - i, vol, fraction_bits);
+}
+
+s32 AddBuffersWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 vol, s32 step)
+{
+  // The volume of each sample is in its own 32-bit lane. Its top half always fits in 16 bits, and
+  // the top half of its product with the sample is what gets added.
+  size_t i = 0;
+#if defined(_M_X86_64)
+  if (count >= 8)
+  {
+    const auto lane_volume = [&](u32 lane) { return static_cast<s32>(vol + u32(step) * lane); };
+    __m128i vols_lo = _mm_setr_epi32(lane_volume(0), lane_volume(1), lane_volume(2),
+                                     lane_volume(3));
+    __m128i vols_hi = _mm_setr_epi32(lane_volume(4), lane_volume(5), lane_volume(6),
+                                     lane_volume(7));
+    const __m128i vols_step = _mm_set1_epi32(static_cast<s32>(u32(step) * 8));
+    for (; i + 8 <= count; i += 8)
+    {
+      const __m128i vols =
+          _mm_packs_epi32(_mm_srai_epi32(vols_lo, 16), _mm_srai_epi32(vols_hi, 16));
+      const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+
+      __m128i* const out = reinterpret_cast<__m128i*>(dst + i);
+      _mm_storeu_si128(out, _mm_add_epi16(_mm_loadu_si128(out), _mm_mulhi_epi16(vols, samples)));
+
+      vols_lo = _mm_add_epi32(vols_lo, vols_step);
+      vols_hi = _mm_add_epi32(vols_hi, vols_step);
+    }
+    vol = static_cast<s32>(vol + u32(step) * u32(i));
+  }
+#elif defined(_M_ARM_64)
+  if (count >= 8)
+  {
+    static constexpr u32 lanes[4] = {0, 1, 2, 3};
+    uint32x4_t vols_lo = vmlaq_n_u32(vdupq_n_u32(u32(vol)), vld1q_u32(lanes), u32(step));
+    uint32x4_t vols_hi = vaddq_u32(vols_lo, vdupq_n_u32(u32(step) * 4));
+    const uint32x4_t vols_step = vdupq_n_u32(u32(step) * 8);
+    for (; i + 8 <= count; i += 8)
+    {
+      const int16x4_t vols_lo16 = vshrn_n_s32(vreinterpretq_s32_u32(vols_lo), 16);
+      const int16x4_t vols_hi16 = vshrn_n_s32(vreinterpretq_s32_u32(vols_hi), 16);
+      const int16x8_t samples = vld1q_s16(src + i);
+      const int16x8_t added =
+          vcombine_s16(vshrn_n_s32(vmull_s16(vols_lo16, vget_low_s16(samples)), 16),
+                       vshrn_n_s32(vmull_s16(vols_hi16, vget_high_s16(samples)), 16));
+      vst1q_s16(dst + i, vaddq_s16(vld1q_s16(dst + i), added));
+
+      vols_lo = vaddq_u32(vols_lo, vols_step);
+      vols_hi = vaddq_u32(vols_hi, vols_step);
+    }
+    vol = static_cast<s32>(vol + u32(step) * u32(i));
+  }
+#endif
+
+  return Generic::AddBuffersWithVolumeRamp(dst + i, src + i, count - i, vol, step);
+}
+
+void AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol)
+{
+  size_t i = 0;
+#if defined(_M_X86_64)
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    __m128i* const out = reinterpret_cast<__m128i*>(dst + i);
+    _mm_storeu_si128(out, _mm_add_epi16(_mm_loadu_si128(out), ApplyVolume(samples, vol, 15)));
+  }
+#elif defined(_M_ARM_64)
+  for (; i + 8 <= count; i += 8)
+    vst1q_s16(dst + i, vaddq_s16(vld1q_s16(dst + i), ApplyVolume(vld1q_s16(src + i), vol, 15)));
+#endif
+
+  Generic::AddBuffersWithVolume(dst + i, src + i, count - i, vol);
+}
+}  // namespace DSP::HLE::ZeldaMixing
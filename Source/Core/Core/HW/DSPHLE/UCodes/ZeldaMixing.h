@@ -0,0 +1,32 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+
+// The sample processing kernels of the Zelda ucode's audio renderer. Every function uses SSE2 or
+// NEON where available, and matches its Generic counterpart bit for bit.
+namespace DSP::HLE::ZeldaMixing
+{
+// Applies a fixed point volume with the given number of fractional bits to a buffer, saturating.
+void ApplyVolumeInPlace(s16* buf, size_t count, u16 vol, u32 fraction_bits);
+
+// Adds src to dst with a volume that starts at vol and changes by step after every sample. Both
+// are 16.16 fixed point, and the volume after the last sample is returned.
+s32 AddBuffersWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 vol, s32 step);
+
+// Adds src to dst with a 1.15 volume.
+void AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol);
+
+// The plain C++ implementations, which the others fall back to for the samples that don't fill
+// a full vector.
+namespace Generic
+{
+void ApplyVolumeInPlace(s16* buf, size_t count, u16 vol, u32 fraction_bits);
+s32 AddBuffersWithVolumeRamp(s16* dst, const s16* src, size_t count, s32 vol, s32 step);
+void AddBuffersWithVolume(s16* dst, const s16* src, size_t count, u16 vol);
+}  // namespace Generic
+}  // namespace DSP::HLE::ZeldaMixing
@@ -9,6 +9,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "AudioCommon/AudioCommon.h"
@@ -131,21 +132,7 @@ size_t DVDInterface::ProcessDTKSamples(s16* target_samples, size_t target_block_
 {
   const size_t block_count_to_process =
       std::min(target_block_count, audio_data.size() / StreamADPCM::ONE_BLOCK_SIZE);
-  size_t samples_processed = 0;
-  size_t bytes_processed = 0;
-  for (size_t i = 0; i < block_count_to_process; ++i)
-  {
-    m_adpcm_decoder.DecodeBlock(&target_samples[samples_processed * 2],
-                                &audio_data[bytes_processed]);
-    for (size_t j = 0; j < StreamADPCM::SAMPLES_PER_BLOCK * 2; ++j)
-    {
-      // TODO: Fix the mixer so it can accept non-byte-swapped samples.
-      s16* sample = &target_samples[samples_processed * 2 + j];
-      *sample = Common::swap16(*sample);
-    }
-    samples_processed += StreamADPCM::SAMPLES_PER_BLOCK;
-    bytes_processed += StreamADPCM::ONE_BLOCK_SIZE;
-  }
+  m_adpcm_decoder.DecodeBlocks(target_samples, audio_data.data(), block_count_to_process);
   return block_count_to_process;
 }
 
@@ -198,10 +185,11 @@ void DVDInterface::DTKStreamingCallback(DIInterruptType interrupt_type,
 
   // Determine which audio data to read next.
 
-  // 3.5 ms of samples
-  constexpr u32 MAX_POSSIBLE_BLOCKS = 6;
+  // 10.5 ms of samples. Each batch costs an event, a DVD thread read and a push into the mixer,
+  // so games that constantly stream music are cheaper with fewer and larger ones.
+  constexpr u32 MAX_POSSIBLE_BLOCKS = 18;
   constexpr u32 MAX_POSSIBLE_SAMPLES = MAX_POSSIBLE_BLOCKS * StreamADPCM::SAMPLES_PER_BLOCK;
-  const u32 maximum_blocks = sample_rate == AudioInterface::SampleRate::AI32KHz ? 4 : 6;
+  const u32 maximum_blocks = sample_rate == AudioInterface::SampleRate::AI32KHz ? 12 : 18;
   u64 read_offset = 0;
   u32 read_length = 0;
 
@@ -331,6 +319,8 @@ void DVDInterface::ResetDrive(bool spinup)
 void DVDInterface::Shutdown()
 {
   m_system.GetDVDThread().Stop();
+  m_inserted_disc_path.clear();
+  m_resident_discs.clear();
 }
 
 static u64 GetDiscEndOffset(const DiscIO::VolumeDisc& disc)
@@ -360,7 +350,7 @@ static u64 GetDiscEndOffset(const DiscIO::VolumeDisc& disc)
     return DiscIO::DL_DVD_SIZE;
 }
 
-void DVDInterface::SetDisc(std::unique_ptr<DiscIO::VolumeDisc> disc,
+void DVDInterface::SetDisc(std::unique_ptr<DiscIO::VolumeDisc> disc, const std::string& path,
                            std::optional<std::vector<std::string>> auto_disc_change_paths = {})
 {
   bool had_disc = IsDiscInside();
@@ -404,7 +394,14 @@ void DVDInterface::SetDisc(std::unique_ptr<DiscIO::VolumeDisc> disc,
   if (had_disc != has_disc)
     ExpansionInterface::g_rtc_flags[ExpansionInterface::RTCFlag::DiscChanged] = true;
 
-  m_system.GetDVDThread().SetDisc(std::move(disc));
+  std::unique_ptr<DiscIO::VolumeDisc> old_disc = m_system.GetDVDThread().SetDisc(std::move(disc));
+  if (old_disc && !m_inserted_disc_path.empty())
+  {
+    if (m_resident_discs.size() >= MAX_RESIDENT_DISCS)
+      m_resident_discs.erase(m_resident_discs.begin());
+    m_resident_discs.emplace_back(std::move(m_inserted_disc_path), std::move(old_disc));
+  }
+  m_inserted_disc_path = has_disc ? path : std::string();
   SetLidOpen();
 
   ResetDrive(false);
@@ -422,17 +419,28 @@ void DVDInterface::AutoChangeDiscCallback(Core::System& system, u64 userdata, s6
 
 void DVDInterface::EjectDiscCallback(Core::System& system, u64 userdata, s64 cyclesLate)
 {
-  system.GetDVDInterface().SetDisc(nullptr, {});
+  system.GetDVDInterface().SetDisc(nullptr, {}, {});
 }
 
 void DVDInterface::InsertDiscCallback(Core::System& system, u64 userdata, s64 cyclesLate)
 {
   auto& di = system.GetDVDInterface();
-  std::unique_ptr<DiscIO::VolumeDisc> new_disc =
-      DiscIO::CreateDiscForCore(di.m_disc_path_to_insert);
+  std::unique_ptr<DiscIO::VolumeDisc> new_disc;
+  const auto resident = std::ranges::find_if(di.m_resident_discs, [&di](const auto& entry) {
+    return entry.first == di.m_disc_path_to_insert;
+  });
+  if (resident != di.m_resident_discs.end())
+  {
+    new_disc = std::move(resident->second);
+    di.m_resident_discs.erase(resident);
+  }
+  else
+  {
+    new_disc = DiscIO::CreateDiscForCore(di.m_disc_path_to_insert);
+  }
 
   if (new_disc)
-    di.SetDisc(std::move(new_disc), {});
+    di.SetDisc(std::move(new_disc), di.m_disc_path_to_insert, {});
   else
     PanicAlertFmtT("The disc that was about to be inserted couldn't be found.");
 
@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/BitField.h"
@@ -138,7 +139,7 @@ public:
 
   void RegisterMMIO(MMIO::Mapping* mmio, u32 base, bool is_wii);
 
-  void SetDisc(std::unique_ptr<DiscIO::VolumeDisc> disc,
+  void SetDisc(std::unique_ptr<DiscIO::VolumeDisc> disc, const std::string& path,
                std::optional<std::vector<std::string>> auto_disc_change_paths);
   bool IsDiscInside() const;
   void EjectDisc(const Core::CPUThreadGuard& guard, EjectCause cause);
@@ -295,6 +296,12 @@ private:
   std::vector<std::string> m_auto_disc_change_paths;
   size_t m_auto_disc_change_index = 0;
 
+  // Discs that were ejected stay open, so that inserting them again doesn't have to open the
+  // file and read its headers again. The most recently ejected disc is at the back.
+  static constexpr size_t MAX_RESIDENT_DISCS = 4;
+  std::string m_inserted_disc_path;
+  std::vector<std::pair<std::string, std::unique_ptr<DiscIO::VolumeDisc>>> m_resident_discs;
+
   // Events
   CoreTiming::EventType* m_finish_executing_command = nullptr;
   CoreTiming::EventType* m_auto_change_disc = nullptr;
@@ -0,0 +1,230 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DVD/DVDReadAhead.h"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+#include "DiscIO/Blob.h"
+#include "DiscIO/Volume.h"
+
+namespace DVD
+{
+void ReadAheadTrace::Record(const Read& read)
+{
+  if (m_reads.size() >= MAX_READS)
+    return;
+
+  m_positions[read].push_back(m_reads.size());
+  m_reads.push_back(read);
+}
+
+std::vector<ReadAheadTrace::Read> ReadAheadTrace::Predict(const Read& read, size_t count)
+{
+  const auto it = m_positions.find(read);
+  if (it == m_positions.end())
+    return {};
+
+  const std::vector<size_t>& positions = it->second;
+  const auto next = std::ranges::lower_bound(positions, m_next_position);
+  m_next_position = (next != positions.end() ? *next : positions.front()) + 1;
+
+  const size_t end = std::min(m_next_position + count, m_reads.size());
+  return std::vector<Read>(m_reads.begin() + m_next_position, m_reads.begin() + end);
+}
+
+bool ReadAheadTrace::Load(const std::string& path)
+{
+  File::IOFile file(path, "rb");
+  Header header;
+  if (!file.ReadArray(&header, 1) || header.magic != MAGIC || header.version != VERSION ||
+      header.read_count > MAX_READS)
+  {
+    return false;
+  }
+
+  std::vector<Read> reads(header.read_count);
+  if (!file.ReadArray(reads.data(), reads.size()))
+    return false;
+
+  m_reads.clear();
+  m_positions.clear();
+  m_next_position = 0;
+  for (const Read& read : reads)
+    Record(read);
+
+  return true;
+}
+
+bool ReadAheadTrace::Save(const std::string& path) const
+{
+  if (!File::CreateFullPath(path))
+    return false;
+
+  const Header header{MAGIC, VERSION, static_cast<u32>(m_reads.size()), 0};
+  File::IOFile file(path, "wb");
+  return file.WriteArray(&header, 1) && file.WriteArray(m_reads.data(), m_reads.size());
+}
+
+ReadAhead::~ReadAhead()
+{
+  Stop();
+}
+
+void ReadAhead::Start(const DiscIO::Volume& disc)
+{
+  Stop();
+
+  // Reading the formats that aren't compressed or encrypted is about as fast as the OS file cache
+  const DiscIO::BlobReader& blob = disc.GetBlobReader();
+  switch (blob.GetBlobType())
+  {
+  case DiscIO::BlobType::GCZ:
+  case DiscIO::BlobType::WIA:
+  case DiscIO::BlobType::RVZ:
+  case DiscIO::BlobType::NFS:
+    break;
+  default:
+    return;
+  }
+
+  const std::string game_id = disc.GetGameID();
+  if (game_id.empty())
+    return;
+
+  // The worker reads through its own reader, so that it never waits on the DVD thread.
+  std::unique_ptr<DiscIO::BlobReader> reader = blob.CopyReader();
+  if (!reader)
+    return;
+  m_disc = DiscIO::CreateVolume(std::move(reader));
+  if (!m_disc)
+    return;
+
+  m_trace_path = File::GetUserPath(D_CACHE_IDX) + "DVDTraces" DIR_SEP +
+                 fmt::format("{}_r{}_d{}.trace", game_id, disc.GetRevision().value_or(0),
+                             disc.GetDiscNumber().value_or(0));
+  m_trace = {};
+  m_recording = {};
+  if (m_trace.Load(m_trace_path))
+    INFO_LOG_FMT(DVDINTERFACE, "Loaded {} reads to read ahead", m_trace.GetReads().size());
+
+  m_worker.Reset("DVD read ahead", std::bind_front(&ReadAhead::Prefetch, this),
+                 Common::ThreadPriority::Background);
+}
+
+void ReadAhead::Stop()
+{
+  if (!m_disc)
+    return;
+
+  m_worker.Cancel();
+  m_worker.Shutdown();
+
+  if (m_recording.GetReads().size() > m_trace.GetReads().size() &&
+      !m_recording.Save(m_trace_path))
+  {
+    WARN_LOG_FMT(DVDINTERFACE, "Failed to save DVD read trace to {}", m_trace_path);
+  }
+
+  m_disc.reset();
+  m_cache.clear();
+  m_cache_order.clear();
+  m_pending.clear();
+  m_cache_size = 0;
+}
+
+bool ReadAhead::Read(u64 offset, u32 length, const DiscIO::Partition& partition, u8* buffer)
+{
+  if (!m_disc)
+    return false;
+
+  const ReadAheadTrace::Read read{partition.offset, offset, length};
+  m_recording.Record(read);
+  const std::vector<ReadAheadTrace::Read> predicted = m_trace.Predict(read, READ_AHEAD_COUNT);
+
+  std::lock_guard lk(m_cache_lock);
+
+  bool found = false;
+  const auto it = m_cache.find(read);
+  if (it != m_cache.end())
+  {
+    std::ranges::copy(it->second.data, buffer);
+    m_cache_size -= it->second.data.size();
+    m_cache.erase(it);
+    found = true;
+  }
+  else
+  {
+    // If the worker is still reading it, it's too late to be of use.
+    m_pending.erase(read);
+  }
+
+  for (const ReadAheadTrace::Read& next : predicted)
+  {
+    if (next.length > MAX_CACHE_SIZE / READ_AHEAD_COUNT || m_cache.contains(next) ||
+        !m_pending.insert(next).second)
+    {
+      continue;
+    }
+    m_worker.Push(ReadAheadTrace::Read(next));
+  }
+
+  return found;
+}
+
+void ReadAhead::Prefetch(ReadAheadTrace::Read read)
+{
+  {
+    std::lock_guard lk(m_cache_lock);
+    if (!m_pending.contains(read))
+      return;
+  }
+
+  std::vector<u8> data(read.length);
+  if (!m_disc->Read(read.offset, read.length, data.data(),
+                    DiscIO::Partition(read.partition_offset)))
+  {
+    std::lock_guard lk(m_cache_lock);
+    m_pending.erase(read);
+    return;
+  }
+
+  InsertIntoCache(read, std::move(data));
+}
+
+void ReadAhead::InsertIntoCache(const ReadAheadTrace::Read& read, std::vector<u8> data)
+{
+  std::lock_guard lk(m_cache_lock);
+  if (m_pending.erase(read) == 0)
+    return;
+
+  const u64 sequence = m_next_sequence++;
+  m_cache_size += data.size();
+  m_cache.insert_or_assign(read, CachedRead{std::move(data), sequence});
+  m_cache_order.emplace_back(sequence, read);
+
+  // Drop the oldest data, along with the order of data the DVD thread has already taken
+  while (!m_cache_order.empty())
+  {
+    const auto& [oldest_sequence, oldest_read] = m_cache_order.front();
+    const auto it = m_cache.find(oldest_read);
+    if (it != m_cache.end() && it->second.sequence == oldest_sequence)
+    {
+      if (m_cache_size <= MAX_CACHE_SIZE)
+        break;
+      m_cache_size -= it->second.data.size();
+      m_cache.erase(it);
+    }
+    m_cache_order.pop_front();
+  }
+}
+}  // namespace DVD
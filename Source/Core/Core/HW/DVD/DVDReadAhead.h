@@ -0,0 +1,122 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <compare>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
+
+namespace DiscIO
+{
+struct Partition;
+class Volume;
+}  // namespace DiscIO
+
+namespace DVD
+{
+// The sequence of reads a game made from its disc during one run.
+class ReadAheadTrace
+{
+public:
+  static constexpr u32 MAGIC = 0x52545644;  // "DVTR"
+  static constexpr u32 VERSION = 1;
+  static constexpr size_t MAX_READS = 0x10000;
+
+  struct Read
+  {
+    u64 partition_offset = 0;
+    u64 offset = 0;
+    u32 length = 0;
+    u32 padding = 0;
+
+    auto operator<=>(const Read&) const = default;
+  };
+
+  // Reads past MAX_READS aren't recorded.
+  void Record(const Read& read);
+
+  // Returns up to count reads that followed this one in the trace. If the read is in the trace more
+  // than once, the first occurrence after the previous prediction is used.
+  std::vector<Read> Predict(const Read& read, size_t count);
+
+  bool Load(const std::string& path);
+  bool Save(const std::string& path) const;
+
+  const std::vector<Read>& GetReads() const { return m_reads; }
+
+private:
+  struct Header
+  {
+    u32 magic;
+    u32 version;
+    u32 read_count;
+    u32 padding;
+  };
+
+  std::vector<Read> m_reads;
+  // The indices in m_reads of every read, in ascending order.
+  std::map<Read, std::vector<size_t>> m_positions;
+  size_t m_next_position = 0;
+};
+
+// Reads (and decompresses) what a game is likely to read next on a separate thread, based on the
+// trace recorded during its previous run, so that the DVD thread finds it in memory. Only the host
+// side latency of reads changes, the emulated timing doesn't.
+class ReadAhead
+{
+public:
+  // How many of the predicted next reads are queued, and how much read ahead data is kept.
+  static constexpr size_t READ_AHEAD_COUNT = 4;
+  static constexpr size_t MAX_CACHE_SIZE = 32 * 1024 * 1024;
+
+  ReadAhead() = default;
+  ReadAhead(const ReadAhead&) = delete;
+  ReadAhead& operator=(const ReadAhead&) = delete;
+  ~ReadAhead();
+
+  // Must not be called while the DVD thread is reading from the disc. Does nothing for formats
+  // that are cheap to read.
+  void Start(const DiscIO::Volume& disc);
+  // Saves the trace of this run, if it is longer than the one it started with.
+  void Stop();
+
+  // Called on the DVD thread for every read. Returns false if the data hasn't been read ahead,
+  // in which case buffer isn't written to.
+  bool Read(u64 offset, u32 length, const DiscIO::Partition& partition, u8* buffer);
+
+private:
+  void Prefetch(ReadAheadTrace::Read read);
+  void InsertIntoCache(const ReadAheadTrace::Read& read, std::vector<u8> data);
+
+  struct CachedRead
+  {
+    std::vector<u8> data;
+    u64 sequence;
+  };
+
+  std::unique_ptr<DiscIO::Volume> m_disc;
+  std::string m_trace_path;
+  ReadAheadTrace m_trace;
+  ReadAheadTrace m_recording;
+
+  Common::WorkQueueThreadSP<ReadAheadTrace::Read> m_worker;
+
+  // Shared between the DVD thread and the worker.
+  std::mutex m_cache_lock;
+  std::map<ReadAheadTrace::Read, CachedRead> m_cache;
+  std::deque<std::pair<u64, ReadAheadTrace::Read>> m_cache_order;
+  std::set<ReadAheadTrace::Read> m_pending;
+  size_t m_cache_size = 0;
+  u64 m_next_sequence = 0;
+};
+}  // namespace DVD
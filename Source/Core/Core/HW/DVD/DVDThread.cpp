@@ -5,21 +5,25 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
 #include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/FrameProfiler.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/SPSCQueue.h"
 #include "Common/Timer.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/DVD/DVDInterface.h"
+#include "Core/HW/DVD/DVDReadAhead.h"
 #include "Core/HW/DVD/FileMonitor.h"
 #include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
@@ -55,7 +59,12 @@ void DVDThread::Stop()
 
   m_result_queue.Clear();
   m_result_map.clear();
+  {
+    std::lock_guard lk(m_free_buffers_lock);
+    m_free_buffers.clear();
+  }
 
+  m_read_ahead.Stop();
   m_disc.reset();
 }
 
@@ -100,10 +109,14 @@ void DVDThread::DoState(PointerWrap& p)
   // was made. Handling that properly may be more effort than it's worth.
 }
 
-void DVDThread::SetDisc(std::unique_ptr<DiscIO::Volume> disc)
+std::unique_ptr<DiscIO::VolumeDisc> DVDThread::SetDisc(std::unique_ptr<DiscIO::VolumeDisc> disc)
 {
   WaitUntilIdle();
-  m_disc = std::move(disc);
+  m_read_ahead.Stop();
+  std::swap(m_disc, disc);
+  if (m_disc && Config::Get(Config::MAIN_DVD_READ_AHEAD))
+    m_read_ahead.Start(*m_disc);
+  return disc;
 }
 
 bool DVDThread::HasDisc() const
@@ -291,18 +304,50 @@ void DVDThread::FinishRead(u64 id, s64 cycles_late)
 
   // Notify the emulated software that the command has been executed
   dvd_interface.FinishExecutingCommand(request.reply_type, interrupt, cycles_late, buffer);
+
+  ReleaseBuffer(std::move(result.second));
 }
 
 void DVDThread::ProcessReadRequest(ReadRequest&& request)
 {
+  Common::FrameProfiler::Scope profiler_scope(Common::FrameProfiler::Stage::DVDRead);
+
   m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
 
-  std::vector<u8> buffer(request.length);
-  if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+  std::vector<u8> buffer = GetBuffer(request.length);
+  if (!m_read_ahead.Read(request.dvd_offset, request.length, request.partition, buffer.data()) &&
+      !m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+  {
     buffer.resize(0);
+  }
 
   request.realtime_done_us = Common::Timer::NowUs();
 
   m_result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
 }
+
+std::vector<u8> DVDThread::GetBuffer(u32 length)
+{
+  std::vector<u8> buffer;
+  {
+    std::lock_guard lk(m_free_buffers_lock);
+    if (!m_free_buffers.empty())
+    {
+      buffer = std::move(m_free_buffers.back());
+      m_free_buffers.pop_back();
+    }
+  }
+
+  // Reads are split into ECC blocks, so a reused buffer almost always has the right size already
+  // and doesn't have to be allocated or zeroed again.
+  buffer.resize(length);
+  return buffer;
+}
+
+void DVDThread::ReleaseBuffer(std::vector<u8>&& buffer)
+{
+  std::lock_guard lk(m_free_buffers_lock);
+  if (m_free_buffers.size() < MAX_FREE_BUFFERS)
+    m_free_buffers.push_back(std::move(buffer));
+}
 }  // namespace DVD
@@ -5,6 +5,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -14,9 +15,11 @@
 
 #include "Common/WorkQueueThread.h"
 #include "Core/HW/DVD/DVDInterface.h"
+#include "Core/HW/DVD/DVDReadAhead.h"
 #include "Core/HW/DVD/FileMonitor.h"
 
 #include "DiscIO/Volume.h"
+#include "DiscIO/VolumeDisc.h"
 
 class PointerWrap;
 namespace Core
@@ -62,7 +65,8 @@ public:
   void Stop();
   void DoState(PointerWrap& p);
 
-  void SetDisc(std::unique_ptr<DiscIO::Volume> disc);
+  // Returns the disc that was inserted before
+  std::unique_ptr<DiscIO::VolumeDisc> SetDisc(std::unique_ptr<DiscIO::VolumeDisc> disc);
   bool HasDisc() const;
 
   bool HasWiiHashes() const;
@@ -119,6 +123,8 @@ private:
   };
 
   void ProcessReadRequest(ReadRequest&& read_request);
+  std::vector<u8> GetBuffer(u32 length);
+  void ReleaseBuffer(std::vector<u8>&& buffer);
 
   using ReadResult = std::pair<ReadRequest, std::vector<u8>>;
 
@@ -131,7 +137,13 @@ private:
   Common::WaitableSPSCQueue<ReadResult> m_result_queue;
   std::map<u64, ReadResult> m_result_map;
 
-  std::unique_ptr<DiscIO::Volume> m_disc;
+  // The buffers of finished reads, for the DVD thread to read into again.
+  static constexpr size_t MAX_FREE_BUFFERS = 16;
+  std::mutex m_free_buffers_lock;
+  std::vector<std::vector<u8>> m_free_buffers;
+
+  std::unique_ptr<DiscIO::VolumeDisc> m_disc;
+  ReadAhead m_read_ahead;
 
   FileMonitor::FileLogger m_file_logger;
 
@@ -4,6 +4,7 @@
 #include "Core/HW/EXI/EXI_DeviceEthernet.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <optional>
 #include <string>
@@ -570,10 +571,13 @@ bool CEXIETHERNET::RecvHandlePacket()
   descriptor = (Descriptor*)write_ptr;
   current_rwp = page_ptr(BBA_RWP);
   DEBUG_LOG_FMT(SP1, "Frame recv: {:x}", mRecvBufferLength);
-  for (u32 i = 0; i < mRecvBufferLength; i++)
+  // Copy up to the end of each page at once
+  for (u32 copied = 0; copied < mRecvBufferLength;)
   {
-    write_ptr[off] = mRecvBuffer[i];
-    off++;
+    const u32 size = std::min(0x100 - off, mRecvBufferLength - copied);
+    std::memcpy(write_ptr + off, &mRecvBuffer[copied], size);
+    copied += size;
+    off += size;
     if (off == 0x100)
     {
       off = 0;
@@ -90,9 +90,24 @@ bool GCMemcardDirectory::LoadGCI(Memcard::GCIFile gci)
     return false;
   }
 
-  if (!gci.LoadSaveBlocks())
+  // The saves of other games are only read once the game accesses them (see SaveAreaRW), which
+  // usually never happens. Only the size of the file is checked for now.
+  const bool is_current_game = m_game_id == Common::swap32(gci.m_gci_header.m_gamecode.data());
+  if (is_current_game || gci.HasCopyProtection())
   {
-    ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to load data of {}", gci.m_filename);
+    if (!gci.LoadSaveBlocks())
+    {
+      ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to load data of {}", gci.m_filename);
+      return false;
+    }
+  }
+  else if (File::GetSize(gci.m_filename) != u64{num_blocks} * Memcard::BLOCK_SIZE +
+                                                 Memcard::DENTRY_SIZE)
+  {
+    ERROR_LOG_FMT(EXPANSIONINTERFACE,
+                  "{}\nwas not loaded because it is an invalid GCI.\nThe file size does not match "
+                  "the size recorded in the header",
+                  gci.m_filename);
     return false;
   }
 
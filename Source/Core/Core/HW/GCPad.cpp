@@ -3,6 +3,7 @@
 
 #include "Core/HW/GCPad.h"
 
+#include <array>
 #include <cstring>
 
 #include "Common/Common.h"
@@ -15,6 +16,10 @@
 namespace Pad
 {
 static InputConfig s_config("GCPadNew", _trans("Pad"), "GCPad", "Pad");
+
+// What each pad returned the last time, only accessed on the CPU thread.
+static std::array<GCPadStatus, 4> s_last_status;
+
 InputConfig* GetConfig()
 {
   return &s_config;
@@ -37,6 +42,8 @@ void Initialize()
 
   s_config.RegisterHotplugCallback();
 
+  s_last_status = {};
+
   // Load the saved controller config
   s_config.LoadConfig();
 }
@@ -58,7 +65,15 @@ bool IsInitialized()
 
 GCPadStatus GetStatus(int pad_num)
 {
-  return static_cast<GCPad*>(s_config.GetController(pad_num))->GetInput();
+  // The state lock is held by the UI while it draws the mapping indicators or updates references
+  // after a hotplug. Rather than blocking the emulated pad poll on it, the pad repeats its last
+  // status for that poll.
+  const auto lock = ControllerEmu::EmulatedController::TryGetStateLock();
+  if (!lock.owns_lock())
+    return s_last_status[pad_num];
+
+  s_last_status[pad_num] = static_cast<GCPad*>(s_config.GetController(pad_num))->GetInput();
+  return s_last_status[pad_num];
 }
 
 ControllerEmu::ControlGroup* GetGroup(int pad_num, PadGroup group)
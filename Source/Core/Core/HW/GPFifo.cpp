@@ -3,6 +3,7 @@
 
 #include "Core/HW/GPFifo.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 
@@ -89,23 +90,34 @@ void GPFifoManager::UpdateGatherPipe()
   auto& processor_interface = system.GetProcessorInterface();
 
   size_t pipe_count = GetGatherPipeCount();
-  size_t processed;
-  for (processed = 0; pipe_count >= GATHER_PIPE_SIZE; processed += GATHER_PIPE_SIZE)
+  size_t processed = 0;
+  while (pipe_count >= GATHER_PIPE_SIZE)
   {
-    // copy the GatherPipe
-    memory.CopyToEmu(processor_interface.m_fifo_cpu_write_pointer, m_gather_pipe + processed,
-                     GATHER_PIPE_SIZE);
-    pipe_count -= GATHER_PIPE_SIZE;
+    // Copy as many bursts as fit before the end of the FIFO at once. The end pointer is the
+    // address of the last burst.
+    u32& write_pointer = processor_interface.m_fifo_cpu_write_pointer;
+    const u32 end = processor_interface.m_fifo_cpu_end;
+    const bool before_end = write_pointer <= end;
+    const size_t bursts_to_end = before_end ? (end - write_pointer) / GATHER_PIPE_SIZE + 1 : 1;
+    const size_t bursts = std::min(pipe_count / GATHER_PIPE_SIZE, bursts_to_end);
+    const size_t size = bursts * GATHER_PIPE_SIZE;
+
+    memory.CopyToEmu(write_pointer, m_gather_pipe + processed, size);
+    processed += size;
+    pipe_count -= size;
 
     // increase the CPUWritePointer
-    if (processor_interface.m_fifo_cpu_write_pointer == processor_interface.m_fifo_cpu_end)
-      processor_interface.m_fifo_cpu_write_pointer = processor_interface.m_fifo_cpu_base;
+    if (before_end && bursts == bursts_to_end)
+      write_pointer = processor_interface.m_fifo_cpu_base;
     else
-      processor_interface.m_fifo_cpu_write_pointer += GATHER_PIPE_SIZE;
-
-    system.GetCommandProcessor().GatherPipeBursted();
+      write_pointer += static_cast<u32>(size);
   }
 
+  // Publish all the bursts to the command processor at once, rather than waking the GPU thread
+  // for every 32 bytes.
+  if (processed != 0)
+    system.GetCommandProcessor().GatherPipeBursted(static_cast<u32>(processed / GATHER_PIPE_SIZE));
+
   // move back the spill bytes
   memmove(m_gather_pipe, m_gather_pipe + processed, pipe_count);
   SetGatherPipeCount(pipe_count);
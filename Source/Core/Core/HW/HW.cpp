@@ -96,6 +96,8 @@ void DoState(Core::System& system, PointerWrap& p)
   p.DoMarker("ProcessorInterface");
   system.GetDSP().DoState(p);
   p.DoMarker("DSP");
+  // Finish the deferred RAM and ARAM copies before devices that may access them.
+  p.FlushDeferredCopies();
   system.GetDVDInterface().DoState(p);
   p.DoMarker("DVDInterface");
   system.GetGPFifo().DoState(p);
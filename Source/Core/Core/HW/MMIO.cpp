@@ -3,7 +3,9 @@
 
 #include "Core/HW/MMIO.h"
 
+#include <cstdint>
 #include <functional>
+#include <limits>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
@@ -220,6 +222,77 @@ struct LargerAccessSize<u16>
   typedef u32 value;
 };
 
+// The kind of handling method a handler currently uses. The converters use this to become a
+// constant or direct handling method themselves when the handlers they forward to allow it, so that
+// the JITs can inline those accesses too. This only works if the handlers they forward to have
+// been registered before the converters, which is how all HW modules register them.
+template <typename T>
+struct ReadMethodInfo : public ReadHandlingMethodVisitor<T>
+{
+  enum class Kind
+  {
+    Constant,
+    Direct,
+    Complex,
+  };
+
+  Kind kind = Kind::Complex;
+  T value = 0;
+  const T* addr = nullptr;
+  u32 mask = 0;
+
+  void VisitConstant(T constant) override
+  {
+    kind = Kind::Constant;
+    value = constant;
+  }
+
+  void VisitDirect(const T* direct_addr, u32 direct_mask) override
+  {
+    kind = Kind::Direct;
+    addr = direct_addr;
+    mask = direct_mask & std::numeric_limits<T>::max();
+  }
+
+  void VisitComplex(const std::function<T(Core::System&, u32)>*) override { kind = Kind::Complex; }
+};
+
+template <typename T>
+struct WriteMethodInfo : public WriteHandlingMethodVisitor<T>
+{
+  enum class Kind
+  {
+    Nop,
+    Direct,
+    Complex,
+  };
+
+  Kind kind = Kind::Complex;
+  T* addr = nullptr;
+  u32 mask = 0;
+
+  void VisitNop() override { kind = Kind::Nop; }
+
+  void VisitDirect(T* direct_addr, u32 direct_mask) override
+  {
+    kind = Kind::Direct;
+    addr = direct_addr;
+    mask = direct_mask & std::numeric_limits<T>::max();
+  }
+
+  void VisitComplex(const std::function<void(Core::System&, u32, T)>*) override
+  {
+    kind = Kind::Complex;
+  }
+};
+
+// Whether two direct halves are the low and high half of the same larger value in host memory.
+template <typename T, typename ST>
+bool AreAdjacentHalves(const ST* high_part, const ST* low_part)
+{
+  return high_part == low_part + 1 && reinterpret_cast<uintptr_t>(low_part) % alignof(T) == 0;
+}
+
 template <typename T>
 ReadHandlingMethod<T>* ReadToSmaller(Mapping* mmio, u32 high_part_addr, u32 low_part_addr)
 {
@@ -228,7 +301,22 @@ ReadHandlingMethod<T>* ReadToSmaller(Mapping* mmio, u32 high_part_addr, u32 low_
   ReadHandler<ST>* high_part = &mmio->GetHandlerForRead<ST>(high_part_addr);
   ReadHandler<ST>* low_part = &mmio->GetHandlerForRead<ST>(low_part_addr);
 
-  // TODO(delroth): optimize
+  ReadMethodInfo<ST> high_info;
+  ReadMethodInfo<ST> low_info;
+  high_part->Visit(high_info);
+  low_part->Visit(low_info);
+
+  using Kind = typename ReadMethodInfo<ST>::Kind;
+  if (high_info.kind == Kind::Constant && low_info.kind == Kind::Constant)
+    return Constant<T>(((T)high_info.value << (8 * sizeof(ST))) | low_info.value);
+
+  if (high_info.kind == Kind::Direct && low_info.kind == Kind::Direct &&
+      AreAdjacentHalves<T>(high_info.addr, low_info.addr))
+  {
+    return DirectRead<T>(reinterpret_cast<const T*>(low_info.addr),
+                         (high_info.mask << (8 * sizeof(ST))) | low_info.mask);
+  }
+
   return ComplexRead<T>([=](Core::System& system, u32 addr) {
     return ((T)high_part->Read(system, high_part_addr) << (8 * sizeof(ST))) |
            low_part->Read(system, low_part_addr);
@@ -243,7 +331,22 @@ WriteHandlingMethod<T>* WriteToSmaller(Mapping* mmio, u32 high_part_addr, u32 lo
   WriteHandler<ST>* high_part = &mmio->GetHandlerForWrite<ST>(high_part_addr);
   WriteHandler<ST>* low_part = &mmio->GetHandlerForWrite<ST>(low_part_addr);
 
-  // TODO(delroth): optimize
+  WriteMethodInfo<ST> high_info;
+  WriteMethodInfo<ST> low_info;
+  high_part->Visit(high_info);
+  low_part->Visit(low_info);
+
+  using Kind = typename WriteMethodInfo<ST>::Kind;
+  if (high_info.kind == Kind::Nop && low_info.kind == Kind::Nop)
+    return Nop<T>();
+
+  if (high_info.kind == Kind::Direct && low_info.kind == Kind::Direct &&
+      AreAdjacentHalves<T>(high_info.addr, low_info.addr))
+  {
+    return DirectWrite<T>(reinterpret_cast<T*>(low_info.addr),
+                          (high_info.mask << (8 * sizeof(ST))) | low_info.mask);
+  }
+
   return ComplexWrite<T>([=](Core::System& system, u32 addr, T val) {
     high_part->Write(system, high_part_addr, val >> (8 * sizeof(ST)));
     low_part->Write(system, low_part_addr, (ST)val);
@@ -257,7 +360,20 @@ ReadHandlingMethod<T>* ReadToLarger(Mapping* mmio, u32 larger_addr, u32 shift)
 
   ReadHandler<LT>* large = &mmio->GetHandlerForRead<LT>(larger_addr);
 
-  // TODO(delroth): optimize
+  ReadMethodInfo<LT> info;
+  large->Visit(info);
+
+  using Kind = typename ReadMethodInfo<LT>::Kind;
+  if (info.kind == Kind::Constant)
+    return Constant<T>(static_cast<T>(info.value >> shift));
+
+  // The part that is shifted down is a value of the smaller type in host memory.
+  if (info.kind == Kind::Direct && shift % (8 * sizeof(T)) == 0)
+  {
+    return DirectRead<T>(reinterpret_cast<const T*>(info.addr) + shift / (8 * sizeof(T)),
+                         (info.mask >> shift) & std::numeric_limits<T>::max());
+  }
+
   return ComplexRead<T>([large, shift](Core::System& system, u32 addr) {
     return large->Read(system, addr & ~(sizeof(LT) - 1)) >> shift;
   });
@@ -15,6 +15,7 @@
 #include <span>
 #include <tuple>
 
+#include "Common/Align.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -109,6 +110,9 @@ void MemoryManager::Init()
   // If MMU is turned off in GameCube mode, turn on fake VMEM hack.
   const bool fake_vmem = !wii && !mmu;
 
+  m_huge_pages = Config::Get(Config::MAIN_FASTMEM_HUGE_PAGES);
+  m_huge_page_bytes = 0;
+
   u32 mem_size = 0;
   for (PhysicalMemoryRegion& region : m_physical_regions)
   {
@@ -117,6 +121,10 @@ void MemoryManager::Init()
     if (!fake_vmem && (region.flags & PhysicalMemoryRegion::FAKE_VMEM))
       continue;
 
+    // Huge pages of shared memory are aligned within the segment as well.
+    if (m_huge_pages)
+      mem_size = Common::AlignUp(mem_size, Common::MemArena::HUGE_PAGE_SIZE);
+
     region.shm_position = mem_size;
     region.active = true;
     mem_size += region.size;
@@ -140,6 +148,7 @@ void MemoryManager::Init()
           region.physical_address, region.size);
       exit(0);
     }
+    AdviseHugePages(*region.out_pointer, region.size);
 
     for (u32 i = 0; i < region.size; i += PowerPC::BAT_PAGE_SIZE)
     {
@@ -159,6 +168,12 @@ void MemoryManager::Init()
   m_is_initialized = true;
 }
 
+void MemoryManager::AdviseHugePages(void* view, size_t size)
+{
+  if (m_huge_pages && m_arena.AdviseHugePages(view, size))
+    m_huge_page_bytes += size;
+}
+
 bool MemoryManager::IsAddressInFastmemArea(const u8* address) const
 {
   return address >= m_fastmem_arena && address < m_fastmem_arena + m_fastmem_arena_size;
@@ -201,12 +216,19 @@ bool MemoryManager::InitFastmemArena()
   constexpr size_t guard_size = 0x8000'0000;
   constexpr size_t memory_size = ppc_view_size * 2 + guard_size * 3;
 
-  m_fastmem_arena = m_arena.ReserveMemoryRegion(memory_size);
+  // With huge pages, the views have to be aligned to them, so reserve enough to align the base.
+  const size_t alignment_slack = m_huge_pages ? Common::MemArena::HUGE_PAGE_SIZE : 0;
+  m_fastmem_arena = m_arena.ReserveMemoryRegion(memory_size + alignment_slack);
   if (!m_fastmem_arena)
   {
     PanicAlertFmt("Memory::InitFastmemArena(): Failed finding a memory base.");
     return false;
   }
+  if (m_huge_pages)
+  {
+    m_fastmem_arena = reinterpret_cast<u8*>(Common::AlignUp(
+        reinterpret_cast<uintptr_t>(m_fastmem_arena), Common::MemArena::HUGE_PAGE_SIZE));
+  }
 
   m_physical_base = m_fastmem_arena + guard_size;
   m_logical_base = m_fastmem_arena + ppc_view_size + guard_size * 2;
@@ -226,6 +248,12 @@ bool MemoryManager::InitFastmemArena()
                     region.physical_address, region.size);
       return false;
     }
+    AdviseHugePages(view, region.size);
+  }
+
+  if (m_huge_pages)
+  {
+    NOTICE_LOG_FMT(MEMMAP, "Asked for huge pages for {} MiB of mappings", m_huge_page_bytes >> 20);
   }
 
   m_is_fastmem_arena_initialized = true;
@@ -294,6 +322,8 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
                   intersection_start, mapped_size, logical_address);
               exit(0);
             }
+            if (m_huge_pages)
+              m_arena.AdviseHugePages(mapped_pointer, mapped_size);
             m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
           }
 
@@ -343,14 +373,14 @@ void MemoryManager::DoState(PointerWrap& p)
     return;
   }
 
-  p.DoArray(m_ram, current_ram_size);
-  p.DoArray(m_l1_cache, current_l1_cache_size);
+  p.DoDeferrableArray(m_ram, current_ram_size);
+  p.DoDeferrableArray(m_l1_cache, current_l1_cache_size);
   p.DoMarker("Memory RAM");
   if (current_have_fake_vmem)
-    p.DoArray(m_fake_vmem, current_fake_vmem_size);
+    p.DoDeferrableArray(m_fake_vmem, current_fake_vmem_size);
   p.DoMarker("Memory FakeVMEM");
   if (current_have_exram)
-    p.DoArray(m_exram, current_exram_size);
+    p.DoDeferrableArray(m_exram, current_exram_size);
   p.DoMarker("Memory EXRAM");
 }
 
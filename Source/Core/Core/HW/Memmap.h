@@ -79,6 +79,9 @@ public:
 
   bool IsAddressInFastmemArea(const u8* address) const;
   u8* GetPhysicalBase() const { return m_physical_base; }
+  // How many bytes of the views of physical memory the OS was asked to back with huge pages and
+  // accepted, for telling whether TLB misses are expected to be an issue.
+  size_t GetHugePageBytes() const { return m_huge_page_bytes; }
   u8* GetLogicalBase() const { return m_logical_base; }
   u8* GetPhysicalPageMappingsBase() const { return m_physical_page_mappings_base; }
   u8* GetLogicalPageMappingsBase() const { return m_logical_page_mappings_base; }
@@ -156,6 +159,8 @@ public:
   }
 
 private:
+  void AdviseHugePages(void* view, size_t size);
+
   // Base is a pointer to the base of the memory map. Yes, some MMU tricks
   // are used to set up a full GC or Wii memory map in process memory.
   // In 64-bit, this might point to "high memory" (above the 32-bit limit),
@@ -196,6 +201,11 @@ private:
 
   bool m_is_fastmem_arena_initialized = false;
 
+  // Whether views are backed by huge pages where the OS allows it, and how many bytes of views
+  // the OS accepted that for.
+  bool m_huge_pages = false;
+  size_t m_huge_page_bytes = 0;
+
   // STATE_TO_SAVE
   // Save the Init(), Shutdown() state
   bool m_is_initialized = false;
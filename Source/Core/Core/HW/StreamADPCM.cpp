@@ -6,33 +6,45 @@
 #include "Core/HW/StreamADPCM.h"
 
 #include <algorithm>
+#include <array>
+#include <utility>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Swap.h"
 
 namespace StreamADPCM
 {
-static s16 ADPDecodeSample(s32 bits, s32 q, s32& hist1, s32& hist2)
+namespace
 {
-  s32 hist = 0;
-  switch (q >> 4)
-  {
-  case 0:
-    hist = 0;
-    break;
-  case 1:
-    hist = (hist1 * 0x3c);
-    break;
-  case 2:
-    hist = (hist1 * 0x73) - (hist2 * 0x34);
-    break;
-  case 3:
-    hist = (hist1 * 0x62) - (hist2 * 0x37);
-    break;
-  }
+struct Coefficients
+{
+  s32 hist1;
+  s32 hist2;
+  s32 shift;
+};
+
+// The filter and the scale are the same for the whole block.
+Coefficients GetCoefficients(u8 q)
+{
+  static constexpr std::array<std::pair<s32, s32>, 4> FILTERS{{
+      {0, 0},
+      {0x3c, 0},
+      {0x73, -0x34},
+      {0x62, -0x37},
+  }};
+
+  const u32 filter = q >> 4;
+  const auto [hist1, hist2] = filter < FILTERS.size() ? FILTERS[filter] : FILTERS[0];
+  return {hist1, hist2, q & 0xf};
+}
+
+s16 ADPDecodeSample(s32 bits, const Coefficients& coefficients, s32& hist1, s32& hist2)
+{
+  s32 hist = hist1 * coefficients.hist1 + hist2 * coefficients.hist2;
   hist = std::clamp((hist + 0x20) >> 6, -0x200000, 0x1fffff);
 
-  s32 cur = (((s16)(bits << 12) >> (q & 0xf)) << 6) + hist;
+  s32 cur = (((s16)(bits << 12) >> coefficients.shift) << 6) + hist;
 
   hist2 = hist1;
   hist1 = cur;
@@ -42,6 +54,7 @@ static s16 ADPDecodeSample(s32 bits, s32 q, s32& hist1, s32& hist2)
 
   return (s16)cur;
 }
+}  // namespace
 
 void ADPCMDecoder::ResetFilter()
 {
@@ -61,12 +74,20 @@ void ADPCMDecoder::DoState(PointerWrap& p)
 
 void ADPCMDecoder::DecodeBlock(s16* pcm, const u8* adpcm)
 {
+  const Coefficients left = GetCoefficients(adpcm[0]);
+  const Coefficients right = GetCoefficients(adpcm[1]);
+  const u8* data = adpcm + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK);
+
   for (int i = 0; i < SAMPLES_PER_BLOCK; i++)
   {
-    pcm[i * 2] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] & 0xf, adpcm[0],
-                                 m_histl1, m_histl2);
-    pcm[i * 2 + 1] = ADPDecodeSample(adpcm[i + (ONE_BLOCK_SIZE - SAMPLES_PER_BLOCK)] >> 4, adpcm[1],
-                                     m_histr1, m_histr2);
+    pcm[i * 2] = Common::swap16(ADPDecodeSample(data[i] & 0xf, left, m_histl1, m_histl2));
+    pcm[i * 2 + 1] = Common::swap16(ADPDecodeSample(data[i] >> 4, right, m_histr1, m_histr2));
   }
 }
+
+void ADPCMDecoder::DecodeBlocks(s16* pcm, const u8* adpcm, size_t block_count)
+{
+  for (size_t i = 0; i < block_count; i++)
+    DecodeBlock(pcm + i * SAMPLES_PER_BLOCK * 2, adpcm + i * ONE_BLOCK_SIZE);
+}
 }  // namespace StreamADPCM
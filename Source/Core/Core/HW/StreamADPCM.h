@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "Common/CommonTypes.h"
 
 class PointerWrap;
@@ -22,7 +24,9 @@ class ADPCMDecoder
 public:
   void ResetFilter();
   void DoState(PointerWrap& p);
+  // Decodes into big endian stereo samples, which is what the mixer's streaming input takes.
   void DecodeBlock(s16* pcm, const u8* adpcm);
+  void DecodeBlocks(s16* pcm, const u8* adpcm, size_t block_count);
 
 private:
   s32 m_histl1 = 0;
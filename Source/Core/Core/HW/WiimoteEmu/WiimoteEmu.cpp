@@ -474,6 +474,21 @@ GetPassthroughCameraPoints(ControllerEmu::IRPassthrough* ir_passthrough)
   return camera_points;
 }
 
+static bool ReportingModeHasIR(InputReportID mode)
+{
+  switch (mode)
+  {
+  case InputReportID::ReportCoreAccelIR12:
+  case InputReportID::ReportCoreIR10Ext9:
+  case InputReportID::ReportCoreAccelIR10Ext6:
+  case InputReportID::ReportInterleave1:
+  case InputReportID::ReportInterleave2:
+    return true;
+  default:
+    return false;
+  }
+}
+
 void Wiimote::BuildDesiredWiimoteState(DesiredWiimoteState* target_state,
                                        SensorBarState sensor_bar_state)
 {
@@ -497,7 +512,12 @@ void Wiimote::BuildDesiredWiimoteState(DesiredWiimoteState* target_state,
       ConvertAccelData(GetTotalAcceleration(), ACCEL_ZERO_G << 2, ACCEL_ONE_G << 2);
 
   // Calculate IR camera state.
-  if (m_ir_passthrough->enabled.GetValue() && m_ir_passthrough->AreInputsBound())
+  if (!ReportingModeHasIR(m_reporting_mode))
+  {
+    // The points wouldn't be sent, so don't bother with the camera math.
+    target_state->camera_points = DesiredWiimoteState::DEFAULT_CAMERA;
+  }
+  else if (m_ir_passthrough->enabled.GetValue() && m_ir_passthrough->AreInputsBound())
   {
     target_state->camera_points = GetPassthroughCameraPoints(m_ir_passthrough);
   }
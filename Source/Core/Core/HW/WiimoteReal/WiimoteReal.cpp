@@ -207,7 +207,15 @@ void Wiimote::WriteReport(Report rpt)
   const auto report_time =
       Core::IsCPUThread() ? core_timing.GetTargetHostTime(core_timing.GetTicks()) : Clock::now();
 
-  m_write_reports.Emplace(report_time, std::move(rpt));
+  if (rpt.size() >= 2 && rpt[1] == u8(OutputReportID::SpeakerData))
+  {
+    // Not before now, so that the write thread can tell how long it waited in the queue.
+    m_speaker_reports.Emplace(std::max(report_time, Clock::now()), std::move(rpt));
+  }
+  else
+  {
+    m_write_reports.Emplace(report_time, std::move(rpt));
+  }
   m_write_event.Set();
 }
 
@@ -835,6 +843,9 @@ void Wiimote::WriteThreadFunc()
   // If we haven't written a report in some time, attempt a rumble-off report.
   // This also has a minor benefit of preventing rumble from being stuck on.
   constexpr auto WRITE_TEST_INTERVAL = std::chrono::milliseconds{1000};
+  // Speaker data that couldn't be sent in time is dropped, otherwise the delay would only grow
+  // while the link is saturated.
+  constexpr auto MAX_SPEAKER_DATA_DELAY = std::chrono::milliseconds{50};
 
   TimePoint last_write_time = Clock::now();
 
@@ -848,6 +859,19 @@ void Wiimote::WriteThreadFunc()
       write_success = Write(m_write_reports.Front());
       m_write_reports.Pop();
     }
+    else if (!m_speaker_reports.Empty())
+    {
+      const bool is_late = Clock::now() - m_speaker_reports.Front().time > MAX_SPEAKER_DATA_DELAY;
+      if (is_late)
+      {
+        DEBUG_LOG_FMT(WIIMOTE, "Dropping late speaker data for Wiimote {}.", m_index + 1);
+        m_speaker_reports.Pop();
+        continue;
+      }
+
+      write_success = Write(m_speaker_reports.Front());
+      m_speaker_reports.Pop();
+    }
     else if (Clock::now() - last_write_time >= WRITE_TEST_INTERVAL)
     {
       // We haven't written in a while, test a write so we can check for a disconnect.
@@ -167,6 +167,9 @@ private:
 
   Common::SPSCQueue<Report> m_read_reports;
   Common::SPSCQueue<TimedReport> m_write_reports;
+  // Speaker data is sent after the other reports, so that it can't hold them up when it saturates
+  // the link.
+  Common::SPSCQueue<TimedReport> m_speaker_reports;
   // Kick the write thread.
   Common::Event m_write_event;
 
@@ -32,6 +32,7 @@ enum Hotkey
   HK_CENTER_MOUSE,
   HK_ACTIVATE_CHAT,
   HK_REQUEST_GOLF_CONTROL,
+  HK_DUMP_RECENT_FRAME_TIMINGS,
 #ifdef USE_RETRO_ACHIEVEMENTS
   HK_OPEN_ACHIEVEMENTS,
 #endif  // USE_RETRO_ACHIEVEMENTS
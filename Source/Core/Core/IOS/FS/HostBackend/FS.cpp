@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <functional>
 #include <optional>
 #include <string_view>
 #include <type_traits>
@@ -150,9 +152,15 @@ HostFileSystem::HostFileSystem(const std::string& root_path,
   File::CreateFullPath(m_root_path + '/');
   ResetFst();
   LoadFst();
+  m_fst_writer.Reset("IOS FST Writer", std::bind_front(&HostFileSystem::WriteFst, this),
+                     Common::ThreadPriority::Background);
 }
 
-HostFileSystem::~HostFileSystem() = default;
+HostFileSystem::~HostFileSystem()
+{
+  // Writes the FST if it changed since the last write
+  m_fst_writer.Shutdown();
+}
 
 std::string HostFileSystem::GetFstFilePath() const
 {
@@ -218,12 +226,25 @@ void HostFileSystem::SaveFst()
   };
   collect_entries(collect_entries, m_root_entry);
 
+  std::vector<u8> serialized_fst(to_write.size() * sizeof(SerializedFstEntry));
+  std::memcpy(serialized_fst.data(), to_write.data(), serialized_fst.size());
+
+  m_pending_fst_count.fetch_add(1, std::memory_order_relaxed);
+  m_fst_writer.Push(std::move(serialized_fst));
+}
+
+void HostFileSystem::WriteFst(std::vector<u8> serialized_fst)
+{
+  // Skip this FST if a newer one is already queued
+  if (m_pending_fst_count.fetch_sub(1, std::memory_order_relaxed) != 1)
+    return;
+
   const std::string dest_path = GetFstFilePath();
   const std::string temp_path = File::GetTempFilenameForAtomicWrite(dest_path);
   {
     // This temporary file must be closed before it can be renamed.
     File::IOFile file{temp_path, "wb"};
-    if (!file.WriteArray(to_write.data(), to_write.size()))
+    if (!file.WriteBytes(serialized_fst.data(), serialized_fst.size()))
     {
       PanicAlertFmt("IOS_FS: Failed to write new FST");
       return;
@@ -369,6 +390,9 @@ void HostFileSystem::DoStateWriteOrMeasure(PointerWrap& p, std::string start_dir
 
 void HostFileSystem::DoState(PointerWrap& p)
 {
+  // The FST file is part of the NAND, which may be saved or replaced below.
+  m_fst_writer.WaitForCompletion();
+
   // Temporarily close the file, to prevent any issues with the savestating of files/folders.
   for (Handle& handle : m_handles)
     handle.host_file.reset();
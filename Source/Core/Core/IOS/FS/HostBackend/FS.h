@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -11,6 +12,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/IOS/FS/FileSystem.h"
 
 namespace IOS::HLE::FS
@@ -104,7 +106,9 @@ private:
   std::string GetFstFilePath() const;
   void ResetFst();
   void LoadFst();
+  // Serializes the FST and queues it to be written to the host on m_fst_writer.
   void SaveFst();
+  void WriteFst(std::vector<u8> serialized_fst);
   /// Get the FST entry for a file (or directory).
   /// Automatically creates fallback entries for parents if they do not exist.
   /// Returns nullptr if the path is invalid or the file does not exist.
@@ -125,6 +129,11 @@ private:
 
   FstEntry m_redirect_fst{};
   std::vector<NandRedirect> m_nand_redirects;
+
+  // Writing the FST file (atomically, through a temporary file) is slow on some hosts, and titles
+  // change metadata several times for every save. The writer only writes the newest queued FST.
+  Common::WorkQueueThreadSP<std::vector<u8>> m_fst_writer;
+  std::atomic<u64> m_pending_fst_count = 0;
 };
 
 }  // namespace IOS::HLE::FS
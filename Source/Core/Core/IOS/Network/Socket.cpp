@@ -261,7 +261,7 @@ s32 WiiSocket::FCntl(u32 cmd, u32 arg)
   return ret;
 }
 
-void WiiSocket::Update(bool read, bool write, bool except)
+void WiiSocket::Update()
 {
   auto& system = m_socket_manager.m_ios.GetSystem();
   auto& memory = system.GetMemory();
@@ -683,6 +683,8 @@ void WiiSocket::Update(bool read, bool write, bool except)
               ret, BufferOutSize2 ? "SO_RECVFROM" : "SO_RECV", true);
           if (ret > 0)
             system.GetPowerPC().GetDebugInterface().NetworkLogger()->LogRead(data, ret, fd, from);
+          else if (ret == 0 || ReturnValue == -SO_ECONNRESET)
+            system.GetPowerPC().GetDebugInterface().NetworkLogger()->OnDisconnect(fd);
 
           INFO_LOG_FMT(IOS_NET,
                        "{}({}, {}) Socket: {:08X}, Flags: {:08X}, "
@@ -997,25 +999,14 @@ void WiiSockMan::EnqueueIPCReply(const Request& request, s32 return_value) const
 
 void WiiSockMan::Update()
 {
-  s32 nfds = 0;
-  fd_set read_fds, write_fds, except_fds;
-  timeval t = {0, 0};
-  FD_ZERO(&read_fds);
-  FD_ZERO(&write_fds);
-  FD_ZERO(&except_fds);
-
-  auto socket_iter = WiiSockets.begin();
-  auto end_socks = WiiSockets.end();
-
-  while (socket_iter != end_socks)
+  // Every pending operation is simply retried, so there is no need to ask the host which sockets
+  // are ready first. That would only cost a syscall over every socket on every update.
+  for (auto socket_iter = WiiSockets.begin(); socket_iter != WiiSockets.end();)
   {
-    const WiiSocket& sock = socket_iter->second;
+    WiiSocket& sock = socket_iter->second;
     if (sock.IsValid())
     {
-      FD_SET(sock.fd, &read_fds);
-      FD_SET(sock.fd, &write_fds);
-      FD_SET(sock.fd, &except_fds);
-      nfds = std::max(nfds, sock.fd + 1);
+      sock.Update();
       ++socket_iter;
     }
     else
@@ -1024,25 +1015,6 @@ void WiiSockMan::Update()
       socket_iter = WiiSockets.erase(socket_iter);
     }
   }
-
-  const s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
-
-  if (ret >= 0)
-  {
-    for (auto& pair : WiiSockets)
-    {
-      WiiSocket& sock = pair.second;
-      sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
-                  FD_ISSET(sock.fd, &except_fds) != 0);
-    }
-  }
-  else
-  {
-    for (auto& elem : WiiSockets)
-    {
-      elem.second.Update(false, false, false);
-    }
-  }
   UpdatePollCommands();
 }
 
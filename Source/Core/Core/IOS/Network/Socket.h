@@ -222,7 +222,7 @@ private:
 
   void DoSock(Request request, NET_IOCTL type);
   void DoSock(Request request, SSL_IOCTL type);
-  void Update(bool read, bool write, bool except);
+  void Update();
   void UpdateConnectingState(s32 connect_rv);
   ConnectingState GetConnectingState() const;
   bool IsValid() const { return fd >= 0; }
@@ -3,23 +3,42 @@
 
 #include "Core/MemoryWatcher.h"
 
+#include <algorithm>
 #include <cstring>
+#include <fcntl.h>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <sstream>
+#include <sys/mman.h>
 #include <unistd.h>
 
+#include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/Swap.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 MemoryWatcher::MemoryWatcher()
 {
   m_running = false;
   if (!LoadAddresses(File::GetUserPath(F_MEMORYWATCHERLOCATIONS_IDX)))
     return;
-  if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
+  if (Config::Get(Config::MAIN_MEMORY_WATCHER_SHARED_MEMORY))
+  {
+    if (!OpenRing(File::GetUserPath(F_MEMORYWATCHERRING_IDX)))
+      return;
+  }
+  else if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
+  {
     return;
+  }
   m_running = true;
 }
 
@@ -29,7 +48,10 @@ MemoryWatcher::~MemoryWatcher()
     return;
 
   m_running = false;
-  close(m_fd);
+  if (m_ring)
+    munmap(m_ring, m_ring_size);
+  else
+    close(m_fd);
 }
 
 bool MemoryWatcher::LoadAddresses(const std::string& path)
@@ -40,22 +62,24 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
     return false;
 
   std::string line;
-  while (std::getline(locations, line))
-    ParseLine(line);
+  for (u32 line_number = 0; std::getline(locations, line); ++line_number)
+    ParseLine(line_number, line);
 
-  return !m_values.empty();
+  return !m_watches.empty();
 }
 
-void MemoryWatcher::ParseLine(const std::string& line)
+void MemoryWatcher::ParseLine(u32 line_number, const std::string& line)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
+  if (std::ranges::any_of(m_watches, [&line](const Watch& watch) { return watch.text == line; }))
+    return;
+
+  Watch& watch = m_watches.emplace_back(Watch{.line = line_number, .text = line});
 
   std::istringstream offsets(line);
   offsets >> std::hex;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+    watch.offsets.push_back(offset);
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -67,12 +91,83 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line)
+bool MemoryWatcher::OpenRing(const std::string& path)
+{
+  const int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+  {
+    ERROR_LOG_FMT(CORE, "Failed to create memory watcher ring {}", path);
+    return false;
+  }
+
+  const size_t size = sizeof(RingHeader) + RING_CAPACITY * sizeof(RingRecord);
+  void* view = MAP_FAILED;
+  if (ftruncate(fd, size) == 0)
+    view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (view == MAP_FAILED)
+  {
+    ERROR_LOG_FMT(CORE, "Failed to map memory watcher ring {}", path);
+    return false;
+  }
+
+  m_ring_size = size;
+  m_ring = std::construct_at(static_cast<RingHeader*>(view), RING_MAGIC, RING_VERSION,
+                             RING_CAPACITY, static_cast<u32>(sizeof(RingRecord)), 0);
+  m_ring_records = reinterpret_cast<RingRecord*>(m_ring + 1);
+  return true;
+}
+
+// Fixed addresses usually stay mapped by the same BAT, so the host pointer to them is kept
+// until the DBAT entry changes.
+const u8* MemoryWatcher::GetHostPointer(const Core::CPUThreadGuard& guard, Watch& watch)
+{
+  auto& system = guard.GetSystem();
+  const auto& ppc_state = system.GetPPCState();
+  if (ppc_state.m_enable_dcache || !ppc_state.msr.DR)
+    return nullptr;
+
+  const u32 address = watch.offsets.front();
+  const u32 dbat_entry = system.GetMMU().GetDBATTable()[address >> PowerPC::BAT_INDEX_SHIFT];
+  if (dbat_entry == watch.dbat_entry)
+    return watch.host;
+
+  watch.dbat_entry = dbat_entry;
+  watch.host = nullptr;
+  const u32 page_offset = address & (PowerPC::BAT_PAGE_SIZE - 1);
+  if (!(dbat_entry & PowerPC::BAT_MAPPED_BIT) || page_offset > PowerPC::BAT_PAGE_SIZE - 4)
+    return nullptr;
+
+  const u32 physical_address = (dbat_entry & PowerPC::BAT_RESULT_MASK) | page_offset;
+  auto& memory = system.GetMemory();
+  if (memory.GetRAM() && (physical_address & 0xF8000000) == 0x00000000)
+  {
+    watch.host = &memory.GetRAM()[physical_address & memory.GetRamMask()];
+  }
+  else if (memory.GetEXRAM() && (physical_address >> 28) == 0x1 &&
+           (physical_address & 0x0FFFFFFF) + 4 <= memory.GetExRamSizeReal())
+  {
+    watch.host = &memory.GetEXRAM()[physical_address & 0x0FFFFFFF];
+  }
+  return watch.host;
+}
+
+u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, Watch& watch, u32* address)
 {
   u32 value = 0;
-  for (u32 offset : m_addresses[line])
+  for (size_t i = 0; i < watch.offsets.size(); ++i)
   {
-    value = PowerPC::MMU::HostRead<u32>(guard, value + offset);
+    *address = value + watch.offsets[i];
+    const u8* host = i == 0 ? GetHostPointer(guard, watch) : nullptr;
+    if (host)
+    {
+      std::memcpy(&value, host, sizeof(value));
+      value = Common::swap32(value);
+    }
+    else
+    {
+      value = PowerPC::MMU::HostRead<u32>(guard, *address);
+    }
     if (!PowerPC::MMU::HostIsRAMAddress(guard, value))
       break;
   }
@@ -84,29 +179,54 @@ std::string MemoryWatcher::ComposeMessages(const Core::CPUThreadGuard& guard)
   std::ostringstream message_stream;
   message_stream << std::hex;
 
-  for (auto& entry : m_values)
+  for (Watch& watch : m_watches)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
-
-    u32 new_value = ChasePointer(guard, address);
-    if (new_value != current_value)
+    u32 address = 0;
+    const u32 new_value = ChasePointer(guard, watch, &address);
+    if (new_value != watch.value)
     {
       // Update the value
-      current_value = new_value;
-      message_stream << address << '\n' << new_value << '\n';
+      watch.value = new_value;
+      message_stream << watch.text << '\n' << new_value << '\n';
     }
   }
 
   return message_stream.str();
 }
 
+void MemoryWatcher::WriteRecords(const Core::CPUThreadGuard& guard)
+{
+  u64 write_count = m_ring->write_count.load(std::memory_order_relaxed);
+  for (Watch& watch : m_watches)
+  {
+    u32 address = 0;
+    const u32 new_value = ChasePointer(guard, watch, &address);
+    if (new_value == watch.value)
+      continue;
+
+    watch.value = new_value;
+    m_ring_records[write_count % RING_CAPACITY] = {watch.line, address, new_value, 0, m_frame};
+    ++write_count;
+  }
+
+  // Publishes all of this frame's records at once
+  m_ring->write_count.store(write_count, std::memory_order_release);
+}
+
 void MemoryWatcher::Step(const Core::CPUThreadGuard& guard)
 {
   if (!m_running)
     return;
 
-  std::string message = ComposeMessages(guard);
-  sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
-         sizeof(m_addr));
+  if (m_ring)
+  {
+    WriteRecords(guard);
+  }
+  else
+  {
+    std::string message = ComposeMessages(guard);
+    sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
+           sizeof(m_addr));
+  }
+  ++m_frame;
 }
@@ -5,7 +5,7 @@
 
 #include "Common/CommonTypes.h"
 
-#include <map>
+#include <atomic>
 #include <string>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -24,28 +24,79 @@ class CPUThreadGuard;
 // "ABCD EF" will watch the address at (*0xABCD) + 0xEF.
 // The output to the socket is two lines. The first is the address from the
 // input file, and the second is the new value in hex.
+//
+// With MAIN_MEMORY_WATCHER_SHARED_MEMORY, the changes are instead written as RingRecords to a
+// ring in a file that readers can map into memory as well, so that no system calls are made
+// for them. A RingHeader is at the start of the file, and the records follow it.
 class MemoryWatcher final
 {
 public:
+  static constexpr u32 RING_MAGIC = 0x52574D44;  // "DMWR"
+  static constexpr u32 RING_VERSION = 1;
+  static constexpr u32 RING_CAPACITY = 0x10000;
+
+  struct RingHeader
+  {
+    u32 magic;
+    u32 version;
+    u32 capacity;
+    u32 record_size;
+    // How many records have been written. Record n is at index n % capacity, and is complete
+    // once write_count is past it. Readers that copy records should check write_count again
+    // afterwards, since records that fell more than capacity behind it may have been overwritten.
+    std::atomic<u64> write_count;
+  };
+  static_assert(std::atomic<u64>::is_always_lock_free);
+
+  struct RingRecord
+  {
+    // The line of the input file, counting from 0.
+    u32 line;
+    // The address that was read, after following pointers.
+    u32 address;
+    u32 value;
+    u32 padding;
+    // How many frames the watcher had run for when the value changed.
+    u64 frame;
+  };
+
   MemoryWatcher();
   ~MemoryWatcher();
   void Step(const Core::CPUThreadGuard& guard);
 
 private:
+  struct Watch
+  {
+    u32 line;
+    std::string text;
+    // Offsets to follow
+    std::vector<u32> offsets;
+    u32 value = 0;
+    // Where the first offset is in host memory, and the DBAT entry it was found with.
+    const u8* host = nullptr;
+    u32 dbat_entry = 0;
+  };
+
   bool LoadAddresses(const std::string& path);
   bool OpenSocket(const std::string& path);
+  bool OpenRing(const std::string& path);
 
-  void ParseLine(const std::string& line);
-  u32 ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line);
+  void ParseLine(u32 line_number, const std::string& line);
+  const u8* GetHostPointer(const Core::CPUThreadGuard& guard, Watch& watch);
+  u32 ChasePointer(const Core::CPUThreadGuard& guard, Watch& watch, u32* address);
   std::string ComposeMessages(const Core::CPUThreadGuard& guard);
+  void WriteRecords(const Core::CPUThreadGuard& guard);
 
   bool m_running = false;
 
-  int m_fd;
+  int m_fd = -1;
   sockaddr_un m_addr{};
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  RingHeader* m_ring = nullptr;
+  RingRecord* m_ring_records = nullptr;
+  size_t m_ring_size = 0;
+  u64 m_frame = 0;
+
+  // In the order of the input file, without repeated lines
+  std::vector<Watch> m_watches;
 };
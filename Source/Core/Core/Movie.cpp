@@ -12,6 +12,7 @@
 #include <mbedtls/config.h>
 #include <mbedtls/md.h>
 #include <mutex>
+#include <span>
 #include <thread>
 #include <utility>
 #include <variant>
@@ -19,8 +20,11 @@
 
 #include <fmt/chrono.h>
 #include <fmt/format.h>
+#include <xxhash.h>
+#include <zstd.h>
 
 #include "Common/Assert.h"
+#include "Common/Buffer.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonPaths.h"
 #include "Common/Config/Config.h"
@@ -29,6 +33,7 @@
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
 #include "Common/NandPaths.h"
+#include "Common/Random.h"
 #include "Common/StringUtil.h"
 #include "Common/Timer.h"
 #include "Common/VariantUtil.h"
@@ -78,6 +83,35 @@ static bool IsMovieHeader(const std::array<u8, 4>& magic)
   return magic[0] == 'D' && magic[1] == 'T' && magic[2] == 'M' && magic[3] == 0x1A;
 }
 
+// While recording, the inputs are written here as they come instead of being kept in memory. The
+// name is picked for each recording, so that instances sharing a user directory don't overwrite
+// each other's file.
+static std::string GetInputLogSpillPath()
+{
+  return fmt::format("{}dtm.{:016x}.inputs", File::GetUserPath(D_STATESAVES_IDX),
+                     Common::Random::GenerateValue<u64>());
+}
+
+// The keyframe file of a movie starts with a KeyframeFileHeader, followed by the keyframes in
+// ascending frame order. Each keyframe is a KeyframeHeader followed by a zstd compressed savestate.
+constexpr u32 KEYFRAME_FILE_MAGIC = 0x464B5444;  // "DTKF"
+constexpr u32 KEYFRAME_FILE_VERSION = 1;
+
+struct KeyframeFileHeader
+{
+  u32 magic;
+  u32 version;
+  // Of the movie's input data and the Dolphin revision, as the keyframes are only valid for both
+  u64 hash;
+};
+
+struct KeyframeHeader
+{
+  u64 frame;
+  u32 compressed_size;
+  u32 uncompressed_size;
+};
+
 static std::array<u8, 20> ConvertGitRevisionToBytes(const std::string& revision)
 {
   std::array<u8, 20> revision_bytes{};
@@ -185,6 +219,24 @@ void MovieManager::FrameUpdate()
   }
 
   m_polled = false;
+
+  if (!IsPlayingInput())
+    return;
+
+  const u64 seek_target = m_seek_target;
+  if (seek_target != 0 && m_current_frame >= seek_target)
+  {
+    m_seek_target = 0;
+    Core::SetIsThrottlerTempDisabled(false);
+    Core::DisplayMessage(fmt::format("Seeked to frame {}", m_current_frame), 2000);
+  }
+
+  // The savestate can't be made from within the VI event, so it's left to the host thread.
+  if (Config::Get(Config::MAIN_MOVIE_SAVE_KEYFRAMES) && !m_keyframes_path.empty() &&
+      m_current_frame >= m_last_keyframe + KEYFRAME_INTERVAL && !m_keyframe_pending.exchange(true))
+  {
+    Core::QueueHostJob([this](Core::System&) { SaveKeyframe(); });
+  }
 }
 
 // called when game is booting up, even if no movie is active,
@@ -551,7 +603,8 @@ bool MovieManager::BeginRecordingInput(const ControllerTypeArray& controllers,
 
   m_play_mode = PlayMode::Recording;
   m_author = Config::Get(Config::MAIN_MOVIE_MOVIE_AUTHOR);
-  m_temp_input.clear();
+  m_input_log.Clear();
+  m_input_log.SpillTo(GetInputLogSpillPath());
 
   m_current_byte = 0;
 
@@ -826,8 +879,8 @@ void MovieManager::RecordInput(const GCPadStatus* PadStatus, int controllerID)
 
   CheckPadStatus(PadStatus, controllerID);
 
-  m_temp_input.resize(m_current_byte + sizeof(ControllerState));
-  memcpy(&m_temp_input[m_current_byte], &m_pad_state, sizeof(ControllerState));
+  m_input_log.Truncate(m_current_byte);
+  m_input_log.Append({reinterpret_cast<const u8*>(&m_pad_state), sizeof(ControllerState)});
   m_current_byte += sizeof(ControllerState);
 }
 
@@ -855,10 +908,10 @@ void MovieManager::RecordWiimote(int wiimote, const SerializedWiimoteState& seri
   InputUpdate();
 
   const u8 size = serialized_state.length;
-  m_temp_input.resize(m_current_byte + size + 1);
-  m_temp_input[m_current_byte++] = size;
-  std::copy_n(serialized_state.data.data(), size, m_temp_input.data() + m_current_byte);
-  m_current_byte += size;
+  m_input_log.Truncate(m_current_byte);
+  m_input_log.Append({&size, 1});
+  m_input_log.Append({serialized_state.data.data(), size});
+  m_current_byte += size + 1;
 }
 
 // NOTE: EmuThread / Host Thread
@@ -900,6 +953,17 @@ void MovieManager::ReadHeader()
   m_dsp_coef_hash = m_temp_header.DSPcoefHash;
 }
 
+// The inputs follow the header, either as they are or in the chunks of InputLog.
+bool MovieManager::ReadInputs(File::IOFile& file, const DTMHeader& header, InputLog* log)
+{
+  const u64 size = file.GetSize();
+  if (size < sizeof(DTMHeader) || !file.Seek(sizeof(DTMHeader), File::SeekOrigin::Begin))
+    return false;
+
+  return header.bEncodedInputs ? log->ReadEncoded(file, size - sizeof(DTMHeader)) :
+                                 log->ReadRaw(file, size - sizeof(DTMHeader));
+}
+
 // NOTE: Host Thread
 bool MovieManager::PlayInput(const std::string& movie_path,
                              std::optional<std::string>* savestate_path)
@@ -922,6 +986,16 @@ bool MovieManager::PlayInput(const std::string& movie_path,
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
     return false;
 
+  m_input_log.Clear();
+  if (!ReadInputs(recording_file, m_temp_header, &m_input_log))
+  {
+    PanicAlertFmtT("Invalid recording file");
+    m_input_log.Clear();
+    return false;
+  }
+  m_current_byte = 0;
+  recording_file.Close();
+
   m_total_frames = m_temp_header.frameCount;
   m_total_lag_count = m_temp_header.lagCount;
   m_total_input_count = m_temp_header.inputCount;
@@ -937,10 +1011,7 @@ bool MovieManager::PlayInput(const std::string& movie_path,
 
   Core::UpdateWantDeterminism(m_system);
 
-  m_temp_input.resize(recording_file.GetSize() - 256);
-  recording_file.ReadBytes(m_temp_input.data(), m_temp_input.size());
-  m_current_byte = 0;
-  recording_file.Close();
+  LoadKeyframes(movie_path);
 
   // Load savestate (and skip to frame data)
   if (m_temp_header.bFromSaveState && savestate_path)
@@ -1015,7 +1086,14 @@ void MovieManager::LoadInput(const std::string& movie_path)
   if (m_system.IsWii())
     ChangeWiiPads(true);
 
-  u64 totalSavedBytes = t_record.GetSize() - 256;
+  InputLog saved_input;
+  if (!ReadInputs(t_record, m_temp_header, &saved_input))
+  {
+    PanicAlertFmtT("Savestate movie {0} is corrupted, movie recording stopping...", movie_path);
+    EndPlayInput(false);
+    return;
+  }
+  const u64 totalSavedBytes = saved_input.GetSize();
 
   bool afterEnd = false;
   // This can only happen if the user manually deletes data from the dtm.
@@ -1028,42 +1106,40 @@ void MovieManager::LoadInput(const std::string& movie_path)
     afterEnd = true;
   }
 
-  if (!m_read_only || m_temp_input.empty())
+  if (!m_read_only || m_input_log.IsEmpty())
   {
     m_total_frames = m_temp_header.frameCount;
     m_total_lag_count = m_temp_header.lagCount;
     m_total_input_count = m_temp_header.inputCount;
     m_total_tick_count = m_tick_count_at_last_input = m_temp_header.tickCount;
 
-    m_temp_input.resize(static_cast<size_t>(totalSavedBytes));
-    t_record.ReadBytes(m_temp_input.data(), m_temp_input.size());
+    m_input_log = std::move(saved_input);
+    if (!m_read_only)
+      m_input_log.SpillTo(GetInputLogSpillPath());
   }
   else if (m_current_byte > 0)
   {
     if (m_current_byte > totalSavedBytes)
     {
     }
-    else if (m_current_byte > m_temp_input.size())
+    else if (m_current_byte > m_input_log.GetSize())
     {
       afterEnd = true;
       PanicAlertFmtT(
           "Warning: You loaded a save that's after the end of the current movie. (byte {0} "
           "> {1}) (input {2} > {3}). You should load another save before continuing, or load "
           "this state with read-only mode off.",
-          m_current_byte + 256, m_temp_input.size() + 256, m_current_input_count,
+          m_current_byte + 256, m_input_log.GetSize() + 256, m_current_input_count,
           m_total_input_count);
     }
-    else if (m_current_byte > 0 && !m_temp_input.empty())
+    else if (m_current_byte > 0 && !m_input_log.IsEmpty())
     {
       // verify identical from movie start to the save's current frame
-      std::vector<u8> movInput(m_current_byte);
-      t_record.ReadArray(movInput.data(), movInput.size());
-
-      const auto mismatch_result = std::ranges::mismatch(movInput, m_temp_input);
+      const std::optional<u64> mismatch = saved_input.FindMismatch(m_input_log, m_current_byte);
 
-      if (mismatch_result.in1 != movInput.end())
+      if (mismatch)
       {
-        const ptrdiff_t mismatch_index = std::distance(movInput.begin(), mismatch_result.in1);
+        const u64 mismatch_index = *mismatch;
 
         // this is a "you did something wrong" alert for the user's benefit.
         // we'll try to say what's going on in excruciating detail, otherwise the user might not
@@ -1078,16 +1154,21 @@ void MovieManager::LoadInput(const std::string& movie_path)
                          "read-only mode off. Otherwise you'll probably get a desync.",
                          byte_offset, byte_offset);
 
-          std::ranges::copy(movInput, m_temp_input.begin());
+          InputLog merged_input;
+          merged_input.AppendFrom(saved_input, 0, m_current_byte);
+          merged_input.AppendFrom(m_input_log, m_current_byte,
+                                  m_input_log.GetSize() - m_current_byte);
+          m_input_log = std::move(merged_input);
         }
         else
         {
-          const ptrdiff_t frame = mismatch_index / sizeof(ControllerState);
-          ControllerState curPadState;
-          memcpy(&curPadState, &m_temp_input[frame * sizeof(ControllerState)],
-                 sizeof(ControllerState));
-          ControllerState movPadState;
-          memcpy(&movPadState, &movInput[frame * sizeof(ControllerState)], sizeof(ControllerState));
+          const u64 frame = mismatch_index / sizeof(ControllerState);
+          ControllerState curPadState{};
+          m_input_log.Read(frame * sizeof(ControllerState),
+                           {reinterpret_cast<u8*>(&curPadState), sizeof(ControllerState)});
+          ControllerState movPadState{};
+          saved_input.Read(frame * sizeof(ControllerState),
+                           {reinterpret_cast<u8*>(&movPadState), sizeof(ControllerState)});
           PanicAlertFmtT(
               "Warning: You loaded a save whose movie mismatches on frame {0}. You should load "
               "another save before continuing, or load this state with read-only mode off. "
@@ -1152,7 +1233,7 @@ void MovieManager::LoadInput(const std::string& movie_path)
 // NOTE: CPU Thread
 void MovieManager::CheckInputEnd()
 {
-  if (m_current_byte >= m_temp_input.size() ||
+  if (m_current_byte >= m_input_log.GetSize() ||
       (m_system.GetCoreTiming().GetTicks() > m_total_tick_count &&
        !IsRecordingInputFromSaveState()))
   {
@@ -1165,18 +1246,17 @@ void MovieManager::PlayController(GCPadStatus* PadStatus, int controllerID)
 {
   // Correct playback is entirely dependent on the emulator polling the controllers
   // in the same order done during recording
-  if (!IsPlayingInput() || !IsUsingPad(controllerID) || m_temp_input.empty())
+  if (!IsPlayingInput() || !IsUsingPad(controllerID) || m_input_log.IsEmpty())
     return;
 
-  if (m_current_byte + sizeof(ControllerState) > m_temp_input.size())
+  if (!m_input_log.Read(m_current_byte,
+                        {reinterpret_cast<u8*>(&m_pad_state), sizeof(ControllerState)}))
   {
     PanicAlertFmtT("Premature movie end in PlayController. {0} + {1} > {2}", m_current_byte,
-                   sizeof(ControllerState), m_temp_input.size());
+                   sizeof(ControllerState), m_input_log.GetSize());
     EndPlayInput(!m_read_only);
     return;
   }
-
-  memcpy(&m_pad_state, &m_temp_input[m_current_byte], sizeof(ControllerState));
   m_current_byte += sizeof(ControllerState);
 
   PadStatus->isConnected = m_pad_state.is_connected;
@@ -1255,20 +1335,18 @@ void MovieManager::PlayController(GCPadStatus* PadStatus, int controllerID)
 // NOTE: CPU Thread
 bool MovieManager::PlayWiimote(int wiimote, DesiredWiimoteState* desired_state)
 {
-  if (!IsPlayingInput() || !IsUsingWiimote(wiimote) || m_temp_input.empty())
+  if (!IsPlayingInput() || !IsUsingWiimote(wiimote) || m_input_log.IsEmpty())
     return false;
 
-  if (m_current_byte + sizeof(u8) > m_temp_input.size())
+  SerializedWiimoteState serialized;
+  if (!m_input_log.Read(m_current_byte, {&serialized.length, 1}))
   {
     PanicAlertFmtT("Premature movie end in PlayWiimote. {0} + 1 > {1}", m_current_byte,
-                   m_temp_input.size());
+                   m_input_log.GetSize());
     EndPlayInput(!m_read_only);
     return false;
   }
 
-  SerializedWiimoteState serialized;
-  serialized.length = m_temp_input[m_current_byte];
-
   if (serialized.length > serialized.data.size())
   {
     PanicAlertFmtT("Invalid serialized length:{0} in PlayWiimote. byte:{1}", int(serialized.length),
@@ -1278,15 +1356,14 @@ bool MovieManager::PlayWiimote(int wiimote, DesiredWiimoteState* desired_state)
   }
 
   ++m_current_byte;
-  if (m_current_byte + serialized.length > m_temp_input.size())
+  if (!m_input_log.Read(m_current_byte, {serialized.data.data(), serialized.length}))
   {
     PanicAlertFmtT("Premature movie end in PlayWiimote. {0} + {1} > {2}", m_current_byte,
-                   int(serialized.length), m_temp_input.size());
+                   int(serialized.length), m_input_log.GetSize());
     EndPlayInput(!m_read_only);
     return false;
   }
 
-  std::copy_n(m_temp_input.data() + m_current_byte, serialized.length, serialized.data.data());
   if (!WiimoteEmu::DeserializeDesiredState(desired_state, serialized))
   {
     PanicAlertFmtT("Aborting playback. Error in DeserializeDesiredState. byte:{0}{1}",
@@ -1309,6 +1386,9 @@ bool MovieManager::PlayWiimote(int wiimote, DesiredWiimoteState* desired_state)
 // NOTE: Host / EmuThread / CPU Thread
 void MovieManager::EndPlayInput(bool cont)
 {
+  if (m_seek_target.exchange(0) != 0)
+    Core::SetIsThrottlerTempDisabled(false);
+
   if (cont)
   {
     // If !IsMovieActive(), changing m_play_mode requires calling UpdateWantDeterminism
@@ -1386,6 +1466,7 @@ void MovieManager::SaveRecording(const std::string& filename)
   header.DSPiromHash = m_dsp_irom_hash;
   header.DSPcoefHash = m_dsp_coef_hash;
   header.tickCount = m_total_tick_count;
+  header.bEncodedInputs = Config::Get(Config::MAIN_MOVIE_ENCODE_INPUTS);
 
   // TODO
   header.uniqueID = 0;
@@ -1393,7 +1474,8 @@ void MovieManager::SaveRecording(const std::string& filename)
 
   save_record.WriteArray(&header, 1);
 
-  bool success = save_record.WriteBytes(m_temp_input.data(), m_temp_input.size());
+  bool success = header.bEncodedInputs ? m_input_log.WriteEncoded(save_record) :
+                                         m_input_log.WriteRaw(save_record);
 
   if (success && m_recording_from_save_state)
   {
@@ -1520,9 +1602,169 @@ void MovieManager::GetMD5()
 }
 
 // NOTE: EmuThread
+// NOTE: Host Thread
+void MovieManager::LoadKeyframes(const std::string& movie_path)
+{
+  const std::string& revision = Common::GetScmRevGitStr();
+  m_keyframes_path = movie_path + ".keyframes";
+  m_keyframes_hash = m_input_log.GetHash(XXH3_64bits(revision.data(), revision.size()));
+  m_keyframes.clear();
+  m_last_keyframe = 0;
+  m_keyframe_pending = false;
+
+  // A file that doesn't match is overwritten once the first keyframe is saved.
+  File::IOFile file(m_keyframes_path, "rb");
+  KeyframeFileHeader header;
+  if (!file.ReadArray(&header, 1) || header.magic != KEYFRAME_FILE_MAGIC ||
+      header.version != KEYFRAME_FILE_VERSION || header.hash != m_keyframes_hash)
+  {
+    return;
+  }
+
+  // Anything after a truncated keyframe, if saving one was interrupted, is ignored.
+  const u64 file_size = file.GetSize();
+  KeyframeHeader keyframe;
+  while (file.ReadArray(&keyframe, 1))
+  {
+    const u64 offset = file.Tell();
+    if (keyframe.compressed_size > file_size - offset ||
+        (!m_keyframes.empty() && keyframe.frame <= m_keyframes.back().frame) ||
+        !file.Seek(keyframe.compressed_size, File::SeekOrigin::Current))
+    {
+      break;
+    }
+    m_keyframes.push_back(
+        {keyframe.frame, offset, keyframe.compressed_size, keyframe.uncompressed_size});
+  }
+
+  if (!m_keyframes.empty())
+    m_last_keyframe = m_keyframes.back().frame;
+}
+
+// NOTE: Host Thread
+void MovieManager::SaveKeyframe()
+{
+  u64 frame = 0;
+  Common::UniqueBuffer<u8> state;
+  Core::RunOnCPUThread(
+      m_system,
+      [&] {
+        if (!IsPlayingInput())
+          return;
+        frame = m_current_frame;
+        State::SaveToBuffer(m_system, state);
+      },
+      true);
+
+  if (frame == 0 || state.empty())
+  {
+    m_keyframe_pending = false;
+    return;
+  }
+
+  // Even if this fails, it isn't retried until the next interval.
+  m_last_keyframe = frame;
+  m_keyframe_pending = false;
+
+  // Keyframes are only appended, after seeking back they are saved again once playback has passed
+  // the last one.
+  if (!m_keyframes.empty() && frame <= m_keyframes.back().frame)
+    return;
+
+  std::vector<u8> compressed(ZSTD_compressBound(state.size()));
+  const size_t compressed_size =
+      ZSTD_compress(compressed.data(), compressed.size(), state.data(), state.size(), 1);
+  if (ZSTD_isError(compressed_size))
+    return;
+
+  File::IOFile file;
+  u64 offset;
+  if (m_keyframes.empty())
+  {
+    const KeyframeFileHeader header{KEYFRAME_FILE_MAGIC, KEYFRAME_FILE_VERSION, m_keyframes_hash};
+    offset = sizeof(header);
+    if (!file.Open(m_keyframes_path, "wb") || !file.WriteArray(&header, 1))
+      return;
+  }
+  else
+  {
+    offset = m_keyframes.back().offset + m_keyframes.back().compressed_size;
+    if (!file.Open(m_keyframes_path, "r+b") || !file.Seek(offset, File::SeekOrigin::Begin))
+      return;
+  }
+
+  const KeyframeHeader header{frame, static_cast<u32>(compressed_size),
+                              static_cast<u32>(state.size())};
+  offset += sizeof(header);
+  if (!file.WriteArray(&header, 1) || !file.WriteBytes(compressed.data(), compressed_size) ||
+      (file.GetSize() > offset + compressed_size && !file.Resize(offset + compressed_size)))
+  {
+    Core::DisplayMessage("Failed to save movie keyframe", 2000);
+    return;
+  }
+
+  m_keyframes.push_back({frame, offset, header.compressed_size, header.uncompressed_size});
+}
+
+// NOTE: Host Thread
+bool MovieManager::SeekToFrame(u64 frame)
+{
+  if (!IsPlayingInput() || !m_read_only)
+  {
+    Core::DisplayMessage("Seeking is only possible while playing back in read-only mode", 2000);
+    return false;
+  }
+  if (frame > m_total_frames)
+    return false;
+
+  const u64 current_frame = m_current_frame;
+  const auto it = std::ranges::upper_bound(m_keyframes, frame, {}, &Keyframe::frame);
+  const Keyframe* keyframe = it != m_keyframes.begin() ? &*std::prev(it) : nullptr;
+
+  // Playing on is faster unless there's a keyframe between the current frame and the target.
+  if (frame >= current_frame && (!keyframe || keyframe->frame <= current_frame))
+  {
+    keyframe = nullptr;
+  }
+  else if (!keyframe)
+  {
+    Core::DisplayMessage(fmt::format("There is no keyframe before frame {}", frame), 2000);
+    return false;
+  }
+
+  if (keyframe)
+  {
+    std::vector<u8> compressed(keyframe->compressed_size);
+    Common::UniqueBuffer<u8> state(keyframe->uncompressed_size);
+    File::IOFile file(m_keyframes_path, "rb");
+    if (!file.Seek(keyframe->offset, File::SeekOrigin::Begin) ||
+        !file.ReadBytes(compressed.data(), compressed.size()) ||
+        ZSTD_decompress(state.data(), state.size(), compressed.data(), compressed.size()) !=
+            state.size() ||
+        !State::LoadFromSpan(m_system, std::span<const u8>(state.data(), state.size())))
+    {
+      Core::DisplayMessage(fmt::format("Failed to load the keyframe of frame {}", keyframe->frame),
+                           2000);
+      return false;
+    }
+  }
+
+  if (m_current_frame >= frame)
+  {
+    Core::DisplayMessage(fmt::format("Seeked to frame {}", m_current_frame), 2000);
+    return true;
+  }
+
+  Core::SetIsThrottlerTempDisabled(true);
+  m_seek_target = frame;
+  return true;
+}
+
 void MovieManager::Shutdown()
 {
   m_current_input_count = m_total_input_count = m_total_frames = m_tick_count_at_last_input = 0;
-  m_temp_input.clear();
+  m_input_log.Clear();
+  m_keyframes_path.clear();
+  m_keyframes.clear();
 }
 }  // namespace Movie
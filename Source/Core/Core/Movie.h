@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstring>
 #include <mutex>
 #include <optional>
@@ -13,6 +14,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Core/HW/WiimoteEmu/DesiredWiimoteState.h"
+#include "Core/MovieInputLog.h"
 
 struct BootParameters;
 
@@ -134,7 +136,8 @@ struct DTMHeader
   u8 GBAControllers;                // GBA Controllers plugged in (the bits are ports 1-4)
   bool bWidescreen;                 // true indicates SYSCONF aspect ratio is 16:9, false for 4:3
   u8 countryCode;                   // SYSCONF country code
-  std::array<u8, 5> reserved;       // Padding for any new config options
+  bool bEncodedInputs;              // The inputs are in the chunks of Movie::InputLog
+  std::array<u8, 4> reserved;       // Padding for any new config options
   std::array<char, 40> discChange;  // Name of iso file to switch to, for two disc games.
   std::array<u8, 20> revision;      // Git hash
   u32 DSPiromHash;
@@ -224,7 +227,28 @@ public:
   std::string GetRTCDisplay() const;
   std::string GetRerecords() const;
 
+  // Jumps to the given frame of the movie that is being played back, by loading the last keyframe
+  // saved before it and fast-forwarding from there. Keyframes are savestates that are written to
+  // a file next to the movie during playback if MAIN_MOVIE_SAVE_KEYFRAMES is set, so only the
+  // parts of the movie that have been played back with it set before can be seeked to.
+  bool SeekToFrame(u64 frame);
+
 private:
+  // About a minute at 60 frames per second.
+  static constexpr u64 KEYFRAME_INTERVAL = 3600;
+
+  struct Keyframe
+  {
+    u64 frame;
+    u64 offset;
+    u32 compressed_size;
+    u32 uncompressed_size;
+  };
+
+  static bool ReadInputs(File::IOFile& file, const DTMHeader& header, InputLog* log);
+  void LoadKeyframes(const std::string& movie_path);
+  void SaveKeyframe();
+
   void GetSettings();
   void CheckInputEnd();
 
@@ -239,7 +263,7 @@ private:
   std::array<bool, 4> m_wiimotes{};
   ControllerState m_pad_state{};
   DTMHeader m_temp_header{};
-  std::vector<u8> m_temp_input;
+  InputLog m_input_log;
   u64 m_current_byte = 0;
   u64 m_current_frame = 0;
   u64 m_total_frames = 0;  // VI
@@ -269,6 +293,14 @@ private:
 
   std::string m_current_file_name;
 
+  // Owned by the host thread, apart from the atomics.
+  std::string m_keyframes_path;
+  u64 m_keyframes_hash = 0;
+  std::vector<Keyframe> m_keyframes;
+  std::atomic<u64> m_last_keyframe = 0;
+  std::atomic<bool> m_keyframe_pending = false;
+  std::atomic<u64> m_seek_target = 0;
+
   // m_input_display is used by both CPU and GPU (is mutable).
   std::mutex m_input_display_lock;
   std::array<std::string, 8> m_input_display;
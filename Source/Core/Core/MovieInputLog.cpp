@@ -0,0 +1,469 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/MovieInputLog.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <xxh3.h>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+
+namespace Movie
+{
+namespace
+{
+constexpr u8 ZERO_RUN = 0x80;
+constexpr size_t MAX_RUN = 0x80;
+
+// Returns the size of the encoding, and writes it to out unless it's null.
+size_t Encode(std::span<const u8> data, u8 distance, std::vector<u8>* out)
+{
+  const auto delta = [&](size_t i) -> u8 {
+    return distance != 0 && i >= distance ? data[i] ^ data[i - distance] : data[i];
+  };
+
+  size_t encoded_size = 0;
+  size_t i = 0;
+  while (i < data.size())
+  {
+    size_t zeros = 0;
+    while (i + zeros < data.size() && zeros < MAX_RUN && delta(i + zeros) == 0)
+      ++zeros;
+    if (zeros != 0)
+    {
+      if (out)
+        out->push_back(static_cast<u8>(ZERO_RUN + zeros - 1));
+      ++encoded_size;
+      i += zeros;
+      continue;
+    }
+
+    // A single zero is cheaper to keep in the literal than to end it for.
+    const size_t start = i;
+    while (i < data.size() && i - start < MAX_RUN &&
+           !(delta(i) == 0 && i + 1 < data.size() && delta(i + 1) == 0))
+    {
+      ++i;
+    }
+    if (out)
+    {
+      out->push_back(static_cast<u8>(i - start - 1));
+      for (size_t j = start; j < i; ++j)
+        out->push_back(delta(j));
+    }
+    encoded_size += 1 + i - start;
+  }
+  return encoded_size;
+}
+}  // namespace
+
+std::vector<u8> EncodeChunk(std::span<const u8> data, u8 distance)
+{
+  std::vector<u8> encoded;
+  Encode(data, distance, &encoded);
+  return encoded;
+}
+
+std::optional<std::vector<u8>> DecodeChunk(std::span<const u8> encoded, u8 distance, u32 size)
+{
+  std::vector<u8> data;
+  data.reserve(size);
+  for (size_t i = 0; i < encoded.size();)
+  {
+    const u8 token = encoded[i++];
+    const size_t count = (token & ~ZERO_RUN) + size_t{1};
+    if (data.size() + count > size)
+      return std::nullopt;
+
+    if (token & ZERO_RUN)
+    {
+      data.insert(data.end(), count, 0);
+    }
+    else
+    {
+      if (i + count > encoded.size())
+        return std::nullopt;
+      data.insert(data.end(), encoded.begin() + i, encoded.begin() + i + count);
+      i += count;
+    }
+  }
+
+  if (data.size() != size)
+    return std::nullopt;
+
+  if (distance != 0)
+  {
+    for (size_t i = distance; i < data.size(); ++i)
+      data[i] ^= data[i - distance];
+  }
+  return data;
+}
+
+u8 FindDeltaDistance(std::span<const u8> data)
+{
+  u8 best_distance = 0;
+  size_t best_size = Encode(data, 0, nullptr);
+  for (u8 distance = 1; distance <= MAX_DELTA_DISTANCE; ++distance)
+  {
+    const size_t size = Encode(data, distance, nullptr);
+    if (size < best_size)
+    {
+      best_distance = distance;
+      best_size = size;
+    }
+  }
+  return best_distance;
+}
+
+InputLog::InputLog(InputLog&& other) noexcept
+{
+  *this = std::move(other);
+}
+
+InputLog& InputLog::operator=(InputLog&& other) noexcept
+{
+  if (this == &other)
+    return *this;
+
+  Clear();
+  m_chunks = std::exchange(other.m_chunks, {});
+  m_tail = std::exchange(other.m_tail, {});
+  m_spill_path = std::exchange(other.m_spill_path, {});
+  m_spill_file = std::move(other.m_spill_file);
+  m_spill_end = std::exchange(other.m_spill_end, 0);
+  m_cached_index = std::exchange(other.m_cached_index, std::nullopt);
+  m_cached = std::exchange(other.m_cached, {});
+  return *this;
+}
+
+InputLog::~InputLog()
+{
+  Clear();
+}
+
+void InputLog::Clear()
+{
+  m_chunks.clear();
+  m_tail.clear();
+  m_cached_index.reset();
+  m_cached.clear();
+
+  m_spill_file.Close();
+  m_spill_end = 0;
+  if (!m_spill_path.empty())
+  {
+    File::Delete(m_spill_path);
+    m_spill_path.clear();
+  }
+}
+
+void InputLog::Append(std::span<const u8> data)
+{
+  while (!data.empty())
+  {
+    const size_t count = std::min<size_t>(CHUNK_SIZE - m_tail.size(), data.size());
+    m_tail.insert(m_tail.end(), data.begin(), data.begin() + count);
+    data = data.subspan(count);
+    if (m_tail.size() == CHUNK_SIZE)
+      SealTail();
+  }
+}
+
+bool InputLog::AppendFrom(InputLog& other, u64 offset, u64 size)
+{
+  std::vector<u8> buffer(CHUNK_SIZE);
+  while (size != 0)
+  {
+    const size_t count = static_cast<size_t>(std::min<u64>(size, CHUNK_SIZE));
+    if (!other.Read(offset, {buffer.data(), count}))
+      return false;
+    Append({buffer.data(), count});
+    offset += count;
+    size -= count;
+  }
+  return true;
+}
+
+void InputLog::Truncate(u64 size)
+{
+  if (size >= GetSize())
+    return;
+
+  const size_t index = static_cast<size_t>(size / CHUNK_SIZE);
+  if (index < m_chunks.size())
+  {
+    if (const std::vector<u8>* decoded = GetDecoded(index))
+    {
+      m_tail = *decoded;
+    }
+    else
+    {
+      ERROR_LOG_FMT(CORE, "Failed to read the movie inputs back from {}", m_spill_path);
+      m_tail.assign(CHUNK_SIZE, 0);
+    }
+
+    // What was spilled after the chunks that are kept is written over.
+    const auto spilled =
+        std::ranges::find_if(m_chunks.begin() + index, m_chunks.end(),
+                             [](const Chunk& chunk) { return chunk.spill_offset.has_value(); });
+    if (spilled != m_chunks.end())
+    {
+      m_spill_end = *spilled->spill_offset;
+      m_spill_file.Resize(m_spill_end);
+    }
+
+    m_chunks.erase(m_chunks.begin() + index, m_chunks.end());
+    if (m_cached_index >= index)
+      m_cached_index.reset();
+  }
+
+  m_tail.resize(static_cast<size_t>(size - u64{CHUNK_SIZE} * index));
+}
+
+bool InputLog::Read(u64 offset, std::span<u8> out)
+{
+  if (offset > GetSize() || out.size() > GetSize() - offset)
+    return false;
+
+  while (!out.empty())
+  {
+    const size_t index = static_cast<size_t>(offset / CHUNK_SIZE);
+    const size_t begin = static_cast<size_t>(offset % CHUNK_SIZE);
+    const std::vector<u8>* chunk = index < m_chunks.size() ? GetDecoded(index) : &m_tail;
+    if (!chunk)
+      return false;
+
+    const size_t count = std::min(chunk->size() - begin, out.size());
+    std::copy_n(chunk->data() + begin, count, out.data());
+    out = out.subspan(count);
+    offset += count;
+  }
+  return true;
+}
+
+std::optional<u64> InputLog::FindMismatch(InputLog& other, u64 size)
+{
+  std::vector<u8> buffer(CHUNK_SIZE);
+  std::vector<u8> other_buffer(CHUNK_SIZE);
+  for (u64 offset = 0; offset < size; offset += CHUNK_SIZE)
+  {
+    const size_t count = static_cast<size_t>(std::min<u64>(size - offset, CHUNK_SIZE));
+    if (!Read(offset, {buffer.data(), count}) || !other.Read(offset, {other_buffer.data(), count}))
+      return offset;
+
+    const u8* const begin = buffer.data();
+    const u8* const it = std::mismatch(begin, begin + count, other_buffer.data()).first;
+    if (it != begin + count)
+      return offset + (it - begin);
+  }
+  return std::nullopt;
+}
+
+u64 InputLog::GetHash(u64 seed)
+{
+  XXH3_state_t state;
+  XXH3_INITSTATE(&state);
+  XXH3_64bits_reset_withSeed(&state, seed);
+  for (size_t i = 0; i < m_chunks.size(); ++i)
+  {
+    if (const std::vector<u8>* decoded = GetDecoded(i))
+      XXH3_64bits_update(&state, decoded->data(), decoded->size());
+  }
+  XXH3_64bits_update(&state, m_tail.data(), m_tail.size());
+  return XXH3_64bits_digest(&state);
+}
+
+bool InputLog::SpillTo(const std::string& path)
+{
+  if (m_spill_path == path)
+    return true;
+
+  File::IOFile file(path, "w+b");
+  if (!file.IsOpen())
+    return false;
+
+  for (Chunk& chunk : m_chunks)
+  {
+    if (!chunk.spill_offset)
+      continue;
+    chunk.encoded = GetEncoded(chunk).value_or(std::vector<u8>{});
+    chunk.spill_offset.reset();
+  }
+  m_spill_file.Close();
+  if (!m_spill_path.empty())
+    File::Delete(m_spill_path);
+
+  m_spill_path = path;
+  m_spill_file = std::move(file);
+  m_spill_end = 0;
+  for (Chunk& chunk : m_chunks)
+    SpillChunk(chunk);
+  return true;
+}
+
+bool InputLog::WriteRaw(File::IOFile& file)
+{
+  for (size_t i = 0; i < m_chunks.size(); ++i)
+  {
+    const std::vector<u8>* decoded = GetDecoded(i);
+    if (!decoded || !file.WriteBytes(decoded->data(), decoded->size()))
+      return false;
+  }
+  return file.WriteBytes(m_tail.data(), m_tail.size());
+}
+
+bool InputLog::WriteEncoded(File::IOFile& file)
+{
+  for (const Chunk& chunk : m_chunks)
+  {
+    const std::optional<std::vector<u8>> encoded = GetEncoded(chunk);
+    const ChunkHeader header{CHUNK_SIZE, chunk.encoded_size, chunk.distance};
+    if (!encoded || !file.WriteArray(&header, 1) ||
+        !file.WriteBytes(encoded->data(), encoded->size()))
+    {
+      return false;
+    }
+  }
+
+  if (m_tail.empty())
+    return true;
+
+  const u8 distance = FindDeltaDistance(m_tail);
+  const std::vector<u8> encoded = EncodeChunk(m_tail, distance);
+  const ChunkHeader header{static_cast<u32>(m_tail.size()), static_cast<u32>(encoded.size()),
+                           distance};
+  return file.WriteArray(&header, 1) && file.WriteBytes(encoded.data(), encoded.size());
+}
+
+bool InputLog::ReadRaw(File::IOFile& file, u64 size)
+{
+  ClearData();
+
+  std::vector<u8> buffer(CHUNK_SIZE);
+  while (size != 0)
+  {
+    const size_t count = static_cast<size_t>(std::min<u64>(size, CHUNK_SIZE));
+    if (!file.ReadBytes(buffer.data(), count))
+      return false;
+    Append({buffer.data(), count});
+    size -= count;
+  }
+  return true;
+}
+
+bool InputLog::ReadEncoded(File::IOFile& file, u64 size)
+{
+  ClearData();
+
+  while (size != 0)
+  {
+    ChunkHeader header;
+    if (size < sizeof(header) || !file.ReadArray(&header, 1))
+      return false;
+    size -= sizeof(header);
+
+    // Only the last chunk can be smaller than CHUNK_SIZE.
+    if (header.encoded_size > size || header.size > CHUNK_SIZE ||
+        header.distance > MAX_DELTA_DISTANCE || !m_tail.empty())
+    {
+      return false;
+    }
+
+    std::vector<u8> encoded(header.encoded_size);
+    if (!file.ReadBytes(encoded.data(), encoded.size()))
+      return false;
+    size -= header.encoded_size;
+
+    std::optional<std::vector<u8>> decoded = DecodeChunk(encoded, header.distance, header.size);
+    if (!decoded)
+      return false;
+
+    if (header.size != CHUNK_SIZE)
+    {
+      m_tail = std::move(*decoded);
+      continue;
+    }
+
+    Chunk chunk{header.encoded_size, header.distance, std::nullopt, std::move(encoded)};
+    if (m_spill_file.IsOpen())
+      SpillChunk(chunk);
+    m_chunks.push_back(std::move(chunk));
+  }
+  return true;
+}
+
+void InputLog::ClearData()
+{
+  m_chunks.clear();
+  m_tail.clear();
+  m_cached_index.reset();
+  m_spill_end = 0;
+}
+
+void InputLog::SealTail()
+{
+  Chunk chunk;
+  chunk.distance = FindDeltaDistance(m_tail);
+  chunk.encoded = EncodeChunk(m_tail, chunk.distance);
+  chunk.encoded_size = static_cast<u32>(chunk.encoded.size());
+  if (m_spill_file.IsOpen())
+    SpillChunk(chunk);
+
+  m_chunks.push_back(std::move(chunk));
+  m_tail.clear();
+}
+
+// If the chunk can't be written, it's kept in memory instead.
+bool InputLog::SpillChunk(Chunk& chunk)
+{
+  const ChunkHeader header{CHUNK_SIZE, chunk.encoded_size, chunk.distance};
+  if (!m_spill_file.Seek(m_spill_end, File::SeekOrigin::Begin) ||
+      !m_spill_file.WriteArray(&header, 1) ||
+      !m_spill_file.WriteBytes(chunk.encoded.data(), chunk.encoded.size()))
+  {
+    ERROR_LOG_FMT(CORE, "Failed to write the movie inputs to {}", m_spill_path);
+    return false;
+  }
+
+  chunk.spill_offset = m_spill_end;
+  m_spill_end += sizeof(header) + chunk.encoded_size;
+  chunk.encoded = {};
+  return true;
+}
+
+std::optional<std::vector<u8>> InputLog::GetEncoded(const Chunk& chunk)
+{
+  if (!chunk.spill_offset)
+    return chunk.encoded;
+
+  std::vector<u8> encoded(chunk.encoded_size);
+  if (!m_spill_file.Seek(*chunk.spill_offset + sizeof(ChunkHeader), File::SeekOrigin::Begin) ||
+      !m_spill_file.ReadBytes(encoded.data(), encoded.size()))
+  {
+    return std::nullopt;
+  }
+  return encoded;
+}
+
+const std::vector<u8>* InputLog::GetDecoded(size_t index)
+{
+  if (m_cached_index == index)
+    return &m_cached;
+
+  const Chunk& chunk = m_chunks[index];
+  const std::optional<std::vector<u8>> encoded = GetEncoded(chunk);
+  if (!encoded)
+    return nullptr;
+
+  std::optional<std::vector<u8>> decoded = DecodeChunk(*encoded, chunk.distance, CHUNK_SIZE);
+  if (!decoded)
+    return nullptr;
+
+  m_cached = std::move(*decoded);
+  m_cached_index = index;
+  return &m_cached;
+}
+}  // namespace Movie
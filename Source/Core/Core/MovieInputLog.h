@@ -0,0 +1,110 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+
+namespace Movie
+{
+// Most polls repeat the inputs of the one before, so the bytes of a chunk are first XORed with
+// the ones `distance` bytes before them, which makes those bytes zero, and then the runs of zeros
+// are replaced by their length. Every token is one byte: below 0x80, it is followed by that many
+// bytes plus one as they are, otherwise it stands for (token - 0x80) plus one zeros.
+// A distance of 0 leaves the bytes as they are before the runs are replaced.
+constexpr u8 MAX_DELTA_DISTANCE = 64;
+
+std::vector<u8> EncodeChunk(std::span<const u8> data, u8 distance);
+// Empty if encoded isn't the encoding of exactly size bytes.
+std::optional<std::vector<u8>> DecodeChunk(std::span<const u8> encoded, u8 distance, u32 size);
+// The distance that encodes data into the fewest bytes.
+u8 FindDeltaDistance(std::span<const u8> data);
+
+// The inputs of a movie, the bytes that follow the DTMHeader in DTM files. They're kept in
+// chunks of CHUNK_SIZE bytes, and all but the last one are encoded once they're complete. After
+// SpillTo, the encoded chunks are written to a file instead of being kept in memory, so what is
+// left in memory doesn't grow with the length of the recording.
+//
+// DTM files with DTMHeader::bEncodedInputs set have the chunks one after another, each one a
+// ChunkHeader followed by its encoded bytes. All but the last one have CHUNK_SIZE bytes.
+class InputLog
+{
+public:
+  static constexpr u32 CHUNK_SIZE = 0x4000;
+
+#pragma pack(push, 1)
+  struct ChunkHeader
+  {
+    u32 size;
+    u32 encoded_size;
+    u8 distance;
+  };
+#pragma pack(pop)
+
+  InputLog() = default;
+  InputLog(const InputLog&) = delete;
+  InputLog(InputLog&& other) noexcept;
+  InputLog& operator=(const InputLog&) = delete;
+  InputLog& operator=(InputLog&& other) noexcept;
+  ~InputLog();
+
+  u64 GetSize() const { return u64{CHUNK_SIZE} * m_chunks.size() + m_tail.size(); }
+  bool IsEmpty() const { return GetSize() == 0; }
+  // Also deletes the spill file.
+  void Clear();
+
+  void Append(std::span<const u8> data);
+  // Copies size bytes of other from offset, which have to be there.
+  bool AppendFrom(InputLog& other, u64 offset, u64 size);
+  void Truncate(u64 size);
+  // False if the bytes go past the end.
+  bool Read(u64 offset, std::span<u8> out);
+  // The offset of the first of the first size bytes, which both have to have, that differs.
+  std::optional<u64> FindMismatch(InputLog& other, u64 size);
+  // The same as XXH3_64bits_withSeed of all the bytes.
+  u64 GetHash(u64 seed);
+
+  bool SpillTo(const std::string& path);
+
+  bool WriteRaw(File::IOFile& file);
+  bool WriteEncoded(File::IOFile& file);
+  // Read size bytes of the file from the current position, replacing what's in the log.
+  bool ReadRaw(File::IOFile& file, u64 size);
+  bool ReadEncoded(File::IOFile& file, u64 size);
+
+private:
+  struct Chunk
+  {
+    u32 encoded_size;
+    u8 distance;
+    // Where the ChunkHeader is in the spill file, if the chunk was spilled.
+    std::optional<u64> spill_offset;
+    std::vector<u8> encoded;
+  };
+
+  // Like Clear, but keeps the spill file.
+  void ClearData();
+  void SealTail();
+  bool SpillChunk(Chunk& chunk);
+  std::optional<std::vector<u8>> GetEncoded(const Chunk& chunk);
+  // The decoded bytes of the chunk, null if they couldn't be read from the spill file.
+  const std::vector<u8>* GetDecoded(size_t index);
+
+  std::vector<Chunk> m_chunks;
+  std::vector<u8> m_tail;
+
+  std::string m_spill_path;
+  File::IOFile m_spill_file;
+  u64 m_spill_end = 0;
+
+  // The last chunk that was decoded, since the inputs are mostly read one after another.
+  std::optional<size_t> m_cached_index;
+  std::vector<u8> m_cached;
+};
+}  // namespace Movie
@@ -0,0 +1,93 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayBufferTuner.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace NetPlay
+{
+u32 BufferTuner::Samples::GetPercentile95() const
+{
+  std::array<u32, SAMPLE_COUNT> sorted = rtt_ms;
+  const auto end = sorted.begin() + count;
+  std::sort(sorted.begin(), end);
+  return sorted[(count - 1) * 95 / 100];
+}
+
+void BufferTuner::AddSample(PlayerId pid, u32 rtt_ms)
+{
+  Samples& samples = m_samples[pid];
+  samples.rtt_ms[samples.next] = rtt_ms;
+  samples.next = (samples.next + 1) % SAMPLE_COUNT;
+  samples.count = std::min(samples.count + 1, SAMPLE_COUNT);
+}
+
+void BufferTuner::RemovePlayer(PlayerId pid)
+{
+  m_samples.erase(pid);
+}
+
+void BufferTuner::Reset()
+{
+  m_samples.clear();
+  m_shrink_votes = 0;
+}
+
+u32 BufferTuner::GetRequiredBufferSize(double frame_rate) const
+{
+  u32 largest = 0;
+  u32 second_largest = 0;
+  for (const auto& [pid, samples] : m_samples)
+  {
+    if (samples.count == 0)
+      continue;
+
+    const u32 rtt = samples.GetPercentile95();
+    if (rtt > largest)
+    {
+      second_largest = largest;
+      largest = rtt;
+    }
+    else if (rtt > second_largest)
+    {
+      second_largest = rtt;
+    }
+  }
+
+  const double latency_ms = (largest + second_largest) / 2.0;
+  const u32 frames = static_cast<u32>(std::ceil(latency_ms * frame_rate / 1000.0)) + 1;
+  return std::clamp(frames, MIN_BUFFER_SIZE, MAX_BUFFER_SIZE);
+}
+
+std::optional<u32> BufferTuner::Update(u32 current_size, double frame_rate)
+{
+  if (m_samples.empty())
+    return std::nullopt;
+
+  const u32 required = GetRequiredBufferSize(frame_rate);
+  if (required > current_size)
+  {
+    m_shrink_votes = 0;
+    return required;
+  }
+
+  // Shrinking stalls the game while the buffer drains, so only do it one frame at a time and when
+  // a buffer that is at least two frames smaller has been enough for a while.
+  if (required + 2 <= current_size)
+  {
+    if (++m_shrink_votes >= SHRINK_DELAY)
+    {
+      m_shrink_votes = 0;
+      return current_size - 1;
+    }
+  }
+  else
+  {
+    m_shrink_votes = 0;
+  }
+
+  return std::nullopt;
+}
+}  // namespace NetPlay
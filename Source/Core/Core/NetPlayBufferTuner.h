@@ -0,0 +1,54 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <optional>
+
+#include "Common/CommonTypes.h"
+#include "Core/NetPlayProto.h"
+
+namespace NetPlay
+{
+// Picks the pad buffer size from the round trip times the server measures with its pings.
+//
+// Pad data travels from one client through the server to another, so it needs about half of the
+// sum of the two largest round trip times to arrive. The 95th percentile of each player's recent
+// samples is used, so occasional jitter is covered as well. The buffer grows as soon as that
+// doesn't fit anymore, but only shrinks once a smaller one has been enough for a while.
+class BufferTuner
+{
+public:
+  static constexpr size_t SAMPLE_COUNT = 16;
+  // Updates in a row that have to ask for a smaller buffer before it actually shrinks.
+  static constexpr u32 SHRINK_DELAY = 5;
+  static constexpr u32 MIN_BUFFER_SIZE = 1;
+  static constexpr u32 MAX_BUFFER_SIZE = 20;
+
+  void AddSample(PlayerId pid, u32 rtt_ms);
+  void RemovePlayer(PlayerId pid);
+  void Reset();
+
+  // The buffer size the current samples need, in frames at frame_rate, including one frame of
+  // margin.
+  u32 GetRequiredBufferSize(double frame_rate) const;
+  // Returns the new buffer size if current_size should change. Meant to be called at a fixed
+  // interval, e.g. whenever the server sends its pings.
+  std::optional<u32> Update(u32 current_size, double frame_rate);
+
+private:
+  struct Samples
+  {
+    std::array<u32, SAMPLE_COUNT> rtt_ms{};
+    size_t count = 0;
+    size_t next = 0;
+
+    u32 GetPercentile95() const;
+  };
+
+  std::map<PlayerId, Samples> m_samples;
+  u32 m_shrink_votes = 0;
+};
+}  // namespace NetPlay
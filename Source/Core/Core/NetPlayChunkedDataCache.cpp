@@ -0,0 +1,141 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayChunkedDataCache.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <string_view>
+#include <utility>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+
+namespace NetPlay
+{
+ChunkedDataCache::ChunkedDataCache(std::string directory) : m_directory(std::move(directory))
+{
+}
+
+std::span<const u8> ChunkedDataCache::Find(const Common::SHA1::Digest& digest)
+{
+  const auto it = std::ranges::find(m_entries, digest, &Entry::digest);
+  if (it != m_entries.end())
+    return it->data;
+
+  if (!Load(digest))
+    return {};
+  return m_entries.back().data;
+}
+
+void ChunkedDataCache::Store(const Common::SHA1::Digest& digest, std::span<const u8> data,
+                             bool complete)
+{
+  if (data.size() > MAX_SIZE)
+    return;
+
+  Add(digest, std::vector<u8>(data.begin(), data.end()));
+  if (complete)
+    Write(digest, data);
+}
+
+std::string ChunkedDataCache::GetPath(const Common::SHA1::Digest& digest) const
+{
+  return m_directory + Common::SHA1::DigestToString(digest);
+}
+
+std::span<const u8> ChunkedDataCache::Add(const Common::SHA1::Digest& digest,
+                                          std::vector<u8> data)
+{
+  if (const auto it = std::ranges::find(m_entries, digest, &Entry::digest); it != m_entries.end())
+  {
+    m_size -= it->data.size();
+    m_entries.erase(it);
+  }
+
+  m_size += data.size();
+  m_entries.push_back(Entry{digest, std::move(data)});
+
+  auto oldest = m_entries.begin();
+  for (; m_size > MAX_SIZE; ++oldest)
+    m_size -= oldest->data.size();
+  m_entries.erase(m_entries.begin(), oldest);
+
+  return m_entries.back().data;
+}
+
+bool ChunkedDataCache::Load(const Common::SHA1::Digest& digest)
+{
+  if (m_directory.empty())
+    return false;
+
+  const std::string path = GetPath(digest);
+  std::string contents;
+  if (!File::ReadFileToString(path, contents) || contents.size() > MAX_SIZE)
+    return false;
+
+  // Don't trust a file that was cut short or changed.
+  if (Common::SHA1::CalculateDigest(contents) != digest)
+  {
+    WARN_LOG_FMT(NETPLAY, "Removing corrupted cached data {}.", path);
+    File::Delete(path);
+    return false;
+  }
+
+  // Mark it as used, so it's the last to be pruned.
+  std::error_code error;
+  const auto now = std::filesystem::file_time_type::clock::now();
+  std::filesystem::last_write_time(StringToPath(path), now, error);
+
+  Add(digest, std::vector<u8>(contents.begin(), contents.end()));
+  return true;
+}
+
+void ChunkedDataCache::Write(const Common::SHA1::Digest& digest, std::span<const u8> data) const
+{
+  if (m_directory.empty())
+    return;
+
+  const std::string path = GetPath(digest);
+  if (!File::CreateFullPath(path) ||
+      !File::WriteStringToFile(
+          path, std::string_view(reinterpret_cast<const char*>(data.data()), data.size())))
+  {
+    WARN_LOG_FMT(NETPLAY, "Failed to cache data in {}.", path);
+    return;
+  }
+
+  PruneDirectory();
+}
+
+void ChunkedDataCache::PruneDirectory() const
+{
+  struct CachedFile
+  {
+    std::filesystem::path path;
+    std::filesystem::file_time_type time;
+    u64 size;
+  };
+
+  std::vector<CachedFile> files;
+  u64 total_size = 0;
+  std::error_code error;
+  for (const auto& entry : std::filesystem::directory_iterator(StringToPath(m_directory), error))
+  {
+    if (!entry.is_regular_file(error))
+      continue;
+
+    const u64 size = entry.file_size(error);
+    files.push_back(CachedFile{entry.path(), entry.last_write_time(error), size});
+    total_size += size;
+  }
+
+  std::ranges::sort(files, {}, &CachedFile::time);
+  for (auto it = files.begin(); it != files.end() && total_size > MAX_DIRECTORY_SIZE; ++it)
+  {
+    if (std::filesystem::remove(it->path, error))
+      total_size -= it->size;
+  }
+}
+}  // namespace NetPlay
@@ -0,0 +1,58 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+
+namespace NetPlay
+{
+// The chunked data a client received, by the SHA1 of all of it. When the server starts sending
+// data the client has, the client tells it to skip what it already has: all of it when it was
+// received before, or the start of it when an earlier transfer was aborted halfway, for instance
+// because another player disconnected during the game start.
+//
+// Complete data is also written to a directory, so that save data which didn't change since the
+// last session doesn't have to be sent again.
+class ChunkedDataCache
+{
+public:
+  static constexpr size_t MAX_SIZE = 64 * 1024 * 1024;
+  static constexpr u64 MAX_DIRECTORY_SIZE = 256 * 1024 * 1024;
+
+  // Without a directory nothing is written to disk.
+  explicit ChunkedDataCache(std::string directory = {});
+
+  // The data kept for digest, which can be just the start of it. Empty if there is none.
+  std::span<const u8> Find(const Common::SHA1::Digest& digest);
+  // Replaces what is kept for digest. The oldest data is dropped once it grows beyond MAX_SIZE,
+  // or MAX_DIRECTORY_SIZE for the directory, which only complete data is written to.
+  void Store(const Common::SHA1::Digest& digest, std::span<const u8> data, bool complete);
+
+  size_t GetSize() const { return m_size; }
+
+private:
+  struct Entry
+  {
+    Common::SHA1::Digest digest;
+    std::vector<u8> data;
+  };
+
+  std::string GetPath(const Common::SHA1::Digest& digest) const;
+  std::span<const u8> Add(const Common::SHA1::Digest& digest, std::vector<u8> data);
+  bool Load(const Common::SHA1::Digest& digest);
+  void Write(const Common::SHA1::Digest& digest, std::span<const u8> data) const;
+  void PruneDirectory() const;
+
+  std::string m_directory;
+  // Oldest first.
+  std::vector<Entry> m_entries;
+  size_t m_size = 0;
+};
+}  // namespace NetPlay
@@ -19,6 +19,7 @@
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
+#include <lz4.h>
 
 #include "Common/Assert.h"
 #include "Common/CommonPaths.h"
@@ -26,12 +27,15 @@
 #include "Common/Crypto/SHA1.h"
 #include "Common/ENet.h"
 #include "Common/FileUtil.h"
+#include "Common/FrameProfiler.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/NandPaths.h"
 #include "Common/QoSSession.h"
 #include "Common/SFMLHelper.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 #include "Common/Timer.h"
 #include "Common/Version.h"
 
@@ -43,6 +47,7 @@
 #include "Core/Config/SessionSettings.h"
 #include "Core/Config/WiimoteSettings.h"
 #include "Core/ConfigManager.h"
+#include "Core/Core.h"
 #include "Core/GeckoCode.h"
 #include "Core/HW/EXI/EXI.h"
 #include "Core/HW/EXI/EXI_DeviceIPL.h"
@@ -67,10 +72,11 @@
 #include "Core/IOS/Uids.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayCommon.h"
+#include "Core/NetPlayGameDigest.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/State.h"
 #include "Core/SyncIdentifier.h"
 #include "Core/System.h"
-#include "DiscIO/Blob.h"
 
 #include "InputCommon/ControllerEmu/ControlGroup/Attachments.h"
 #include "InputCommon/GCAdapter.h"
@@ -87,6 +93,14 @@ static std::mutex crit_netplay_client;
 static NetPlayClient* netplay_client = nullptr;
 static bool s_si_poll_batching = false;
 
+// Rollback takes a frontend that calls UpdateRollback() every frame, which only the libretro core
+// does. The server only turns it on if every player can.
+#ifdef DOLPHIN_LIBRETRO
+static constexpr bool SUPPORTS_ROLLBACK = true;
+#else
+static constexpr bool SUPPORTS_ROLLBACK = false;
+#endif
+
 // called from ---GUI--- thread
 NetPlayClient::~NetPlayClient()
 {
@@ -100,6 +114,8 @@ NetPlayClient::~NetPlayClient()
     m_dialog->AbortGameDigest();
     if (m_game_digest_thread.joinable())
       m_game_digest_thread.join();
+    if (m_late_join_thread.joinable())
+      m_late_join_thread.join();
     m_do_loop.Clear();
     m_thread.join();
 
@@ -131,7 +147,8 @@ NetPlayClient::~NetPlayClient()
 // called from ---GUI--- thread
 NetPlayClient::NetPlayClient(const std::string& address, const u16 port, NetPlayUI* dialog,
                              const std::string& name, const NetTraversalConfig& traversal_config)
-    : m_dialog(dialog), m_player_name(name)
+    : m_dialog(dialog), m_player_name(name),
+      m_chunked_data_cache(File::GetUserPath(D_CACHE_IDX) + "NetPlay/")
 {
   ClearBuffers();
 
@@ -244,6 +261,18 @@ NetPlayClient::NetPlayClient(const std::string& address, const u16 port, NetPlay
   }
 }
 
+std::optional<std::pair<std::string, u16>> NetPlayClient::GetServerAddress() const
+{
+  if (!m_is_connected || !m_server)
+    return std::nullopt;
+
+  std::array<char, 64> host{};
+  if (enet_address_get_host_ip(&m_server->address, host.data(), host.size()) != 0)
+    return std::nullopt;
+
+  return std::pair<std::string, u16>(host.data(), m_server->address.port);
+}
+
 bool NetPlayClient::Connect()
 {
   INFO_LOG_FMT(NETPLAY, "Connecting to server.");
@@ -343,6 +372,8 @@ static void ReceiveSyncIdentifier(sf::Packet& spac, SyncIdentifier& sync_identif
 // called from ---NETPLAY--- thread
 void NetPlayClient::OnData(sf::Packet& packet)
 {
+  Common::FrameProfiler::Scope profiler_scope(Common::FrameProfiler::Stage::NetPlayPacket);
+
   MessageID mid;
   packet >> mid;
 
@@ -398,6 +429,18 @@ void NetPlayClient::OnData(sf::Packet& packet)
     OnPadHostData(packet);
     break;
 
+  case MessageID::PadFrames:
+    OnPadFrames(packet);
+    break;
+
+  case MessageID::PadFrameRequest:
+    OnPadFrameRequest(packet);
+    break;
+
+  case MessageID::SpectatorPadData:
+    OnSpectatorPadData(packet);
+    break;
+
   case MessageID::WiimoteData:
     OnWiimoteData(packet);
     break;
@@ -439,6 +482,18 @@ void NetPlayClient::OnData(sf::Packet& packet)
     OnPowerButton();
     break;
 
+  case MessageID::LateJoinRequest:
+    OnLateJoinRequest(packet);
+    break;
+
+  case MessageID::LateJoin:
+    OnLateJoin(packet);
+    break;
+
+  case MessageID::LateJoinState:
+    OnLateJoinState(packet);
+    break;
+
   case MessageID::Ping:
     OnPing(packet);
     break;
@@ -447,6 +502,10 @@ void NetPlayClient::OnData(sf::Packet& packet)
     OnPlayerPingData(packet);
     break;
 
+  case MessageID::ClockSync:
+    OnClockSync(packet);
+    break;
+
   case MessageID::DesyncDetected:
     OnDesyncDetected(packet);
     break;
@@ -459,6 +518,10 @@ void NetPlayClient::OnData(sf::Packet& packet)
     OnSyncCodes(packet);
     break;
 
+  case MessageID::SyncGame:
+    OnSyncGame(packet);
+    break;
+
   case MessageID::ComputeGameDigest:
     OnComputeGameDigest(packet);
     break;
@@ -547,14 +610,35 @@ void NetPlayClient::OnChunkedDataStart(sf::Packet& packet)
   std::string title;
   packet >> title;
   const u64 data_size = Common::PacketReadU64(packet);
+  Common::SHA1::Digest digest;
+  for (u8& byte : digest)
+    packet >> byte;
 
   INFO_LOG_FMT(NETPLAY, "Starting data chunk {}.", cid);
 
-  m_chunked_data_receive_queue.emplace(cid, sf::Packet{});
+  // Resume from what was received of the same data before.
+  ChunkedDataReceive receive{digest, sf::Packet{}};
+  if (const std::span<const u8> cached = m_chunked_data_cache.Find(digest);
+      cached.size() <= data_size)
+  {
+    receive.data.append(cached.data(), cached.size());
+  }
+  const u64 offset = receive.data.getDataSize();
+  m_chunked_data_receive_queue.insert_or_assign(cid, std::move(receive));
+
+  if (offset != 0)
+    INFO_LOG_FMT(NETPLAY, "Resuming data chunk {} at {}/{}.", cid, offset, data_size);
 
   std::vector<int> players;
   players.push_back(m_local_player->pid);
   m_dialog->ShowChunkedProgressDialog(title, data_size, players);
+  m_dialog->SetChunkedProgress(m_local_player->pid, offset);
+
+  sf::Packet resume_packet;
+  resume_packet << MessageID::ChunkedDataResume;
+  resume_packet << cid;
+  resume_packet << offset;
+  Send(resume_packet, CHUNKED_DATA_CHANNEL);
 }
 
 void NetPlayClient::OnChunkedDataEnd(sf::Packet& packet)
@@ -571,7 +655,13 @@ void NetPlayClient::OnChunkedDataEnd(sf::Packet& packet)
 
   INFO_LOG_FMT(NETPLAY, "Ending data chunk {}.", cid);
 
-  auto& data_packet = data_packet_iter->second;
+  auto& [digest, data_packet] = data_packet_iter->second;
+  const std::span<const u8> data{static_cast<const u8*>(data_packet.getData()),
+                                 data_packet.getDataSize()};
+  if (Common::SHA1::CalculateDigest(data.data(), data.size()) == digest)
+    m_chunked_data_cache.Store(digest, data, true);
+  else
+    ERROR_LOG_FMT(NETPLAY, "Data chunk {} doesn't match its digest.", cid);
   OnData(data_packet);
   m_chunked_data_receive_queue.erase(data_packet_iter);
   m_dialog->HideChunkedProgressDialog();
@@ -594,13 +684,9 @@ void NetPlayClient::OnChunkedDataPayload(sf::Packet& packet)
     return;
   }
 
-  auto& data_packet = data_packet_iter->second;
-  while (!packet.endOfPacket())
-  {
-    u8 byte;
-    packet >> byte;
-    data_packet << byte;
-  }
+  auto& data_packet = data_packet_iter->second.data;
+  data_packet.append(static_cast<const u8*>(packet.getData()) + packet.getReadPosition(),
+                     packet.getDataSize() - packet.getReadPosition());
 
   INFO_LOG_FMT(NETPLAY, "Received {} bytes of data chunk {}.", data_packet.getDataSize(), cid);
 
@@ -627,6 +713,14 @@ void NetPlayClient::OnChunkedDataAbort(sf::Packet& packet)
 
   INFO_LOG_FMT(NETPLAY, "Aborting data chunk {}.", cid);
 
+  // Keep what was received, the game start is usually tried again right away.
+  const auto& [digest, data_packet] = iter->second;
+  if (data_packet.getDataSize() != 0)
+  {
+    m_chunked_data_cache.Store(
+        digest, {static_cast<const u8*>(data_packet.getData()), data_packet.getDataSize()},
+        false);
+  }
   m_chunked_data_receive_queue.erase(iter);
   m_dialog->HideChunkedProgressDialog();
 }
@@ -726,28 +820,105 @@ void NetPlayClient::OnPadHostData(sf::Packet& packet)
   }
 }
 
-void NetPlayClient::OnWiimoteData(sf::Packet& packet)
+void NetPlayClient::OnPadFrames(sf::Packet& packet)
 {
+  PadFrames frames;
   while (!packet.endOfPacket())
   {
-    PadIndex map;
-    packet >> map;
+    // Trusting server for good map value (>=0 && <4)
+    if (!ReadPadFrames(packet, &frames))
+      return;
 
-    WiimoteEmu::SerializedWiimoteState pad;
-    packet >> pad.length;
-    ASSERT(pad.length <= pad.data.size());
-    if (pad.length <= pad.data.size())
+    PadFrameReceiver& receiver = m_pad_frame_receivers[frames.map];
+    const u32 next_frame = receiver.GetNextFrame();
+    if (receiver.Receive(frames,
+                         [&](const GCPadStatus& pad) { m_pad_buffer.at(frames.map).Push(pad); }))
     {
-      for (size_t i = 0; i < pad.length; ++i)
-        packet >> pad.data[i];
+      if (receiver.GetNextFrame() != next_frame)
+        m_gc_pad_event.Set();
     }
-    else
+    else if (receiver.ShouldRequestMissingFrames())
+    {
+      sf::Packet request;
+      request << MessageID::PadFrameRequest << frames.map << next_frame;
+      Send(request);
+    }
+  }
+}
+
+void NetPlayClient::OnSpectatorPadData(sf::Packet& packet)
+{
+  // A batch of delayed inputs for spectators, a PadData message compressed with LZ4.
+  constexpr u32 MAX_SIZE = 1024 * 1024;
+
+  u32 size;
+  u32 compressed_size;
+  packet >> size >> compressed_size;
+  if (!packet || size == 0 || size > MAX_SIZE ||
+      compressed_size > packet.getDataSize() - packet.getReadPosition())
+  {
+    ERROR_LOG_FMT(NETPLAY, "Received invalid spectator inputs.");
+    return;
+  }
+
+  std::vector<char> data(size);
+  const int decompressed_size = LZ4_decompress_safe(
+      static_cast<const char*>(packet.getData()) + packet.getReadPosition(), data.data(),
+      static_cast<int>(compressed_size), static_cast<int>(size));
+  if (decompressed_size != static_cast<int>(size))
+  {
+    ERROR_LOG_FMT(NETPLAY, "Failed to decompress spectator inputs.");
+    return;
+  }
+
+  sf::Packet pad_packet;
+  pad_packet.append(data.data(), data.size());
+  OnPadData(pad_packet);
+}
+
+void NetPlayClient::OnPadFrameRequest(sf::Packet& packet)
+{
+  PadIndex map;
+  u32 first_frame;
+  packet >> map >> first_frame;
+  if (!packet || map < 0 || map >= 4)
+    return;
+
+  sf::Packet spac;
+  spac << MessageID::PadFrames;
+  bool send_packet;
+  {
+    std::lock_guard lk(m_pad_frame_history_lock);
+    const PadFrameHistory& history = m_pad_frame_histories[map];
+    if (!WriteMissingPadFrames(spac, map, history, first_frame))
     {
-      pad.length = 0;
+      ERROR_LOG_FMT(NETPLAY, "Inputs of pad {} from {} on are no longer available.", map,
+                    first_frame);
     }
+    send_packet = first_frame >= history.GetBegin() && first_frame < history.GetEnd();
+  }
+
+  if (send_packet)
+    Send(spac);
+}
+
+void NetPlayClient::OnWiimoteData(sf::Packet& packet)
+{
+  while (!packet.endOfPacket())
+  {
+    PadIndex map;
+    packet >> map;
+
+    WiimoteStateDelta delta;
+    const bool valid = ReadWiimoteStateDelta(packet, &delta);
+    ASSERT(valid);
+    if (!valid)
+      break;
 
     // Trusting server for good map value (>=0 && <4)
     // add to pad buffer
+    WiimoteEmu::SerializedWiimoteState& pad = m_last_received_wiimote_state.at(map);
+    pad = delta.Apply(pad);
     m_wiimote_buffer.at(map).Push(pad);
     m_wii_pad_event.Set();
   }
@@ -823,6 +994,7 @@ void NetPlayClient::OnChangeGame(sf::Packet& packet)
   client_capabilities_packet << MessageID::ClientCapabilities;
   client_capabilities_packet << ExpansionInterface::CEXIIPL::HasIPLDump();
   client_capabilities_packet << Config::Get(Config::SESSION_USE_FMA);
+  client_capabilities_packet << SUPPORTS_ROLLBACK;
   Send(client_capabilities_packet);
 }
 
@@ -934,11 +1106,35 @@ void NetPlayClient::OnStartGame(sf::Packet& packet)
     packet >> m_net_settings.golf_mode;
     packet >> m_net_settings.use_fma;
     packet >> m_net_settings.hide_remote_gbas;
+    packet >> m_net_settings.redundant_pad_data;
+    packet >> m_net_settings.state_fingerprints;
+    packet >> m_net_settings.rollback;
+
+    const u64 start_time = Common::PacketReadU64(packet);
+    packet >> m_preroll_inputs;
+
+    // A start too far ahead means the clock estimate is off, in which case it's not waited for.
+    constexpr u64 max_wait_us = 10'000'000;
+    m_scheduled_start_us = m_clock_sync.ToLocalTime(start_time);
+    if (m_scheduled_start_us && *m_scheduled_start_us > Common::Timer::NowUs() + max_wait_us)
+      m_scheduled_start_us.reset();
 
     for (size_t i = 0; i < sizeof(m_net_settings.sram); ++i)
       packet >> m_net_settings.sram[i];
 
     m_net_settings.is_hosting = m_local_player->IsHost();
+
+    for (PadFrameReceiver& receiver : m_pad_frame_receivers)
+      receiver.Reset();
+
+    // A player joining the running game can't start before it has the state to start from.
+    if (m_late_join_frame)
+    {
+      std::lock_guard lk(m_late_join_state_lock);
+      m_late_join_start_pending = m_late_join_state.empty();
+    }
+    if (m_late_join_start_pending)
+      return;
   }
 
   m_dialog->OnMsgStartGame();
@@ -968,6 +1164,23 @@ void NetPlayClient::OnPing(sf::Packet& packet)
   response_packet << ping_key;
 
   Send(response_packet);
+
+  // Every ping also measures our clock against the server's, for scheduling the game start.
+  sf::Packet clock_packet;
+  clock_packet << MessageID::ClockSync;
+  clock_packet << Common::Timer::NowUs();
+
+  Send(clock_packet);
+}
+
+void NetPlayClient::OnClockSync(sf::Packet& packet)
+{
+  const u64 sent_us = Common::PacketReadU64(packet);
+  const u64 server_us = Common::PacketReadU64(packet);
+  if (!packet)
+    return;
+
+  m_clock_sync.AddSample(sent_us, server_us, Common::Timer::NowUs());
 }
 
 void NetPlayClient::OnPlayerPingData(sf::Packet& packet)
@@ -978,7 +1191,8 @@ void NetPlayClient::OnPlayerPingData(sf::Packet& packet)
   {
     std::lock_guard lkp(m_crit.players);
     Player& player = m_players[pid];
-    packet >> player.ping;
+    packet >> player.ping >> player.jitter >> player.packet_loss;
+    player.ping_history.Push(player.ping);
   }
 
   DisplayPlayersPing();
@@ -1482,6 +1696,50 @@ void NetPlayClient::OnSyncCodesDataAR(sf::Packet& packet)
   ActionReplay::UpdateSyncedCodes(synced_codes);
 }
 
+void NetPlayClient::OnSyncGame(sf::Packet& packet)
+{
+  if (!Config::Get(Config::NETPLAY_ACCEPT_GAME_TRANSFERS))
+  {
+    ERROR_LOG_FMT(NETPLAY, "Ignoring a game sent by the host.");
+    return;
+  }
+
+  SyncIdentifier sync_identifier;
+  ReceiveSyncIdentifier(packet, sync_identifier);
+
+  const u8* data = static_cast<const u8*>(packet.getData()) + packet.getReadPosition();
+  const size_t size = packet.getDataSize() - packet.getReadPosition();
+  if (size == 0 || size > MAX_GAME_TRANSFER_SIZE)
+  {
+    ERROR_LOG_FMT(NETPLAY, "Ignoring a game of {} bytes sent by the host.", size);
+    return;
+  }
+
+  const std::string path = GetTransferredGamePath(sync_identifier);
+  const std::string partial_path = path + ".part";
+  {
+    File::CreateFullPath(path);
+    File::IOFile file(partial_path, "wb");
+    if (!file.WriteBytes(data, size))
+    {
+      PanicAlertFmtT("Failed to write the game sent by the host to {0}.", partial_path);
+      return;
+    }
+  }
+  if (!File::RenameSync(partial_path, path))
+  {
+    PanicAlertFmtT("Failed to write the game sent by the host to {0}.", path);
+    return;
+  }
+
+  INFO_LOG_FMT(NETPLAY, "Received a game of {} bytes, saved to {}.", size, path);
+  m_dialog->AppendChat(Common::GetStringT("Game received!"));
+
+  // The dialog looks for transferred games when it doesn't find the game in the game list.
+  if (sync_identifier == m_selected_game)
+    SendGameStatus();
+}
+
 void NetPlayClient::OnComputeGameDigest(sf::Packet& packet)
 {
   SyncIdentifier sync_identifier;
@@ -1526,9 +1784,131 @@ void NetPlayClient::OnGameDigestAbort()
   m_dialog->AbortGameDigest();
 }
 
+void NetPlayClient::OnLateJoinRequest(sf::Packet& packet)
+{
+  PlayerId pid;
+  packet >> pid;
+
+  // The state is saved on the CPU thread, which may be waiting for inputs from this thread.
+  if (m_late_join_thread.joinable())
+    m_late_join_thread.join();
+  m_late_join_thread = std::thread([this, pid] { SendLateJoinState(pid); });
+}
+
+void NetPlayClient::SendLateJoinState(PlayerId pid)
+{
+  Common::SetCurrentThreadName("NetPlay Late Join");
+
+  auto& system = Core::System::GetInstance();
+  Common::UniqueBuffer<u8> state;
+  std::array<u32, 4> pad_reads{};
+  u32 frame = 0;
+  bool saved = false;
+  Core::RunOnCPUThread(
+      system,
+      [&] {
+        std::lock_guard lk(crit_netplay_client);
+        if (!m_is_running.IsSet() || m_rollback_enabled || !Core::IsRunning(system))
+          return;
+
+        State::SaveToBuffer(system, state);
+        pad_reads = m_pad_reads;
+        frame = m_timebase_frame;
+        saved = true;
+      },
+      true);
+
+  sf::Packet state_packet;
+  if (saved && !CompressBufferIntoPacket(std::vector<u8>(state.begin(), state.end()), state_packet))
+    saved = false;
+
+  sf::Packet packet;
+  packet << MessageID::LateJoinState;
+  packet << pid;
+  packet << saved;
+  if (saved)
+  {
+    packet << frame;
+    for (u32 reads : pad_reads)
+      packet << reads;
+    packet.append(state_packet.getData(), state_packet.getDataSize());
+  }
+
+  SendAsync(std::move(packet), CHUNKED_DATA_CHANNEL);
+}
+
+void NetPlayClient::OnLateJoin(sf::Packet& packet)
+{
+  u32 frame;
+  packet >> frame;
+
+  {
+    std::lock_guard lkg(m_crit.game);
+    m_late_join_frame = frame;
+    m_late_join_start_pending = false;
+    {
+      std::lock_guard lk(m_late_join_state_lock);
+      m_late_join_state.clear();
+    }
+    ClearBuffers();
+  }
+
+  m_dialog->AppendChat(Common::GetStringT("Joining the running game..."));
+}
+
+void NetPlayClient::OnLateJoinState(sf::Packet& packet)
+{
+  std::optional<std::vector<u8>> state = DecompressPacketIntoBuffer(packet);
+  const bool received = state && !state->empty();
+
+  bool start = false;
+  {
+    std::lock_guard lkg(m_crit.game);
+    if (!received)
+    {
+      m_late_join_frame.reset();
+      m_late_join_start_pending = false;
+    }
+    else
+    {
+      std::lock_guard lk(m_late_join_state_lock);
+      m_late_join_state = std::move(*state);
+      start = std::exchange(m_late_join_start_pending, false);
+    }
+  }
+
+  if (!received)
+  {
+    m_dialog->AppendChat(Common::GetStringT("Error processing the state of the running game."));
+    return;
+  }
+
+  m_dialog->AppendChat(Common::GetStringT("Game state received!"));
+  if (start)
+    m_dialog->OnMsgStartGame();
+}
+
+void NetPlayClient::LoadJoinState(Core::System& system)
+{
+  std::lock_guard lk(crit_netplay_client);
+  if (!netplay_client)
+    return;
+
+  std::vector<u8> state;
+  {
+    std::lock_guard lks(netplay_client->m_late_join_state_lock);
+    state = std::move(netplay_client->m_late_join_state);
+    netplay_client->m_late_join_state.clear();
+  }
+
+  if (!state.empty() && !State::LoadNetPlayJoinState(system, state))
+    ERROR_LOG_FMT(NETPLAY, "Failed to load the state of the running game");
+}
+
 void NetPlayClient::Send(const sf::Packet& packet, const u8 channel_id)
 {
-  Common::ENet::SendPacket(m_server, packet, channel_id);
+  m_bytes_sent[channel_id] += static_cast<u32>(packet.getDataSize());
+  Common::ENet::SendPacket(m_server, packet, channel_id, GetChannelPacketFlags(channel_id));
 }
 
 void NetPlayClient::DisplayPlayersPing()
@@ -1546,6 +1926,67 @@ u32 NetPlayClient::GetPlayersMaxPing() const
       ->second.ping;
 }
 
+// called from ---NETPLAY--- thread
+void NetPlayClient::UpdateConnectionStats()
+{
+  const double seconds = m_connection_stats_timer.ElapsedMs() / 1000.0;
+  m_connection_stats_timer.Start();
+
+  ConnectionStats stats;
+  {
+    std::lock_guard lkp(m_crit.players);
+    for (const auto& [pid, player] : m_players)
+    {
+      PlayerConnectionStats& player_stats = stats.players.emplace_back();
+      player_stats.pid = pid;
+      player_stats.name = player.name;
+      player_stats.ping = player.ping;
+      player_stats.rtt_p50 = player.ping_history.GetPercentile(50);
+      player_stats.rtt_p95 = player.ping_history.GetPercentile(95);
+      player_stats.rtt_p99 = player.ping_history.GetPercentile(99);
+      player_stats.jitter = player.jitter;
+      player_stats.packet_loss = static_cast<float>(player.packet_loss) /
+                                 static_cast<float>(ENET_PEER_PACKET_LOSS_SCALE);
+    }
+  }
+
+  for (size_t i = 0; i < m_pad_buffer.size(); ++i)
+    stats.pad_buffer[i] = static_cast<u32>(m_pad_buffer[i].Size());
+  stats.stalled_frames = m_stalled_frames.exchange(0);
+
+  for (size_t i = 0; i < CHANNEL_COUNT; ++i)
+  {
+    stats.bytes_sent_per_second[i] = static_cast<u32>(m_bytes_sent[i].exchange(0) / seconds);
+    stats.bytes_received_per_second[i] =
+        static_cast<u32>(m_bytes_received[i].exchange(0) / seconds);
+  }
+
+  // ENet counts a reliable packet as lost whenever it has to send it again, and starts over
+  // every ENET_PEER_PACKET_LOSS_INTERVAL.
+  const u32 packets_lost = m_server ? m_server->packetsLost : 0;
+  stats.retransmits = packets_lost >= m_last_packets_lost ? packets_lost - m_last_packets_lost :
+                                                            packets_lost;
+  m_last_packets_lost = packets_lost;
+
+  {
+    std::lock_guard lk(m_connection_stats_lock);
+    stats.sequence = m_connection_stats.sequence + 1;
+    m_connection_stats = stats;
+  }
+
+  if (Config::Get(Config::GFX_SHOW_NETPLAY_STATS))
+  {
+    OSD::AddTypedMessage(OSD::MessageType::NetPlayStats, FormatConnectionStats(stats),
+                         OSD::Duration::SHORT, OSD::Color::CYAN);
+  }
+}
+
+ConnectionStats NetPlayClient::GetConnectionStats() const
+{
+  std::lock_guard lk(m_connection_stats_lock);
+  return m_connection_stats;
+}
+
 void NetPlayClient::Disconnect()
 {
   ENetEvent netEvent;
@@ -1584,10 +2025,35 @@ void NetPlayClient::SendAsync(sf::Packet&& packet, const u8 channel_id)
   Common::ENet::WakeupThread(m_client);
 }
 
+void NetPlayClient::SendAsync(const Common::WirePacket& packet, const u8 channel_id)
+{
+  ENetPacket* epac = m_packet_pool.CreatePacket(packet, GetChannelPacketFlags(channel_id));
+  if (!epac)
+    return;
+
+  {
+    std::lock_guard lkq(m_crit.async_queue_write);
+    while (!m_packet_queue.Push(epac, channel_id))
+    {
+      if (!m_do_loop.IsSet())
+      {
+        enet_packet_destroy(epac);
+        return;
+      }
+
+      // The NetPlay thread is far behind, wait for it instead of dropping inputs.
+      Common::ENet::WakeupThread(m_client);
+      std::this_thread::yield();
+    }
+  }
+  Common::ENet::WakeupThread(m_client);
+}
+
 // called from ---NETPLAY--- thread
 void NetPlayClient::ThreadFunc()
 {
   INFO_LOG_FMT(NETPLAY, "NetPlayClient starting.");
+  Common::SetCurrentThreadPriority(Common::ThreadPriority::High);
 
   Common::QoSSession qos_session;
   if (Config::Get(Config::NETPLAY_ENABLE_QOS))
@@ -1605,6 +2071,8 @@ void NetPlayClient::ThreadFunc()
     }
   }
 
+  m_connection_stats_timer.Start();
+
   while (m_do_loop.IsSet())
   {
     ENetEvent netEvent;
@@ -1612,6 +2080,8 @@ void NetPlayClient::ThreadFunc()
     if (m_traversal_client)
       m_traversal_client->HandleResends();
     net = enet_host_service(m_client, &netEvent, 250);
+    if (m_connection_stats_timer.ElapsedMs() >= 1000)
+      UpdateConnectionStats();
     while (!m_async_queue.Empty())
     {
       INFO_LOG_FMT(NETPLAY, "Processing async queue event.");
@@ -1622,6 +2092,14 @@ void NetPlayClient::ThreadFunc()
       INFO_LOG_FMT(NETPLAY, "Processing async queue event done.");
       m_async_queue.Pop();
     }
+    RequestMissingPadFrames();
+    ENetPacket* epac;
+    u8 channel_id;
+    while (m_packet_queue.Pop(&epac, &channel_id))
+    {
+      m_bytes_sent[channel_id] += static_cast<u32>(epac->dataLength);
+      Common::ENet::SendPacket(m_server, epac, channel_id);
+    }
     if (net > 0)
     {
       sf::Packet rpac;
@@ -1633,6 +2111,8 @@ void NetPlayClient::ThreadFunc()
       case ENET_EVENT_TYPE_RECEIVE:
         INFO_LOG_FMT(NETPLAY, "enet_host_service: receive event");
 
+        if (netEvent.channelID < CHANNEL_COUNT)
+          m_bytes_received[netEvent.channelID] += static_cast<u32>(netEvent.packet->dataLength);
         rpac.append(netEvent.packet->data, netEvent.packet->dataLength);
         OnData(rpac);
 
@@ -1701,8 +2181,16 @@ void NetPlayClient::SendChatMessage(const std::string& msg)
 
 // called from ---CPU--- thread
 void NetPlayClient::AddPadStateToPacket(const int in_game_pad, const GCPadStatus& pad,
-                                        sf::Packet& packet)
+                                        Common::WirePacket& packet)
 {
+  if (UseRedundantPadData())
+  {
+    // SendPadData() sends it from the history.
+    std::lock_guard lk(m_pad_frame_history_lock);
+    m_pad_frame_histories[in_game_pad].Push(pad);
+    return;
+  }
+
   packet << static_cast<PadIndex>(in_game_pad);
   packet << pad.button;
   if (!m_gba_config[in_game_pad].enabled)
@@ -1715,12 +2203,12 @@ void NetPlayClient::AddPadStateToPacket(const int in_game_pad, const GCPadStatus
 // called from ---CPU--- thread
 void NetPlayClient::AddWiimoteStateToPacket(int in_game_pad,
                                             const WiimoteEmu::SerializedWiimoteState& state,
-                                            sf::Packet& packet)
+                                            Common::WirePacket& packet)
 {
+  WiimoteEmu::SerializedWiimoteState& previous = m_last_sent_wiimote_state[in_game_pad];
   packet << static_cast<PadIndex>(in_game_pad);
-  packet << state.length;
-  for (size_t i = 0; i < state.length; ++i)
-    packet << state.data[i];
+  WriteWiimoteStateDelta(packet, WiimoteStateDelta::Make(previous, state));
+  previous = state;
 }
 
 // called from ---GUI--- thread
@@ -1754,14 +2242,64 @@ bool NetPlayClient::StartGame(const std::string& path)
     return false;
   }
 
-  m_timebase_frame = 0;
+  // A player joining the running game continues from the frame the state is at, with the inputs
+  // that are read after it, which it already started receiving in OnLateJoin().
+  const bool late_join = m_late_join_frame.has_value();
+  m_timebase_frame = m_late_join_frame.value_or(0);
+  m_state_fingerprint.Reset(m_timebase_frame);
+  m_late_join_frame.reset();
+  m_pad_reads = {};
+  m_host_input_pacer.Reset();
   m_current_golfer = 1;
   m_wait_on_input = false;
 
+  {
+    std::lock_guard lk(m_pad_frame_history_lock);
+    for (PadFrameHistory& history : m_pad_frame_histories)
+      history.Clear();
+  }
+
+  // Wii Remote input and host input authority don't go through the predicted pad inputs.
+  m_rollback_enabled =
+      m_net_settings.rollback && !m_host_input_authority && !late_join &&
+      std::ranges::none_of(m_wiimote_map, [](PlayerId pid) { return pid > 0; });
+  m_rollback_pads = {};
+  m_rollback_states.clear();
+  m_next_rollback_state_id = 0;
+  m_rollback_pending.store(false);
+  m_rollback_resimulating.store(false);
+  m_rollback_fast_forward = false;
+  if (m_rollback_enabled)
+    State::InitStateRing(ROLLBACK_STATES);
+
   m_is_running.Set();
   NetPlay_Enable(this);
 
-  ClearBuffers();
+  if (late_join)
+    m_scheduled_start_us.reset();
+  else
+    ClearBuffers();
+  m_wiimote_batch_size = std::max(Config::Get(Config::NETPLAY_WIIMOTE_BATCH_SIZE), 1u);
+
+  // Every client starts the buffers of the GC pads with the same neutral inputs, none of which
+  // are sent, so the first frames run before any inputs arrived. The own pads are topped up to
+  // the own buffer size with real inputs as usual.
+  if (!late_join && !m_rollback_enabled && !m_host_input_authority)
+  {
+    GCPadStatus neutral;
+    neutral.stickX = GCPadStatus::MAIN_STICK_CENTER_X;
+    neutral.stickY = GCPadStatus::MAIN_STICK_CENTER_Y;
+    neutral.substickX = GCPadStatus::C_STICK_CENTER_X;
+    neutral.substickY = GCPadStatus::C_STICK_CENTER_Y;
+
+    for (size_t i = 0; i < m_pad_map.size(); ++i)
+    {
+      if (m_pad_map[i] <= 0)
+        continue;
+      for (u32 j = 0; j < m_preroll_inputs; ++j)
+        m_pad_buffer[i].Push(neutral);
+    }
+  }
 
   m_first_pad_status_received.fill(false);
 
@@ -1799,7 +2337,11 @@ bool NetPlayClient::StartGame(const std::string& path)
                "Setting Wii sync data: has FS {}, sync_titles = {:016x}, redirect folder = {}",
                !!m_wii_sync_fs, fmt::join(m_wii_sync_titles, ", "), m_wii_sync_redirect_folder);
 
-  boot_session_data->SetWiiSyncData(std::move(m_wii_sync_fs), std::move(m_wii_sync_titles),
+  // The client's sync FS is only a copy of what it received, see OnSyncSaveDataWii()
+  std::string wii_sync_fs_root =
+      m_wii_sync_fs ? File::GetUserPath(D_USER_IDX) + "Wii" GC_MEMCARD_NETPLAY DIR_SEP : "";
+  boot_session_data->SetWiiSyncData(std::move(m_wii_sync_fs), std::move(wii_sync_fs_root),
+                                    std::move(m_wii_sync_titles),
                                     std::move(m_wii_sync_redirect_folder), [] {
                                       // on emulation end clean up the Wii save sync directory --
                                       // see OnSyncSaveDataWii()
@@ -1939,6 +2481,11 @@ void NetPlayClient::ClearBuffers()
     while (m_wiimote_buffer[i].Size())
       m_wiimote_buffer[i].Pop();
   }
+
+  m_last_sent_wiimote_state = {};
+  m_last_received_wiimote_state = {};
+  m_wiimote_batch = {};
+  m_wiimote_batch_polls = 0;
 }
 
 // called from ---NETPLAY--- thread
@@ -2044,9 +2591,29 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     m_wait_on_input_event.Wait();
   }
 
+  // The first frame runs at the time the server scheduled, which every client reaches at about
+  // the same moment whenever it finished booting.
+  while (m_scheduled_start_us)
+  {
+    if (!m_is_running.IsSet())
+      return false;
+
+    const u64 now = Common::Timer::NowUs();
+    if (now >= *m_scheduled_start_us)
+    {
+      m_scheduled_start_us.reset();
+      break;
+    }
+
+    m_wait_on_input_event.WaitFor(std::chrono::microseconds(*m_scheduled_start_us - now));
+  }
+
+  if (m_rollback_enabled)
+    return GetNetPadsRollback(pad_nb, batching, pad_status);
+
   if (IsFirstInGamePad(pad_nb) && batching)
   {
-    sf::Packet packet;
+    Common::WirePacket packet;
     packet << MessageID::PadData;
 
     bool send_packet = false;
@@ -2057,7 +2624,7 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     }
 
     if (send_packet)
-      SendAsync(std::move(packet));
+      SendPadData(packet);
 
     if (m_host_input_authority)
       SendPadHostPoll(-1);
@@ -2068,10 +2635,10 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     const int local_pad = InGamePadToLocalPad(pad_nb);
     if (local_pad < 4)
     {
-      sf::Packet packet;
+      Common::WirePacket packet;
       packet << MessageID::PadData;
       if (PollLocalPad(local_pad, packet))
-        SendAsync(std::move(packet));
+        SendPadData(packet);
     }
 
     if (m_host_input_authority)
@@ -2082,20 +2649,14 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
   {
     if (m_local_player->pid != m_current_golfer)
     {
-      // CoreTiming acts funny and causes what looks like frame skip if
-      // we toggle the emulation speed too quickly, so to prevent this
-      // we wait until the buffer has been over for at least 1 second.
-
-      const bool buffer_over_target = m_pad_buffer[pad_nb].Size() > m_target_buffer_size + 1;
-      if (!buffer_over_target)
-        m_buffer_under_target_last = std::chrono::steady_clock::now();
-
-      std::chrono::duration<double> time_diff =
-          std::chrono::steady_clock::now() - m_buffer_under_target_last;
-      if (time_diff.count() >= 1.0 || !buffer_over_target)
+      // Stay the pad buffer size behind the host by running slightly faster or slower, see
+      // NetPlayHostInputPacer.h.
+      if (IsFirstInGamePad(pad_nb))
       {
-        // run fast if the buffer is overfilled, otherwise run normal speed
-        Config::SetCurrent(Config::MAIN_EMULATION_SPEED, buffer_over_target ? 0.0f : 1.0f);
+        const float speed = m_host_input_pacer.Update(
+            static_cast<u32>(m_pad_buffer[pad_nb].Size()), m_target_buffer_size);
+        if (speed != Config::Get(Config::MAIN_EMULATION_SPEED))
+          Config::SetCurrent(Config::MAIN_EMULATION_SPEED, speed);
       }
     }
     else
@@ -2107,17 +2668,23 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
 
   // Now, we either use the data pushed earlier, or wait for the
   // other clients to send it to us
-  while (m_pad_buffer[pad_nb].Size() == 0)
+  if (m_pad_buffer[pad_nb].Size() == 0)
   {
-    if (!m_is_running.IsSet())
+    ++m_stalled_frames;
+    Common::FrameProfiler::Scope profiler_scope(Common::FrameProfiler::Stage::NetPlayInputWait);
+    while (m_pad_buffer[pad_nb].Size() == 0)
     {
-      return false;
-    }
+      if (!m_is_running.IsSet())
+      {
+        return false;
+      }
 
-    m_gc_pad_event.Wait();
+      WaitForPadData(pad_nb);
+    }
   }
 
   m_pad_buffer[pad_nb].Pop(*pad_status);
+  ++m_pad_reads[pad_nb];
 
   auto& movie = Core::System::GetInstance().GetMovie();
   if (movie.IsRecordingInput())
@@ -2133,14 +2700,217 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
   return true;
 }
 
+static bool PadStatusEqual(const GCPadStatus& a, const GCPadStatus& b)
+{
+  // Only what goes over the network, see AddPadStateToPacket.
+  return a.button == b.button && a.analogA == b.analogA && a.analogB == b.analogB &&
+         a.stickX == b.stickX && a.stickY == b.stickY && a.substickX == b.substickX &&
+         a.substickY == b.substickY && a.triggerLeft == b.triggerLeft &&
+         a.triggerRight == b.triggerRight && a.isConnected == b.isConnected;
+}
+
+static GCPadStatus GetNeutralPadStatus()
+{
+  GCPadStatus status;
+  status.stickX = GCPadStatus::MAIN_STICK_CENTER_X;
+  status.stickY = GCPadStatus::MAIN_STICK_CENTER_Y;
+  status.substickX = GCPadStatus::C_STICK_CENTER_X;
+  status.substickY = GCPadStatus::C_STICK_CENTER_Y;
+  return status;
+}
+
+// called from ---CPU--- thread
+bool NetPlayClient::GetNetPadsRollback(const int pad_nb, const bool batching,
+                                       GCPadStatus* pad_status)
+{
+  // Local pads are only polled for new frames. Frames that are emulated again after a rollback
+  // reuse the inputs that were already sent.
+  if (IsFirstInGamePad(pad_nb) && batching)
+  {
+    Common::WirePacket packet;
+    packet << MessageID::PadData;
+
+    bool send_packet = false;
+    const int num_local_pads = NumLocalPads();
+    for (int local_pad = 0; local_pad < num_local_pads; local_pad++)
+    {
+      if (IsNewRollbackFrame(LocalPadToInGamePad(local_pad)))
+        send_packet = PollLocalPad(local_pad, packet) || send_packet;
+    }
+
+    if (send_packet)
+      SendPadData(packet);
+  }
+
+  if (!batching)
+  {
+    const int local_pad = InGamePadToLocalPad(pad_nb);
+    if (local_pad < 4 && IsNewRollbackFrame(pad_nb))
+    {
+      Common::WirePacket packet;
+      packet << MessageID::PadData;
+      if (PollLocalPad(local_pad, packet))
+        SendPadData(packet);
+    }
+  }
+
+  RollbackPad& pad = m_rollback_pads[pad_nb];
+  const u64 frame = pad.frame;
+  if (InGamePadToLocalPad(pad_nb) >= 4)
+  {
+    ConfirmRollbackInputs(pad_nb);
+
+    // Mispredictions can only be corrected as far back as the saved states reach, so past that
+    // wait for the remote input like the delay based mode does.
+    if (frame >= pad.confirmed_frames + ROLLBACK_MAX_FRAMES)
+    {
+      Common::FrameProfiler::Scope profiler_scope(Common::FrameProfiler::Stage::NetPlayInputWait);
+      while (frame >= pad.confirmed_frames + ROLLBACK_MAX_FRAMES)
+      {
+        if (!m_is_running.IsSet())
+          return false;
+
+        WaitForPadData(pad_nb);
+        ConfirmRollbackInputs(pad_nb);
+      }
+    }
+
+    if (frame >= pad.confirmed_frames)
+    {
+      // Predict that the remote player still holds the last input we know of.
+      pad.inputs[frame % ROLLBACK_WINDOW] =
+          pad.confirmed_frames == 0 ? GetNeutralPadStatus() :
+                                      pad.inputs[(pad.confirmed_frames - 1) % ROLLBACK_WINDOW];
+    }
+  }
+
+  *pad_status = pad.inputs[frame % ROLLBACK_WINDOW];
+  pad.frame++;
+  pad.simulated_frames = std::max(pad.simulated_frames, pad.frame);
+
+  m_rollback_resimulating.store(
+      std::ranges::any_of(m_rollback_pads, [](const RollbackPad& p) {
+        return p.frame < p.simulated_frames;
+      }));
+  return true;
+}
+
+bool NetPlayClient::IsNewRollbackFrame(const int ingame_pad) const
+{
+  const RollbackPad& pad = m_rollback_pads[ingame_pad];
+  return pad.frame == pad.simulated_frames;
+}
+
+// called from ---CPU--- thread
+void NetPlayClient::ConfirmRollbackInputs(const int ingame_pad)
+{
+  RollbackPad& pad = m_rollback_pads[ingame_pad];
+
+  // Don't take inputs so far ahead that they would overwrite ones a rollback may still need.
+  GCPadStatus status;
+  while (pad.confirmed_frames < pad.frame + ROLLBACK_MAX_FRAMES &&
+         m_pad_buffer[ingame_pad].Pop(status))
+  {
+    const u64 frame = pad.confirmed_frames++;
+    GCPadStatus& input = pad.inputs[frame % ROLLBACK_WINDOW];
+    if (frame < pad.simulated_frames && !PadStatusEqual(input, status))
+    {
+      pad.mismatch_frame = std::min(pad.mismatch_frame, frame);
+      m_rollback_pending.store(true);
+    }
+    input = status;
+  }
+}
+
+// called from ---CPU--- thread
+void NetPlayClient::RollBack(Core::System& system)
+{
+  // Find the newest state that was saved before the first mispredicted input of every pad.
+  const auto it = std::find_if(
+      m_rollback_states.rbegin(), m_rollback_states.rend(), [this](const RollbackState& state) {
+        for (size_t i = 0; i < m_rollback_pads.size(); ++i)
+        {
+          if (state.pad_frames[i] > m_rollback_pads[i].mismatch_frame)
+            return false;
+        }
+        return State::IsFrameInRing(state.id);
+      });
+
+  for (RollbackPad& pad : m_rollback_pads)
+    pad.mismatch_frame = ROLLBACK_NO_MISMATCH;
+
+  if (it == m_rollback_states.rend() || !State::LoadFromRing(system, it->id))
+  {
+    ERROR_LOG_FMT(NETPLAY, "Rollback failed, no saved state before the misprediction");
+    return;
+  }
+
+  for (size_t i = 0; i < m_rollback_pads.size(); ++i)
+    m_rollback_pads[i].frame = it->pad_frames[i];
+
+  // The ring dropped the states of the timeline that was rolled back.
+  m_rollback_states.erase(it.base(), m_rollback_states.end());
+  m_rollback_resimulating.store(true);
+}
+
+// called from ---CPU--- thread
+void NetPlayClient::SaveRollbackState(Core::System& system)
+{
+  RollbackState state{m_next_rollback_state_id++, {}};
+  for (size_t i = 0; i < m_rollback_pads.size(); ++i)
+    state.pad_frames[i] = m_rollback_pads[i].frame;
+
+  if (!State::SaveToRing(system, state.id))
+    return;
+
+  m_rollback_states.push_back(state);
+  while (m_rollback_states.size() > ROLLBACK_STATES)
+    m_rollback_states.pop_front();
+}
+
+// called from ---GUI--- thread
+void NetPlayClient::UpdateRollback(Core::System& system)
+{
+  if (!m_rollback_enabled || !m_is_running.IsSet() || !Core::IsRunning(system))
+    return;
+
+  Core::RunOnCPUThread(
+      system,
+      [this, &system] {
+        if (m_rollback_pending.exchange(false))
+          RollBack(system);
+        SaveRollbackState(system);
+      },
+      true);
+
+  // Catch up to the newest frame as quickly as possible.
+  const bool resimulating = m_rollback_resimulating.load();
+  if (resimulating != m_rollback_fast_forward)
+  {
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, resimulating ? 0.0f : 1.0f);
+    m_rollback_fast_forward = resimulating;
+  }
+}
+
 u64 NetPlayClient::GetInitialRTCValue() const
 {
   return m_initial_rtc;
 }
 
+// called from ---CPU--- thread
+void NetPlayClient::SendWiimoteBatch()
+{
+  if (m_wiimote_batch_polls != 0)
+    SendAsync(m_wiimote_batch);
+
+  m_wiimote_batch = {};
+  m_wiimote_batch_polls = 0;
+}
+
 // called from ---CPU--- thread
 bool NetPlayClient::WiimoteUpdate(const std::span<WiimoteDataBatchEntry>& entries)
 {
+  bool data_added = false;
   for (const WiimoteDataBatchEntry& entry : entries)
   {
     const int local_wiimote = InGameWiimoteToLocalWiimote(entry.wiimote);
@@ -2150,16 +2920,30 @@ bool NetPlayClient::WiimoteUpdate(const std::span<WiimoteDataBatchEntry>& entrie
                   fmt::join(std::span(entry.state->data.data(), entry.state->length), ", "));
     if (local_wiimote < 4)
     {
-      sf::Packet packet;
-      packet << MessageID::WiimoteData;
-      if (AddLocalWiimoteToBuffer(local_wiimote, *entry.state, packet))
-        SendAsync(std::move(packet));
+      if (m_wiimote_batch.GetData().empty())
+        m_wiimote_batch << MessageID::WiimoteData;
+      data_added |= AddLocalWiimoteToBuffer(local_wiimote, *entry.state, m_wiimote_batch);
     }
+  }
+
+  // Batching more polls than are buffered would make the other players wait. The batch also
+  // shouldn't get close to not fitting when the buffer is refilled.
+  const u32 batch_size = std::min(m_wiimote_batch_size, std::max(m_target_buffer_size, 1u));
+  if (data_added && (++m_wiimote_batch_polls >= batch_size ||
+                     m_wiimote_batch.GetData().size() > Common::WirePacket::CAPACITY / 2))
+  {
+    SendWiimoteBatch();
+  }
 
+  for (const WiimoteDataBatchEntry& entry : entries)
+  {
     // Now, we either use the data pushed earlier, or wait for the
     // other clients to send it to us
     while (m_wiimote_buffer[entry.wiimote].Size() == 0)
     {
+      // The other players might be waiting for the batch in turn.
+      SendWiimoteBatch();
+
       if (!m_is_running.IsSet())
       {
         return false;
@@ -2177,7 +2961,7 @@ bool NetPlayClient::WiimoteUpdate(const std::span<WiimoteDataBatchEntry>& entrie
   return true;
 }
 
-bool NetPlayClient::PollLocalPad(const int local_pad, sf::Packet& packet)
+bool NetPlayClient::PollLocalPad(const int local_pad, Common::WirePacket& packet)
 {
   const int ingame_pad = LocalPadToInGamePad(local_pad);
   bool data_added = false;
@@ -2197,7 +2981,15 @@ bool NetPlayClient::PollLocalPad(const int local_pad, sf::Packet& packet)
     pad_status = Pad::GetStatus(local_pad);
   }
 
-  if (m_host_input_authority)
+  if (m_rollback_enabled)
+  {
+    // Used right away, so local input has no delay. The other clients get it for the same frame.
+    RollbackPad& pad = m_rollback_pads[ingame_pad];
+    pad.inputs[pad.frame % ROLLBACK_WINDOW] = pad_status;
+    AddPadStateToPacket(ingame_pad, pad_status, packet);
+    data_added = true;
+  }
+  else if (m_host_input_authority)
   {
     if (m_local_player->pid != m_current_golfer)
     {
@@ -2230,9 +3022,71 @@ bool NetPlayClient::PollLocalPad(const int local_pad, sf::Packet& packet)
   return data_added;
 }
 
+bool NetPlayClient::UseRedundantPadData() const
+{
+  // Host input authority relays the inputs through the golfer instead.
+  return m_net_settings.redundant_pad_data && !m_host_input_authority;
+}
+
+// called from ---CPU--- thread
+void NetPlayClient::SendPadData(const Common::WirePacket& packet)
+{
+  if (!UseRedundantPadData())
+  {
+    SendAsync(packet);
+    return;
+  }
+
+  // The inputs only went to the histories, send the newest ones of every local pad.
+  Common::WirePacket frames_packet;
+  frames_packet << MessageID::PadFrames;
+  {
+    std::lock_guard lk(m_pad_frame_history_lock);
+    const int num_local_pads = NumLocalPads();
+    for (int local_pad = 0; local_pad < num_local_pads; local_pad++)
+    {
+      const int ingame_pad = LocalPadToInGamePad(local_pad);
+      WriteRedundantPadFrames(frames_packet, static_cast<PadIndex>(ingame_pad),
+                              m_pad_frame_histories[ingame_pad]);
+    }
+  }
+  SendAsync(frames_packet, PAD_DATA_CHANNEL);
+}
+
+// called from ---CPU--- thread
+void NetPlayClient::WaitForPadData(const int ingame_pad)
+{
+  if (!UseRedundantPadData())
+  {
+    m_gc_pad_event.Wait();
+    return;
+  }
+
+  if (!m_gc_pad_event.WaitFor(PAD_FRAME_REQUEST_TIMEOUT))
+  {
+    m_missing_pad_frames.fetch_or(static_cast<u8>(1 << ingame_pad));
+    Common::ENet::WakeupThread(m_client);
+  }
+}
+
+// called from ---NETPLAY--- thread
+void NetPlayClient::RequestMissingPadFrames()
+{
+  const u8 missing = m_missing_pad_frames.exchange(0);
+  for (PadIndex map = 0; map < 4; ++map)
+  {
+    if (!(missing & (1 << map)))
+      continue;
+
+    sf::Packet request;
+    request << MessageID::PadFrameRequest << map << m_pad_frame_receivers[map].GetNextFrame();
+    Send(request);
+  }
+}
+
 bool NetPlayClient::AddLocalWiimoteToBuffer(const int local_wiimote,
                                             const WiimoteEmu::SerializedWiimoteState& state,
-                                            sf::Packet& packet)
+                                            Common::WirePacket& packet)
 {
   const int ingame_pad = LocalWiimoteToInGameWiimote(local_wiimote);
   bool data_added = false;
@@ -2269,7 +3123,7 @@ void NetPlayClient::SendPadHostPoll(const PadIndex pad_num)
   if (m_local_player->pid != m_current_golfer)
     return;
 
-  sf::Packet packet;
+  Common::WirePacket packet;
   packet << MessageID::PadHostData;
 
   if (pad_num < 0)
@@ -2316,7 +3170,7 @@ void NetPlayClient::SendPadHostPoll(const PadIndex pad_num)
     }
   }
 
-  SendAsync(std::move(packet));
+  SendAsync(packet);
 }
 
 void NetPlayClient::InvokeStop()
@@ -2337,6 +3191,17 @@ bool NetPlayClient::StopGame()
 
   NetPlay_Disable();
 
+  if (m_rollback_enabled)
+  {
+    State::ShutdownStateRing();
+    if (m_rollback_fast_forward)
+      Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 1.0f);
+    m_rollback_enabled = false;
+  }
+
+  if (m_host_input_authority && Config::Get(Config::MAIN_EMULATION_SPEED) != 1.0f)
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 1.0f);
+
   // stop game
   m_dialog->StopGame();
 
@@ -2511,6 +3376,7 @@ void NetPlayClient::SendGameStatus()
   }
 
   packet << static_cast<u32>(result);
+  packet << Config::Get(Config::NETPLAY_ACCEPT_GAME_TRANSFERS);
   Send(packet);
 }
 
@@ -2518,14 +3384,31 @@ void NetPlayClient::SendTimeBase()
 {
   std::lock_guard lk(crit_netplay_client);
 
-  if (netplay_client->m_timebase_frame % 60 == 0)
+  auto& system = Core::System::GetInstance();
+
+  // Rolled back frames run with predicted inputs, so the state isn't comparable.
+  const bool fingerprint = netplay_client->m_net_settings.state_fingerprints &&
+                           !netplay_client->m_rollback_enabled;
+  if (fingerprint)
+    netplay_client->m_state_fingerprint.Update(system);
+
+  if (netplay_client->m_timebase_frame % StateFingerprint::INTERVAL == 0)
   {
-    const u64 timebase = Core::System::GetInstance().GetSystemTimers().GetFakeTimeBase();
+    const u64 timebase = system.GetSystemTimers().GetFakeTimeBase();
 
     sf::Packet packet;
     packet << MessageID::TimeBase;
     packet << timebase;
     packet << netplay_client->m_timebase_frame;
+    // Incomplete fingerprints are left out, the server only compares them when everyone sent one.
+    const bool complete = netplay_client->m_state_fingerprint.IsComplete();
+    packet << (fingerprint && complete);
+    if (fingerprint)
+    {
+      const u64 value = netplay_client->m_state_fingerprint.Take(system);
+      if (complete)
+        packet << value;
+    }
 
     netplay_client->SendAsync(std::move(packet));
   }
@@ -2542,35 +3425,6 @@ bool NetPlayClient::DoAllPlayersHaveGame()
   });
 }
 
-static std::string SHA1Sum(const std::string& file_path, std::function<bool(int)> report_progress)
-{
-  std::vector<u8> data(8 * 1024 * 1024);
-  u64 read_offset = 0;
-
-  std::unique_ptr<DiscIO::BlobReader> file(DiscIO::CreateBlobReader(file_path));
-  u64 game_size = file->GetDataSize();
-
-  auto ctx = Common::SHA1::CreateContext();
-
-  while (read_offset < game_size)
-  {
-    size_t read_size = std::min(static_cast<u64>(data.size()), game_size - read_offset);
-    if (!file->Read(read_offset, read_size, data.data()))
-      return "";
-
-    ctx->Update(data.data(), read_size);
-    read_offset += read_size;
-
-    int progress =
-        static_cast<int>(static_cast<float>(read_offset) / static_cast<float>(game_size) * 100);
-    if (!report_progress(progress))
-      return "";
-  }
-
-  // Convert to hex
-  return fmt::format("{:02x}", fmt::join(ctx->Finish(), ""));
-}
-
 void NetPlayClient::ComputeGameDigest(const SyncIdentifier& sync_identifier)
 {
   if (m_should_compute_game_digest)
@@ -2597,7 +3451,7 @@ void NetPlayClient::ComputeGameDigest(const SyncIdentifier& sync_identifier)
   if (m_game_digest_thread.joinable())
     m_game_digest_thread.join();
   m_game_digest_thread = std::thread([this, file] {
-    std::string sum = SHA1Sum(file, [&](int progress) {
+    std::string sum = ComputeGameFileDigest(file, [&](int progress) {
       sf::Packet packet;
       packet << MessageID::GameDigestProgress;
       packet << progress;
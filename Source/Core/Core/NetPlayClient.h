@@ -5,10 +5,14 @@
 
 #include <SFML/Network/Packet.hpp>
 #include <array>
+#include <atomic>
 #include <chrono>
+#include <deque>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <string>
 #include <thread>
@@ -17,13 +21,27 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/ENet.h"
 #include "Common/Event.h"
 #include "Common/SPSCQueue.h"
+#include "Common/Timer.h"
 #include "Common/TraversalClient.h"
+#include "Core/NetPlayChunkedDataCache.h"
+#include "Core/NetPlayClockSync.h"
+#include "Core/NetPlayConnectionStats.h"
+#include "Core/NetPlayHostInputPacer.h"
+#include "Core/NetPlayPadFrames.h"
 #include "Core/NetPlayProto.h"
+#include "Core/NetPlayStateFingerprint.h"
+#include "Core/NetPlayWiimoteDelta.h"
 #include "Core/SyncIdentifier.h"
 #include "InputCommon/GCPadStatus.h"
 
+namespace Core
+{
+class System;
+}
+
 class BootSessionData;
 
 namespace IOS::HLE::FS
@@ -103,6 +121,10 @@ public:
   std::string name;
   std::string revision;
   u32 ping = 0;
+  u32 jitter = 0;
+  // Scaled by ENET_PEER_PACKET_LOSS_SCALE.
+  u32 packet_loss = 0;
+  RttHistory ping_history;
   SyncIdentifierComparison game_status = SyncIdentifierComparison::Unknown;
 
   bool IsHost() const { return pid == 1; }
@@ -113,6 +135,9 @@ class NetPlayClient : public Common::TraversalClientClient
 public:
   void ThreadFunc();
   void SendAsync(sf::Packet&& packet, u8 channel_id = DEFAULT_CHANNEL);
+  // For the messages sent every frame. The packet is handed to the NetPlay thread through a fixed
+  // ring rather than the queue of sf::Packets, so it may overtake sf::Packets still queued there.
+  void SendAsync(const Common::WirePacket& packet, u8 channel_id = DEFAULT_CHANNEL);
 
   NetPlayClient(const std::string& address, const u16 port, NetPlayUI* dialog,
                 const std::string& name, const NetTraversalConfig& traversal_config);
@@ -123,6 +148,9 @@ public:
 
   // Called from the GUI thread.
   bool IsConnected() const { return m_is_connected; }
+  // The IP address and port of the host. For traversal connections, this is what the traversal
+  // server resolved the host code to.
+  std::optional<std::pair<std::string, u16>> GetServerAddress() const;
   bool StartGame(const std::string& path);
   void InvokeStop();
   bool StopGame();
@@ -135,6 +163,12 @@ public:
   void RequestGolfControl();
   std::string GetCurrentGolfer();
 
+  // Rollback mode. Called once per host frame to roll back after a misprediction and to save the
+  // state the next one can be rolled back to.
+  void UpdateRollback(Core::System& system);
+  // True while frames that were rolled back are emulated again, which should not be presented.
+  bool IsRollbackResimulating() const { return m_rollback_resimulating.load(); }
+
   // Send and receive pads values
   struct WiimoteDataBatchEntry
   {
@@ -166,6 +200,9 @@ public:
   const PlayerId& GetLocalPlayerId() const;
 
   static void SendTimeBase();
+  // Called on the CPU thread before the game starts running. Loads the state that a player
+  // joining the running game starts from, see NetPlayLateJoin.h.
+  static void LoadJoinState(Core::System& system);
   bool DoAllPlayersHaveGame();
 
   const PadMappingArray& GetPadMapping() const;
@@ -174,6 +211,9 @@ public:
 
   void AdjustPadBufferSize(unsigned int size);
 
+  // The latest stats, see NetPlayConnectionStats.h.
+  ConnectionStats GetConnectionStats() const;
+
   void SetWiiSyncData(std::unique_ptr<IOS::HLE::FS::FileSystem> fs, std::vector<u64> titles,
                       std::string redirect_folder);
 
@@ -197,14 +237,78 @@ protected:
   } m_crit;
 
   Common::SPSCQueue<AsyncQueueEntry> m_async_queue;
+  Common::ENet::PacketPool m_packet_pool;
+
+  // Counted as they happen and turned into m_connection_stats once per second by the NetPlay
+  // thread.
+  std::array<std::atomic<u32>, CHANNEL_COUNT> m_bytes_sent{};
+  std::array<std::atomic<u32>, CHANNEL_COUNT> m_bytes_received{};
+  std::atomic<u32> m_stalled_frames = 0;
+  u32 m_last_packets_lost = 0;
+  Common::Timer m_connection_stats_timer;
+  mutable std::mutex m_connection_stats_lock;
+  ConnectionStats m_connection_stats;
+
+  Common::ENet::PacketQueue m_packet_queue;
 
   std::array<Common::SPSCQueue<GCPadStatus>, 4> m_pad_buffer;
   std::array<Common::SPSCQueue<WiimoteEmu::SerializedWiimoteState>, 4> m_wiimote_buffer;
+  // The previous states the Wii Remote deltas are made against, see NetPlayWiimoteDelta.h. Sent
+  // ones are used by the CPU thread, received ones by the NetPlay thread.
+  std::array<WiimoteEmu::SerializedWiimoteState, 4> m_last_sent_wiimote_state{};
+  std::array<WiimoteEmu::SerializedWiimoteState, 4> m_last_received_wiimote_state{};
+  // The local Wii Remote states of up to m_wiimote_batch_size polls are sent together. The batch
+  // is sent early when the CPU thread would otherwise wait for another player's states.
+  Common::WirePacket m_wiimote_batch;
+  u32 m_wiimote_batch_polls = 0;
+  u32 m_wiimote_batch_size = 1;
 
   std::array<GCPadStatus, 4> m_last_pad_status{};
   std::array<bool, 4> m_first_pad_status_received{};
 
-  std::chrono::time_point<std::chrono::steady_clock> m_buffer_under_target_last;
+  // Redundant pad data mode, see NetPlayPadFrames.h. The histories of the local pads are written
+  // by the CPU thread and read by the NetPlay thread to answer requests for missing inputs.
+  std::array<PadFrameReceiver, 4> m_pad_frame_receivers;
+  // The pads the CPU thread timed out waiting on, one bit each.
+  std::atomic<u8> m_missing_pad_frames = 0;
+  std::mutex m_pad_frame_history_lock;
+  std::array<PadFrameHistory, 4> m_pad_frame_histories;
+
+  // In rollback mode, the inputs of remote pads that haven't arrived yet are predicted to be the
+  // last ones that did, so the game never waits for them. The k-th input received for a pad is
+  // the input for the k-th time that pad is read, exactly like in the delay based mode.
+  static constexpr u64 ROLLBACK_WINDOW = 64;
+  // How far the game may run ahead of the remote inputs before it waits for them.
+  static constexpr u64 ROLLBACK_MAX_FRAMES = 16;
+  static constexpr size_t ROLLBACK_STATES = 24;
+  static constexpr u64 ROLLBACK_NO_MISMATCH = std::numeric_limits<u64>::max();
+  struct RollbackPad
+  {
+    // The input used (or received) for frame f is kept at f % ROLLBACK_WINDOW.
+    std::array<GCPadStatus, ROLLBACK_WINDOW> inputs{};
+    // The next frame the game reads.
+    u64 frame = 0;
+    // The number of frames read before the last rollback, frame catches up to it.
+    u64 simulated_frames = 0;
+    // Remote pads only. Inputs before this frame are the real ones.
+    u64 confirmed_frames = 0;
+    // The first frame for which a prediction turned out to be wrong.
+    u64 mismatch_frame = ROLLBACK_NO_MISMATCH;
+  };
+  struct RollbackState
+  {
+    u64 id;
+    std::array<u64, 4> pad_frames;
+  };
+  bool m_rollback_enabled = false;
+  std::array<RollbackPad, 4> m_rollback_pads{};
+  std::deque<RollbackState> m_rollback_states;
+  u64 m_next_rollback_state_id = 0;
+  std::atomic<bool> m_rollback_pending{false};
+  std::atomic<bool> m_rollback_resimulating{false};
+  bool m_rollback_fast_forward = false;
+
+  HostInputPacer m_host_input_pacer;
 
   NetPlayUI* m_dialog = nullptr;
 
@@ -256,16 +360,26 @@ private:
   void SyncSaveDataResponse(bool success);
   void SyncCodeResponse(bool success);
 
-  bool PollLocalPad(int local_pad, sf::Packet& packet);
+  bool PollLocalPad(int local_pad, Common::WirePacket& packet);
+  bool UseRedundantPadData() const;
+  void SendPadData(const Common::WirePacket& packet);
+  void WaitForPadData(int ingame_pad);
+  void RequestMissingPadFrames();
+  bool GetNetPadsRollback(int pad_nb, bool batching, GCPadStatus* pad_status);
+  bool IsNewRollbackFrame(int ingame_pad) const;
+  void ConfirmRollbackInputs(int ingame_pad);
+  void RollBack(Core::System& system);
+  void SaveRollbackState(Core::System& system);
   void SendPadHostPoll(PadIndex pad_num);
 
+  void SendWiimoteBatch();
   bool AddLocalWiimoteToBuffer(int local_wiimote, const WiimoteEmu::SerializedWiimoteState& state,
-                               sf::Packet& packet);
+                               Common::WirePacket& packet);
 
   void UpdateDevices();
-  void AddPadStateToPacket(int in_game_pad, const GCPadStatus& np, sf::Packet& packet);
+  void AddPadStateToPacket(int in_game_pad, const GCPadStatus& np, Common::WirePacket& packet);
   void AddWiimoteStateToPacket(int in_game_pad, const WiimoteEmu::SerializedWiimoteState& np,
-                               sf::Packet& packet);
+                               Common::WirePacket& packet);
   void Send(const sf::Packet& packet, u8 channel_id = DEFAULT_CHANNEL);
   void Disconnect();
   bool Connect();
@@ -273,6 +387,7 @@ private:
   void ComputeGameDigest(const SyncIdentifier& sync_identifier);
   void DisplayPlayersPing();
   u32 GetPlayersMaxPing() const;
+  void UpdateConnectionStats();
 
   void OnData(sf::Packet& packet);
   void OnPlayerJoin(sf::Packet& packet);
@@ -287,6 +402,9 @@ private:
   void OnGBAConfig(sf::Packet& packet);
   void OnPadData(sf::Packet& packet);
   void OnPadHostData(sf::Packet& packet);
+  void OnPadFrames(sf::Packet& packet);
+  void OnPadFrameRequest(sf::Packet& packet);
+  void OnSpectatorPadData(sf::Packet& packet);
   void OnWiimoteData(sf::Packet& packet);
   void OnPadBuffer(sf::Packet& packet);
   void OnHostInputAuthority(sf::Packet& packet);
@@ -299,6 +417,7 @@ private:
   void OnPowerButton();
   void OnPing(sf::Packet& packet);
   void OnPlayerPingData(sf::Packet& packet);
+  void OnClockSync(sf::Packet& packet);
   void OnDesyncDetected(sf::Packet& packet);
   void OnSyncSaveData(sf::Packet& packet);
   void OnSyncSaveDataNotify(sf::Packet& packet);
@@ -312,11 +431,16 @@ private:
   void OnSyncCodesDataGecko(sf::Packet& packet);
   void OnSyncCodesNotifyAR(sf::Packet& packet);
   void OnSyncCodesDataAR(sf::Packet& packet);
+  void OnSyncGame(sf::Packet& packet);
   void OnComputeGameDigest(sf::Packet& packet);
   void OnGameDigestProgress(sf::Packet& packet);
   void OnGameDigestResult(sf::Packet& packet);
   void OnGameDigestError(sf::Packet& packet);
   void OnGameDigestAbort();
+  void OnLateJoinRequest(sf::Packet& packet);
+  void OnLateJoin(sf::Packet& packet);
+  void OnLateJoinState(sf::Packet& packet);
+  void SendLateJoinState(PlayerId pid);
 
   bool m_is_connected = false;
   ConnectionState m_connection_state = ConnectionState::Failure;
@@ -342,10 +466,34 @@ private:
   u16 m_sync_ar_codes_count = 0;
   u16 m_sync_ar_codes_success_count = 0;
   bool m_sync_ar_codes_complete = false;
-  std::unordered_map<u32, sf::Packet> m_chunked_data_receive_queue;
+  struct ChunkedDataReceive
+  {
+    Common::SHA1::Digest digest;
+    sf::Packet data;
+  };
+  std::unordered_map<u32, ChunkedDataReceive> m_chunked_data_receive_queue;
+  ChunkedDataCache m_chunked_data_cache;
 
   u64 m_initial_rtc = 0;
+  // Only used on the ---NETPLAY--- thread.
+  ClockSync m_clock_sync;
+  // The own time GetNetPads() waits for before the first frame, see StartGame.
+  std::optional<u64> m_scheduled_start_us;
+  // How many neutral inputs the pad buffers start with.
+  u32 m_preroll_inputs = 0;
   u32 m_timebase_frame = 0;
+  StateFingerprint m_state_fingerprint;
+
+  // How many inputs the CPU thread read from the buffer of each GC pad, which the host sends
+  // along with its state to a player joining the running game.
+  std::array<u32, 4> m_pad_reads{};
+  std::thread m_late_join_thread;
+  // Only set while joining a running game, from when the server said which frame the state is
+  // at until the game is started.
+  std::optional<u32> m_late_join_frame;
+  bool m_late_join_start_pending = false;
+  std::mutex m_late_join_state_lock;
+  std::vector<u8> m_late_join_state;
 
   std::unique_ptr<IOS::HLE::FS::FileSystem> m_wii_sync_fs;
   std::vector<u64> m_wii_sync_titles;
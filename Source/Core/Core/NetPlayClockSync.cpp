@@ -0,0 +1,47 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayClockSync.h"
+
+#include <algorithm>
+
+namespace NetPlay
+{
+void ClockSync::Reset()
+{
+  m_count = 0;
+  m_next = 0;
+}
+
+void ClockSync::AddSample(u64 sent_us, u64 server_us, u64 received_us)
+{
+  if (received_us < sent_us)
+    return;
+
+  const u64 rtt_us = received_us - sent_us;
+  const s64 offset_us = static_cast<s64>(server_us - (sent_us + rtt_us / 2));
+
+  m_samples[m_next] = {rtt_us, offset_us};
+  m_next = (m_next + 1) % SIZE;
+  m_count = std::min(m_count + 1, SIZE);
+}
+
+std::optional<s64> ClockSync::GetOffset() const
+{
+  if (m_count == 0)
+    return std::nullopt;
+
+  const auto begin = m_samples.begin();
+  const auto best = std::ranges::min_element(begin, begin + m_count, {}, &Sample::rtt_us);
+  return best->offset_us;
+}
+
+std::optional<u64> ClockSync::ToLocalTime(u64 server_us) const
+{
+  const std::optional<s64> offset = GetOffset();
+  if (!offset)
+    return std::nullopt;
+
+  return server_us - static_cast<u64>(*offset);
+}
+}  // namespace NetPlay
@@ -0,0 +1,42 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <optional>
+
+#include "Common/CommonTypes.h"
+
+namespace NetPlay
+{
+// Estimates how far the server's clock is ahead of the own one, the way NTP does, from the last
+// SIZE ClockSync round trips. The one with the shortest round trip is trusted the most, since it
+// spent the least time queued up anywhere, so its halves were most likely the same.
+class ClockSync
+{
+public:
+  static constexpr size_t SIZE = 8;
+
+  void Reset();
+
+  // sent_us and received_us are the own times a ClockSync was sent and its reply received,
+  // server_us the server's time in the reply. Everything in microseconds.
+  void AddSample(u64 sent_us, u64 server_us, u64 received_us);
+
+  // Returns nothing until there is a sample.
+  std::optional<s64> GetOffset() const;
+  std::optional<u64> ToLocalTime(u64 server_us) const;
+
+private:
+  struct Sample
+  {
+    u64 rtt_us;
+    s64 offset_us;
+  };
+
+  std::array<Sample, SIZE> m_samples{};
+  size_t m_count = 0;
+  size_t m_next = 0;
+};
+}  // namespace NetPlay
@@ -5,19 +5,29 @@
 
 #include <algorithm>
 
+#include <enet/enet.h>
 #include <fmt/format.h>
 #include <lzo/lzo1x.h>
 
+#include "Common/CommonPaths.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
 #include "Common/SFMLHelper.h"
+#include "Common/StringUtil.h"
+#include "Core/NetPlayProto.h"
 
 namespace NetPlay
 {
 constexpr u32 LZO_IN_LEN = 1024 * 64;
 constexpr u32 LZO_OUT_LEN = LZO_IN_LEN + (LZO_IN_LEN / 16) + 64 + 3;
 
+u32 GetChannelPacketFlags(u8 channel_id)
+{
+  // Unreliable but still sequenced, older packets that arrive late are dropped.
+  return channel_id == PAD_DATA_CHANNEL ? 0 : ENET_PACKET_FLAG_RELIABLE;
+}
+
 bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
 {
   File::IOFile file(file_path, "rb");
@@ -297,4 +307,11 @@ std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet)
 
   return out_buffer;
 }
+
+std::string GetTransferredGamePath(const SyncIdentifier& sync_identifier)
+{
+  // The sync hash is unique enough, and is safe to use as a file name whatever the host sent.
+  return File::GetUserPath(D_CACHE_IDX) + "NetPlayGames" DIR_SEP +
+         Common::BytesToHexString(sync_identifier.sync_hash) + ".rvz";
+}
 }  // namespace NetPlay
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Core/SyncIdentifier.h"
 
 namespace NetPlay
 {
@@ -20,10 +21,16 @@ using namespace std::chrono_literals;
 // connection is disconnected
 constexpr std::chrono::milliseconds PEER_TIMEOUT = 30s;
 
+// The ENet packet flags for sending on a channel.
+u32 GetChannelPacketFlags(u8 channel_id);
+
 bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet);
 bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet);
 bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet);
 bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path);
 bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path);
 std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet);
+
+// Where a game sent by the host (as a scrubbed RVZ) is kept, on both sides of the transfer.
+std::string GetTransferredGamePath(const SyncIdentifier& sync_identifier);
 }  // namespace NetPlay
@@ -0,0 +1,54 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayConnectionStats.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+namespace NetPlay
+{
+void RttHistory::Push(u32 rtt_ms)
+{
+  m_rtt_ms[m_next] = rtt_ms;
+  m_next = (m_next + 1) % SIZE;
+  m_count = std::min(m_count + 1, SIZE);
+}
+
+u32 RttHistory::GetPercentile(u32 percent) const
+{
+  if (m_count == 0)
+    return 0;
+
+  std::array<u32, SIZE> sorted = m_rtt_ms;
+  const auto end = sorted.begin() + m_count;
+  std::sort(sorted.begin(), end);
+  return sorted[(m_count - 1) * percent / 100];
+}
+
+std::string FormatConnectionStats(const ConnectionStats& stats, std::string_view line_separator)
+{
+  std::string result;
+  for (const PlayerConnectionStats& player : stats.players)
+  {
+    fmt::format_to(std::back_inserter(result),
+                   "{}: ping {} ms (p50 {} / p95 {} / p99 {}), jitter {} ms, loss {:.1f}%{}",
+                   player.name, player.ping, player.rtt_p50, player.rtt_p95, player.rtt_p99,
+                   player.jitter, player.packet_loss * 100, line_separator);
+  }
+
+  const u32 sent = std::accumulate(stats.bytes_sent_per_second.begin(),
+                                   stats.bytes_sent_per_second.end(), u32{0});
+  const u32 received = std::accumulate(stats.bytes_received_per_second.begin(),
+                                       stats.bytes_received_per_second.end(), u32{0});
+  fmt::format_to(std::back_inserter(result),
+                 "Buffer {}, stalled {} frames/s, up {:.1f} KiB/s, down {:.1f} KiB/s, "
+                 "{} retransmits/s",
+                 fmt::join(stats.pad_buffer, "/"), stats.stalled_frames, sent / 1024.0,
+                 received / 1024.0, stats.retransmits);
+  return result;
+}
+}  // namespace NetPlay
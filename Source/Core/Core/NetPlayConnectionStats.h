@@ -0,0 +1,68 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/NetPlayProto.h"
+
+namespace NetPlay
+{
+// The round trip times the server measured for a player over the last SIZE pings.
+class RttHistory
+{
+public:
+  static constexpr size_t SIZE = 60;
+
+  void Push(u32 rtt_ms);
+  // percent is in [0, 100]. Returns 0 if there are no samples yet.
+  u32 GetPercentile(u32 percent) const;
+
+private:
+  std::array<u32, SIZE> m_rtt_ms{};
+  size_t m_count = 0;
+  size_t m_next = 0;
+};
+
+struct PlayerConnectionStats
+{
+  PlayerId pid = 0;
+  std::string name;
+  // Between the player and the server, in milliseconds.
+  u32 ping = 0;
+  u32 rtt_p50 = 0;
+  u32 rtt_p95 = 0;
+  u32 rtt_p99 = 0;
+  // The round trip time variance ENet measures.
+  u32 jitter = 0;
+  // The share of the packets to the player that were lost, in [0, 1].
+  float packet_loss = 0;
+};
+
+// Updated by NetPlayClient once per second.
+struct ConnectionStats
+{
+  // Counts the updates, so that a UI can tell when there is a new one.
+  u32 sequence = 0;
+  std::vector<PlayerConnectionStats> players;
+
+  // The rest is about this client's own connection to the server.
+  // The inputs waiting in the pad buffers.
+  std::array<u32, 4> pad_buffer{};
+  // The frames GetNetPads() had to wait for inputs in the last second.
+  u32 stalled_frames = 0;
+  std::array<u32, CHANNEL_COUNT> bytes_sent_per_second{};
+  std::array<u32, CHANNEL_COUNT> bytes_received_per_second{};
+  // The reliable packets ENet had to send again in the last second.
+  u32 retransmits = 0;
+};
+
+// One line per player, and one for the own connection, for the on-screen display.
+std::string FormatConnectionStats(const ConnectionStats& stats,
+                                  std::string_view line_separator = "\n");
+}  // namespace NetPlay
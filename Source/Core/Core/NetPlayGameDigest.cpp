@@ -0,0 +1,222 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayGameDigest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include "Common/Crypto/SHA1.h"
+#include "Common/Event.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+#include "Common/Swap.h"
+#include "DiscIO/Blob.h"
+
+namespace NetPlay
+{
+namespace
+{
+// More threads than this mostly make the reads seek around on a hard drive.
+constexpr u32 MAX_THREAD_COUNT = 4;
+
+struct FileKey
+{
+  std::string path;
+  u64 size = 0;
+  s64 modification_time = 0;
+
+  auto operator<=>(const FileKey&) const = default;
+};
+
+struct PartialDigest
+{
+  std::vector<Common::SHA1::Digest> blocks;
+  std::vector<u8> done;
+};
+
+std::mutex s_cache_lock;
+bool s_cache_loaded = false;
+std::map<FileKey, std::string> s_digests;
+std::map<FileKey, PartialDigest> s_partial_digests;
+
+std::string GetCachePath()
+{
+  return File::GetUserPath(D_CACHE_IDX) + "NetPlayGameDigests.txt";
+}
+
+std::optional<FileKey> GetFileKey(const std::string& file_path)
+{
+  std::error_code error;
+  const auto time = std::filesystem::last_write_time(StringToPath(file_path), error);
+  if (error)
+    return std::nullopt;
+
+  return FileKey{file_path, File::GetSize(file_path), time.time_since_epoch().count()};
+}
+
+// Each line is the modification time, size, digest and path, separated by tabs.
+void LoadCache()
+{
+  if (s_cache_loaded)
+    return;
+  s_cache_loaded = true;
+
+  std::string contents;
+  if (!File::ReadFileToString(GetCachePath(), contents))
+    return;
+
+  std::istringstream stream(contents);
+  std::string line;
+  while (std::getline(stream, line))
+  {
+    std::istringstream line_stream(line);
+    FileKey key;
+    std::string digest;
+    line_stream >> key.modification_time >> key.size >> digest;
+    line_stream.ignore(1);
+    if (line_stream && std::getline(line_stream, key.path) && !key.path.empty())
+      s_digests.insert_or_assign(std::move(key), std::move(digest));
+  }
+}
+
+void SaveCache()
+{
+  std::string contents;
+  for (const auto& [key, digest] : s_digests)
+    contents += fmt::format("{}\t{}\t{}\t{}\n", key.modification_time, key.size, digest, key.path);
+
+  if (!File::WriteStringToFile(GetCachePath(), contents))
+    WARN_LOG_FMT(NETPLAY, "Failed to write the game digest cache.");
+}
+}  // namespace
+
+std::string ComputeGameFileDigest(const std::string& file_path,
+                                  const std::function<bool(int)>& report_progress)
+{
+  const std::optional<FileKey> key = GetFileKey(file_path);
+  if (!key)
+    return "";
+
+  PartialDigest partial;
+  {
+    std::lock_guard lk(s_cache_lock);
+    LoadCache();
+    if (const auto it = s_digests.find(*key); it != s_digests.end())
+    {
+      report_progress(100);
+      return it->second;
+    }
+
+    if (const auto it = s_partial_digests.find(*key); it != s_partial_digests.end())
+    {
+      partial = std::move(it->second);
+      s_partial_digests.erase(it);
+    }
+  }
+
+  std::unique_ptr<DiscIO::BlobReader> file(DiscIO::CreateBlobReader(file_path));
+  if (!file)
+    return "";
+
+  const u64 data_size = file->GetDataSize();
+  const u64 block_count = (data_size + GAME_DIGEST_BLOCK_SIZE - 1) / GAME_DIGEST_BLOCK_SIZE;
+  if (partial.blocks.size() != block_count)
+    partial = PartialDigest{std::vector<Common::SHA1::Digest>(block_count),
+                            std::vector<u8>(block_count)};
+
+  std::atomic<u64> next_block = 0;
+  std::atomic<u64> blocks_done = static_cast<u64>(std::ranges::count(partial.done, 1));
+  std::atomic<bool> stop = false;
+  Common::Event block_done_event;
+
+  const auto hash_blocks = [&](std::unique_ptr<DiscIO::BlobReader> reader) {
+    std::vector<u8> data;
+    for (u64 block = next_block++; block < block_count && !stop; block = next_block++)
+    {
+      if (partial.done[block])
+        continue;
+
+      const u64 offset = block * GAME_DIGEST_BLOCK_SIZE;
+      const u64 size = std::min(GAME_DIGEST_BLOCK_SIZE, data_size - offset);
+      data.resize(size);
+      if (!reader || !reader->Read(offset, size, data.data()))
+      {
+        stop = true;
+        block_done_event.Set();
+        return false;
+      }
+
+      partial.blocks[block] = Common::SHA1::CalculateDigest(data.data(), size);
+      partial.done[block] = 1;
+      ++blocks_done;
+      block_done_event.Set();
+    }
+    return true;
+  };
+
+  const u32 threads = static_cast<u32>(std::min<u64>(
+      block_count,
+      std::clamp<u32>(std::thread::hardware_concurrency(), 1, MAX_THREAD_COUNT)));
+  // Blob readers can't be shared between threads.
+  std::vector<std::unique_ptr<DiscIO::BlobReader>> readers;
+  for (u32 i = 1; i < threads; ++i)
+    readers.push_back(file->CopyReader());
+  readers.push_back(std::move(file));
+
+  std::vector<std::future<bool>> futures(threads);
+  for (u32 i = 0; i < threads; ++i)
+    futures[i] = std::async(std::launch::async, hash_blocks, std::move(readers[i]));
+
+  bool aborted = false;
+  while (std::ranges::any_of(futures, [](const std::future<bool>& future) {
+    return future.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+  }))
+  {
+    block_done_event.WaitFor(std::chrono::milliseconds(100));
+    const int progress = static_cast<int>(blocks_done * 100 / block_count);
+    if (!stop && !report_progress(progress))
+    {
+      aborted = true;
+      stop = true;
+    }
+  }
+
+  bool success = !aborted;
+  for (std::future<bool>& future : futures)
+    success &= future.get();
+
+  std::lock_guard lk(s_cache_lock);
+  if (!success)
+  {
+    // The blocks that were hashed don't have to be hashed again on the next try.
+    s_partial_digests.insert_or_assign(*key, std::move(partial));
+    return "";
+  }
+
+  auto ctx = Common::SHA1::CreateContext();
+  const u64 data_size_be = Common::FromBigEndian(data_size);
+  ctx->Update(reinterpret_cast<const u8*>(&data_size_be), sizeof(data_size_be));
+  for (const Common::SHA1::Digest& block : partial.blocks)
+    ctx->Update(block.data(), block.size());
+
+  std::string digest = fmt::format("{:02x}", fmt::join(ctx->Finish(), ""));
+  s_digests.insert_or_assign(*key, digest);
+  SaveCache();
+  report_progress(100);
+  return digest;
+}
+}  // namespace NetPlay
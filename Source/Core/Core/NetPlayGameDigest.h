@@ -0,0 +1,25 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace NetPlay
+{
+// The digest players compare to check that they have the same game. The data is split into
+// blocks that are hashed on several threads, and the digest is the SHA1 of the data size and the
+// block digests.
+//
+// Digests are cached by file path, size and modification time, so checking the same file again is
+// instant. When a check is aborted, the blocks that were hashed are kept until the next try.
+constexpr u64 GAME_DIGEST_BLOCK_SIZE = 16 * 1024 * 1024;
+
+// report_progress is called with the percentage done, and aborts when it returns false. Returns
+// an empty string on failure or when aborted.
+std::string ComputeGameFileDigest(const std::string& file_path,
+                                  const std::function<bool(int)>& report_progress);
+}  // namespace NetPlay
@@ -0,0 +1,28 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayHostInputPacer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace NetPlay
+{
+void HostInputPacer::Reset()
+{
+  m_average = 0;
+  m_has_average = false;
+}
+
+float HostInputPacer::Update(u32 buffered, u32 target)
+{
+  if (m_has_average)
+    m_average += (buffered - m_average) * SMOOTHING;
+  else
+    m_average = buffered;
+  m_has_average = true;
+
+  const double speed = std::clamp(1 + (m_average - target) * GAIN, MIN_SPEED, MAX_SPEED);
+  return static_cast<float>(std::round(speed / SPEED_STEP) * SPEED_STEP);
+}
+}  // namespace NetPlay
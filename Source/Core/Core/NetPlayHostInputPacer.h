@@ -0,0 +1,37 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace NetPlay
+{
+// Paces a client with host input authority against the host, which runs at normal speed and
+// sends every input the frame it uses it.
+//
+// The inputs waiting in the pad buffer are the frames the client is behind beyond the ones still
+// on their way. They arrive in bursts, so their average is kept at the pad buffer size by running
+// slightly faster or slower, which leaves waiting for inputs to the times they really don't come.
+class HostInputPacer
+{
+public:
+  // The share the average moves towards each new buffer size, about half a second at 60 FPS.
+  static constexpr double SMOOTHING = 1.0 / 30;
+  // The change of speed per frame of distance from the target.
+  static constexpr double GAIN = 0.02;
+  static constexpr double MIN_SPEED = 0.95;
+  static constexpr double MAX_SPEED = 1.2;
+  // The speed only changes in steps of this, so it isn't set again every frame.
+  static constexpr double SPEED_STEP = 0.01;
+
+  void Reset();
+
+  // Called once per frame with the inputs buffered for it. Returns the emulation speed.
+  float Update(u32 buffered, u32 target);
+
+private:
+  double m_average = 0;
+  bool m_has_average = false;
+};
+}  // namespace NetPlay
@@ -0,0 +1,45 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayLateJoin.h"
+
+namespace NetPlay
+{
+GCPadStatus GetNeutralPadStatus()
+{
+  GCPadStatus neutral;
+  neutral.stickX = GCPadStatus::MAIN_STICK_CENTER_X;
+  neutral.stickY = GCPadStatus::MAIN_STICK_CENTER_Y;
+  neutral.substickX = GCPadStatus::C_STICK_CENTER_X;
+  neutral.substickY = GCPadStatus::C_STICK_CENTER_Y;
+  return neutral;
+}
+
+void LateJoinInputs::Reset(u32 preroll_inputs)
+{
+  m_end = 0;
+  m_preroll_inputs = preroll_inputs;
+}
+
+void LateJoinInputs::Push(const GCPadStatus& status)
+{
+  m_statuses[m_end % SIZE] = status;
+  ++m_end;
+}
+
+std::optional<std::vector<GCPadStatus>> LateJoinInputs::GetInputsAfter(u32 reads) const
+{
+  const u32 begin = m_end > SIZE ? m_end - SIZE : 0;
+  const u32 first = reads > m_preroll_inputs ? reads - m_preroll_inputs : 0;
+  if (first < begin || first > m_end)
+    return std::nullopt;
+
+  std::vector<GCPadStatus> inputs;
+  if (reads < m_preroll_inputs)
+    inputs.assign(m_preroll_inputs - reads, GetNeutralPadStatus());
+
+  for (u32 input = first; input < m_end; ++input)
+    inputs.push_back(m_statuses[input % SIZE]);
+  return inputs;
+}
+}  // namespace NetPlay
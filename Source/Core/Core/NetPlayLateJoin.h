@@ -0,0 +1,49 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "InputCommon/GCPadStatus.h"
+
+namespace NetPlay
+{
+// Joining a game that is already running.
+//
+// The host saves the state and notes how many inputs of each pad it had read by then. The server
+// sends the state to the joining player, followed by the inputs that are read after it, and from
+// then on relays the inputs to the player like to everyone else. A player that dropped out keeps
+// its player ID and pads. Until its state was sent when it joined again, the server fills its
+// pads with neutral inputs, so the others, and the host that has to save the state, keep running.
+
+GCPadStatus GetNeutralPadStatus();
+
+// The inputs the server relayed for a pad since the game started. Only the newest SIZE of them
+// are kept, which is plenty for the time it takes the host to save and send its state.
+class LateJoinInputs
+{
+public:
+  static constexpr u32 SIZE = 1024;
+
+  // Every client starts the buffer of the pad with preroll_inputs neutral inputs, which are read
+  // before the first one that is relayed.
+  void Reset(u32 preroll_inputs);
+  void Push(const GCPadStatus& status);
+
+  // The number of inputs that were pushed.
+  u32 GetEnd() const { return m_end; }
+
+  // The inputs that are read after the first `reads` ones. Empty if some of them aren't kept
+  // anymore.
+  std::optional<std::vector<GCPadStatus>> GetInputsAfter(u32 reads) const;
+
+private:
+  std::array<GCPadStatus, SIZE> m_statuses{};
+  u32 m_end = 0;
+  u32 m_preroll_inputs = 0;
+};
+}  // namespace NetPlay
@@ -0,0 +1,166 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayPadFrames.h"
+
+#include <algorithm>
+
+namespace NetPlay
+{
+namespace
+{
+enum PadField : u16
+{
+  FIELD_BUTTON = 1 << 0,
+  FIELD_ANALOG_A = 1 << 1,
+  FIELD_ANALOG_B = 1 << 2,
+  FIELD_STICK_X = 1 << 3,
+  FIELD_STICK_Y = 1 << 4,
+  FIELD_SUBSTICK_X = 1 << 5,
+  FIELD_SUBSTICK_Y = 1 << 6,
+  FIELD_TRIGGER_LEFT = 1 << 7,
+  FIELD_TRIGGER_RIGHT = 1 << 8,
+  FIELD_IS_CONNECTED = 1 << 9,
+  FIELD_ALL = (1 << 10) - 1,
+};
+
+u16 GetChangedFields(const GCPadStatus& previous, const GCPadStatus& status)
+{
+  u16 fields = 0;
+  fields |= previous.button != status.button ? FIELD_BUTTON : 0;
+  fields |= previous.analogA != status.analogA ? FIELD_ANALOG_A : 0;
+  fields |= previous.analogB != status.analogB ? FIELD_ANALOG_B : 0;
+  fields |= previous.stickX != status.stickX ? FIELD_STICK_X : 0;
+  fields |= previous.stickY != status.stickY ? FIELD_STICK_Y : 0;
+  fields |= previous.substickX != status.substickX ? FIELD_SUBSTICK_X : 0;
+  fields |= previous.substickY != status.substickY ? FIELD_SUBSTICK_Y : 0;
+  fields |= previous.triggerLeft != status.triggerLeft ? FIELD_TRIGGER_LEFT : 0;
+  fields |= previous.triggerRight != status.triggerRight ? FIELD_TRIGGER_RIGHT : 0;
+  fields |= previous.isConnected != status.isConnected ? FIELD_IS_CONNECTED : 0;
+  return fields;
+}
+
+template <typename Packet, typename T>
+void WriteField(Packet& packet, u16 fields, PadField field, T value)
+{
+  if (fields & field)
+    packet << value;
+}
+
+template <typename T>
+void ReadField(sf::Packet& packet, u16 fields, PadField field, T& value)
+{
+  if (fields & field)
+    packet >> value;
+}
+}  // namespace
+
+void PadFrameHistory::Push(const GCPadStatus& status)
+{
+  m_statuses[m_end % SIZE] = status;
+  ++m_end;
+}
+
+template <typename Packet>
+void WritePadFrames(Packet& packet, PadIndex map, const PadFrameHistory& history, u32 first,
+                    u32 end)
+{
+  const u32 count = std::min(end - first, MAX_PAD_FRAMES_PER_BLOCK);
+  packet << map << first << static_cast<u8>(count);
+
+  for (u32 frame = first; frame < first + count; ++frame)
+  {
+    // The first input is sent as a whole, since the receiver might not have the one before it.
+    const GCPadStatus& status = history.Get(frame);
+    const u16 fields = frame == first ? static_cast<u16>(FIELD_ALL) :
+                                        GetChangedFields(history.Get(frame - 1), status);
+
+    packet << fields;
+    WriteField(packet, fields, FIELD_BUTTON, status.button);
+    WriteField(packet, fields, FIELD_ANALOG_A, status.analogA);
+    WriteField(packet, fields, FIELD_ANALOG_B, status.analogB);
+    WriteField(packet, fields, FIELD_STICK_X, status.stickX);
+    WriteField(packet, fields, FIELD_STICK_Y, status.stickY);
+    WriteField(packet, fields, FIELD_SUBSTICK_X, status.substickX);
+    WriteField(packet, fields, FIELD_SUBSTICK_Y, status.substickY);
+    WriteField(packet, fields, FIELD_TRIGGER_LEFT, status.triggerLeft);
+    WriteField(packet, fields, FIELD_TRIGGER_RIGHT, status.triggerRight);
+    WriteField(packet, fields, FIELD_IS_CONNECTED, status.isConnected);
+  }
+}
+
+template <typename Packet>
+void WriteRedundantPadFrames(Packet& packet, PadIndex map, const PadFrameHistory& history)
+{
+  const u32 end = history.GetEnd();
+  WritePadFrames(packet, map, history, end - std::min(end, PAD_FRAME_REDUNDANCY), end);
+}
+
+template void WritePadFrames(sf::Packet&, PadIndex, const PadFrameHistory&, u32, u32);
+template void WritePadFrames(Common::WirePacket&, PadIndex, const PadFrameHistory&, u32, u32);
+template void WriteRedundantPadFrames(sf::Packet&, PadIndex, const PadFrameHistory&);
+template void WriteRedundantPadFrames(Common::WirePacket&, PadIndex, const PadFrameHistory&);
+
+bool WriteMissingPadFrames(sf::Packet& packet, PadIndex map, const PadFrameHistory& history,
+                           u32 first)
+{
+  if (first < history.GetBegin())
+    return false;
+
+  // Inputs that weren't pushed yet are sent with the redundant ones once they are.
+  const u32 end = history.GetEnd();
+
+  for (u32 frame = first; frame < end; frame += MAX_PAD_FRAMES_PER_BLOCK)
+    WritePadFrames(packet, map, history, frame, end);
+  return true;
+}
+
+bool ReadPadFrames(sf::Packet& packet, PadFrames* frames)
+{
+  u8 count;
+  packet >> frames->map >> frames->first_frame >> count;
+  if (!packet || frames->map < 0 || frames->map >= 4)
+    return false;
+
+  frames->count = count;
+  GCPadStatus status;
+  for (u32 i = 0; i < count; ++i)
+  {
+    u16 fields;
+    packet >> fields;
+    if (i == 0 && fields != FIELD_ALL)
+      return false;
+
+    ReadField(packet, fields, FIELD_BUTTON, status.button);
+    ReadField(packet, fields, FIELD_ANALOG_A, status.analogA);
+    ReadField(packet, fields, FIELD_ANALOG_B, status.analogB);
+    ReadField(packet, fields, FIELD_STICK_X, status.stickX);
+    ReadField(packet, fields, FIELD_STICK_Y, status.stickY);
+    ReadField(packet, fields, FIELD_SUBSTICK_X, status.substickX);
+    ReadField(packet, fields, FIELD_SUBSTICK_Y, status.substickY);
+    ReadField(packet, fields, FIELD_TRIGGER_LEFT, status.triggerLeft);
+    ReadField(packet, fields, FIELD_TRIGGER_RIGHT, status.triggerRight);
+    ReadField(packet, fields, FIELD_IS_CONNECTED, status.isConnected);
+    frames->statuses[i] = status;
+  }
+
+  return static_cast<bool>(packet);
+}
+
+void PadFrameReceiver::Reset()
+{
+  m_next_frame = 0;
+  m_requested = false;
+}
+
+bool PadFrameReceiver::ShouldRequestMissingFrames()
+{
+  if (m_requested && m_requested_frame == m_next_frame && ++m_packets_since_request < RETRY_DELAY)
+    return false;
+
+  m_requested = true;
+  m_requested_frame = m_next_frame;
+  m_packets_since_request = 0;
+  return true;
+}
+}  // namespace NetPlay
@@ -0,0 +1,111 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <chrono>
+
+#include <SFML/Network/Packet.hpp>
+
+#include "Common/CommonTypes.h"
+#include "Common/WirePacket.h"
+#include "Core/NetPlayProto.h"
+#include "InputCommon/GCPadStatus.h"
+
+namespace NetPlay
+{
+// Pad inputs sent on the unreliable PAD_DATA_CHANNEL.
+//
+// The k-th input of a pad is numbered k. Every packet repeats the newest PAD_FRAME_REDUNDANCY
+// inputs of a pad, each stored as the fields that changed since the one before it, so a lost
+// packet is made up for by the next one instead of holding up everything behind it until it is
+// retransmitted. Only when more than that is lost in a row the receiver asks for the missing
+// inputs with a PadFrameRequest, which is answered on the reliable channel. Since nothing may be
+// sent after the last lost packet, e.g. when every player waits for the others, a client that
+// waited PAD_FRAME_REQUEST_TIMEOUT for an input asks for it too. The server passes the request
+// on to the owner of the pad if it doesn't have the input either.
+constexpr u32 PAD_FRAME_REDUNDANCY = 8;
+constexpr auto PAD_FRAME_REQUEST_TIMEOUT = std::chrono::milliseconds(100);
+constexpr u32 MAX_PAD_FRAMES_PER_BLOCK = 255;
+
+// The newest inputs sent for a pad, so they can be repeated and sent again when requested.
+class PadFrameHistory
+{
+public:
+  static constexpr u32 SIZE = 256;
+
+  void Clear() { m_end = 0; }
+  void Push(const GCPadStatus& status);
+
+  // The number of the oldest input that is kept.
+  u32 GetBegin() const { return m_end > SIZE ? m_end - SIZE : 0; }
+  // The number of the next input that is pushed.
+  u32 GetEnd() const { return m_end; }
+  const GCPadStatus& Get(u32 frame) const { return m_statuses[frame % SIZE]; }
+
+private:
+  std::array<GCPadStatus, SIZE> m_statuses{};
+  u32 m_end = 0;
+};
+
+struct PadFrames
+{
+  PadIndex map = 0;
+  u32 first_frame = 0;
+  u32 count = 0;
+  std::array<GCPadStatus, MAX_PAD_FRAMES_PER_BLOCK> statuses{};
+};
+
+// Writes the inputs [first, end) of a pad, at most MAX_PAD_FRAMES_PER_BLOCK of them. They have to
+// be kept by the history. Packet is sf::Packet or Common::WirePacket.
+template <typename Packet>
+void WritePadFrames(Packet& packet, PadIndex map, const PadFrameHistory& history, u32 first,
+                    u32 end);
+// Writes the newest inputs of a pad, see PAD_FRAME_REDUNDANCY.
+template <typename Packet>
+void WriteRedundantPadFrames(Packet& packet, PadIndex map, const PadFrameHistory& history);
+// Writes the inputs from first on, in as many blocks as needed, to answer a PadFrameRequest.
+// Returns false if some of them aren't kept anymore.
+bool WriteMissingPadFrames(sf::Packet& packet, PadIndex map, const PadFrameHistory& history,
+                           u32 first);
+bool ReadPadFrames(sf::Packet& packet, PadFrames* frames);
+
+// Puts the inputs a pad receives back in order, dropping the ones that arrived before.
+class PadFrameReceiver
+{
+public:
+  void Reset();
+
+  u32 GetNextFrame() const { return m_next_frame; }
+
+  // Calls push(status) for every input in frames that wasn't received yet. Returns false if the
+  // inputs right before the first one in frames are missing, in which case nothing is pushed.
+  template <typename Func>
+  bool Receive(const PadFrames& frames, Func push)
+  {
+    if (frames.first_frame > m_next_frame)
+      return false;
+
+    for (u32 i = m_next_frame - frames.first_frame; i < frames.count; ++i)
+    {
+      push(frames.statuses[i]);
+      ++m_next_frame;
+    }
+    return true;
+  }
+
+  // Called whenever Receive() finds inputs to be missing. Returns true the first time, and again
+  // every RETRY_DELAY packets while they are still missing, e.g. because the sender didn't have
+  // them yet either.
+  bool ShouldRequestMissingFrames();
+
+private:
+  static constexpr u32 RETRY_DELAY = 30;
+
+  u32 m_next_frame = 0;
+  u32 m_requested_frame = 0;
+  u32 m_packets_since_request = 0;
+  bool m_requested = false;
+};
+}  // namespace NetPlay
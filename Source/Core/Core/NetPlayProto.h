@@ -108,6 +108,9 @@ struct NetSettings
   bool golf_mode = false;
   bool use_fma = false;
   bool hide_remote_gbas = false;
+  bool redundant_pad_data = false;
+  bool state_fingerprints = false;
+  bool rollback = false;
 
   Sram sram;
 
@@ -147,12 +150,16 @@ enum class MessageID : u8
   ChunkedDataProgress = 0x43,
   ChunkedDataComplete = 0x44,
   ChunkedDataAbort = 0x45,
+  ChunkedDataResume = 0x46,
 
   PadData = 0x60,
   PadMapping = 0x61,
   PadBuffer = 0x62,
   PadHostData = 0x63,
   GBAConfig = 0x64,
+  PadFrames = 0x65,
+  PadFrameRequest = 0x66,
+  SpectatorPadData = 0x67,
 
   WiimoteData = 0x70,
   WiimoteMapping = 0x71,
@@ -171,6 +178,9 @@ enum class MessageID : u8
   ClientCapabilities = 0xA5,
   HostInputAuthority = 0xA6,
   PowerButton = 0xA7,
+  LateJoinRequest = 0xA8,
+  LateJoin = 0xA9,
+  LateJoinState = 0xAA,
 
   TimeBase = 0xB0,
   DesyncDetected = 0xB1,
@@ -187,9 +197,11 @@ enum class MessageID : u8
   Ping = 0xE0,
   Pong = 0xE1,
   PlayerPingData = 0xE2,
+  ClockSync = 0xE3,
 
   SyncSaveData = 0xF1,
   SyncCodes = 0xF2,
+  SyncGame = 0xF3,
 };
 
 enum class ConnectionError : u8
@@ -225,12 +237,19 @@ enum class SyncCodeID : u8
 
 constexpr u32 MAX_NAME_LENGTH = 30;
 constexpr size_t CHUNKED_DATA_UNIT_SIZE = 16384;
+// The largest game image the host sends to players that don't have the game.
+constexpr u64 MAX_GAME_TRANSFER_SIZE = 0x80000000;
 constexpr u32 MAX_ENET_MTU = 1392;  // see https://github.com/lsalzman/enet/issues/132
+// How far ahead of StartGame the server schedules the first frame, so that the clients are done
+// booting by then. Longer if the slowest ping needs it.
+constexpr u32 MIN_SCHEDULED_START_DELAY_MS = 1000;
 
 enum : u8
 {
   DEFAULT_CHANNEL,
   CHUNKED_DATA_CHANNEL,
+  // Unreliable, see NetPlayPadFrames.h.
+  PAD_DATA_CHANNEL,
   CHANNEL_COUNT
 };
 
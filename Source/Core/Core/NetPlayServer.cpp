@@ -7,6 +7,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdio>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -20,11 +21,14 @@
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
+#include <lz4.h>
 
 #include "Common/CommonPaths.h"
+#include "Common/Crypto/SHA1.h"
 #include "Common/ENet.h"
 #include "Common/FileUtil.h"
 #include "Common/HttpRequest.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/SFMLHelper.h"
@@ -53,6 +57,7 @@
 #include "Core/HW/GCMemcard/GCMemcardDirectory.h"
 #include "Core/HW/GCMemcard/GCMemcardRaw.h"
 #include "Core/HW/Sram.h"
+#include "Core/HW/VideoInterface.h"
 #include "Core/HW/WiiSave.h"
 #include "Core/HW/WiiSaveStructs.h"
 #include "Core/HW/WiimoteEmu/DesiredWiimoteState.h"
@@ -65,9 +70,13 @@
 #include "Core/NetPlayClient.h"  //for NetPlayUI
 #include "Core/NetPlayCommon.h"
 #include "Core/SyncIdentifier.h"
+#include "Core/System.h"
 
+#include "DiscIO/Blob.h"
 #include "DiscIO/Enums.h"
 #include "DiscIO/RiivolutionPatcher.h"
+#include "DiscIO/ScrubbedBlob.h"
+#include "DiscIO/WIABlob.h"
 
 #include "InputCommon/ControllerEmu/ControlGroup/Attachments.h"
 #include "InputCommon/GCPadStatus.h"
@@ -93,16 +102,52 @@
 
 namespace NetPlay
 {
+namespace
+{
+thread_local bool tls_is_control_thread = false;
+
+// The messages handled on the ---NETPLAY--- thread. Besides the inputs, that's the ones that
+// change how they are relayed, which have to be handled in order with them, and Pong, which
+// would otherwise measure the time spent waiting on the ---Control--- thread.
+bool IsRelayMessage(MessageID mid)
+{
+  switch (mid)
+  {
+  case MessageID::PadData:
+  case MessageID::PadHostData:
+  case MessageID::PadFrames:
+  case MessageID::PadFrameRequest:
+  case MessageID::WiimoteData:
+  case MessageID::GolfRequest:
+  case MessageID::GolfRelease:
+  case MessageID::GolfAcquire:
+  case MessageID::GolfPrepare:
+  case MessageID::Pong:
+  case MessageID::ClockSync:
+  case MessageID::StartGame:
+  case MessageID::LateJoinState:
+    return true;
+  default:
+    return false;
+  }
+}
+}  // namespace
+
 NetPlayServer::~NetPlayServer()
 {
   if (is_connected)
   {
+    m_abort_game_transfer = true;
+    m_game_transfer_worker.Cancel();
+    m_game_transfer_worker.Shutdown();
+
     m_do_loop = false;
     m_chunked_data_event.Set();
     m_chunked_data_complete_event.Set();
     if (m_chunked_data_thread.joinable())
       m_chunked_data_thread.join();
     m_thread.join();
+    m_relay_client.reset();
     enet_host_destroy(m_server);
 
     if (Common::g_MainNetHost.get() == m_server)
@@ -164,6 +209,13 @@ NetPlayServer::NetPlayServer(const u16 port, const bool forward_port, NetPlayUI*
     {
       m_server->mtu = std::min(m_server->mtu, NetPlay::MAX_ENET_MTU);
       m_server->intercept = Common::ENet::InterceptCallback;
+
+      const std::string relay_server = Config::Get(Config::NETPLAY_RELAY_SERVER);
+      if (!relay_server.empty())
+      {
+        m_relay_client = std::make_unique<Common::RelayClient>(
+            m_server, relay_server, Config::Get(Config::NETPLAY_RELAY_PORT));
+      }
     }
 
     SetupIndex();
@@ -173,12 +225,15 @@ NetPlayServer::NetPlayServer(const u16 port, const bool forward_port, NetPlayUI*
     is_connected = true;
     m_do_loop = true;
     m_thread = std::thread(&NetPlayServer::ThreadFunc, this);
+    m_control_thread = std::thread(&NetPlayServer::ControlThreadFunc, this);
     m_target_buffer_size = 5;
     m_chunked_data_thread = std::thread(&NetPlayServer::ChunkedDataThreadFunc, this);
+    m_game_transfer_worker.Reset("NetPlay game transfer",
+                                 std::bind_front(&NetPlayServer::TransferGame, this));
 
 #ifdef USE_UPNP
     if (forward_port && !traversal_config.use_traversal)
-      Common::UPnP::TryPortmapping(port);
+      Common::UPnP::TryPortmapping(GetPort());
 #endif
   }
 }
@@ -269,9 +324,19 @@ void NetPlayServer::ThreadFunc()
       m_ping_timer.Start();
       SendToClients(spac);
 
-      m_index.SetPlayerCount(static_cast<int>(m_players.size()));
-      m_index.SetGame(m_selected_game_name);
-      m_index.SetInGame(m_is_running);
+      if (m_auto_buffer && m_is_running && !m_host_input_authority)
+      {
+        // The pings are sent once per second, which is slow enough to not keep resizing. The
+        // buffer is counted in frames, so it follows the game's refresh rate, e.g. 50 Hz for PAL.
+        double frame_rate = Core::System::GetInstance().GetVideoInterface().GetTargetRefreshRate();
+        if (!(frame_rate > 0))
+          frame_rate = 60.0;
+        if (const auto size = m_buffer_tuner.Update(m_target_buffer_size, frame_rate))
+          AdjustPadBufferSize(*size);
+      }
+
+      m_index.UpdateSession(static_cast<int>(m_players.size()), m_selected_game_name,
+                            m_is_running);
 
       m_update_pings = false;
     }
@@ -280,13 +345,17 @@ void NetPlayServer::ThreadFunc()
     int net;
     if (m_traversal_client)
       m_traversal_client->HandleResends();
+    if (m_relay_client)
+      UpdateRelay();
     net = enet_host_service(m_server, &netEvent, 1000);
+    HandleControlDisconnects();
+    HandleNetworkTasks();
     while (!m_async_queue.Empty())
     {
       INFO_LOG_FMT(NETPLAY, "Processing async queue event.");
       {
-        std::lock_guard lkp(m_crit.players);
-        INFO_LOG_FMT(NETPLAY, "Locked player mutex.");
+        // m_players is only changed by this thread, so it can be read without locking, which
+        // would wait for the ---Control--- thread.
         auto& e = m_async_queue.Front();
         if (e.target_mode == TargetMode::Only)
         {
@@ -349,7 +418,13 @@ void NetPlayServer::ThreadFunc()
         {
           auto it = m_players.find(*PeerPlayerId(netEvent.peer));
           Client& client = it->second;
-          if (OnData(rpac, client) != 0)
+          const u8* const data = static_cast<const u8*>(rpac.getData());
+          if (rpac.getDataSize() != 0 && !IsRelayMessage(static_cast<MessageID>(data[0])))
+          {
+            m_control_queue.Push(ControlQueueEntry{std::move(rpac), client.pid});
+            m_control_event.Set();
+          }
+          else if (OnData(rpac, client) != 0)
           {
             INFO_LOG_FMT(NETPLAY, "Invalid packet from client {}, disconnecting.", client.pid);
 
@@ -414,6 +489,11 @@ void NetPlayServer::ThreadFunc()
 
   INFO_LOG_FMT(NETPLAY, "NetPlayServer shutting down.");
 
+  // The ---Control--- thread has to stop using m_players first.
+  m_control_event.Set();
+  if (m_control_thread.joinable())
+    m_control_thread.join();
+
   // close listening socket and client sockets
   for (const auto& player_entry : std::views::values(m_players))
   {
@@ -423,6 +503,94 @@ void NetPlayServer::ThreadFunc()
   m_players.clear();
 }
 
+// called from ---NETPLAY--- thread
+void NetPlayServer::UpdateRelay()
+{
+  m_relay_client->Update();
+
+  const u16 port = m_relay_client->GetSessionPort();
+  if (port == m_relay_session_port)
+    return;
+
+  m_relay_session_port = port;
+  if (port != 0 && m_dialog)
+  {
+    m_dialog->AppendChat(Common::FmtFormatT("Players can join through the relay at {0}:{1}.",
+                                            m_relay_client->GetServer(), port));
+  }
+}
+
+// called from ---NETPLAY--- thread
+void NetPlayServer::HandleControlDisconnects()
+{
+  while (!m_control_disconnect_queue.Empty())
+  {
+    const PlayerId pid = m_control_disconnect_queue.Front();
+    m_control_disconnect_queue.Pop();
+
+    const auto it = m_players.find(pid);
+    if (it == m_players.end())
+      continue;
+
+    INFO_LOG_FMT(NETPLAY, "Invalid packet from client {}, disconnecting.", pid);
+
+    ENetPeer* const socket = it->second.socket;
+    std::lock_guard lkg(m_crit.game);
+    OnDisconnect(it->second);
+
+    ClearPeerPlayerId(socket);
+  }
+}
+
+void NetPlayServer::RunOnNetworkThread(Common::MoveOnlyFunction<void()> task)
+{
+  {
+    std::lock_guard lkq(m_crit.async_queue_write);
+    m_network_tasks.Push(std::move(task));
+  }
+  Common::ENet::WakeupThread(m_server);
+}
+
+// called from ---NETPLAY--- thread
+void NetPlayServer::HandleNetworkTasks()
+{
+  while (!m_network_tasks.Empty())
+  {
+    m_network_tasks.Front()();
+    m_network_tasks.Pop();
+  }
+}
+
+// called from ---Control--- thread
+void NetPlayServer::ControlThreadFunc()
+{
+  tls_is_control_thread = true;
+
+  while (m_do_loop)
+  {
+    m_control_event.Wait();
+
+    while (m_do_loop && !m_control_queue.Empty())
+    {
+      ControlQueueEntry& e = m_control_queue.Front();
+      {
+        // Keeps the player from being removed while its message is handled.
+        std::lock_guard lkg(m_crit.game);
+        std::lock_guard lkp(m_crit.players);
+        if (const auto it = m_players.find(e.pid); it != m_players.end())
+        {
+          if (OnData(e.packet, it->second) != 0)
+          {
+            m_control_disconnect_queue.Push(e.pid);
+            Common::ENet::WakeupThread(m_server);
+          }
+        }
+      }
+      m_control_queue.Pop();
+    }
+  }
+}
+
 static void SendSyncIdentifier(sf::Packet& spac, const SyncIdentifier& sync_identifier)
 {
   // We cast here due to a potential long vs long long mismatch
@@ -445,19 +613,32 @@ ConnectionError NetPlayServer::OnConnect(ENetPeer* incoming_connection, sf::Pack
   if (netplay_version != Common::GetScmRevGitStr())
     return ConnectionError::VersionMismatch;
 
-  if (m_is_running || m_start_pending)
+  if (m_start_pending || (m_is_running && !m_late_join_allowed))
     return ConnectionError::GameRunning;
 
   if (m_players.size() >= 255)
     return ConnectionError::ServerFull;
 
   Client new_player{};
-  new_player.pid = GiveFirstAvailableIDTo(incoming_connection);
   new_player.socket = incoming_connection;
+  new_player.joining = m_is_running;
 
   received_packet >> new_player.revision;
   received_packet >> new_player.name;
 
+  // A player that dropped out of the running game gets its pads back.
+  const auto reserved = m_reserved_pids.find(new_player.name);
+  if (new_player.joining && reserved != m_reserved_pids.end())
+  {
+    new_player.pid = reserved->second;
+    incoming_connection->data = new PlayerId(new_player.pid);
+    m_reserved_pids.erase(reserved);
+  }
+  else
+  {
+    new_player.pid = GiveFirstAvailableIDTo(incoming_connection);
+  }
+
   if (StringUTF8CodePointCount(new_player.name) > MAX_NAME_LENGTH)
     return ConnectionError::NameTooLong;
 
@@ -468,7 +649,8 @@ ConnectionError NetPlayServer::OnConnect(ENetPeer* incoming_connection, sf::Pack
   // force a ping on first netplay loop
   m_update_pings = true;
 
-  AssignNewUserAPad(new_player);
+  if (!new_player.joining)
+    AssignNewUserAPad(new_player);
 
   // tell other players a new player joined
   SendResponseToAllPlayers(MessageID::PlayerJoin, new_player.pid, new_player.name,
@@ -521,7 +703,20 @@ ConnectionError NetPlayServer::OnConnect(ENetPeer* incoming_connection, sf::Pack
 unsigned int NetPlayServer::OnDisconnect(const Client& player)
 {
   const PlayerId pid = player.pid;
+  m_buffer_tuner.RemovePlayer(pid);
 
+  // With late join, the pads of a player that dropped out are filled with neutral inputs until it
+  // joins again, instead of the game being disabled. That takes someone else still playing.
+  const auto others_playing = [&] {
+    for (size_t i = 0; i < m_pad_map.size(); ++i)
+    {
+      if (m_pad_map[i] != 0 && m_pad_map[i] != pid && !m_vacant_pads[i])
+        return true;
+    }
+    return false;
+  };
+
+  bool keep_pads = false;
   if (m_is_running)
   {
     for (PlayerId& mapping : m_pad_map)
@@ -529,17 +724,34 @@ unsigned int NetPlayServer::OnDisconnect(const Client& player)
       if (mapping == pid && pid != 1)
       {
         std::lock_guard lkg(m_crit.game);
+        if (m_late_join_allowed && others_playing())
+        {
+          m_reserved_pids[player.name] = pid;
+          for (size_t i = 0; i < m_pad_map.size(); ++i)
+            m_vacant_pads[i] |= m_pad_map[i] == pid;
+          keep_pads = true;
+          break;
+        }
+
         m_is_running = false;
 
+        // this thread doesn't need players lock
+        SendSpectatorInputs(true);
+
         sf::Packet spac;
         spac << MessageID::DisableGame;
-        // this thread doesn't need players lock
         SendToClients(spac);
         break;
       }
     }
   }
 
+  if (pid == m_late_join_pid)
+  {
+    std::lock_guard lkg(m_crit.game);
+    RequestNextLateJoin();
+  }
+
   if (m_start_pending)
   {
     ChunkedDataAbort();
@@ -557,13 +769,15 @@ unsigned int NetPlayServer::OnDisconnect(const Client& player)
   auto it = m_players.find(player.pid);
   if (it != m_players.end())
     m_players.erase(it);
+  // Don't keep the chunked data thread waiting for them.
+  m_chunked_data_complete_event.Set();
 
   // alert other players of disconnect
   SendToClients(spac);
 
   for (size_t i = 0; i < m_pad_map.size(); ++i)
   {
-    if (m_pad_map[i] == pid)
+    if (m_pad_map[i] == pid && !keep_pads)
     {
       m_pad_map[i] = 0;
       m_gba_config[i].enabled = false;
@@ -584,6 +798,167 @@ unsigned int NetPlayServer::OnDisconnect(const Client& player)
   return 0;
 }
 
+// Only GameCube games that run with the inputs of every player relayed as they are, so the
+// inputs after the host's state are all the server needs to give a new player.
+bool NetPlayServer::CanLateJoin(const bool delayed_spectators) const
+{
+  if (!Config::Get(Config::NETPLAY_ALLOW_LATE_JOIN) || m_host_input_authority ||
+      m_settings.redundant_pad_data || m_settings.rollback || m_settings.enable_cheats ||
+      delayed_spectators)
+  {
+    return false;
+  }
+
+  if (std::ranges::any_of(m_wiimote_map, [](PlayerId pid) { return pid > 0; }) ||
+      std::ranges::any_of(m_gba_config, [](const auto& config) { return config.enabled; }))
+  {
+    return false;
+  }
+
+  const auto game = m_dialog->FindGameFile(m_selected_game_identifier);
+  return game && game->GetPlatform() == DiscIO::Platform::GameCubeDisc;
+}
+
+// called from ---Control--- thread
+void NetPlayServer::QueueLateJoin(const PlayerId pid)
+{
+  if (!m_is_running || pid == m_late_join_pid ||
+      std::ranges::find(m_late_join_queue, pid) != m_late_join_queue.end())
+  {
+    return;
+  }
+
+  m_late_join_queue.push_back(pid);
+  if (m_late_join_pid == 0)
+    RequestNextLateJoin();
+}
+
+// The host saves a state for one player at a time.
+void NetPlayServer::RequestNextLateJoin()
+{
+  m_late_join_pid = 0;
+  const auto host = m_players.find(1);
+  while (!m_late_join_queue.empty() && m_is_running && host != m_players.end())
+  {
+    const PlayerId pid = m_late_join_queue.front();
+    m_late_join_queue.pop_front();
+    if (!m_players.contains(pid))
+      continue;
+
+    m_late_join_pid = pid;
+    sf::Packet spac;
+    spac << MessageID::LateJoinRequest;
+    spac << pid;
+    Send(host->second.socket, spac);
+    return;
+  }
+}
+
+// called from ---NETPLAY--- thread
+unsigned int NetPlayServer::OnLateJoinState(sf::Packet& packet, const Client& player)
+{
+  if (!player.IsHost())
+    return 1;
+
+  PlayerId pid;
+  bool saved;
+  packet >> pid;
+  packet >> saved;
+
+  std::lock_guard lkg(m_crit.game);
+  if (pid != m_late_join_pid)
+    return 0;
+
+  const auto it = m_players.find(pid);
+  if (it == m_players.end())
+  {
+    RequestNextLateJoin();
+    return 0;
+  }
+  Client& joiner = it->second;
+
+  u32 frame = 0;
+  std::array<std::optional<std::vector<GCPadStatus>>, 4> inputs;
+  bool ok = saved && m_is_running;
+  if (ok)
+  {
+    packet >> frame;
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+      u32 reads;
+      packet >> reads;
+      inputs[i] = m_late_join_inputs[i].GetInputsAfter(reads);
+      ok &= inputs[i].has_value();
+    }
+  }
+
+  if (!ok)
+  {
+    INFO_LOG_FMT(NETPLAY, "Couldn't get the state of the running game for player {}.", pid);
+    ENetPeer* const socket = joiner.socket;
+    OnDisconnect(joiner);
+    ClearPeerPlayerId(socket);
+    return 0;
+  }
+
+  sf::Packet spac;
+  spac << MessageID::LateJoin;
+  spac << frame;
+  Send(joiner.socket, spac);
+  Send(joiner.socket, m_start_game_packet);
+
+  sf::Packet pads;
+  pads << MessageID::PadData;
+  for (size_t i = 0; i < inputs.size(); ++i)
+  {
+    if (m_pad_map[i] == 0)
+      continue;
+
+    for (const GCPadStatus& pad : *inputs[i])
+    {
+      pads << static_cast<PadIndex>(i) << pad.button;
+      pads << pad.analogA << pad.analogB << pad.stickX << pad.stickY << pad.substickX
+           << pad.substickY << pad.triggerLeft << pad.triggerRight << pad.isConnected;
+    }
+  }
+  Send(joiner.socket, pads);
+
+  // The inputs of the joiner's pads come from the joiner from now on, right after the neutral ones
+  // it just got.
+  for (size_t i = 0; i < m_pad_map.size(); ++i)
+  {
+    if (m_pad_map[i] == pid)
+      m_vacant_pads[i] = false;
+  }
+
+  // The rest of the packet is the compressed state.
+  sf::Packet state;
+  state << MessageID::LateJoinState;
+  state.append(static_cast<const u8*>(packet.getData()) + packet.getReadPosition(),
+               packet.getDataSize() - packet.getReadPosition());
+  SendChunked(std::move(state), pid, "Game State");
+
+  joiner.joining = false;
+  RequestNextLateJoin();
+  return 0;
+}
+
+void NetPlayServer::ReleaseReservedPads()
+{
+  std::lock_guard lkp(m_crit.players);
+  for (size_t i = 0; i < m_pad_map.size(); ++i)
+  {
+    if (m_pad_map[i] != 0 && !m_players.contains(m_pad_map[i]))
+      m_pad_map[i] = 0;
+  }
+  UpdatePadMapping();
+
+  m_reserved_pids.clear();
+  m_vacant_pads = {};
+  m_late_join_queue.clear();
+  m_late_join_pid = 0;
+}
+
 // called from ---GUI--- thread
 PadMappingArray NetPlayServer::GetPadMapping() const
 {
@@ -730,6 +1105,12 @@ void NetPlayServer::SendAsyncToClients(sf::Packet&& packet, const PlayerId skip_
 }
 
 void NetPlayServer::SendChunked(sf::Packet&& packet, const PlayerId pid, const std::string& title)
+{
+  SendChunked(std::make_shared<const sf::Packet>(std::move(packet)), pid, title);
+}
+
+void NetPlayServer::SendChunked(std::shared_ptr<const sf::Packet> packet, const PlayerId pid,
+                                const std::string& title)
 {
   {
     std::lock_guard lkq(m_crit.chunked_data_queue_write);
@@ -745,7 +1126,8 @@ void NetPlayServer::SendChunkedToClients(sf::Packet&& packet, const PlayerId ski
   {
     std::lock_guard lkq(m_crit.chunked_data_queue_write);
     m_chunked_data_queue.Push(
-        ChunkedDataQueueEntry{std::move(packet), skip_pid, TargetMode::AllExcept, title});
+        ChunkedDataQueueEntry{std::make_shared<const sf::Packet>(std::move(packet)), skip_pid,
+                              TargetMode::AllExcept, title});
   }
   m_chunked_data_event.Set();
 }
@@ -794,10 +1176,27 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     u32 cid;
     packet >> cid;
 
-    if (const auto it = m_chunked_data_complete_count.find(cid);
-        it != m_chunked_data_complete_count.end())
+    std::lock_guard lk(m_chunked_data_transfer_lock);
+    if (const auto it = m_chunked_data_transfers.find(player.pid);
+        cid == m_chunked_data_transfer_id && it != m_chunked_data_transfers.end())
+    {
+      it->second.complete = true;
+      m_chunked_data_complete_event.Set();
+    }
+  }
+  break;
+
+  case MessageID::ChunkedDataResume:
+  {
+    u32 cid;
+    packet >> cid;
+    const u64 offset = Common::PacketReadU64(packet);
+
+    std::lock_guard lk(m_chunked_data_transfer_lock);
+    if (const auto it = m_chunked_data_transfers.find(player.pid);
+        cid == m_chunked_data_transfer_id && it != m_chunked_data_transfers.end())
     {
-      it->second++;
+      it->second.resume_offset = offset;
       m_chunked_data_complete_event.Set();
     }
   }
@@ -809,7 +1208,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     if (player.current_game != m_current_game)
       break;
 
-    sf::Packet spac;
+    Common::WirePacket spac;
     spac << (m_host_input_authority ? MessageID::PadHostData : MessageID::PadData);
 
     while (!packet.endOfPacket())
@@ -835,8 +1234,14 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
         spac << pad.analogA << pad.analogB << pad.stickX << pad.stickY << pad.substickX
              << pad.substickY << pad.triggerLeft << pad.triggerRight << pad.isConnected;
       }
+
+      // With host input authority, the inputs that count arrive as PadHostData from the golfer.
+      if (!m_host_input_authority)
+        AddRelayedInput(map, pad);
     }
 
+    SendSpectatorInputs();
+
     if (m_host_input_authority)
     {
       // Prevent crash before game stop if the golfer disconnects
@@ -849,6 +1254,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     else
     {
       SendToClients(spac, player.pid);
+      FillVacantPads();
     }
   }
   break;
@@ -859,7 +1265,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     if (m_current_golfer != 0 && player.pid != m_current_golfer)
       return 1;
 
-    sf::Packet spac;
+    Common::WirePacket spac;
     spac << MessageID::PadData;
 
     while (!packet.endOfPacket())
@@ -878,19 +1284,108 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
         spac << pad.analogA << pad.analogB << pad.stickX << pad.stickY << pad.substickX
              << pad.substickY << pad.triggerLeft << pad.triggerRight << pad.isConnected;
       }
+
+      AddRelayedInput(map, pad);
     }
 
+    SendSpectatorInputs();
+
     SendToClients(spac, player.pid);
   }
   break;
 
+  case MessageID::PadFrames:
+  {
+    if (player.current_game != m_current_game)
+      break;
+
+    Common::WirePacket spac;
+    spac << MessageID::PadFrames;
+    bool send_packet = false;
+
+    PadFrames frames;
+    while (!packet.endOfPacket())
+    {
+      if (!ReadPadFrames(packet, &frames) || m_pad_map.at(frames.map) != player.pid)
+        return 1;
+
+      PadFrameReceiver& receiver = m_pad_frame_receivers[frames.map];
+      PadFrameHistory& history = m_pad_frame_histories[frames.map];
+      const u32 next_frame = receiver.GetNextFrame();
+      const auto push = [&](const GCPadStatus& pad) {
+        history.Push(pad);
+        AddRelayedInput(frames.map, pad);
+      };
+      if (!receiver.Receive(frames, push))
+      {
+        if (receiver.ShouldRequestMissingFrames())
+        {
+          sf::Packet request;
+          request << MessageID::PadFrameRequest << frames.map << next_frame;
+          Send(player.socket, request);
+        }
+        continue;
+      }
+
+      // Only relay new inputs, the receivers already got the older ones several times.
+      if (receiver.GetNextFrame() != next_frame)
+      {
+        WriteRedundantPadFrames(spac, frames.map, history);
+        send_packet = true;
+      }
+    }
+
+    if (send_packet)
+    {
+      SendToClients(spac, player.pid, PAD_DATA_CHANNEL);
+      SendSpectatorInputs();
+    }
+  }
+  break;
+
+  case MessageID::PadFrameRequest:
+  {
+    PadIndex map;
+    u32 first_frame;
+    packet >> map >> first_frame;
+    if (!packet || map < 0 || map >= 4)
+      return 1;
+
+    const PadFrameHistory& history = m_pad_frame_histories[map];
+    if (first_frame >= history.GetEnd())
+    {
+      // The server is missing the inputs too, ask the owner of the pad for them.
+      const auto it = m_players.find(m_pad_map[map]);
+      if (it != m_players.end() && it->second.pid != player.pid)
+      {
+        sf::Packet request;
+        request << MessageID::PadFrameRequest << map << m_pad_frame_receivers[map].GetNextFrame();
+        Send(it->second.socket, request);
+      }
+      break;
+    }
+
+    sf::Packet spac;
+    spac << MessageID::PadFrames;
+    if (!WriteMissingPadFrames(spac, map, history, first_frame))
+    {
+      ERROR_LOG_FMT(NETPLAY, "Inputs of pad {} from {} on are no longer available.", map,
+                    first_frame);
+    }
+    else
+    {
+      Send(player.socket, spac);
+    }
+  }
+  break;
+
   case MessageID::WiimoteData:
   {
     // if this is Wiimote data from the last game still being received, ignore it
     if (player.current_game != m_current_game)
       break;
 
-    sf::Packet spac;
+    Common::WirePacket spac;
     spac << MessageID::WiimoteData;
 
     while (!packet.endOfPacket())
@@ -905,17 +1400,13 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
         return 1;
       }
 
-      WiimoteEmu::SerializedWiimoteState pad;
-      packet >> pad.length;
-      if (pad.length > pad.data.size())
+      // Relayed as is, the receivers apply the deltas to the same previous states.
+      WiimoteStateDelta delta;
+      if (!ReadWiimoteStateDelta(packet, &delta))
         return 1;
-      for (size_t i = 0; i < pad.length; ++i)
-        packet >> pad.data[i];
 
       spac << map;
-      spac << pad.length;
-      for (size_t i = 0; i < pad.length; ++i)
-        spac << pad.data[i];
+      WriteWiimoteStateDelta(spac, delta);
     }
 
     SendToClients(spac, player.pid);
@@ -989,17 +1480,33 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     if (m_ping_key == ping_key)
     {
       player.ping = ping;
+      m_buffer_tuner.AddSample(player.pid, ping);
     }
 
     sf::Packet spac;
     spac << MessageID::PlayerPingData;
     spac << player.pid;
     spac << player.ping;
+    spac << player.socket->roundTripTimeVariance;
+    spac << player.socket->packetLoss;
 
     SendToClients(spac);
   }
   break;
 
+  case MessageID::ClockSync:
+  {
+    // Answered right away, since any time it waits counts into the round trip.
+    const u64 client_time = Common::PacketReadU64(packet);
+
+    sf::Packet spac;
+    spac << MessageID::ClockSync;
+    spac << client_time;
+    spac << Common::Timer::NowUs();
+    Send(player.socket, spac);
+  }
+  break;
+
   case MessageID::StartGame:
   {
     packet >> player.current_game;
@@ -1012,20 +1519,27 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
       break;
 
     m_is_running = false;
+    ReleaseReservedPads();
 
-    // tell clients to stop game
-    sf::Packet spac;
-    spac << MessageID::StopGame;
+    // The spectators are behind, they get the rest of the inputs before the game stops for them.
+    // The queue belongs to the ---NETPLAY--- thread, which sends the StopGame message after them.
+    RunOnNetworkThread([this] {
+      SendSpectatorInputs(true);
 
-    std::lock_guard lkp(m_crit.players);
-    SendToClients(spac);
+      // tell clients to stop game
+      sf::Packet spac;
+      spac << MessageID::StopGame;
+      SendToClients(spac);
+    });
   }
   break;
 
   case MessageID::GameStatus:
   {
     SyncIdentifierComparison status;
+    bool accepts_game = false;
     packet >> status;
+    packet >> accepts_game;
 
     m_players[player.pid].game_status = status;
 
@@ -1036,6 +1550,11 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     spac << status;
 
     SendToClients(spac);
+
+    if (status != SyncIdentifierComparison::SameGame && accepts_game)
+      QueueGameTransfer(player.pid);
+    else if (m_players[player.pid].joining)
+      QueueLateJoin(player.pid);
   }
   break;
 
@@ -1043,6 +1562,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
   {
     packet >> m_players[player.pid].has_ipl_dump;
     packet >> m_players[player.pid].has_hardware_fma;
+    packet >> m_players[player.pid].supports_rollback;
   }
   break;
 
@@ -1054,30 +1574,54 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
   }
   break;
 
+  case MessageID::LateJoinState:
+    return OnLateJoinState(packet, player);
+
   case MessageID::TimeBase:
   {
-    u64 timebase = Common::PacketReadU64(packet);
+    FrameState state;
+    state.timebase = Common::PacketReadU64(packet);
     u32 frame;
     packet >> frame;
+    bool has_fingerprint;
+    packet >> has_fingerprint;
+    if (has_fingerprint)
+      state.fingerprint = Common::PacketReadU64(packet);
 
     if (m_desync_detected)
       break;
 
-    std::vector<std::pair<PlayerId, u64>>& timebases = m_timebase_by_frame[frame];
-    timebases.emplace_back(player.pid, timebase);
-    if (timebases.size() >= m_players.size())
+    if (m_last_timebase_frame && frame <= *m_last_timebase_frame &&
+        !m_timebase_by_frame.contains(frame))
+    {
+      break;
+    }
+
+    std::vector<std::pair<PlayerId, FrameState>>& timebases = m_timebase_by_frame[frame];
+    timebases.emplace_back(player.pid, state);
+    const auto playing = std::ranges::count_if(
+        std::views::values(m_players), [](const Client& client) { return !client.joining; });
+    if (timebases.size() >= static_cast<size_t>(playing))
     {
       // we have all records for this frame
 
-      if (!std::ranges::all_of(timebases, [&](std::pair<PlayerId, u64> pair) {
-            return pair.second == timebases[0].second;
+      // Fingerprints are only compared when every player sent one.
+      const bool compare_fingerprints = std::ranges::all_of(
+          timebases, [](const auto& pair) { return pair.second.fingerprint.has_value(); });
+      const auto same_state = [&](const FrameState& a, const FrameState& b) {
+        return a.timebase == b.timebase &&
+               (!compare_fingerprints || a.fingerprint == b.fingerprint);
+      };
+
+      if (!std::ranges::all_of(timebases, [&](const std::pair<PlayerId, FrameState>& pair) {
+            return same_state(pair.second, timebases[0].second);
           }))
       {
         int pid_to_blame = 0;
-        for (auto pair : timebases)
+        for (const auto& pair : timebases)
         {
-          if (std::ranges::all_of(timebases, [&](std::pair<PlayerId, u64> other) {
-                return other.first == pair.first || other.second != pair.second;
+          if (std::ranges::all_of(timebases, [&](const std::pair<PlayerId, FrameState>& other) {
+                return other.first == pair.first || !same_state(other.second, pair.second);
               }))
           {
             // we are the only outlier
@@ -1095,6 +1639,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
         m_desync_detected = true;
       }
       m_timebase_by_frame.erase(frame);
+      m_last_timebase_frame = std::max(m_last_timebase_frame.value_or(0), frame);
     }
   }
   break;
@@ -1466,6 +2011,9 @@ bool NetPlayServer::SetupNetSettings()
   settings.golf_mode = Config::Get(Config::NETPLAY_NETWORK_MODE) == "golf";
   settings.use_fma = DoAllPlayersHaveHardwareFMA();
   settings.hide_remote_gbas = Config::Get(Config::NETPLAY_HIDE_REMOTE_GBAS);
+  settings.redundant_pad_data = Config::Get(Config::NETPLAY_REDUNDANT_PAD_DATA);
+  settings.state_fingerprints = Config::Get(Config::NETPLAY_STATE_FINGERPRINTS);
+  settings.rollback = Config::Get(Config::NETPLAY_ROLLBACK) && DoAllPlayersSupportRollback();
 
   // Unload GameINI to restore things to normal
   Config::RemoveLayer(Config::LayerType::GlobalGame);
@@ -1486,6 +2034,11 @@ bool NetPlayServer::DoAllPlayersHaveHardwareFMA() const
   return std::ranges::all_of(m_players, [](const auto& p) { return p.second.has_hardware_fma; });
 }
 
+bool NetPlayServer::DoAllPlayersSupportRollback() const
+{
+  return std::ranges::all_of(m_players, [](const auto& p) { return p.second.supports_rollback; });
+}
+
 struct SaveSyncInfo
 {
   u8 save_count = 0;
@@ -1569,20 +2122,63 @@ bool NetPlayServer::StartGame()
   INFO_LOG_FMT(NETPLAY, "Starting game.");
 
   m_timebase_by_frame.clear();
+  m_last_timebase_frame.reset();
   m_desync_detected = false;
   std::lock_guard lkg(m_crit.game);
   // only used as an identifier, not time value, so truncation is fine
   m_current_game = static_cast<u32>(Common::Timer::NowMs());
 
+  m_auto_buffer = Config::Get(Config::NETPLAY_AUTO_BUFFER);
+
+  // Wii Remote inputs aren't part of the spectator stream.
+  const bool delayed_spectators =
+      Config::Get(Config::NETPLAY_DELAYED_SPECTATORS) &&
+      std::ranges::none_of(m_wiimote_map, [](PlayerId pid) { return pid > 0; });
+  const u32 spectator_delay = Config::Get(Config::NETPLAY_SPECTATOR_DELAY);
+
   // no change, just update with clients
   if (!m_host_input_authority)
     AdjustPadBufferSize(m_target_buffer_size);
 
+  ReleaseReservedPads();
+  const bool late_join_allowed = CanLateJoin(delayed_spectators);
+  const u32 preroll_inputs = m_target_buffer_size;
+
+  // The clients only send inputs for the new game once they got the StartGame message, which is
+  // queued after this.
+  RunOnNetworkThread([this, delayed_spectators, spectator_delay, late_join_allowed,
+                      preroll_inputs] {
+    for (PadFrameReceiver& receiver : m_pad_frame_receivers)
+      receiver.Reset();
+    for (PadFrameHistory& history : m_pad_frame_histories)
+      history.Clear();
+
+    m_delayed_spectators = delayed_spectators;
+    m_spectator_inputs.Reset(spectator_delay);
+    for (auto& client : std::views::values(m_players))
+    {
+      client.spectating = delayed_spectators && !client.IsHost() &&
+                          std::ranges::find(m_pad_map, client.pid) == m_pad_map.end();
+    }
+
+    m_late_join_allowed = late_join_allowed;
+    for (LateJoinInputs& inputs : m_late_join_inputs)
+      inputs.Reset(preroll_inputs);
+  });
+
   m_current_golfer = 1;
   m_pending_golfer = 0;
 
   const u64 initial_rtc = GetInitialNetPlayRTC();
 
+  // The clients start running at this time of the server's clock, and until the inputs of the
+  // others arrive they play the first frames with the neutral ones they buffered.
+  u32 max_ping = 0;
+  for (const auto& client : std::views::values(m_players))
+    max_ping = std::max(max_ping, client.ping);
+  const u64 start_time =
+      Common::Timer::NowUs() + u64{std::max(MIN_SCHEDULED_START_DELAY_MS, 2 * max_ping)} * 1000;
+
   const std::string region = Config::GetDirectoryForRegion(
       Config::ToGameCubeRegion(m_dialog->FindGameFile(m_selected_game_identifier)->GetRegion()));
 
@@ -1674,10 +2270,17 @@ bool NetPlayServer::StartGame()
   spac << m_settings.golf_mode;
   spac << m_settings.use_fma;
   spac << m_settings.hide_remote_gbas;
+  spac << m_settings.redundant_pad_data;
+  spac << m_settings.state_fingerprints;
+  spac << m_settings.rollback;
+  spac << start_time;
+  spac << m_target_buffer_size;
 
   for (size_t i = 0; i < sizeof(m_settings.sram); ++i)
     spac << m_settings.sram[i];
 
+  // Players joining the running game start it the same way.
+  m_start_game_packet = spac;
   SendAsyncToClients(std::move(spac));
 
   m_start_pending = false;
@@ -2215,18 +2818,156 @@ u64 NetPlayServer::GetInitialNetPlayRTC() const
 void NetPlayServer::SendToClients(const sf::Packet& packet, const PlayerId skip_pid,
                                   const u8 channel_id)
 {
+  // Only the ---NETPLAY--- thread can use ENet.
+  if (tls_is_control_thread)
+  {
+    SendAsyncToClients(sf::Packet(packet), skip_pid, channel_id);
+    return;
+  }
+
+  ENetPacket* epac = enet_packet_create(packet.getData(), packet.getDataSize(),
+                                        GetChannelPacketFlags(channel_id));
+  if (!epac)
+  {
+    ERROR_LOG_FMT(NETPLAY, "Failed to create ENetPacket ({} bytes).", packet.getDataSize());
+    return;
+  }
+
+  SendToClients(epac, skip_pid, channel_id);
+}
+
+void NetPlayServer::Send(ENetPeer* socket, const sf::Packet& packet, const u8 channel_id)
+{
+  if (tls_is_control_thread)
+  {
+    if (const PlayerId* pid = PeerPlayerId(socket))
+      SendAsync(sf::Packet(packet), *pid, channel_id);
+    return;
+  }
+
+  Common::ENet::SendPacket(socket, packet, channel_id, GetChannelPacketFlags(channel_id));
+}
+
+// called from ---NETPLAY--- thread
+void NetPlayServer::SendToClients(const Common::WirePacket& packet, const PlayerId skip_pid,
+                                  const u8 channel_id)
+{
+  // Only the per-frame inputs are sent with these, delayed spectators get them separately.
+  if (ENetPacket* epac = m_packet_pool.CreatePacket(packet, GetChannelPacketFlags(channel_id)))
+    SendToClients(epac, skip_pid, channel_id, false);
+}
+
+void NetPlayServer::SendToClients(ENetPacket* epac, const PlayerId skip_pid, const u8 channel_id,
+                                  const bool include_spectators)
+{
+  // All clients share the same ENetPacket instead of each getting a copy. ENet counts the
+  // references and destroys it once the last peer is done with it.
   for (auto& p : std::views::values(m_players))
   {
-    if (p.pid && p.pid != skip_pid)
+    if (!p.pid || p.pid == skip_pid || ((p.spectating || p.joining) && !include_spectators))
+      continue;
+
+    if (enet_peer_send(p.socket, channel_id, epac) != 0)
+      ERROR_LOG_FMT(NETPLAY, "Failed to send ENetPacket to player {}.", p.pid);
+  }
+
+  if (epac->referenceCount == 0)
+    enet_packet_destroy(epac);
+}
+
+// called from ---NETPLAY--- thread
+void NetPlayServer::Send(ENetPeer* socket, const Common::WirePacket& packet, const u8 channel_id)
+{
+  if (ENetPacket* epac = m_packet_pool.CreatePacket(packet, GetChannelPacketFlags(channel_id)))
+    Common::ENet::SendPacket(socket, epac, channel_id);
+}
+
+// called from ---NETPLAY--- thread
+void NetPlayServer::AddRelayedInput(const PadIndex map, const GCPadStatus& pad)
+{
+  if (m_delayed_spectators)
+    m_spectator_inputs.Push(map, pad);
+  if (m_late_join_allowed)
+    m_late_join_inputs[map].Push(pad);
+}
+
+// called from ---NETPLAY--- thread
+void NetPlayServer::FillVacantPads()
+{
+  u32 end = 0;
+  for (size_t i = 0; i < m_pad_map.size(); ++i)
+  {
+    if (m_pad_map[i] != 0 && !m_vacant_pads[i])
+      end = std::max(end, m_late_join_inputs[i].GetEnd());
+  }
+
+  sf::Packet spac;
+  spac << MessageID::PadData;
+  bool send_packet = false;
+  const GCPadStatus neutral = GetNeutralPadStatus();
+  for (size_t i = 0; i < m_pad_map.size(); ++i)
+  {
+    if (!m_vacant_pads[i])
+      continue;
+
+    for (u32 input = m_late_join_inputs[i].GetEnd(); input < end; ++input)
     {
-      Send(p.socket, packet, channel_id);
+      const PadIndex map = static_cast<PadIndex>(i);
+      spac << map << neutral.button;
+      spac << neutral.analogA << neutral.analogB << neutral.stickX << neutral.stickY
+           << neutral.substickX << neutral.substickY << neutral.triggerLeft << neutral.triggerRight
+           << neutral.isConnected;
+      AddRelayedInput(map, neutral);
+      send_packet = true;
     }
   }
+
+  if (send_packet)
+    SendToClients(spac);
 }
 
-void NetPlayServer::Send(ENetPeer* socket, const sf::Packet& packet, const u8 channel_id)
+// called from ---NETPLAY--- thread
+void NetPlayServer::SendSpectatorInputs(const bool flush)
 {
-  Common::ENet::SendPacket(socket, packet, channel_id);
+  if (!m_delayed_spectators)
+    return;
+
+  // The batch is laid out like a PadData message, so the spectators can read it the same way.
+  sf::Packet batch;
+  for (const auto& [map, pad] : m_spectator_inputs.TakeBatch(flush))
+  {
+    batch << map << pad.button;
+    if (!m_gba_config[map].enabled)
+    {
+      batch << pad.analogA << pad.analogB << pad.stickX << pad.stickY << pad.substickX
+            << pad.substickY << pad.triggerLeft << pad.triggerRight << pad.isConnected;
+    }
+  }
+
+  const int size = static_cast<int>(batch.getDataSize());
+  if (size == 0)
+    return;
+
+  std::vector<char> compressed(LZ4_compressBound(size));
+  const int compressed_size =
+      LZ4_compress_default(static_cast<const char*>(batch.getData()), compressed.data(), size,
+                           static_cast<int>(compressed.size()));
+  if (compressed_size <= 0)
+  {
+    ERROR_LOG_FMT(NETPLAY, "Failed to compress spectator inputs.");
+    return;
+  }
+
+  sf::Packet spac;
+  spac << MessageID::SpectatorPadData;
+  spac << static_cast<u32>(size) << static_cast<u32>(compressed_size);
+  spac.append(compressed.data(), compressed_size);
+
+  for (const auto& p : std::views::values(m_players))
+  {
+    if (p.spectating)
+      Send(p.socket, spac);
+  }
 }
 
 void NetPlayServer::KickPlayer(PlayerId player)
@@ -2421,9 +3162,9 @@ void NetPlayServer::ChunkedDataThreadFunc()
         break;
       auto& e = m_chunked_data_queue.Front();
       const u32 id = m_next_chunked_data_id++;
+      const u64 data_size = e.packet->getDataSize();
+      const u8* const data = static_cast<const u8*>(e.packet->getData());
 
-      m_chunked_data_complete_count[id] = 0;
-      size_t player_count;
       {
         std::vector<int> players;
         if (e.target_mode == TargetMode::Only)
@@ -2438,28 +3179,40 @@ void NetPlayServer::ChunkedDataThreadFunc()
               players.push_back(pl.pid);
           }
         }
-        player_count = players.size();
+
+        {
+          std::lock_guard lk(m_chunked_data_transfer_lock);
+          m_chunked_data_transfer_id = id;
+          m_chunked_data_transfers.clear();
+          for (const int pid : players)
+            m_chunked_data_transfers.emplace(static_cast<PlayerId>(pid), ChunkedDataTransfer{});
+        }
 
         INFO_LOG_FMT(NETPLAY, "Informing players {} of data chunk {} start.",
                      fmt::join(players, ", "), id);
 
+        // The digest lets the players skip the data they already have, see ChunkedDataCache.
         sf::Packet pac;
         pac << MessageID::ChunkedDataStart;
-        pac << id << e.title << u64{e.packet.getDataSize()};
+        pac << id << e.title << data_size;
+        for (const u8 byte : Common::SHA1::CalculateDigest(data, data_size))
+          pac << byte;
 
         ChunkedDataSend(std::move(pac), e.target_pid, e.target_mode);
 
         if (e.target_mode == TargetMode::AllExcept && e.target_pid == 1)
-          m_dialog->ShowChunkedProgressDialog(e.title, e.packet.getDataSize(), players);
+          m_dialog->ShowChunkedProgressDialog(e.title, data_size, players);
       }
 
       const bool enable_limit = Config::Get(Config::NETPLAY_ENABLE_CHUNKED_UPLOAD_LIMIT);
       const float bytes_per_second =
           (std::max(Config::Get(Config::NETPLAY_CHUNKED_UPLOAD_LIMIT), 1u) / 8.0f) * 1024.0f;
       const std::chrono::duration<double> send_interval(CHUNKED_DATA_UNIT_SIZE / bytes_per_second);
-      bool skip_wait = false;
-      size_t index = 0;
-      do
+
+      // Every player is sent the data on its own, from where it said to resume, so the players
+      // that have it already or got further before are done sooner. The upload limit is per
+      // player, like it was when the same chunks were sent to everyone.
+      while (true)
       {
         if (!m_do_loop)
           return;
@@ -2473,50 +3226,81 @@ void NetPlayServer::ChunkedDataThreadFunc()
           ChunkedDataSend(std::move(pac), e.target_pid, e.target_mode);
           break;
         }
-        if (e.target_mode == TargetMode::Only)
+
+        const auto start = std::chrono::steady_clock::now();
+        bool done = true;
+        bool sent_payload = false;
         {
-          if (!m_players.contains(e.target_pid))
+          std::lock_guard lk(m_chunked_data_transfer_lock);
+          for (auto it = m_chunked_data_transfers.begin(); it != m_chunked_data_transfers.end();)
           {
-            skip_wait = true;
-            break;
+            const PlayerId pid = it->first;
+            ChunkedDataTransfer& transfer = it->second;
+            if (!m_players.contains(pid))
+            {
+              it = m_chunked_data_transfers.erase(it);
+              continue;
+            }
+            ++it;
+
+            if (transfer.complete)
+              continue;
+            done = false;
+
+            if (transfer.resume_offset)
+            {
+              transfer.offset = std::min(*transfer.resume_offset, data_size);
+              transfer.resume_offset.reset();
+              transfer.sending = true;
+            }
+            if (!transfer.sending)
+              continue;
+
+            sf::Packet pac;
+            if (transfer.offset < data_size)
+            {
+              const size_t len = std::min<u64>(CHUNKED_DATA_UNIT_SIZE, data_size - transfer.offset);
+              pac << MessageID::ChunkedDataPayload;
+              pac << id;
+              pac.append(data + transfer.offset, len);
+
+              INFO_LOG_FMT(NETPLAY, "Sending data chunk of {} to player {} ({} bytes at {}/{}).",
+                           id, pid, len, transfer.offset, data_size);
+
+              transfer.offset += len;
+              sent_payload = true;
+            }
+            else
+            {
+              INFO_LOG_FMT(NETPLAY, "Informing player {} of data chunk {} end.", pid, id);
+
+              pac << MessageID::ChunkedDataEnd;
+              pac << id;
+              transfer.sending = false;
+            }
+            SendAsync(std::move(pac), pid, CHUNKED_DATA_CHANNEL);
           }
         }
 
-        auto start = std::chrono::steady_clock::now();
-
-        sf::Packet pac;
-        pac << MessageID::ChunkedDataPayload;
-        pac << id;
-        size_t len = std::min(CHUNKED_DATA_UNIT_SIZE, e.packet.getDataSize() - index);
-        pac.append(static_cast<const u8*>(e.packet.getData()) + index, len);
-
-        INFO_LOG_FMT(NETPLAY, "Sending data chunk of {} ({} bytes at {}/{}).", id, len, index,
-                     e.packet.getDataSize());
-
-        ChunkedDataSend(std::move(pac), e.target_pid, e.target_mode);
-        index += CHUNKED_DATA_UNIT_SIZE;
+        if (done)
+          break;
 
-        if (enable_limit)
+        if (!sent_payload)
+        {
+          // Waiting for the players to answer ChunkedDataStart or ChunkedDataEnd.
+          m_chunked_data_complete_event.Wait();
+        }
+        else if (enable_limit)
         {
           std::chrono::duration<double> delta = std::chrono::steady_clock::now() - start;
           std::this_thread::sleep_for(send_interval - delta);
         }
-      } while (index < e.packet.getDataSize());
+      }
 
-      if (!m_abort_chunked_data)
       {
-        INFO_LOG_FMT(NETPLAY, "Informing players of data chunk {} end.", id);
-
-        sf::Packet pac;
-        pac << MessageID::ChunkedDataEnd;
-        pac << id;
-        ChunkedDataSend(std::move(pac), e.target_pid, e.target_mode);
+        std::lock_guard lk(m_chunked_data_transfer_lock);
+        m_chunked_data_transfers.clear();
       }
-
-      while (m_chunked_data_complete_count[id] < player_count && m_do_loop &&
-             !m_abort_chunked_data && !skip_wait)
-        m_chunked_data_complete_event.Wait();
-      m_chunked_data_complete_count.erase(id);
       m_dialog->HideChunkedProgressDialog();
 
       m_chunked_data_queue.Pop();
@@ -2546,4 +3330,125 @@ void NetPlayServer::ChunkedDataAbort()
   m_chunked_data_event.Set();
   m_chunked_data_complete_event.Set();
 }
+
+// called from OnData on the ---Control--- thread, for the GameStatus of a player that would take
+// the game
+void NetPlayServer::QueueGameTransfer(const PlayerId pid)
+{
+  if (!Config::Get(Config::NETPLAY_TRANSFER_GAMES))
+    return;
+
+  SyncIdentifier game;
+  {
+    std::lock_guard lkg(m_crit.game);
+    game = m_selected_game_identifier;
+  }
+
+  // ELF/DOL files and Datel discs can't be turned into a scrubbed RVZ.
+  if (game.dol_elf_size != 0 || game.is_datel || game.game_id.empty())
+    return;
+
+  if (game != m_game_transfer_game)
+  {
+    m_game_transfer_game = game;
+    m_game_transfer_players.clear();
+  }
+  if (!m_game_transfer_players.insert(pid).second)
+    return;
+
+  const auto game_file = m_dialog->FindGameFile(game);
+  if (!game_file)
+    return;
+
+  m_game_transfer_worker.Push(GameTransfer{pid, std::move(game), game_file->GetFilePath()});
+}
+
+// called from ---Game Transfer--- thread
+void NetPlayServer::TransferGame(GameTransfer transfer)
+{
+  std::shared_ptr<const sf::Packet> packet;
+  if (transfer.game == m_game_transfer_packet_game)
+    packet = m_game_transfer_packet.lock();
+  if (!packet)
+  {
+    if (transfer.game == m_game_transfer_too_large_game)
+      return;
+
+    packet = CreateGameTransferPacket(transfer);
+    if (!packet)
+      return;
+
+    m_game_transfer_packet_game = transfer.game;
+    m_game_transfer_packet = packet;
+  }
+
+  INFO_LOG_FMT(NETPLAY, "Sending {} bytes of the game to player {}.", packet->getDataSize(),
+               transfer.pid);
+  SendChunked(std::move(packet), transfer.pid, "Game Transfer");
+}
+
+// called from ---Game Transfer--- thread
+std::shared_ptr<const sf::Packet>
+NetPlayServer::CreateGameTransferPacket(const GameTransfer& transfer)
+{
+  const auto too_large = [&] {
+    m_game_transfer_too_large_game = transfer.game;
+    m_dialog->AppendChat(
+        Common::GetStringT("The selected game is too large to be sent to other players."));
+    return nullptr;
+  };
+
+  // The conversion is kept, so that the game only has to be converted once for every player.
+  const std::string path = GetTransferredGamePath(transfer.game);
+  if (!File::Exists(path))
+  {
+    INFO_LOG_FMT(NETPLAY, "Converting {} to send it to players.", transfer.source_path);
+
+    // How large the RVZ gets is only known while it's written, so that's when the limit is
+    // checked, instead of after converting all of it.
+    const std::string partial_path = path + ".part";
+    bool exceeded_limit = false;
+    std::unique_ptr<DiscIO::BlobReader> reader = DiscIO::ScrubbedBlob::Create(transfer.source_path);
+    const auto callback = [&](const std::string&, float) {
+      exceeded_limit = File::GetSize(partial_path) > MAX_GAME_TRANSFER_SIZE;
+      return !exceeded_limit && !m_abort_game_transfer;
+    };
+    if (!reader || !File::CreateFullPath(path) ||
+        !DiscIO::ConvertToWIAOrRVZ(reader.get(), transfer.source_path, partial_path, true,
+                                   DiscIO::WIARVZCompressionType::Zstd, 5, 0x20000, callback) ||
+        !File::RenameSync(partial_path, path))
+    {
+      File::Delete(partial_path);
+      if (exceeded_limit)
+        return too_large();
+
+      ERROR_LOG_FMT(NETPLAY, "Failed to convert {} to send it to players.", transfer.source_path);
+      return nullptr;
+    }
+  }
+
+  File::IOFile file(path, "rb");
+  const u64 size = file.GetSize();
+  if (size > MAX_GAME_TRANSFER_SIZE)
+  {
+    file.Close();
+    File::Delete(path);
+    return too_large();
+  }
+
+  std::vector<u8> data(size);
+  if (!file.ReadBytes(data.data(), data.size()))
+  {
+    ERROR_LOG_FMT(NETPLAY, "Failed to read {}.", path);
+    file.Close();
+    File::Delete(path);
+    return nullptr;
+  }
+
+  auto packet = std::make_shared<sf::Packet>();
+  *packet << MessageID::SyncGame;
+  SendSyncIdentifier(*packet, transfer.game);
+  packet->append(data.data(), data.size());
+  return packet;
+}
 }  // namespace NetPlay
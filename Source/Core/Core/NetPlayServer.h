@@ -5,23 +5,35 @@
 
 #include <SFML/Network/Packet.hpp>
 
+#include <atomic>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <set>
 #include <sstream>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
+#include "Common/ENet.h"
 #include "Common/Event.h"
+#include "Common/Functional.h"
 #include "Common/QoSSession.h"
+#include "Common/RelayClient.h"
 #include "Common/SPSCQueue.h"
 #include "Common/Timer.h"
 #include "Common/TraversalClient.h"
+#include "Common/WorkQueueThread.h"
+#include "Core/NetPlayBufferTuner.h"
+#include "Core/NetPlayLateJoin.h"
+#include "Core/NetPlayPadFrames.h"
 #include "Core/NetPlayProto.h"
+#include "Core/NetPlaySpectatorInputs.h"
+#include "Core/NetPlayWiimoteDelta.h"
 #include "Core/SyncIdentifier.h"
 #include "InputCommon/GCPadStatus.h"
 #include "UICommon/NetPlayIndex.h"
@@ -39,6 +51,8 @@ public:
   void SendAsyncToClients(sf::Packet&& packet, PlayerId skip_pid = 0,
                           u8 channel_id = DEFAULT_CHANNEL);
   void SendChunked(sf::Packet&& packet, PlayerId pid, const std::string& title = "");
+  void SendChunked(std::shared_ptr<const sf::Packet> packet, PlayerId pid,
+                   const std::string& title = "");
   void SendChunkedToClients(sf::Packet&& packet, PlayerId skip_pid = 0,
                             const std::string& title = "");
 
@@ -53,6 +67,7 @@ public:
 
   bool DoAllPlayersHaveIPLDump() const;
   bool DoAllPlayersHaveHardwareFMA() const;
+  bool DoAllPlayersSupportRollback() const;
   bool StartGame();
   bool RequestStartGame();
   void AbortGameStart();
@@ -88,10 +103,15 @@ private:
     SyncIdentifierComparison game_status = SyncIdentifierComparison::Unknown;
     bool has_ipl_dump = false;
     bool has_hardware_fma = false;
+    bool supports_rollback = false;
 
     ENetPeer* socket = nullptr;
     u32 ping = 0;
     u32 current_game = 0;
+    // Gets the inputs from the delayed spectator stream instead of the relays.
+    bool spectating = false;
+    // Joined the running game and doesn't get the relays until it has the host's state.
+    bool joining = false;
 
     Common::QoSSession qos_session;
 
@@ -113,14 +133,42 @@ private:
     u8 channel_id = 0;
   };
 
-  struct ChunkedDataQueueEntry
+  // A message that isn't needed to relay the inputs, handled on the ---Control--- thread.
+  struct ControlQueueEntry
   {
     sf::Packet packet;
+    PlayerId pid{};
+  };
+
+  struct ChunkedDataQueueEntry
+  {
+    std::shared_ptr<const sf::Packet> packet;
     PlayerId target_pid{};
     TargetMode target_mode{};
     std::string title;
   };
 
+  // A player being sent the current chunked data.
+  struct ChunkedDataTransfer
+  {
+    // Set from the ---NETPLAY--- thread once the player answered ChunkedDataStart with how much
+    // of the data it already has.
+    std::optional<u64> resume_offset;
+    bool complete = false;
+
+    // Only used by the ---Chunked Data--- thread.
+    u64 offset = 0;
+    bool sending = false;
+  };
+
+  // The host's copy of the selected game, to be sent to a player that doesn't have it.
+  struct GameTransfer
+  {
+    PlayerId pid{};
+    SyncIdentifier game;
+    std::string source_path;
+  };
+
   bool SetupNetSettings();
   std::optional<SaveSyncInfo> CollectSaveSyncInfo();
   bool SyncSaveData(const SaveSyncInfo& sync_info);
@@ -137,9 +185,26 @@ private:
   void SendToClients(const sf::Packet& packet, PlayerId skip_pid = 0,
                      u8 channel_id = DEFAULT_CHANNEL);
   void Send(ENetPeer* socket, const sf::Packet& packet, u8 channel_id = DEFAULT_CHANNEL);
+  // For relaying the messages sent every frame, without building an sf::Packet.
+  void SendToClients(const Common::WirePacket& packet, PlayerId skip_pid = 0,
+                     u8 channel_id = DEFAULT_CHANNEL);
+  void Send(ENetPeer* socket, const Common::WirePacket& packet, u8 channel_id = DEFAULT_CHANNEL);
+  // Takes the packet, which isn't sent to any peer yet.
+  void SendToClients(ENetPacket* epac, PlayerId skip_pid, u8 channel_id,
+                     bool include_spectators = true);
+  void AddRelayedInput(PadIndex map, const GCPadStatus& pad);
+  void FillVacantPads();
+  void SendSpectatorInputs(bool flush = false);
   ConnectionError OnConnect(ENetPeer* socket, sf::Packet& received_packet);
   unsigned int OnDisconnect(const Client& player);
   unsigned int OnData(sf::Packet& packet, Client& player);
+  bool CanLateJoin(bool delayed_spectators) const;
+  void QueueLateJoin(PlayerId pid);
+  void RequestNextLateJoin();
+  unsigned int OnLateJoinState(sf::Packet& packet, const Client& player);
+  void ReleaseReservedPads();
+  void RunOnNetworkThread(Common::MoveOnlyFunction<void()> task);
+  void HandleNetworkTasks();
 
   void OnTraversalStateChanged() override;
   void OnConnectReady(ENetAddress) override {}
@@ -149,9 +214,15 @@ private:
   void UpdateGBAConfig();
   void UpdateWiimoteMapping();
   std::vector<std::pair<std::string, std::string>> GetInterfaceListInternal() const;
+  void UpdateRelay();
+  void ControlThreadFunc();
+  void HandleControlDisconnects();
   void ChunkedDataThreadFunc();
   void ChunkedDataSend(sf::Packet&& packet, PlayerId pid, const TargetMode target_mode);
   void ChunkedDataAbort();
+  void QueueGameTransfer(PlayerId pid);
+  void TransferGame(GameTransfer transfer);
+  std::shared_ptr<const sf::Packet> CreateGameTransferPacket(const GameTransfer& transfer);
 
   void SetupIndex();
   bool PlayerHasControllerMapped(PlayerId pid) const;
@@ -171,6 +242,28 @@ private:
   bool m_update_pings = false;
   u32 m_current_game = 0;
   unsigned int m_target_buffer_size = 0;
+  // Whether the pad buffer follows the measured round trip times while a game is running.
+  bool m_auto_buffer = false;
+  BufferTuner m_buffer_tuner;
+  // Redundant pad data mode. The inputs received from the owner of each pad, which are relayed to
+  // the other clients.
+  std::array<PadFrameReceiver, 4> m_pad_frame_receivers;
+  std::array<PadFrameHistory, 4> m_pad_frame_histories;
+  // Delayed spectators, clients without a controller. The inputs are held back by
+  // NETPLAY_SPECTATOR_DELAY frames and sent to them in LZ4 compressed batches, so the players
+  // never depend on how well they keep up.
+  bool m_delayed_spectators = false;
+  SpectatorInputs m_spectator_inputs;
+  // Late join, see NetPlay::LateJoinInputs. The players that were mapped to a pad and dropped out
+  // keep their ID, by name, so they get the same pads back when they join again. Their pads are
+  // vacant until then.
+  bool m_late_join_allowed = false;
+  std::array<LateJoinInputs, 4> m_late_join_inputs;
+  std::array<bool, 4> m_vacant_pads{};
+  std::map<std::string, PlayerId> m_reserved_pids;
+  sf::Packet m_start_game_packet;
+  std::deque<PlayerId> m_late_join_queue;
+  PlayerId m_late_join_pid = 0;
   PadMappingArray m_pad_map;
   GBAConfigArray m_gba_config;
   PadMappingArray m_wiimote_map;
@@ -185,7 +278,15 @@ private:
 
   std::map<PlayerId, Client> m_players;
 
-  std::unordered_map<u32, std::vector<std::pair<PlayerId, u64>>> m_timebase_by_frame;
+  // What a player reported about its state at a frame, see NetPlay::StateFingerprint.
+  struct FrameState
+  {
+    u64 timebase = 0;
+    std::optional<u64> fingerprint;
+  };
+  std::unordered_map<u32, std::vector<std::pair<PlayerId, FrameState>>> m_timebase_by_frame;
+  // Players that joined late report the frames the others already did.
+  std::optional<u32> m_last_timebase_frame;
   bool m_desync_detected = false;
 
   struct
@@ -198,20 +299,46 @@ private:
   } m_crit;
 
   Common::SPSCQueue<AsyncQueueEntry> m_async_queue;
+  // Must outlive m_server.
+  Common::ENet::PacketPool m_packet_pool;
   Common::SPSCQueue<ChunkedDataQueueEntry> m_chunked_data_queue;
 
   SyncIdentifier m_selected_game_identifier;
   std::string m_selected_game_name;
   std::thread m_thread;
+  // The ---NETPLAY--- thread only handles what's needed to relay the inputs itself, so that slow
+  // messages don't hold them up, and passes everything else on to the ---Control--- thread. That
+  // one can't use ENet, so what it sends goes through the async queue, and players it wants to
+  // kick through m_control_disconnect_queue. The state of the relays is only changed by the
+  // ---NETPLAY--- thread, the other threads queue that work in m_network_tasks.
+  Common::SPSCQueue<ControlQueueEntry> m_control_queue;
+  Common::SPSCQueue<PlayerId> m_control_disconnect_queue;
+  Common::SPSCQueue<Common::MoveOnlyFunction<void()>> m_network_tasks;
+  Common::Event m_control_event;
+  std::thread m_control_thread;
   Common::Event m_chunked_data_event;
   Common::Event m_chunked_data_complete_event;
   std::thread m_chunked_data_thread;
   u32 m_next_chunked_data_id = 0;
-  std::unordered_map<u32, unsigned int> m_chunked_data_complete_count;
+  std::mutex m_chunked_data_transfer_lock;
+  u32 m_chunked_data_transfer_id = 0;
+  std::map<PlayerId, ChunkedDataTransfer> m_chunked_data_transfers;
   bool m_abort_chunked_data = false;
+  // The players the selected game was queued to be sent to, only used by the ---Control--- thread.
+  SyncIdentifier m_game_transfer_game;
+  std::set<PlayerId> m_game_transfer_players;
+  Common::WorkQueueThreadSP<GameTransfer> m_game_transfer_worker;
+  // The players that are sent the same game share the packet, which is kept until the last of
+  // them got it. Only used by the ---Game Transfer--- thread, like the game that is too large.
+  SyncIdentifier m_game_transfer_packet_game;
+  std::weak_ptr<const sf::Packet> m_game_transfer_packet;
+  SyncIdentifier m_game_transfer_too_large_game;
+  std::atomic<bool> m_abort_game_transfer = false;
 
   ENetHost* m_server = nullptr;
   Common::TraversalClient* m_traversal_client = nullptr;
+  std::unique_ptr<Common::RelayClient> m_relay_client;
+  u16 m_relay_session_port = 0;
   NetPlayUI* m_dialog = nullptr;
   NetPlayIndex m_index;
 };
@@ -0,0 +1,35 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlaySpectatorInputs.h"
+
+namespace NetPlay
+{
+void SpectatorInputs::Reset(u32 delay)
+{
+  for (std::deque<GCPadStatus>& inputs : m_inputs)
+    inputs.clear();
+  m_delay = delay;
+}
+
+void SpectatorInputs::Push(s8 pad, const GCPadStatus& status)
+{
+  m_inputs[pad].push_back(status);
+}
+
+std::vector<std::pair<s8, GCPadStatus>> SpectatorInputs::TakeBatch(bool flush)
+{
+  std::vector<std::pair<s8, GCPadStatus>> batch;
+  for (size_t i = 0; i < m_inputs.size(); ++i)
+  {
+    std::deque<GCPadStatus>& inputs = m_inputs[i];
+    const size_t keep = flush ? 0 : m_delay;
+    if (!flush && inputs.size() < keep + BATCH_SIZE)
+      continue;
+
+    for (; inputs.size() > keep; inputs.pop_front())
+      batch.emplace_back(static_cast<s8>(i), inputs.front());
+  }
+  return batch;
+}
+}  // namespace NetPlay
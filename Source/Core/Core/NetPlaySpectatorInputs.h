@@ -0,0 +1,35 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "InputCommon/GCPadStatus.h"
+
+namespace NetPlay
+{
+// The inputs the server holds back for the delayed spectators. They are sent in batches of
+// BATCH_SIZE, once that many of a pad are older than the delay.
+class SpectatorInputs
+{
+public:
+  static constexpr size_t BATCH_SIZE = 10;
+
+  void Reset(u32 delay);
+  void Push(s8 pad, const GCPadStatus& status);
+
+  // Takes the inputs that are due, in order per pad. With flush, every input is due, which is
+  // used when the game ends, so the spectators get to see the last frames too.
+  std::vector<std::pair<s8, GCPadStatus>> TakeBatch(bool flush);
+
+private:
+  std::array<std::deque<GCPadStatus>, 4> m_inputs;
+  u32 m_delay = 0;
+};
+}  // namespace NetPlay
@@ -0,0 +1,70 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayStateFingerprint.h"
+
+#include <xxhash.h>
+
+#include "Core/CoreTiming.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+namespace NetPlay
+{
+namespace
+{
+u64 HashSlice(const u8* data, u32 size, u32 slice, u64 seed)
+{
+  if (!data)
+    return seed;
+
+  const u64 begin = u64{size} * slice / StateFingerprint::INTERVAL;
+  const u64 end = u64{size} * (slice + 1) / StateFingerprint::INTERVAL;
+  return XXH3_64bits_withSeed(data + begin, end - begin, seed);
+}
+
+template <typename T>
+u64 HashValue(const T& value, u64 seed)
+{
+  return XXH3_64bits_withSeed(&value, sizeof(value), seed);
+}
+}  // namespace
+
+void StateFingerprint::Reset(u32 frame)
+{
+  m_ram_hash = 0;
+  m_frame = frame;
+  m_complete = frame % INTERVAL == 0;
+}
+
+void StateFingerprint::Update(Core::System& system)
+{
+  auto& memory = system.GetMemory();
+  const u32 slice = m_frame % INTERVAL;
+  m_ram_hash = HashSlice(memory.GetRAM(), memory.GetRamSizeReal(), slice, m_ram_hash);
+  m_ram_hash = HashSlice(memory.GetEXRAM(), memory.GetExRamSizeReal(), slice, m_ram_hash);
+  ++m_frame;
+}
+
+u64 StateFingerprint::Take(Core::System& system)
+{
+  const auto& ppc_state = system.GetPPCState();
+  u64 hash = m_ram_hash;
+  hash = HashValue(ppc_state.pc, hash);
+  hash = HashValue(ppc_state.gpr, hash);
+  for (const PowerPC::PairedSingle& ps : ppc_state.ps)
+    hash = HashValue(ps.ps1, HashValue(ps.ps0, hash));
+  hash = HashValue(ppc_state.cr.Get(), hash);
+  hash = HashValue(ppc_state.msr.Hex, hash);
+  hash = HashValue(ppc_state.fpscr.Hex, hash);
+  hash = HashValue(ppc_state.xer_ca, hash);
+  hash = HashValue(ppc_state.xer_so_ov, hash);
+  hash = HashValue(ppc_state.sr, hash);
+  hash = HashValue(system.GetCoreTiming().GetEventQueueHash(), hash);
+
+  m_ram_hash = 0;
+  m_complete = true;
+  return hash;
+}
+}  // namespace NetPlay
@@ -0,0 +1,41 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace Core
+{
+class System;
+}
+
+namespace NetPlay
+{
+// A cheap fingerprint of the emulated state, which the players compare to notice a desync soon
+// after it happens instead of when it shows.
+//
+// Hashing all of RAM at once would cause a hitch, so every frame hashes the next 1/INTERVAL of it,
+// and the fingerprint taken every INTERVAL frames covers all of it once. The CPU registers and the
+// CoreTiming event queue are hashed when the fingerprint is taken.
+class StateFingerprint
+{
+public:
+  static constexpr u32 INTERVAL = 60;
+
+  // Starts at the given frame. A fingerprint of an interval that started before it is incomplete.
+  void Reset(u32 frame = 0);
+  // Called once per frame on the CPU thread.
+  void Update(Core::System& system);
+  // Called on the CPU thread. Starts the next fingerprint.
+  u64 Take(Core::System& system);
+  // Whether the next fingerprint covers all of RAM, which it doesn't right after joining a
+  // running game.
+  bool IsComplete() const { return m_complete; }
+
+private:
+  u64 m_ram_hash = 0;
+  u32 m_frame = 0;
+  bool m_complete = true;
+};
+}  // namespace NetPlay
@@ -0,0 +1,89 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayWiimoteDelta.h"
+
+#include <bit>
+
+namespace NetPlay
+{
+namespace
+{
+// Only as many mask bytes as the state has bytes are sent.
+u32 GetMaskSize(u8 length)
+{
+  return (length + 7) / 8;
+}
+}  // namespace
+
+WiimoteStateDelta WiimoteStateDelta::Make(const State& previous, const State& state)
+{
+  WiimoteStateDelta delta;
+  delta.length = state.length;
+
+  u32 count = 0;
+  for (u32 i = 0; i < state.length; ++i)
+  {
+    if (previous.length == state.length && previous.data[i] == state.data[i])
+      continue;
+
+    delta.mask |= 1u << i;
+    delta.bytes[count++] = state.data[i];
+  }
+  return delta;
+}
+
+WiimoteStateDelta::State WiimoteStateDelta::Apply(const State& previous) const
+{
+  State state = previous;
+  state.length = length;
+
+  u32 count = 0;
+  for (u32 i = 0; i < length; ++i)
+  {
+    if (mask & (1u << i))
+      state.data[i] = bytes[count++];
+  }
+  return state;
+}
+
+template <typename Packet>
+void WriteWiimoteStateDelta(Packet& packet, const WiimoteStateDelta& delta)
+{
+  packet << delta.length;
+  for (u32 i = 0; i < GetMaskSize(delta.length); ++i)
+    packet << static_cast<u8>(delta.mask >> (i * 8));
+
+  const int count = std::popcount(delta.mask);
+  for (int i = 0; i < count; ++i)
+    packet << delta.bytes[i];
+}
+
+template void WriteWiimoteStateDelta(sf::Packet&, const WiimoteStateDelta&);
+template void WriteWiimoteStateDelta(Common::WirePacket&, const WiimoteStateDelta&);
+
+bool ReadWiimoteStateDelta(sf::Packet& packet, WiimoteStateDelta* delta)
+{
+  packet >> delta->length;
+  if (!packet || delta->length > delta->bytes.size())
+    return false;
+
+  delta->mask = 0;
+  for (u32 i = 0; i < GetMaskSize(delta->length); ++i)
+  {
+    u8 mask_byte;
+    packet >> mask_byte;
+    delta->mask |= u32{mask_byte} << (i * 8);
+  }
+
+  // Bits beyond the length would make the receivers read bytes that aren't there.
+  if ((delta->mask >> delta->length) != 0)
+    return false;
+
+  const int count = std::popcount(delta->mask);
+  for (int i = 0; i < count; ++i)
+    packet >> delta->bytes[i];
+
+  return static_cast<bool>(packet);
+}
+}  // namespace NetPlay
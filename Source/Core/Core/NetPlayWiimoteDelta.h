@@ -0,0 +1,38 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include <SFML/Network/Packet.hpp>
+
+#include "Common/CommonTypes.h"
+#include "Common/WirePacket.h"
+#include "Core/HW/WiimoteEmu/DesiredWiimoteState.h"
+
+namespace NetPlay
+{
+// Wii Remote states are sent as the bytes that changed since the previous state of the same Wii
+// Remote, which most of the time is a few of the accelerometer and camera bytes. This relies on
+// the states arriving in order, which they do on the reliable channel. A state with a different
+// length than the previous one is sent whole.
+struct WiimoteStateDelta
+{
+  using State = WiimoteEmu::SerializedWiimoteState;
+
+  u8 length = 0;
+  // Bit i is set if byte i changed.
+  u32 mask = 0;
+  // The changed bytes, in order.
+  std::array<u8, sizeof(State::data)> bytes{};
+
+  static WiimoteStateDelta Make(const State& previous, const State& state);
+  State Apply(const State& previous) const;
+};
+
+template <typename Packet>
+void WriteWiimoteStateDelta(Packet& packet, const WiimoteStateDelta& delta);
+// Returns false if the delta is malformed.
+bool ReadWiimoteStateDelta(sf::Packet& packet, WiimoteStateDelta* delta);
+}  // namespace NetPlay
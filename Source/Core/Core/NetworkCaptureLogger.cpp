@@ -7,6 +7,7 @@
 #include <cerrno>
 #include <cstring>
 #include <iterator>
+#include <utility>
 
 #include <fmt/chrono.h>
 #include <fmt/format.h>
@@ -51,11 +52,24 @@ void DummyNetworkCaptureLogger::LogBBA(const void* data, std::size_t length)
 {
 }
 
+void DummyNetworkCaptureLogger::OnDisconnect(s32 socket)
+{
+}
+
+void DummyNetworkCaptureLogger::Dump()
+{
+}
+
 NetworkCaptureType DummyNetworkCaptureLogger::GetCaptureType() const
 {
   return NetworkCaptureType::None;
 }
 
+std::size_t DummyNetworkCaptureLogger::GetRingBufferSize() const
+{
+  return 0;
+}
+
 void BinarySSLCaptureLogger::LogSSLRead(const void* data, std::size_t length, s32 socket)
 {
   if (!Config::Get(Config::MAIN_NETWORK_SSL_DUMP_READ))
@@ -79,16 +93,37 @@ NetworkCaptureType BinarySSLCaptureLogger::GetCaptureType() const
   return NetworkCaptureType::Raw;
 }
 
-PCAPSSLCaptureLogger::PCAPSSLCaptureLogger()
+static std::unique_ptr<Common::PCAP> CreatePCAPFile(const std::string& game_id)
+{
+  const std::string base_path =
+      fmt::format("{}{} {:%Y-%m-%d %Hh%Mm%Ss}", File::GetUserPath(D_DUMPSSL_IDX), game_id,
+                  *Common::LocalTime(std::time(nullptr)));
+
+  // Ring buffers can be dumped more than once a second.
+  std::string filepath = base_path + ".pcap";
+  for (int i = 2; File::Exists(filepath); ++i)
+    filepath = fmt::format("{} ({}).pcap", base_path, i);
+
+  return std::make_unique<Common::PCAP>(new File::IOFile(filepath, "wb", File::SharedAccess::Read),
+                                        Common::PCAP::LinkType::Ethernet);
+}
+
+PCAPSSLCaptureLogger::PCAPSSLCaptureLogger(std::size_t ring_buffer_size)
+    : m_ring_buffer_size(ring_buffer_size)
 {
-  const std::string filepath =
-      fmt::format("{}{} {:%Y-%m-%d %Hh%Mm%Ss}.pcap", File::GetUserPath(D_DUMPSSL_IDX),
-                  SConfig::GetInstance().GetGameID(), *Common::LocalTime(std::time(nullptr)));
-  m_file = std::make_unique<Common::PCAP>(
-      new File::IOFile(filepath, "wb", File::SharedAccess::Read), Common::PCAP::LinkType::Ethernet);
+  if (m_ring_buffer_size == 0)
+    m_file = CreatePCAPFile(SConfig::GetInstance().GetGameID());
+
+  m_writer.Reset("Network capture", [this](WriteRequest request) { Write(std::move(request)); },
+                 Common::ThreadPriority::Background);
 }
 
-PCAPSSLCaptureLogger::~PCAPSSLCaptureLogger() = default;
+PCAPSSLCaptureLogger::~PCAPSSLCaptureLogger()
+{
+  // What the ring buffer still has would otherwise be lost.
+  Dump();
+  m_writer.Shutdown();
+}
 
 void PCAPSSLCaptureLogger::OnNewSocket(s32 socket)
 {
@@ -125,9 +160,82 @@ void PCAPSSLCaptureLogger::LogBBA(const void* data, std::size_t length)
   if (!Config::Get(Config::MAIN_NETWORK_DUMP_BBA))
     return;
 
-  // Concurrency between CEXIETHERNET's RecvHandlePacket and SendFromDirectFIFO
-  const std::lock_guard lock(m_io_mutex);
-  m_file->AddPacket(static_cast<const u8*>(data), length);
+  const u8* bytes = static_cast<const u8*>(data);
+  AddPacket(std::vector<u8>(bytes, bytes + length));
+}
+
+void PCAPSSLCaptureLogger::OnDisconnect(s32 socket)
+{
+  if (m_ring_buffer_size == 0)
+    return;
+
+  const auto state = Common::SaveNetworkErrorState();
+  Common::ScopeGuard guard([&state] { Common::RestoreNetworkErrorState(state); });
+
+  int socket_type;
+  socklen_t option_length = sizeof(int);
+  if (getsockopt(socket, SOL_SOCKET, SO_TYPE, reinterpret_cast<char*>(&socket_type),
+                 &option_length) == 0 &&
+      socket_type == SOCK_STREAM)
+  {
+    Dump();
+  }
+}
+
+void PCAPSSLCaptureLogger::Dump()
+{
+  if (m_ring_buffer_size == 0)
+    return;
+
+  WriteRequest request;
+  {
+    const std::lock_guard lock(m_ring_buffer_mutex);
+    if (m_ring_buffer.empty())
+      return;
+
+    request.packets.assign(std::make_move_iterator(m_ring_buffer.begin()),
+                           std::make_move_iterator(m_ring_buffer.end()));
+    m_ring_buffer.clear();
+    m_ring_buffer_used = 0;
+  }
+
+  request.dump_game_id = SConfig::GetInstance().GetGameID();
+  m_writer.Push(std::move(request));
+}
+
+// Called from the sockets and from CEXIETHERNET's RecvHandlePacket and SendFromDirectFIFO, which
+// can be on different threads.
+void PCAPSSLCaptureLogger::AddPacket(std::vector<u8> data)
+{
+  Packet packet{std::chrono::system_clock::now(), std::move(data)};
+
+  if (m_ring_buffer_size == 0)
+  {
+    WriteRequest request;
+    request.packets.push_back(std::move(packet));
+    m_writer.Push(std::move(request));
+    return;
+  }
+
+  const std::lock_guard lock(m_ring_buffer_mutex);
+  m_ring_buffer_used += packet.data.size();
+  m_ring_buffer.push_back(std::move(packet));
+  while (m_ring_buffer_used > m_ring_buffer_size)
+  {
+    m_ring_buffer_used -= m_ring_buffer.front().data.size();
+    m_ring_buffer.pop_front();
+  }
+}
+
+void PCAPSSLCaptureLogger::Write(WriteRequest request)
+{
+  std::unique_ptr<Common::PCAP> dump_file;
+  if (request.dump_game_id)
+    dump_file = CreatePCAPFile(*request.dump_game_id);
+
+  Common::PCAP& file = dump_file ? *dump_file : *m_file;
+  for (const Packet& packet : request.packets)
+    file.AddPacket(packet.data.data(), packet.data.size(), packet.time);
 }
 
 void PCAPSSLCaptureLogger::Log(LogType log_type, const void* data, std::size_t length, s32 socket,
@@ -210,11 +318,16 @@ void PCAPSSLCaptureLogger::LogIPv4(LogType log_type, const u8* data, u16 length,
   }
 
   packet.insert(packet.end(), data, data + length);
-  m_file->AddPacket(packet.data(), packet.size());
+  AddPacket(std::move(packet));
 }
 
 NetworkCaptureType PCAPSSLCaptureLogger::GetCaptureType() const
 {
   return NetworkCaptureType::PCAP;
 }
+
+std::size_t PCAPSSLCaptureLogger::GetRingBufferSize() const
+{
+  return m_ring_buffer_size;
+}
 }  // namespace Core
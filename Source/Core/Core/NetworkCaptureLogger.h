@@ -4,10 +4,15 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <cstddef>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
 
 #ifdef _WIN32
 #include <WinSock2.h>
@@ -19,6 +24,7 @@ using socklen_t = int;
 #endif
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 
 namespace Common
 {
@@ -54,7 +60,14 @@ public:
 
   virtual void LogBBA(const void* data, std::size_t length) = 0;
 
+  // Called when the other end of a socket closed the connection.
+  virtual void OnDisconnect(s32 socket) = 0;
+  // Writes the traffic that is kept in memory to a file.
+  virtual void Dump() = 0;
+
   virtual NetworkCaptureType GetCaptureType() const = 0;
+  // How many bytes of the latest traffic are kept in memory instead of written, or 0.
+  virtual std::size_t GetRingBufferSize() const = 0;
 };
 
 class DummyNetworkCaptureLogger : public NetworkCaptureLogger
@@ -70,7 +83,11 @@ public:
 
   void LogBBA(const void* data, std::size_t length) override;
 
+  void OnDisconnect(s32 socket) override;
+  void Dump() override;
+
   NetworkCaptureType GetCaptureType() const override;
+  std::size_t GetRingBufferSize() const override;
 };
 
 class BinarySSLCaptureLogger final : public DummyNetworkCaptureLogger
@@ -82,10 +99,13 @@ public:
   NetworkCaptureType GetCaptureType() const override;
 };
 
+// The packets are written on a thread of their own, so that capturing doesn't hold up the sockets.
+// With a ring buffer size, only that much of the latest traffic is kept, in memory, until it is
+// dumped.
 class PCAPSSLCaptureLogger final : public NetworkCaptureLogger
 {
 public:
-  PCAPSSLCaptureLogger();
+  explicit PCAPSSLCaptureLogger(std::size_t ring_buffer_size = 0);
   ~PCAPSSLCaptureLogger() override;
 
   void OnNewSocket(s32 socket) override;
@@ -98,7 +118,11 @@ public:
 
   void LogBBA(const void* data, std::size_t length) override;
 
+  void OnDisconnect(s32 socket) override;
+  void Dump() override;
+
   NetworkCaptureType GetCaptureType() const override;
+  std::size_t GetRingBufferSize() const override;
 
 private:
   enum class LogType
@@ -107,13 +131,35 @@ private:
     Write,
   };
 
+  struct Packet
+  {
+    std::chrono::system_clock::time_point time;
+    std::vector<u8> data;
+  };
+
+  struct WriteRequest
+  {
+    // Set for dumping the packets to a new file for the game, otherwise they go to m_file.
+    std::optional<std::string> dump_game_id;
+    std::vector<Packet> packets;
+  };
+
   void Log(LogType log_type, const void* data, std::size_t length, s32 socket, sockaddr* other);
   void LogIPv4(LogType log_type, const u8* data, u16 length, s32 socket, const sockaddr_in& from,
                const sockaddr_in& to);
+  void AddPacket(std::vector<u8> data);
+  void Write(WriteRequest request);
 
   std::unique_ptr<Common::PCAP> m_file;
-  std::mutex m_io_mutex;
   std::map<s32, u32> m_read_sequence_number;
   std::map<s32, u32> m_write_sequence_number;
+
+  const std::size_t m_ring_buffer_size;
+  std::mutex m_ring_buffer_mutex;
+  std::deque<Packet> m_ring_buffer;
+  std::size_t m_ring_buffer_used = 0;
+
+  // Destroyed first, so that it is done writing before anything it writes with goes away.
+  Common::WorkQueueThread<WriteRequest> m_writer;
 };
 }  // namespace Core
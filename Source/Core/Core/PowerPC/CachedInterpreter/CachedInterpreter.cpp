@@ -20,8 +20,10 @@
 #include "Core/HW/CPU.h"
 #include "Core/Host.h"
 #include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/Interpreter/ExceptionUtils.h"
 #include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/Jit64Common/Jit64Constants.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -221,6 +223,74 @@ s32 CachedInterpreter::CheckIdle(PowerPC::PowerPCState& ppc_state,
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+template <typename T>
+static u32 CompareToField(T a, T b, bool summary_overflow)
+{
+  u32 cr_field;
+  if (a < b)
+    cr_field = PowerPC::CR_LT;
+  else if (a > b)
+    cr_field = PowerPC::CR_GT;
+  else
+    cr_field = PowerPC::CR_EQ;
+
+  if (summary_overflow)
+    cr_field |= PowerPC::CR_SO;
+  return cr_field;
+}
+
+template <typename T>
+s32 CachedInterpreter::LoadCompareBranch(PowerPC::PowerPCState& ppc_state,
+                                         const LoadCompareBranchOperands& operands)
+{
+  const u32 address =
+      (operands.load_ra ? ppc_state.gpr[operands.load_ra] : 0) + operands.load_offset;
+  const u32 value = operands.mmu.Read<T>(address);
+  if (!(ppc_state.Exceptions & EXCEPTION_DSI))
+    ppc_state.gpr[operands.load_rd] = value;
+
+  const u32 a = ppc_state.gpr[operands.compare_ra];
+  const u32 cr_field =
+      operands.compare_signed ?
+          CompareToField(static_cast<s32>(a), static_cast<s32>(operands.compare_imm),
+                         ppc_state.GetXER_SO()) :
+          CompareToField(a, operands.compare_imm, ppc_state.GetXER_SO());
+  ppc_state.cr.SetField(operands.compare_crf, cr_field);
+
+  ppc_state.pc = operands.branch_pc;
+  if (ppc_state.cr.GetBit(operands.branch_bi) == u32(operands.branch_if_true))
+    ppc_state.npc = operands.branch_target;
+  else
+    ppc_state.npc = operands.branch_pc + 4;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::AddiStoreWord(PowerPC::PowerPCState& ppc_state,
+                                     const AddiStoreWordOperands& operands)
+{
+  ppc_state.gpr[operands.addi_rd] =
+      (operands.addi_ra ? ppc_state.gpr[operands.addi_ra] : 0) + operands.addi_imm;
+  const u32 address =
+      (operands.store_ra ? ppc_state.gpr[operands.store_ra] : 0) + operands.store_offset;
+  operands.mmu.Write<u32>(ppc_state.gpr[operands.store_rs], address);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::PairedLoad(PowerPC::PowerPCState& ppc_state,
+                                  const PairedLoadOperands& operands)
+{
+  if (HID2(ppc_state).LSQE == 0)
+  {
+    GenerateProgramException(ppc_state, ProgramExceptionCause::IllegalInstruction);
+    return sizeof(AnyCallback) + sizeof(operands);
+  }
+
+  const u32 address = (operands.ra ? ppc_state.gpr[operands.ra] : 0) + operands.offset;
+  Interpreter::Helper_Dequantize(operands.mmu, &ppc_state, address, operands.gqr, operands.frd,
+                                 operands.w);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 bool CachedInterpreter::HandleFunctionHooking(u32 address)
 {
   // CachedInterpreter inherits from JitBase and is considered a JIT by relevant code.
@@ -239,6 +309,91 @@ bool CachedInterpreter::HandleFunctionHooking(u32 address)
   return true;
 }
 
+bool CachedInterpreter::CanFuseInstructions(u32 index, u32 count)
+{
+  if (index + count > code_block.m_num_instructions)
+    return false;
+
+  // Only the last instruction may end the block, and the rest have to directly follow the first
+  // one, without being skipped or hooked.
+  const u32 first_address = m_code_buffer[index].address;
+  for (u32 i = 0; i < count; ++i)
+  {
+    const PPCAnalyst::CodeOp& op = m_code_buffer[index + i];
+    if (op.skip || (op.canEndBlock && i != count - 1) || op.address != first_address + i * 4)
+      return false;
+    if (i != 0 && HLE::TryReplaceFunction(m_ppc_symbol_db, op.address, PowerPC::CoreMode::JIT))
+      return false;
+  }
+  return true;
+}
+
+u32 CachedInterpreter::WriteSuperinstruction(u32 index)
+{
+  // Exceptions are only checked after each instruction with memcheck, and breakpoints and branch
+  // watch need each instruction to be run on its own.
+  if (jo.memcheck || IsDebuggingEnabled())
+    return 0;
+
+  auto& mmu = m_system.GetMMU();
+  const UGeckoInstruction inst = m_code_buffer[index].inst;
+
+  if ((inst.OPCD == 32 || inst.OPCD == 34 || inst.OPCD == 40) && CanFuseInstructions(index, 3))
+  {
+    const UGeckoInstruction compare = m_code_buffer[index + 1].inst;
+    const UGeckoInstruction branch = m_code_buffer[index + 2].inst;
+    if ((compare.OPCD == 10 || compare.OPCD == 11) && branch.OPCD == 16 && !branch.LK &&
+        (branch.BO & BO_DONT_DECREMENT_FLAG) != 0 && (branch.BO & BO_DONT_CHECK_CONDITION) == 0 &&
+        branch.BI >> 2 == compare.CRFD)
+    {
+      const u32 branch_pc = m_code_buffer[index + 2].address;
+      const u32 branch_offset = SignExt16(s16(branch.BD << 2));
+      const LoadCompareBranchOperands operands = {
+          .mmu = mmu,
+          .load_offset = u32(inst.SIMM_16),
+          .compare_imm = compare.OPCD == 11 ? u32(compare.SIMM_16) : compare.UIMM,
+          .branch_pc = branch_pc,
+          .branch_target = branch.AA ? branch_offset : branch_pc + branch_offset,
+          .load_rd = static_cast<u8>(inst.RD),
+          .load_ra = static_cast<u8>(inst.RA),
+          .compare_ra = static_cast<u8>(compare.RA),
+          .compare_crf = static_cast<u8>(compare.CRFD),
+          .branch_bi = static_cast<u8>(branch.BI),
+          .compare_signed = compare.OPCD == 11,
+          .branch_if_true = ((branch.BO >> 3) & 1) != 0,
+      };
+      if (inst.OPCD == 32)
+        Write(LoadCompareBranch<u32>, operands);
+      else if (inst.OPCD == 40)
+        Write(LoadCompareBranch<u16>, operands);
+      else
+        Write(LoadCompareBranch<u8>, operands);
+      return 3;
+    }
+  }
+
+  if (inst.OPCD == 14 && CanFuseInstructions(index, 2))
+  {
+    const UGeckoInstruction store = m_code_buffer[index + 1].inst;
+    if (store.OPCD == 36)
+    {
+      Write(AddiStoreWord, {mmu, u32(inst.SIMM_16), u32(store.SIMM_16), static_cast<u8>(inst.RD),
+                            static_cast<u8>(inst.RA), static_cast<u8>(store.RS),
+                            static_cast<u8>(store.RA)});
+      return 2;
+    }
+  }
+
+  if (inst.OPCD == 56 && !m_code_buffer[index].canEndBlock)
+  {
+    Write(PairedLoad, {mmu, u32(inst.SIMM_12), static_cast<u8>(inst.RA), static_cast<u8>(inst.RD),
+                       static_cast<u8>(inst.I), static_cast<u8>(inst.W)});
+    return 1;
+  }
+
+  return 0;
+}
+
 void CachedInterpreter::WriteEndBlock()
 {
   if (IsProfilingEnabled())
@@ -387,8 +542,22 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         js.firstFPInstructionFound = true;
       }
 
+      if (const u32 fused = WriteSuperinstruction(i); fused != 0)
+      {
+        // The first instruction was already accounted for above.
+        for (u32 j = i + 1; j < i + fused; ++j)
+        {
+          const PPCAnalyst::CodeOp& fused_op = m_code_buffer[j];
+          js.downcountAmount += fused_op.opinfo->num_cycles;
+          if (fused_op.opinfo->flags & FL_LOADSTORE)
+            ++js.numLoadStoreInst;
+          if (fused_op.opinfo->flags & FL_USE_FPU)
+            ++js.numFloatingPointInst;
+        }
+        i += fused - 1;
+      }
       // Instruction may cause a DSI Exception or Program Exception.
-      if ((jo.memcheck && (op.opinfo->flags & FL_LOADSTORE) != 0) ||
+      else if ((jo.memcheck && (op.opinfo->flags & FL_LOADSTORE) != 0) ||
           (!op.canEndBlock && ShouldHandleFPExceptionForInstruction(&op)))
       {
         const InterpretAndCheckExceptionsOperands operands = {
@@ -407,9 +576,10 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
               operands);
       }
 
-      if (op.branchIsIdleLoop)
+      const PPCAnalyst::CodeOp& last_op = m_code_buffer[i];
+      if (last_op.branchIsIdleLoop)
         Write(CheckIdle, {m_system.GetCoreTiming(), js.blockStart});
-      if (op.canEndBlock)
+      if (last_op.canEndBlock)
         WriteEndBlock();
     }
   }
@@ -82,6 +82,9 @@ private:
   struct WriteBrokenBlockNPCOperands;
   struct CheckHaltOperands;
   struct CheckIdleOperands;
+  struct LoadCompareBranchOperands;
+  struct AddiStoreWordOperands;
+  struct PairedLoadOperands;
 
   static s32 StartProfiledBlock(PowerPC::PowerPCState& ppc_state,
                                 const StartProfiledBlockOperands& operands);
@@ -112,6 +115,24 @@ private:
   static s32 CheckIdle(PowerPC::PowerPCState& ppc_state, const CheckIdleOperands& operands);
   static s32 CheckIdle(std::ostream& stream, const CheckIdleOperands& operands);
 
+  // Superinstructions, which run a common sequence of instructions with their operands decoded
+  // ahead of time, without going through the interpreter for each of them.
+  template <typename T>
+  static s32 LoadCompareBranch(PowerPC::PowerPCState& ppc_state,
+                               const LoadCompareBranchOperands& operands);
+  template <typename T>
+  static s32 LoadCompareBranch(std::ostream& stream, const LoadCompareBranchOperands& operands);
+  static s32 AddiStoreWord(PowerPC::PowerPCState& ppc_state,
+                           const AddiStoreWordOperands& operands);
+  static s32 AddiStoreWord(std::ostream& stream, const AddiStoreWordOperands& operands);
+  static s32 PairedLoad(PowerPC::PowerPCState& ppc_state, const PairedLoadOperands& operands);
+  static s32 PairedLoad(std::ostream& stream, const PairedLoadOperands& operands);
+
+  // Writes a superinstruction for the instructions starting at index in the code buffer, if they
+  // form one. Returns how many instructions it covers, or 0 if none was written.
+  u32 WriteSuperinstruction(u32 index);
+  bool CanFuseInstructions(u32 index, u32 count);
+
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges;
   CachedInterpreterBlockCache m_block_cache;
 };
@@ -175,3 +196,45 @@ struct CachedInterpreter::CheckIdleOperands
   CoreTiming::CoreTimingManager& core_timing;
   u32 idle_pc;
 };
+
+// lwz/lhz/lbz, then cmpwi/cmplwi, then a bc on the compared field that doesn't use CTR.
+struct CachedInterpreter::LoadCompareBranchOperands
+{
+  PowerPC::MMU& mmu;
+  u32 load_offset;
+  u32 compare_imm;
+  u32 branch_pc;
+  u32 branch_target;
+  u8 load_rd;
+  u8 load_ra;
+  u8 compare_ra;
+  u8 compare_crf;
+  u8 branch_bi;
+  bool compare_signed;
+  bool branch_if_true;
+  u8 : 8;
+};
+
+// addi, then stw.
+struct CachedInterpreter::AddiStoreWordOperands
+{
+  PowerPC::MMU& mmu;
+  u32 addi_imm;
+  u32 store_offset;
+  u8 addi_rd;
+  u8 addi_ra;
+  u8 store_rs;
+  u8 store_ra;
+  u32 : 32;
+};
+
+// psq_l.
+struct CachedInterpreter::PairedLoadOperands
+{
+  PowerPC::MMU& mmu;
+  u32 offset;
+  u8 ra;
+  u8 frd;
+  u8 gqr;
+  u8 w;
+};
@@ -90,6 +90,38 @@ s32 CachedInterpreter::CheckIdle(std::ostream& stream, const CheckIdleOperands&
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+template <typename T>
+s32 CachedInterpreter::LoadCompareBranch(std::ostream& stream,
+                                         const LoadCompareBranchOperands& operands)
+{
+  fmt::println(stream,
+               "LoadCompareBranch<u{}>(load_rd=r{}, load_ra=r{}, load_offset={}, compare_ra=r{}, "
+               "compare_imm={}, compare_signed={}, compare_crf={}, branch_pc=0x{:08x}, "
+               "branch_target=0x{:08x}, branch_bi={}, branch_if_true={})",
+               sizeof(T) * 8, operands.load_rd, operands.load_ra, s32(operands.load_offset),
+               operands.compare_ra, s32(operands.compare_imm), operands.compare_signed,
+               operands.compare_crf, operands.branch_pc, operands.branch_target, operands.branch_bi,
+               operands.branch_if_true);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::AddiStoreWord(std::ostream& stream, const AddiStoreWordOperands& operands)
+{
+  fmt::println(stream,
+               "AddiStoreWord(addi_rd=r{}, addi_ra=r{}, addi_imm={}, store_rs=r{}, store_ra=r{}, "
+               "store_offset={})",
+               operands.addi_rd, operands.addi_ra, s32(operands.addi_imm), operands.store_rs,
+               operands.store_ra, s32(operands.store_offset));
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::PairedLoad(std::ostream& stream, const PairedLoadOperands& operands)
+{
+  fmt::println(stream, "PairedLoad(frd=f{}, ra=r{}, offset={}, gqr={}, w={})", operands.frd,
+               operands.ra, s32(operands.offset), operands.gqr, operands.w);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 static std::once_flag s_sorted_lookup_flag;
 
 std::size_t CachedInterpreter::Disassemble(const JitBlock& block, std::ostream& stream)
@@ -115,6 +147,11 @@ std::size_t CachedInterpreter::Disassemble(const JitBlock& block, std::ostream&
       LOOKUP_KV(CachedInterpreter::CheckFPU),
       LOOKUP_KV(CachedInterpreter::CheckBreakpoint),
       LOOKUP_KV(CachedInterpreter::CheckIdle),
+      LOOKUP_KV(CachedInterpreter::LoadCompareBranch<u8>),
+      LOOKUP_KV(CachedInterpreter::LoadCompareBranch<u16>),
+      LOOKUP_KV(CachedInterpreter::LoadCompareBranch<u32>),
+      LOOKUP_KV(CachedInterpreter::AddiStoreWord),
+      LOOKUP_KV(CachedInterpreter::PairedLoad),
   });
 
 #undef LOOKUP_KV
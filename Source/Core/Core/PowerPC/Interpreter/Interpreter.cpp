@@ -217,6 +217,16 @@ void Interpreter::SingleStep()
   }
 }
 
+int Interpreter::RunBlock()
+{
+  m_end_block = false;
+
+  int cycles = 0;
+  while (!m_end_block)
+    cycles += SingleStepInner();
+  return cycles;
+}
+
 // #define SHOW_HISTORY
 #ifdef SHOW_HISTORY
 static std::vector<u32> s_pc_vec;
@@ -36,6 +36,9 @@ public:
   void Shutdown() override;
   void SingleStep() override;
   int SingleStepInner();
+  // Runs the instructions up to and including the next branch, or up to an exception. Returns
+  // the cycles they took, which aren't taken from the downcount yet.
+  int RunBlock();
 
   void Run() override;
   void ClearCache() override;
@@ -293,6 +296,8 @@ public:
   static void RunTable63(Interpreter& interpreter, UGeckoInstruction inst);
 
   static u32 Helper_Carry(u32 value1, u32 value2);
+  static void Helper_Dequantize(PowerPC::MMU& mmu, PowerPC::PowerPCState* ppcs, u32 addr,
+                                u32 instI, u32 instRD, u32 instW);
 
 private:
   void CheckExceptions();
@@ -11,6 +11,7 @@
 
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
+#include "Core/HW/GPFifo.h"
 #include "Core/PowerPC/Interpreter/ExceptionUtils.h"
 #include "Core/PowerPC/Interpreter/Interpreter_FPUtils.h"
 #include "Core/PowerPC/JitInterface.h"
@@ -305,6 +306,21 @@ void Interpreter::stmw(Interpreter& interpreter, UGeckoInstruction inst)
     return;
   }
 
+  // All of the words fit into the gather pipe before it has to be checked for full bursts. They can
+  // only be written at once if a memcheck doesn't need to see each write, and if all of them are on
+  // the page of the gather pipe, which is where the slow path would write them to as well.
+  const u32 size = (32 - inst.RS) * sizeof(u32);
+  if (!interpreter.m_system.GetPowerPC().GetMemChecks().HasAny() &&
+      (address & PowerPC::HW_PAGE_MASK) + size <= PowerPC::HW_PAGE_SIZE &&
+      interpreter.m_mmu.IsOptimizableGatherPipeWrite(address))
+  {
+    auto& gpfifo = interpreter.m_system.GetGPFifo();
+    for (u32 i = inst.RS; i <= 31; i++)
+      gpfifo.FastWrite32(ppc_state.gpr[i]);
+    gpfifo.CheckGatherPipe();
+    return;
+  }
+
   for (u32 i = inst.RS; i <= 31; i++, address += 4)
   {
     interpreter.m_mmu.Write<u32>(ppc_state.gpr[i], address);
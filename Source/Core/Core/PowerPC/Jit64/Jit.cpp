@@ -18,6 +18,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumUtils.h"
+#include "Common/FrameProfiler.h"
 #include "Common/GekkoDisassembler.h"
 #include "Common/HostDisassembler.h"
 #include "Common/IOFile.h"
@@ -339,6 +340,7 @@ void Jit64::ResetFreeMemoryRanges()
 
 void Jit64::Shutdown()
 {
+  CloseDiskCache();
   FreeCodeSpace();
 
   auto& memory = m_system.GetMemory();
@@ -759,6 +761,9 @@ void Jit64::Trace()
 
 void Jit64::Jit(u32 em_address)
 {
+  Common::FrameProfiler::Scope profiler_scope(Common::FrameProfiler::Stage::JitCompile);
+
+  PrewarmBlocks();
   Jit(em_address, true);
 }
 
@@ -805,10 +810,15 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
+  analyzer.SetSuperblockEnabled(IsHotBlock(em_address));
   const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
 
   if (code_block.m_memory_exception)
   {
+    // A block from the disk cache ran into code that isn't mapped. Leave it for the game to run.
+    if (m_prewarming)
+      return;
+
     // Address of instruction could not be translated
     m_ppc_state.npc = nextPC;
     m_ppc_state.Exceptions |= EXCEPTION_ISI;
@@ -844,6 +854,7 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
       b->far_end = far_end;
 
       blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block, m_code_buffer);
+      RecordBlock(em_address);
 
 #ifdef JIT_LOG_GENERATED_CODE
       LogGeneratedCode();
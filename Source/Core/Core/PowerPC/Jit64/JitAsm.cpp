@@ -67,11 +67,12 @@ void Jit64AsmRoutineManager::Generate()
 
   const u8* outerLoop = GetCodePtr();
   ABI_PushRegistersAndAdjustStack({}, 0);
-  ABI_CallFunction(CoreTiming::GlobalAdvance);
+  MOV(64, R(ABI_PARAM1), Imm64(reinterpret_cast<u64>(&m_jit)));
+  ABI_CallFunction(JitAdvance);
   ABI_PopRegistersAndAdjustStack({}, 0);
 
   // When we've just entered the jit we need to update the membase
-  // GlobalAdvance also checks exceptions after which we need to
+  // JitAdvance also checks exceptions after which we need to
   // update the membase so it makes sense to do this here.
   MOV(64, R(RMEM), PPCSTATE(mem_ptr));
 
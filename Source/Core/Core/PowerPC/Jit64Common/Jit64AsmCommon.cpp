@@ -468,13 +468,11 @@ void QuantizedMemoryRoutines::GenQuantizedStore(bool single, EQuantizeType type,
     {
       SHR(32, R(RSCRATCH2), Imm8(5));
       LEA(64, RSCRATCH, MConst(m_quantizeTableS));
-      MOVQ_xmm(XMM1, MRegSum(RSCRATCH2, RSCRATCH));
-      MULPS(XMM0, R(XMM1));
+      GenMultiplyPairByScale(MRegSum(RSCRATCH2, RSCRATCH));
     }
     else if (quantize > 0)
     {
-      MOVQ_xmm(XMM1, MConst(m_quantizeTableS, quantize * 2));
-      MULPS(XMM0, R(XMM1));
+      GenMultiplyPairByScale(MConst(m_quantizeTableS, quantize * 2));
     }
 
     bool hasPACKUSDW = cpu_info.bSSE4_1;
@@ -682,13 +680,11 @@ void QuantizedMemoryRoutines::GenQuantizedLoad(bool single, EQuantizeType type,
     {
       SHR(32, R(RSCRATCH2), Imm8(5));
       LEA(64, RSCRATCH, MConst(m_dequantizeTableS));
-      MOVQ_xmm(XMM1, MRegSum(RSCRATCH2, RSCRATCH));
-      MULPS(XMM0, R(XMM1));
+      GenMultiplyPairByScale(MRegSum(RSCRATCH2, RSCRATCH));
     }
     else if (quantize > 0)
     {
-      MOVQ_xmm(XMM1, MConst(m_dequantizeTableS, quantize * 2));
-      MULPS(XMM0, R(XMM1));
+      GenMultiplyPairByScale(MConst(m_dequantizeTableS, quantize * 2));
     }
   }
 }
@@ -715,3 +711,19 @@ void QuantizedMemoryRoutines::GenQuantizedLoadFloat(bool single, bool isInline)
     MOVQ_xmm(XMM0, R(RSCRATCH_EXTRA));
   }
 }
+
+void QuantizedMemoryRoutines::GenMultiplyPairByScale(const OpArg& scale)
+{
+  if (cpu_info.bAVX)
+  {
+    // Memory operands of VEX encoded instructions don't have to be aligned, so the scales are
+    // used in place. This also reads the entry after them, which only affects the upper half of
+    // XMM0 that is never used.
+    VMULPS(XMM0, XMM0, scale);
+  }
+  else
+  {
+    MOVQ_xmm(XMM1, scale);
+    MULPS(XMM0, R(XMM1));
+  }
+}
@@ -21,6 +21,7 @@ public:
 private:
   void GenQuantizedLoadFloat(bool single, bool isInline);
   void GenQuantizedStoreFloat(bool single, bool isInline);
+  void GenMultiplyPairByScale(const Gen::OpArg& scale);
 };
 
 class CommonAsmRoutines : public CommonAsmRoutinesBase, public QuantizedMemoryRoutines
@@ -14,6 +14,7 @@
 #include "Common/Arm64Emitter.h"
 #include "Common/CommonTypes.h"
 #include "Common/EnumUtils.h"
+#include "Common/FrameProfiler.h"
 #include "Common/GekkoDisassembler.h"
 #include "Common/HostDisassembler.h"
 #include "Common/Logging/Log.h"
@@ -248,6 +249,7 @@ void JitArm64::ResetFreeMemoryRanges(size_t routines_near_size, size_t routines_
 
 void JitArm64::Shutdown()
 {
+  CloseDiskCache();
   auto& memory = m_system.GetMemory();
   memory.ShutdownFastmemArena();
   FreeCodeSpace();
@@ -946,6 +948,9 @@ void JitArm64::Trace()
 
 void JitArm64::Jit(u32 em_address)
 {
+  Common::FrameProfiler::Scope profiler_scope(Common::FrameProfiler::Stage::JitCompile);
+
+  PrewarmBlocks();
   Jit(em_address, true);
 }
 
@@ -986,10 +991,15 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
+  analyzer.SetSuperblockEnabled(IsHotBlock(em_address));
   const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
 
   if (code_block.m_memory_exception)
   {
+    // A block from the disk cache ran into code that isn't mapped. Leave it for the game to run.
+    if (m_prewarming)
+      return;
+
     // Address of instruction could not be translated
     m_ppc_state.npc = nextPC;
     m_ppc_state.Exceptions |= EXCEPTION_ISI;
@@ -1031,6 +1041,7 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
       b->far_end = far_end;
 
       blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block, m_code_buffer);
+      RecordBlock(em_address);
 
 #ifdef JIT_LOG_GENERATED_CODE
       LogGeneratedCode();
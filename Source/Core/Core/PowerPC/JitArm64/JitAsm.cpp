@@ -201,10 +201,10 @@ void JitArm64::GenerateAsm()
   FixupBranch exit = CBNZ(ARM64Reg::W8);
 
   SetJumpTarget(to_start_of_timing_slice);
-  ABI_CallFunction(&CoreTiming::GlobalAdvance);
+  ABI_CallFunction(&JitAdvance, this);
 
   // When we've just entered the jit we need to update the membase
-  // GlobalAdvance also checks exceptions after which we need to
+  // JitAdvance also checks exceptions after which we need to
   // update the membase so it makes sense to do this here.
   EmitUpdateMembase();
 
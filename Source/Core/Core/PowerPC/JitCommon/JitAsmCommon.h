@@ -8,8 +8,9 @@
 alignas(16) extern const u8 pbswapShuffle1x4[16];
 alignas(16) extern const u8 pbswapShuffle2x4[16];
 alignas(16) extern const float m_one[4];
-alignas(16) extern const float m_quantizeTableS[128];
-alignas(16) extern const float m_dequantizeTableS[128];
+// Padded by an entry, so that 16 bytes can be read from the last one.
+alignas(16) extern const float m_quantizeTableS[130];
+alignas(16) extern const float m_dequantizeTableS[130];
 
 struct CommonAsmRoutinesBase
 {
@@ -19,9 +19,12 @@
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
 #include "Core/MemTools.h"
+#include "Core/NetPlayProto.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
+#include "VideoCommon/VideoEvents.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -57,7 +60,7 @@
 // After resetting the stack to the top, we call _resetstkoflw() to restore
 // the guard page at the 256kb mark.
 
-const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitBase::JIT_SETTINGS{{
+const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 25> JitBase::JIT_SETTINGS{{
     {&JitBase::bJITOff, &Config::MAIN_DEBUG_JIT_OFF},
     {&JitBase::bJITLoadStoreOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_OFF},
     {&JitBase::bJITLoadStorelXzOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_LXZ_OFF},
@@ -81,6 +84,8 @@ const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitB
     {&JitBase::m_accurate_nans, &Config::MAIN_ACCURATE_NANS},
     {&JitBase::m_fastmem_enabled, &Config::MAIN_FASTMEM},
     {&JitBase::m_accurate_cpu_cache_enabled, &Config::MAIN_ACCURATE_CPU_CACHE},
+    {&JitBase::m_tiered_compilation, &Config::MAIN_JIT_TIERED_COMPILATION},
+    {&JitBase::m_superblocks, &Config::MAIN_JIT_SUPERBLOCKS},
 }};
 
 const u8* JitBase::Dispatch(JitBase& jit)
@@ -90,7 +95,16 @@ const u8* JitBase::Dispatch(JitBase& jit)
 
 void JitTrampoline(JitBase& jit, u32 em_address)
 {
-  jit.Jit(em_address);
+  if (jit.ShouldInterpretBlock(em_address))
+    jit.InterpretBlock();
+  else
+    jit.Jit(em_address);
+}
+
+void JitAdvance(JitBase& jit)
+{
+  jit.SampleHotBlock();
+  jit.m_system.GetCoreTiming().Advance();
 }
 
 JitBase::JitBase(Core::System& system)
@@ -140,6 +154,20 @@ void JitBase::RefreshConfig()
   jo.memcheck = m_system.IsMMUMode() || m_system.IsPauseOnPanicMode() || any_watchpoints;
   jo.fp_exceptions = m_enable_float_exceptions;
   jo.div_by_zero_exceptions = m_enable_div_by_zero_exceptions;
+
+  // Which blocks are interpreted depends on when they were compiled, which isn't the same for
+  // every player, and the interpreter checks the downcount at other places than the JIT.
+  m_interpret_cold_blocks = m_tiered_compilation && !m_enable_debugging &&
+                            !SConfig::GetInstance().bJITNoBlockCache &&
+                            !NetPlay::IsNetPlayRunning();
+  m_block_misses.clear();
+
+  // Samples are taken at timing slices, so which blocks become superblocks doesn't depend on the
+  // host, but the block boundaries decide when exceptions are checked.
+  m_sample_hot_blocks = m_superblocks && m_enable_branch_following && !m_enable_debugging &&
+                        !SConfig::GetInstance().bJITNoBlockCache && !NetPlay::IsNetPlayRunning();
+  m_hot_block_samples.clear();
+  m_hot_blocks.clear();
 }
 
 void JitBase::InitFastmemArena()
@@ -260,6 +288,106 @@ void JitBase::CleanUpAfterStackFault()
   }
 }
 
+bool JitBase::ShouldInterpretBlock(u32 em_address)
+{
+  if (!m_interpret_cold_blocks)
+    return false;
+
+  const u64 key = (u64{m_ppc_state.feature_flags} << 32) | em_address;
+  u32& misses = m_block_misses[key];
+  if (misses >= COLD_BLOCK_RUNS)
+    return false;
+
+  ++misses;
+  return true;
+}
+
+void JitBase::InterpretBlock()
+{
+  m_ppc_state.downcount -= m_system.GetInterpreter().RunBlock();
+
+  // What a compiled block does when it exits with the downcount used up, except for checking the
+  // CPU state, which the next compiled block does.
+  if (m_ppc_state.downcount <= 0)
+  {
+    m_ppc_state.npc = m_ppc_state.pc;
+    m_system.GetCoreTiming().Advance();
+  }
+}
+
+void JitBase::SampleHotBlock()
+{
+  if (!m_sample_hot_blocks)
+    return;
+
+  const u64 key = (u64{m_ppc_state.feature_flags} << 32) | m_ppc_state.pc;
+  if (m_hot_blocks.contains(key))
+    return;
+
+  if (++m_hot_block_samples[key] < HOT_BLOCK_SAMPLES)
+  {
+    // Blocks that only ever got a few samples would pile up otherwise.
+    if (m_hot_block_samples.size() > MAX_HOT_BLOCK_SAMPLES)
+      m_hot_block_samples.clear();
+    return;
+  }
+
+  m_hot_block_samples.erase(key);
+  m_hot_blocks.insert(key);
+
+  // The dispatcher doesn't find it anymore and compiles it again. The code it took up isn't
+  // reused until the next compile, which resets the stack the BLR optimization may have pointed
+  // into it with.
+  if (JitBlock* block = GetBlockCache()->GetBlockFromStartAddress(m_ppc_state.pc,
+                                                                  m_ppc_state.feature_flags))
+  {
+    EraseSingleBlock(*block);
+  }
+}
+
+bool JitBase::IsHotBlock(u32 em_address) const
+{
+  return m_sample_hot_blocks &&
+         m_hot_blocks.contains((u64{m_ppc_state.feature_flags} << 32) | em_address);
+}
+
+void JitBase::PrewarmBlocks()
+{
+  if (m_prewarming || IsDebuggingEnabled() || SConfig::GetInstance().bJITNoBlockCache)
+    return;
+
+  // Not in Init, since the game ID isn't known before the game booted.
+  if (!m_disk_cache_opened)
+  {
+    m_disk_cache_opened = true;
+    m_disk_cache.Open();
+    m_disk_cache_frame_hook = m_system.GetVideoEvents().vi_end_field_event.Register(
+        [this] { m_disk_cache.StartFrame(); });
+    return;
+  }
+
+  m_prewarming = true;
+  m_disk_cache.Prewarm(m_mmu, *GetBlockCache(), m_ppc_state.feature_flags,
+                       [this](u32 address) { Jit(address); });
+  m_prewarming = false;
+}
+
+void JitBase::RecordBlock(u32 em_address)
+{
+  if (m_prewarming || IsDebuggingEnabled())
+    return;
+
+  m_disk_cache.Record(em_address, m_ppc_state.feature_flags, m_code_buffer,
+                      code_block.m_num_instructions);
+}
+
+void JitBase::CloseDiskCache()
+{
+  m_disk_cache_frame_hook.reset();
+  m_disk_cache.Close();
+  m_disk_cache_opened = false;
+}
+
 bool JitBase::CanMergeNextInstructions(int count) const
 {
   if (m_system.GetCPU().IsStepping() || js.instructionsLeft < count)
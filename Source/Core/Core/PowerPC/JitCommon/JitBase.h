@@ -8,6 +8,7 @@
 #include <iosfwd>
 #include <map>
 #include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -15,6 +16,7 @@
 #include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
 #include "Common/Config/ConfigInfo.h"
+#include "Common/HookableEvent.h"
 #include "Common/x64Emitter.h"
 #include "Core/CPUThreadConfigCallback.h"
 #include "Core/ConfigManager.h"
@@ -22,6 +24,7 @@
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/JitCommon/JitAsmCommon.h"
 #include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/JitCommon/JitDiskCache.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 
 namespace Core
@@ -160,12 +163,30 @@ protected:
   bool m_accurate_nans = false;
   bool m_fastmem_enabled = false;
   bool m_accurate_cpu_cache_enabled = false;
+  bool m_tiered_compilation = false;
+  bool m_superblocks = false;
 
   bool m_enable_blr_optimization = false;
   bool m_cleanup_after_stackfault = false;
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JIT_SETTINGS;
+  JitDiskCache m_disk_cache;
+  bool m_disk_cache_opened = false;
+  bool m_prewarming = false;
+  Common::EventHook m_disk_cache_frame_hook;
+
+  // With tiered compilation, how often the dispatcher didn't find a block at each address, by
+  // (feature_flags << 32) | address.
+  std::unordered_map<u64, u32> m_block_misses;
+  bool m_interpret_cold_blocks = false;
+
+  // With superblocks, how often each block was the next one to run when a timing slice ran out,
+  // and the blocks that were so often enough to be recompiled as superblocks, by the same key.
+  std::unordered_map<u64, u32> m_hot_block_samples;
+  std::unordered_set<u64> m_hot_blocks;
+  bool m_sample_hot_blocks = false;
+
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 25> JIT_SETTINGS;
 
   bool DoesConfigNeedRefresh() const;
   void RefreshConfig();
@@ -177,6 +198,14 @@ protected:
   void UnprotectStack();
   void CleanUpAfterStackFault();
 
+  // Called before compiling a block, compiles the ones the disk cache has ready.
+  void PrewarmBlocks();
+  // Called after compiling a block, adds it to the disk cache.
+  void RecordBlock(u32 em_address);
+  void CloseDiskCache();
+
+  bool IsHotBlock(u32 em_address) const;
+
   bool CanMergeNextInstructions(int count) const;
   bool HasConstantCarry() const
   {
@@ -205,6 +234,23 @@ public:
 
   virtual void Jit(u32 em_address) = 0;
 
+  // Lets the disk cache check the blocks again whose code wasn't loaded yet.
+  void InvalidateDiskCacheRange(u32 address, u32 size) { m_disk_cache.Invalidate(address, size); }
+
+  // With tiered compilation, blocks are run by the interpreter the first COLD_BLOCK_RUNS times
+  // the dispatcher doesn't find them, so that code that only runs a few times, like the code
+  // a game runs once after loading it, is never compiled.
+  static constexpr u32 COLD_BLOCK_RUNS = 2;
+  bool ShouldInterpretBlock(u32 em_address);
+  void InterpretBlock();
+
+  // With superblocks, the dispatcher samples the block that runs next every time a timing slice
+  // runs out, which costs nothing in the compiled code. A block sampled HOT_BLOCK_SAMPLES times is
+  // erased, and compiled again following more branches.
+  static constexpr u32 HOT_BLOCK_SAMPLES = 32;
+  static constexpr size_t MAX_HOT_BLOCK_SAMPLES = 0x4000;
+  void SampleHotBlock();
+
   virtual void EraseSingleBlock(const JitBlock& block) = 0;
 
   // Memory region name, free size, and fragmentation ratio
@@ -233,3 +279,5 @@ public:
 };
 
 void JitTrampoline(JitBase& jit, u32 em_address);
+// Called by the dispatcher instead of CoreTiming::GlobalAdvance.
+void JitAdvance(JitBase& jit);
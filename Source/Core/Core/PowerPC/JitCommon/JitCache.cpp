@@ -8,10 +8,13 @@
 #include <cstring>
 #include <functional>
 #include <map>
+#include <optional>
 #include <ranges>
 #include <set>
 #include <span>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/JitRegister.h"
@@ -29,6 +32,38 @@
 
 using namespace Gen;
 
+namespace
+{
+void EraseAddressesInRange(std::unordered_set<u32>& addresses, u32 address, u32 length)
+{
+  // These sets are small, while a DMA can invalidate a lot of memory at once.
+  if (length / 4 > addresses.size())
+  {
+    std::erase_if(addresses, [&](u32 i) { return i - address < length; });
+    return;
+  }
+
+  for (u32 i = address; i < address + length; i += 4)
+    addresses.erase(i);
+}
+
+template <typename Func>
+void ForEachPage(const std::set<u32>& physical_addresses, u32 page_shift, Func func)
+{
+  // The addresses are sorted, so the ones on a page are next to each other.
+  std::optional<u32> previous_page;
+  for (const u32 addr : physical_addresses)
+  {
+    const u32 page = addr >> page_shift;
+    if (page == previous_page)
+      continue;
+
+    func(page);
+    previous_page = page;
+  }
+}
+}  // namespace
+
 bool JitBlock::OverlapsPhysicalRange(u32 address, u32 length) const
 {
   return physical_addresses.lower_bound(address) !=
@@ -47,6 +82,124 @@ void JitBlock::ProfileData::EndProfiling(ProfileData* data, u32 downcount_amount
   data->time_spent += Clock::now() - data->time_start;
 }
 
+void JitBlockLinkMap::Clear()
+{
+  std::ranges::fill(m_slots, Slot{});
+  m_used_slots = 0;
+}
+
+void JitBlockLinkMap::Insert(JitBlock::LinkData& link)
+{
+  // Keep the table at most half full, so that the probe sequences stay short.
+  if ((m_used_slots + 1) * 2 > m_slots.size())
+    Grow();
+
+  Slot& slot = m_slots[FindSlot(link.exitAddress)];
+  if (!slot.head)
+  {
+    slot.address = link.exitAddress;
+    ++m_used_slots;
+  }
+
+  link.prev_link_to = nullptr;
+  link.next_link_to = slot.head;
+  if (slot.head)
+    slot.head->prev_link_to = &link;
+  slot.head = &link;
+}
+
+void JitBlockLinkMap::Remove(JitBlock::LinkData& link)
+{
+  if (link.prev_link_to)
+  {
+    link.prev_link_to->next_link_to = link.next_link_to;
+  }
+  else
+  {
+    if (m_slots.empty())
+      return;
+
+    const size_t index = FindSlot(link.exitAddress);
+    if (m_slots[index].head != &link)
+      return;
+
+    m_slots[index].head = link.next_link_to;
+    if (!link.next_link_to)
+      EraseSlot(index);
+  }
+
+  if (link.next_link_to)
+    link.next_link_to->prev_link_to = link.prev_link_to;
+  link.prev_link_to = nullptr;
+  link.next_link_to = nullptr;
+}
+
+JitBlock::LinkData* JitBlockLinkMap::Find(u32 address) const
+{
+  if (m_slots.empty())
+    return nullptr;
+  return m_slots[FindSlot(address)].head;
+}
+
+size_t JitBlockLinkMap::GetHomeSlot(u32 address) const
+{
+  // Fibonacci hashing. Exit addresses are 4-byte aligned and often close to each other, so the
+  // low bits alone would collide a lot.
+  return static_cast<size_t>((u64{address} * 0x9E3779B97F4A7C15ULL) >> (64 - m_shift));
+}
+
+size_t JitBlockLinkMap::FindSlot(u32 address) const
+{
+  const size_t mask = m_slots.size() - 1;
+  size_t index = GetHomeSlot(address);
+  while (m_slots[index].head && m_slots[index].address != address)
+    index = (index + 1) & mask;
+  return index;
+}
+
+void JitBlockLinkMap::EraseSlot(size_t index)
+{
+  // Linear probing without tombstones: move the slots after the erased one back if their probe
+  // sequence passes through it.
+  const size_t mask = m_slots.size() - 1;
+  m_slots[index] = {};
+  --m_used_slots;
+
+  for (size_t next = (index + 1) & mask; m_slots[next].head; next = (next + 1) & mask)
+  {
+    const size_t home = GetHomeSlot(m_slots[next].address);
+    if (((next - home) & mask) >= ((next - index) & mask))
+    {
+      m_slots[index] = m_slots[next];
+      m_slots[next] = {};
+      index = next;
+    }
+  }
+}
+
+void JitBlockLinkMap::Grow()
+{
+  std::vector<Slot> old_slots = std::exchange(m_slots, {});
+  m_shift = m_shift ? m_shift + 1 : INITIAL_SHIFT;
+  m_slots.resize(size_t{1} << m_shift);
+
+  for (const Slot& slot : old_slots)
+  {
+    if (slot.head)
+      m_slots[FindSlot(slot.address)] = slot;
+  }
+}
+
+void ValidBlockBitSet::ClearRange(u32 begin, u32 end)
+{
+  while (begin < end && begin % 32 != 0)
+    Clear(begin++);
+  if (begin < end)
+    memset(&m_valid_block[begin / 32], 0, sizeof(u32) * ((end - begin) / 32));
+  for (u32 bit = std::max(begin, end - end % 32); bit < end; ++bit)
+    Clear(bit);
+}
+
 JitBaseBlockCache::JitBaseBlockCache(JitBase& jit) : m_jit{jit}
 {
 }
@@ -55,7 +208,8 @@ JitBaseBlockCache::~JitBaseBlockCache() = default;
 
 void JitBaseBlockCache::Init()
 {
-  Common::JitRegister::Init(Config::Get(Config::MAIN_PERF_MAP_DIR));
+  Common::JitRegister::Init(Config::Get(Config::MAIN_PERF_MAP_DIR),
+                            Config::Get(Config::MAIN_PERF_JITDUMP));
 
   m_entry_points_ptr = nullptr;
 #ifdef _ARCH_64
@@ -88,8 +242,9 @@ void JitBaseBlockCache::Clear()
     DestroyBlock(e.second);
   }
   block_map.clear();
-  links_to.clear();
-  block_range_map.clear();
+  links_to.Clear();
+  block_page_map.clear();
+  code_pages.fill(0);
 
   valid_block.ClearAll();
 
@@ -172,16 +327,15 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   }
 
   for (u32 addr : block.physical_addresses)
-  {
     valid_block.Set(addr / 32);
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].insert(&block);
-  }
+  AddBlockToPages(block);
 
   if (block_link)
   {
-    for (const auto& e : block.linkData)
+    for (auto& e : block.linkData)
     {
-      links_to[e.exitAddress].insert(&block);
+      e.source_block = &block;
+      links_to.Insert(e);
     }
 
     LinkBlock(block);
@@ -321,8 +475,7 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
     // cleared regions.
     const u32 covered_block_start = (physical_address + 0x1f) / 32;
     const u32 covered_block_end = (physical_address + length) / 32;
-    for (u32 i = covered_block_start; i < covered_block_end; ++i)
-      valid_block.Clear(i);
+    valid_block.ClearRange(covered_block_start, covered_block_end);
   }
 
   if (destroy_block)
@@ -336,61 +489,60 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
     // being in the right place between instructions).
     if (!forced)
     {
-      for (u32 i = address; i < address + length; i += 4)
-      {
-        m_jit.js.fifoWriteAddresses.erase(i);
-        m_jit.js.pairedQuantizeAddresses.erase(i);
-        m_jit.js.noSpeculativeConstantsAddresses.erase(i);
-      }
+      EraseAddressesInRange(m_jit.js.fifoWriteAddresses, address, length);
+      EraseAddressesInRange(m_jit.js.pairedQuantizeAddresses, address, length);
+      EraseAddressesInRange(m_jit.js.noSpeculativeConstantsAddresses, address, length);
     }
   }
 }
 
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
-  // Iterate over all macro blocks which overlap the given range.
-  auto start = block_range_map.lower_bound(address & BLOCK_RANGE_MAP_MASK);
-  auto end = block_range_map.lower_bound(address + length);
-  while (start != end)
+  if (length == 0)
+    return;
+
+  // Collect the blocks first, since erasing them changes the lists of their pages.
+  std::vector<JitBlock*> blocks_to_erase;
+  const u32 first_page = address >> BLOCK_PAGE_SHIFT;
+  const u32 last_page = (address + (length - 1)) >> BLOCK_PAGE_SHIFT;
+  for (u32 page = first_page; page <= last_page; ++page)
   {
-    // Iterate over all blocks in the macro block.
-    auto iter = start->second.begin();
-    while (iter != start->second.end())
+    if (!PageHasCode(page))
+    {
+      // Skip the rest of the pages without code in this word.
+      if ((code_pages[page / 64] >> (page % 64)) == 0)
+        page |= 63;
+      continue;
+    }
+
+    for (JitBlock* block : block_page_map.find(page)->second)
     {
-      JitBlock* block = *iter;
       if (block->OverlapsPhysicalRange(address, length))
+        blocks_to_erase.push_back(block);
+    }
+  }
+
+  // Blocks with code on several of the pages were found once for each.
+  std::ranges::sort(blocks_to_erase);
+  const auto duplicates = std::ranges::unique(blocks_to_erase);
+  blocks_to_erase.erase(duplicates.begin(), duplicates.end());
+
+  for (JitBlock* block : blocks_to_erase)
+  {
+    RemoveBlockFromPages(*block);
+
+    // And remove the block.
+    DestroyBlock(*block);
+    auto block_map_iter = block_map.equal_range(block->physicalAddress);
+    while (block_map_iter.first != block_map_iter.second)
+    {
+      if (&block_map_iter.first->second == block)
       {
-        // If the block overlaps, also remove all other occupied slots in the other macro blocks.
-        // This will leak empty macro blocks, but they may be reused or cleared later on.
-        for (u32 addr : block->physical_addresses)
-          if ((addr & BLOCK_RANGE_MAP_MASK) != start->first)
-            block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(block);
-
-        // And remove the block.
-        DestroyBlock(*block);
-        auto block_map_iter = block_map.equal_range(block->physicalAddress);
-        while (block_map_iter.first != block_map_iter.second)
-        {
-          if (&block_map_iter.first->second == block)
-          {
-            block_map.erase(block_map_iter.first);
-            break;
-          }
-          block_map_iter.first++;
-        }
-        iter = start->second.erase(iter);
-      }
-      else
-      {
-        iter++;
+        block_map.erase(block_map_iter.first);
+        break;
       }
+      block_map_iter.first++;
     }
-
-    // If the macro block is empty, drop it.
-    if (start->second.empty())
-      start = block_range_map.erase(start);
-    else
-      start++;
   }
 }
 
@@ -404,13 +556,42 @@ void JitBaseBlockCache::EraseSingleBlock(const JitBlock& block)
 
   JitBlock& mutable_block = block_map_iter->second;
 
-  for (const u32 addr : mutable_block.physical_addresses)
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(&mutable_block);
+  RemoveBlockFromPages(mutable_block);
 
   DestroyBlock(mutable_block);
   block_map.erase(block_map_iter);  // The original JitBlock reference is now dangling.
 }
 
+void JitBaseBlockCache::AddBlockToPages(JitBlock& block)
+{
+  ForEachPage(block.physical_addresses, BLOCK_PAGE_SHIFT, [&](u32 page) {
+    block_page_map[page].push_back(&block);
+    code_pages[page / 64] |= u64{1} << (page % 64);
+  });
+}
+
+void JitBaseBlockCache::RemoveBlockFromPages(const JitBlock& block)
+{
+  ForEachPage(block.physical_addresses, BLOCK_PAGE_SHIFT, [&](u32 page) {
+    const auto it = block_page_map.find(page);
+    if (it == block_page_map.end())
+      return;
+
+    std::vector<JitBlock*>& blocks = it->second;
+    const auto block_iter = std::ranges::find(blocks, &block);
+    if (block_iter == blocks.end())
+      return;
+
+    *block_iter = blocks.back();
+    blocks.pop_back();
+    if (blocks.empty())
+    {
+      block_page_map.erase(it);
+      code_pages[page / 64] &= ~(u64{1} << (page % 64));
+    }
+  });
+}
+
 u32* JitBaseBlockCache::GetBlockBitSet() const
 {
   return valid_block.m_valid_block.get();
@@ -445,14 +626,14 @@ void JitBaseBlockCache::LinkBlockExits(JitBlock& block)
 void JitBaseBlockCache::LinkBlock(JitBlock& block)
 {
   LinkBlockExits(block);
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
-    return;
 
-  for (JitBlock* b2 : it->second)
+  for (JitBlock::LinkData* e = links_to.Find(block.effectiveAddress); e; e = e->next_link_to)
   {
-    if (block.feature_flags == b2->feature_flags)
-      LinkBlockExits(*b2);
+    if (!e->linkStatus && e->source_block->feature_flags == block.feature_flags)
+    {
+      WriteLinkBlock(*e, &block);
+      e->linkStatus = true;
+    }
   }
 }
 
@@ -465,21 +646,12 @@ void JitBaseBlockCache::UnlinkBlock(const JitBlock& block)
   }
 
   // Unlink all exits of other blocks which points to this block
-  const auto it = links_to.find(block.effectiveAddress);
-  if (it == links_to.end())
-    return;
-  for (JitBlock* sourceBlock : it->second)
+  for (JitBlock::LinkData* e = links_to.Find(block.effectiveAddress); e; e = e->next_link_to)
   {
-    if (sourceBlock->feature_flags != block.feature_flags)
-      continue;
-
-    for (auto& e : sourceBlock->linkData)
+    if (e->source_block->feature_flags == block.feature_flags)
     {
-      if (e.exitAddress == block.effectiveAddress)
-      {
-        WriteLinkBlock(e, nullptr);
-        e.linkStatus = false;
-      }
+      WriteLinkBlock(*e, nullptr);
+      e->linkStatus = false;
     }
   }
 }
@@ -504,15 +676,8 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
   UnlinkBlock(block);
 
   // Delete linking addresses
-  for (const auto& e : block.linkData)
-  {
-    auto it = links_to.find(e.exitAddress);
-    if (it == links_to.end())
-      continue;
-    it->second.erase(&block);
-    if (it->second.empty())
-      links_to.erase(it);
-  }
+  for (auto& e : block.linkData)
+    links_to.Remove(e);
 
   // Raise an signal if we are going to call this block again
   WriteDestroyBlock(block);
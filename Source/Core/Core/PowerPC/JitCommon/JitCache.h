@@ -97,6 +97,11 @@ struct JitBlock : public JitBlockData
     u32 exitAddress;
     bool linkStatus;  // is it already linked?
     bool call;
+
+    // Set by the block cache, see JitBlockLinkMap.
+    JitBlock* source_block = nullptr;
+    LinkData* prev_link_to = nullptr;
+    LinkData* next_link_to = nullptr;
   };
   std::vector<LinkData> linkData;
 
@@ -138,10 +143,47 @@ public:
 
   void Set(u32 bit) { m_valid_block[bit / 32] |= 1u << (bit % 32); }
   void Clear(u32 bit) { m_valid_block[bit / 32] &= ~(1u << (bit % 32)); }
+  // Clears the bits [begin, end).
+  void ClearRange(u32 begin, u32 end);
   void ClearAll() { memset(m_valid_block.get(), 0, sizeof(u32) * VALID_BLOCK_ALLOC_ELEMENTS); }
   bool Test(u32 bit) const { return (m_valid_block[bit / 32] & (1u << (bit % 32))) != 0; }
 };
 
+// The exits of all valid blocks by the address they jump to, so that all blocks which link to an
+// address can be found. The exits to an address form a list through their prev_link_to and
+// next_link_to, whose heads are kept in an open addressing table, so adding and removing an exit
+// doesn't allocate unless the table grows.
+class JitBlockLinkMap final
+{
+public:
+  void Clear();
+  void Insert(JitBlock::LinkData& link);
+  // Does nothing if link wasn't inserted.
+  void Remove(JitBlock::LinkData& link);
+  // The first exit to address, the others follow through next_link_to.
+  JitBlock::LinkData* Find(u32 address) const;
+
+private:
+  struct Slot
+  {
+    u32 address = 0;
+    // nullptr if the slot is free.
+    JitBlock::LinkData* head = nullptr;
+  };
+
+  static constexpr u32 INITIAL_SHIFT = 12;
+
+  size_t GetHomeSlot(u32 address) const;
+  // The slot holding address, or the free slot where it goes.
+  size_t FindSlot(u32 address) const;
+  void EraseSlot(size_t index);
+  void Grow();
+
+  std::vector<Slot> m_slots;
+  size_t m_used_slots = 0;
+  u32 m_shift = 0;
+};
+
 class JitBaseBlockCache
 {
 public:
@@ -202,6 +244,10 @@ private:
   void UnlinkBlock(const JitBlock& block);
   void InvalidateICacheInternal(u32 physical_address, u32 address, u32 length, bool forced);
 
+  bool PageHasCode(u32 page) const { return (code_pages[page / 64] >> (page % 64)) & 1; }
+  void AddBlockToPages(JitBlock& block);
+  void RemoveBlockFromPages(const JitBlock& block);
+
   JitBlock* MoveBlockIntoFastCache(u32 em_address, CPUEmuFeatureFlags feature_flags);
 
   // Fast but risky block lookup based on fast_block_map.
@@ -209,17 +255,22 @@ private:
 
   // links_to hold all exit points of all valid blocks in a reverse way.
   // It is used to query all blocks which links to an address.
-  std::unordered_map<u32, std::unordered_set<JitBlock*>> links_to;  // destination_PC -> number
+  JitBlockLinkMap links_to;
 
   // Map indexed by the physical address of the entry point.
   // This is used to query the block based on the current PC in a slow way.
   std::multimap<u32, JitBlock> block_map;  // start_addr -> block
 
-  // Range of overlapping code indexed by a masked physical address.
-  // This is used for invalidation of memory regions. The range is grouped
-  // in macro blocks of each 0x100 bytes.
-  static constexpr u32 BLOCK_RANGE_MAP_MASK = ~(0x100 - 1);
-  std::map<u32, std::unordered_set<JitBlock*>> block_range_map;
+  // The blocks with code on each physical page, indexed by the page number.
+  // This is used for invalidation of memory regions, which is then proportional
+  // to the number of blocks on the pages, not to the length of the region.
+  static constexpr u32 BLOCK_PAGE_SHIFT = 12;
+  static constexpr u32 BLOCK_PAGE_COUNT = 1u << (32 - BLOCK_PAGE_SHIFT);
+  std::unordered_map<u32, std::vector<JitBlock*>> block_page_map;
+
+  // This bitset shows which pages have an entry in block_page_map, so that
+  // regions without any code can be skipped 64 pages at a time.
+  std::array<u64, BLOCK_PAGE_COUNT / 64> code_pages{};
 
   // This bitsets shows which cachelines overlap with any blocks.
   // It is used to provide a fast way to query if no icache invalidation is needed.
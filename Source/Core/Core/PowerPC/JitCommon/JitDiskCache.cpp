@@ -0,0 +1,258 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitDiskCache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <fmt/format.h>
+#include <xxhash.h>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#include "Common/Timer.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/MMU.h"
+
+class JitDiskCache::Reader : public Common::LinearDiskCacheReader<Key, u8>
+{
+public:
+  explicit Reader(JitDiskCache& cache) : m_cache(cache) {}
+
+  void Read(const Key& key, const u8* value, u32 value_size) override
+  {
+    if (value_size == 0 || value_size % sizeof(u32) != 0)
+      return;
+    if (!m_cache.m_known.insert(ToTuple(key)).second)
+      return;
+
+    Block& block = m_cache.m_pending[key.feature_flags].emplace_back();
+    block.key = key;
+    block.instruction_addresses.resize(value_size / sizeof(u32));
+    std::memcpy(block.instruction_addresses.data(), value, value_size);
+  }
+
+private:
+  JitDiskCache& m_cache;
+};
+
+JitDiskCache::~JitDiskCache()
+{
+  Close();
+}
+
+void JitDiskCache::Open()
+{
+  Close();
+
+  const std::string game_id = SConfig::GetInstance().GetGameID();
+  if (!Config::Get(Config::MAIN_JIT_DISK_CACHE) || game_id.empty())
+    return;
+
+  const std::string& directory = File::GetUserPath(D_SHADERCACHE_IDX);
+  if (!File::Exists(directory))
+    File::CreateDir(directory);
+
+  m_open = true;
+  m_load_thread = std::thread(&JitDiskCache::Load, this,
+                              fmt::format("{}JIT-{}.cache", directory, game_id));
+}
+
+void JitDiskCache::Close()
+{
+  if (m_load_thread.joinable())
+    m_load_thread.join();
+
+  if (m_open && IsLoaded())
+    m_file.Sync();
+  m_file.Close();
+
+  m_open = false;
+  m_loaded.store(false);
+  m_loaded_seen = false;
+  m_pending.clear();
+  m_known.clear();
+  m_unwritten.clear();
+  m_waiting.clear();
+  m_invalidated.clear();
+  m_budget_us = PREWARM_BUDGET_US;
+}
+
+void JitDiskCache::Load(std::string filename)
+{
+  Common::SetCurrentThreadName("JIT Disk Cache");
+
+  Reader reader(*this);
+  const u32 count = m_file.OpenAndRead(filename, reader);
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} cached JIT blocks from {}", count, filename);
+
+  m_loaded.store(true, std::memory_order_release);
+}
+
+bool JitDiskCache::IsLoaded()
+{
+  if (m_loaded_seen)
+    return true;
+  if (!m_loaded.load(std::memory_order_acquire))
+    return false;
+
+  m_loaded_seen = true;
+  for (const Block& block : m_unwritten)
+  {
+    if (m_known.insert(ToTuple(block.key)).second)
+      WriteBlock(block);
+  }
+  m_unwritten.clear();
+  return true;
+}
+
+u64 JitDiskCache::Hash(std::span<const u32> addresses_and_instructions)
+{
+  return XXH3_64bits(addresses_and_instructions.data(), addresses_and_instructions.size_bytes());
+}
+
+std::tuple<u32, u32, u64> JitDiskCache::ToTuple(const Key& key)
+{
+  return {key.address, key.feature_flags, key.hash};
+}
+
+void JitDiskCache::WriteBlock(const Block& block)
+{
+  m_file.Append(block.key, reinterpret_cast<const u8*>(block.instruction_addresses.data()),
+                static_cast<u32>(block.instruction_addresses.size() * sizeof(u32)));
+}
+
+void JitDiskCache::Record(u32 address, CPUEmuFeatureFlags feature_flags,
+                          const PPCAnalyst::CodeBuffer& buffer, u32 num_instructions)
+{
+  if (!m_open || num_instructions == 0 || num_instructions > buffer.size())
+    return;
+
+  Block block;
+  std::vector<u32> hashed;
+  hashed.reserve(num_instructions * 2);
+  block.instruction_addresses.reserve(num_instructions);
+  for (u32 i = 0; i < num_instructions; ++i)
+  {
+    block.instruction_addresses.push_back(buffer[i].address);
+    hashed.push_back(buffer[i].address);
+    hashed.push_back(buffer[i].inst.hex);
+  }
+  block.key = {address, static_cast<u32>(feature_flags), Hash(hashed)};
+
+  if (!IsLoaded())
+  {
+    m_unwritten.push_back(std::move(block));
+    return;
+  }
+
+  if (m_known.insert(ToTuple(block.key)).second)
+    WriteBlock(block);
+}
+
+void JitDiskCache::Prewarm(PowerPC::MMU& mmu, JitBaseBlockCache& blocks,
+                           CPUEmuFeatureFlags feature_flags,
+                           const std::function<void(u32)>& compile)
+{
+  if (!m_open || m_budget_us == 0 || !IsLoaded())
+    return;
+
+  RequeueInvalidated();
+
+  // Blocks for another MSR state wait until the CPU is in it.
+  const auto pending = m_pending.find(static_cast<u32>(feature_flags));
+  if (pending == m_pending.end())
+    return;
+  std::deque<Block>& queue = pending->second;
+
+  const u64 start_time = Common::Timer::NowUs();
+  u64 elapsed_us = 0;
+  std::vector<u32> hashed;
+  while (!queue.empty() && elapsed_us < m_budget_us)
+  {
+    Block block = std::move(queue.front());
+    queue.pop_front();
+
+    if (!blocks.GetBlockFromStartAddress(block.key.address, feature_flags))
+    {
+      // Compiling unmapped code would raise an ISI, so every instruction has to be readable.
+      bool ready = true;
+      hashed.clear();
+      for (const u32 address : block.instruction_addresses)
+      {
+        const PowerPC::TryReadInstResult result = mmu.TryReadInstruction(address);
+        if (!result.valid)
+        {
+          ready = false;
+          break;
+        }
+        hashed.push_back(address);
+        hashed.push_back(result.hex);
+      }
+
+      if (ready && Hash(hashed) == block.key.hash)
+        compile(block.key.address);
+      else if (++block.attempts < MAX_ATTEMPTS)
+      {
+        const auto [min, max] = std::ranges::minmax(block.instruction_addresses);
+        block.min_address = min;
+        block.max_address = max;
+        m_waiting.push_back(std::move(block));
+      }
+    }
+
+    elapsed_us = Common::Timer::NowUs() - start_time;
+  }
+
+  m_budget_us -= std::min(elapsed_us, m_budget_us);
+  if (queue.empty())
+    m_pending.erase(pending);
+}
+
+void JitDiskCache::StartFrame()
+{
+  m_budget_us = PREWARM_BUDGET_US;
+}
+
+void JitDiskCache::Invalidate(u32 address, u32 size)
+{
+  if (m_waiting.empty() || size == 0)
+    return;
+
+  // Games invalidate code a cache line at a time, so a range mostly continues the last one.
+  const Range range{address, u64{address} + size};
+  if (!m_invalidated.empty() &&
+      (m_invalidated.size() >= MAX_INVALIDATED_RANGES ||
+       (range.begin <= m_invalidated.back().end && range.end >= m_invalidated.back().begin)))
+  {
+    Range& merged = m_invalidated.back();
+    merged.begin = std::min(merged.begin, range.begin);
+    merged.end = std::max(merged.end, range.end);
+    return;
+  }
+
+  m_invalidated.push_back(range);
+}
+
+void JitDiskCache::RequeueInvalidated()
+{
+  if (m_invalidated.empty())
+    return;
+
+  // Going by the span of the block checks some blocks again too early, which is harmless.
+  const auto is_invalidated = [this](const Block& block) {
+    return std::ranges::any_of(m_invalidated, [&block](const Range& range) {
+      return block.min_address < range.end && range.begin <= block.max_address;
+    });
+  };
+
+  const auto requeued = std::ranges::partition(m_waiting, std::not_fn(is_invalidated)).begin();
+  for (auto it = requeued; it != m_waiting.end(); ++it)
+    m_pending[it->key.feature_flags].push_back(std::move(*it));
+  m_waiting.erase(requeued, m_waiting.end());
+  m_invalidated.clear();
+}
@@ -0,0 +1,123 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <map>
+#include <set>
+#include <span>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/LinearDiskCache.h"
+#include "Core/PowerPC/PPCAnalyst.h"
+#include "Core/PowerPC/PowerPC.h"
+
+class JitBaseBlockCache;
+
+namespace PowerPC
+{
+class MMU;
+}
+
+// Remembers the blocks a game ran, so that on the next boot they are compiled before the game
+// gets to them instead of one at a time as it does.
+//
+// A block is stored as the addresses of its instructions and a hash of them and the instructions
+// at them, next to the shader cache and, like every LinearDiskCache, only for the same build.
+// The file is read on a background thread at boot. Compiling has to happen on the CPU thread, so
+// the JIT calls Prewarm() whenever it compiles a block anyway, and the stored blocks for the
+// current feature flags whose code is in memory by then are compiled as well, for at most
+// PREWARM_BUDGET_US per emulated frame. A block whose code isn't there yet is only checked again
+// once code in its range is invalidated, which is what loading code does.
+class JitDiskCache
+{
+public:
+  static constexpr u64 PREWARM_BUDGET_US = 2000;
+  // A stored block whose code doesn't match is given up on after checking it this many times.
+  static constexpr u32 MAX_ATTEMPTS = 16;
+  // More invalidated ranges than this are merged into one that covers all of them.
+  static constexpr size_t MAX_INVALIDATED_RANGES = 32;
+
+  JitDiskCache() = default;
+  JitDiskCache(const JitDiskCache&) = delete;
+  JitDiskCache& operator=(const JitDiskCache&) = delete;
+  ~JitDiskCache();
+
+  // Starts reading the cache of the running game, if there is a game ID to go by.
+  void Open();
+  void Close();
+
+  // Called with every block the JIT compiled.
+  void Record(u32 address, CPUEmuFeatureFlags feature_flags, const PPCAnalyst::CodeBuffer& buffer,
+              u32 num_instructions);
+
+  // Calls compile(address) for the stored blocks that aren't compiled yet and whose code is
+  // loaded and still the same.
+  void Prewarm(PowerPC::MMU& mmu, JitBaseBlockCache& blocks, CPUEmuFeatureFlags feature_flags,
+               const std::function<void(u32)>& compile);
+  // Called at the end of every emulated field, gives Prewarm() a new budget.
+  void StartFrame();
+  // Called when the code from address to address + size may have changed.
+  void Invalidate(u32 address, u32 size);
+
+private:
+  struct Key
+  {
+    u32 address;
+    u32 feature_flags;
+    u64 hash;
+  };
+
+  struct Block
+  {
+    Key key;
+    std::vector<u32> instruction_addresses;
+    u32 attempts = 0;
+    // The lowest and the highest instruction address, set while the block waits.
+    u32 min_address = 0;
+    u32 max_address = 0;
+  };
+
+  // A range of addresses, end exclusive and in 64 bits so that it can reach the end of memory.
+  struct Range
+  {
+    u64 begin;
+    u64 end;
+  };
+
+  class Reader;
+
+  static u64 Hash(std::span<const u32> addresses_and_instructions);
+  static std::tuple<u32, u32, u64> ToTuple(const Key& key);
+  void Load(std::string filename);
+  // Whether the file has been read. Writes what was recorded until then the first time it is.
+  bool IsLoaded();
+  void WriteBlock(const Block& block);
+  // Moves the waiting blocks with code in an invalidated range back to m_pending.
+  void RequeueInvalidated();
+
+  Common::LinearDiskCache<Key, u8> m_file;
+  std::thread m_load_thread;
+  std::atomic<bool> m_loaded{false};
+  bool m_open = false;
+  bool m_loaded_seen = false;
+
+  // Only touched by the loading thread until m_loaded is set, then only by the CPU thread.
+  // Blocks to check, by their feature flags.
+  std::map<u32, std::deque<Block>> m_pending;
+  std::set<std::tuple<u32, u32, u64>> m_known;
+  // Recorded while the file was still being read.
+  std::vector<Block> m_unwritten;
+
+  // Blocks whose code wasn't in memory, and the ranges invalidated since they were last checked.
+  std::vector<Block> m_waiting;
+  std::vector<Range> m_invalidated;
+  u64 m_budget_us = PREWARM_BUDGET_US;
+};
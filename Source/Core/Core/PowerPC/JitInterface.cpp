@@ -13,6 +13,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
 
 #include "Core/Core.h"
 #include "Core/PowerPC/CPUCoreBase.h"
@@ -182,6 +183,33 @@ void JitInterface::JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE*
   }
 }
 
+std::size_t JitInterface::JitBlockProfileDump(const Core::CPUThreadGuard& guard,
+                                              std::FILE* file) const
+{
+  if (!m_jit || !m_jit->IsProfilingEnabled())
+    return 0;
+
+  // One "function;block cycles" line per block that has run, in the collapsed stack format that
+  // flamegraph.pl, inferno and speedscope read. Blocks outside of any symbol share an "[unknown]"
+  // function frame, so they still add up in the graph.
+  std::size_t written = 0;
+  m_jit->GetBlockCache()->RunOnBlocks(guard, [&](const JitBlock& block) {
+    const JitBlock::ProfileData* const data = block.profile_data.get();
+    if (data->run_count == 0)
+      return;
+
+    const Common::Symbol* const symbol =
+        m_jit->m_ppc_symbol_db.GetSymbolFromAddr(block.effectiveAddress);
+    // Semicolons separate the frames. Blocks compiled for several feature flags show up once per
+    // flag set and are added together by the tools.
+    const std::string function = symbol ? ReplaceAll(symbol->name, ";", ":") : "[unknown]";
+
+    fmt::println(file, "{};{:08x} {}", function, block.effectiveAddress, data->cycles_spent);
+    ++written;
+  });
+  return written;
+}
+
 void JitInterface::WipeBlockProfilingData(const Core::CPUThreadGuard& guard)
 {
   if (m_jit)
@@ -265,13 +293,19 @@ std::size_t JitInterface::DisassembleFarCode(const JitBlock& block, std::ostream
 void JitInterface::InvalidateICache(u32 address, u32 size, bool forced)
 {
   if (m_jit)
+  {
     m_jit->GetBlockCache()->InvalidateICache(address, size, forced);
+    m_jit->InvalidateDiskCacheRange(address, size);
+  }
 }
 
 void JitInterface::InvalidateICacheLine(u32 address)
 {
   if (m_jit)
+  {
     m_jit->GetBlockCache()->InvalidateICacheLine(address);
+    m_jit->InvalidateDiskCacheRange(address & ~0x1f, 32);
+  }
 }
 
 void JitInterface::InvalidateICacheLines(u32 address, u32 count)
@@ -47,6 +47,10 @@ public:
 
   void UpdateMembase();
   void JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE* file) const;
+  // Writes the cycles spent in each block, grouped by guest function, as collapsed stacks for
+  // flame graph tools. Returns how many blocks were written, which is 0 unless block profiling is
+  // enabled and a block has run.
+  std::size_t JitBlockProfileDump(const Core::CPUThreadGuard& guard, std::FILE* file) const;
   void WipeBlockProfilingData(const Core::CPUThreadGuard& guard);
   void RunOnBlocks(const Core::CPUThreadGuard& guard, std::function<void(const JitBlock&)> f) const;
   std::size_t GetBlockCount() const;
@@ -28,6 +28,7 @@
 #include <bit>
 #include <cstddef>
 #include <cstring>
+#include <optional>
 #include <string>
 
 #include "Common/Align.h"
@@ -144,6 +145,64 @@ static void EFB_Write(u32 data, u32 addr)
   }
 }
 
+u8* MMU::LookupHostTLB(HostTLB& host_tlb, u32 address)
+{
+  const u32 tag = address >> HW_PAGE_INDEX_SHIFT;
+  const HostTLBEntry& entry = host_tlb[tag & (HOST_TLB_SIZE - 1)];
+  if (entry.tag != tag || entry.sr != m_ppc_state.sr[address >> 28] ||
+      m_ppc_state.m_enable_dcache)
+  {
+    return nullptr;
+  }
+
+  // Keep the TLB replacement order the same as if the TLB had been looked up.
+  if (entry.tlb_way != HostTLBEntry::NO_TLB_WAY)
+    m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][tag & HW_PAGE_INDEX_MASK].recent = entry.tlb_way;
+
+  return entry.host_page + (address & HW_PAGE_MASK);
+}
+
+void MMU::FillHostTLB(HostTLB& host_tlb, u32 address, u8* host_page,
+                      TranslateAddressResultEnum translation)
+{
+  const u32 tag = address >> HW_PAGE_INDEX_SHIFT;
+  const u32 sr = m_ppc_state.sr[address >> 28];
+
+  u32 tlb_way = HostTLBEntry::NO_TLB_WAY;
+  if (translation == TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED)
+  {
+    const TLBEntry& tlbe = m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][tag & HW_PAGE_INDEX_MASK];
+    const u32 vsid = UReg_SR{sr}.VSID;
+    for (u32 way = 0; way < PowerPC::TLB_WAYS; ++way)
+    {
+      if (tlbe.tag[way] == tag && tlbe.vsid[way] == vsid)
+        tlb_way = way;
+    }
+
+    // Only pages that are in the TLB can be looked up without it.
+    if (tlb_way == HostTLBEntry::NO_TLB_WAY)
+      return;
+  }
+
+  host_tlb[tag & (HOST_TLB_SIZE - 1)] = {tag, sr, host_page, tlb_way};
+}
+
+void MMU::InvalidateHostTLB()
+{
+  m_host_read_tlb.fill({});
+  m_host_write_tlb.fill({});
+}
+
+void MMU::InvalidateHostTLBPage(u32 tag)
+{
+  for (HostTLB* host_tlb : {&m_host_read_tlb, &m_host_write_tlb})
+  {
+    HostTLBEntry& entry = (*host_tlb)[tag & (HOST_TLB_SIZE - 1)];
+    if (entry.tag == tag)
+      entry = {};
+  }
+}
+
 template <XCheckTLBFlag flag, std::unsigned_integral T, bool never_translate>
 T MMU::ReadFromHardware(u32 em_address)
 {
@@ -169,6 +228,18 @@ T MMU::ReadFromHardware(u32 em_address)
     return var;
   }
 
+  if (flag == XCheckTLBFlag::Read && !never_translate && m_ppc_state.msr.DR)
+  {
+    if (const u8* host_address = LookupHostTLB(m_host_read_tlb, em_address))
+    {
+      T value;
+      std::memcpy(&value, host_address, sizeof(T));
+      return bswap(value);
+    }
+  }
+
+  const u32 effective_address = em_address;
+  std::optional<TranslateAddressResultEnum> translation;
   bool wi = false;
 
   if (!never_translate &&
@@ -182,6 +253,7 @@ T MMU::ReadFromHardware(u32 em_address)
       return 0;
     }
     em_address = translated_addr.address;
+    translation = translated_addr.result;
     wi = translated_addr.wi;
   }
 
@@ -214,6 +286,12 @@ T MMU::ReadFromHardware(u32 em_address)
     T value;
     em_address &= m_memory.GetRamMask();
 
+    if (flag == XCheckTLBFlag::Read && translation && !m_ppc_state.m_enable_dcache)
+    {
+      FillHostTLB(m_host_read_tlb, effective_address,
+                  &m_memory.GetRAM()[em_address & ~HW_PAGE_MASK], *translation);
+    }
+
     if (!m_ppc_state.m_enable_dcache || wi)
     {
       std::memcpy(&value, &m_memory.GetRAM()[em_address], sizeof(T));
@@ -233,6 +311,12 @@ T MMU::ReadFromHardware(u32 em_address)
     T value;
     em_address &= 0x0FFFFFFF;
 
+    if (flag == XCheckTLBFlag::Read && translation && !m_ppc_state.m_enable_dcache)
+    {
+      FillHostTLB(m_host_read_tlb, effective_address,
+                  &m_memory.GetEXRAM()[em_address & ~HW_PAGE_MASK], *translation);
+    }
+
     if (!m_ppc_state.m_enable_dcache || wi)
     {
       std::memcpy(&value, &m_memory.GetEXRAM()[em_address], sizeof(T));
@@ -288,6 +372,18 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
     return;
   }
 
+  if (flag == XCheckTLBFlag::Write && !never_translate && m_ppc_state.msr.DR)
+  {
+    if (u8* host_address = LookupHostTLB(m_host_write_tlb, em_address))
+    {
+      const u32 swapped_data = Common::swap32(std::rotr(data, size * 8));
+      std::memcpy(host_address, &swapped_data, size);
+      return;
+    }
+  }
+
+  const u32 effective_address = em_address;
+  std::optional<TranslateAddressResultEnum> translation;
   bool wi = false;
 
   if (!never_translate && m_ppc_state.msr.DR)
@@ -300,6 +396,7 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
       return;
     }
     em_address = translated_addr.address;
+    translation = translated_addr.result;
     wi = translated_addr.wi;
   }
 
@@ -411,6 +508,12 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
     // mirrors of memory).
     em_address &= m_memory.GetRamMask();
 
+    if (flag == XCheckTLBFlag::Write && translation && !wi && !m_ppc_state.m_enable_dcache)
+    {
+      FillHostTLB(m_host_write_tlb, effective_address,
+                  &m_memory.GetRAM()[em_address & ~HW_PAGE_MASK], *translation);
+    }
+
     if (m_ppc_state.m_enable_dcache && !wi)
       m_ppc_state.dCache.Write(m_memory, em_address, &swapped_data, size, HID0(m_ppc_state).DLOCK);
 
@@ -425,6 +528,12 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
   {
     em_address &= 0x0FFFFFFF;
 
+    if (flag == XCheckTLBFlag::Write && translation && !wi && !m_ppc_state.m_enable_dcache)
+    {
+      FillHostTLB(m_host_write_tlb, effective_address,
+                  &m_memory.GetEXRAM()[em_address & ~HW_PAGE_MASK], *translation);
+    }
+
     if (m_ppc_state.m_enable_dcache && !wi)
     {
       m_ppc_state.dCache.Write(m_memory, em_address + 0x10000000, &swapped_data, size,
@@ -647,6 +756,15 @@ template <>
 void MMU::Write<u64>(const u64 var, const u32 address)
 {
   Memcheck(address, var, true, 8);
+
+  // Double and paired single stores to the gather pipe are common in GX code. Writing them as a
+  // single value translates the address once and checks for a full burst once.
+  if (IsOptimizableGatherPipeWrite(address))
+  {
+    m_system.GetGPFifo().Write64(var);
+    return;
+  }
+
   WriteToHardware<XCheckTLBFlag::Write>(address, static_cast<u32>(var >> 32), 4);
   WriteToHardware<XCheckTLBFlag::Write>(address + sizeof(u32), static_cast<u32>(var), 4);
 }
@@ -1283,21 +1401,24 @@ static TLBLookupResult LookupTLBPageAddress(PowerPC::PowerPCState& ppc_state,
   return TLBLookupResult::NotFound;
 }
 
-static void UpdateTLBEntry(PowerPC::PowerPCState& ppc_state, const XCheckTLBFlag flag, UPTE_Hi pte2,
-                           const u32 address, const u32 vsid)
+// Returns the tag of the page whose entry was replaced, or TLBEntry::INVALID_TAG.
+static u32 UpdateTLBEntry(PowerPC::PowerPCState& ppc_state, const XCheckTLBFlag flag, UPTE_Hi pte2,
+                          const u32 address, const u32 vsid)
 {
   if (IsNoExceptionFlag(flag))
-    return;
+    return TLBEntry::INVALID_TAG;
 
   const u32 tag = address >> HW_PAGE_INDEX_SHIFT;
   const size_t tlb_index = IsOpcodeFlag(flag) ? PowerPC::INST_TLB_INDEX : PowerPC::DATA_TLB_INDEX;
   TLBEntry& tlbe = ppc_state.tlb[tlb_index][tag & HW_PAGE_INDEX_MASK];
   const u32 index = tlbe.recent == 0 && tlbe.tag[0] != TLBEntry::INVALID_TAG;
+  const u32 replaced_tag = tlbe.tag[index];
   tlbe.recent = index;
   tlbe.paddr[index] = pte2.RPN << HW_PAGE_INDEX_SHIFT;
   tlbe.pte[index] = pte2.Hex;
   tlbe.tag[index] = tag;
   tlbe.vsid[index] = vsid;
+  return replaced_tag;
 }
 
 void MMU::InvalidateTLBEntry(u32 address)
@@ -1306,6 +1427,15 @@ void MMU::InvalidateTLBEntry(u32 address)
 
   m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][entry_index].Invalidate();
   m_ppc_state.tlb[PowerPC::INST_TLB_INDEX][entry_index].Invalidate();
+
+  for (u32 i = entry_index; i < HOST_TLB_SIZE; i += HW_PAGE_INDEX_MASK + 1)
+  {
+    for (HostTLB* host_tlb : {&m_host_read_tlb, &m_host_write_tlb})
+    {
+      if ((*host_tlb)[i].tlb_way != HostTLBEntry::NO_TLB_WAY)
+        (*host_tlb)[i] = {};
+    }
+  }
 }
 
 // Page Address Translation
@@ -1396,7 +1526,11 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
 
         // We already updated the TLB entry if this was caused by a C bit.
         if (res != TLBLookupResult::UpdateC)
-          UpdateTLBEntry(m_ppc_state, flag, pte2, address.Hex, VSID);
+        {
+          const u32 replaced_tag = UpdateTLBEntry(m_ppc_state, flag, pte2, address.Hex, VSID);
+          if (!IsOpcodeFlag(flag) && replaced_tag != TLBEntry::INVALID_TAG)
+            InvalidateHostTLBPage(replaced_tag);
+        }
 
         *wi = (pte2.WIMG & 0b1100) != 0;
 
@@ -1520,6 +1654,7 @@ void MMU::UpdateFakeMMUBat(BatTable& bat_table, u32 start_addr)
 
 void MMU::DBATUpdated()
 {
+  InvalidateHostTLB();
   m_dbat_table = {};
   UpdateBATs(m_dbat_table, SPR_DBAT0U);
   bool extended_bats = m_system.IsWii() && HID4(m_ppc_state).SBE;
@@ -156,7 +156,7 @@ public:
       requires(!std::unsigned_integral<T>)
   {
     using U = Common::MakeUnsignedSameSize<T>;
-    std::optional<ReadResult<U>> result = HostTryRead<U>(guard, address);
+    std::optional<ReadResult<U>> result = HostTryRead<U>(guard, address, space);
     return std::bit_cast<std::optional<ReadResult<T>>>(result);
   }
   static std::optional<ReadResult<u32>>
@@ -312,6 +312,33 @@ private:
   bool IsEffectiveRAMAddress(u32 address);
   bool IsPhysicalRAMAddress(u32 address) const;
 
+  // A direct-mapped cache of host pointers to the RAM pages that translated data accesses went
+  // to, so loads and stores to them don't go through the BATs and the TLB again. Writes have their
+  // own entries, since a page can only be written to without a TLB update once its C bit is set.
+  // Entries are dropped together with the data TLB entry they came from, and on BAT updates.
+  struct HostTLBEntry
+  {
+    static constexpr u32 INVALID_TAG = 0xffffffff;
+    static constexpr u32 NO_TLB_WAY = 0xffffffff;
+
+    // The effective page number.
+    u32 tag = INVALID_TAG;
+    // The segment register the page was translated with.
+    u32 sr = 0;
+    u8* host_page = nullptr;
+    // The way of the data TLB entry that translated the page, or NO_TLB_WAY for a BAT.
+    u32 tlb_way = NO_TLB_WAY;
+  };
+
+  static constexpr u32 HOST_TLB_SIZE = 1024;
+  using HostTLB = std::array<HostTLBEntry, HOST_TLB_SIZE>;
+
+  u8* LookupHostTLB(HostTLB& host_tlb, u32 address);
+  void FillHostTLB(HostTLB& host_tlb, u32 address, u8* host_page,
+                   TranslateAddressResultEnum translation);
+  void InvalidateHostTLB();
+  void InvalidateHostTLBPage(u32 tag);
+
   Core::System& m_system;
   Memory::MemoryManager& m_memory;
   PowerPC::PowerPCManager& m_power_pc;
@@ -319,6 +346,9 @@ private:
 
   BatTable m_ibat_table;
   BatTable m_dbat_table;
+
+  HostTLB m_host_read_tlb;
+  HostTLB m_host_write_tlb;
 };
 
 void ClearDCacheLineFromJit(MMU& mmu, u32 address);
@@ -4,7 +4,9 @@
 #include "Core/PowerPC/PPCAnalyst.h"
 
 #include <algorithm>
+#include <array>
 #include <map>
+#include <optional>
 #include <queue>
 #include <string>
 #include <vector>
@@ -43,6 +45,7 @@ namespace PPCAnalyst
 {
 // 0 does not perform block merging
 constexpr u32 BRANCH_FOLLOWING_THRESHOLD = 2;
+constexpr u32 SUPERBLOCK_BRANCH_FOLLOWING_THRESHOLD = 8;
 
 constexpr u32 INVALID_BRANCH_TARGET = 0xFFFFFFFF;
 
@@ -737,6 +740,107 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code,
   }
 }
 
+// Memory mapped registers that games poll while they wait for the hardware, and that can be read
+// without side effects. Reading other ones can, e.g. the low half of the mailbox from the DSP or
+// the SI input buffers acknowledge the data, so loops reading them aren't busy wait loops.
+struct PolledRegister
+{
+  u32 address;
+  u32 size;
+};
+
+constexpr std::array<PolledRegister, 20> POLLED_MMIO_REGISTERS{{
+    {0x0C000000, 2},   // CP status
+    {0x0C00202C, 4},   // VI beam position
+    {0x0C002030, 16},  // VI display interrupts
+    {0x0C003000, 4},   // PI interrupt cause
+    {0x0C005000, 4},   // DSP mailbox to the DSP
+    {0x0C005004, 2},   // DSP mailbox from the DSP, high half
+    {0x0C00500A, 2},   // DSP control
+    {0x0C005028, 4},   // ARAM DMA count
+    {0x0C00503A, 2},   // AI DMA blocks left
+    {0x0C006000, 4},   // DI status
+    {0x0C00601C, 4},   // DI control
+    {0x0C006434, 8},   // SI communication control and status
+    {0x0C006800, 4},   // EXI channel 0 status
+    {0x0C00680C, 4},   // EXI channel 0 control
+    {0x0C006814, 4},   // EXI channel 1 status
+    {0x0C006820, 4},   // EXI channel 1 control
+    {0x0C006828, 4},   // EXI channel 2 status
+    {0x0C006834, 4},   // EXI channel 2 control
+    {0x0C006C00, 12},  // AI control, volume and sample counter
+    {0x0D000004, 8},   // IPC control and message from the ARM (Wii)
+}};
+
+static bool IsRepeatableLoad(u32 address, u32 size)
+{
+  // The MMIO registers are only ever accessed uncached, through 0xCC000000 and 0xCD000000.
+  if ((address & 0xF0000000) != 0xC0000000)
+    return true;
+
+  // 0x0D800000 mirrors 0x0D000000, and the legacy registers are at 0x0D006000 on Wii as well.
+  u32 physical_address = address & 0x0F7FFFFF;
+  if ((physical_address & 0xFFFFF000) == 0x0D006000)
+    physical_address &= 0x0C00FFFF;
+  if ((physical_address & 0xFFFF0000) != 0x0C000000 &&
+      (physical_address & 0xFFFF0000) != 0x0D000000)
+  {
+    return true;
+  }
+
+  return std::ranges::any_of(POLLED_MMIO_REGISTERS, [&](const PolledRegister& reg) {
+    return physical_address >= reg.address && physical_address + size <= reg.address + reg.size;
+  });
+}
+
+// The size of a load with an immediate offset, or 0 for any other instruction.
+static u32 GetImmediateLoadSize(UGeckoInstruction inst)
+{
+  switch (inst.OPCD)
+  {
+  case 32:  // lwz
+  case 33:  // lwzu
+    return 4;
+  case 34:  // lbz
+  case 35:  // lbzu
+    return 1;
+  case 40:  // lhz
+  case 41:  // lhzu
+  case 42:  // lha
+  case 43:  // lhau
+    return 2;
+  default:
+    return 0;
+  }
+}
+
+// Whether an instruction that isn't a load or an integer instruction can be repeated in a busy
+// wait loop, because it has no side effects and reads nothing that changes on its own.
+static bool IsPureSystemInstruction(UGeckoInstruction inst)
+{
+  if (inst.OPCD == 19 && inst.SUBOP10 == 150)  // isync
+    return true;
+  if (inst.OPCD != 31)
+    return false;
+
+  switch (inst.SUBOP10)
+  {
+  case 19:   // mfcr
+  case 83:   // mfmsr
+  case 598:  // sync
+  case 854:  // eieio
+    return true;
+  case 339:  // mfspr
+  {
+    const u32 index = GetSPRIndex(inst);
+    return index != SPR_DEC && index != SPR_TL && index != SPR_TU &&
+           (index < SPR_UPMC1 || index > SPR_PMC4);
+  }
+  default:
+    return false;
+  }
+}
+
 bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const
 {
   // Very basic algorithm to detect busy wait loops:
@@ -744,15 +848,17 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
   //   * It does not write to memory.
   //   * It only reads from registers it wrote to earlier in the loop, or it
   //     does not write to these registers.
+  //   * It doesn't read from MMIO registers that change when they are read.
   //
-  // Would benefit a lot from basic inlining support - a lot of the most
-  // used busy loops are DSP register interactions, which are bl/cmp/bne
-  // (with the bl target a pure function that follows the above rules). We
-  // don't detect these at the moment.
+  // Most of the busy loops are polling MMIO registers, often through bl/cmp/bne with the bl
+  // target a pure function that loads the register base with lis. Branch following inlines those
+  // functions, and the register base is tracked to find out which registers are read.
   std::bitset<32> write_disallowed_regs;
   std::bitset<32> written_regs;
+  std::array<std::optional<u32>, 32> constants{};
   for (size_t i = 0; i <= instructions; ++i)
   {
+    const UGeckoInstruction inst = code[i].inst;
     if (code[i].opinfo->type == OpType::Branch)
     {
       if (code[i].branchUsesCtr)
@@ -760,7 +866,8 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
       if (code[i].branchTo == block->m_address && i == instructions)
         return true;
     }
-    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load)
+    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load &&
+             !IsPureSystemInstruction(inst))
     {
       // In the future, some subsets of other instruction types might get
       // supported. Right now, only try loops that have this very
@@ -769,6 +876,14 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
     }
     else
     {
+      const u32 load_size = GetImmediateLoadSize(inst);
+      if (load_size != 0)
+      {
+        const std::optional<u32> base = inst.RA == 0 ? 0 : constants[inst.RA];
+        if (base && !IsRepeatableLoad(*base + inst.SIMM_16, load_size))
+          return false;
+      }
+
       for (int reg : code[i].regsIn)
       {
         if (reg == -1)
@@ -777,6 +892,20 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
           continue;
         write_disallowed_regs[reg] = true;
       }
+
+      std::optional<u32> result;
+      if (inst.OPCD == 14 || inst.OPCD == 15)  // addi, addis
+      {
+        const u32 imm = inst.OPCD == 15 ? static_cast<u32>(inst.SIMM_16) << 16 : inst.SIMM_16;
+        const std::optional<u32> base = inst.RA == 0 ? 0 : constants[inst.RA];
+        if (base)
+          result = *base + imm;
+      }
+      else if (inst.OPCD == 24 && constants[inst.RS])  // ori
+      {
+        result = *constants[inst.RS] | inst.UIMM;
+      }
+
       for (int reg : code[i].regsOut)
       {
         if (reg == -1)
@@ -784,6 +913,7 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
         if (write_disallowed_regs[reg])
           return false;
         written_regs[reg] = true;
+        constants[reg] = result;
       }
     }
   }
@@ -800,8 +930,21 @@ static bool CanCauseGatherPipeInterruptCheck(const CodeOp& op)
          op.opinfo->type == OpType::StorePS;
 }
 
+void PPCAnalyzer::ReportIdleLoop(u32 address, size_t instructions)
+{
+  if (!m_idle_loops.insert(address).second)
+    return;
+
+  // Logged so the loops found in a game can be checked against its code.
+  const Common::Symbol* symbol =
+      Core::System::GetInstance().GetPPCSymbolDB().GetSymbolFromAddr(address);
+  NOTICE_LOG_FMT(POWERPC, "{}: Skipping idle loop at {:08x} ({} instructions) in {}",
+                 SConfig::GetInstance().GetGameID(), address, instructions,
+                 symbol ? symbol->name : "unknown function");
+}
+
 u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
-                         std::size_t block_size) const
+                         std::size_t block_size)
 {
   // Clear block stats
   *block->m_stats = {};
@@ -829,6 +972,8 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
   u32 num_inst = 0;
 
   const bool enable_follow = m_enable_branch_following;
+  const u32 follow_threshold =
+      m_enable_superblock ? SUPERBLOCK_BRANCH_FOLLOWING_THRESHOLD : BRANCH_FOLLOWING_THRESHOLD;
 
   auto& system = Core::System::GetInstance();
   auto& mmu = system.GetMMU();
@@ -891,7 +1036,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
       {
         code[i].branchTo = code[caller].address + 4;
         if ((inst.BO & BO_DONT_DECREMENT_FLAG) && (inst.BO & BO_DONT_CHECK_CONDITION) &&
-            numFollows < BRANCH_FOLLOWING_THRESHOLD)
+            numFollows < follow_threshold)
         {
           // bclrx with unconditional branch = return
           // Follow it if we can propagate the LR value of the last CALL instruction.
@@ -944,8 +1089,10 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
 
     code[i].branchIsIdleLoop =
         code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
+    if (code[i].branchIsIdleLoop)
+      ReportIdleLoop(block->m_address, i + 1);
 
-    if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
+    if (follow && numFollows < follow_threshold)
     {
       // Follow the unconditional branch.
       numFollows++;
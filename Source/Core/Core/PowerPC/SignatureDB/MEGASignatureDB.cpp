@@ -3,12 +3,16 @@
 
 #include "Core/PowerPC/SignatureDB/MEGASignatureDB.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 #include <fstream>
+#include <future>
 #include <limits>
+#include <span>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 
 #include "Common/FileUtil.h"
@@ -101,18 +105,12 @@ bool GetRefs(MEGASignature* sig, std::istringstream* iss)
   return true;
 }
 
-bool Compare(const Core::CPUThreadGuard& guard, u32 address, u32 size, const MEGASignature& sig)
+bool Compare(std::span<const u32> code, const MEGASignature& sig)
 {
-  if (size != sig.code.size() * sizeof(u32))
-    return false;
-
   for (size_t i = 0; i < sig.code.size(); ++i)
   {
-    if (sig.code[i] != 0 && PowerPC::MMU::HostRead<u32>(
-                                guard, static_cast<u32>(address + i * sizeof(u32))) != sig.code[i])
-    {
+    if (sig.code[i] != 0 && code[i] != sig.code[i])
       return false;
-    }
   }
   return true;
 }
@@ -124,6 +122,7 @@ MEGASignatureDB::~MEGASignatureDB() = default;
 void MEGASignatureDB::Clear()
 {
   m_signatures.clear();
+  m_signatures_by_size.clear();
 }
 
 bool MEGASignatureDB::Load(const std::string& file_path)
@@ -142,6 +141,8 @@ bool MEGASignatureDB::Load(const std::string& file_path)
 
     if (GetCode(&sig, &iss) && GetName(&sig, &iss) && GetRefs(&sig, &iss))
     {
+      const u32 size = static_cast<u32>(sig.code.size() * sizeof(u32));
+      m_signatures_by_size[size].push_back(m_signatures.size());
       m_signatures.push_back(std::move(sig));
     }
     else
@@ -160,18 +161,68 @@ bool MEGASignatureDB::Save(const std::string& file_path) const
 
 void MEGASignatureDB::Apply(const Core::CPUThreadGuard& guard, PPCSymbolDB* symbol_db) const
 {
+  struct Candidate
+  {
+    const Common::Symbol* symbol;
+    const std::vector<size_t>* signatures;
+    std::vector<u32> code;
+    const MEGASignature* match = nullptr;
+  };
+
+  // Only the signatures of the same size can match a symbol. The code of the symbols that have
+  // any is read here, so that comparing it can be spread over all cores.
+  std::vector<Candidate> candidates;
   symbol_db->ForEachSymbol([&](const Common::Symbol& symbol) {
-    for (const auto& sig : m_signatures)
+    const auto it = m_signatures_by_size.find(symbol.size);
+    if (it == m_signatures_by_size.end())
+      return;
+
+    std::vector<u32> code(symbol.size / sizeof(u32));
+    for (size_t i = 0; i < code.size(); ++i)
     {
-      if (Compare(guard, symbol.address, symbol.size, sig))
-      {
-        symbol_db->RenameSymbol(symbol, sig.name);
-        INFO_LOG_FMT(SYMBOLS, "Found {} at {:08x} (size: {:08x})!", sig.name, symbol.address,
-                     symbol.size);
-        break;
-      }
+      code[i] =
+          PowerPC::MMU::HostRead<u32>(guard, static_cast<u32>(symbol.address + i * sizeof(u32)));
     }
+    candidates.push_back({&symbol, &it->second, std::move(code)});
   });
+
+  const size_t threads =
+      std::min(candidates.size(), std::max<size_t>(1, std::thread::hardware_concurrency()));
+  std::vector<std::future<void>> futures(threads);
+  for (size_t i = 0; i < threads; ++i)
+  {
+    futures[i] = std::async(
+        std::launch::async,
+        [this, &candidates](size_t start, size_t end) {
+          for (size_t j = start; j < end; ++j)
+          {
+            Candidate& candidate = candidates[j];
+            for (const size_t index : *candidate.signatures)
+            {
+              if (Compare(candidate.code, m_signatures[index]))
+              {
+                candidate.match = &m_signatures[index];
+                break;
+              }
+            }
+          }
+        },
+        i * candidates.size() / threads, (i + 1) * candidates.size() / threads);
+  }
+
+  for (std::future<void>& future : futures)
+    future.get();
+
+  for (const Candidate& candidate : candidates)
+  {
+    if (!candidate.match)
+      continue;
+
+    const Common::Symbol& symbol = *candidate.symbol;
+    symbol_db->RenameSymbol(symbol, candidate.match->name);
+    INFO_LOG_FMT(SYMBOLS, "Found {} at {:08x} (size: {:08x})!", candidate.match->name,
+                 symbol.address, symbol.size);
+  }
   symbol_db->Index();
 }
 
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -59,4 +60,6 @@ public:
 
 private:
   std::vector<MEGASignature> m_signatures;
+  // The indices in m_signatures of the signatures of each code size in bytes, in ascending order.
+  std::map<u32, std::vector<size_t>> m_signatures_by_size;
 };
@@ -5,12 +5,16 @@
 
 #include <algorithm>
 #include <condition_variable>
+#include <cstring>
 #include <filesystem>
+#include <future>
 #include <locale>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -19,6 +23,7 @@
 
 #include <lz4.h>
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -27,12 +32,14 @@
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
+#include "Common/PageDelta.h"
 #include "Common/Thread.h"
 #include "Common/TimeUtil.h"
 #include "Common/Version.h"
 #include "Common/WorkQueueThread.h"
 
 #include "Core/AchievementManager.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -46,6 +53,8 @@
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
+#include "DiscIO/MultithreadedCompressor.h"
+
 #include "VideoCommon/FrameDumpFFMpeg.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoBackendBase.h"
@@ -76,6 +85,8 @@ struct CompressAndDumpState_args
 {
   Common::UniqueBuffer<u8> buffer;
   std::string filename;
+  CompressionType compression_type = CompressionType::Uncompressed;
+  int compression_level = 0;
   std::shared_ptr<Common::Event> state_write_done_event;
 };
 
@@ -130,6 +141,60 @@ enum
 
 static bool s_use_compression = true;
 
+constexpr u32 DELTA_STATE_MAGIC = 0x41544C44;  // "DLTA"
+
+struct DeltaStateHeader
+{
+  u32 magic;
+  u32 base_id;
+  u64 state_size;
+  u8 is_base;
+  u8 reserved[7];
+};
+static_assert(std::is_trivially_copyable_v<DeltaStateHeader>);
+
+// s_delta_base is the full state that deltas are relative to. s_delta_work is a scratch image of
+// the last state that was saved or loaded; while s_delta_work_valid is set, it only differs from
+// s_delta_base in s_delta_work_pages, so rebuilding a state from a delta only touches those pages.
+static std::mutex s_delta_mutex;
+static Common::UniqueBuffer<u8> s_delta_base;
+static size_t s_delta_base_size = 0;
+static u32 s_delta_base_id = 0;
+static Common::UniqueBuffer<u8> s_delta_work;
+static std::vector<u32> s_delta_work_pages;
+static bool s_delta_work_valid = false;
+
+struct RingKeyframe
+{
+  Common::UniqueBuffer<u8> data;
+  size_t size = 0;
+  u64 generation = 0;
+};
+
+struct RingEntry
+{
+  Common::UniqueBuffer<u8> delta;
+  size_t delta_size = 0;
+  size_t state_size = 0;
+  u64 frame = 0;
+  u64 keyframe_generation = 0;
+  bool valid = false;
+};
+
+// Keyframes live in their own pool, which is sized so that a keyframe is only recycled once every
+// ring entry that refers to it has been overwritten. s_ring_work plays the same role as
+// s_delta_work above.
+static std::mutex s_ring_mutex;
+static std::vector<RingEntry> s_ring;
+static std::vector<RingKeyframe> s_ring_keyframes;
+static size_t s_ring_next = 0;
+static size_t s_ring_keyframe_interval = 0;
+static size_t s_ring_saves_since_keyframe = 0;
+static u64 s_ring_generation = 0;
+static Common::UniqueBuffer<u8> s_ring_work;
+static std::vector<u32> s_ring_work_pages;
+static u64 s_ring_work_generation = 0;
+
 void EnableCompression(bool compression)
 {
   s_use_compression = compression;
@@ -137,6 +202,9 @@ void EnableCompression(bool compression)
 
 static void DoState(Core::System& system, PointerWrap& p)
 {
+  // Let the big memory arrays be copied in parallel. HW::DoState flushes them.
+  p.EnableDeferredCopies();
+
   bool is_wii = system.IsWii() || system.IsMIOS();
   const bool is_wii_currently = is_wii;
   p.Do(is_wii);
@@ -203,46 +271,406 @@ static void DoState(Core::System& system, PointerWrap& p)
 
 void LoadFromBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
 {
-  if (NetPlay::IsNetPlayRunning())
-  {
-    OSD::AddMessage("Loading savestates is disabled in Netplay to prevent desyncs");
-    return;
-  }
+  LoadFromSpan(system, std::span<const u8>(buffer.data(), buffer.size()));
+}
+
+// Grows buffer if needed and returns the number of bytes of it that the state occupies.
+static size_t SaveToBufferInternal(Core::System& system, Common::UniqueBuffer<u8>& buffer)
+{
+  size_t size = 0;
+  Core::RunOnCPUThread(
+      system,
+      [&] {
+        u8* ptr = nullptr;
+        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+        DoState(system, p_measure);
+
+        const size_t new_buffer_size = ptr - (u8*)(nullptr);
+        if (new_buffer_size > buffer.size())
+          buffer.reset(new_buffer_size);
+
+        ptr = buffer.data();
+        PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
+        DoState(system, p);
+        if (p.IsWriteMode())
+          size = ptr - buffer.data();
+      },
+      true);
+  return size;
+}
 
+void SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
+{
+  SaveToBufferInternal(system, buffer);
+}
+
+static bool LoadFromSpanInternal(Core::System& system, std::span<const u8> buffer)
+{
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
   {
     OSD::AddMessage("Loading savestates is disabled in RetroAchievements hardcore mode");
-    return;
+    return false;
   }
 
+  bool loaded = false;
   Core::RunOnCPUThread(
       system,
       [&] {
-        u8* ptr = buffer.data();
+        // PointerWrap never writes through the pointer in read mode.
+        u8* ptr = const_cast<u8*>(buffer.data());
         PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
         DoState(system, p);
+        loaded = p.IsReadMode();
       },
       true);
+  return loaded;
 }
 
-void SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer)
+bool LoadFromSpan(Core::System& system, std::span<const u8> buffer)
+{
+  if (NetPlay::IsNetPlayRunning())
+  {
+    OSD::AddMessage("Loading savestates is disabled in Netplay to prevent desyncs");
+    return false;
+  }
+
+  return LoadFromSpanInternal(system, buffer);
+}
+
+bool LoadNetPlayJoinState(Core::System& system, std::span<const u8> buffer)
+{
+  return LoadFromSpanInternal(system, buffer);
+}
+
+size_t SaveToSpan(Core::System& system, std::span<u8> buffer)
+{
+  size_t written = 0;
+  Core::RunOnCPUThread(
+      system,
+      [&] {
+        u8* ptr = buffer.data();
+        PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
+        DoState(system, p);
+
+        // PointerWrap drops to measure mode if the state ran past the end of the span.
+        if (p.IsWriteMode())
+          written = ptr - buffer.data();
+      },
+      true);
+  return written;
+}
+
+size_t MeasureStateSize(Core::System& system)
 {
+  size_t size = 0;
   Core::RunOnCPUThread(
       system,
       [&] {
         u8* ptr = nullptr;
         PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
         DoState(system, p_measure);
-
-        const size_t new_buffer_size = ptr - (u8*)(nullptr);
-        if (new_buffer_size > buffer.size())
-          buffer.reset(new_buffer_size);
-
-        ptr = buffer.data();
-        PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
-        DoState(system, p);
+        size = ptr - (u8*)(nullptr);
       },
       true);
+  return size;
+}
+
+size_t SaveDeltaToSpan(Core::System& system, std::span<u8> buffer)
+{
+  std::lock_guard lk(s_delta_mutex);
+
+  const size_t size = SaveToBufferInternal(system, s_delta_work);
+  if (size == 0)
+    return 0;
+
+  const std::span<const u8> current(s_delta_work.data(), size);
+  s_delta_work_pages.clear();
+
+  bool store_base = s_delta_base_size == 0;
+  if (!store_base)
+  {
+    Common::PageDelta::FindChangedPages(std::span(s_delta_base.data(), s_delta_base_size), current,
+                                        &s_delta_work_pages);
+    store_base = Common::PageDelta::GetEncodedSize(size, s_delta_work_pages) > size / 2;
+
+    // Pages past the end of a shorter state aren't tracked, so the next load has to start over.
+    s_delta_work_valid = size == s_delta_base_size;
+  }
+
+  DeltaStateHeader header{};
+  header.magic = DELTA_STATE_MAGIC;
+  header.state_size = size;
+
+  if (store_base)
+  {
+    if (sizeof(header) + size > buffer.size())
+      return 0;
+
+    if (s_delta_base.size() < size)
+      s_delta_base.reset(size);
+    std::memcpy(s_delta_base.data(), current.data(), size);
+    s_delta_base_size = size;
+    s_delta_work_pages.clear();
+    s_delta_work_valid = true;
+
+    header.base_id = ++s_delta_base_id;
+    header.is_base = 1;
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    std::memcpy(buffer.data() + sizeof(header), current.data(), size);
+    return sizeof(header) + size;
+  }
+
+  if (sizeof(header) > buffer.size())
+    return 0;
+
+  const size_t delta_size = Common::PageDelta::Encode(current, s_delta_work_pages,
+                                                      buffer.subspan(sizeof(header)));
+  if (delta_size == 0 && !s_delta_work_pages.empty())
+    return 0;
+
+  header.base_id = s_delta_base_id;
+  std::memcpy(buffer.data(), &header, sizeof(header));
+  return sizeof(header) + delta_size;
+}
+
+bool LoadDeltaFromSpan(Core::System& system, std::span<const u8> buffer)
+{
+  DeltaStateHeader header;
+  if (buffer.size() < sizeof(header))
+    return LoadFromSpan(system, buffer);
+
+  std::memcpy(&header, buffer.data(), sizeof(header));
+  if (header.magic != DELTA_STATE_MAGIC)
+    return LoadFromSpan(system, buffer);
+
+  std::lock_guard lk(s_delta_mutex);
+
+  const std::span<const u8> payload = buffer.subspan(sizeof(header));
+  const size_t size = static_cast<size_t>(header.state_size);
+
+  if (header.is_base)
+  {
+    if (payload.size() < size)
+      return false;
+
+    if (s_delta_base.size() < size)
+      s_delta_base.reset(size);
+    std::memcpy(s_delta_base.data(), payload.data(), size);
+    s_delta_base_size = size;
+    s_delta_base_id = header.base_id;
+    s_delta_work_valid = false;
+
+    return LoadFromSpan(system, std::span(s_delta_base.data(), size));
+  }
+
+  if (s_delta_base_size == 0 || header.base_id != s_delta_base_id)
+  {
+    Core::DisplayMessage("Delta savestate does not belong to the current base state", 2000);
+    return false;
+  }
+
+  if (s_delta_work.size() < size)
+  {
+    s_delta_work.reset(size);
+    s_delta_work_valid = false;
+  }
+
+  const std::span<u8> work(s_delta_work.data(), size);
+  const std::span<const u8> base(s_delta_base.data(), s_delta_base_size);
+  if (s_delta_work_valid)
+    Common::PageDelta::CopyPages(base, work, s_delta_work_pages);
+  else
+    std::memcpy(work.data(), base.data(), std::min(size, s_delta_base_size));
+
+  s_delta_work_pages.clear();
+  s_delta_work_valid = false;
+  if (!Common::PageDelta::Apply(payload, work, &s_delta_work_pages))
+  {
+    PanicAlertFmt("Delta savestate is corrupted");
+    return false;
+  }
+  s_delta_work_valid = size == s_delta_base_size;
+
+  return LoadFromSpan(system, work);
+}
+
+void ResetDeltaBase()
+{
+  std::lock_guard lk(s_delta_mutex);
+  s_delta_base.reset();
+  s_delta_base_size = 0;
+  s_delta_work.reset();
+  s_delta_work_pages.clear();
+  s_delta_work_valid = false;
+}
+
+// Makes sure buffer can hold size bytes, leaving some room for the state to grow.
+static void ReserveRingBuffer(Common::UniqueBuffer<u8>& buffer, size_t size)
+{
+  if (buffer.size() < size)
+    buffer.reset(size + size / 16);
+}
+
+void InitStateRing(size_t capacity, size_t keyframe_interval)
+{
+  std::lock_guard lk(s_ring_mutex);
+  s_ring_keyframe_interval = std::max<size_t>(keyframe_interval, 1);
+  s_ring.clear();
+  s_ring.resize(capacity);
+  s_ring_keyframes.clear();
+  s_ring_keyframes.resize(capacity / s_ring_keyframe_interval + 2);
+  s_ring_next = 0;
+  s_ring_saves_since_keyframe = 0;
+  s_ring_generation = 0;
+  s_ring_work_generation = 0;
+  s_ring_work_pages.clear();
+}
+
+void ShutdownStateRing()
+{
+  std::lock_guard lk(s_ring_mutex);
+  s_ring.clear();
+  s_ring_keyframes.clear();
+  s_ring_work.reset();
+  s_ring_work_pages.clear();
+  s_ring_work_generation = 0;
+}
+
+static RingKeyframe& GetRingKeyframe(u64 generation)
+{
+  return s_ring_keyframes[generation % s_ring_keyframes.size()];
+}
+
+bool SaveToRing(Core::System& system, u64 frame)
+{
+  std::lock_guard lk(s_ring_mutex);
+  if (s_ring.empty())
+    return false;
+
+  // s_ring_work is about to be overwritten with the new state.
+  s_ring_work_generation = 0;
+  const size_t size = SaveToBufferInternal(system, s_ring_work);
+  if (size == 0)
+    return false;
+
+  for (RingEntry& entry : s_ring)
+  {
+    if (entry.valid && entry.frame == frame)
+      entry.valid = false;
+  }
+
+  RingEntry& entry = s_ring[s_ring_next];
+  entry.valid = false;
+
+  const std::span<const u8> current(s_ring_work.data(), size);
+  const RingKeyframe* keyframe = &GetRingKeyframe(s_ring_generation);
+  if (s_ring_generation == 0 || keyframe->generation != s_ring_generation ||
+      keyframe->size != size || s_ring_saves_since_keyframe >= s_ring_keyframe_interval)
+  {
+    const u64 generation = ++s_ring_generation;
+    RingKeyframe& new_keyframe = GetRingKeyframe(generation);
+
+    // Keyframes are normally recycled long after their last user is gone, but state size changes
+    // force extra keyframes, so make sure nothing refers to the one being replaced.
+    for (RingEntry& other : s_ring)
+    {
+      if (other.valid && other.keyframe_generation == new_keyframe.generation)
+        other.valid = false;
+    }
+
+    ReserveRingBuffer(new_keyframe.data, size);
+    std::memcpy(new_keyframe.data.data(), current.data(), size);
+    new_keyframe.size = size;
+    new_keyframe.generation = generation;
+
+    s_ring_saves_since_keyframe = 0;
+    s_ring_work_generation = generation;
+    s_ring_work_pages.clear();
+    entry.delta_size = 0;
+  }
+  else
+  {
+    s_ring_work_pages.clear();
+    Common::PageDelta::FindChangedPages(std::span(keyframe->data.data(), keyframe->size), current,
+                                        &s_ring_work_pages);
+    s_ring_work_generation = s_ring_generation;
+
+    ReserveRingBuffer(entry.delta, Common::PageDelta::GetEncodedSize(size, s_ring_work_pages));
+    entry.delta_size = Common::PageDelta::Encode(current, s_ring_work_pages,
+                                                 std::span(entry.delta.data(), entry.delta.size()));
+  }
+
+  ++s_ring_saves_since_keyframe;
+  entry.state_size = size;
+  entry.frame = frame;
+  entry.keyframe_generation = s_ring_generation;
+  entry.valid = true;
+  s_ring_next = (s_ring_next + 1) % s_ring.size();
+  return true;
+}
+
+bool LoadFromRing(Core::System& system, u64 frame)
+{
+  std::lock_guard lk(s_ring_mutex);
+
+  const auto it = std::ranges::find_if(
+      s_ring, [frame](const RingEntry& entry) { return entry.valid && entry.frame == frame; });
+  if (it == s_ring.end())
+    return false;
+
+  const RingEntry& entry = *it;
+  const RingKeyframe& keyframe = GetRingKeyframe(entry.keyframe_generation);
+  if (keyframe.generation != entry.keyframe_generation || keyframe.size != entry.state_size)
+    return false;
+
+  std::span<const u8> state(keyframe.data.data(), keyframe.size);
+  if (entry.delta_size != 0)
+  {
+    // s_ring_work already matches the keyframe outside of s_ring_work_pages if it was last used
+    // with the same keyframe, in which case only those pages need to be restored.
+    if (s_ring_work.size() >= entry.state_size &&
+        s_ring_work_generation == entry.keyframe_generation)
+    {
+      Common::PageDelta::CopyPages(state, std::span(s_ring_work.data(), entry.state_size),
+                                   s_ring_work_pages);
+    }
+    else
+    {
+      ReserveRingBuffer(s_ring_work, entry.state_size);
+      std::memcpy(s_ring_work.data(), state.data(), entry.state_size);
+    }
+
+    s_ring_work_pages.clear();
+    s_ring_work_generation = entry.keyframe_generation;
+    if (!Common::PageDelta::Apply(std::span(entry.delta.data(), entry.delta_size),
+                                  std::span(s_ring_work.data(), entry.state_size),
+                                  &s_ring_work_pages))
+    {
+      s_ring_work_generation = 0;
+      return false;
+    }
+
+    state = std::span(s_ring_work.data(), entry.state_size);
+  }
+
+  // Rollback NetPlay only restores states of its own timeline, which doesn't desync.
+  if (!LoadFromSpanInternal(system, state))
+    return false;
+
+  for (RingEntry& other : s_ring)
+  {
+    if (other.valid && other.frame > frame)
+      other.valid = false;
+  }
+  s_ring_next = (static_cast<size_t>(it - s_ring.begin()) + 1) % s_ring.size();
+  return true;
+}
+
+bool IsFrameInRing(u64 frame)
+{
+  std::lock_guard lk(s_ring_mutex);
+  return std::ranges::any_of(
+      s_ring, [frame](const RingEntry& entry) { return entry.valid && entry.frame == frame; });
 }
 
 namespace
@@ -309,50 +737,135 @@ static std::vector<SlotWithTimestamp> GetUsedSlotsWithTimestamp()
   return result;
 }
 
-static void CompressBufferToFile(const u8* raw_buffer, u64 size, File::IOFile& f)
+// Savestates are compressed in blocks of this size which can be decoded independently, so that both
+// compression and decompression can be spread over all host threads.
+constexpr u32 COMPRESSION_BLOCK_SIZE = 4 * 1024 * 1024;
+
+namespace
 {
-  u64 total_bytes_compressed = 0;
+struct ZstdCompressContextDeleter
+{
+  void operator()(ZSTD_CCtx* context) const { ZSTD_freeCCtx(context); }
+};
 
-  while (true)
-  {
-    const u64 bytes_left_to_compress = size - total_bytes_compressed;
+struct BlockCompressorState
+{
+  std::unique_ptr<ZSTD_CCtx, ZstdCompressContextDeleter> zstd_context;
+};
 
-    const int bytes_to_compress =
-        static_cast<int>(std::min(static_cast<u64>(LZ4_MAX_INPUT_SIZE), bytes_left_to_compress));
-    Common::UniqueBuffer<char> compressed_buffer(LZ4_compressBound(bytes_to_compress));
-    const int compressed_len = LZ4_compress_default(
-        reinterpret_cast<const char*>(raw_buffer) + total_bytes_compressed, compressed_buffer.get(),
-        bytes_to_compress, int(compressed_buffer.size()));
+struct UncompressedBlock
+{
+  const u8* data = nullptr;
+  size_t size = 0;
+};
 
-    if (compressed_len == 0)
+struct CompressedBlock
+{
+  Common::UniqueBuffer<u8> data;
+  size_t size = 0;
+};
+}  // namespace
+
+// Writes the block size, the block count, the compressed size of each block and then the
+// compressed blocks themselves.
+static bool CompressBlocksToFile(const u8* raw_buffer, u64 size, CompressionType type, int level,
+                                 File::IOFile& f)
+{
+  const u32 block_count =
+      static_cast<u32>((size + COMPRESSION_BLOCK_SIZE - 1) / COMPRESSION_BLOCK_SIZE);
+  std::vector<CompressedBlock> compressed_blocks;
+  compressed_blocks.reserve(block_count);
+
+  using Compressor =
+      DiscIO::MultithreadedCompressor<BlockCompressorState, UncompressedBlock, CompressedBlock>;
+  using DiscIO::ConversionResultCode;
+
+  const auto set_up_compress_thread_state = [type](BlockCompressorState* state) {
+    if (type != CompressionType::ZstdBlocks)
+      return ConversionResultCode::Success;
+
+    state->zstd_context.reset(ZSTD_createCCtx());
+    return state->zstd_context ? ConversionResultCode::Success :
+                                 ConversionResultCode::InternalError;
+  };
+
+  const auto compress =
+      [type, level](BlockCompressorState* state,
+                    UncompressedBlock block) -> DiscIO::ConversionResult<CompressedBlock> {
+    CompressedBlock compressed;
+    if (type == CompressionType::ZstdBlocks)
     {
-      PanicAlertFmtT("Internal LZ4 Error - compression failed");
-      break;
+      compressed.data.reset(ZSTD_compressBound(block.size));
+      const size_t result =
+          ZSTD_compressCCtx(state->zstd_context.get(), compressed.data.data(),
+                            compressed.data.size(), block.data, block.size, level);
+      if (ZSTD_isError(result))
+        return DiscIO::ConversionResultCode::InternalError;
+      compressed.size = result;
     }
+    else
+    {
+      const int block_size = static_cast<int>(block.size);
+      compressed.data.reset(LZ4_compressBound(block_size));
+      const int result = LZ4_compress_default(reinterpret_cast<const char*>(block.data),
+                                              reinterpret_cast<char*>(compressed.data.data()),
+                                              block_size, static_cast<int>(compressed.data.size()));
+      if (result <= 0)
+        return DiscIO::ConversionResultCode::InternalError;
+      compressed.size = static_cast<size_t>(result);
+    }
+    return compressed;
+  };
 
-    // The size of the data to write is 'compressed_len'
-    f.WriteArray(&compressed_len, 1);
-    f.WriteBytes(compressed_buffer.get(), compressed_len);
+  const auto output = [&compressed_blocks](CompressedBlock block) {
+    compressed_blocks.push_back(std::move(block));
+    return ConversionResultCode::Success;
+  };
 
-    total_bytes_compressed += bytes_to_compress;
-    if (total_bytes_compressed == size)
-      break;
+  Compressor compressor(set_up_compress_thread_state, compress, output);
+  for (u64 position = 0; position < size; position += COMPRESSION_BLOCK_SIZE)
+  {
+    compressor.CompressAndWrite(UncompressedBlock{
+        raw_buffer + position, static_cast<size_t>(std::min<u64>(COMPRESSION_BLOCK_SIZE,
+                                                                   size - position))});
   }
+  compressor.Shutdown();
+
+  if (compressor.GetStatus() != ConversionResultCode::Success ||
+      compressed_blocks.size() != block_count)
+  {
+    PanicAlertFmtT("Internal compression error - savestate compression failed");
+    return false;
+  }
+
+  std::vector<u32> compressed_sizes;
+  compressed_sizes.reserve(block_count);
+  for (const CompressedBlock& block : compressed_blocks)
+    compressed_sizes.push_back(static_cast<u32>(block.size));
+
+  f.WriteArray(&COMPRESSION_BLOCK_SIZE, 1);
+  f.WriteArray(&block_count, 1);
+  f.WriteArray(compressed_sizes.data(), compressed_sizes.size());
+  for (const CompressedBlock& block : compressed_blocks)
+    f.WriteBytes(block.data.data(), block.size);
+
+  return f.IsGood();
 }
 
-static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size)
+static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size,
+                                 CompressionType compression_type)
 {
   StateExtendedBaseHeader& base_header = extended_header.base_header;
   base_header.header_version = EXTENDED_HEADER_VERSION;
-  base_header.compression_type =
-      s_use_compression ? CompressionType::LZ4 : CompressionType::Uncompressed;
+  base_header.compression_type = compression_type;
   base_header.payload_offset = COMPRESSED_DATA_OFFSET;
   base_header.uncompressed_size = uncompressed_size;
 
   // If more fields are added to StateExtendedHeader, set them here.
 }
 
-static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
+static void WriteHeadersToFile(size_t uncompressed_size, CompressionType compression_type,
+                               File::IOFile& f)
 {
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.legacy_header.game_id,
@@ -364,7 +877,7 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
   header.version_header.version_string_length = static_cast<u32>(header.version_string.length());
 
   StateExtendedHeader extended_header{};
-  CreateExtendedHeader(extended_header, uncompressed_size);
+  CreateExtendedHeader(extended_header, uncompressed_size, compression_type);
 
   f.WriteArray(&header.legacy_header, 1);
   f.WriteArray(&header.version_header, 1);
@@ -398,12 +911,17 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     return;
   }
 
-  WriteHeadersToFile(buffer_size, f);
+  WriteHeadersToFile(buffer_size, save_args.compression_type, f);
 
-  if (s_use_compression)
-    CompressBufferToFile(buffer_data, buffer_size, f);
-  else
+  if (save_args.compression_type == CompressionType::Uncompressed)
+  {
     f.WriteBytes(buffer_data, buffer_size);
+  }
+  else
+  {
+    CompressBlocksToFile(buffer_data, buffer_size, save_args.compression_type,
+                         save_args.compression_level, f);
+  }
 
   if (!f.IsGood())
     Core::DisplayMessage("Failed to write state file", 2000);
@@ -493,6 +1011,14 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
           CompressAndDumpState_args save_args;
           save_args.buffer = std::move(current_buffer);
           save_args.filename = filename;
+          if (s_use_compression)
+          {
+            const int zstd_level =
+                std::min(Config::Get(Config::MAIN_SAVESTATE_ZSTD_LEVEL), ZSTD_maxCLevel());
+            save_args.compression_type =
+                zstd_level > 0 ? CompressionType::ZstdBlocks : CompressionType::LZ4Blocks;
+            save_args.compression_level = zstd_level;
+          }
           if (wait)
           {
             sync_event = std::make_shared<Common::Event>();
@@ -706,6 +1232,125 @@ static bool DecompressLZ4(Common::UniqueBuffer<u8>& raw_buffer, u64 size, File::
   }
 }
 
+static bool DecompressBlocks(Common::UniqueBuffer<u8>& raw_buffer, u64 size, CompressionType type,
+                             File::IOFile& f)
+{
+  u32 block_size;
+  u32 block_count;
+  if (!f.ReadArray(&block_size, 1) || !f.ReadArray(&block_count, 1))
+  {
+    PanicAlertFmt("Could not read state block table");
+    return false;
+  }
+
+  if (block_size == 0 || block_count != (size + block_size - 1) / block_size)
+  {
+    PanicAlertFmt("State block table corrupted ({0} blocks of {1} bytes for {2} bytes)",
+                  block_count, block_size, size);
+    return false;
+  }
+
+  const u64 remaining_size = f.GetSize() - std::min(f.Tell(), f.GetSize());
+  if (static_cast<u64>(block_count) * sizeof(u32) > remaining_size)
+  {
+    PanicAlertFmt("State block table corrupted ({0} blocks past the end of the file)",
+                  block_count);
+    return false;
+  }
+
+  std::vector<u32> compressed_sizes(block_count);
+  if (!f.ReadArray(compressed_sizes.data(), block_count))
+  {
+    PanicAlertFmt("Could not read state block table");
+    return false;
+  }
+
+  if (type == CompressionType::LZ4Blocks && block_size > LZ4_MAX_INPUT_SIZE)
+  {
+    PanicAlertFmt("State block table corrupted (block size {0} too large for LZ4)", block_size);
+    return false;
+  }
+
+  // Every block must fit in what its compressor could have produced for it, and the blocks
+  // together must fit in the rest of the file, so that nothing below reads past its source.
+  std::vector<u64> compressed_offsets(block_count + 1);
+  for (u32 i = 0; i < block_count; ++i)
+  {
+    const u64 expected_size = std::min<u64>(block_size, size - static_cast<u64>(i) * block_size);
+    const u64 max_compressed_size =
+        type == CompressionType::ZstdBlocks ?
+            ZSTD_compressBound(expected_size) :
+            static_cast<u64>(LZ4_compressBound(static_cast<int>(expected_size)));
+    if (compressed_sizes[i] == 0 || compressed_sizes[i] > max_compressed_size)
+    {
+      PanicAlertFmt("State block table corrupted (block {0} is {1} bytes, at most {2} expected)",
+                    i, compressed_sizes[i], max_compressed_size);
+      return false;
+    }
+    compressed_offsets[i + 1] = compressed_offsets[i] + compressed_sizes[i];
+  }
+
+  if (compressed_offsets.back() > remaining_size - static_cast<u64>(block_count) * sizeof(u32))
+  {
+    PanicAlertFmt("State block table corrupted ({0} bytes of blocks past the end of the file)",
+                  compressed_offsets.back());
+    return false;
+  }
+
+  Common::UniqueBuffer<u8> compressed_data(compressed_offsets.back());
+  if (!f.ReadBytes(compressed_data.data(), compressed_data.size()))
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  raw_buffer.reset(size);
+
+  const auto decompress_block = [&](u32 i) {
+    const u64 offset = static_cast<u64>(i) * block_size;
+    const size_t expected_size = static_cast<size_t>(std::min<u64>(block_size, size - offset));
+    const u8* const src = compressed_data.data() + compressed_offsets[i];
+    u8* const dst = raw_buffer.data() + offset;
+
+    if (type == CompressionType::ZstdBlocks)
+    {
+      const size_t result = ZSTD_decompress(dst, expected_size, src, compressed_sizes[i]);
+      return !ZSTD_isError(result) && result == expected_size;
+    }
+
+    const int result = LZ4_decompress_safe(reinterpret_cast<const char*>(src),
+                                           reinterpret_cast<char*>(dst),
+                                           static_cast<int>(compressed_sizes[i]),
+                                           static_cast<int>(expected_size));
+    return result >= 0 && static_cast<size_t>(result) == expected_size;
+  };
+
+  const u32 threads =
+      std::min(block_count, std::max<u32>(1, std::thread::hardware_concurrency()));
+  std::vector<std::future<bool>> futures(threads);
+  for (u32 i = 0; i < threads; ++i)
+  {
+    futures[i] = std::async(
+        std::launch::async,
+        [&decompress_block](u32 start, u32 end) {
+          bool success = true;
+          for (u32 j = start; j < end; ++j)
+            success &= decompress_block(j);
+          return success;
+        },
+        i * block_count / threads, (i + 1) * block_count / threads);
+  }
+
+  bool success = true;
+  for (std::future<bool>& future : futures)
+    success &= future.get();
+
+  if (!success)
+    PanicAlertFmtT("Internal decompression error - savestate decompression failed");
+
+  return success;
+}
+
 static bool ValidateHeaders(const StateHeader& header)
 {
   bool success = true;
@@ -803,6 +1448,16 @@ static void LoadFileStateData(const std::string& filename, Common::UniqueBuffer<
 
     break;
   }
+  case CompressionType::LZ4Blocks:
+  case CompressionType::ZstdBlocks:
+  {
+    const auto type = static_cast<CompressionType>(extended_header.base_header.compression_type);
+    Core::DisplayMessage("Decompressing State...", OSD::Duration::SHORT);
+    if (!DecompressBlocks(buffer, extended_header.base_header.uncompressed_size, type, f))
+      return;
+
+    break;
+  }
   case CompressionType::Uncompressed:
   {
     u64 header_len = sizeof(StateHeaderLegacy) + sizeof(StateHeaderVersion) +
@@ -925,23 +1580,28 @@ void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback)
 
 void Init(Core::System& system)
 {
-  s_save_thread.Reset("Savestate Worker", [&system](CompressAndDumpState_args args) {
-    CompressAndDumpState(system, args);
+  s_save_thread.Reset(
+      "Savestate Worker",
+      [&system](CompressAndDumpState_args args) {
+        CompressAndDumpState(system, args);
 
-    {
-      std::lock_guard lk(s_state_writes_in_queue_mutex);
-      if (--s_state_writes_in_queue == 0)
-        s_state_write_queue_is_empty.notify_all();
-    }
+        {
+          std::lock_guard lk(s_state_writes_in_queue_mutex);
+          if (--s_state_writes_in_queue == 0)
+            s_state_write_queue_is_empty.notify_all();
+        }
 
-    if (args.state_write_done_event)
-      args.state_write_done_event->Set();
-  });
+        if (args.state_write_done_event)
+          args.state_write_done_event->Set();
+      },
+      Common::ThreadPriority::Background);
 }
 
 void Shutdown()
 {
   s_save_thread.Shutdown();
+  ResetDeltaBase();
+  ShutdownStateRing();
 
   std::lock_guard lk(s_undo_load_buffer_mutex);
   s_undo_load_buffer.reset();
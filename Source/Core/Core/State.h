@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <span>
 #include <string>
 #include <type_traits>
 
@@ -55,6 +56,9 @@ enum CompressionType : u16
 {
   Uncompressed = 0,
   LZ4 = 1,
+  // Independently decodable blocks, see CompressBlocksToFile() in State.cpp.
+  LZ4Blocks = 2,
+  ZstdBlocks = 3,
   // Add new compression types after this, as the compression type
   // is numerically stored in the state file.
 };
@@ -109,6 +113,42 @@ void LoadAs(Core::System& system, const std::string& filename);
 void SaveToBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer);
 void LoadFromBuffer(Core::System& system, Common::UniqueBuffer<u8>& buffer);
 
+// Like SaveToBuffer/LoadFromBuffer, but PointerWrap works directly on the caller's memory, so no
+// intermediate buffer is allocated or copied. SaveToSpan runs a single DoState pass and returns
+// the number of bytes written, or 0 if the state did not fit into the span.
+size_t SaveToSpan(Core::System& system, std::span<u8> buffer);
+bool LoadFromSpan(Core::System& system, std::span<const u8> buffer);
+// Like LoadFromSpan, but also while NetPlay is running. Only for the state that a player joining a
+// running NetPlay game starts from, which the other players are at as well.
+bool LoadNetPlayJoinState(Core::System& system, std::span<const u8> buffer);
+
+// Runs only the measure pass of DoState and returns the number of bytes a buffer savestate would
+// currently take. This is considerably cheaper than SaveToBuffer, but the result is only valid
+// until the emulated state changes, so callers that need a stable bound must add headroom.
+size_t MeasureStateSize(Core::System& system);
+
+// Delta savestates for runahead and rollback, where states are saved and loaded by the same
+// instance many times per second. The first delta save, and any save whose delta would be larger
+// than half of the full state, stores a full state and keeps a copy of it in memory as the base.
+// All other saves only store the 4 KiB pages of the serialized state that differ from that base,
+// so a delta can only be loaded while its base is still current. LoadDeltaFromSpan also accepts
+// regular states. Both functions return 0/false on failure, like SaveToSpan/LoadFromSpan.
+size_t SaveDeltaToSpan(Core::System& system, std::span<u8> buffer);
+bool LoadDeltaFromSpan(Core::System& system, std::span<const u8> buffer);
+void ResetDeltaBase();
+
+// In-memory savestate ring for rollback. Keeps the states of the last `capacity` calls to
+// SaveToRing, tagged with the frame number passed in. Every keyframe_interval-th state is kept in
+// full and the others as page deltas against the most recent full state. All buffers are reused
+// across saves, so once the ring has warmed up SaveToRing doesn't allocate.
+void InitStateRing(size_t capacity, size_t keyframe_interval = 8);
+void ShutdownStateRing();
+bool SaveToRing(Core::System& system, u64 frame);
+// Loads the state that was saved for the given frame. States saved for later frames belong to the
+// timeline that is being rolled back and are dropped from the ring.
+bool LoadFromRing(Core::System& system, u64 frame);
+bool IsFrameInRing(u64 frame);
+
 void LoadLastSaved(Core::System& system, int i = 1);
 void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
@@ -5,6 +5,7 @@
 
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -96,6 +97,54 @@ static void CopySave(FS::FileSystem* source, FS::FileSystem* dest, const u64 tit
   WiiSave::Copy(source_save.get(), dest_save.get());
 }
 
+static void GetMetadataRecursively(FS::FileSystem* fs, const std::string& path,
+                                   std::vector<std::pair<std::string, FS::Metadata>>* metadata)
+{
+  const auto result = fs->GetMetadata(IOS::PID_KERNEL, IOS::PID_KERNEL, path);
+  if (!result)
+    return;
+  metadata->emplace_back(path, *result);
+
+  if (result->is_file)
+    return;
+  if (const auto children = fs->ReadDirectory(IOS::PID_KERNEL, IOS::PID_KERNEL, path))
+  {
+    for (const std::string& child : *children)
+      GetMetadataRecursively(fs, path + '/' + child, metadata);
+  }
+}
+
+// Moves a save from a temporary FS whose files are at source_root on the host, which only takes
+// renaming its directory instead of reading and writing every file. Returns false if the save
+// wasn't moved, in which case it should be copied instead.
+static bool MoveSave(FS::FileSystem* source, const std::string& source_root, FS::FileSystem* dest,
+                     const u64 title_id)
+{
+  const std::string data_path = Common::GetTitleDataPath(title_id);
+  const std::string source_host_path = source_root + data_path.substr(1);
+  if (!File::IsDirectory(source_host_path))
+    return false;
+
+  // The metadata lives in the FST of the source FS, so it has to be read before the move.
+  std::vector<std::pair<std::string, FS::Metadata>> metadata;
+  GetMetadataRecursively(source, data_path, &metadata);
+
+  dest->CreateFullPath(IOS::PID_KERNEL, IOS::PID_KERNEL, data_path, 0,
+                       {FS::Mode::ReadWrite, FS::Mode::ReadWrite, FS::Mode::ReadWrite});
+  if (!File::Rename(source_host_path,
+                    Common::GetTitleDataPath(title_id, Common::FromWhichRoot::Session)))
+  {
+    return false;
+  }
+
+  for (const auto& [path, file_metadata] : metadata)
+  {
+    dest->SetMetadata(IOS::PID_KERNEL, path, file_metadata.uid, file_metadata.gid,
+                      file_metadata.attribute, file_metadata.modes);
+  }
+  return true;
+}
+
 static bool CopyNandFile(FS::FileSystem* source_fs, const std::string& source_file,
                          FS::FileSystem* dest_fs, const std::string& dest_file)
 {
@@ -163,8 +212,14 @@ static void InitializeDeterministicWiiSaves(FS::FileSystem* session_fs,
     }
     else
     {
+      const std::string& sync_fs_root = boot_session_data.GetWiiSyncFSRoot();
       for (const u64 title : sync_titles)
       {
+        if (sync_fs && !sync_fs_root.empty() && MoveSave(sync_fs, sync_fs_root, session_fs, title))
+        {
+          INFO_LOG_FMT(CORE, "Wii Save Init: Moved {0:016x}.", title);
+          continue;
+        }
         INFO_LOG_FMT(CORE, "Wii Save Init: Copying {0:016x}.", title);
         CopySave(source_fs, session_fs, title);
       }
@@ -180,8 +235,15 @@ static void InitializeDeterministicWiiSaves(FS::FileSystem* session_fs,
     const auto& netplay_redirect_folder = boot_session_data.GetWiiSyncRedirectFolder();
     if (!netplay_redirect_folder.empty())
     {
-      File::CreateDirs(s_temp_redirect_root);
-      File::Copy(netplay_redirect_folder, s_temp_redirect_root);
+      // Like the saves, a redirected save that only exists for this session is moved.
+      const bool moved = !boot_session_data.GetWiiSyncFSRoot().empty() &&
+                         File::IsDirectory(netplay_redirect_folder) &&
+                         File::Rename(netplay_redirect_folder, s_temp_redirect_root);
+      if (!moved)
+      {
+        File::CreateDirs(s_temp_redirect_root);
+        File::Copy(netplay_redirect_folder, s_temp_redirect_root);
+      }
     }
   }
 }
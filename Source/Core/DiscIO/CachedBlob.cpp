@@ -3,10 +3,17 @@
 
 #include "DiscIO/CachedBlob.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstring>
+#include <list>
+#include <map>
 #include <thread>
+#include <utility>
+#include <vector>
 
+#include "Common/Align.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
@@ -226,6 +233,163 @@ private:
   const std::unique_ptr<BlobReader> m_reader;
 };
 
+class BlockCachedBlobReader final : public BlobReader
+{
+public:
+  static constexpr u64 CACHE_BLOCK_SIZE = 0x20000;
+  static constexpr size_t MAX_CACHED_BLOCKS = 256;  // 32 MiB
+  // How many blocks past the end of a sequential read are read along with it
+  static constexpr u64 PREFETCH_BLOCKS = 1;
+
+  explicit BlockCachedBlobReader(std::unique_ptr<BlobReader> reader) : m_reader{std::move(reader)}
+  {
+  }
+
+  std::unique_ptr<BlobReader> CopyReader() const override
+  {
+    auto reader = m_reader->CopyReader();
+    return reader ? std::make_unique<BlockCachedBlobReader>(std::move(reader)) : nullptr;
+  }
+
+  BlobType GetBlobType() const override { return m_reader->GetBlobType(); }
+  u64 GetRawSize() const override { return m_reader->GetRawSize(); }
+  u64 GetDataSize() const override { return m_reader->GetDataSize(); }
+  DataSizeType GetDataSizeType() const override { return m_reader->GetDataSizeType(); }
+
+  u64 GetBlockSize() const override { return m_reader->GetBlockSize(); }
+  bool HasFastRandomAccessInBlock() const override
+  {
+    return m_reader->HasFastRandomAccessInBlock();
+  }
+  std::string GetCompressionMethod() const override { return m_reader->GetCompressionMethod(); }
+  std::optional<int> GetCompressionLevel() const override
+  {
+    return m_reader->GetCompressionLevel();
+  }
+
+  bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const override
+  {
+    return m_reader->SupportsReadWiiDecrypted(offset, size, partition_data_offset);
+  }
+
+  bool ReadWiiDecrypted(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset) override
+  {
+    return m_reader->ReadWiiDecrypted(offset, size, out_ptr, partition_data_offset);
+  }
+
+  bool Read(u64 offset, u64 size, u8* out_ptr) override
+  {
+    const u64 data_size = m_reader->GetDataSize();
+
+    // Reads that would push most of the cache out, or that go past the end (which NFS allows),
+    // aren't worth caching.
+    if (size == 0 || size > CACHE_BLOCK_SIZE * MAX_CACHED_BLOCKS / 4 || offset > data_size ||
+        size > data_size - offset)
+    {
+      return m_reader->Read(offset, size, out_ptr);
+    }
+
+    const u64 first_block = offset / CACHE_BLOCK_SIZE;
+    const u64 last_block = (offset + size - 1) / CACHE_BLOCK_SIZE;
+    const u64 block_count = Common::AlignUp(data_size, CACHE_BLOCK_SIZE) / CACHE_BLOCK_SIZE;
+    const bool is_sequential = first_block == m_last_block || first_block == m_last_block + 1;
+    m_last_block = last_block;
+
+    // Make sure that the blocks of this read that are already cached don't get evicted while
+    // reading the rest. The size limit above leaves room for them and the missing blocks.
+    for (u64 block = first_block; block <= last_block; ++block)
+    {
+      const auto it = m_cached_blocks_by_index.find(block);
+      if (it != m_cached_blocks_by_index.end())
+        m_cached_blocks.splice(m_cached_blocks.begin(), m_cached_blocks, it->second);
+    }
+
+    u64 block = first_block;
+    while (block <= last_block)
+    {
+      if (!m_cached_blocks_by_index.contains(block))
+      {
+        // Coalesce the run of blocks that are missing into a single read
+        u64 end_block = block + 1;
+        while (end_block <= last_block && !m_cached_blocks_by_index.contains(end_block))
+          ++end_block;
+        if (end_block > last_block && is_sequential)
+        {
+          for (u64 i = 0; i < PREFETCH_BLOCKS && end_block < block_count &&
+                          !m_cached_blocks_by_index.contains(end_block);
+               ++i)
+          {
+            ++end_block;
+          }
+        }
+
+        if (!ReadBlocks(block, end_block, data_size))
+          return m_reader->Read(offset, size, out_ptr);
+      }
+
+      const std::vector<u8>& data = GetCachedBlock(block);
+      const u64 block_offset = block * CACHE_BLOCK_SIZE;
+      const u64 copy_start = std::max(offset, block_offset);
+      const u64 copy_end = std::min(offset + size, block_offset + data.size());
+      std::memcpy(out_ptr + (copy_start - offset), data.data() + (copy_start - block_offset),
+                  copy_end - copy_start);
+      ++block;
+    }
+
+    return true;
+  }
+
+private:
+  struct CachedBlock
+  {
+    u64 index;
+    std::vector<u8> data;
+  };
+
+  bool ReadBlocks(u64 first_block, u64 end_block, u64 data_size)
+  {
+    const u64 start = first_block * CACHE_BLOCK_SIZE;
+    const u64 end = std::min(end_block * CACHE_BLOCK_SIZE, data_size);
+    std::vector<u8> buffer(end - start);
+    if (!m_reader->Read(start, buffer.size(), buffer.data()))
+      return false;
+
+    for (u64 block = first_block; block < end_block; ++block)
+    {
+      const u64 block_start = block * CACHE_BLOCK_SIZE - start;
+      const u64 block_end = std::min<u64>(block_start + CACHE_BLOCK_SIZE, buffer.size());
+      InsertBlock(block, std::vector<u8>(buffer.begin() + block_start, buffer.begin() + block_end));
+    }
+    return true;
+  }
+
+  void InsertBlock(u64 index, std::vector<u8> data)
+  {
+    if (m_cached_blocks.size() >= MAX_CACHED_BLOCKS)
+    {
+      m_cached_blocks_by_index.erase(m_cached_blocks.back().index);
+      m_cached_blocks.pop_back();
+    }
+
+    m_cached_blocks.push_front(CachedBlock{index, std::move(data)});
+    m_cached_blocks_by_index.insert_or_assign(index, m_cached_blocks.begin());
+  }
+
+  const std::vector<u8>& GetCachedBlock(u64 index)
+  {
+    const auto it = m_cached_blocks_by_index.at(index);
+    m_cached_blocks.splice(m_cached_blocks.begin(), m_cached_blocks, it);
+    return it->data;
+  }
+
+  const std::unique_ptr<BlobReader> m_reader;
+
+  // Most recently used first
+  std::list<CachedBlock> m_cached_blocks;
+  std::map<u64, std::list<CachedBlock>::iterator> m_cached_blocks_by_index;
+  u64 m_last_block = 0;
+};
+
 std::unique_ptr<BlobReader> CreateCachedBlobReader(std::unique_ptr<BlobReader> reader)
 {
   return std::make_unique<CachedBlobReader>(std::move(reader), false);
@@ -236,4 +400,9 @@ std::unique_ptr<BlobReader> CreateScrubbingCachedBlobReader(std::unique_ptr<Blob
   return std::make_unique<CachedBlobReader>(std::move(reader), true);
 }
 
+std::unique_ptr<BlobReader> CreateBlockCachedBlobReader(std::unique_ptr<BlobReader> reader)
+{
+  return std::make_unique<BlockCachedBlobReader>(std::move(reader));
+}
+
 }  // namespace DiscIO
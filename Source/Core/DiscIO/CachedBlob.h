@@ -13,4 +13,9 @@ namespace DiscIO
 std::unique_ptr<BlobReader> CreateCachedBlobReader(std::unique_ptr<BlobReader> reader);
 std::unique_ptr<BlobReader> CreateScrubbingCachedBlobReader(std::unique_ptr<BlobReader> reader);
 
+// Keeps the most recently read blocks of a reader in memory, up to a fixed size. Misses on
+// neighbouring blocks are read from the reader in one go, and sequential reads also pull in the
+// block after the one that was asked for.
+std::unique_ptr<BlobReader> CreateBlockCachedBlobReader(std::unique_ptr<BlobReader> reader);
+
 }  // namespace DiscIO
@@ -93,8 +93,8 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer, DirectoryBlobReade
     if (std::holds_alternative<ContentFile>(m_content_source))
     {
       const auto& content = std::get<ContentFile>(m_content_source);
-      File::DirectIOFile file(content.m_filename, File::AccessMode::Read);
-      if (!file.OffsetRead(content.m_offset + offset_in_content, *buffer, bytes_to_read))
+      File::DirectIOFile* file = blob->GetOpenFile(content.m_filename);
+      if (!file || !file->OffsetRead(content.m_offset + offset_in_content, *buffer, bytes_to_read))
       {
         return false;
       }
@@ -144,8 +144,30 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer, DirectoryBlobReade
 
 void DiscContentContainer::Add(u64 offset, u64 size, ContentSource source)
 {
-  if (size != 0)
-    m_contents.emplace(offset, size, std::move(source));
+  if (size == 0)
+    return;
+
+  if (const auto* file = std::get_if<ContentFile>(&source))
+  {
+    // DiscContents are ordered by their end offset
+    const auto previous = m_contents.find(DiscContent(offset));
+    if (previous != m_contents.end() && previous->GetSize() != 0)
+    {
+      const auto* previous_file = std::get_if<ContentFile>(&previous->GetContentSource());
+      if (previous_file && previous_file->m_filename == file->m_filename &&
+          previous_file->m_offset + previous->GetSize() == file->m_offset)
+      {
+        ContentFile merged = *previous_file;
+        const u64 merged_offset = previous->GetOffset();
+        const u64 merged_size = previous->GetSize() + size;
+        m_contents.erase(previous);
+        m_contents.emplace(merged_offset, merged_size, std::move(merged));
+        return;
+      }
+    }
+  }
+
+  m_contents.emplace(offset, size, std::move(source));
 }
 
 u64 DiscContentContainer::CheckSizeAndAdd(u64 offset, const std::string& path)
@@ -510,6 +532,26 @@ bool DirectoryBlobReader::Read(u64 offset, u64 length, u8* buffer)
       .Read(offset, length, buffer, this);
 }
 
+File::DirectIOFile* DirectoryBlobReader::GetOpenFile(const std::string& path)
+{
+  const auto it =
+      std::ranges::find(m_open_files, path, &std::pair<std::string, File::DirectIOFile>::first);
+  if (it != m_open_files.end())
+  {
+    m_open_files.splice(m_open_files.begin(), m_open_files, it);
+    return &m_open_files.front().second;
+  }
+
+  File::DirectIOFile file(path, File::AccessMode::Read);
+  if (!file.IsOpen())
+    return nullptr;
+
+  if (m_open_files.size() >= MAX_OPEN_FILES)
+    m_open_files.pop_back();
+  m_open_files.emplace_front(path, std::move(file));
+  return &m_open_files.front().second;
+}
+
 const DirectoryBlobPartition* DirectoryBlobReader::GetPartition(u64 offset, u64 size,
                                                                 u64 partition_data_offset) const
 {
@@ -1206,14 +1248,22 @@ void DirectoryBlobPartition::WriteDirectory(std::vector<u8>* fst_data,
 {
   std::vector<FSTBuilderNode>& sorted_entries = *parent_entries;
 
-  // Sort for determinism
-  std::ranges::sort(sorted_entries, [](const FSTBuilderNode& one, const FSTBuilderNode& two) {
-    std::string one_upper = one.m_filename;
-    std::string two_upper = two.m_filename;
-    Common::ToUpper(&one_upper);
-    Common::ToUpper(&two_upper);
-    return one_upper == two_upper ? one.m_filename < two.m_filename : one_upper < two_upper;
+  // Sort for determinism. The uppercase names are made once per entry rather than once per
+  // comparison, which matters for folders with thousands of files.
+  std::vector<std::pair<std::string, FSTBuilderNode>> keyed_entries;
+  keyed_entries.reserve(sorted_entries.size());
+  for (FSTBuilderNode& entry : sorted_entries)
+  {
+    std::string upper = entry.m_filename;
+    Common::ToUpper(&upper);
+    keyed_entries.emplace_back(std::move(upper), std::move(entry));
+  }
+  std::ranges::sort(keyed_entries, [](const auto& one, const auto& two) {
+    return one.first == two.first ? one.second.m_filename < two.second.m_filename :
+                                    one.first < two.first;
   });
+  for (size_t i = 0; i < keyed_entries.size(); ++i)
+    sorted_entries[i] = std::move(keyed_entries[i].second);
 
   for (FSTBuilderNode& entry : sorted_entries)
   {
@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <list>
 #include <map>
 #include <memory>
 #include <optional>
@@ -15,6 +16,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/DirectIOFile.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/Volume.h"
 #include "DiscIO/WiiEncryptionCache.h"
@@ -135,6 +137,7 @@ public:
   u64 GetOffset() const;
   u64 GetEndOffset() const;
   u64 GetSize() const;
+  const ContentSource& GetContentSource() const { return m_content_source; }
   bool Read(u64* offset, u64* length, u8** buffer, DirectoryBlobReader* blob) const;
 
   bool operator==(const DiscContent& other) const { return GetEndOffset() == other.GetEndOffset(); }
@@ -162,6 +165,8 @@ public:
     size_t vector_size = vector.size();
     return Add(offset, vector_size, std::make_shared<std::vector<u8>>(std::move(vector)));
   }
+  // Content that continues the host file of the content right before it is merged into it, so
+  // that reading across both takes one host read.
   void Add(u64 offset, u64 size, ContentSource source);
   u64 CheckSizeAndAdd(u64 offset, const std::string& path);
   u64 CheckSizeAndAdd(u64 offset, u64 max_size, const std::string& path);
@@ -307,6 +312,9 @@ private:
 
   const VolumeDisc* GetWrappedVolume() const { return m_wrapped_volume.get(); }
 
+  // Returns nullptr if the file can't be opened.
+  File::DirectIOFile* GetOpenFile(const std::string& path);
+
   // For GameCube:
   DirectoryBlobPartition m_gamecube_pseudopartition;
 
@@ -321,6 +329,11 @@ private:
   u64 m_data_size;
 
   std::unique_ptr<VolumeDisc> m_wrapped_volume;
+
+  // Host files that were read from recently, most recently used first. Keeps reads of files that
+  // are split into many contents (or read in small pieces) from opening the file every time.
+  static constexpr size_t MAX_OPEN_FILES = 16;
+  std::list<std::pair<std::string, File::DirectIOFile>> m_open_files;
 };
 
 }  // namespace DiscIO
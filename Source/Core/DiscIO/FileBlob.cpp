@@ -4,6 +4,7 @@
 #include "DiscIO/FileBlob.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
@@ -38,6 +39,54 @@ bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
   return m_file.OffsetRead(offset, out_ptr, nbytes);
 }
 
+MappedFileReader::MappedFileReader(std::string path) : m_path(std::move(path))
+{
+}
+
+std::unique_ptr<MappedFileReader> MappedFileReader::Create(const std::string& path)
+{
+  // A whole disc image doesn't reliably fit in a 32-bit address space
+  if constexpr (sizeof(void*) < 8)
+    return nullptr;
+
+  if (!Common::MappedFile::IsOnLocalDrive(path))
+    return nullptr;
+
+  auto reader = std::unique_ptr<MappedFileReader>(new MappedFileReader(path));
+  if (!reader->m_file.Open(path) || reader->m_file.GetData().empty())
+    return nullptr;
+
+  // Reads are advised individually, so the OS shouldn't guess around them
+  reader->m_file.Advise(0, reader->m_file.GetData().size(), Common::MappedFile::AccessHint::Random);
+  return reader;
+}
+
+std::unique_ptr<BlobReader> MappedFileReader::CopyReader() const
+{
+  return Create(m_path);
+}
+
+bool MappedFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
+{
+  const std::span<const u8> data = m_file.GetData();
+  if (offset > data.size() || nbytes > data.size() - offset)
+    return false;
+
+  // Have the whole range read in at once rather than faulting it in page by page
+  m_file.Advise(offset, nbytes, Common::MappedFile::AccessHint::WillNeed);
+
+  m_sequential_reads = offset == m_next_sequential_offset ? m_sequential_reads + 1 : 0;
+  m_next_sequential_offset = offset + nbytes;
+  if (m_sequential_reads >= 2)
+  {
+    m_file.Advise(m_next_sequential_offset, SEQUENTIAL_READ_AHEAD,
+                  Common::MappedFile::AccessHint::WillNeed);
+  }
+
+  std::memcpy(out_ptr, data.data() + offset, nbytes);
+  return true;
+}
+
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
                     const std::string& outfile_path, const CompressCB& callback)
 {
@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <semaphore>
 #include <thread>
 #include <utility>
 
@@ -27,6 +29,15 @@ enum class ConversionResultCode
 template <typename T>
 using ConversionResult = Common::Result<T, ConversionResultCode>;
 
+// Shared by all MultithreadedCompressors, so that running several conversions at once doesn't
+// run more compression jobs at a time than there are hardware threads.
+inline std::counting_semaphore<>& GetCompressionSlots()
+{
+  static std::counting_semaphore<> slots(
+      std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+  return slots;
+}
+
 // This class starts a number of compression threads and one output thread.
 // The set_up_compress_thread_state function is called at the start of each compression thread.
 // When CompressAndWrite is called, the compress function will be called on one of the
@@ -154,8 +165,10 @@ private:
       state->compress_done_event.Reset();
       state->compress_ready_event.Set();
 
+      GetCompressionSlots().acquire();
       ConversionResult<OutputParameters> result =
           m_compress(&compress_thread_state, std::move(parameters));
+      GetCompressionSlots().release();
 
       if (result)
       {
@@ -23,6 +23,7 @@
 #include "DiscIO/CachedBlob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/Enums.h"
+#include "DiscIO/FileBlob.h"
 #include "DiscIO/VolumeDisc.h"
 #include "DiscIO/VolumeGC.h"
 #include "DiscIO/VolumeWad.h"
@@ -122,7 +123,31 @@ std::unique_ptr<VolumeDisc> CreateDiscForCore(const std::string& path)
   if (Config::Get(Config::MAIN_LOAD_GAME_INTO_MEMORY))
     return TryCreateDisc(CreateBlobReader(path), CreateScrubbingCachedBlobReader);
 
-  return CreateDisc(path);
+  std::unique_ptr<BlobReader> reader = CreateBlobReader(path);
+  if (reader && reader->GetBlobType() == BlobType::PLAIN &&
+      Config::Get(Config::MAIN_MEMORY_MAP_DISC_IMAGES))
+  {
+    if (std::unique_ptr<BlobReader> mapped_reader = MappedFileReader::Create(path))
+      reader = std::move(mapped_reader);
+  }
+
+  // These go to the host file for every read (and NFS decrypts every read too). GCZ, WIA and RVZ
+  // have caches of their own.
+  if (reader)
+  {
+    switch (reader->GetBlobType())
+    {
+    case BlobType::NFS:
+    case BlobType::WBFS:
+    case BlobType::CISO:
+    case BlobType::SPLIT_PLAIN:
+      return TryCreateDisc(std::move(reader), CreateBlockCachedBlobReader);
+    default:
+      break;
+    }
+  }
+
+  return CreateDisc(std::move(reader));
 }
 
 static std::unique_ptr<VolumeWAD> TryCreateWAD(std::unique_ptr<BlobReader> reader)
@@ -1075,42 +1075,76 @@ void VolumeVerifier::SetUpHashing()
   {
     m_sha1_context = Common::SHA1::CreateContext();
   }
+
+  StartHashWorkers();
+}
+
+void VolumeVerifier::StartHashWorkers()
+{
+  if (m_hashes_to_calculate.crc32)
+  {
+    m_crc32_worker.Reset("CRC32 hashing", [this](ChunkToHash chunk) {
+      m_crc32_context = Common::UpdateCRC32(m_crc32_context, chunk.data->data(), chunk.size);
+    });
+  }
+
+  if (m_hashes_to_calculate.md5)
+  {
+    m_md5_worker.Reset("MD5 hashing", [this](ChunkToHash chunk) {
+      mbedtls_md5_update_ret(&m_md5_context, chunk.data->data(), chunk.size);
+    });
+  }
+
+  if (m_hashes_to_calculate.sha1)
+  {
+    m_sha1_worker.Reset("SHA1 hashing", [this](ChunkToHash chunk) {
+      m_sha1_context->Update(chunk.data->data(), chunk.size);
+    });
+  }
 }
 
-void VolumeVerifier::WaitForAsyncOperations() const
+void VolumeVerifier::WaitForIntegrityChecks() const
 {
-  if (m_crc32_future.valid())
-    m_crc32_future.wait();
-  if (m_md5_future.valid())
-    m_md5_future.wait();
-  if (m_sha1_future.valid())
-    m_sha1_future.wait();
   if (m_content_future.valid())
     m_content_future.wait();
   if (m_group_future.valid())
     m_group_future.wait();
 }
 
-bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
+void VolumeVerifier::WaitForAsyncOperations()
+{
+  m_crc32_worker.WaitForCompletion();
+  m_md5_worker.WaitForCompletion();
+  m_sha1_worker.WaitForCompletion();
+  WaitForIntegrityChecks();
+}
+
+bool VolumeVerifier::ReadChunkAndWaitForIntegrityChecks(u64 bytes_to_read)
 {
-  std::vector<u8> data(bytes_to_read);
+  // Blocks while the hash workers are MAX_CHUNKS_IN_FLIGHT - 1 chunks behind
+  m_free_chunks.acquire();
+  const std::shared_ptr<std::vector<u8>> data(new std::vector<u8>(bytes_to_read),
+                                              [this](std::vector<u8>* chunk) {
+                                                delete chunk;
+                                                m_free_chunks.release();
+                                              });
 
   const u64 bytes_to_copy = std::min(m_excess_bytes, bytes_to_read);
   if (bytes_to_copy > 0)
-    std::memcpy(data.data(), m_data.data() + m_data.size() - m_excess_bytes, bytes_to_copy);
+    std::memcpy(data->data(), m_data->data() + m_data->size() - m_excess_bytes, bytes_to_copy);
   bytes_to_read -= bytes_to_copy;
 
   if (bytes_to_read > 0)
   {
-    if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data.data() + bytes_to_copy,
+    if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data->data() + bytes_to_copy,
                        PARTITION_NONE))
     {
       return false;
     }
   }
 
-  WaitForAsyncOperations();
-  m_data = std::move(data);
+  WaitForIntegrityChecks();
+  m_data = data;
   return true;
 }
 
@@ -1185,7 +1219,7 @@ void VolumeVerifier::Process()
   }
 
   const bool is_data_needed = m_calculating_any_hash || content_read || group_read;
-  const bool read_failed = is_data_needed && !ReadChunkAndWaitForAsyncOperations(bytes_to_read);
+  const bool read_failed = is_data_needed && !ReadChunkAndWaitForIntegrityChecks(bytes_to_read);
 
   if (read_failed)
   {
@@ -1200,33 +1234,19 @@ void VolumeVerifier::Process()
 
   if (m_calculating_any_hash)
   {
+    const ChunkToHash chunk{m_data, static_cast<size_t>(byte_increment)};
     if (m_hashes_to_calculate.crc32)
-    {
-      m_crc32_future = std::async(std::launch::async, [this, byte_increment] {
-        m_crc32_context = Common::UpdateCRC32(m_crc32_context, m_data.data(),
-                                              static_cast<size_t>(byte_increment));
-      });
-    }
-
+      m_crc32_worker.Push(chunk);
     if (m_hashes_to_calculate.md5)
-    {
-      m_md5_future = std::async(std::launch::async, [this, byte_increment] {
-        mbedtls_md5_update_ret(&m_md5_context, m_data.data(), byte_increment);
-      });
-    }
-
+      m_md5_worker.Push(chunk);
     if (m_hashes_to_calculate.sha1)
-    {
-      m_sha1_future = std::async(std::launch::async, [this, byte_increment] {
-        m_sha1_context->Update(m_data.data(), byte_increment);
-      });
-    }
+      m_sha1_worker.Push(chunk);
   }
 
   if (content_read)
   {
     m_content_future = std::async(std::launch::async, [this, read_failed, content] {
-      if (read_failed || !m_volume.CheckContentIntegrity(content, m_data, m_ticket))
+      if (read_failed || !m_volume.CheckContentIntegrity(content, *m_data, m_ticket))
       {
         AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
       }
@@ -1247,7 +1267,7 @@ void VolumeVerifier::Process()
         const u64 block_offset = group.offset + offset_in_group;
 
         if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
+                                block_index, m_data->data() + offset_in_group, group.partition))
         {
           m_biggest_verified_offset =
               std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
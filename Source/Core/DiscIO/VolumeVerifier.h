@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <semaphore>
 #include <string>
 #include <vector>
 
@@ -14,6 +15,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/DiscScrubber.h"
 #include "DiscIO/Volume.h"
@@ -144,6 +146,15 @@ private:
     size_t block_index_end;
   };
 
+  struct ChunkToHash
+  {
+    std::shared_ptr<const std::vector<u8>> data;
+    size_t size;
+  };
+
+  // How many chunks may be read ahead of the slowest hash. Includes the chunk in m_data.
+  static constexpr std::ptrdiff_t MAX_CHUNKS_IN_FLIGHT = 8;
+
   std::vector<Partition> CheckPartitions();
   bool CheckPartition(const Partition& partition);  // Returns false if partition should be ignored
   std::string GetPartitionName(std::optional<u32> type) const;
@@ -156,8 +167,10 @@ private:
   void CheckMisc();
   void CheckSuperPaperMario();
   void SetUpHashing();
-  void WaitForAsyncOperations() const;
-  bool ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read);
+  void StartHashWorkers();
+  void WaitForIntegrityChecks() const;
+  void WaitForAsyncOperations();
+  bool ReadChunkAndWaitForIntegrityChecks(u64 bytes_to_read);
 
   void AddProblem(Severity severity, std::string text);
 
@@ -180,10 +193,14 @@ private:
   std::unique_ptr<Common::SHA1::Context> m_sha1_context;
 
   u64 m_excess_bytes = 0;
-  std::vector<u8> m_data;
-  std::future<void> m_crc32_future;
-  std::future<void> m_md5_future;
-  std::future<void> m_sha1_future;
+  // Released when the last user of a chunk lets go of it, so declared before all of them
+  std::counting_semaphore<MAX_CHUNKS_IN_FLIGHT> m_free_chunks{MAX_CHUNKS_IN_FLIGHT};
+  std::shared_ptr<const std::vector<u8>> m_data;
+  // Each hash consumes the chunks in order on its own thread, so that reading the next chunks
+  // overlaps with hashing and the hashes don't wait on each other.
+  Common::WorkQueueThreadSP<ChunkToHash> m_crc32_worker;
+  Common::WorkQueueThreadSP<ChunkToHash> m_md5_worker;
+  Common::WorkQueueThreadSP<ChunkToHash> m_sha1_worker;
   std::future<void> m_content_future;
   std::future<void> m_group_future;
 
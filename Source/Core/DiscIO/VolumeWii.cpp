@@ -510,18 +510,26 @@ bool VolumeWii::HashGroup(const std::array<u8, BLOCK_DATA_SIZE> in[BLOCKS_PER_GR
                           HashBlock out[BLOCKS_PER_GROUP],
                           const std::function<bool(size_t block)>& read_function)
 {
-  std::array<std::future<void>, BLOCKS_PER_GROUP> hash_futures;
+  // The H0 and H1 hashes of a subgroup only depend on its own blocks, so each subgroup is hashed
+  // by its own task while the next one is being read. Only the H2 hashes need all of them.
+  constexpr size_t BLOCKS_PER_SUBGROUP = 8;
+  constexpr size_t SUBGROUPS = BLOCKS_PER_GROUP / BLOCKS_PER_SUBGROUP;
+
+  std::array<std::future<void>, SUBGROUPS> hash_futures;
   bool success = true;
 
-  for (size_t i = 0; i < BLOCKS_PER_GROUP; ++i)
+  for (size_t subgroup = 0; subgroup < SUBGROUPS && success; ++subgroup)
   {
-    if (read_function && success)
+    const size_t h1_base = subgroup * BLOCKS_PER_SUBGROUP;
+
+    for (size_t i = h1_base; i < h1_base + BLOCKS_PER_SUBGROUP && read_function && success; ++i)
       success = read_function(i);
 
-    hash_futures[i] = std::async(std::launch::async, [&in, &out, &hash_futures, success, i] {
-      const size_t h1_base = Common::AlignDown(i, 8);
+    if (!success)
+      break;
 
-      if (success)
+    hash_futures[subgroup] = std::async(std::launch::async, [&in, &out, h1_base] {
+      for (size_t i = h1_base; i < h1_base + BLOCKS_PER_SUBGROUP; ++i)
       {
         // H0 hashes
         for (size_t j = 0; j < 31; ++j)
@@ -534,47 +542,37 @@ bool VolumeWii::HashGroup(const std::array<u8, BLOCK_DATA_SIZE> in[BLOCKS_PER_GR
         out[h1_base].h1[i - h1_base] = Common::SHA1::CalculateDigest(out[i].h0);
       }
 
-      if (i % 8 == 7)
-      {
-        for (size_t j = 0; j < 7; ++j)
-          hash_futures[h1_base + j].get();
-
-        if (success)
-        {
-          // H1 padding
-          out[h1_base].padding_1 = {};
+      // H1 padding
+      out[h1_base].padding_1 = {};
 
-          // H1 copies
-          for (size_t j = 1; j < 8; ++j)
-            out[h1_base + j].h1 = out[h1_base].h1;
+      // H1 copies
+      for (size_t j = 1; j < BLOCKS_PER_SUBGROUP; ++j)
+        out[h1_base + j].h1 = out[h1_base].h1;
+    });
+  }
 
-          // H2 hash
-          out[0].h2[h1_base / 8] = Common::SHA1::CalculateDigest(out[i].h1);
-        }
+  // Wait for all the async tasks to finish
+  for (std::future<void>& future : hash_futures)
+  {
+    if (future.valid())
+      future.get();
+  }
 
-        if (i == BLOCKS_PER_GROUP - 1)
-        {
-          for (size_t j = 0; j < 7; ++j)
-            hash_futures[j * 8 + 7].get();
+  if (!success)
+    return false;
 
-          if (success)
-          {
-            // H2 padding
-            out[0].padding_2 = {};
+  // H2 hashes
+  for (size_t subgroup = 0; subgroup < SUBGROUPS; ++subgroup)
+    out[0].h2[subgroup] = Common::SHA1::CalculateDigest(out[subgroup * BLOCKS_PER_SUBGROUP].h1);
 
-            // H2 copies
-            for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
-              out[j].h2 = out[0].h2;
-          }
-        }
-      }
-    });
-  }
+  // H2 padding
+  out[0].padding_2 = {};
 
-  // Wait for all the async tasks to finish
-  hash_futures.back().get();
+  // H2 copies
+  for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
+    out[j].h2 = out[0].h2;
 
-  return success;
+  return true;
 }
 
 bool VolumeWii::EncryptGroup(
@@ -586,25 +584,25 @@ bool VolumeWii::EncryptGroup(
   std::vector<std::array<u8, BLOCK_DATA_SIZE>> unencrypted_data(BLOCKS_PER_GROUP);
   std::vector<HashBlock> unencrypted_hashes(BLOCKS_PER_GROUP);
 
-  const bool success =
-      HashGroup(unencrypted_data.data(), unencrypted_hashes.data(), [&](size_t block) {
-        if (offset + (block + 1) * BLOCK_DATA_SIZE <= partition_data_decrypted_size)
-        {
-          if (!blob->ReadWiiDecrypted(offset + block * BLOCK_DATA_SIZE, BLOCK_DATA_SIZE,
-                                      unencrypted_data[block].data(), partition_data_offset))
-          {
-            return false;
-          }
-        }
-        else
-        {
-          unencrypted_data[block].fill(0);
-        }
-        return true;
-      });
-
-  if (!success)
+  // Read everything in the partition with a single read, so that the blob reader can work on the
+  // whole group at once (decompressing its chunks in parallel, for instance)
+  const u64 blocks_in_partition = offset >= partition_data_decrypted_size ?
+                                      0 :
+                                      (partition_data_decrypted_size - offset) / BLOCK_DATA_SIZE;
+  const u64 blocks_to_read = std::min<u64>(BLOCKS_PER_GROUP, blocks_in_partition);
+
+  static_assert(sizeof(std::array<u8, BLOCK_DATA_SIZE>) == BLOCK_DATA_SIZE);
+  u8* const unencrypted_data_ptr = reinterpret_cast<u8*>(unencrypted_data.data());
+  if (blocks_to_read > 0 && !blob->ReadWiiDecrypted(offset, blocks_to_read * BLOCK_DATA_SIZE,
+                                                    unencrypted_data_ptr, partition_data_offset))
+  {
     return false;
+  }
+
+  for (size_t block = blocks_to_read; block < BLOCKS_PER_GROUP; ++block)
+    unencrypted_data[block].fill(0);
+
+  HashGroup(unencrypted_data.data(), unencrypted_hashes.data());
 
   if (hash_exception_callback)
     hash_exception_callback(unencrypted_hashes.data());
@@ -6,11 +6,13 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <future>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -28,6 +30,8 @@
 #include "Common/ScopeGuard.h"
 #include "Common/Swap.h"
 
+#include "Core/Config/MainSettings.h"
+
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/Filesystem.h"
@@ -79,13 +83,23 @@ std::pair<int, int> GetAllowedCompressionLevels(WIARVZCompressionType compressio
 
 template <bool RVZ>
 WIARVZFileReader<RVZ>::WIARVZFileReader(File::DirectIOFile file, const std::string& path)
-    : m_file(std::move(file)), m_path(path), m_encryption_cache(this)
+    : m_file(std::move(file)), m_path(path),
+      m_chunk_cache_budget(
+          static_cast<size_t>(std::max(Config::Get(Config::MAIN_COMPRESSED_CHUNK_CACHE_SIZE), 0))
+          << 20),
+      m_encryption_cache(this)
 {
   m_valid = Initialize(path);
 }
 
 template <bool RVZ>
-WIARVZFileReader<RVZ>::~WIARVZFileReader() = default;
+WIARVZFileReader<RVZ>::~WIARVZFileReader()
+{
+  // Drop the cached chunks first, so that their decompression contexts go back to the pools.
+  m_cached_chunk_index.clear();
+  m_cached_chunks.clear();
+  FreeUnusedDecompressionContexts();
+}
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
@@ -215,6 +229,7 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
                          number_of_raw_data_entries * sizeof(RawDataEntry), m_compression_type);
   if (!raw_data_entries.ReadAll(&m_raw_data_entries))
     return false;
+  UpdateCachedChunkSize(raw_data_entries);
 
   for (size_t i = 0; i < m_raw_data_entries.size(); ++i)
   {
@@ -232,6 +247,7 @@ bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
                          number_of_group_entries * sizeof(GroupEntry), m_compression_type);
   if (!group_entries.ReadAll(&m_group_entries))
     return false;
+  UpdateCachedChunkSize(group_entries);
 
   if (HasDataOverlap())
     return false;
@@ -499,10 +515,25 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   if (*offset < data_offset)
     return false;
 
+  // Nothing from a previous call is in use anymore
+  TrimChunkCache();
+
   const u64 skipped_data = data_offset % sector_size;
   data_offset -= skipped_data;
   data_size += skipped_data;
 
+  struct GroupRead
+  {
+    Chunk* chunk;
+    u64 group_offset_in_file;
+    u64 group_offset_in_data;
+    u64 total_group_index;
+    u64 offset_in_group;
+    u64 bytes_to_read;
+    u8* out_ptr;
+  };
+  std::vector<GroupRead> group_reads;
+
   const u64 start_group_index = (*offset - data_offset) / chunk_size;
   for (u64 i = start_group_index; i < number_of_groups && (*size) > 0; ++i)
   {
@@ -543,21 +574,8 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
           ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
                              exception_lists, rvz_packed_size, group_offset_in_data);
 
-      if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
-      {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
-        return false;
-      }
-
-      if (m_write_to_exception_list && m_exception_list_last_group_index != total_group_index)
-      {
-        const u64 exception_list_index = offset_in_group / VolumeWii::GROUP_DATA_SIZE;
-        const u16 additional_offset =
-            static_cast<u16>(group_offset_in_data % VolumeWii::GROUP_DATA_SIZE /
-                             VolumeWii::BLOCK_DATA_SIZE * VolumeWii::BLOCK_HEADER_SIZE);
-        chunk.GetHashExceptions(&m_exception_list, exception_list_index, additional_offset);
-        m_exception_list_last_group_index = total_group_index;
-      }
+      group_reads.push_back({&chunk, group_offset_in_file, group_offset_in_data, total_group_index,
+                             offset_in_group, bytes_to_read, *out_ptr});
     }
 
     *offset += bytes_to_read;
@@ -565,6 +583,74 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     *out_ptr += bytes_to_read;
   }
 
+  // If more than one chunk has to be decompressed, decompress them in parallel. Groups that reuse
+  // the data of another group share its chunk, which must only be decompressed by one thread.
+  std::map<Chunk*, std::pair<u64, u64>> chunks_to_decompress;
+  for (const GroupRead& group_read : group_reads)
+  {
+    const u64 end = group_read.offset_in_group + group_read.bytes_to_read;
+    if (!group_read.chunk->IsDecompressedUntil(0, end))
+    {
+      auto& [group_offset_in_file, chunk_end] = chunks_to_decompress[group_read.chunk];
+      group_offset_in_file = group_read.group_offset_in_file;
+      chunk_end = std::max(chunk_end, end);
+    }
+  }
+
+  if (chunks_to_decompress.size() > 1)
+  {
+    const std::vector<std::pair<Chunk*, std::pair<u64, u64>>> chunks(chunks_to_decompress.begin(),
+                                                                     chunks_to_decompress.end());
+
+    const size_t threads = std::min<size_t>(
+        chunks.size(), std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+
+    std::vector<std::future<bool>> decompression_futures(threads);
+    for (size_t i = 0; i < threads; ++i)
+    {
+      decompression_futures[i] = std::async(std::launch::async, [&chunks, threads, i] {
+        bool success = true;
+        for (size_t j = i; j < chunks.size(); j += threads)
+          success &= chunks[j].first->DecompressUntil(0, chunks[j].second.second);
+        return success;
+      });
+    }
+
+    bool success = true;
+    for (std::future<bool>& future : decompression_futures)
+      success &= future.get();
+
+    if (!success)
+    {
+      for (const auto& [chunk, chunk_info] : chunks)
+        EraseCachedChunk(chunk_info.first);
+      return false;
+    }
+  }
+
+  for (const GroupRead& group_read : group_reads)
+  {
+    if (!group_read.chunk->Read(group_read.offset_in_group, group_read.bytes_to_read,
+                                group_read.out_ptr))
+    {
+      EraseCachedChunk(group_read.group_offset_in_file);
+      return false;
+    }
+    UpdateCachedChunkSize(*group_read.chunk);
+
+    if (m_write_to_exception_list &&
+        m_exception_list_last_group_index != group_read.total_group_index)
+    {
+      const u64 exception_list_index = group_read.offset_in_group / VolumeWii::GROUP_DATA_SIZE;
+      const u16 additional_offset =
+          static_cast<u16>(group_read.group_offset_in_data % VolumeWii::GROUP_DATA_SIZE /
+                           VolumeWii::BLOCK_DATA_SIZE * VolumeWii::BLOCK_HEADER_SIZE);
+      group_read.chunk->GetHashExceptions(&m_exception_list, exception_list_index,
+                                          additional_offset);
+      m_exception_list_last_group_index = group_read.total_group_index;
+    }
+  }
+
   return true;
 }
 
@@ -575,8 +661,11 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                           WIARVZCompressionType compression_type,
                                           u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  if (const auto it = m_cached_chunk_index.find(offset_in_file); it != m_cached_chunk_index.end())
+  {
+    m_cached_chunks.splice(m_cached_chunks.begin(), m_cached_chunks, it->second);
+    return it->second->second;
+  }
 
   std::unique_ptr<Decompressor> decompressor;
   switch (compression_type)
@@ -606,11 +695,44 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
 
   const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  Chunk& chunk = m_cached_chunks
+                     .emplace_front(offset_in_file,
+                                    Chunk(&m_file, offset_in_file, compressed_size,
+                                          decompressed_size, exception_lists,
+                                          compressed_exception_lists, rvz_packed_size, data_offset,
+                                          std::move(decompressor)))
+                     .second;
+  m_cached_chunk_index.emplace(offset_in_file, m_cached_chunks.begin());
+  UpdateCachedChunkSize(chunk);
+  return chunk;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::EraseCachedChunk(u64 offset_in_file)
+{
+  const auto it = m_cached_chunk_index.find(offset_in_file);
+  if (it == m_cached_chunk_index.end())
+    return;
+
+  m_cached_chunks_size -= it->second->second.counted_memory_usage;
+  m_cached_chunks.erase(it->second);
+  m_cached_chunk_index.erase(it);
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::UpdateCachedChunkSize(Chunk& chunk)
+{
+  const size_t memory_usage = chunk.GetMemoryUsage();
+  m_cached_chunks_size = m_cached_chunks_size - chunk.counted_memory_usage + memory_usage;
+  chunk.counted_memory_usage = memory_usage;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::TrimChunkCache()
+{
+  // The most recently used chunk is kept even if it's larger than the budget on its own
+  while (m_cached_chunks_size > m_chunk_cache_budget && m_cached_chunks.size() > 1)
+    EraseCachedChunk(m_cached_chunks.back().first);
 }
 
 template <bool RVZ>
@@ -653,6 +775,22 @@ WIARVZFileReader<RVZ>::Chunk::Chunk(File::DirectIOFile* file, u64 offset_in_file
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
+{
+  if (!DecompressUntil(offset, size))
+    return false;
+
+  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
+  return true;
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::IsDecompressedUntil(u64 offset, u64 size) const
+{
+  return offset + size <= GetOutBytesWrittenExcludingExceptions();
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressUntil(u64 offset, u64 size)
 {
   if (!m_decompressor || !m_file ||
       offset + size > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
@@ -754,7 +892,6 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
     }
   }
 
-  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
   return true;
 }
 
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <limits>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -194,6 +195,10 @@ private:
           u64 data_offset, std::unique_ptr<Decompressor> decompressor);
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
+    // Decompresses everything up to offset + size without copying it anywhere. A chunk can be
+    // decompressed on any thread, but only one thread at a time.
+    bool DecompressUntil(u64 offset, u64 size);
+    bool IsDecompressedUntil(u64 offset, u64 size) const;
 
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
@@ -205,6 +210,17 @@ private:
       return Read(0, vector->size() * sizeof(T), reinterpret_cast<u8*>(vector->data()));
     }
 
+    // Includes the decompression context, which is only held while the chunk is partially
+    // decompressed.
+    size_t GetMemoryUsage() const
+    {
+      return m_in.data.size() + m_out.data.size() +
+             (m_decompressor ? m_decompressor->GetMemoryUsage() : 0);
+    }
+
+    // What the chunk cache currently counts for this chunk. Kept by UpdateCachedChunkSize.
+    size_t counted_memory_usage = 0;
+
   private:
     bool Decompress();
     bool HandleExceptions(const u8* data, size_t bytes_allocated, size_t bytes_written,
@@ -238,9 +254,14 @@ private:
   bool ReadFromGroups(u64* offset, u64* size, u8** out_ptr, u64 chunk_size, u32 sector_size,
                       u64 data_offset, u64 data_size, u32 group_index, u32 number_of_groups,
                       u32 exception_lists);
+  // The returned chunk stays valid until the next call to TrimChunkCache or EraseCachedChunk.
   Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
                             u32 rvz_packed_size = 0, u64 data_offset = 0);
+  void EraseCachedChunk(u64 offset_in_file);
+  // Recounts the memory of a cached chunk after it was decompressed further.
+  void UpdateCachedChunkSize(Chunk& chunk);
+  void TrimChunkCache();
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -368,8 +389,14 @@ private:
 
   File::DirectIOFile m_file;
   std::string m_path;
-  Chunk m_cached_chunk;
-  u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
+  // Chunks by their offset in the file, the most recently used first. Partially decompressed chunks
+  // continue from where they stopped when read again.
+  using CachedChunks = std::list<std::pair<u64, Chunk>>;
+  CachedChunks m_cached_chunks;
+  std::map<u64, typename CachedChunks::iterator> m_cached_chunk_index;
+  // The sum of counted_memory_usage of all cached chunks.
+  size_t m_cached_chunks_size = 0;
+  size_t m_chunk_cache_budget;
   WiiEncryptionCache m_encryption_cache;
 
   std::vector<HashExceptionEntry> m_exception_list;
@@ -8,6 +8,7 @@
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <vector>
 
@@ -23,6 +24,81 @@
 
 namespace DiscIO
 {
+namespace
+{
+// Creating a decompression context allocates its window, which for zstd is as large as a chunk and
+// for LZMA is the whole dictionary. Decompressors are created for every chunk that gets read, on
+// any thread, so the contexts are kept around for the next one instead.
+template <typename Context, auto Free>
+class ContextPool
+{
+public:
+  static constexpr size_t MAX_SIZE = 4;
+
+  ~ContextPool() { Clear(); }
+
+  // Returns nullptr if the pool is empty.
+  Context* Take()
+  {
+    std::lock_guard lk(m_lock);
+    if (m_contexts.empty())
+      return nullptr;
+
+    Context* const context = m_contexts.back();
+    m_contexts.pop_back();
+    return context;
+  }
+
+  void Return(Context* context)
+  {
+    {
+      std::lock_guard lk(m_lock);
+      if (m_contexts.size() < MAX_SIZE)
+      {
+        m_contexts.push_back(context);
+        return;
+      }
+    }
+    Free(context);
+  }
+
+  void Clear()
+  {
+    std::vector<Context*> contexts;
+    {
+      std::lock_guard lk(m_lock);
+      contexts.swap(m_contexts);
+    }
+    for (Context* context : contexts)
+      Free(context);
+  }
+
+private:
+  std::mutex m_lock;
+  std::vector<Context*> m_contexts;
+};
+
+void FreeLZMAStream(lzma_stream* stream)
+{
+  lzma_end(stream);
+  delete stream;
+}
+
+void FreeZstdStream(ZSTD_DStream* stream)
+{
+  ZSTD_freeDStream(stream);
+}
+
+ContextPool<lzma_stream, FreeLZMAStream> s_lzma_streams;
+ContextPool<ZSTD_DStream, FreeZstdStream> s_zstd_streams;
+}  // namespace
+
+void FreeUnusedDecompressionContexts()
+{
+  s_lzma_streams.Clear();
+  s_zstd_streams.Clear();
+}
+
 static u32 LZMA2DictionarySize(u8 p)
 {
   return (static_cast<u32>(2) | (p & 1)) << (p / 2 + 11);
@@ -180,6 +256,14 @@ bool Bzip2Decompressor::Decompress(const DecompressionBuffer& in, DecompressionB
   return result == BZ_OK || result == BZ_STREAM_END;
 }
 
+size_t Bzip2Decompressor::GetMemoryUsage() const
+{
+  // bzip2 has no way to ask, but documents 100000 + 4 * block size bytes for decompressing. This
+  // assumes the largest block size of 900000 bytes, since the stream doesn't tell either.
+  constexpr size_t DECOMPRESSION_MEMORY = 100000 + 4 * 900000;
+  return m_started ? DECOMPRESSION_MEMORY : 0;
+}
+
 LZMADecompressor::LZMADecompressor(bool lzma2, const u8* filter_options, size_t filter_options_size)
 {
   m_options.preset_dict = nullptr;
@@ -224,8 +308,8 @@ LZMADecompressor::LZMADecompressor(bool lzma2, const u8* filter_options, size_t
 
 LZMADecompressor::~LZMADecompressor()
 {
-  if (m_started)
-    lzma_end(&m_stream);
+  if (m_stream)
+    s_lzma_streams.Return(m_stream);
 }
 
 bool LZMADecompressor::Decompress(const DecompressionBuffer& in, DecompressionBuffer* out,
@@ -233,44 +317,73 @@ bool LZMADecompressor::Decompress(const DecompressionBuffer& in, DecompressionBu
 {
   if (!m_started)
   {
-    if (m_error_occurred || lzma_raw_decoder(&m_stream, m_filters) != LZMA_OK)
+    if (m_error_occurred)
+      return false;
+
+    m_stream = s_lzma_streams.Take();
+    if (!m_stream)
+    {
+      m_stream = new lzma_stream;
+      *m_stream = LZMA_STREAM_INIT;
+    }
+
+    // Initializing a stream that has been used before reuses its memory
+    if (lzma_raw_decoder(m_stream, m_filters) != LZMA_OK)
       return false;
 
     m_started = true;
   }
 
+  if (!m_stream)
+    return m_done;
+
   const u8* const in_ptr = in.data.data() + *in_bytes_read;
-  m_stream.next_in = in_ptr;
-  m_stream.avail_in = in.bytes_written - *in_bytes_read;
+  m_stream->next_in = in_ptr;
+  m_stream->avail_in = in.bytes_written - *in_bytes_read;
 
   u8* const out_ptr = out->data.data() + out->bytes_written;
-  m_stream.next_out = out_ptr;
-  m_stream.avail_out = out->data.size() - out->bytes_written;
+  m_stream->next_out = out_ptr;
+  m_stream->avail_out = out->data.size() - out->bytes_written;
 
-  const lzma_ret result = lzma_code(&m_stream, LZMA_RUN);
+  const lzma_ret result = lzma_code(m_stream, LZMA_RUN);
 
-  *in_bytes_read += m_stream.next_in - in_ptr;
-  out->bytes_written += m_stream.next_out - out_ptr;
+  *in_bytes_read += m_stream->next_in - in_ptr;
+  out->bytes_written += m_stream->next_out - out_ptr;
 
   m_done = result == LZMA_STREAM_END;
+  if (m_done)
+  {
+    s_lzma_streams.Return(m_stream);
+    m_stream = nullptr;
+  }
   return result == LZMA_OK || result == LZMA_STREAM_END;
 }
 
+size_t LZMADecompressor::GetMemoryUsage() const
+{
+  return m_stream ? static_cast<size_t>(lzma_memusage(m_stream)) : 0;
+}
+
 ZstdDecompressor::ZstdDecompressor()
 {
-  m_stream = ZSTD_createDStream();
+  m_stream = s_zstd_streams.Take();
+  if (m_stream)
+    ZSTD_DCtx_reset(m_stream, ZSTD_reset_session_only);
+  else
+    m_stream = ZSTD_createDStream();
 }
 
 ZstdDecompressor::~ZstdDecompressor()
 {
-  ZSTD_freeDStream(m_stream);
+  if (m_stream)
+    s_zstd_streams.Return(m_stream);
 }
 
 bool ZstdDecompressor::Decompress(const DecompressionBuffer& in, DecompressionBuffer* out,
                                   size_t* in_bytes_read)
 {
   if (!m_stream)
-    return false;
+    return m_done;
 
   ZSTD_inBuffer in_buffer{in.data.data(), in.bytes_written, *in_bytes_read};
   ZSTD_outBuffer out_buffer{out->data.data(), out->data.size(), out->bytes_written};
@@ -281,9 +394,19 @@ bool ZstdDecompressor::Decompress(const DecompressionBuffer& in, DecompressionBu
   out->bytes_written = out_buffer.pos;
 
   m_done = result == 0;
+  if (m_done)
+  {
+    s_zstd_streams.Return(m_stream);
+    m_stream = nullptr;
+  }
   return !ZSTD_isError(result);
 }
 
+size_t ZstdDecompressor::GetMemoryUsage() const
+{
+  return m_stream ? ZSTD_sizeof_DStream(m_stream) : 0;
+}
+
 RVZPackDecompressor::RVZPackDecompressor(std::unique_ptr<Decompressor> decompressor,
                                          DecompressionBuffer decompressed, u64 data_offset,
                                          u32 rvz_packed_size)
@@ -430,6 +553,11 @@ bool RVZPackDecompressor::Done() const
          m_decompressed.bytes_written == m_decompressed_bytes_read && m_decompressor->Done();
 }
 
+size_t RVZPackDecompressor::GetMemoryUsage() const
+{
+  return m_decompressed.data.size() + m_decompressor->GetMemoryUsage();
+}
+
 Compressor::~Compressor() = default;
 
 PurgeCompressor::PurgeCompressor() = default;
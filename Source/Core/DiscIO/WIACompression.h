@@ -39,11 +39,16 @@ public:
   virtual bool Decompress(const DecompressionBuffer& in, DecompressionBuffer* out,
                           size_t* in_bytes_read) = 0;
   virtual bool Done() const { return m_done; }
+  // The memory held by the decompression context, if any.
+  virtual size_t GetMemoryUsage() const { return 0; }
 
 protected:
   bool m_done = false;
 };
 
+// Frees the decompression contexts that are kept for reuse. The ones in use are left alone.
+void FreeUnusedDecompressionContexts();
+
 class NoneDecompressor final : public Decompressor
 {
 public:
@@ -79,6 +84,7 @@ public:
 
   bool Decompress(const DecompressionBuffer& in, DecompressionBuffer* out,
                   size_t* in_bytes_read) override;
+  size_t GetMemoryUsage() const override;
 
 private:
   bz_stream m_stream = {};
@@ -93,9 +99,11 @@ public:
 
   bool Decompress(const DecompressionBuffer& in, DecompressionBuffer* out,
                   size_t* in_bytes_read) override;
+  size_t GetMemoryUsage() const override;
 
 private:
-  lzma_stream m_stream = LZMA_STREAM_INIT;
+  // Taken from a pool when decompressing starts, and returned to it when done
+  lzma_stream* m_stream = nullptr;
   lzma_options_lzma m_options = {};
   lzma_filter m_filters[2];
   bool m_started = false;
@@ -110,8 +118,10 @@ public:
 
   bool Decompress(const DecompressionBuffer& in, DecompressionBuffer* out,
                   size_t* in_bytes_read) override;
+  size_t GetMemoryUsage() const override;
 
 private:
+  // Taken from a pool, and returned to it when done
   ZSTD_DStream* m_stream;
 };
 
@@ -125,6 +135,7 @@ public:
                   size_t* in_bytes_read) override;
 
   bool Done() const override;
+  size_t GetMemoryUsage() const override;
 
 private:
   bool IncrementBytesRead(size_t x);
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <cstdarg>
 #include <cstdint>
 #include <cstdio>
@@ -15,9 +16,12 @@
 #include <map>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -36,16 +40,19 @@
 #include <unistd.h>
 #endif
 
-#include "Common/Buffer.h"
 #include "Common/CommonPaths.h"
+#include "Common/Event.h"
 #include "Common/FileUtil.h"
 #include "Common/GL/GLInterface/Libretro.h"
 #include "Common/HookableEvent.h"
+#include "Common/IOFile.h"
 #include "Common/IniFile.h"
 #include "Common/Logging/LogManager.h"
 #include "Common/MsgHandler.h"
 #include "Common/SocketContext.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
+#include "Common/TraversalClient.h"
 #include "Common/Version.h"
 #include "AudioCommon/LibretroSoundStream.h"
 #include "Core/ARDecrypt.h"
@@ -59,22 +66,36 @@
 #include "Core/Config/NetplaySettings.h"
 #include "Core/Config/WiimoteSettings.h"
 #include "Core/Core.h"
+#include "Core/CoreTiming.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/GeckoCodeConfig.h"
+#include "Core/HW/DVD/DVDInterface.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/Wiimote.h"
 #include "Core/Host.h"
 #include "Core/NetPlayClient.h"
 #include "Core/NetPlayServer.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/State.h"
 #include "Core/System.h"
 #include "Core/TitleDatabase.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/VolumeDisc.h"
 #include "UICommon/GameFile.h"
 #include "UICommon/NetPlayIndex.h"
 #include "UICommon/UICommon.h"
 #include "VideoBackends/OGL/VideoBackend.h"
+#include "VideoCommon/Present.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "InputCommon/LibretroInput.h"
 
+#ifdef HAS_VULKAN
+#include "VideoBackends/Vulkan/VKLibretro.h"
+#include "VideoBackends/Vulkan/VideoBackend.h"
+
+#include <libretro_vulkan.h>
+#endif
+
 namespace
 {
 retro_environment_t s_environment = nullptr;
@@ -98,11 +119,55 @@ retro_hw_render_callback s_hw_callback{};
 std::vector<retro_variable> s_core_options;
 std::vector<std::string> s_core_option_strings;
 
-Common::UniqueBuffer<u8> s_state_buffer;
+// Frontends doing runahead or rewind call retro_serialize_size() every frame, so the size is
+// measured once per boot and padded so that normal growth (FIFO, texture cache, queued events)
+// still fits. It is only re-measured when a state no longer fits in the reported size.
+constexpr size_t kStateSizeHeadroomBase = 1024 * 1024;
+constexpr size_t kStateSizeHeadroomDivisor = 16;
+size_t s_state_size_estimate = 0;
+
+// Whether retro_serialize may produce delta states (see State::SaveDeltaToSpan) when the frontend
+// reports that the state stays within this instance, as it does for single-instance runahead.
+bool s_delta_savestates = true;
+
+// Not a standard libretro memory type: frontends that know about it can read the Wii's MEM2 with
+// retro_get_memory_data(), just like MEM1 with RETRO_MEMORY_SYSTEM_RAM.
+constexpr unsigned kMemoryTypeMem2 = (1 << 8) | RETRO_MEMORY_SYSTEM_RAM;
+
+// The emulated RAM is only allocated once the emulation thread has initialized the memory
+// manager, so the memory map is sent from retro_run once that happened.
+bool s_memory_maps_set = false;
+
+// Whether the video thread renders into the core's own triple-buffered frames, which retro_run then
+// copies into the frontend's framebuffer, instead of rendering into that framebuffer directly.
+// Applied when the frontend (re)creates the hardware context.
+bool s_triple_buffer = true;
+
+// Whether the frontend paces the emulation: retro_run allows the CPU thread to emulate one field,
+// and Dolphin's throttle doesn't sleep on its own. Needs a frontend that accepted the frame time
+// callback, as that's one that calls retro_run at the rate it's meant to run at.
+bool s_frontend_pacing = true;
+bool s_frame_time_callback_set = false;
+// With frontend pacing, whether retro_run also waits until the field it allowed was emulated, as
+// if the CPU ran inside retro_run. Input is then consumed by exactly the frame it was polled for,
+// and states sit on exact field boundaries for runahead and rewind.
+bool s_synchronous_emulation = false;
+// How long retro_run waits for the field, in case the CPU thread was paused or is loading.
+constexpr auto kSynchronousFieldTimeout = std::chrono::milliseconds(100);
+
+#ifdef HAS_VULKAN
+// Whether the Vulkan backend renders on a device created for the frontend through context
+// negotiation. Selected when the hardware context is requested at load time.
+bool s_use_vulkan = false;
+const retro_hw_render_interface_vulkan* s_vulkan_interface = nullptr;
+#endif
 
 std::atomic<bool> s_pending_present{false};
 std::atomic<unsigned> s_present_width{0};
 std::atomic<unsigned> s_present_height{0};
+// Whether retro_run may hand the frontend no frame, for the fields that didn't complete one (e.g.
+// the ones the VI skip drops), so that it shows the last frame again.
+bool s_can_dupe = false;
 bool s_log_listener_registered = false;
 
 enum class CheatBackend
@@ -165,6 +230,7 @@ class LibretroNetPlayUI;
 std::unique_ptr<NetPlay::NetPlayClient> s_netplay_client;
 std::unique_ptr<NetPlay::NetPlayServer> s_netplay_server;
 std::unique_ptr<LibretroNetPlayUI> s_netplay_ui;
+u32 s_netplay_stats_sequence = 0;
 
 std::shared_ptr<const UICommon::GameFile> s_loaded_game_file;
 std::string s_loaded_game_path;
@@ -173,6 +239,47 @@ std::vector<NetPlaySession> s_netplay_rooms;
 std::unordered_map<std::string, size_t> s_netplay_room_value_map;
 std::mutex s_netplay_mutex;
 
+// The lobby is listed on its own thread so that retro_run never waits on the network. The rooms
+// it finds are put into s_netplay_rooms, and the core options are rebuilt from them by retro_run.
+std::thread s_lobby_thread;
+Common::Event s_lobby_event;
+std::atomic<bool> s_lobby_thread_exit{false};
+std::atomic<bool> s_lobby_refresh_requested{false};
+std::atomic<bool> s_lobby_rooms_updated{false};
+std::map<std::string, std::string> s_lobby_filters;  // Guarded by s_netplay_mutex.
+// Refreshes within this long of the last listing are answered from it.
+constexpr auto kLobbyListTtl = std::chrono::seconds(10);
+
+// The traversal server is connected to on its own thread as soon as the netplay options call for
+// it, so that hosting or joining doesn't wait for the handshake. The connection is kept alive until
+// a session takes it over, see StartNetPlaySession.
+struct TraversalPrewarmConfig
+{
+  std::string server;
+  u16 port = 0;
+  u16 port_alt = 0;
+  u16 listen_port = 0;
+
+  bool operator==(const TraversalPrewarmConfig&) const = default;
+};
+std::thread s_traversal_thread;
+Common::Event s_traversal_event;
+std::atomic<bool> s_traversal_thread_exit{false};
+std::optional<TraversalPrewarmConfig> s_traversal_config;
+// How long a connection that failed waits before it is tried again.
+constexpr auto kTraversalRetryDelay = std::chrono::seconds(5);
+
+// The host codes that traversal resolved, most recent first, along with where their host was.
+struct ResolvedHostCode
+{
+  std::string code;
+  std::string address;
+  u16 port = 0;
+};
+std::vector<ResolvedHostCode> s_resolved_host_codes;
+bool s_resolved_host_codes_loaded = false;
+constexpr size_t kMaxResolvedHostCodes = 8;
+
 NetPlay::SyncIdentifier s_netplay_selected_game{};
 std::string s_netplay_selected_game_name;
 
@@ -181,8 +288,25 @@ std::atomic<bool> s_netplay_start_requested{false};
 NetPlayOptionCache s_netplay_option_cache;
 std::optional<PendingBoot> s_pending_boot;
 
+// The value of every core option that was last applied, so that an update only applies the
+// options that changed.
+std::map<std::string, std::string, std::less<>> s_applied_core_options;
+// Changing options saves the config once they stopped changing for this long, instead of writing
+// the INI files in the middle of a frame for every change.
+constexpr auto kConfigSaveDelay = std::chrono::seconds(2);
+std::optional<std::chrono::steady_clock::time_point> s_config_save_time;
+
+// The discs of the loaded game for the disk control interface, in the order of its M3U file.
+// Images that the frontend added but didn't replace yet are empty.
+std::vector<std::string> s_disk_images;
+size_t s_disk_index = 0;
+bool s_disk_ejected = false;
+// The image the frontend wants the next game to start with, if it remembered one.
+std::optional<std::pair<unsigned, std::string>> s_disk_initial_image;
+
 constexpr unsigned kDummyWidth = 1;
 constexpr unsigned kDummyHeight = 1;
+constexpr double kFrameRate = 60.0;
 std::array<uint32_t, kDummyWidth * kDummyHeight> s_dummy_frame{};
 
 const char* GetCoreOptionValue(const char* key);
@@ -383,77 +507,108 @@ NetPlayMode GetNetPlayMode()
   return NetPlayMode::Disabled;
 }
 
-bool IsUdpPortAvailable(u16 port)
+// A UDP socket for probing which ports are free. A bind that fails leaves it unbound, so the same
+// socket is tried on the next port, and it is only replaced after a bind succeeded.
+class UdpPortProbe
 {
-  if (port == 0)
-    return false;
+public:
+  UdpPortProbe() = default;
+  UdpPortProbe(const UdpPortProbe&) = delete;
+  UdpPortProbe& operator=(const UdpPortProbe&) = delete;
+  ~UdpPortProbe() { Close(); }
 
-  Common::SocketContext socket_context;
-#if defined(_WIN32)
-  SOCKET sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-  if (sock == INVALID_SOCKET)
-    return false;
+  std::optional<bool> IsAvailable(u16 port)
+  {
+    if (!m_socket_valid && !Open())
+      return std::nullopt;
 
-  const BOOL exclusive = TRUE;
-  setsockopt(sock, SOL_SOCKET, SO_EXCLUSIVEADDRUSE,
-             reinterpret_cast<const char*>(&exclusive), sizeof(exclusive));
-
-  sockaddr_in addr{};
-  addr.sin_family = AF_INET;
-  addr.sin_addr.s_addr = htonl(INADDR_ANY);
-  addr.sin_port = htons(port);
-  const int result = bind(sock, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr));
-  closesocket(sock);
-  return result == 0;
-#else
-  const int sock = socket(AF_INET, SOCK_DGRAM, 0);
-  if (sock < 0)
-    return false;
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(m_socket, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0)
+      return false;
 
-  sockaddr_in addr{};
-  addr.sin_family = AF_INET;
-  addr.sin_addr.s_addr = htonl(INADDR_ANY);
-  addr.sin_port = htons(port);
-  const int result = bind(sock, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr));
-  close(sock);
-  return result == 0;
-#endif
-}
+    Close();
+    return true;
+  }
 
-std::optional<u16> FindAvailableUdpPort(u16 base_port, u16 range)
-{
-  if (base_port == 0)
-    return std::nullopt;
+private:
+  bool Open()
+  {
+#if defined(_WIN32)
+    m_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    m_socket_valid = m_socket != INVALID_SOCKET;
+    if (m_socket_valid)
+    {
+      const BOOL exclusive = TRUE;
+      setsockopt(m_socket, SOL_SOCKET, SO_EXCLUSIVEADDRUSE,
+                 reinterpret_cast<const char*>(&exclusive), sizeof(exclusive));
+    }
+#else
+    m_socket = socket(AF_INET, SOCK_DGRAM, 0);
+    m_socket_valid = m_socket >= 0;
+#endif
+    return m_socket_valid;
+  }
 
-  for (u16 offset = 0; offset <= range; ++offset)
+  void Close()
   {
-    const u16 port = static_cast<u16>(base_port + offset);
-    if (port < base_port)
-      break;
-    if (IsUdpPortAvailable(port))
-      return port;
+    if (!m_socket_valid)
+      return;
+#if defined(_WIN32)
+    closesocket(m_socket);
+#else
+    close(m_socket);
+#endif
+    m_socket_valid = false;
   }
 
-  return std::nullopt;
-}
+  Common::SocketContext m_socket_context;
+#if defined(_WIN32)
+  SOCKET m_socket = INVALID_SOCKET;
+#else
+  int m_socket = -1;
+#endif
+  bool m_socket_valid = false;
+};
 
-std::optional<u16> FindInUseUdpPort(u16 base_port, u16 range)
+// Returns the first port from base_port on, at most range ports further, that is free (or taken,
+// if available is false).
+std::optional<u16> FindUdpPort(u16 base_port, u16 range, bool available)
 {
   if (base_port == 0)
     return std::nullopt;
 
+  UdpPortProbe probe;
   for (u16 offset = 0; offset <= range; ++offset)
   {
     const u16 port = static_cast<u16>(base_port + offset);
     if (port < base_port)
       break;
-    if (!IsUdpPortAvailable(port))
+
+    const std::optional<bool> is_available = probe.IsAvailable(port);
+    if (!is_available)
+      return std::nullopt;
+    if (*is_available == available)
       return port;
   }
 
   return std::nullopt;
 }
 
+// The port the LAN auto port picked, which ApplyNetPlayOptions keeps as long as neither the LAN
+// mode nor the host port core option change. Otherwise the probe would run on every option
+// change, and find the port taken once our own host listens on it. A port of 0 lets the host pick
+// one.
+struct LanAutoPort
+{
+  NetPlayLanMode mode;
+  u16 base_port;
+  u16 port;
+};
+std::optional<LanAutoPort> s_lan_auto_port;
+
 NetPlayConnection GetNetPlayConnection()
 {
   if (GetNetPlayLanMode() != NetPlayLanMode::Disabled)
@@ -508,6 +663,65 @@ void AddUniqueValue(std::vector<std::string>& values, std::string value)
     values.push_back(std::move(value));
 }
 
+std::string GetResolvedHostCodesPath()
+{
+  return File::GetUserPath(D_CACHE_IDX) + "NetPlayHostCodes.txt";
+}
+
+// Each line of the file is a host code, an address and a port, separated by tabs.
+const std::vector<ResolvedHostCode>& GetResolvedHostCodes()
+{
+  if (s_resolved_host_codes_loaded)
+    return s_resolved_host_codes;
+  s_resolved_host_codes_loaded = true;
+
+  std::string contents;
+  if (!File::ReadFileToString(GetResolvedHostCodesPath(), contents))
+    return s_resolved_host_codes;
+
+  for (const std::string& line : SplitString(contents, '\n'))
+  {
+    const std::vector<std::string> fields = SplitString(line, '\t');
+    u16 port = 0;
+    if (fields.size() != 3 || fields[0].empty() || fields[1].empty() || !TryParse(fields[2], &port))
+      continue;
+
+    s_resolved_host_codes.push_back(ResolvedHostCode{fields[0], fields[1], port});
+    if (s_resolved_host_codes.size() == kMaxResolvedHostCodes)
+      break;
+  }
+
+  return s_resolved_host_codes;
+}
+
+const ResolvedHostCode* FindResolvedHostCode(std::string_view code)
+{
+  const std::vector<ResolvedHostCode>& codes = GetResolvedHostCodes();
+  const auto it = std::find_if(codes.begin(), codes.end(), [code](const ResolvedHostCode& entry) {
+    return entry.code == code;
+  });
+  return it != codes.end() ? &*it : nullptr;
+}
+
+void RememberResolvedHostCode(const std::string& code, std::string address, u16 port)
+{
+  GetResolvedHostCodes();
+  std::erase_if(s_resolved_host_codes,
+                [&code](const ResolvedHostCode& entry) { return entry.code == code; });
+  s_resolved_host_codes.insert(s_resolved_host_codes.begin(),
+                               ResolvedHostCode{code, std::move(address), port});
+  if (s_resolved_host_codes.size() > kMaxResolvedHostCodes)
+    s_resolved_host_codes.resize(kMaxResolvedHostCodes);
+
+  std::string contents;
+  for (const ResolvedHostCode& entry : s_resolved_host_codes)
+    contents += entry.code + '\t' + entry.address + '\t' + std::to_string(entry.port) + '\n';
+
+  const std::string path = GetResolvedHostCodesPath();
+  if (!File::CreateFullPath(path) || !File::WriteStringToFile(path, contents))
+    LogMessage(RETRO_LOG_WARN, "NetPlay failed to save host codes to %s\n", path.c_str());
+}
+
 std::vector<std::string> BuildNetPlayAddressValues()
 {
   std::vector<std::string> values;
@@ -526,6 +740,8 @@ std::vector<std::string> BuildNetPlayHostCodeValues()
   std::vector<std::string> values;
   AddUniqueValue(values,
                  SanitizeCoreOptionValue(Config::Get(Config::NETPLAY_HOST_CODE)));
+  for (const ResolvedHostCode& entry : GetResolvedHostCodes())
+    AddUniqueValue(values, SanitizeCoreOptionValue(entry.code));
   AddUniqueValue(values, "00000000");
   return values;
 }
@@ -824,6 +1040,24 @@ void SetUserDirectoryFromEnvironment()
     user_dir += "-LANJoin";
 
   UICommon::SetUserDirectory(user_dir);
+
+  // The shader, pipeline and texture caches don't depend on the save directory or on the LAN
+  // mode, so they can be built once for every frontend configuration and Dolphin based core.
+  // The caches lock their files, so that only one running instance writes to each of them.
+  const char* system_dir = nullptr;
+  const char* shared_cache = GetCoreOptionValue("dolphin_shared_cache");
+  if (shared_cache && std::string_view(shared_cache) == "enabled" && s_environment &&
+      s_environment(RETRO_ENVIRONMENT_GET_SYSTEM_DIRECTORY, &system_dir) && system_dir &&
+      system_dir[0])
+  {
+    std::string cache_dir = system_dir;
+    if (cache_dir.back() == DIR_SEP_CHR)
+      cache_dir.pop_back();
+    cache_dir += DIR_SEP "Dolphin" DIR_SEP CACHE_DIR DIR_SEP;
+    LogMessage(RETRO_LOG_INFO, "Using shared Cache directory: %s\n", cache_dir.c_str());
+    File::SetUserPath(D_CACHE_IDX, std::move(cache_dir));
+  }
+
   UICommon::CreateDirectories();
 }
 
@@ -864,14 +1098,359 @@ void SetSystemDirectoryFromEnvironment()
   File::SetSysDirectory(std::move(base_dir));
 }
 
+void InvalidateStateSizeEstimate()
+{
+  s_state_size_estimate = 0;
+  State::ResetDeltaBase();
+}
+
+size_t GetStateSizeEstimate()
+{
+  if (s_state_size_estimate == 0)
+  {
+    const size_t measured = State::MeasureStateSize(Core::System::GetInstance());
+    s_state_size_estimate =
+        measured + measured / kStateSizeHeadroomDivisor + kStateSizeHeadroomBase;
+  }
+
+  return s_state_size_estimate;
+}
+
+bool UseDeltaSavestates()
+{
+  if (!s_delta_savestates || !s_environment)
+    return false;
+
+  retro_savestate_context context = RETRO_SAVESTATE_CONTEXT_NORMAL;
+  if (!s_environment(RETRO_ENVIRONMENT_GET_SAVESTATE_CONTEXT, &context))
+    return false;
+
+  return context == RETRO_SAVESTATE_CONTEXT_RUNAHEAD_SAME_INSTANCE;
+}
+
+// With block profiling enabled, the profile of the session is written when the game is stopped,
+// since there is no menu to ask for it from.
+void WriteJitBlockProfileDump(Core::System& system)
+{
+  if (!Config::Get(Config::MAIN_DEBUG_JIT_ENABLE_PROFILING))
+    return;
+
+  const std::string filename = File::GetUserPath(D_DUMPDEBUG_JITBLOCKS_IDX) +
+                               SConfig::GetInstance().GetGameID() + ".folded";
+  File::IOFile f(filename, "w");
+  if (!f)
+  {
+    LogMessage(RETRO_LOG_WARN, "Failed to open %s for writing\n", filename.c_str());
+    return;
+  }
+  if (system.GetJitInterface().JitBlockProfileDump(Core::CPUThreadGuard{system}, f.GetHandle()) ==
+      0)
+  {
+    f.Close();
+    File::Delete(filename);
+    LogMessage(RETRO_LOG_WARN, "No JIT block was profiled, not writing %s\n", filename.c_str());
+    return;
+  }
+  LogMessage(RETRO_LOG_INFO, "Wrote JIT block profile to %s\n", filename.c_str());
+}
+
+void UpdateHostPacing()
+{
+  Core::System::GetInstance().GetCoreTiming().SetHostPacing(s_frontend_pacing &&
+                                                            s_frame_time_callback_set);
+}
+
+void SetupFrameTimeCallback()
+{
+  // One field is emulated per retro_run whatever time the frontend reports, so that frame
+  // stepping, slow motion and fast forwarding in the frontend all work on exact fields. The
+  // callback only tells the frontend that the core relies on its pacing.
+  retro_frame_time_callback frame_time{};
+  frame_time.callback = [](retro_usec_t) {};
+  frame_time.reference = static_cast<retro_usec_t>(1000000 / kFrameRate);
+  s_frame_time_callback_set =
+      s_environment && s_environment(RETRO_ENVIRONMENT_SET_FRAME_TIME_CALLBACK, &frame_time);
+  UpdateHostPacing();
+}
+
 void StopCore()
 {
+  InvalidateStateSizeEstimate();
+  s_memory_maps_set = false;
   auto& system = Core::System::GetInstance();
   if (!Core::IsUninitialized(system))
+  {
+    WriteJitBlockProfileDump(system);
     Core::Stop(system);
+  }
   Core::Shutdown(system);
 }
 
+void SetupDiskImages(BootParameters& boot)
+{
+  s_disk_images.clear();
+  s_disk_index = 0;
+  s_disk_ejected = false;
+  const std::optional<std::pair<unsigned, std::string>> initial_image =
+      std::exchange(s_disk_initial_image, std::nullopt);
+
+  auto* disc = std::get_if<BootParameters::Disc>(&boot.parameters);
+  if (!disc)
+    return;
+
+  std::vector<std::string>& paths = disc->auto_disc_change_paths;
+  s_disk_images = paths.empty() ? std::vector<std::string>{disc->path} : paths;
+
+  // The list of paths to change between is circular, so starting at a later disc only rotates it
+  if (!initial_image || initial_image->first == 0 ||
+      initial_image->first >= s_disk_images.size() ||
+      s_disk_images[initial_image->first] != initial_image->second)
+  {
+    return;
+  }
+  std::unique_ptr<DiscIO::VolumeDisc> volume = DiscIO::CreateDiscForCore(initial_image->second);
+  if (!volume)
+    return;
+
+  disc->path = initial_image->second;
+  disc->volume = std::move(volume);
+  std::ranges::rotate(paths, paths.begin() + initial_image->first);
+  s_disk_index = initial_image->first;
+}
+
+bool CanChangeDisc()
+{
+  if (!s_game_loaded || s_disk_images.empty() || !Core::IsRunning(Core::System::GetInstance()))
+    return false;
+
+  // The other players would keep the disc that is inserted
+  if (s_netplay_client)
+  {
+    LogMessage(RETRO_LOG_WARN, "Discs can't be changed during NetPlay\n");
+    return false;
+  }
+
+  return true;
+}
+
+bool SetDiskEjectState(bool ejected)
+{
+  if (ejected == s_disk_ejected)
+    return true;
+  if (!CanChangeDisc())
+    return false;
+
+  // Ejecting keeps the disc open in DVDInterface, so inserting it again doesn't reopen it
+  auto& system = Core::System::GetInstance();
+  auto& dvd_interface = system.GetDVDInterface();
+  const Core::CPUThreadGuard guard(system);
+  if (ejected)
+    dvd_interface.EjectDisc(guard, DVD::EjectCause::User);
+  else if (s_disk_index < s_disk_images.size() && !s_disk_images[s_disk_index].empty())
+    dvd_interface.ChangeDisc(guard, s_disk_images[s_disk_index]);
+
+  s_disk_ejected = ejected;
+  return true;
+}
+
+bool GetDiskEjectState()
+{
+  return s_disk_ejected;
+}
+
+unsigned GetDiskImageIndex()
+{
+  return static_cast<unsigned>(s_disk_index);
+}
+
+bool SetDiskImageIndex(unsigned index)
+{
+  // An index past the last image means that no disc is inserted when the tray closes
+  if (index > s_disk_images.size() || (!s_disk_ejected && index != s_disk_index))
+    return false;
+
+  s_disk_index = index;
+  return true;
+}
+
+unsigned GetDiskImageCount()
+{
+  return static_cast<unsigned>(s_disk_images.size());
+}
+
+bool ReplaceDiskImage(unsigned index, const retro_game_info* info)
+{
+  if (index >= s_disk_images.size() || (!s_disk_ejected && index == s_disk_index))
+    return false;
+
+  if (info && info->path)
+  {
+    s_disk_images[index] = info->path;
+    return true;
+  }
+
+  s_disk_images.erase(s_disk_images.begin() + index);
+  if (s_disk_index > index)
+    --s_disk_index;
+  return true;
+}
+
+bool AddDiskImage()
+{
+  s_disk_images.emplace_back();
+  return true;
+}
+
+bool SetDiskInitialImage(unsigned index, const char* path)
+{
+  if (!path || !*path)
+    return false;
+
+  s_disk_initial_image.emplace(index, path);
+  return true;
+}
+
+bool CopyDiskImageString(unsigned index, char* s, size_t len, bool label)
+{
+  if (index >= s_disk_images.size() || s_disk_images[index].empty() || !s || len == 0)
+    return false;
+
+  std::string value = s_disk_images[index];
+  if (label)
+    SplitPath(s_disk_images[index], nullptr, &value, nullptr);
+  strncpy(s, value.c_str(), len - 1);
+  s[len - 1] = '\0';
+  return true;
+}
+
+void SetupDiskControlInterface()
+{
+  unsigned version = 0;
+  if (s_environment(RETRO_ENVIRONMENT_GET_DISK_CONTROL_INTERFACE_VERSION, &version) &&
+      version >= 1)
+  {
+    retro_disk_control_ext_callback disk_control{};
+    disk_control.set_eject_state = SetDiskEjectState;
+    disk_control.get_eject_state = GetDiskEjectState;
+    disk_control.get_image_index = GetDiskImageIndex;
+    disk_control.set_image_index = SetDiskImageIndex;
+    disk_control.get_num_images = GetDiskImageCount;
+    disk_control.replace_image_index = ReplaceDiskImage;
+    disk_control.add_image_index = AddDiskImage;
+    disk_control.set_initial_image = SetDiskInitialImage;
+    disk_control.get_image_path = [](unsigned index, char* s, size_t len) {
+      return CopyDiskImageString(index, s, len, false);
+    };
+    disk_control.get_image_label = [](unsigned index, char* s, size_t len) {
+      return CopyDiskImageString(index, s, len, true);
+    };
+    s_environment(RETRO_ENVIRONMENT_SET_DISK_CONTROL_EXT_INTERFACE, &disk_control);
+    return;
+  }
+
+  retro_disk_control_callback disk_control{};
+  disk_control.set_eject_state = SetDiskEjectState;
+  disk_control.get_eject_state = GetDiskEjectState;
+  disk_control.get_image_index = GetDiskImageIndex;
+  disk_control.set_image_index = SetDiskImageIndex;
+  disk_control.get_num_images = GetDiskImageCount;
+  disk_control.replace_image_index = ReplaceDiskImage;
+  disk_control.add_image_index = AddDiskImage;
+  s_environment(RETRO_ENVIRONMENT_SET_DISK_CONTROL_INTERFACE, &disk_control);
+}
+
+// Returns the host view of the given RAM region, or an empty span while it isn't allocated.
+std::span<u8> GetMemoryRegion(unsigned id)
+{
+  auto& memory = Core::System::GetInstance().GetMemory();
+  if (!s_game_loaded || !memory.IsInitialized())
+    return {};
+
+  switch (id)
+  {
+  case RETRO_MEMORY_SYSTEM_RAM:
+    return {memory.GetRAM(), memory.GetRamSizeReal()};
+  case kMemoryTypeMem2:
+    if (!memory.GetEXRAM())
+      return {};
+    return {memory.GetEXRAM(), memory.GetExRamSizeReal()};
+  default:
+    return {};
+  }
+}
+
+// Describes MEM1 and MEM2 at their cached physical addresses, the way achievement and cheat tools
+// address them. The RAM is kept in the console's big-endian byte order.
+void UpdateMemoryMaps()
+{
+  if (s_memory_maps_set || !s_environment)
+    return;
+
+  const std::span<u8> mem1 = GetMemoryRegion(RETRO_MEMORY_SYSTEM_RAM);
+  if (mem1.empty())
+    return;
+
+  std::array<retro_memory_descriptor, 2> descriptors{};
+  unsigned num_descriptors = 0;
+  descriptors[num_descriptors].flags = RETRO_MEMDESC_SYSTEM_RAM | RETRO_MEMDESC_BIGENDIAN;
+  descriptors[num_descriptors].ptr = mem1.data();
+  descriptors[num_descriptors].start = 0x80000000;
+  descriptors[num_descriptors].len = mem1.size();
+  ++num_descriptors;
+
+  const std::span<u8> mem2 = GetMemoryRegion(kMemoryTypeMem2);
+  if (!mem2.empty())
+  {
+    descriptors[num_descriptors].flags = RETRO_MEMDESC_SYSTEM_RAM | RETRO_MEMDESC_BIGENDIAN;
+    descriptors[num_descriptors].ptr = mem2.data();
+    descriptors[num_descriptors].start = 0x90000000;
+    descriptors[num_descriptors].len = mem2.size();
+    ++num_descriptors;
+  }
+
+  retro_memory_map map{descriptors.data(), num_descriptors};
+  s_environment(RETRO_ENVIRONMENT_SET_MEMORY_MAPS, &map);
+  s_memory_maps_set = true;
+}
+
+// The OSD isn't drawn into the frames the frontend gets, so the stats are shown as a frontend
+// message whenever the client has new ones.
+void ShowNetPlayStats()
+{
+  if (!s_netplay_client || !s_environment || !Config::Get(Config::GFX_SHOW_NETPLAY_STATS))
+    return;
+
+  const NetPlay::ConnectionStats stats = s_netplay_client->GetConnectionStats();
+  if (stats.sequence == s_netplay_stats_sequence)
+    return;
+  s_netplay_stats_sequence = stats.sequence;
+
+  const std::string text = NetPlay::FormatConnectionStats(stats, " | ");
+  retro_message_ext message{};
+  message.msg = text.c_str();
+  message.duration = 1500;
+  message.level = RETRO_LOG_INFO;
+  message.target = RETRO_MESSAGE_TARGET_OSD;
+  message.type = RETRO_MESSAGE_TYPE_STATUS;
+  message.progress = -1;
+  s_environment(RETRO_ENVIRONMENT_SET_MESSAGE_EXT, &message);
+}
+
+// When the frontend runs ahead it disables video and audio for the frames it throws away, so skip
+// presenting and mixing them. Presentation follows from the next field the emulation thread
+// starts, and the frame paced audio drain from this frame's samples.
+void UpdateSpeculativeFrame()
+{
+  int av_enable = 3;
+  if (!s_environment || !s_environment(RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE, &av_enable))
+    av_enable = 3;
+
+  // Frames that rollback NetPlay emulates again were already shown once.
+  const bool resimulating = s_netplay_client && s_netplay_client->IsRollbackResimulating();
+  VideoCommon::SetPresentationSuppressed(!(av_enable & 1) || resimulating);
+  AudioCommon::SetLibretroAudioSuppressed(!(av_enable & 2) || resimulating);
+}
+
 void PresentFrame(unsigned width, unsigned height)
 {
   s_present_width.store(width);
@@ -891,6 +1470,7 @@ void UpdateLibretroGLCallbacks()
   callbacks.base_height = 528;
   callbacks.is_gles = (s_hw_callback.context_type == RETRO_HW_CONTEXT_OPENGLES2 ||
                        s_hw_callback.context_type == RETRO_HW_CONTEXT_OPENGLES3);
+  callbacks.triple_buffer = s_triple_buffer;
 #if defined(_WIN32)
   callbacks.native_display = wglGetCurrentDC();
   callbacks.native_context = wglGetCurrentContext();
@@ -902,8 +1482,125 @@ void UpdateLibretroGLCallbacks()
   LibretroSetGLCallbacks(callbacks);
 }
 
+#ifdef HAS_VULKAN
+const VkApplicationInfo* GetVulkanApplicationInfo()
+{
+  static const VkApplicationInfo app_info{VK_STRUCTURE_TYPE_APPLICATION_INFO,
+                                          nullptr,
+                                          "Dolphin Emulator",
+                                          VK_MAKE_VERSION(5, 0, 0),
+                                          "Dolphin Emulator",
+                                          VK_MAKE_VERSION(5, 0, 0),
+                                          VK_API_VERSION_1_0};
+  return &app_info;
+}
+
+bool CreateVulkanDevice(retro_vulkan_context* context, VkInstance instance, VkPhysicalDevice gpu,
+                        VkSurfaceKHR surface, PFN_vkGetInstanceProcAddr get_instance_proc_addr,
+                        const char** required_device_extensions,
+                        unsigned num_required_device_extensions, const char**, unsigned,
+                        const VkPhysicalDeviceFeatures* required_features)
+{
+  Vulkan::Libretro::CreatedDevice device{};
+  if (!Vulkan::Libretro::CreateDevice(
+          instance, gpu, surface, get_instance_proc_addr,
+          std::span<const char* const>(required_device_extensions, num_required_device_extensions),
+          required_features, &device))
+  {
+    LogMessage(RETRO_LOG_ERROR, "Failed to create a Vulkan device for the frontend.\n");
+    return false;
+  }
+
+  context->gpu = device.gpu;
+  context->device = device.device;
+  context->queue = device.queue;
+  context->queue_family_index = device.queue_family_index;
+  context->presentation_queue = device.present_queue;
+  context->presentation_queue_family_index = device.present_queue_family_index;
+  return true;
+}
+
+void DestroyVulkanDevice()
+{
+  Vulkan::Libretro::DestroyDevice();
+}
+
+const retro_hw_render_context_negotiation_interface_vulkan s_vulkan_negotiation{
+    RETRO_HW_RENDER_CONTEXT_NEGOTIATION_INTERFACE_VULKAN,
+    RETRO_HW_RENDER_CONTEXT_NEGOTIATION_INTERFACE_VULKAN_VERSION, GetVulkanApplicationInfo,
+    CreateVulkanDevice, DestroyVulkanDevice};
+
+void LockVulkanQueue(void*)
+{
+  if (s_vulkan_interface && s_vulkan_interface->lock_queue)
+    s_vulkan_interface->lock_queue(s_vulkan_interface->handle);
+}
+
+void UnlockVulkanQueue(void*)
+{
+  if (s_vulkan_interface && s_vulkan_interface->unlock_queue)
+    s_vulkan_interface->unlock_queue(s_vulkan_interface->handle);
+}
+
+bool SetupVulkanInterface()
+{
+  const retro_hw_render_interface* hw_interface = nullptr;
+  if (!s_environment(RETRO_ENVIRONMENT_GET_HW_RENDER_INTERFACE, &hw_interface) || !hw_interface ||
+      hw_interface->interface_type != RETRO_HW_RENDER_INTERFACE_VULKAN ||
+      hw_interface->interface_version != RETRO_HW_RENDER_INTERFACE_VULKAN_VERSION)
+  {
+    LogMessage(RETRO_LOG_ERROR, "Frontend did not provide a usable Vulkan render interface.\n");
+    return false;
+  }
+
+  // Frontends that don't support context negotiation create the device themselves, without the
+  // extensions and features the backend needs.
+  if (!Vulkan::Libretro::IsActive())
+  {
+    LogMessage(RETRO_LOG_ERROR, "Frontend did not create the Vulkan device through the core.\n");
+    return false;
+  }
+
+  s_vulkan_interface = reinterpret_cast<const retro_hw_render_interface_vulkan*>(hw_interface);
+
+  Vulkan::Libretro::HostCallbacks callbacks;
+  callbacks.handle = s_vulkan_interface->handle;
+  callbacks.lock_queue = LockVulkanQueue;
+  callbacks.unlock_queue = UnlockVulkanQueue;
+  callbacks.base_width = 640;
+  callbacks.base_height = 528;
+  Vulkan::Libretro::SetHostCallbacks(callbacks);
+  return true;
+}
+
+// Hands the newest frame the video thread completed to the frontend, which samples it directly.
+// Returns false if there is none.
+bool PresentVulkanFrame()
+{
+  Vulkan::Libretro::PresentedFrame frame;
+  if (!s_vulkan_interface || !Vulkan::Libretro::TakeFrontFrame(&frame))
+    return false;
+
+  const retro_vulkan_image image{frame.view, frame.layout, frame.view_info};
+  s_vulkan_interface->set_image(s_vulkan_interface->handle, &image, 0, nullptr,
+                                VK_QUEUE_FAMILY_IGNORED);
+  s_video_refresh(RETRO_HW_FRAME_BUFFER_VALID, frame.width, frame.height, 0);
+  s_present_width.store(frame.width);
+  s_present_height.store(frame.height);
+  return true;
+}
+#endif
+
 void OnHWContextReset()
 {
+#ifdef HAS_VULKAN
+  if (s_use_vulkan)
+  {
+    if (SetupVulkanInterface())
+      s_hw_context_ready.store(true);
+    return;
+  }
+#endif
   s_hw_context_ready.store(true);
   UpdateLibretroGLCallbacks();
 }
@@ -911,6 +1608,15 @@ void OnHWContextReset()
 void OnHWContextDestroy()
 {
   s_hw_context_ready.store(false);
+#ifdef HAS_VULKAN
+  if (s_use_vulkan)
+  {
+    s_vulkan_interface = nullptr;
+    Vulkan::Libretro::ReleaseDevice();
+    return;
+  }
+#endif
+  LibretroReleaseQueuedFrames();
   LibretroSetGLCallbacks(LibretroGLCallbacks{});
 }
 
@@ -920,6 +1626,36 @@ bool SetupHardwareRendering()
     return false;
 
   s_hw_context_ready.store(false);
+
+#ifdef HAS_VULKAN
+  const char* gfx_backend = GetCoreOptionValue("dolphin_gfx_backend");
+  s_use_vulkan = gfx_backend && std::string_view(gfx_backend) == "Vulkan";
+  if (s_use_vulkan)
+  {
+    s_hw_callback = {};
+    s_hw_callback.context_type = RETRO_HW_CONTEXT_VULKAN;
+    s_hw_callback.context_reset = OnHWContextReset;
+    s_hw_callback.context_destroy = OnHWContextDestroy;
+    s_hw_callback.version_major = VK_API_VERSION_1_0;
+    s_hw_callback.version_minor = 0;
+    if (s_environment(RETRO_ENVIRONMENT_SET_HW_RENDER, &s_hw_callback) &&
+        s_environment(RETRO_ENVIRONMENT_SET_HW_RENDER_CONTEXT_NEGOTIATION_INTERFACE,
+                      const_cast<retro_hw_render_context_negotiation_interface_vulkan*>(
+                          &s_vulkan_negotiation)))
+    {
+      Config::SetBaseOrCurrent(Config::MAIN_GFX_BACKEND, Vulkan::VideoBackend::CONFIG_NAME);
+      VideoBackendBase::ActivateBackend(Config::Get(Config::MAIN_GFX_BACKEND));
+      return true;
+    }
+
+    LogMessage(RETRO_LOG_WARN, "Frontend does not support Vulkan context negotiation, "
+                               "falling back to OpenGL.\n");
+    s_use_vulkan = false;
+  }
+  Config::SetBaseOrCurrent(Config::MAIN_GFX_BACKEND, OGL::VideoBackend::CONFIG_NAME);
+  VideoBackendBase::ActivateBackend(Config::Get(Config::MAIN_GFX_BACKEND));
+#endif
+
   bool shared_context = true;
   s_environment(RETRO_ENVIRONMENT_SET_HW_SHARED_CONTEXT, &shared_context);
 
@@ -958,12 +1694,17 @@ bool BootGameInternal(std::string path, std::optional<BootSessionData> session,
     return false;
   }
 
+  SetupDiskImages(*boot);
+
   auto& system = Core::System::GetInstance();
   if (!s_state_hook)
   {
     s_state_hook = Core::AddOnStateChangedCallback([](Core::State state) {
       if (state == Core::State::Uninitialized)
+      {
         s_game_loaded = false;
+        InvalidateStateSizeEstimate();
+      }
     });
   }
 
@@ -975,6 +1716,7 @@ bool BootGameInternal(std::string path, std::optional<BootSessionData> session,
   }
 
   s_game_loaded = true;
+  InvalidateStateSizeEstimate();
   ApplyCheats();
   return true;
 }
@@ -1063,11 +1805,13 @@ void BuildEarlyCoreOptions()
   s_core_options.clear();
   s_core_option_strings.clear();
 
-  s_core_options.reserve(2);
-  s_core_option_strings.reserve(1);
+  s_core_options.reserve(3);
+  s_core_option_strings.reserve(2);
 
   AddCoreOption("dolphin_netplay_lan_mode", "NetPlay LAN mode (localhost)",
                 {"disabled", "host", "join"}, "disabled");
+  AddCoreOption("dolphin_shared_cache", "Share caches through the system directory (restart)",
+                {"disabled", "enabled"}, "disabled");
 
   s_core_options.push_back({nullptr, nullptr});
   s_environment(RETRO_ENVIRONMENT_SET_VARIABLES, s_core_options.data());
@@ -1081,7 +1825,7 @@ void BuildCoreOptions(bool use_current_values = false)
   s_core_options.clear();
   s_core_option_strings.clear();
 
-  constexpr size_t option_count = 43;
+  constexpr size_t option_count = 60;
   s_core_options.reserve(option_count + 1);
   s_core_option_strings.reserve(option_count);
 
@@ -1118,6 +1862,33 @@ void BuildCoreOptions(bool use_current_values = false)
                 GetOptionDefault("dolphin_savestates",
                                  GetEnabledDisabled(Config::Get(Config::MAIN_ENABLE_SAVESTATES)),
                                  use_current_values));
+  AddCoreOption("dolphin_delta_savestates", "Delta savestates for runahead",
+                {"enabled", "disabled"},
+                GetOptionDefault("dolphin_delta_savestates", "enabled", use_current_values));
+  AddCoreOption("dolphin_triple_buffer", "Triple-buffered frame pacing (restart)",
+                {"enabled", "disabled"},
+                GetOptionDefault("dolphin_triple_buffer", "enabled", use_current_values));
+  AddCoreOption("dolphin_frame_paced_audio", "Output audio from retro_run (restart)",
+                {"enabled", "disabled"},
+                GetOptionDefault("dolphin_frame_paced_audio", "enabled", use_current_values));
+  AddCoreOption("dolphin_frontend_pacing", "Let the frontend pace emulation",
+                {"enabled", "disabled"},
+                GetOptionDefault("dolphin_frontend_pacing", "enabled", use_current_values));
+  AddCoreOption("dolphin_synchronous_emulation", "Emulate each frame within retro_run",
+                {"disabled", "enabled"},
+                GetOptionDefault("dolphin_synchronous_emulation", "disabled", use_current_values));
+  AddCoreOption("dolphin_shared_cache", "Share caches through the system directory (restart)",
+                {"disabled", "enabled"},
+                GetOptionDefault("dolphin_shared_cache", "disabled", use_current_values));
+  AddCoreOption(
+      "dolphin_jit_profiling", "JIT block profiling (written on stop)", {"disabled", "enabled"},
+      GetOptionDefault("dolphin_jit_profiling",
+                       GetEnabledDisabled(Config::Get(Config::MAIN_DEBUG_JIT_ENABLE_PROFILING)),
+                       use_current_values));
+#ifdef HAS_VULKAN
+  AddCoreOption("dolphin_gfx_backend", "Graphics backend (restart)", {"OpenGL", "Vulkan"},
+                GetOptionDefault("dolphin_gfx_backend", "OpenGL", use_current_values));
+#endif
   AddCoreOption("dolphin_wiimote_speaker", "Wiimote speaker", {"disabled", "enabled"},
                 GetOptionDefault(
                     "dolphin_wiimote_speaker",
@@ -1224,6 +1995,54 @@ void BuildCoreOptions(bool use_current_values = false)
                 GetOptionDefault("dolphin_netplay_buffer_size",
                                  std::to_string(Config::Get(Config::NETPLAY_BUFFER_SIZE)),
                                  use_current_values));
+  AddCoreOption("dolphin_netplay_auto_buffer", "NetPlay automatic buffer size (host)",
+                {"disabled", "enabled"},
+                GetOptionDefault("dolphin_netplay_auto_buffer",
+                                 GetEnabledDisabled(Config::Get(Config::NETPLAY_AUTO_BUFFER)),
+                                 use_current_values));
+  AddCoreOption("dolphin_netplay_redundant_inputs", "NetPlay redundant unreliable inputs (host)",
+                {"disabled", "enabled"},
+                GetOptionDefault(
+                    "dolphin_netplay_redundant_inputs",
+                    GetEnabledDisabled(Config::Get(Config::NETPLAY_REDUNDANT_PAD_DATA)),
+                    use_current_values));
+  AddCoreOption("dolphin_netplay_state_fingerprints", "NetPlay state desync checks (host)",
+                {"disabled", "enabled"},
+                GetOptionDefault(
+                    "dolphin_netplay_state_fingerprints",
+                    GetEnabledDisabled(Config::Get(Config::NETPLAY_STATE_FINGERPRINTS)),
+                    use_current_values));
+  AddCoreOption("dolphin_netplay_delayed_spectators", "NetPlay delayed spectators (host)",
+                {"disabled", "enabled"},
+                GetOptionDefault(
+                    "dolphin_netplay_delayed_spectators",
+                    GetEnabledDisabled(Config::Get(Config::NETPLAY_DELAYED_SPECTATORS)),
+                    use_current_values));
+  AddCoreOption("dolphin_netplay_spectator_delay", "NetPlay spectator delay in frames (host)",
+                {"0", "60", "180", "300", "600"},
+                GetOptionDefault("dolphin_netplay_spectator_delay",
+                                 std::to_string(Config::Get(Config::NETPLAY_SPECTATOR_DELAY)),
+                                 use_current_values));
+  AddCoreOption("dolphin_netplay_rollback", "NetPlay rollback, predicting remote input (host)",
+                {"disabled", "enabled"},
+                GetOptionDefault("dolphin_netplay_rollback",
+                                 GetEnabledDisabled(Config::Get(Config::NETPLAY_ROLLBACK)),
+                                 use_current_values));
+  AddCoreOption("dolphin_netplay_late_join", "NetPlay allow joining a running game (host)",
+                {"disabled", "enabled"},
+                GetOptionDefault("dolphin_netplay_late_join",
+                                 GetEnabledDisabled(Config::Get(Config::NETPLAY_ALLOW_LATE_JOIN)),
+                                 use_current_values));
+  AddCoreOption("dolphin_netplay_show_stats", "NetPlay show connection stats",
+                {"disabled", "enabled"},
+                GetOptionDefault("dolphin_netplay_show_stats",
+                                 GetEnabledDisabled(Config::Get(Config::GFX_SHOW_NETPLAY_STATS)),
+                                 use_current_values));
+  AddCoreOption("dolphin_netplay_wiimote_batch", "NetPlay Wii Remote polls per packet",
+                {"1", "2", "3", "4"},
+                GetOptionDefault("dolphin_netplay_wiimote_batch",
+                                 std::to_string(Config::Get(Config::NETPLAY_WIIMOTE_BATCH_SIZE)),
+                                 use_current_values));
   AddCoreOption("dolphin_netplay_client_buffer_size", "NetPlay client buffer size",
                 {"1", "2", "3", "4", "5"},
                 GetOptionDefault("dolphin_netplay_client_buffer_size",
@@ -1292,6 +2111,45 @@ const char* GetCoreOptionValue(const char* key)
   return var.value;
 }
 
+// Returns the value of the option if it changed since the last call for it, and nullptr otherwise.
+const char* TakeChangedCoreOptionValue(const char* key)
+{
+  const char* value = GetCoreOptionValue(key);
+  if (!value)
+    return nullptr;
+
+  const auto [it, inserted] = s_applied_core_options.try_emplace(key, value);
+  if (!inserted)
+  {
+    if (it->second == value)
+      return nullptr;
+    it->second = value;
+  }
+  return value;
+}
+
+// Makes the next call of TakeChangedCoreOptionValue for the key return its value again.
+void ForgetAppliedCoreOption(std::string_view key)
+{
+  const auto it = s_applied_core_options.find(key);
+  if (it != s_applied_core_options.end())
+    s_applied_core_options.erase(it);
+}
+
+void RequestConfigSave()
+{
+  s_config_save_time = std::chrono::steady_clock::now() + kConfigSaveDelay;
+}
+
+void SaveConfigIfRequested(bool force)
+{
+  if (!s_config_save_time || (!force && std::chrono::steady_clock::now() < *s_config_save_time))
+    return;
+
+  s_config_save_time.reset();
+  Config::Save();
+}
+
 template <typename T>
 bool SetConfigIfChanged(const Config::Info<T>& info, const T& value)
 {
@@ -1304,7 +2162,7 @@ bool SetConfigIfChanged(const Config::Info<T>& info, const T& value)
 
 bool ApplyBoolOption(const char* key, const Config::Info<bool>& info)
 {
-  const char* value = GetCoreOptionValue(key);
+  const char* value = TakeChangedCoreOptionValue(key);
   if (!value)
     return false;
 
@@ -1314,7 +2172,7 @@ bool ApplyBoolOption(const char* key, const Config::Info<bool>& info)
 
 bool ApplyInternalResolutionOption(const char* key)
 {
-  const char* value = GetCoreOptionValue(key);
+  const char* value = TakeChangedCoreOptionValue(key);
   if (!value)
     return false;
 
@@ -1331,7 +2189,7 @@ bool ApplyInternalResolutionOption(const char* key)
 
 bool ApplyWiimoteSourceOption(const char* key, int index)
 {
-  const char* value = GetCoreOptionValue(key);
+  const char* value = TakeChangedCoreOptionValue(key);
   if (!value)
     return false;
 
@@ -1346,6 +2204,7 @@ bool ApplyWiimoteSourceOption(const char* key, int index)
   return SetConfigIfChanged(Config::GetInfoForWiimoteSource(index), source);
 }
 
+// Only applies the options that changed since they were last applied.
 void ApplyCoreOptions()
 {
   bool changed = false;
@@ -1357,20 +2216,39 @@ void ApplyCoreOptions()
   changed |= ApplyBoolOption("dolphin_sync_on_skip_idle", Config::MAIN_SYNC_ON_SKIP_IDLE);
   changed |= ApplyBoolOption("dolphin_cheats", Config::MAIN_ENABLE_CHEATS);
   changed |= ApplyBoolOption("dolphin_savestates", Config::MAIN_ENABLE_SAVESTATES);
+  changed |= ApplyBoolOption("dolphin_jit_profiling", Config::MAIN_DEBUG_JIT_ENABLE_PROFILING);
   changed |= ApplyBoolOption("dolphin_wiimote_speaker", Config::MAIN_WIIMOTE_ENABLE_SPEAKER);
   changed |= ApplyWiimoteSourceOption("dolphin_wiimote_1", 0);
   changed |= ApplyWiimoteSourceOption("dolphin_wiimote_2", 1);
   changed |= ApplyWiimoteSourceOption("dolphin_wiimote_3", 2);
   changed |= ApplyWiimoteSourceOption("dolphin_wiimote_4", 3);
 
+  if (const char* value = TakeChangedCoreOptionValue("dolphin_delta_savestates"))
+    s_delta_savestates = std::string_view(value) == "enabled";
+
+  if (const char* value = TakeChangedCoreOptionValue("dolphin_triple_buffer"))
+    s_triple_buffer = std::string_view(value) == "enabled";
+
+  if (const char* value = TakeChangedCoreOptionValue("dolphin_frame_paced_audio"))
+    AudioCommon::SetLibretroAudioFramePaced(std::string_view(value) == "enabled");
+
+  if (const char* value = TakeChangedCoreOptionValue("dolphin_frontend_pacing"))
+  {
+    s_frontend_pacing = std::string_view(value) == "enabled";
+    UpdateHostPacing();
+  }
+
+  if (const char* value = TakeChangedCoreOptionValue("dolphin_synchronous_emulation"))
+    s_synchronous_emulation = std::string_view(value) == "enabled";
+
   if (changed)
-    Config::Save();
+    RequestConfigSave();
 }
 
 bool ApplyStringOption(const char* key, const Config::Info<std::string>& info,
                        std::initializer_list<std::string_view> allowed)
 {
-  const char* value = GetCoreOptionValue(key);
+  const char* value = TakeChangedCoreOptionValue(key);
   if (!value)
     return false;
 
@@ -1389,7 +2267,7 @@ bool ApplyStringOption(const char* key, const Config::Info<std::string>& info,
 
 bool ApplyU16Option(const char* key, const Config::Info<u16>& info, u16 min, u16 max)
 {
-  const char* value = GetCoreOptionValue(key);
+  const char* value = TakeChangedCoreOptionValue(key);
   if (!value)
     return false;
 
@@ -1404,7 +2282,7 @@ bool ApplyU16Option(const char* key, const Config::Info<u16>& info, u16 min, u16
 
 bool ApplyU32Option(const char* key, const Config::Info<u32>& info, u32 min, u32 max)
 {
-  const char* value = GetCoreOptionValue(key);
+  const char* value = TakeChangedCoreOptionValue(key);
   if (!value)
     return false;
 
@@ -1417,8 +2295,104 @@ bool ApplyU32Option(const char* key, const Config::Info<u32>& info, u32 min, u32
   return SetConfigIfChanged(info, clamped);
 }
 
+void TraversalThreadFunc(TraversalPrewarmConfig config)
+{
+  Common::SetCurrentThreadName("NetPlay Traversal");
+
+  if (!Common::EnsureTraversalClient(config.server, config.port, config.port_alt,
+                                     config.listen_port))
+  {
+    LogMessage(RETRO_LOG_WARN, "NetPlay traversal pre-connect failed to create a host\n");
+    return;
+  }
+
+  while (!s_traversal_thread_exit.load())
+  {
+    if (Common::g_TraversalClient->HasFailed())
+    {
+      s_traversal_event.WaitFor(kTraversalRetryDelay);
+      if (s_traversal_thread_exit.load())
+        return;
+      Common::g_TraversalClient->ReconnectToServer();
+    }
+
+    // Also sends the pings that keep the connection alive.
+    Common::g_TraversalClient->Update();
+  }
+}
+
+// Stops servicing the pre-connected traversal client. A session that is about to use the
+// connection keeps it; otherwise it is closed.
+void StopTraversalPrewarm(bool keep_connection)
+{
+  if (s_traversal_thread.joinable())
+  {
+    s_traversal_thread_exit.store(true);
+    s_traversal_event.Set();
+    s_traversal_thread.join();
+    s_traversal_thread_exit.store(false);
+  }
+
+  if (s_traversal_config && !keep_connection)
+    Common::ReleaseTraversalClient();
+  s_traversal_config.reset();
+}
+
+void UpdateTraversalPrewarm()
+{
+  // A session services the connection itself.
+  if (s_netplay_client || s_netplay_server)
+    return;
+
+  // These have to match what NetPlayClient and NetPlayServer ask for, or they reconnect.
+  std::optional<TraversalPrewarmConfig> config;
+  const NetPlayMode mode = GetNetPlayMode();
+  const NetPlayConnection connection = GetNetPlayConnection();
+  const std::string server = Config::Get(Config::NETPLAY_TRAVERSAL_SERVER);
+  const u16 port = Config::Get(Config::NETPLAY_TRAVERSAL_PORT);
+  if (mode == NetPlayMode::Join && connection != NetPlayConnection::Direct)
+  {
+    config = TraversalPrewarmConfig{server, port, 0, 0};
+  }
+  else if (mode == NetPlayMode::Host && connection == NetPlayConnection::Traversal)
+  {
+    config = TraversalPrewarmConfig{server, port, Config::Get(Config::NETPLAY_TRAVERSAL_PORT_ALT),
+                                    Config::Get(Config::NETPLAY_LISTEN_PORT)};
+  }
+
+  if (config == s_traversal_config)
+    return;
+
+  StopTraversalPrewarm(false);
+  if (!config || config->server.empty())
+    return;
+
+  if (enet_initialize() != 0)
+  {
+    LogMessage(RETRO_LOG_WARN, "NetPlay traversal pre-connect failed to initialize ENet\n");
+    return;
+  }
+
+  s_traversal_config = config;
+  s_traversal_thread = std::thread(TraversalThreadFunc, std::move(*config));
+}
+
 bool ApplyNetPlayOptions()
 {
+  // The LAN mode overrides these options, so they have to be applied again when it changes.
+  const bool lan_mode_changed = TakeChangedCoreOptionValue("dolphin_netplay_lan_mode") != nullptr;
+  const bool auto_port_changed =
+      TakeChangedCoreOptionValue("dolphin_netplay_lan_auto_port") != nullptr;
+  if (lan_mode_changed || auto_port_changed)
+  {
+    for (const char* key : {"dolphin_netplay_address", "dolphin_netplay_connect_port",
+                            "dolphin_netplay_host_port", "dolphin_netplay_lobby_advertise",
+                            "dolphin_netplay_host_code"})
+    {
+      ForgetAppliedCoreOption(key);
+    }
+  }
+
   bool changed = false;
   changed |= ApplyStringOption("dolphin_netplay_address", Config::NETPLAY_ADDRESS, {});
   changed |= ApplyU16Option("dolphin_netplay_connect_port", Config::NETPLAY_CONNECT_PORT, 1, 65535);
@@ -1449,6 +2423,20 @@ bool ApplyNetPlayOptions()
   changed |= ApplyStringOption("dolphin_netplay_network_mode", Config::NETPLAY_NETWORK_MODE,
                                {"fixeddelay", "hostinputauthority", "golf"});
   changed |= ApplyU32Option("dolphin_netplay_buffer_size", Config::NETPLAY_BUFFER_SIZE, 1, 20);
+  changed |= ApplyBoolOption("dolphin_netplay_rollback", Config::NETPLAY_ROLLBACK);
+  changed |= ApplyBoolOption("dolphin_netplay_late_join", Config::NETPLAY_ALLOW_LATE_JOIN);
+  changed |= ApplyBoolOption("dolphin_netplay_auto_buffer", Config::NETPLAY_AUTO_BUFFER);
+  changed |=
+      ApplyBoolOption("dolphin_netplay_redundant_inputs", Config::NETPLAY_REDUNDANT_PAD_DATA);
+  changed |=
+      ApplyBoolOption("dolphin_netplay_state_fingerprints", Config::NETPLAY_STATE_FINGERPRINTS);
+  changed |=
+      ApplyBoolOption("dolphin_netplay_delayed_spectators", Config::NETPLAY_DELAYED_SPECTATORS);
+  changed |=
+      ApplyU32Option("dolphin_netplay_spectator_delay", Config::NETPLAY_SPECTATOR_DELAY, 0, 600);
+  changed |=
+      ApplyU32Option("dolphin_netplay_wiimote_batch", Config::NETPLAY_WIIMOTE_BATCH_SIZE, 1, 4);
+  changed |= ApplyBoolOption("dolphin_netplay_show_stats", Config::GFX_SHOW_NETPLAY_STATS);
   changed |= ApplyU32Option("dolphin_netplay_client_buffer_size", Config::NETPLAY_CLIENT_BUFFER_SIZE,
                             1, 5);
 
@@ -1458,33 +2446,41 @@ bool ApplyNetPlayOptions()
     if (IsNetPlayLanAutoPortEnabled())
     {
       constexpr u16 kLanAutoPortRange = 16;
-      const u16 base_port = Config::Get(Config::NETPLAY_HOST_PORT);
-      if (lan_mode == NetPlayLanMode::Host)
+      // Probing starts at the port set in the core option, not at the config value, which gets
+      // overwritten with the port that was picked.
+      u16 base_port = Config::NETPLAY_HOST_PORT.GetDefaultValue();
+      unsigned option_port = 0;
+      if (const char* value = GetCoreOptionValue("dolphin_netplay_host_port");
+          value && TryParse(value, &option_port) && option_port >= 1 && option_port <= 65535)
       {
-        if (const auto port = FindAvailableUdpPort(base_port, kLanAutoPortRange))
-        {
-          if (*port != Config::Get(Config::NETPLAY_HOST_PORT))
-          {
-            Config::SetCurrent(Config::NETPLAY_HOST_PORT, *port);
-            Config::SetCurrent(Config::NETPLAY_CONNECT_PORT, *port);
-            LogMessage(RETRO_LOG_INFO, "NetPlay LAN auto port selected (host): %u\n", *port);
-            changed = true;
-          }
-        }
+        base_port = static_cast<u16>(option_port);
       }
-      else if (lan_mode == NetPlayLanMode::Join)
+      if (!s_lan_auto_port || s_lan_auto_port->mode != lan_mode ||
+          s_lan_auto_port->base_port != base_port)
       {
-        if (const auto port = FindInUseUdpPort(base_port, kLanAutoPortRange))
+        const bool want_available = lan_mode == NetPlayLanMode::Host;
+        const auto port = FindUdpPort(base_port, kLanAutoPortRange, want_available);
+        // A host that finds no free port in the range leaves it to the system, see
+        // StartNetPlaySession.
+        if (port || want_available)
+          s_lan_auto_port = LanAutoPort{lan_mode, base_port, port.value_or(0)};
+        else
+          s_lan_auto_port.reset();
+
+        if (port)
         {
-          if (*port != Config::Get(Config::NETPLAY_CONNECT_PORT))
-          {
-            Config::SetCurrent(Config::NETPLAY_CONNECT_PORT, *port);
-            Config::SetCurrent(Config::NETPLAY_HOST_PORT, *port);
-            LogMessage(RETRO_LOG_INFO, "NetPlay LAN auto port selected (join): %u\n", *port);
-            changed = true;
-          }
+          LogMessage(RETRO_LOG_INFO, "NetPlay LAN auto port selected (%s): %u\n",
+                     want_available ? "host" : "join", *port);
         }
       }
+
+      if (s_lan_auto_port && (Config::Get(Config::NETPLAY_HOST_PORT) != s_lan_auto_port->port ||
+                              Config::Get(Config::NETPLAY_CONNECT_PORT) != s_lan_auto_port->port))
+      {
+        Config::SetCurrent(Config::NETPLAY_HOST_PORT, s_lan_auto_port->port);
+        Config::SetCurrent(Config::NETPLAY_CONNECT_PORT, s_lan_auto_port->port);
+        changed = true;
+      }
     }
 
     if (Config::Get(Config::NETPLAY_ADDRESS) != "127.0.0.1")
@@ -1510,33 +2506,103 @@ bool ApplyNetPlayOptions()
     }
   }
 
+  UpdateTraversalPrewarm();
+
   if (changed)
-    Config::Save();
+    RequestConfigSave();
   return changed;
 }
 
-void RefreshNetPlayRooms()
+void LobbyThreadFunc()
 {
+  Common::SetCurrentThreadName("NetPlay Lobby");
+
   NetPlayIndex index;
-  std::map<std::string, std::string> filters;
-  const std::string region = Config::Get(Config::NETPLAY_INDEX_REGION);
-  if (!region.empty())
-    filters.emplace("region", region);
+  std::vector<NetPlaySession> rooms;
+  std::map<std::string, std::string> listed_filters;
+  std::optional<std::chrono::steady_clock::time_point> listed_time;
 
-  auto rooms = index.List(filters);
-  if (!rooms)
+  while (true)
   {
-    LogMessage(RETRO_LOG_WARN, "NetPlay lobby refresh failed: %s\n",
-               index.GetLastError().c_str());
+    s_lobby_event.Wait();
+    if (s_lobby_thread_exit.load())
+      return;
+    if (!s_lobby_refresh_requested.exchange(false))
+      continue;
+
+    std::map<std::string, std::string> filters;
+    {
+      std::lock_guard lk(s_netplay_mutex);
+      filters = s_lobby_filters;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (!listed_time || now - *listed_time >= kLobbyListTtl || filters != listed_filters)
+    {
+      auto result = index.List(filters);
+      if (!result)
+      {
+        LogMessage(RETRO_LOG_WARN, "NetPlay lobby refresh failed: %s\n",
+                   index.GetLastError().c_str());
+        continue;
+      }
+
+      rooms = std::move(*result);
+      listed_filters = std::move(filters);
+      listed_time = now;
+    }
+
+    {
+      std::lock_guard lk(s_netplay_mutex);
+      s_netplay_rooms = rooms;
+    }
+    s_lobby_rooms_updated.store(true);
+  }
+}
+
+void StopLobbyThread()
+{
+  if (!s_lobby_thread.joinable())
     return;
+
+  s_lobby_thread_exit.store(true);
+  s_lobby_event.Set();
+  s_lobby_thread.join();
+  s_lobby_thread_exit.store(false);
+  s_lobby_refresh_requested.store(false);
+  s_lobby_rooms_updated.store(false);
+}
+
+void RefreshNetPlayRooms()
+{
+  {
+    std::lock_guard lk(s_netplay_mutex);
+    s_lobby_filters.clear();
+    const std::string region = Config::Get(Config::NETPLAY_INDEX_REGION);
+    if (!region.empty())
+      s_lobby_filters.emplace("region", region);
   }
 
+  if (!s_lobby_thread.joinable())
+    s_lobby_thread = std::thread(LobbyThreadFunc);
+
+  s_lobby_refresh_requested.store(true);
+  s_lobby_event.Set();
+}
+
+// Called from retro_run, where the core options may be set.
+void UpdateNetPlayRooms()
+{
+  if (!s_lobby_rooms_updated.exchange(false))
+    return;
+
+  size_t room_count;
   {
     std::lock_guard lk(s_netplay_mutex);
-    s_netplay_rooms = std::move(*rooms);
+    room_count = s_netplay_rooms.size();
   }
 
-  LogMessage(RETRO_LOG_INFO, "NetPlay lobby rooms: %zu\n", s_netplay_rooms.size());
+  LogMessage(RETRO_LOG_INFO, "NetPlay lobby rooms: %zu\n", room_count);
   BuildCoreOptions(true);
 }
 
@@ -1630,11 +2696,15 @@ void ShutdownNetPlay()
   s_netplay_server.reset();
   s_netplay_ui.reset();
 
-  s_netplay_rooms.clear();
+  {
+    std::lock_guard lk(s_netplay_mutex);
+    s_netplay_rooms.clear();
+  }
   s_netplay_room_value_map.clear();
   s_netplay_selected_game = {};
   s_netplay_selected_game_name.clear();
   s_netplay_start_requested.store(false);
+  s_lan_auto_port.reset();
 }
 
 bool StartNetPlaySession()
@@ -1677,6 +2747,8 @@ bool StartNetPlaySession()
         use_traversal ? Config::Get(Config::NETPLAY_LISTEN_PORT) :
                         Config::Get(Config::NETPLAY_HOST_PORT);
 
+    StopTraversalPrewarm(use_traversal);
+
     s_netplay_server = std::make_unique<NetPlay::NetPlayServer>(
         host_port, Config::Get(Config::NETPLAY_USE_UPNP), s_netplay_ui.get(),
         NetPlay::NetTraversalConfig{use_traversal, traversal_host, traversal_port,
@@ -1689,6 +2761,16 @@ bool StartNetPlaySession()
       return false;
     }
 
+    if (host_port == 0)
+    {
+      const u16 port = s_netplay_server->GetPort();
+      LogMessage(RETRO_LOG_INFO, "NetPlay host listening on port %u\n", port);
+      if (s_lan_auto_port)
+        s_lan_auto_port->port = port;
+      Config::SetCurrent(Config::NETPLAY_HOST_PORT, port);
+      Config::SetCurrent(Config::NETPLAY_CONNECT_PORT, port);
+    }
+
     const std::string netplay_name = GetNetPlayRoomName();
     {
       std::lock_guard lk(s_netplay_mutex);
@@ -1716,6 +2798,8 @@ bool StartNetPlaySession()
   if (!target)
     return false;
 
+  StopTraversalPrewarm(target->use_traversal);
+
   Config::SetBaseOrCurrent(Config::NETPLAY_TRAVERSAL_CHOICE,
                            target->use_traversal ? "traversal" : "direct");
   if (target->use_traversal)
@@ -1725,6 +2809,22 @@ bool StartNetPlaySession()
       target->address, target->port, s_netplay_ui.get(), nickname,
       NetPlay::NetTraversalConfig{target->use_traversal, traversal_host, traversal_port});
 
+  // Where traversal found a host before is worth trying when it can't find it now, since the host
+  // may still have the port open, for example through UPnP.
+  const ResolvedHostCode* resolved =
+      target->use_traversal && !s_netplay_client->IsConnected() ?
+          FindResolvedHostCode(target->address) :
+          nullptr;
+  if (resolved)
+  {
+    LogMessage(RETRO_LOG_WARN, "NetPlay traversal failed, trying %s:%u from the last join\n",
+               resolved->address.c_str(), resolved->port);
+    s_netplay_client.reset();
+    s_netplay_client = std::make_unique<NetPlay::NetPlayClient>(
+        resolved->address, resolved->port, s_netplay_ui.get(), nickname,
+        NetPlay::NetTraversalConfig{false, traversal_host, traversal_port});
+  }
+
   if (!s_netplay_client->IsConnected())
   {
     LogMessage(RETRO_LOG_ERROR, "NetPlay join failed to connect\n");
@@ -1732,6 +2832,12 @@ bool StartNetPlaySession()
     return false;
   }
 
+  if (target->use_traversal && !resolved)
+  {
+    if (auto address = s_netplay_client->GetServerAddress())
+      RememberResolvedHostCode(target->address, std::move(address->first), address->second);
+  }
+
   return true;
 }
 
@@ -1819,7 +2925,12 @@ void UpdateCoreOptions()
   bool updated = false;
   if (s_environment(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
   {
-    ApplyCoreOptions();
+    {
+      // React to all changes at once, instead of once per option.
+      Config::ConfigChangeCallbackGuard config_guard;
+      ApplyCoreOptions();
+      ApplyNetPlayOptions();
+    }
     UpdateNetPlayOptions();
   }
 }
@@ -2110,7 +3221,10 @@ RETRO_API void retro_set_environment(retro_environment_t cb)
 
   bool no_game = false;
   if (s_environment)
+  {
     s_environment(RETRO_ENVIRONMENT_SET_SUPPORT_NO_GAME, &no_game);
+    SetupDiskControlInterface();
+  }
 }
 
 RETRO_API void retro_set_video_refresh(retro_video_refresh_t cb)
@@ -2169,6 +3283,7 @@ RETRO_API void retro_init(void)
   UICommon::Init();
   SetupLibretroLogging();
   BuildCoreOptions(false);
+  s_applied_core_options.clear();
   ApplyCoreOptions();
   ApplyNetPlayOptions();
   ForceLibretroVideoConfig();
@@ -2186,6 +3301,8 @@ RETRO_API void retro_init(void)
 
 RETRO_API void retro_deinit(void)
 {
+  StopLobbyThread();
+  StopTraversalPrewarm(false);
   ShutdownNetPlay();
 
   if (s_game_loaded)
@@ -2193,6 +3310,7 @@ RETRO_API void retro_deinit(void)
 
   if (s_initialized)
   {
+    SaveConfigIfRequested(true);
     UICommon::ShutdownControllers();
     UICommon::Shutdown();
   }
@@ -2206,15 +3324,19 @@ RETRO_API void retro_deinit(void)
   s_audio_sample_batch = nullptr;
   s_core_options.clear();
   s_core_option_strings.clear();
-  s_state_buffer.reset(0);
+  InvalidateStateSizeEstimate();
   s_cheats.clear();
   s_loaded_game_file.reset();
   s_loaded_game_path.clear();
   s_netplay_option_cache = {};
+  s_resolved_host_codes.clear();
+  s_resolved_host_codes_loaded = false;
+  s_applied_core_options.clear();
   s_pending_boot.reset();
   s_game_loaded = false;
   s_initialized = false;
   s_hw_render_enabled = false;
+  s_frame_time_callback_set = false;
   s_hw_context_ready.store(false);
 }
 
@@ -2226,14 +3348,14 @@ RETRO_API void retro_get_system_info(struct retro_system_info* info)
 
   info->library_name = "Dolphin";
   info->library_version = s_library_version.c_str();
-  info->valid_extensions = "iso;gcm;gcz;wbfs;ciso;wad;elf;dol";
+  info->valid_extensions = "iso;gcm;gcz;wbfs;ciso;wad;elf;dol;m3u";
   info->need_fullpath = true;
   info->block_extract = false;
 }
 
 RETRO_API void retro_get_system_av_info(struct retro_system_av_info* info)
 {
-  info->timing.fps = 60.0;
+  info->timing.fps = kFrameRate;
   info->timing.sample_rate = 48000.0;
   info->geometry.base_width = 640;
   info->geometry.base_height = 528;
@@ -2265,7 +3387,13 @@ RETRO_API bool retro_load_game(const struct retro_game_info* info)
   }
 
   s_wsi.type = WindowSystemType::Libretro;
+  SetupFrameTimeCallback();
+
+  s_can_dupe = false;
+  s_environment(RETRO_ENVIRONMENT_GET_CAN_DUPE, &s_can_dupe);
 
+  // The current run layer of the last game is gone, so apply every option again.
+  s_applied_core_options.clear();
   ApplyCoreOptions();
   ApplyNetPlayOptions();
 
@@ -2296,11 +3424,17 @@ RETRO_API void retro_unload_game(void)
   ShutdownNetPlay();
   if (s_game_loaded)
     StopCore();
+  s_frame_time_callback_set = false;
+  UpdateHostPacing();
+  SaveConfigIfRequested(true);
   s_game_loaded = false;
   s_hw_render_enabled = false;
   s_pending_boot.reset();
   s_loaded_game_file.reset();
   s_loaded_game_path.clear();
+  s_disk_images.clear();
+  s_disk_index = 0;
+  s_disk_ejected = false;
 }
 
 RETRO_API bool retro_load_game_special(unsigned, const struct retro_game_info*, size_t)
@@ -2313,14 +3447,14 @@ RETRO_API unsigned retro_get_region(void)
   return RETRO_REGION_NTSC;
 }
 
-RETRO_API void* retro_get_memory_data(unsigned)
+RETRO_API void* retro_get_memory_data(unsigned id)
 {
-  return nullptr;
+  return GetMemoryRegion(id).data();
 }
 
-RETRO_API size_t retro_get_memory_size(unsigned)
+RETRO_API size_t retro_get_memory_size(unsigned id)
 {
-  return 0;
+  return GetMemoryRegion(id).size();
 }
 
 RETRO_API void retro_run(void)
@@ -2349,18 +3483,53 @@ RETRO_API void retro_run(void)
     BootGameInternal(std::move(pending.path), std::move(pending.session), pending.is_netplay);
   }
 
+  UpdateSpeculativeFrame();
+  ShowNetPlayStats();
+
   if (s_game_loaded)
+  {
+    // After polling input, so that the field uses it.
+    auto& core_timing = Core::System::GetInstance().GetCoreTiming();
+    if (s_synchronous_emulation)
+      core_timing.RunHostPacedField(kSynchronousFieldTimeout);
+    else
+      core_timing.AllowHostPacedField();
     Core::HostDispatchJobs(Core::System::GetInstance());
+    if (s_netplay_client)
+      s_netplay_client->UpdateRollback(Core::System::GetInstance());
+    AudioCommon::DrainLibretroAudio(kFrameRate);
+    UpdateMemoryMaps();
+  }
+
+  bool presented = false;
+#ifdef HAS_VULKAN
+  if (s_use_vulkan && s_video_refresh)
+    presented = PresentVulkanFrame();
+#endif
 
   if (s_pending_present.exchange(false) && s_video_refresh)
   {
-    const unsigned width = s_present_width.load();
-    const unsigned height = s_present_height.load();
-    s_video_refresh(RETRO_HW_FRAME_BUFFER_VALID, width, height, 0);
+    unsigned width = s_present_width.load();
+    unsigned height = s_present_height.load();
+    // With triple buffering only frames the video thread has completed since the last call are
+    // handed to the frontend, and the copy never waits on the video thread.
+    if (!LibretroGetGLCallbacks().triple_buffer ||
+        (s_hw_callback.get_current_framebuffer &&
+         LibretroBlitQueuedFrame(s_hw_callback.get_current_framebuffer(), &width, &height)))
+    {
+      s_video_refresh(RETRO_HW_FRAME_BUFFER_VALID, width, height, 0);
+      presented = true;
+    }
   }
 
   if (!s_game_loaded || !s_hw_render_enabled)
     SubmitDummyFrame();
+  else if (!presented && s_can_dupe && s_video_refresh)
+    s_video_refresh(nullptr, s_present_width.load(), s_present_height.load(), 0);
+
+  // Left for after the frame was handed to the frontend, since they take a while.
+  UpdateNetPlayRooms();
+  SaveConfigIfRequested(false);
 }
 
 RETRO_API size_t retro_serialize_size(void)
@@ -2368,10 +3537,7 @@ RETRO_API size_t retro_serialize_size(void)
   if (!s_game_loaded)
     return 0;
 
-  auto& system = Core::System::GetInstance();
-  s_state_buffer.reset(0);
-  State::SaveToBuffer(system, s_state_buffer);
-  return s_state_buffer.size();
+  return GetStateSizeEstimate();
 }
 
 RETRO_API void retro_cheat_reset(void)
@@ -2386,13 +3552,16 @@ RETRO_API bool retro_serialize(void* data, size_t size)
     return false;
 
   auto& system = Core::System::GetInstance();
-  s_state_buffer.reset(0);
-  State::SaveToBuffer(system, s_state_buffer);
-
-  if (s_state_buffer.empty() || s_state_buffer.size() > size)
+  const std::span<u8> buffer(static_cast<u8*>(data), size);
+  const size_t written = UseDeltaSavestates() ? State::SaveDeltaToSpan(system, buffer) :
+                                                State::SaveToSpan(system, buffer);
+  if (written == 0)
+  {
+    // The state outgrew the reported size; report a larger one from now on.
+    InvalidateStateSizeEstimate();
     return false;
+  }
 
-  std::memcpy(data, s_state_buffer.data(), s_state_buffer.size());
   return true;
 }
 
@@ -2401,12 +3570,8 @@ RETRO_API bool retro_unserialize(const void* data, size_t size)
   if (!s_game_loaded || !data || size == 0)
     return false;
 
-  Common::UniqueBuffer<u8> buffer(size);
-  std::memcpy(buffer.data(), data, size);
-
   auto& system = Core::System::GetInstance();
-  State::LoadFromBuffer(system, buffer);
-  return true;
+  return State::LoadDeltaFromSpan(system, std::span<const u8>(static_cast<const u8*>(data), size));
 }
 
 RETRO_API void retro_cheat_set(unsigned index, bool enabled, const char* code)
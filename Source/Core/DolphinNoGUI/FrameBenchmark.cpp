@@ -0,0 +1,120 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/FrameBenchmark.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Core/Core.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/System.h"
+#include "VideoCommon/PerformanceMetrics.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoEvents.h"
+
+FrameBenchmark::FrameBenchmark(u32 frame_count, std::function<void()> on_done)
+    : m_frame_count(frame_count), m_on_done(std::move(on_done))
+{
+  m_frame_times.reserve(frame_count);
+  m_frame_hook = GetVideoEvents().after_frame_event.Register([this](Core::System&) { OnFrame(); });
+}
+
+void FrameBenchmark::OnFrame()
+{
+  if (m_finished)
+    return;
+
+  // The first frame only starts the clock, since loading the state or booting ends in it.
+  const Clock::time_point now = Clock::now();
+  if (!m_started)
+  {
+    m_started = true;
+    m_last_frame_time = now;
+    return;
+  }
+
+  m_frame_times.push_back(now - m_last_frame_time);
+  m_last_frame_time = now;
+
+  const auto& frame = g_stats.this_frame;
+  m_counters.prims += frame.num_prims + frame.num_dl_prims;
+  m_counters.draw_calls += frame.num_draw_calls;
+  m_counters.shader_changes += frame.num_shader_changes;
+  m_counters.vertices_loaded += frame.num_vertices_loaded;
+  m_counters.efb_peeks += frame.num_efb_peeks;
+  m_counters.efb_pokes += frame.num_efb_pokes;
+  m_counters.bytes_vertex_streamed += frame.bytes_vertex_streamed;
+  m_counters.bytes_index_streamed += frame.bytes_index_streamed;
+  m_counters.bytes_uniform_streamed += frame.bytes_uniform_streamed;
+
+  if (m_frame_times.size() < m_frame_count)
+    return;
+
+  m_finished = true;
+  m_pixel_shaders_created = g_stats.num_pixel_shaders_created;
+  m_vertex_shaders_created = g_stats.num_vertex_shaders_created;
+  m_textures_created = g_stats.num_textures_created;
+  m_textures_uploaded = g_stats.num_textures_uploaded;
+  m_vertex_loaders = g_stats.num_vertex_loaders;
+  Core::QueueHostJob([this](Core::System& system) { Finish(system); });
+}
+
+void FrameBenchmark::Finish(Core::System& system)
+{
+  Core::RunOnCPUThread(
+      system, [this, &system] { m_jit_blocks = system.GetJitInterface().GetBlockCount(); }, true);
+  m_on_done();
+}
+
+void FrameBenchmark::PrintReport() const
+{
+  if (m_frame_times.empty())
+  {
+    fmt::print("Benchmark: No frames were run\n");
+    return;
+  }
+
+  if (m_frame_times.size() < m_frame_count)
+  {
+    fmt::print("Benchmark: The game stopped after {} of {} frames\n", m_frame_times.size(),
+               m_frame_count);
+  }
+
+  std::vector<Clock::duration> sorted = m_frame_times;
+  std::ranges::sort(sorted);
+  const auto to_ms = [](Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+  };
+  const auto percentile = [&](double p) {
+    return to_ms(sorted[std::min(sorted.size() - 1, static_cast<size_t>(p * sorted.size()))]);
+  };
+
+  const double total_ms = to_ms(std::accumulate(sorted.begin(), sorted.end(), Clock::duration{}));
+  const double frames = static_cast<double>(sorted.size());
+
+  fmt::print("Benchmark: {} frames in {:.3f} s, {:.2f} FPS\n", sorted.size(), total_ms / 1000,
+             frames / total_ms * 1000);
+  fmt::print("Frame time (ms): min {:.3f}, avg {:.3f}, p50 {:.3f}, p90 {:.3f}, p99 {:.3f}, "
+             "max {:.3f}\n",
+             to_ms(sorted.front()), total_ms / frames, percentile(0.5), percentile(0.9),
+             percentile(0.99), to_ms(sorted.back()));
+  fmt::print("Boot time: {:.3f} s\n", to_ms(g_perf_metrics.GetBootTime()) / 1000);
+
+  fmt::print("JIT blocks: {}\n", m_jit_blocks);
+  fmt::print("Per frame: {:.1f} prims, {:.1f} draw calls, {:.1f} shader changes, "
+             "{:.1f} vertices loaded, {:.1f} EFB peeks, {:.1f} EFB pokes\n",
+             m_counters.prims / frames, m_counters.draw_calls / frames,
+             m_counters.shader_changes / frames, m_counters.vertices_loaded / frames,
+             m_counters.efb_peeks / frames, m_counters.efb_pokes / frames);
+  fmt::print("Streamed per frame: {:.0f} vertex bytes, {:.0f} index bytes, {:.0f} uniform bytes\n",
+             m_counters.bytes_vertex_streamed / frames, m_counters.bytes_index_streamed / frames,
+             m_counters.bytes_uniform_streamed / frames);
+  fmt::print("Created: {} pixel shaders, {} vertex shaders, {} textures ({} uploads), "
+             "{} vertex loaders\n",
+             m_pixel_shaders_created, m_vertex_shaders_created, m_textures_created,
+             m_textures_uploaded, m_vertex_loaders);
+}
@@ -0,0 +1,67 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+
+namespace Core
+{
+class System;
+}
+
+// Times a number of frames of the running game, then calls on_done on the host thread. The speed
+// limit has to be turned off before booting for the timings to mean anything.
+class FrameBenchmark
+{
+public:
+  FrameBenchmark(u32 frame_count, std::function<void()> on_done);
+
+  // Prints the frame time percentiles and the JIT and GPU counters. Must be called after the
+  // emulation has stopped.
+  void PrintReport() const;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Counters
+  {
+    u64 prims = 0;
+    u64 draw_calls = 0;
+    u64 shader_changes = 0;
+    u64 vertices_loaded = 0;
+    u64 efb_peeks = 0;
+    u64 efb_pokes = 0;
+    u64 bytes_vertex_streamed = 0;
+    u64 bytes_index_streamed = 0;
+    u64 bytes_uniform_streamed = 0;
+  };
+
+  // Called on the video thread.
+  void OnFrame();
+  // Called on the host thread.
+  void Finish(Core::System& system);
+
+  u32 m_frame_count;
+  std::function<void()> m_on_done;
+  Common::EventHook m_frame_hook;
+
+  // Only touched by the video thread until the benchmark finishes.
+  std::vector<Clock::duration> m_frame_times;
+  Clock::time_point m_last_frame_time;
+  bool m_started = false;
+  bool m_finished = false;
+  Counters m_counters;
+  int m_pixel_shaders_created = 0;
+  int m_vertex_shaders_created = 0;
+  int m_textures_created = 0;
+  int m_textures_uploaded = 0;
+  int m_vertex_loaders = 0;
+
+  std::size_t m_jit_blocks = 0;
+};
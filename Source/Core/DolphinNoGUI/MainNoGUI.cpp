@@ -6,6 +6,7 @@
 #include <OptionParser.h>
 #include <csignal>
 #include <cstdio>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -15,14 +16,19 @@
 #include <Windows.h>
 #endif
 
+#include "Common/Config/Config.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/Host.h"
+#include "Core/Movie.h"
 #include "Core/System.h"
+#include "DolphinNoGUI/FrameBenchmark.h"
 
 #include "UICommon/CommandLineParse.h"
 #ifdef USE_DISCORD_PRESENCE
@@ -212,6 +218,12 @@ int main(const int argc, char* argv[])
                 "macos"
 #endif
       });
+  parser->add_option("--benchmark_frames")
+      .action("store")
+      .metavar("<count>")
+      .type("int")
+      .help("Run the given number of frames with the speed limit off, then print timing "
+            "statistics and exit");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -286,6 +298,37 @@ int main(const int argc, char* argv[])
     return 1;
   }
 
+  if (options.is_set("movie"))
+  {
+    std::optional<std::string> movie_save_state_path;
+    if (!Core::System::GetInstance().GetMovie().PlayInput(
+            static_cast<const char*>(options.get("movie")), &movie_save_state_path))
+    {
+      fprintf(stderr, "Could not play the specified movie\n");
+      return 1;
+    }
+    if (movie_save_state_path)
+    {
+      boot->boot_session_data.SetSavestateData(std::move(movie_save_state_path),
+                                               DeleteSavestateAfterBoot::No);
+    }
+  }
+
+  std::optional<FrameBenchmark> benchmark;
+  if (options.is_set("benchmark_frames"))
+  {
+    const int frame_count = static_cast<int>(options.get("benchmark_frames"));
+    if (frame_count <= 0)
+    {
+      fprintf(stderr, "The number of benchmark frames must be positive\n");
+      return 1;
+    }
+
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+    Config::SetCurrent(Config::GFX_VSYNC, false);
+    benchmark.emplace(static_cast<u32>(frame_count), [] { s_platform->Stop(); });
+  }
+
   auto core_state_changed_hook = Core::AddOnStateChangedCallback([](const Core::State state) {
     if (state == Core::State::Uninitialized)
       s_platform->Stop();
@@ -319,6 +362,9 @@ int main(const int argc, char* argv[])
   s_platform->MainLoop();
   Core::Stop(Core::System::GetInstance());
 
+  if (benchmark)
+    benchmark->PrintReport();
+
   Core::Shutdown(Core::System::GetInstance());
   s_platform.reset();
 
@@ -78,8 +78,17 @@ void GCPadWiiUConfigDialog::UpdateAdapterStatus()
   m_status_label->setText(status_text);
 
   const auto poll_rate = GCAdapter::GetCurrentPollRate();
-  if (poll_rate != 0)
+  const auto input_age = GCAdapter::GetCurrentInputAge();
+  if (poll_rate != 0 && input_age != 0)
+  {
+    m_poll_rate_label->setText(tr("Poll Rate: %1 Hz, Input Age: %2 ms")
+                                   .arg(poll_rate, 0, 'f', 2)
+                                   .arg(input_age, 0, 'f', 1));
+  }
+  else if (poll_rate != 0)
+  {
     m_poll_rate_label->setText(tr("Poll Rate: %1 Hz").arg(poll_rate, 0, 'f', 2));
+  }
   else
     m_poll_rate_label->clear();
 
@@ -11,6 +11,8 @@
 #include <QHeaderView>
 #include <QLabel>
 #include <QPushButton>
+#include <QSignalBlocker>
+#include <QSpinBox>
 #include <QTableWidget>
 #include <QUrl>
 #include <QVBoxLayout>
@@ -25,8 +27,11 @@
 #include "Common/FileUtil.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
+#include "Core/Debugger/PPCDebugInterface.h"
 #include "Core/IOS/Network/SSL.h"
 #include "Core/IOS/Network/Socket.h"
+#include "Core/NetworkCaptureLogger.h"
+#include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 #include "DolphinQt/Host.h"
 #include "DolphinQt/Settings.h"
@@ -248,6 +253,16 @@ void NetworkWidget::ConnectWidgets()
     Config::SetBaseOrCurrent(Config::MAIN_NETWORK_DUMP_BBA, state == Qt::Checked);
   });
 #endif
+  connect(m_dump_ring_buffer_size, &QSpinBox::valueChanged, [](int value) {
+    Config::SetBaseOrCurrent(Config::MAIN_NETWORK_DUMP_RING_BUFFER_SIZE, value);
+  });
+  connect(m_dump_ring_buffer, &QPushButton::clicked, [] {
+    // The logger belongs to the CPU thread.
+    auto& system = Core::System::GetInstance();
+    Core::RunOnCPUThread(
+        system, [&system] { system.GetPowerPC().GetDebugInterface().NetworkLogger()->Dump(); },
+        false);
+  });
   connect(m_open_dump_folder, &QPushButton::clicked, [] {
     const std::string location = File::GetUserPath(D_DUMPSSL_IDX);
     const QUrl url = QUrl::fromLocalFile(QString::fromStdString(location));
@@ -325,6 +340,10 @@ void NetworkWidget::Update()
   m_dump_peer_cert_checkbox->setChecked(Config::Get(Config::MAIN_NETWORK_SSL_DUMP_PEER_CERT));
   m_verify_certificates_checkbox->setChecked(
       Config::Get(Config::MAIN_NETWORK_SSL_VERIFY_CERTIFICATES));
+  {
+    const QSignalBlocker blocker(m_dump_ring_buffer_size);
+    m_dump_ring_buffer_size->setValue(Config::Get(Config::MAIN_NETWORK_DUMP_RING_BUFFER_SIZE));
+  }
 
   const int combo_index = int([is_pcap, is_ssl_read, is_ssl_write]() -> FormatComboId {
     if (is_pcap)
@@ -400,6 +419,15 @@ QGroupBox* NetworkWidget::CreateDumpOptionsGroup()
   m_dump_root_ca_checkbox = new QCheckBox(tr("Dump root CA certificates"));
   m_dump_peer_cert_checkbox = new QCheckBox(tr("Dump peer certificates"));
   m_dump_bba_checkbox = new QCheckBox(tr("Dump GameCube BBA traffic"));
+  m_dump_ring_buffer_size = new QSpinBox();
+  m_dump_ring_buffer_size->setRange(0, 1024);
+  m_dump_ring_buffer_size->setSuffix(tr(" MiB"));
+  m_dump_ring_buffer_size->setSpecialValueText(tr("Off"));
+  m_dump_ring_buffer_size->setToolTip(
+      tr("Only keeps this much of the latest traffic in memory, and writes it to a file when a "
+         "connection is closed by the other end, or when dumped."));
+  m_dump_ring_buffer = new QPushButton(tr("Dump kept traffic"));
+  m_dump_ring_buffer->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
   m_open_dump_folder = new QPushButton(tr("Open dump folder"));
   m_open_dump_folder->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
 
@@ -419,6 +447,17 @@ QGroupBox* NetworkWidget::CreateDumpOptionsGroup()
   dump_options_layout->addWidget(m_dump_root_ca_checkbox);
   dump_options_layout->addWidget(m_dump_peer_cert_checkbox);
   dump_options_layout->addWidget(m_dump_bba_checkbox);
+
+  // i18n: Like the flight recorder of a plane, which keeps what happened last
+  auto* ring_buffer_label = new QLabel(tr("Flight recorder size:"));
+  ring_buffer_label->setBuddy(m_dump_ring_buffer_size);
+  auto* ring_buffer_layout = new QHBoxLayout;
+  ring_buffer_layout->addWidget(ring_buffer_label);
+  ring_buffer_layout->addWidget(m_dump_ring_buffer_size);
+  ring_buffer_layout->addWidget(m_dump_ring_buffer);
+  ring_buffer_layout->addStretch();
+  dump_options_layout->addLayout(ring_buffer_layout);
+
   dump_options_layout->addWidget(m_open_dump_folder);
 
   dump_options_layout->setSpacing(1);
@@ -486,5 +525,7 @@ void NetworkWidget::OnDumpFormatComboChanged(int index)
   m_dump_ssl_read_checkbox->setEnabled(is_pcap);
   m_dump_ssl_write_checkbox->setEnabled(is_pcap);
   m_dump_bba_checkbox->setEnabled(is_pcap);
+  m_dump_ring_buffer_size->setEnabled(is_pcap);
+  m_dump_ring_buffer->setEnabled(is_pcap);
   Config::SetBaseOrCurrent(Config::MAIN_NETWORK_DUMP_AS_PCAP, is_pcap);
 }
@@ -13,6 +13,7 @@ class QComboBox;
 class QGroupBox;
 class QPushButton;
 class QShowEvent;
+class QSpinBox;
 class QTableWidget;
 class QTableWidgetItem;
 
@@ -59,5 +60,7 @@ private:
   QCheckBox* m_dump_peer_cert_checkbox;
   QCheckBox* m_verify_certificates_checkbox;
   QCheckBox* m_dump_bba_checkbox;
+  QSpinBox* m_dump_ring_buffer_size;
+  QPushButton* m_dump_ring_buffer;
   QPushButton* m_open_dump_folder;
 };
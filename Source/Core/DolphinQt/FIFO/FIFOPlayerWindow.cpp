@@ -138,11 +138,13 @@ void FIFOPlayerWindow::CreateWidgets()
   auto* playback_layout = new QGridLayout;
   m_early_memory_updates = new ToolTipCheckBox(tr("Early Memory Updates"));
   m_loop = new ToolTipCheckBox(tr("Loop"));
+  m_benchmark = new ToolTipCheckBox(tr("Benchmark"));
 
   playback_layout->addWidget(object_range_group, 0, 0);
   playback_layout->addWidget(frame_range_group, 0, 1);
   playback_layout->addWidget(m_early_memory_updates, 1, 0);
   playback_layout->addWidget(m_loop, 1, 1);
+  playback_layout->addWidget(m_benchmark, 2, 0);
   playback_group->setLayout(playback_layout);
 
   // Recording Options
@@ -155,8 +157,11 @@ void FIFOPlayerWindow::CreateWidgets()
   m_frame_record_count->setMaximum(3600);
   m_frame_record_count->setValue(3);
 
+  m_compress = new ToolTipCheckBox(tr("Compress"));
+
   recording_layout->addWidget(m_frame_record_count_label);
   recording_layout->addWidget(m_frame_record_count);
+  recording_layout->addWidget(m_compress);
   recording_group->setLayout(recording_layout);
 
   m_button_box = new QDialogButtonBox(QDialogButtonBox::Close);
@@ -196,6 +201,8 @@ void FIFOPlayerWindow::LoadSettings()
 
   m_early_memory_updates->setChecked(Config::Get(Config::MAIN_FIFOPLAYER_EARLY_MEMORY_UPDATES));
   m_loop->setChecked(Config::Get(Config::MAIN_FIFOPLAYER_LOOP_REPLAY));
+  m_benchmark->setChecked(Config::Get(Config::MAIN_FIFOPLAYER_BENCHMARK));
+  m_compress->setChecked(Config::Get(Config::MAIN_FIFOPLAYER_COMPRESS));
 }
 
 void FIFOPlayerWindow::ConnectWidgets()
@@ -207,6 +214,8 @@ void FIFOPlayerWindow::ConnectWidgets()
   connect(m_button_box, &QDialogButtonBox::rejected, this, &FIFOPlayerWindow::hide);
   connect(m_early_memory_updates, &QCheckBox::toggled, this, &FIFOPlayerWindow::OnConfigChanged);
   connect(m_loop, &QCheckBox::toggled, this, &FIFOPlayerWindow::OnConfigChanged);
+  connect(m_benchmark, &QCheckBox::toggled, this, &FIFOPlayerWindow::OnConfigChanged);
+  connect(m_compress, &QCheckBox::toggled, this, &FIFOPlayerWindow::OnConfigChanged);
 
   connect(m_frame_range_from, &QSpinBox::valueChanged, this, &FIFOPlayerWindow::OnLimitsChanged);
   connect(m_frame_range_to, &QSpinBox::valueChanged, this, &FIFOPlayerWindow::OnLimitsChanged);
@@ -225,9 +234,19 @@ void FIFOPlayerWindow::AddDescriptions()
       QT_TR_NOOP("If unchecked, then playback of the fifolog stops after the final frame.<br><br>"
                  "This is generally only useful when a frame-dumping option is enabled.<br><br>"
                  "<dolphin_emphasis>If unsure, leave this checked.</dolphin_emphasis>");
+  static const char TR_BENCHMARK_DESCRIPTION[] = QT_TR_NOOP(
+      "If checked, then the frame range is played back once without any speed limit, and the "
+      "time each frame took is written to FifoBenchmark.json in the Dump folder.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_COMPRESS_DESCRIPTION[] = QT_TR_NOOP(
+      "If checked, then saved FIFO logs are compressed. Compressed FIFO logs can't be loaded by "
+      "older versions of Dolphin.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
 
   m_early_memory_updates->SetDescription(tr(TR_MEMORY_UPDATES_DESCRIPTION));
   m_loop->SetDescription(tr(TR_LOOP_DESCRIPTION));
+  m_benchmark->SetDescription(tr(TR_BENCHMARK_DESCRIPTION));
+  m_compress->SetDescription(tr(TR_COMPRESS_DESCRIPTION));
 }
 
 void FIFOPlayerWindow::LoadRecording()
@@ -251,7 +270,7 @@ void FIFOPlayerWindow::SaveRecording()
 
   FifoDataFile* file = m_fifo_recorder.GetRecordedFile();
 
-  bool result = file->Save(path.toStdString());
+  bool result = file->Save(path.toStdString(), Config::Get(Config::MAIN_FIFOPLAYER_COMPRESS));
 
   if (!result)
   {
@@ -368,6 +387,8 @@ void FIFOPlayerWindow::OnConfigChanged()
   Config::SetBase(Config::MAIN_FIFOPLAYER_EARLY_MEMORY_UPDATES,
                   m_early_memory_updates->isChecked());
   Config::SetBase(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, m_loop->isChecked());
+  Config::SetBase(Config::MAIN_FIFOPLAYER_BENCHMARK, m_benchmark->isChecked());
+  Config::SetBase(Config::MAIN_FIFOPLAYER_COMPRESS, m_compress->isChecked());
 }
 
 void FIFOPlayerWindow::OnLimitsChanged()
@@ -5,6 +5,8 @@
 
 #include "DolphinQt/GBAHost.h"
 
+#include <utility>
+
 #include <QApplication>
 
 #include "Core/HW/GBACore.h"
@@ -40,8 +42,20 @@ void GBAHost::GameChanged()
 
 void GBAHost::FrameEnded(const std::vector<u32>& video_buffer)
 {
-  QueueOnObject(m_widget_controller, [widget_controller = m_widget_controller, video_buffer] {
-    widget_controller->FrameEnded(video_buffer);
+  {
+    std::lock_guard lk(m_frames->lock);
+    m_frames->pending.assign(video_buffer.begin(), video_buffer.end());
+    if (std::exchange(m_frames->queued, true))
+      return;
+  }
+
+  QueueOnObject(m_widget_controller, [widget_controller = m_widget_controller, frames = m_frames] {
+    {
+      std::lock_guard lk(frames->lock);
+      std::swap(frames->pending, frames->displayed);
+      frames->queued = false;
+    }
+    widget_controller->FrameEnded(frames->displayed);
   });
 }
 
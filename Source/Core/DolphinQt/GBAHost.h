@@ -5,6 +5,8 @@
 
 #ifdef HAS_LIBMGBA
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "Core/Host.h"
@@ -25,7 +27,18 @@ public:
   void FrameEnded(const std::vector<u32>& video_buffer) override;
 
 private:
+  // Frames are copied into pending, which the GUI thread swaps with displayed when it gets to them.
+  // A frame that it hasn't gotten to yet is replaced instead of queueing another one.
+  struct FrameSlots
+  {
+    std::mutex lock;
+    std::vector<u32> pending;
+    std::vector<u32> displayed;
+    bool queued = false;
+  };
+
   GBAWidgetController* m_widget_controller{};
   std::weak_ptr<HW::GBA::Core> m_core;
+  std::shared_ptr<FrameSlots> m_frames = std::make_shared<FrameSlots>();
 };
 #endif  // HAS_LIBMGBA
@@ -111,17 +111,33 @@ void GBAWidget::GameChanged(const HW::GBA::CoreInfo& info)
 
 void GBAWidget::SetVideoBuffer(std::span<const u32> video_buffer)
 {
-  m_previous_frame = std::move(m_last_frame);
-  if (video_buffer.size() == static_cast<size_t>(m_core_info.width * m_core_info.height))
+  // The image painted two frames ago is reused, instead of allocating a new one for every frame.
+  std::swap(m_previous_frame, m_last_frame);
+
+  const int width = static_cast<int>(m_core_info.width);
+  const int height = static_cast<int>(m_core_info.height);
+  if (video_buffer.size() != static_cast<size_t>(width * height))
   {
-    m_last_frame = QImage(reinterpret_cast<const uchar*>(video_buffer.data()), m_core_info.width,
-                          m_core_info.height, QImage::Format_ARGB32)
-                       .convertToFormat(QImage::Format_RGB32)
-                       .rgbSwapped();
+    m_last_frame = QImage();
+    update();
+    return;
   }
-  else
+
+  if (m_last_frame.size() != QSize(width, height) ||
+      m_last_frame.format() != QImage::Format_RGB32)
   {
-    m_last_frame = QImage();
+    m_last_frame = QImage(width, height, QImage::Format_RGB32);
+  }
+
+  // The core outputs XBGR8888
+  for (int y = 0; y < height; ++y)
+  {
+    u32* const line = reinterpret_cast<u32*>(m_last_frame.scanLine(y));
+    for (int x = 0; x < width; ++x)
+    {
+      const u32 pixel = video_buffer[y * width + x];
+      line[x] = 0xFF000000 | ((pixel & 0xFF) << 16) | (pixel & 0xFF00) | ((pixel >> 16) & 0xFF);
+    }
   }
   update();
 }
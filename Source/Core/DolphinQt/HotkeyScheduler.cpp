@@ -44,6 +44,7 @@
 #include "InputCommon/ControllerInterface/ControllerInterface.h"
 
 #include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -258,6 +259,9 @@ void HotkeyScheduler::Run()
       if (IsHotkey(HK_REQUEST_GOLF_CONTROL))
         emit RequestGolfControl();
 
+      if (IsHotkey(HK_DUMP_RECENT_FRAME_TIMINGS))
+        g_perf_metrics.DumpRecentFrameTimings();
+
       if (IsHotkey(HK_EXPORT_RECORDING))
         emit ExportRecording();
 
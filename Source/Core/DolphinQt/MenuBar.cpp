@@ -3,8 +3,10 @@
 
 #include "DolphinQt/MenuBar.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <future>
+#include <limits>
 
 #include <QAction>
 #include <QActionGroup>
@@ -144,6 +146,7 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
   {
     m_recording_stop->setEnabled(false);
     m_recording_export->setEnabled(false);
+    m_recording_seek->setEnabled(false);
   }
   const bool can_start_from_boot = m_game_selected && state == Core::State::Uninitialized;
   const bool can_start_from_savestate =
@@ -164,6 +167,7 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
   m_jit_search_instruction->setEnabled(running);
   m_jit_wipe_profiling_data->setEnabled(jit_exists);
   m_jit_write_cache_log_dump->setEnabled(jit_exists);
+  m_jit_write_profile_dump->setEnabled(jit_exists);
 
   // Symbols
   m_symbols->setEnabled(running);
@@ -241,6 +245,34 @@ void MenuBar::OnWriteJitBlockLogDump()
   }
 }
 
+void MenuBar::OnWriteJitBlockProfileDump()
+{
+  const std::string filename =
+      fmt::format("{}{}.folded", File::GetUserPath(D_DUMPDEBUG_JITBLOCKS_IDX),
+                  SConfig::GetInstance().GetGameID());
+  File::IOFile f(filename, "w");
+  if (!f)
+  {
+    ModalMessageBox::warning(
+        this, tr("Error"),
+        tr("Failed to open \"%1\" for writing.").arg(QString::fromStdString(filename)));
+    return;
+  }
+  auto& system = Core::System::GetInstance();
+  if (system.GetJitInterface().JitBlockProfileDump(Core::CPUThreadGuard{system}, f.GetHandle()) ==
+      0)
+  {
+    f.Close();
+    File::Delete(filename);
+    ModalMessageBox::warning(this, tr("Error"),
+                             tr("No JIT block has been profiled. Enable JIT block profiling and "
+                                "run the game before writing the profile."));
+    return;
+  }
+  ModalMessageBox::information(this, tr("Success"),
+                               tr("Wrote to \"%1\".").arg(QString::fromStdString(filename)));
+}
+
 void MenuBar::AddFileMenu()
 {
   QMenu* file_menu = addMenu(tr("&File"));
@@ -825,11 +857,13 @@ void MenuBar::AddMovieMenu()
                                            [this] { emit StopRecording(); });
   m_recording_export =
       movie_menu->addAction(tr("Export Recording..."), this, [this] { emit ExportRecording(); });
+  m_recording_seek = movie_menu->addAction(tr("Seek to Frame..."), this, &MenuBar::SeekRecording);
 
   m_recording_start->setEnabled(false);
   m_recording_play->setEnabled(false);
   m_recording_stop->setEnabled(false);
   m_recording_export->setEnabled(false);
+  m_recording_seek->setEnabled(false);
 
   m_recording_read_only = movie_menu->addAction(tr("&Read-Only Mode"));
   m_recording_read_only->setCheckable(true);
@@ -855,6 +889,12 @@ void MenuBar::AddMovieMenu()
 
   movie_menu->addAction(tr("Customize Movie Window"), this, &MenuBar::ConfigureOSD);
 
+  auto* save_keyframes = movie_menu->addAction(tr("Save Keyframes for Seeking"));
+  save_keyframes->setCheckable(true);
+  save_keyframes->setChecked(Config::Get(Config::MAIN_MOVIE_SAVE_KEYFRAMES));
+  connect(save_keyframes, &QAction::toggled,
+          [](bool value) { Config::SetBaseOrCurrent(Config::MAIN_MOVIE_SAVE_KEYFRAMES, value); });
+
   movie_menu->addSeparator();
 
   auto* dump_frames = movie_menu->addAction(tr("Dump Frames"));
@@ -944,6 +984,8 @@ void MenuBar::AddJITMenu()
                                                &MenuBar::OnWipeJitBlockProfilingData);
   m_jit_write_cache_log_dump =
       m_jit->addAction(tr("Write JIT Block Log Dump"), this, &MenuBar::OnWriteJitBlockLogDump);
+  m_jit_write_profile_dump = m_jit->addAction(tr("Write JIT Block Profile for Flame Graphs"), this,
+                                              &MenuBar::OnWriteJitBlockProfileDump);
 
   m_jit->addSeparator();
 
@@ -1422,6 +1464,19 @@ void MenuBar::OnRecordingStatusChanged(bool recording)
   m_recording_start->setEnabled(!recording && (can_start_from_boot || can_start_from_savestate));
   m_recording_stop->setEnabled(recording);
   m_recording_export->setEnabled(recording);
+  m_recording_seek->setEnabled(recording);
+}
+
+void MenuBar::SeekRecording()
+{
+  auto& movie = Core::System::GetInstance().GetMovie();
+  bool good;
+  const int frame = QInputDialog::getInt(
+      this, tr("Seek to Frame"), tr("Frame:"), static_cast<int>(movie.GetCurrentFrame()), 0,
+      static_cast<int>(std::min<u64>(movie.GetTotalFrames(), std::numeric_limits<int>::max())), 1,
+      &good);
+  if (good)
+    movie.SeekToFrame(static_cast<u64>(frame));
 }
 
 void MenuBar::OnReadOnlyModeChanged(bool read_only)
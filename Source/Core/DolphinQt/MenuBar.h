@@ -195,10 +195,12 @@ private:
 
   void OnSelectionChanged(std::shared_ptr<const UICommon::GameFile> game_file);
   void OnRecordingStatusChanged(bool recording);
+  void SeekRecording();
   void OnReadOnlyModeChanged(bool read_only);
   void OnDebugModeToggled(bool enabled);
   void OnWipeJitBlockProfilingData();
   void OnWriteJitBlockLogDump();
+  void OnWriteJitBlockProfileDump();
 
   QString GetSignatureSelector() const;
 
@@ -254,6 +256,7 @@ private:
   QAction* m_recording_start;
   QAction* m_recording_stop;
   QAction* m_recording_read_only;
+  QAction* m_recording_seek;
   QAction* m_movie_window;
 
   // Options
@@ -291,6 +294,7 @@ private:
   QAction* m_jit_profile_blocks;
   QAction* m_jit_wipe_profiling_data;
   QAction* m_jit_write_cache_log_dump;
+  QAction* m_jit_write_profile_dump;
   QAction* m_jit_off;
   QAction* m_jit_loadstore_off;
   QAction* m_jit_loadstore_lbzx_off;
@@ -29,6 +29,7 @@
 
 #include "Common/CommonPaths.h"
 #include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
 #include "Common/HttpRequest.h"
 #include "Common/Logging/Log.h"
 #include "Common/TraversalClient.h"
@@ -43,6 +44,7 @@
 #include "Core/HW/GBACore.h"
 #endif
 #include "Core/IOS/FS/FileSystem.h"
+#include "Core/NetPlayCommon.h"
 #include "Core/NetPlayServer.h"
 #include "Core/SyncIdentifier.h"
 #include "Core/System.h"
@@ -173,6 +175,11 @@ void NetPlayDialog::CreateMainLayout()
 
   m_sync_codes_action = m_data_menu->addAction(tr("Sync AR/Gecko Codes"));
   m_sync_codes_action->setCheckable(true);
+  m_transfer_games_action = m_data_menu->addAction(tr("Send Game to Players Without It"));
+  m_transfer_games_action->setToolTip(
+      tr("Players that don't have the selected game are sent a scrubbed RVZ of the host's copy. "
+         "This can take a long time for large games, and uses as much memory as the RVZ is big."));
+  m_transfer_games_action->setCheckable(true);
   m_strict_settings_sync_action = m_data_menu->addAction(tr("Strict Settings Sync"));
   m_strict_settings_sync_action->setToolTip(
       tr("This will sync additional graphics settings, and force everyone to the same internal "
@@ -232,6 +239,11 @@ void NetPlayDialog::CreateMainLayout()
   m_golf_mode_overlay_action->setCheckable(true);
   m_hide_remote_gbas_action = m_other_menu->addAction(tr("Hide Remote GBAs"));
   m_hide_remote_gbas_action->setCheckable(true);
+  m_accept_games_action = m_other_menu->addAction(tr("Accept Games from the Host"));
+  m_accept_games_action->setToolTip(
+      tr("If the host sends the selected game to players without it, it is saved in Dolphin's "
+         "cache folder. Takes effect the next time the host selects a game."));
+  m_accept_games_action->setCheckable(true);
 
   m_game_button->setDefault(false);
   m_game_button->setAutoDefault(false);
@@ -416,6 +428,7 @@ void NetPlayDialog::ConnectWidgets()
   connect(m_savedata_load_and_write_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_savedata_all_wii_saves_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_sync_codes_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
+  connect(m_transfer_games_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_record_input_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_strict_settings_sync_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_host_input_authority_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
@@ -423,6 +436,7 @@ void NetPlayDialog::ConnectWidgets()
   connect(m_golf_mode_overlay_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_fixed_delay_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_hide_remote_gbas_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
+  connect(m_accept_games_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
 }
 
 void NetPlayDialog::SendMessage(const std::string& msg)
@@ -859,6 +873,7 @@ void NetPlayDialog::SetOptionsEnabled(bool enabled)
     m_savedata_load_and_write_action->setEnabled(enabled);
     m_savedata_all_wii_saves_action->setEnabled(enabled);
     m_sync_codes_action->setEnabled(enabled);
+    m_transfer_games_action->setEnabled(enabled);
     m_assign_ports_button->setEnabled(enabled);
     m_strict_settings_sync_action->setEnabled(enabled);
     m_host_input_authority_action->setEnabled(enabled);
@@ -1075,8 +1090,22 @@ NetPlayDialog::FindGameFile(const NetPlay::SyncIdentifier& sync_identifier,
         }
         return static_cast<std::shared_ptr<const UICommon::GameFile>>(nullptr);
       });
-  if (game_file)
+  if (game_file && *game_file)
     return *game_file;
+
+  // A game the host sent isn't in the game list unless its folder happens to be.
+  const std::string transferred_path = NetPlay::GetTransferredGamePath(sync_identifier);
+  if (File::Exists(transferred_path))
+  {
+    auto file = std::make_shared<const UICommon::GameFile>(transferred_path);
+    if (file->IsValid() &&
+        file->CompareSyncIdentifier(sync_identifier) == NetPlay::SyncIdentifierComparison::SameGame)
+    {
+      *found = NetPlay::SyncIdentifierComparison::SameGame;
+      return file;
+    }
+  }
+
   return nullptr;
 }
 
@@ -1132,6 +1161,8 @@ void NetPlayDialog::LoadSettings()
   const bool savedata_write = Config::Get(Config::NETPLAY_SAVEDATA_WRITE);
   const bool sync_all_wii_saves = Config::Get(Config::NETPLAY_SAVEDATA_SYNC_ALL_WII);
   const bool sync_codes = Config::Get(Config::NETPLAY_SYNC_CODES);
+  const bool transfer_games = Config::Get(Config::NETPLAY_TRANSFER_GAMES);
+  const bool accept_games = Config::Get(Config::NETPLAY_ACCEPT_GAME_TRANSFERS);
   const bool record_inputs = Config::Get(Config::NETPLAY_RECORD_INPUTS);
   const bool strict_settings_sync = Config::Get(Config::NETPLAY_STRICT_SETTINGS_SYNC);
   const bool golf_mode_overlay = Config::Get(Config::NETPLAY_GOLF_MODE_OVERLAY);
@@ -1148,6 +1179,8 @@ void NetPlayDialog::LoadSettings()
   m_savedata_all_wii_saves_action->setChecked(sync_all_wii_saves);
 
   m_sync_codes_action->setChecked(sync_codes);
+  m_transfer_games_action->setChecked(transfer_games);
+  m_accept_games_action->setChecked(accept_games);
   m_record_input_action->setChecked(record_inputs);
   m_strict_settings_sync_action->setChecked(strict_settings_sync);
   m_golf_mode_overlay_action->setChecked(golf_mode_overlay);
@@ -1191,6 +1224,8 @@ void NetPlayDialog::SaveSettings()
   Config::SetBase(Config::NETPLAY_SAVEDATA_SYNC_ALL_WII,
                   m_savedata_all_wii_saves_action->isChecked());
   Config::SetBase(Config::NETPLAY_SYNC_CODES, m_sync_codes_action->isChecked());
+  Config::SetBase(Config::NETPLAY_TRANSFER_GAMES, m_transfer_games_action->isChecked());
+  Config::SetBase(Config::NETPLAY_ACCEPT_GAME_TRANSFERS, m_accept_games_action->isChecked());
   Config::SetBase(Config::NETPLAY_RECORD_INPUTS, m_record_input_action->isChecked());
   Config::SetBase(Config::NETPLAY_STRICT_SETTINGS_SYNC, m_strict_settings_sync_action->isChecked());
   Config::SetBase(Config::NETPLAY_GOLF_MODE_OVERLAY, m_golf_mode_overlay_action->isChecked());
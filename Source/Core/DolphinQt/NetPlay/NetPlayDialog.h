@@ -152,6 +152,7 @@ private:
   QAction* m_savedata_all_wii_saves_action;
 
   QAction* m_sync_codes_action;
+  QAction* m_transfer_games_action;
   QAction* m_record_input_action;
   QAction* m_strict_settings_sync_action;
   QAction* m_host_input_authority_action;
@@ -159,6 +160,7 @@ private:
   QAction* m_golf_mode_overlay_action;
   QAction* m_fixed_delay_action;
   QAction* m_hide_remote_gbas_action;
+  QAction* m_accept_games_action;
   QPushButton* m_quit_button;
   QSplitter* m_splitter;
   QActionGroup* m_network_mode_group;
@@ -183,6 +183,7 @@ void AudioPane::CreateWidgets()
   audio_buffer_size_label->setFixedWidth(QFontMetrics(font()).boundingRect(tr(" 000 ms")).width());
 
   m_audio_fill_gaps = new ConfigBool(tr("Fill Audio Gaps"), Config::MAIN_AUDIO_FILL_GAPS);
+  m_audio_low_latency = new ConfigBool(tr("Low Latency"), Config::MAIN_AUDIO_LOW_LATENCY);
 
   m_speed_up_mute_enable = new ConfigBool(tr("Mute When Disabling Speed Limit"),
                                           Config::MAIN_AUDIO_MUTE_ON_DISABLED_SPEED_LIMIT);
@@ -195,8 +196,9 @@ void AudioPane::CreateWidgets()
 
   playback_layout->addLayout(buffer_layout, 0, 0);
   playback_layout->addWidget(m_audio_fill_gaps, 1, 0);
-  playback_layout->addWidget(m_speed_up_mute_enable, 2, 0);
-  playback_layout->setRowStretch(3, 1);
+  playback_layout->addWidget(m_audio_low_latency, 2, 0);
+  playback_layout->addWidget(m_speed_up_mute_enable, 3, 0);
+  playback_layout->setRowStretch(4, 1);
   playback_box->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
 
   auto* const main_vbox_layout = new QVBoxLayout;
@@ -320,6 +322,11 @@ void AudioPane::AddDescriptions()
   static const char TR_FILL_AUDIO_GAPS_DESCRIPTION[] = QT_TR_NOOP(
       "Repeat existing audio during lag spikes to prevent stuttering.<br><br><dolphin_emphasis>If "
       "unsure, leave this checked.</dolphin_emphasis>");
+  static const char TR_LOW_LATENCY_DESCRIPTION[] = QT_TR_NOOP(
+      "Buffers only as much audio as the timing of the audio backend and the emulation have needed "
+      "over the last few seconds, never more than the audio buffer size. This lowers latency, but "
+      "may cause crackling when either one has a hiccup.<br><br><dolphin_emphasis>If unsure, "
+      "leave this unchecked.</dolphin_emphasis>");
   static const char TR_SPEED_UP_MUTE_DESCRIPTION[] =
       QT_TR_NOOP("Mutes the audio when overriding the emulation speed limit (default hotkey: Tab). "
                  "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
@@ -360,4 +367,7 @@ void AudioPane::AddDescriptions()
 
   m_audio_fill_gaps->SetTitle(tr("Fill Audio Gaps"));
   m_audio_fill_gaps->SetDescription(tr(TR_FILL_AUDIO_GAPS_DESCRIPTION));
+
+  m_audio_low_latency->SetTitle(tr("Low Latency"));
+  m_audio_low_latency->SetDescription(tr(TR_LOW_LATENCY_DESCRIPTION));
 }
@@ -89,9 +89,12 @@ void OnScreenDisplayPane::CreateLayout()
 
   m_show_ping = new ConfigBool(tr("Show NetPlay Ping"), Config::GFX_SHOW_NETPLAY_PING);
   m_show_chat = new ConfigBool(tr("Show NetPlay Chat"), Config::GFX_SHOW_NETPLAY_MESSAGES);
+  m_show_netplay_stats =
+      new ConfigBool(tr("Show NetPlay Connection Stats"), Config::GFX_SHOW_NETPLAY_STATS);
 
   netplay_layout->addWidget(m_show_ping, 0, 0);
   netplay_layout->addWidget(m_show_chat, 0, 1);
+  netplay_layout->addWidget(m_show_netplay_stats, 1, 0);
 
   // Debug
   auto* debug_box = new QGroupBox(tr("Debug"));
@@ -184,6 +187,11 @@ void OnScreenDisplayPane::AddDescriptions()
   static const char TR_SHOW_NETPLAY_PING_DESCRIPTION[] = QT_TR_NOOP(
       "Shows the player's maximum ping while playing on "
       "NetPlay.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_SHOW_NETPLAY_STATS_DESCRIPTION[] = QT_TR_NOOP(
+      "Shows every player's ping percentiles, jitter and packet loss, and the pad buffer, "
+      "stalled frames, traffic and retransmits of this connection, updated every second while "
+      "playing on NetPlay.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
   static const char TR_SHOW_NETPLAY_MESSAGES_DESCRIPTION[] =
       QT_TR_NOOP("Shows chat messages, buffer changes, and desync alerts "
                  "while playing NetPlay.<br><br><dolphin_emphasis>If unsure, leave "
@@ -232,6 +240,7 @@ void OnScreenDisplayPane::AddDescriptions()
 
   m_show_ping->SetDescription(tr(TR_SHOW_NETPLAY_PING_DESCRIPTION));
   m_show_chat->SetDescription(tr(TR_SHOW_NETPLAY_MESSAGES_DESCRIPTION));
+  m_show_netplay_stats->SetDescription(tr(TR_SHOW_NETPLAY_STATS_DESCRIPTION));
 
   m_movie_window->SetDescription(tr(TR_MOVIE_WINDOW_DESCRIPTION));
   m_rerecord_counter->SetDescription(tr(TR_RERECORD_COUNTER_DESCRIPTION));
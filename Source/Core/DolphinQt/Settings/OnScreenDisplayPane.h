@@ -44,6 +44,7 @@ private:
   // Netplay
   ConfigBool* m_show_ping;
   ConfigBool* m_show_chat;
+  ConfigBool* m_show_netplay_stats;
 
   // Debug
   ConfigBool* m_show_statistics;
@@ -3,9 +3,14 @@
 
 #include "DolphinTool/ConvertCommand.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <future>
 #include <iostream>
 #include <limits>
+#include <list>
+#include <map>
 #include <optional>
 #include <string>
 #include <vector>
@@ -14,7 +19,11 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/ScrubbedBlob.h"
@@ -56,6 +65,167 @@ static std::optional<DiscIO::BlobType> ParseFormatString(const std::string& form
   return std::nullopt;
 }
 
+static std::string GetFormatExtension(DiscIO::BlobType format)
+{
+  switch (format)
+  {
+  case DiscIO::BlobType::GCZ:
+    return ".gcz";
+  case DiscIO::BlobType::WIA:
+    return ".wia";
+  case DiscIO::BlobType::RVZ:
+    return ".rvz";
+  default:
+    return ".iso";
+  }
+}
+
+struct ConvertSettings
+{
+  DiscIO::BlobType format;
+  bool scrub;
+  std::optional<int> block_size;
+  std::optional<DiscIO::WIARVZCompressionType> compression;
+  std::optional<int> compression_level;
+};
+
+// Writes to a temporary file that is renamed once the conversion is done, so that an output
+// under the real name is always complete.
+static bool ConvertFile(const std::string& input_file_path, const std::string& output_file_path,
+                        const ConvertSettings& settings)
+{
+  const DiscIO::BlobType format = settings.format;
+  const bool scrub = settings.scrub;
+
+  // Open the blob reader
+  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
+  if (!blob_reader)
+  {
+    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
+    return false;
+  }
+
+  // Open the volume
+  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
+  if (!volume)
+  {
+    if (scrub)
+    {
+      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
+      return false;
+    }
+
+    fmt::print(std::cerr,
+               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
+  }
+
+  if (scrub)
+  {
+    if (volume->IsDatelDisc())
+    {
+      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
+      return false;
+    }
+
+    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
+
+    if (!blob_reader)
+    {
+      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
+      return false;
+    }
+  }
+
+  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
+      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  {
+    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
+                          "offer space advantages over ISO. Continuing anyway.\n");
+  }
+
+  if (volume && volume->IsNKit())
+  {
+    fmt::print(std::cerr,
+               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
+  }
+
+  if (format == DiscIO::BlobType::GCZ && volume &&
+      !DiscIO::IsGCZBlockSizeLegacyCompatible(settings.block_size.value(), volume->GetDataSize()))
+  {
+    fmt::print(std::cerr,
+               "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
+               "must be an integer multiple of the block size and must not be an integer "
+               "multiple of the block size multiplied by 32. Continuing anyway.\n");
+  }
+
+  // Perform the conversion
+  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
+
+  const std::string partial_file_path = output_file_path + ".part";
+  bool success = false;
+
+  switch (format)
+  {
+  case DiscIO::BlobType::PLAIN:
+  {
+    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, partial_file_path,
+                                     NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::GCZ:
+  {
+    u32 sub_type = std::numeric_limits<u32>::max();
+    if (volume)
+    {
+      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
+        sub_type = 0;
+      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
+        sub_type = 1;
+    }
+    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, partial_file_path,
+                                   sub_type, settings.block_size.value(), NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::WIA:
+  case DiscIO::BlobType::RVZ:
+  {
+    success = DiscIO::ConvertToWIAOrRVZ(
+        blob_reader.get(), input_file_path, partial_file_path, format == DiscIO::BlobType::RVZ,
+        settings.compression.value(), settings.compression_level.value(),
+        settings.block_size.value(), NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  default:
+  {
+    ASSERT(false);
+    break;
+  }
+  }
+
+  if (!success || !File::RenameSync(partial_file_path, output_file_path))
+  {
+    File::Delete(partial_file_path);
+    fmt::print(std::cerr, "Error: Conversion failed\n");
+    return false;
+  }
+
+  return true;
+}
+
+// Lets a batch conversion that was interrupted continue where it stopped.
+static bool IsConvertedFile(const std::string& output_file_path, DiscIO::BlobType format)
+{
+  if (!File::Exists(output_file_path))
+    return false;
+
+  const std::unique_ptr<DiscIO::BlobReader> blob_reader =
+      DiscIO::CreateBlobReader(output_file_path);
+  return blob_reader && blob_reader->GetBlobType() == format;
+}
+
 int ConvertCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
@@ -71,8 +241,9 @@ int ConvertCommand(const std::vector<std::string>& args)
 
   parser.add_option("-i", "--input")
       .type("string")
-      .action("store")
-      .help("Path to disc image FILE.")
+      .action("append")
+      .help("Path to disc image FILE. Can be given more than once, or be a folder, to convert "
+            "several disc images. In that case, the output must be a folder.")
       .metavar("FILE");
 
   parser.add_option("-o", "--output")
@@ -110,6 +281,14 @@ int ConvertCommand(const std::vector<std::string>& args)
       .help("Level of compression for the selected method. Ignored if 'none'. Suggested value for "
             "zstd: 5");
 
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("How many disc images to convert at the same time when converting several. All "
+            "conversions share the same compression threads, so 2 is enough to keep reading "
+            "the next disc image from holding up compression. Default: 2")
+      .set_default(2);
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -125,7 +304,26 @@ int ConvertCommand(const std::vector<std::string>& args)
     fmt::print(std::cerr, "Error: No input set\n");
     return EXIT_FAILURE;
   }
-  const std::string& input_file_path = options["input"];
+
+  static const std::vector<std::string> disc_extensions = {
+      ".gcm", ".tgc", ".bin", ".iso", ".ciso", ".gcz", ".wbfs", ".wia", ".rvz", ".nfs"};
+
+  bool is_batch = false;
+  std::vector<std::string> input_file_paths;
+  for (const std::string& input : options.all("input"))
+  {
+    if (File::IsDirectory(input))
+    {
+      const std::vector<std::string> paths = Common::DoFileSearch({input}, disc_extensions);
+      input_file_paths.insert(input_file_paths.end(), paths.begin(), paths.end());
+      is_batch = true;
+    }
+    else
+    {
+      input_file_paths.push_back(input);
+    }
+  }
+  is_batch |= input_file_paths.size() > 1;
 
   // --output
   if (!options.is_set("output"))
@@ -133,58 +331,33 @@ int ConvertCommand(const std::vector<std::string>& args)
     fmt::print(std::cerr, "Error: No output set\n");
     return EXIT_FAILURE;
   }
-  const std::string& output_file_path = options["output"];
+  const std::string& output_path = options["output"];
 
-  // --format
-  const std::optional<DiscIO::BlobType> format_o = ParseFormatString(options["format"]);
-  if (!format_o.has_value())
+  if (is_batch && File::Exists(output_path) && !File::IsDirectory(output_path))
   {
-    fmt::print(std::cerr, "Error: No output format set\n");
+    fmt::print(std::cerr, "Error: The output must be a folder when converting several files\n");
     return EXIT_FAILURE;
   }
-  const DiscIO::BlobType format = format_o.value();
 
-  // Open the blob reader
-  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
-  if (!blob_reader)
+  // --jobs
+  const int jobs = static_cast<int>(options.get("jobs"));
+  if (jobs < 1)
   {
-    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
+    fmt::print(std::cerr, "Error: Jobs must be at least 1\n");
     return EXIT_FAILURE;
   }
 
-  // --scrub
-  const bool scrub = static_cast<bool>(options.get("scrub"));
-
-  // Open the volume
-  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
-  if (!volume)
+  // --format
+  const std::optional<DiscIO::BlobType> format_o = ParseFormatString(options["format"]);
+  if (!format_o.has_value())
   {
-    if (scrub)
-    {
-      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
-      return EXIT_FAILURE;
-    }
-
-    fmt::print(std::cerr,
-               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
+    fmt::print(std::cerr, "Error: No output format set\n");
+    return EXIT_FAILURE;
   }
+  const DiscIO::BlobType format = format_o.value();
 
-  if (scrub)
-  {
-    if (volume->IsDatelDisc())
-    {
-      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
-      return EXIT_FAILURE;
-    }
-
-    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
-
-    if (!blob_reader)
-    {
-      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
-      return EXIT_FAILURE;
-    }
-  }
+  // --scrub
+  const bool scrub = static_cast<bool>(options.get("scrub"));
 
   if (scrub && format == DiscIO::BlobType::RVZ)
   {
@@ -198,19 +371,6 @@ int ConvertCommand(const std::vector<std::string>& args)
                           "using external compression. Continuing anyway.\n");
   }
 
-  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
-      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
-  {
-    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
-                          "offer space advantages over ISO. Continuing anyway.\n");
-  }
-
-  if (volume && volume->IsNKit())
-  {
-    fmt::print(std::cerr,
-               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
-  }
-
   // --block_size
   std::optional<int> block_size_o;
   if (options.is_set("block_size"))
@@ -237,15 +397,6 @@ int ConvertCommand(const std::vector<std::string>& args)
       fmt::print(std::cerr,
                  "Warning: Block size is not ideal for performance. Continuing anyway.\n");
     }
-
-    if (format == DiscIO::BlobType::GCZ && volume &&
-        !DiscIO::IsGCZBlockSizeLegacyCompatible(block_size_o.value(), volume->GetDataSize()))
-    {
-      fmt::print(std::cerr,
-                 "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
-                 "must be an integer multiple of the block size and must not be an integer "
-                 "multiple of the block size multiplied by 32. Continuing anyway.\n");
-    }
   }
 
   // --compress, --compress_level
@@ -296,58 +447,75 @@ int ConvertCommand(const std::vector<std::string>& args)
     }
   }
 
-  // Perform the conversion
-  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
-
-  bool success = false;
+  const ConvertSettings settings{format, scrub, block_size_o, compression_o, compression_level_o};
 
-  switch (format)
+  if (!is_batch)
   {
-  case DiscIO::BlobType::PLAIN:
+    return ConvertFile(input_file_paths.front(), output_path, settings) ? EXIT_SUCCESS :
+                                                                          EXIT_FAILURE;
+  }
+
+  if (!File::CreateFullPath(output_path + DIR_SEP))
   {
-    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
-                                     NOOP_STATUS_CALLBACK);
-    break;
+    fmt::print(std::cerr, "Error: The output folder could not be created\n");
+    return EXIT_FAILURE;
   }
 
-  case DiscIO::BlobType::GCZ:
+  std::vector<std::pair<std::string, std::string>> conversions;
+  // Inputs whose names only differ in the extension, like Game.iso and Game.gcz, would be converted
+  // into the same file. Compared without case, as the output folder may not tell them apart.
+  std::map<std::string, std::string> inputs_by_output;
+  for (const std::string& input_file_path : input_file_paths)
   {
-    u32 sub_type = std::numeric_limits<u32>::max();
-    if (volume)
+    std::string name;
+    SplitPath(input_file_path, nullptr, &name, nullptr);
+    std::string output_file_path = output_path + DIR_SEP + name + GetFormatExtension(format);
+
+    std::string output_key = output_file_path;
+    Common::ToLower(&output_key);
+    const auto [other, inserted] = inputs_by_output.emplace(std::move(output_key), input_file_path);
+    if (!inserted)
     {
-      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
-        sub_type = 0;
-      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
-        sub_type = 1;
+      fmt::print(std::cerr, "Error: {} and {} would both be converted to {}\n", other->second,
+                 input_file_path, output_file_path);
+      return EXIT_FAILURE;
     }
-    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
-                                   block_size_o.value(), NOOP_STATUS_CALLBACK);
-    break;
-  }
 
-  case DiscIO::BlobType::WIA:
-  case DiscIO::BlobType::RVZ:
-  {
-    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
-                                        format == DiscIO::BlobType::RVZ, compression_o.value(),
-                                        compression_level_o.value(), block_size_o.value(),
-                                        NOOP_STATUS_CALLBACK);
-    break;
-  }
+    if (IsConvertedFile(output_file_path, format))
+    {
+      fmt::print(std::cout, "Skipping {}, it has already been converted\n", input_file_path);
+      continue;
+    }
 
-  default:
-  {
-    ASSERT(false);
-    break;
-  }
+    conversions.emplace_back(input_file_path, std::move(output_file_path));
   }
 
-  if (!success)
-  {
-    fmt::print(std::cerr, "Error: Conversion failed\n");
-    return EXIT_FAILURE;
-  }
+  std::atomic<size_t> next_conversion = 0;
+  std::atomic<bool> success = true;
+  const auto convert_files = [&] {
+    for (size_t i = next_conversion++; i < conversions.size(); i = next_conversion++)
+    {
+      const auto& [input_file_path, output_file_path] = conversions[i];
+      if (!ConvertFile(input_file_path, output_file_path, settings))
+      {
+        fmt::print(std::cerr, "Error: Failed to convert {}\n", input_file_path);
+        success = false;
+      }
+      else
+      {
+        fmt::print(std::cout, "Converted {}\n", input_file_path);
+      }
+    }
+  };
+
+  std::vector<std::future<void>> workers;
+  const size_t worker_count = std::min<size_t>(jobs, conversions.size());
+  for (size_t i = 1; i < worker_count; ++i)
+    workers.push_back(std::async(std::launch::async, convert_files));
+  convert_files();
+  for (std::future<void>& worker : workers)
+    worker.wait();
 
-  return EXIT_SUCCESS;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 }  // namespace DolphinTool
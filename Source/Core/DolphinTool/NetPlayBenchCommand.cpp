@@ -0,0 +1,692 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/NetPlayBenchCommand.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <OptionParser.h>
+#include <SFML/Network/Packet.hpp>
+#include <enet/enet.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/ENet.h"
+#include "Common/SFMLHelper.h"
+#include "Common/Thread.h"
+#include "Common/Version.h"
+#include "Core/Config/NetplaySettings.h"
+#include "Core/NetPlayClient.h"
+#include "Core/NetPlayCommon.h"
+#include "Core/NetPlayProto.h"
+#include "Core/NetPlayServer.h"
+#include "UICommon/GameFile.h"
+#include "UICommon/UICommon.h"
+
+namespace DolphinTool
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr auto JOIN_TIMEOUT = std::chrono::seconds(10);
+
+// Hosts the game for the bench clients when no server to join is given. There is no local player,
+// so the first clients that join get the controllers.
+class BenchUI final : public NetPlay::NetPlayUI
+{
+public:
+  explicit BenchUI(std::shared_ptr<const UICommon::GameFile> game) : m_game(std::move(game)) {}
+
+  void BootGame(const std::string&, std::unique_ptr<BootSessionData>) override {}
+  void StopGame() override {}
+  bool IsHosting() const override { return true; }
+
+  void Update() override {}
+  void AppendChat(const std::string&) override {}
+
+  void OnMsgChangeGame(const NetPlay::SyncIdentifier&, const std::string&) override {}
+  void OnMsgChangeGBARom(int, const NetPlay::GBAConfig&) override {}
+  void OnMsgStartGame() override {}
+  void OnMsgStopGame() override {}
+  void OnMsgPowerButton() override {}
+  void OnPlayerConnect(const std::string&) override {}
+  void OnPlayerDisconnect(const std::string&) override {}
+  void OnPadBufferChanged(u32) override {}
+  void OnHostInputAuthorityChanged(bool) override {}
+  void OnDesync(u32, const std::string&) override {}
+  void OnConnectionLost() override {}
+  void OnConnectionError(const std::string&) override {}
+  void OnTraversalError(Common::TraversalClient::FailureReason) override {}
+  void OnTraversalStateChanged(Common::TraversalClient::State) override {}
+  void OnGameStartAborted() override {}
+  void OnGolferChanged(bool, const std::string&) override {}
+  void OnTtlDetermined(u8) override {}
+
+  bool IsRecording() override { return false; }
+  std::shared_ptr<const UICommon::GameFile>
+  FindGameFile(const NetPlay::SyncIdentifier& sync_identifier,
+               NetPlay::SyncIdentifierComparison* found) override
+  {
+    const NetPlay::SyncIdentifierComparison comparison =
+        m_game->CompareSyncIdentifier(sync_identifier);
+    if (found)
+      *found = comparison;
+    return comparison == NetPlay::SyncIdentifierComparison::SameGame ? m_game : nullptr;
+  }
+  std::string FindGBARomPath(const std::array<u8, 20>&, std::string_view, int) override
+  {
+    return {};
+  }
+  void ShowGameDigestDialog(const std::string&) override {}
+  void SetGameDigestProgress(int, int) override {}
+  void SetGameDigestResult(int, const std::string&) override {}
+  void AbortGameDigest() override {}
+
+  void OnIndexAdded(bool, std::string) override {}
+  void OnIndexRefreshFailed(std::string) override {}
+
+  void ShowChunkedProgressDialog(const std::string&, u64, const std::vector<int>&) override {}
+  void HideChunkedProgressDialog() override {}
+  void SetChunkedProgress(int, u64) override {}
+
+  void SetHostWiiSyncData(std::vector<u64>, std::string) override {}
+
+private:
+  std::shared_ptr<const UICommon::GameFile> m_game;
+};
+
+struct BenchContext
+{
+  double loss = 0;
+  std::chrono::microseconds max_jitter{};
+  std::mt19937 rng{std::random_device{}()};
+
+  // When each input of each controller was sent, by the number that the input carries.
+  std::array<std::vector<Clock::time_point>, 4> send_times;
+  // From sending an input until another client got it from the server.
+  std::vector<s64> relay_latencies_us;
+  u64 inputs_sent = 0;
+};
+
+// A player that speaks the NetPlay protocol without emulating anything. It answers what the
+// server waits for, and sends inputs at 60 Hz for the controllers it was given. The number of the
+// frame is put into the inputs, so that the clients that get them know when they were sent.
+class BenchClient
+{
+public:
+  enum class State
+  {
+    Connecting,
+    Joining,
+    Joined,
+    Running,
+    Failed,
+  };
+
+  explicit BenchClient(std::string name) : m_name(std::move(name)) {}
+
+  bool Connect(const ENetAddress& address)
+  {
+    m_host = Common::ENet::ENetHostPtr{enet_host_create(nullptr, 1, NetPlay::CHANNEL_COUNT, 0, 0)};
+    if (!m_host)
+      return false;
+    m_host->mtu = std::min(m_host->mtu, NetPlay::MAX_ENET_MTU);
+
+    m_peer = enet_host_connect(m_host.get(), &address, NetPlay::CHANNEL_COUNT, 0);
+    return m_peer != nullptr;
+  }
+
+  void Disconnect()
+  {
+    if (m_peer && m_state != State::Failed)
+    {
+      enet_peer_disconnect(m_peer, 0);
+      enet_host_flush(m_host.get());
+    }
+    m_peer = nullptr;
+    m_host.reset();
+  }
+
+  void Update(BenchContext& context)
+  {
+    ENetEvent event;
+    while (m_state != State::Failed && enet_host_service(m_host.get(), &event, 0) > 0)
+    {
+      switch (event.type)
+      {
+      case ENET_EVENT_TYPE_CONNECT:
+        OnConnect();
+        break;
+      case ENET_EVENT_TYPE_RECEIVE:
+      {
+        sf::Packet packet;
+        packet.append(event.packet->data, event.packet->dataLength);
+        enet_packet_destroy(event.packet);
+        OnPacket(packet, context);
+        break;
+      }
+      case ENET_EVENT_TYPE_DISCONNECT:
+        Fail("Disconnected from the server");
+        break;
+      default:
+        break;
+      }
+    }
+
+    if (m_state == State::Running)
+      SendInputs(context);
+  }
+
+  State GetState() const { return m_state; }
+  const std::string& GetName() const { return m_name; }
+  const std::string& GetError() const { return m_error; }
+
+private:
+  struct QueuedInputs
+  {
+    Clock::time_point send_time;
+    sf::Packet packet;
+    NetPlay::FrameNum frame;
+    // The controllers that the packet has inputs of, a bit each.
+    u8 pads;
+  };
+
+  void Fail(std::string error)
+  {
+    m_state = State::Failed;
+    m_error = std::move(error);
+  }
+
+  void Send(const sf::Packet& packet)
+  {
+    Common::ENet::SendPacket(m_peer, packet, NetPlay::DEFAULT_CHANNEL,
+                             NetPlay::GetChannelPacketFlags(NetPlay::DEFAULT_CHANNEL));
+  }
+
+  void OnConnect()
+  {
+    sf::Packet packet;
+    packet << Common::GetScmRevGitStr();
+    packet << Common::GetNetplayDolphinVer();
+    packet << m_name;
+    Send(packet);
+    m_state = State::Joining;
+  }
+
+  void OnPacket(sf::Packet& packet, BenchContext& context)
+  {
+    // The answer to joining has no message ID.
+    if (m_state == State::Joining)
+    {
+      NetPlay::ConnectionError error;
+      packet >> error;
+      if (error != NetPlay::ConnectionError::NoError)
+      {
+        Fail(fmt::format("The server refused to let the client join (error {})",
+                         static_cast<u8>(error)));
+        return;
+      }
+
+      packet >> m_pid;
+      m_state = State::Joined;
+      return;
+    }
+
+    NetPlay::MessageID mid;
+    packet >> mid;
+
+    switch (mid)
+    {
+    case NetPlay::MessageID::PadMapping:
+      for (NetPlay::PlayerId& pid : m_pad_map)
+        packet >> pid;
+      break;
+
+    case NetPlay::MessageID::ChangeGame:
+    {
+      // Claiming to have the game keeps the server from sending it.
+      sf::Packet reply;
+      reply << NetPlay::MessageID::GameStatus << NetPlay::SyncIdentifierComparison::SameGame;
+      Send(reply);
+    }
+    break;
+
+    case NetPlay::MessageID::Ping:
+    {
+      u32 ping_key = 0;
+      packet >> ping_key;
+
+      sf::Packet reply;
+      reply << NetPlay::MessageID::Pong << ping_key;
+      Send(reply);
+    }
+    break;
+
+    case NetPlay::MessageID::StartGame:
+    {
+      u32 current_game = 0;
+      packet >> current_game;
+
+      // Without this, the server ignores the inputs as belonging to an earlier game.
+      sf::Packet reply;
+      reply << NetPlay::MessageID::StartGame << current_game;
+      Send(reply);
+
+      m_state = State::Running;
+      m_start_time = Clock::now();
+      m_next_frame = 0;
+      m_last_send_time = {};
+      m_queued_inputs.clear();
+    }
+    break;
+
+    case NetPlay::MessageID::StopGame:
+    case NetPlay::MessageID::DisableGame:
+      if (m_state == State::Running)
+        m_state = State::Joined;
+      break;
+
+    case NetPlay::MessageID::PadData:
+      OnPadData(packet, context);
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  void OnPadData(sf::Packet& packet, BenchContext& context)
+  {
+    const Clock::time_point now = Clock::now();
+    while (!packet.endOfPacket())
+    {
+      NetPlay::PadIndex map;
+      u16 button;
+      u8 analog_a, analog_b, stick_x, stick_y, substick_x, substick_y, trigger_left,
+          trigger_right;
+      bool is_connected;
+      packet >> map >> button >> analog_a >> analog_b >> stick_x >> stick_y >> substick_x >>
+          substick_y >> trigger_left >> trigger_right >> is_connected;
+      if (!packet || map < 0 || map >= 4)
+        return;
+
+      const NetPlay::FrameNum frame = button | (stick_x << 16) | (static_cast<u32>(stick_y) << 24);
+      const std::vector<Clock::time_point>& send_times = context.send_times[map];
+      if (frame >= send_times.size() || send_times[frame] == Clock::time_point{})
+        continue;
+
+      context.relay_latencies_us.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(now - send_times[frame]).count());
+    }
+  }
+
+  void SendInputs(BenchContext& context)
+  {
+    const Clock::time_point now = Clock::now();
+
+    while (m_start_time + std::chrono::microseconds(u64{m_next_frame} * 1000000 / 60) <= now)
+    {
+      const NetPlay::FrameNum frame = m_next_frame++;
+
+      sf::Packet packet;
+      packet << NetPlay::MessageID::PadData;
+      u8 pads = 0;
+      for (NetPlay::PadIndex map = 0; map < 4; ++map)
+      {
+        if (m_pad_map[map] != m_pid)
+          continue;
+
+        pads |= 1 << map;
+        packet << map << static_cast<u16>(frame) << u8{0} << u8{0} << static_cast<u8>(frame >> 16)
+               << static_cast<u8>(frame >> 24) << u8{0x80} << u8{0x80} << u8{0} << u8{0} << true;
+      }
+      if (pads == 0)
+        continue;
+
+      // The inputs are sent reliably, so one that is lost on the way is late instead of missing.
+      // It is sent again after a round trip, and holds up the ones that come after it.
+      Clock::time_point send_time = now;
+      if (context.max_jitter.count() > 0)
+      {
+        std::uniform_int_distribution<s64> jitter(0, context.max_jitter.count());
+        send_time += std::chrono::microseconds(jitter(context.rng));
+      }
+      if (std::uniform_real_distribution<double>(0, 100)(context.rng) < context.loss)
+        send_time += std::chrono::milliseconds(std::max<u32>(m_peer->roundTripTime, 1));
+      send_time = std::max(send_time, m_last_send_time);
+      m_last_send_time = send_time;
+
+      m_queued_inputs.push_back(QueuedInputs{send_time, std::move(packet), frame, pads});
+    }
+
+    while (!m_queued_inputs.empty() && m_queued_inputs.front().send_time <= now)
+    {
+      const QueuedInputs& inputs = m_queued_inputs.front();
+      Send(inputs.packet);
+      for (int map = 0; map < 4; ++map)
+      {
+        if ((inputs.pads & (1 << map)) == 0)
+          continue;
+
+        std::vector<Clock::time_point>& send_times = context.send_times[map];
+        if (send_times.size() <= inputs.frame)
+          send_times.resize(inputs.frame + 1);
+        send_times[inputs.frame] = now;
+        ++context.inputs_sent;
+      }
+      m_queued_inputs.pop_front();
+    }
+  }
+
+  std::string m_name;
+  std::string m_error;
+  State m_state = State::Connecting;
+
+  Common::ENet::ENetHostPtr m_host;
+  ENetPeer* m_peer = nullptr;
+
+  NetPlay::PlayerId m_pid = 0;
+  NetPlay::PadMappingArray m_pad_map{};
+
+  Clock::time_point m_start_time;
+  NetPlay::FrameNum m_next_frame = 0;
+  Clock::time_point m_last_send_time;
+  std::deque<QueuedInputs> m_queued_inputs;
+};
+
+// Runs the clients until all of them are in the given state, or one of them fails.
+bool WaitForClients(std::vector<BenchClient>& clients, BenchContext& context,
+                    BenchClient::State state, std::optional<Clock::time_point> deadline)
+{
+  while (true)
+  {
+    bool done = true;
+    for (BenchClient& client : clients)
+    {
+      client.Update(context);
+      if (client.GetState() == BenchClient::State::Failed)
+      {
+        fmt::print(std::cerr, "Error: {}: {}\n", client.GetName(), client.GetError());
+        return false;
+      }
+      done &= client.GetState() == state;
+    }
+
+    if (done)
+      return true;
+
+    if (deadline && Clock::now() >= *deadline)
+    {
+      fmt::print(std::cerr, "Error: Timed out waiting for the clients\n");
+      return false;
+    }
+
+    Common::SleepCurrentThread(1);
+  }
+}
+
+// The nearest-rank percentile of sorted samples, in milliseconds.
+double GetPercentileMs(const std::vector<s64>& sorted, double percentile)
+{
+  const size_t rank = static_cast<size_t>(std::ceil(percentile / 100 * sorted.size()));
+  return sorted[std::max<size_t>(rank, 1) - 1] / 1000.0;
+}
+}  // namespace
+
+int NetPlayBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: netplaybench [options]...");
+
+  parser.add_option("-u", "--user")
+      .type("string")
+      .action("store")
+      .help("User folder path, required for temporary processing files. "
+            "Will be automatically created if this option is not set.")
+      .set_default("");
+
+  parser.add_option("-g", "--game")
+      .type("string")
+      .action("store")
+      .help("Path to the disc image FILE to host. The clients join a server that hosts it here.")
+      .metavar("FILE");
+
+  parser.add_option("-a", "--address")
+      .type("string")
+      .action("store")
+      .help("Address of a server to join instead of hosting one. Its host has to give the "
+            "clients controllers and start the game.");
+
+  parser.add_option("-p", "--port")
+      .type("int")
+      .action("store")
+      .help("Port of the server to join, or to host on. Default: 2626")
+      .set_default(2626);
+
+  parser.add_option("-n", "--clients")
+      .type("int")
+      .action("store")
+      .help("How many clients join. The first four that join get a controller each, the others "
+            "only receive inputs. Default: 4")
+      .set_default(4);
+
+  parser.add_option("-d", "--duration")
+      .type("int")
+      .action("store")
+      .help("How many seconds to send inputs for. Default: 30")
+      .set_default(30);
+
+  parser.add_option("-l", "--loss")
+      .type("float")
+      .action("store")
+      .help("Percentage of the inputs that are lost on their way to the server. Default: 0")
+      .set_default(0);
+
+  parser.add_option("-j", "--jitter")
+      .type("int")
+      .action("store")
+      .help("Up to how many milliseconds the inputs are held back before they are sent. "
+            "Default: 0")
+      .set_default(0);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  UICommon::SetUserDirectory(options["user"]);
+  UICommon::Init();
+
+  // Validate options
+  const bool join = options.is_set("address");
+  if (join == options.is_set("game"))
+  {
+    fmt::print(std::cerr, "Error: Set either a game to host or an address to join\n");
+    return EXIT_FAILURE;
+  }
+
+  const int port = static_cast<int>(options.get("port"));
+  if (port < 0 || port > 65535 || (join && port == 0))
+  {
+    fmt::print(std::cerr, "Error: Invalid port\n");
+    return EXIT_FAILURE;
+  }
+
+  const int client_count = static_cast<int>(options.get("clients"));
+  if (client_count < 2 || client_count > 254)
+  {
+    fmt::print(std::cerr, "Error: The number of clients must be between 2 and 254\n");
+    return EXIT_FAILURE;
+  }
+
+  const int duration = static_cast<int>(options.get("duration"));
+  if (duration <= 0)
+  {
+    fmt::print(std::cerr, "Error: Invalid duration\n");
+    return EXIT_FAILURE;
+  }
+
+  BenchContext context;
+  context.loss = static_cast<double>(options.get("loss"));
+  if (context.loss < 0 || context.loss >= 100)
+  {
+    fmt::print(std::cerr, "Error: The loss must be at least 0 and less than 100\n");
+    return EXIT_FAILURE;
+  }
+
+  const int jitter = static_cast<int>(options.get("jitter"));
+  if (jitter < 0)
+  {
+    fmt::print(std::cerr, "Error: Invalid jitter\n");
+    return EXIT_FAILURE;
+  }
+  context.max_jitter = std::chrono::milliseconds(jitter);
+
+  if (enet_initialize() != 0)
+  {
+    fmt::print(std::cerr, "Error: Failed to initialize ENet\n");
+    return EXIT_FAILURE;
+  }
+
+  std::shared_ptr<const UICommon::GameFile> game;
+  std::unique_ptr<BenchUI> ui;
+  std::unique_ptr<NetPlay::NetPlayServer> server;
+  ENetAddress address{};
+
+  if (join)
+  {
+    if (enet_address_set_host(&address, options["address"].c_str()) != 0)
+    {
+      fmt::print(std::cerr, "Error: Failed to resolve the address\n");
+      return EXIT_FAILURE;
+    }
+    address.port = static_cast<u16>(port);
+  }
+  else
+  {
+    game = std::make_shared<UICommon::GameFile>(options["game"]);
+    if (!game->IsValid())
+    {
+      fmt::print(std::cerr, "Error: Unable to open the game\n");
+      return EXIT_FAILURE;
+    }
+
+    // These would hold up the start, or keep the inputs from being relayed to everyone.
+    Config::SetCurrent(Config::NETPLAY_SAVEDATA_LOAD, false);
+    Config::SetCurrent(Config::NETPLAY_SYNC_CODES, false);
+    Config::SetCurrent(Config::NETPLAY_DELAYED_SPECTATORS, false);
+    Config::SetCurrent(Config::NETPLAY_NETWORK_MODE, std::string("fixeddelay"));
+
+    ui = std::make_unique<BenchUI>(game);
+    server = std::make_unique<NetPlay::NetPlayServer>(static_cast<u16>(port), false, ui.get(),
+                                                      NetPlay::NetTraversalConfig{});
+    if (!server->is_connected)
+    {
+      fmt::print(std::cerr, "Error: Failed to host on port {}\n", port);
+      return EXIT_FAILURE;
+    }
+    server->ChangeGame(game->GetSyncIdentifier(), game->GetLongName());
+
+    enet_address_set_host(&address, "127.0.0.1");
+    address.port = server->GetPort();
+  }
+
+  std::vector<BenchClient> clients;
+  clients.reserve(client_count);
+  for (int i = 0; i < client_count; ++i)
+  {
+    BenchClient& client = clients.emplace_back(fmt::format("Bench {}", i + 1));
+    if (!client.Connect(address))
+    {
+      fmt::print(std::cerr, "Error: Failed to create client {}\n", i + 1);
+      return EXIT_FAILURE;
+    }
+  }
+
+  const auto disconnect = [&] {
+    for (BenchClient& client : clients)
+      client.Disconnect();
+    server.reset();
+  };
+
+  if (!WaitForClients(clients, context, BenchClient::State::Joined, Clock::now() + JOIN_TIMEOUT))
+  {
+    disconnect();
+    return EXIT_FAILURE;
+  }
+  fmt::print(std::cout, "{} clients joined\n", client_count);
+
+  if (server)
+  {
+    if (!server->RequestStartGame())
+    {
+      fmt::print(std::cerr, "Error: Failed to start the game\n");
+      disconnect();
+      return EXIT_FAILURE;
+    }
+  }
+  else
+  {
+    fmt::print(std::cout, "Waiting for the host to start the game\n");
+  }
+
+  if (!WaitForClients(clients, context, BenchClient::State::Running,
+                      server ? std::optional(Clock::now() + JOIN_TIMEOUT) : std::nullopt))
+  {
+    disconnect();
+    return EXIT_FAILURE;
+  }
+  fmt::print(std::cout, "Sending inputs for {} seconds\n", duration);
+
+  const Clock::time_point end = Clock::now() + std::chrono::seconds(duration);
+  while (Clock::now() < end)
+  {
+    for (BenchClient& client : clients)
+    {
+      client.Update(context);
+      if (client.GetState() == BenchClient::State::Failed)
+      {
+        fmt::print(std::cerr, "Error: {}: {}\n", client.GetName(), client.GetError());
+        disconnect();
+        return EXIT_FAILURE;
+      }
+    }
+    Common::SleepCurrentThread(1);
+  }
+
+  disconnect();
+
+  std::vector<s64>& latencies = context.relay_latencies_us;
+  const u64 expected_relays = context.inputs_sent * (client_count - 1);
+  fmt::print(std::cout, "Inputs sent: {}\n", context.inputs_sent);
+  fmt::print(std::cout, "Inputs relayed: {} of {}\n", latencies.size(), expected_relays);
+  if (latencies.empty())
+  {
+    fmt::print(std::cerr, "Error: No inputs were relayed\n");
+    return EXIT_FAILURE;
+  }
+
+  std::ranges::sort(latencies);
+  fmt::print(std::cout,
+             "Relay latency (ms): 50%: {:.2f}, 90%: {:.2f}, 99%: {:.2f}, 99.9%: {:.2f}, "
+             "max: {:.2f}\n",
+             GetPercentileMs(latencies, 50), GetPercentileMs(latencies, 90),
+             GetPercentileMs(latencies, 99), GetPercentileMs(latencies, 99.9),
+             latencies.back() / 1000.0);
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
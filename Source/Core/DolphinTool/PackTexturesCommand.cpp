@@ -0,0 +1,80 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/PackTexturesCommand.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "VideoCommon/Assets/TexturePack.h"
+
+namespace DolphinTool
+{
+int PackTexturesCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: packtextures [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the custom texture DIRECTORY. Every .png and .dds file in it is packed.")
+      .metavar("DIRECTORY");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the texture pack FILE to write. Give it the .dtp extension and place it in "
+            "the texture directory of the game so that Dolphin finds it.")
+      .metavar("FILE");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  // Validate options
+  const std::string& input_directory = options["input"];
+  if (input_directory.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+  if (!File::IsDirectory(input_directory))
+  {
+    fmt::print(std::cerr, "Error: Input is not a directory\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::string& output_file_path = options["output"];
+  if (output_file_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::vector<std::string> texture_paths =
+      Common::DoFileSearch({input_directory}, {".png", ".dds"}, /*recursive*/ true);
+  if (texture_paths.empty())
+  {
+    fmt::print(std::cerr, "Error: No textures found in the input directory\n");
+    return EXIT_FAILURE;
+  }
+
+  std::string error_message;
+  if (!VideoCommon::TexturePack::Write(output_file_path, texture_paths, &error_message))
+  {
+    fmt::print(std::cerr, "Error: {}\n", error_message);
+    return EXIT_FAILURE;
+  }
+
+  fmt::print(std::cout, "Packed {} textures\n", texture_paths.size());
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
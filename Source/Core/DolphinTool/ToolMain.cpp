@@ -17,13 +17,16 @@
 #include "DolphinTool/ConvertCommand.h"
 #include "DolphinTool/ExtractCommand.h"
 #include "DolphinTool/HeaderCommand.h"
+#include "DolphinTool/NetPlayBenchCommand.h"
+#include "DolphinTool/PackTexturesCommand.h"
 #include "DolphinTool/VerifyCommand.h"
 
 static void PrintUsage()
 {
   fmt::print(std::cerr, "usage: dolphin-tool COMMAND -h\n"
                         "\n"
-                        "commands supported: [convert, verify, header, extract]\n");
+                        "commands supported: [convert, verify, header, extract, packtextures, "
+                        "netplaybench]\n");
 }
 
 #ifdef _WIN32
@@ -50,6 +53,10 @@ int main(int argc, char* argv[])
     return DolphinTool::HeaderCommand(args);
   else if (command_str == "extract")
     return DolphinTool::Extract(args);
+  else if (command_str == "packtextures")
+    return DolphinTool::PackTexturesCommand(args);
+  else if (command_str == "netplaybench")
+    return DolphinTool::NetPlayBenchCommand(args);
   PrintUsage();
   return EXIT_FAILURE;
 }
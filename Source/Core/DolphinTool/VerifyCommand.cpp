@@ -3,7 +3,12 @@
 
 #include "DolphinTool/VerifyCommand.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <future>
+#include <list>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -30,50 +35,116 @@ static std::string HashToHexString(const std::vector<u8>& hash)
   return ss.str();
 }
 
-static void PrintFullReport(const DiscIO::VolumeVerifier::Result& result)
+static void PrintFullReport(std::ostream& out, const DiscIO::VolumeVerifier::Result& result)
 {
   if (!result.hashes.crc32.empty())
-    fmt::print(std::cout, "CRC32: {}\n", HashToHexString(result.hashes.crc32));
+    fmt::print(out, "CRC32: {}\n", HashToHexString(result.hashes.crc32));
   else
-    fmt::print(std::cout, "CRC32 not computed\n");
+    fmt::print(out, "CRC32 not computed\n");
 
   if (!result.hashes.md5.empty())
-    fmt::print(std::cout, "MD5: {}\n", HashToHexString(result.hashes.md5));
+    fmt::print(out, "MD5: {}\n", HashToHexString(result.hashes.md5));
   else
-    fmt::print(std::cout, "MD5 not computed\n");
+    fmt::print(out, "MD5 not computed\n");
 
   if (!result.hashes.sha1.empty())
-    fmt::print(std::cout, "SHA1: {}\n", HashToHexString(result.hashes.sha1));
+    fmt::print(out, "SHA1: {}\n", HashToHexString(result.hashes.sha1));
   else
-    fmt::print(std::cout, "SHA1 not computed\n");
+    fmt::print(out, "SHA1 not computed\n");
 
-  fmt::print(std::cout, "Problems Found: {}\n", result.problems.empty() ? "No" : "Yes");
+  fmt::print(out, "Problems Found: {}\n", result.problems.empty() ? "No" : "Yes");
 
   for (const auto& problem : result.problems)
   {
-    fmt::print(std::cout, "\nSeverity: ");
+    fmt::print(out, "\nSeverity: ");
     switch (problem.severity)
     {
     case DiscIO::VolumeVerifier::Severity::Low:
-      fmt::print(std::cout, "Low");
+      fmt::print(out, "Low");
       break;
     case DiscIO::VolumeVerifier::Severity::Medium:
-      fmt::print(std::cout, "Medium");
+      fmt::print(out, "Medium");
       break;
     case DiscIO::VolumeVerifier::Severity::High:
-      fmt::print(std::cout, "High");
+      fmt::print(out, "High");
       break;
     case DiscIO::VolumeVerifier::Severity::None:
-      fmt::print(std::cout, "None");
+      fmt::print(out, "None");
       break;
     default:
       ASSERT(false);
       break;
     }
-    fmt::print(std::cout, "\nSummary: {}\n\n", problem.text);
+    fmt::print(out, "\nSummary: {}\n\n", problem.text);
   }
 }
 
+struct VerifyOutput
+{
+  std::ostringstream out;
+  std::ostringstream err;
+  bool success = false;
+};
+
+static void VerifyFile(const std::string& input_file_path,
+                       const DiscIO::Hashes<bool>& hashes_to_calculate, bool rc_hash_calculate,
+                       bool algorithm_is_set, VerifyOutput* output)
+{
+  std::ostream& out = output->out;
+  std::ostream& err = output->err;
+
+  // Open the volume
+  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateVolume(input_file_path);
+  if (!volume)
+  {
+    fmt::print(err, "Error: Unable to open input file\n");
+    return;
+  }
+
+  // Verify the volume
+  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
+  verifier.Start();
+  while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
+  {
+    verifier.Process();
+  }
+  verifier.Finish();
+  const DiscIO::VolumeVerifier::Result& result = verifier.GetResult();
+
+  std::string rc_hash_result = "0";
+#ifdef USE_RETRO_ACHIEVEMENTS
+  // Calculate rcheevos hash
+  if (rc_hash_calculate)
+  {
+    rc_hash_result = AchievementManager::CalculateHash(input_file_path);
+  }
+#endif
+
+  // Print the report
+  if (!algorithm_is_set)
+  {
+    PrintFullReport(out, result);
+  }
+  else
+  {
+    if (hashes_to_calculate.crc32 && !result.hashes.crc32.empty())
+      fmt::print(out, "{}\n", HashToHexString(result.hashes.crc32));
+    else if (hashes_to_calculate.md5 && !result.hashes.md5.empty())
+      fmt::print(out, "{}\n", HashToHexString(result.hashes.md5));
+    else if (hashes_to_calculate.sha1 && !result.hashes.sha1.empty())
+      fmt::print(out, "{}\n", HashToHexString(result.hashes.sha1));
+    else if (rc_hash_calculate)
+      fmt::print(out, "{}\n", rc_hash_result);
+    else
+    {
+      fmt::print(err, "Error: No hash computed\n");
+      return;
+    }
+  }
+
+  output->success = true;
+}
+
 int VerifyCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
@@ -89,10 +160,18 @@ int VerifyCommand(const std::vector<std::string>& args)
 
   parser.add_option("-i", "--input")
       .type("string")
-      .action("store")
-      .help("Path to input file.")
+      .action("append")
+      .help("Path to input file. Can be given more than once to verify several files.")
       .metavar("FILE");
 
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Optional. How many of the input files to verify at the same time. Each file is read "
+            "sequentially, so this mostly helps when the files are on different drives or on "
+            "an SSD. Default: 1")
+      .set_default(1);
+
   parser.add_option("-a", "--algorithm")
       .type("string")
       .action("store")
@@ -113,10 +192,17 @@ int VerifyCommand(const std::vector<std::string>& args)
     fmt::print(std::cerr, "Error: No input set\n");
     return EXIT_FAILURE;
   }
-  const std::string& input_file_path = options["input"];
+  const std::list<std::string> input_list = options.all("input");
+  const std::vector<std::string> input_file_paths(input_list.begin(), input_list.end());
+
+  const int jobs = static_cast<int>(options.get("jobs"));
+  if (jobs < 1)
+  {
+    fmt::print(std::cerr, "Error: Jobs must be at least 1\n");
+    return EXIT_FAILURE;
+  }
 
   bool rc_hash_calculate = false;
-  std::string rc_hash_result = "0";
 
   DiscIO::Hashes<bool> hashes_to_calculate{};
   const bool algorithm_is_set = options.is_set("algorithm");
@@ -147,54 +233,37 @@ int VerifyCommand(const std::vector<std::string>& args)
     return EXIT_FAILURE;
   }
 
-  // Open the volume
-  const std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateVolume(input_file_path);
-  if (!volume)
-  {
-    fmt::print(std::cerr, "Error: Unable to open input file\n");
-    return EXIT_FAILURE;
-  }
+  std::vector<VerifyOutput> outputs(input_file_paths.size());
+  std::atomic<size_t> next_file = 0;
+  const auto verify_files = [&] {
+    for (size_t i = next_file++; i < outputs.size(); i = next_file++)
+    {
+      VerifyFile(input_file_paths[i], hashes_to_calculate, rc_hash_calculate, algorithm_is_set,
+                 &outputs[i]);
+    }
+  };
 
-  // Verify the volume
-  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
-  verifier.Start();
-  while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
-  {
-    verifier.Process();
-  }
-  verifier.Finish();
-  const DiscIO::VolumeVerifier::Result& result = verifier.GetResult();
+  std::vector<std::future<void>> workers;
+  const size_t worker_count = std::min<size_t>(jobs, outputs.size());
+  for (size_t i = 1; i < worker_count; ++i)
+    workers.push_back(std::async(std::launch::async, verify_files));
+  verify_files();
+  for (std::future<void>& worker : workers)
+    worker.wait();
 
-#ifdef USE_RETRO_ACHIEVEMENTS
-  // Calculate rcheevos hash
-  if (rc_hash_calculate)
+  bool success = true;
+  for (size_t i = 0; i < outputs.size(); ++i)
   {
-    rc_hash_result = AchievementManager::CalculateHash(input_file_path);
-  }
-#endif
+    // Only label the reports when there's more than one, so that the output for one file stays
+    // easy to parse
+    if (outputs.size() > 1)
+      fmt::print(std::cout, "{}{}:\n", i == 0 ? "" : "\n", input_file_paths[i]);
 
-  // Print the report
-  if (!algorithm_is_set)
-  {
-    PrintFullReport(result);
-  }
-  else
-  {
-    if (hashes_to_calculate.crc32 && !result.hashes.crc32.empty())
-      fmt::print(std::cout, "{}\n", HashToHexString(result.hashes.crc32));
-    else if (hashes_to_calculate.md5 && !result.hashes.md5.empty())
-      fmt::print(std::cout, "{}\n", HashToHexString(result.hashes.md5));
-    else if (hashes_to_calculate.sha1 && !result.hashes.sha1.empty())
-      fmt::print(std::cout, "{}\n", HashToHexString(result.hashes.sha1));
-    else if (rc_hash_calculate)
-      fmt::print(std::cout, "{}\n", rc_hash_result);
-    else
-    {
-      fmt::print(std::cerr, "Error: No hash computed\n");
-      return EXIT_FAILURE;
-    }
+    fmt::print(std::cout, "{}", outputs[i].out.str());
+    fmt::print(std::cerr, "{}", outputs[i].err.str());
+    success &= outputs[i].success;
   }
 
-  return EXIT_SUCCESS;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 }  // namespace DolphinTool
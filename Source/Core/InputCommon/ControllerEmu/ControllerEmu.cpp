@@ -36,6 +36,11 @@ std::unique_lock<std::recursive_mutex> EmulatedController::GetStateLock()
   return lock;
 }
 
+std::unique_lock<std::recursive_mutex> EmulatedController::TryGetStateLock()
+{
+  return std::unique_lock<std::recursive_mutex>(s_get_state_mutex, std::try_to_lock);
+}
+
 void EmulatedController::UpdateReferences(const ControllerInterface& devi)
 {
   std::scoped_lock lk(s_get_state_mutex, devi.GetDevicesMutex());
@@ -257,6 +257,8 @@ public:
   // which happens while handling a hotplug event because a control reference's State()
   // could be called before we have finished updating the reference.
   [[nodiscard]] static std::unique_lock<std::recursive_mutex> GetStateLock();
+  // Like GetStateLock, but returns a lock that doesn't own the mutex instead of waiting for it.
+  [[nodiscard]] static std::unique_lock<std::recursive_mutex> TryGetStateLock();
   const ciface::ExpressionParser::ControlEnvironment::VariableContainer&
   GetExpressionVariables() const;
 
@@ -115,8 +115,9 @@ struct PortState
   bool is_new_connection = false;
 };
 
-// Only access with s_mutex held!
+// Only access with s_read_mutex held!
 static std::array<PortState, SerialInterface::MAX_SI_CHANNELS> s_port_states;
+static std::optional<TimePoint> s_last_payload_time;
 
 static std::array<u8, CONTROLLER_OUTPUT_RUMBLE_PAYLOAD_SIZE> s_controller_write_payload;
 static std::atomic<int> s_controller_write_payload_size{0};
@@ -164,6 +165,8 @@ static bool s_is_adapter_wanted = false;
 static std::array<bool, SerialInterface::MAX_SI_CHANNELS> s_config_rumble_enabled{};
 
 static std::atomic<double> s_adapter_poll_rate{};
+// Smoothed age of the input returned by Input(), in milliseconds.
+static std::atomic<double> s_input_age_ms{};
 
 static void ReadThreadFunc()
 {
@@ -280,6 +283,11 @@ static void ReadThreadFunc()
 #endif
 
   s_adapter_poll_rate.store(0.0, std::memory_order_relaxed);
+  s_input_age_ms.store(0.0, std::memory_order_relaxed);
+  {
+    std::lock_guard lk(s_read_mutex);
+    s_last_payload_time.reset();
+  }
 
   NOTICE_LOG_FMT(CONTROLLERINTERFACE, "GCAdapter read thread stopped");
 }
@@ -805,6 +813,15 @@ GCPadStatus Input(int chan)
 
   std::lock_guard lk(s_read_mutex);
 
+  if (s_last_payload_time)
+  {
+    constexpr double INPUT_AGE_SMOOTHING = 0.05;
+    const double age_ms = DT_ms(Clock::now() - *s_last_payload_time).count();
+    const double smoothed_age_ms = s_input_age_ms.load(std::memory_order_relaxed);
+    s_input_age_ms.store(smoothed_age_ms + (age_ms - smoothed_age_ms) * INPUT_AGE_SMOOTHING,
+                         std::memory_order_relaxed);
+  }
+
   auto& pad_state = s_port_states[chan];
 
   // Return the "origin" state for the first input on a new connection.
@@ -845,6 +862,8 @@ void ProcessInputPayload(const u8* data, std::size_t size)
   {
     std::lock_guard lk(s_read_mutex);
 
+    s_last_payload_time = Clock::now();
+
     for (int chan = 0; chan != SerialInterface::MAX_SI_CHANNELS; ++chan)
     {
       const u8* const channel_data = &data[1 + (9 * chan)];
@@ -1040,4 +1059,9 @@ double GetCurrentPollRate()
   return s_adapter_poll_rate.load(std::memory_order_relaxed);
 }
 
+double GetCurrentInputAge()
+{
+  return s_input_age_ms.load(std::memory_order_relaxed);
+}
+
 }  // namespace GCAdapter
@@ -30,5 +30,8 @@ bool UseAdapter();
 
 // Callable from any thread. Returns 0 when the adapter is not detected.
 double GetCurrentPollRate();
+// Callable from any thread. Returns how old, in milliseconds, the input the emulated devices read
+// from the adapter is on average, or 0 when the adapter is not detected.
+double GetCurrentInputAge();
 
 }  // namespace GCAdapter
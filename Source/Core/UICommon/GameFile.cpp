@@ -7,6 +7,7 @@
 #include <array>
 #include <cstdio>
 #include <cstring>
+#include <filesystem>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -63,6 +64,14 @@ bool UseGameCovers()
   return Config::Get(Config::MAIN_USE_GAME_COVERS);
 #endif
 }
+
+// Returns 0 if the time can't be determined (e.g. for Android content URIs).
+u64 GetLastWriteTime(const std::string& path)
+{
+  std::error_code error;
+  const auto time = std::filesystem::last_write_time(StringToPath(path), error);
+  return error ? 0 : static_cast<u64>(time.time_since_epoch().count());
+}
 }  // Anonymous namespace
 
 DiscIO::Language GameFile::GetConfigLanguage() const
@@ -104,6 +113,8 @@ GameFile::GameFile() = default;
 GameFile::GameFile(std::string path) : m_file_path(std::move(path))
 {
   m_file_name = PathToFileName(m_file_path);
+  m_host_file_size = File::GetSize(m_file_path);
+  m_host_file_time = GetLastWriteTime(m_file_path);
 
   {
     std::unique_ptr<DiscIO::Volume> volume(DiscIO::CreateVolume(m_file_path));
@@ -292,6 +303,12 @@ void GameCover::DoState(PointerWrap& p)
   p.Do(buffer);
 }
 
+bool GameFile::FileChanged() const
+{
+  return File::GetSize(m_file_path) != m_host_file_size ||
+         GetLastWriteTime(m_file_path) != m_host_file_time;
+}
+
 void GameFile::DoState(PointerWrap& p)
 {
   p.Do(m_valid);
@@ -299,6 +316,8 @@ void GameFile::DoState(PointerWrap& p)
   p.Do(m_file_name);
 
   p.Do(m_file_size);
+  p.Do(m_host_file_size);
+  p.Do(m_host_file_time);
   p.Do(m_volume_size);
   p.Do(m_volume_size_type);
   p.Do(m_is_datel_disc);
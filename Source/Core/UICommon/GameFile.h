@@ -112,6 +112,8 @@ public:
   bool IsModDescriptor() const;
   const GameBanner& GetBannerImage() const;
   const GameCover& GetCoverImage() const;
+  // Whether the size or modification time of the file differs from when it was parsed.
+  bool FileChanged() const;
   void DoState(PointerWrap& p);
   bool XMLMetadataChanged();
   void XMLMetadataCommit();
@@ -147,6 +149,8 @@ private:
   std::string m_file_name;
 
   u64 m_file_size{};
+  u64 m_host_file_size{};
+  u64 m_host_file_time{};
   u64 m_volume_size{};
   DiscIO::DataSizeType m_volume_size_type{};
   bool m_is_datel_disc{};
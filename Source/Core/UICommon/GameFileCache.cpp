@@ -6,10 +6,12 @@
 #include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <future>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -26,7 +28,7 @@
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 26;  // Last changed in PR 10084
+static constexpr u32 CACHE_REVISION = 27;  // Last changed for the host file size and time
 
 std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& directories_to_scan,
                                           bool recursive_scan)
@@ -39,6 +41,27 @@ std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& direct
   return Common::DoFileSearch(directories_to_scan, search_extensions, recursive_scan);
 }
 
+// Parsing a volume is mostly waiting on the disk (or network share), so it's worth spreading over
+// more threads than the number of cores would suggest.
+static void ForEachInParallel(size_t count, const std::atomic_bool& processing_halted,
+                              const std::function<void(size_t)>& function)
+{
+  std::atomic<size_t> next_index = 0;
+  const auto work = [&] {
+    for (size_t i = next_index++; i < count && !processing_halted; i = next_index++)
+      function(i);
+  };
+
+  const size_t thread_count =
+      std::min<size_t>(count, 2 * std::max(1u, std::thread::hardware_concurrency()));
+  std::vector<std::future<void>> threads;
+  for (size_t i = 1; i < thread_count; ++i)
+    threads.push_back(std::async(std::launch::async, work));
+  work();
+  for (std::future<void>& thread : threads)
+    thread.wait();
+}
+
 GameFileCache::GameFileCache() : m_path(File::GetUserPath(D_CACHE_IDX) + "gamelist.cache")
 {
 }
@@ -127,15 +150,47 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
     m_cached_files.erase(it, m_cached_files.end());
   }
 
-  // Now that the previous loop has run, game_paths only contains paths that
+  // Files that were replaced since they were cached get parsed again, like new files.
+  std::vector<char> file_changed(m_cached_files.size());
+  ForEachInParallel(m_cached_files.size(), processing_halted,
+                    [&](size_t i) { file_changed[i] = m_cached_files[i]->FileChanged(); });
+  {
+    auto it = m_cached_files.begin();
+    auto end = m_cached_files.end();
+    while (it != end && !processing_halted)
+    {
+      const size_t index = it - m_cached_files.begin();
+      if (!file_changed[index])
+      {
+        ++it;
+        continue;
+      }
+
+      if (game_removed_from_cache)
+        game_removed_from_cache((*it)->GetFilePath());
+
+      cache_changed = true;
+      game_paths.insert((*it)->GetFilePath());
+      --end;
+      file_changed[index] = file_changed[end - m_cached_files.begin()];
+      *it = std::move(*end);
+    }
+    m_cached_files.erase(end, m_cached_files.end());
+  }
+
+  // Now that the previous loops have run, game_paths only contains paths that
   // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
+  const std::vector<std::string> new_paths(game_paths.begin(), game_paths.end());
+  std::vector<std::shared_ptr<GameFile>> new_files(new_paths.size());
+  ForEachInParallel(new_paths.size(), processing_halted,
+                    [&](size_t i) { new_files[i] = std::make_shared<GameFile>(new_paths[i]); });
+
+  for (std::shared_ptr<GameFile>& file : new_files)
   {
     if (processing_halted)
       break;
 
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
+    if (file && file->IsValid())
     {
       if (game_added_to_cache)
         game_added_to_cache(file);
@@ -4,6 +4,7 @@
 #include "UICommon/NetPlayIndex.h"
 
 #include <chrono>
+#include <mutex>
 #include <numeric>
 #include <string>
 
@@ -22,6 +23,9 @@ NetPlayIndex::~NetPlayIndex()
 {
   if (!m_secret.empty())
     Remove();
+
+  // The session thread may have stopped on its own after an error.
+  StopNotificationLoop();
 }
 
 static std::optional<picojson::value> ParseResponse(const std::vector<u8>& response)
@@ -42,8 +46,6 @@ static std::optional<picojson::value> ParseResponse(const std::vector<u8>& respo
 std::optional<std::vector<NetPlaySession>>
 NetPlayIndex::List(const std::map<std::string, std::string>& filters)
 {
-  Common::HttpRequest request;
-
   std::string list_url = Config::Get(Config::NETPLAY_INDEX_URL) + "/v0/list";
 
   if (!filters.empty())
@@ -51,19 +53,33 @@ NetPlayIndex::List(const std::map<std::string, std::string>& filters)
     list_url += '?';
     for (const auto& filter : filters)
     {
-      list_url += filter.first + '=' + request.EscapeComponent(filter.second) + '&';
+      list_url += filter.first + '=' + m_request.EscapeComponent(filter.second) + '&';
     }
     list_url.pop_back();
   }
 
-  auto response =
-      request.Get(list_url, {{"X-Is-Dolphin", "1"}}, Common::HttpRequest::AllowedReturnCodes::All);
+  // The same list is asked for again with the ETag of the last one, which the server answers
+  // with a bodyless 304 as long as it didn't change.
+  if (list_url != m_list_url)
+  {
+    m_list_url = list_url;
+    m_list_etag.clear();
+  }
+
+  Common::HttpRequest::Headers headers = {{"X-Is-Dolphin", "1"}};
+  if (!m_list_etag.empty())
+    headers.emplace("If-None-Match", m_list_etag);
+
+  auto response = m_request.Get(list_url, headers, Common::HttpRequest::AllowedReturnCodes::All);
   if (!response)
   {
     m_last_error = "NO_RESPONSE";
     return {};
   }
 
+  if (m_request.GetLastResponseCode() == 304 && !m_list_etag.empty())
+    return m_list_sessions;
+
   auto json = ParseResponse(response.value());
 
   if (!json)
@@ -120,19 +136,36 @@ NetPlayIndex::List(const std::map<std::string, std::string>& filters)
     sessions.push_back(std::move(session));
   }
 
+  // Header names are as sent, and HTTP/2 sends them in lower case.
+  m_list_etag = m_request.GetHeaderValue("ETag");
+  if (m_list_etag.empty())
+    m_list_etag = m_request.GetHeaderValue("etag");
+  m_list_sessions = sessions;
+
   return sessions;
 }
 
 void NetPlayIndex::NotificationLoop()
 {
-  while (!m_session_thread_exit_event.WaitFor(std::chrono::seconds(5)))
+  // Every heartbeat goes through the same connection, rather than setting up a new one to the
+  // server each time.
+  Common::HttpRequest request;
+
+  while (true)
   {
-    Common::HttpRequest request;
-    auto response = request.Get(
-        Config::Get(Config::NETPLAY_INDEX_URL) + "/v0/session/active?secret=" + m_secret +
+    m_session_thread_event.WaitFor(std::chrono::seconds(5));
+    if (m_session_thread_exit.IsSet())
+      return;
+
+    std::string url;
+    {
+      std::lock_guard lk(m_session_lock);
+      url = Config::Get(Config::NETPLAY_INDEX_URL) + "/v0/session/active?secret=" + m_secret +
             "&player_count=" + std::to_string(m_player_count) +
-            "&game=" + request.EscapeComponent(m_game) + "&in_game=" + std::to_string(m_in_game),
-        {{"X-Is-Dolphin", "1"}}, Common::HttpRequest::AllowedReturnCodes::All);
+            "&game=" + request.EscapeComponent(m_game) + "&in_game=" + std::to_string(m_in_game);
+    }
+    auto response =
+        request.Get(url, {{"X-Is-Dolphin", "1"}}, Common::HttpRequest::AllowedReturnCodes::All);
 
     if (!response)
       continue;
@@ -159,14 +192,23 @@ void NetPlayIndex::NotificationLoop()
   }
 }
 
+void NetPlayIndex::StopNotificationLoop()
+{
+  m_session_thread_exit.Set();
+  m_session_thread_event.Set();
+  if (m_session_thread.joinable())
+    m_session_thread.join();
+  m_session_thread_exit.Clear();
+  m_session_thread_event.Reset();
+}
+
 bool NetPlayIndex::Add(const NetPlaySession& session)
 {
-  Common::HttpRequest request;
-  auto response = request.Get(
+  auto response = m_request.Get(
       Config::Get(Config::NETPLAY_INDEX_URL) +
-          "/v0/session/add?name=" + request.EscapeComponent(session.name) +
-          "&region=" + request.EscapeComponent(session.region) +
-          "&game=" + request.EscapeComponent(session.game_id) +
+          "/v0/session/add?name=" + m_request.EscapeComponent(session.name) +
+          "&region=" + m_request.EscapeComponent(session.region) +
+          "&game=" + m_request.EscapeComponent(session.game_id) +
           "&password=" + std::to_string(session.has_password) + "&method=" + session.method +
           "&server_id=" + session.server_id + "&in_game=" + std::to_string(session.in_game) +
           "&port=" + std::to_string(session.port) + "&player_count=" +
@@ -195,34 +237,34 @@ bool NetPlayIndex::Add(const NetPlaySession& session)
     return false;
   }
 
-  m_secret = json->get("secret").to_str();
-  m_in_game = session.in_game;
-  m_player_count = session.player_count;
-  m_game = session.game_id;
+  StopNotificationLoop();
 
-  m_session_thread_exit_event.Set();
-  if (m_session_thread.joinable())
-    m_session_thread.join();
-  m_session_thread_exit_event.Reset();
+  m_secret = json->get("secret").to_str();
+  {
+    std::lock_guard lk(m_session_lock);
+    m_in_game = session.in_game;
+    m_player_count = session.player_count;
+    m_game = session.game_id;
+  }
 
   m_session_thread = std::thread([this] { NotificationLoop(); });
 
   return true;
 }
 
-void NetPlayIndex::SetInGame(bool in_game)
+void NetPlayIndex::UpdateSession(int player_count, std::string game, bool in_game)
 {
-  m_in_game = in_game;
-}
+  {
+    std::lock_guard lk(m_session_lock);
+    if (player_count == m_player_count && game == m_game && in_game == m_in_game)
+      return;
 
-void NetPlayIndex::SetPlayerCount(int player_count)
-{
-  m_player_count = player_count;
-}
+    m_player_count = player_count;
+    m_game = std::move(game);
+    m_in_game = in_game;
+  }
 
-void NetPlayIndex::SetGame(std::string game)
-{
-  m_game = std::move(game);
+  m_session_thread_event.Set();
 }
 
 void NetPlayIndex::Remove()
@@ -230,14 +272,10 @@ void NetPlayIndex::Remove()
   if (m_secret.empty())
     return;
 
-  m_session_thread_exit_event.Set();
-
-  if (m_session_thread.joinable())
-    m_session_thread.join();
+  StopNotificationLoop();
 
   // We don't really care whether this fails or not
-  Common::HttpRequest request;
-  request.Get(Config::Get(Config::NETPLAY_INDEX_URL) + "/v0/session/remove?secret=" + m_secret,
+  m_request.Get(Config::Get(Config::NETPLAY_INDEX_URL) + "/v0/session/remove?secret=" + m_secret,
               {{"X-Is-Dolphin", "1"}}, Common::HttpRequest::AllowedReturnCodes::All);
 
   m_secret.clear();
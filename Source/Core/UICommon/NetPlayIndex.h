@@ -5,6 +5,7 @@
 
 #include <functional>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -13,6 +14,8 @@
 #include <vector>
 
 #include "Common/Event.h"
+#include "Common/Flag.h"
+#include "Common/HttpRequest.h"
 
 struct NetPlaySession
 {
@@ -39,6 +42,7 @@ public:
   explicit NetPlayIndex();
   ~NetPlayIndex();
 
+  // Repeated calls are answered from the last list if the server says it didn't change.
   std::optional<std::vector<NetPlaySession>>
   List(const std::map<std::string, std::string>& filters = {});
 
@@ -49,9 +53,8 @@ public:
 
   bool HasActiveSession() const;
 
-  void SetPlayerCount(int player_count);
-  void SetInGame(bool in_game);
-  void SetGame(std::string game);
+  // Sent with the next heartbeat, which is sent early if anything changed.
+  void UpdateSession(int player_count, std::string game, bool in_game);
 
   const std::string& GetLastError() const;
 
@@ -59,16 +62,28 @@ public:
 
 private:
   void NotificationLoop();
+  void StopNotificationLoop();
+
+  // Kept for repeated calls, so that they reuse its connection to the server.
+  Common::HttpRequest m_request;
 
   std::string m_secret;
+
+  // Shared with the session thread.
+  std::mutex m_session_lock;
   std::string m_game;
   int m_player_count = 0;
   bool m_in_game = false;
 
   std::string m_last_error;
+
+  std::string m_list_url;
+  std::string m_list_etag;
+  std::vector<NetPlaySession> m_list_sessions;
   std::thread m_session_thread;
 
-  Common::Event m_session_thread_exit_event;
+  Common::Event m_session_thread_event;
+  Common::Flag m_session_thread_exit;
 
   std::function<void()> m_error_callback = nullptr;
 };
@@ -8,6 +8,8 @@
 #include "Common/FileUtil.h"
 #include "Common/IniFile.h"
 
+#include "VideoCommon/HiresTextures.h"
+
 #include <algorithm>
 
 namespace ResourcePack
@@ -26,6 +28,25 @@ Common::IniFile GetPackConfig()
 
   return file;
 }
+
+// Packs without compressed textures aren't extracted when they're installed, their textures are
+// read from the archive.
+void MountPacks()
+{
+  Common::IniFile file = GetPackConfig();
+  auto* install = file.GetOrCreateSection("Installed");
+
+  std::vector<std::string> mounted;
+  for (const ResourcePack& pack : packs)
+  {
+    bool installed;
+    install->Get(pack.GetManifest()->GetID(), &installed, false);
+    if (installed && !pack.GetManifest()->IsCompressed())
+      mounted.push_back(pack.GetPath());
+  }
+
+  HiresTexture::SetMountedResourcePacks(std::move(mounted));
+}
 }  // Anonymous namespace
 
 bool Init()
@@ -133,6 +154,7 @@ ResourcePack* Add(const std::string& path, int offset)
   file.Save(packs_path);
 
   auto it = packs.insert(packs.begin() + offset, std::move(pack));
+  MountPacks();
   return &*it;
 }
 
@@ -162,6 +184,7 @@ bool Remove(ResourcePack& pack)
   file.Save(packs_path);
 
   packs.erase(pack_iterator);
+  MountPacks();
 
   return true;
 }
@@ -178,6 +201,7 @@ void SetInstalled(const ResourcePack& pack, bool installed)
     install->Delete(pack.GetManifest()->GetID());
 
   file.Save(packs_path);
+  MountPacks();
 }
 
 bool IsInstalled(const ResourcePack& pack)
@@ -97,11 +97,11 @@ ResourcePack::ResourcePack(const std::string& path) : m_path(path)
 
   do
   {
-    std::string filename(256, '\0');
-
     mz_zip_file* texture_info;
-    mz_zip_reader_entry_get_info(zip_reader, &texture_info);
+    if (mz_zip_reader_entry_get_info(zip_reader, &texture_info) != MZ_OK)
+      continue;
 
+    const std::string filename = texture_info->filename;
     if (!filename.starts_with("textures/") || texture_info->uncompressed_size == 0)
       continue;
 
@@ -155,6 +155,13 @@ bool ResourcePack::Install(const std::string& path)
     return false;
   }
 
+  // Stored textures can be read from the archive directly, see MountPacks.
+  if (!m_manifest->IsCompressed())
+  {
+    SetInstalled(*this, true);
+    return true;
+  }
+
   void* zip_reader = mz_zip_reader_create();
   if (!zip_reader)
   {
@@ -47,6 +47,39 @@ bool DescriptorAllocator::Allocate(u32 num_handles, DescriptorHandle* out_base_h
 void DescriptorAllocator::Reset()
 {
   m_current_offset = 0;
+  m_texture_group_map.clear();
+}
+
+bool DescriptorAllocator::GetTextureGroupHandle(
+    const std::array<D3D12_CPU_DESCRIPTOR_HANDLE, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS>& handles,
+    D3D12_GPU_DESCRIPTOR_HANDLE* handle)
+{
+  // Descriptors of destroyed textures are only freed once the GPU is done with the command list,
+  // after the reset, so a handle can't point to a different texture until then.
+  std::array<SIZE_T, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> key;
+  for (u32 i = 0; i < VideoCommon::MAX_PIXEL_SHADER_SAMPLERS; i++)
+    key[i] = handles[i].ptr;
+
+  auto it = m_texture_group_map.find(key);
+  if (it != m_texture_group_map.end())
+  {
+    *handle = it->second;
+    return true;
+  }
+
+  DescriptorHandle allocation;
+  if (!Allocate(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS, &allocation))
+    return false;
+
+  static constexpr std::array<UINT, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> source_sizes = {
+      {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}};
+  g_dx_context->GetDevice()->CopyDescriptors(
+      1, &allocation.cpu_handle, &VideoCommon::MAX_PIXEL_SHADER_SAMPLERS,
+      VideoCommon::MAX_PIXEL_SHADER_SAMPLERS, handles.data(), source_sizes.data(),
+      D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+  *handle = allocation.gpu_handle;
+  m_texture_group_map.emplace(key, allocation.gpu_handle);
+  return true;
 }
 
 bool operator==(const SamplerStateSet& lhs, const SamplerStateSet& rhs)
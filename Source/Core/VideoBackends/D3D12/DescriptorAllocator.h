@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 
 #include "VideoBackends/D3D12/DescriptorHeapManager.h"
@@ -24,6 +25,12 @@ public:
   bool Allocate(u32 num_handles, DescriptorHandle* out_base_handle);
   void Reset();
 
+  // Copies the texture descriptors into a table in the heap. Games tend to switch between a few
+  // sets of textures, so a table copied for the same descriptors since the last reset is reused.
+  bool GetTextureGroupHandle(const std::array<D3D12_CPU_DESCRIPTOR_HANDLE,
+                                              VideoCommon::MAX_PIXEL_SHADER_SAMPLERS>& handles,
+                             D3D12_GPU_DESCRIPTOR_HANDLE* handle);
+
 protected:
   ComPtr<ID3D12DescriptorHeap> m_descriptor_heap;
   u32 m_descriptor_increment_size = 0;
@@ -32,6 +39,10 @@ protected:
 
   D3D12_CPU_DESCRIPTOR_HANDLE m_heap_base_cpu = {};
   D3D12_GPU_DESCRIPTOR_HANDLE m_heap_base_gpu = {};
+
+private:
+  std::map<std::array<SIZE_T, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS>, D3D12_GPU_DESCRIPTOR_HANDLE>
+      m_texture_group_map;
 };
 
 struct SamplerStateSet final
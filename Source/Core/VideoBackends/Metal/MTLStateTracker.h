@@ -246,6 +246,11 @@ private:
     MTLCullMode cull_mode;
     DepthStencilSelector depth_stencil;
     PerfQueryGroup perf_query_group;
+    // Fragment textures and samplers bound on the encoder, only valid for the bound_* bits.
+    std::array<id<MTLTexture>, MAX_TEXTURES> textures;
+    std::array<SamplerState, MAX_SAMPLERS> sampler_states;
+    u16 bound_textures;
+    u16 bound_samplers;
   } m_current;
   std::shared_ptr<PerfQueryTracker> m_current_perf_query;
 
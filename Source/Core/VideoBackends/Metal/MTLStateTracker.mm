@@ -344,6 +344,8 @@ void Metal::StateTracker::BeginRenderPass(MTLRenderPassDescriptor* descriptor)
   m_current.depth_clip_mode = MTLDepthClipModeClip;
   m_current.cull_mode = MTLCullModeNone;
   m_current.perf_query_group = static_cast<PerfQueryGroup>(-1);
+  m_current.bound_textures = 0;
+  m_current.bound_samplers = 0;
   m_flags.NewEncoder();
   m_dirty_samplers = (1 << MAX_SAMPLERS) - 1;
   m_dirty_textures = (1 << MAX_TEXTURES) - 1;
@@ -443,6 +445,8 @@ void Metal::StateTracker::ReloadSamplers()
 {
   for (size_t i = 0; i < std::size(m_state.samplers); ++i)
     m_state.samplers[i] = g_object_cache->GetSampler(m_state.sampler_states[i]);
+  m_current.bound_samplers = 0;
+  m_dirty_samplers = (1 << MAX_SAMPLERS) - 1;
 }
 
 void Metal::StateTracker::SetManualBufferUpload(bool enabled)
@@ -545,6 +549,9 @@ void Metal::StateTracker::UnbindTexture(id<MTLTexture> texture)
       m_state.textures[i] = m_dummy_texture;
       m_dirty_textures |= 1 << i;
     }
+    // A new texture can end up at the same address, don't mistake it for this one.
+    if (m_current.textures[i] == texture)
+      m_current.bound_textures &= ~(1 << i);
   }
 }
 
@@ -782,20 +789,52 @@ void Metal::StateTracker::PrepareRender()
     if (m_state.vertices)
       SetVertexBufferNow(0, m_state.vertices, 0);
   }
+  // Games often switch textures and samplers back and forth between draws, so skip the ones the
+  // encoder still has bound.
   if (u32 dirty = m_dirty_textures & pipe->GetTextures())
   {
     m_dirty_textures &= ~pipe->GetTextures();
-    NSRange range = RangeOfBits(dirty);
-    [enc setFragmentTextures:&m_state.textures[range.location] withRange:range];
+    for (u32 bits = dirty; bits; bits &= bits - 1)
+    {
+      const int idx = std::countr_zero(bits);
+      if ((m_current.bound_textures & (1 << idx)) &&
+          m_current.textures[idx] == m_state.textures[idx])
+      {
+        dirty &= ~(1 << idx);
+      }
+    }
+    if (dirty)
+    {
+      NSRange range = RangeOfBits(dirty);
+      [enc setFragmentTextures:&m_state.textures[range.location] withRange:range];
+      for (NSUInteger i = range.location; i < NSMaxRange(range); i++)
+        m_current.textures[i] = m_state.textures[i];
+      m_current.bound_textures |= ((1 << range.length) - 1) << range.location;
+    }
   }
   if (u32 dirty = m_dirty_samplers & pipe->GetSamplers())
   {
     m_dirty_samplers &= ~pipe->GetSamplers();
-    NSRange range = RangeOfBits(dirty);
-    [enc setFragmentSamplerStates:&m_state.samplers[range.location]
-                     lodMinClamps:&m_state.sampler_min_lod[range.location]
-                     lodMaxClamps:&m_state.sampler_max_lod[range.location]
-                        withRange:range];
+    for (u32 bits = dirty; bits; bits &= bits - 1)
+    {
+      const int idx = std::countr_zero(bits);
+      if ((m_current.bound_samplers & (1 << idx)) &&
+          m_current.sampler_states[idx] == m_state.sampler_states[idx])
+      {
+        dirty &= ~(1 << idx);
+      }
+    }
+    if (dirty)
+    {
+      NSRange range = RangeOfBits(dirty);
+      [enc setFragmentSamplerStates:&m_state.samplers[range.location]
+                       lodMinClamps:&m_state.sampler_min_lod[range.location]
+                       lodMaxClamps:&m_state.sampler_max_lod[range.location]
+                          withRange:range];
+      for (NSUInteger i = range.location; i < NSMaxRange(range); i++)
+        m_current.sampler_states[i] = m_state.sampler_states[i];
+      m_current.bound_samplers |= ((1 << range.length) - 1) << range.location;
+    }
   }
   if (m_state.perf_query_group != m_current.perf_query_group)
   {
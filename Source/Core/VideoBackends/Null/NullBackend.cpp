@@ -10,12 +10,15 @@
 
 #include "Common/Common.h"
 
+#include "Core/Config/GraphicsSettings.h"
+
 #include "VideoBackends/Null/NullBoundingBox.h"
 #include "VideoBackends/Null/NullGfx.h"
 #include "VideoBackends/Null/NullVertexManager.h"
 #include "VideoBackends/Null/PerfQuery.h"
 #include "VideoBackends/Null/TextureCache.h"
 
+#include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -67,6 +70,8 @@ void VideoBackend::InitBackendInfo(const WindowSystemInfo& wsi)
 
 bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
 {
+  OpcodeDecoder::g_skip_gx_processing = Config::Get(Config::GFX_NULL_SKIP_GX_PROCESSING);
+
   return InitializeShared(std::make_unique<NullGfx>(), std::make_unique<VertexManager>(),
                           std::make_unique<PerfQuery>(), std::make_unique<NullBoundingBox>(),
                           std::make_unique<NullEFBInterface>(), std::make_unique<TextureCache>());
@@ -74,6 +79,8 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
 
 void VideoBackend::Shutdown()
 {
+  OpcodeDecoder::g_skip_gx_processing = false;
+
   ShutdownShared();
 }
 
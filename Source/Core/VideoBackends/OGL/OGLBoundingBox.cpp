@@ -3,6 +3,7 @@
 
 #include "VideoBackends/OGL/OGLBoundingBox.h"
 
+#include "VideoBackends/OGL/OGLConfig.h"
 #include "VideoBackends/OGL/OGLGfx.h"
 #include "VideoCommon/DriverDetails.h"
 
@@ -12,6 +13,10 @@ OGLBoundingBox::~OGLBoundingBox()
 {
   if (m_buffer_id)
     glDeleteBuffers(1, &m_buffer_id);
+  if (m_readback_buffer_id)
+    glDeleteBuffers(1, &m_readback_buffer_id);
+  if (m_readback_fence)
+    glDeleteSync(m_readback_fence);
 }
 
 bool OGLBoundingBox::Initialize()
@@ -66,6 +71,60 @@ std::vector<BBoxType> OGLBoundingBox::Read(u32 index, u32 length)
   return values;
 }
 
+bool OGLBoundingBox::BeginReadback()
+{
+  if (!g_ogl_config.bSupportsGLSync)
+    return false;
+
+  constexpr GLsizeiptr size = sizeof(BBoxType) * NUM_BBOX_VALUES;
+  if (!m_readback_buffer_id)
+  {
+    glGenBuffers(1, &m_readback_buffer_id);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, m_readback_buffer_id);
+    glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, GL_STREAM_READ);
+  }
+
+  // Make the writes of the pixel shaders visible to the copy.
+  glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+  glBindBuffer(GL_COPY_READ_BUFFER, m_buffer_id);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, m_readback_buffer_id);
+  glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, size);
+  glBindBuffer(GL_COPY_READ_BUFFER, 0);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+  if (m_readback_fence)
+    glDeleteSync(m_readback_fence);
+  m_readback_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  return true;
+}
+
+bool OGLBoundingBox::PollReadback(std::span<BBoxType, NUM_BBOX_VALUES> values)
+{
+  if (!m_readback_fence)
+    return false;
+
+  // With a timeout of 0 this only flushes the commands, so that the fence gets signaled.
+  const GLenum result = glClientWaitSync(m_readback_fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+  if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED)
+    return false;
+
+  glDeleteSync(m_readback_fence);
+  m_readback_fence = 0;
+
+  // The copy has completed, so mapping the buffer doesn't stall.
+  constexpr GLsizeiptr size = sizeof(BBoxType) * NUM_BBOX_VALUES;
+  glBindBuffer(GL_COPY_WRITE_BUFFER, m_readback_buffer_id);
+  const void* ptr = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, GL_MAP_READ_BIT);
+  if (ptr)
+  {
+    std::memcpy(values.data(), ptr, size);
+    glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+  }
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+  return ptr != nullptr;
+}
+
 void OGLBoundingBox::Write(u32 index, std::span<const BBoxType> values)
 {
   glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_buffer_id);
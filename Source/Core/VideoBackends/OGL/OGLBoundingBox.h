@@ -20,9 +20,15 @@ public:
 protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
+  bool BeginReadback() override;
+  bool PollReadback(std::span<BBoxType, NUM_BBOX_VALUES> values) override;
 
 private:
   GLuint m_buffer_id = 0;
+
+  // BeginReadback copies the values here, and m_readback_fence is signaled once it's done.
+  GLuint m_readback_buffer_id = 0;
+  GLsync m_readback_fence = 0;
 };
 
 }  // namespace OGL
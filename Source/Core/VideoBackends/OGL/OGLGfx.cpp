@@ -4,6 +4,7 @@
 #include "VideoBackends/OGL/OGLGfx.h"
 
 #include "Common/GL/GLContext.h"
+#include "Common/FrameProfiler.h"
 #include "Common/GL/GLExtensions/GLExtensions.h"
 #include "Common/Logging/LogManager.h"
 
@@ -192,6 +193,11 @@ OGLGfx::OGLGfx(std::unique_ptr<GLContext> main_gl_context, float backbuffer_scal
   glGenFramebuffers(1, &m_shared_read_framebuffer);
   glGenFramebuffers(1, &m_shared_draw_framebuffer);
 
+  m_supports_gpu_timer =
+      !m_main_gl_context->IsGLES() && GLExtensions::Supports("GL_ARB_timer_query");
+  if (m_supports_gpu_timer)
+    glGenQueries(NUM_GPU_TIMER_QUERIES, m_gpu_timer_queries.data());
+
   if (g_backend_info.bSupportsPrimitiveRestart)
     GLUtil::EnablePrimitiveRestart(m_main_gl_context.get());
 
@@ -202,6 +208,13 @@ OGLGfx::~OGLGfx()
 {
   glDeleteFramebuffers(1, &m_shared_draw_framebuffer);
   glDeleteFramebuffers(1, &m_shared_read_framebuffer);
+
+  if (m_supports_gpu_timer)
+  {
+    if (m_gpu_timer_active)
+      glEndQuery(GL_TIME_ELAPSED);
+    glDeleteQueries(NUM_GPU_TIMER_QUERIES, m_gpu_timer_queries.data());
+  }
 }
 
 bool OGLGfx::IsHeadless() const
@@ -436,10 +449,52 @@ void OGLGfx::PresentBackbuffer()
     }
   }
 
+  if (m_supports_gpu_timer)
+    UpdateGPUTimer();
+
   // Swap the back and front buffers, presenting the image.
   m_main_gl_context->Swap();
 }
 
+void OGLGfx::UpdateGPUTimer()
+{
+  if (m_gpu_timer_active)
+  {
+    glEndQuery(GL_TIME_ELAPSED);
+    m_gpu_timer_active = false;
+    m_gpu_timer_queries_pending++;
+  }
+
+  // The queries finish in order, so stop at the first one that hasn't.
+  while (m_gpu_timer_queries_pending > 0)
+  {
+    const u32 index =
+        (m_gpu_timer_query_head + NUM_GPU_TIMER_QUERIES - m_gpu_timer_queries_pending) %
+        NUM_GPU_TIMER_QUERIES;
+    GLuint available = GL_FALSE;
+    glGetQueryObjectuiv(m_gpu_timer_queries[index], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+      break;
+
+    GLuint64 elapsed_ns = 0;
+    glGetQueryObjectui64v(m_gpu_timer_queries[index], GL_QUERY_RESULT, &elapsed_ns);
+    Common::FrameProfiler::AddTime(Common::FrameProfiler::Stage::HostGPU,
+                                   std::chrono::nanoseconds(elapsed_ns));
+    m_gpu_timer_queries_pending--;
+  }
+
+  // If the GPU is more than NUM_GPU_TIMER_QUERIES frames behind, skip measuring this frame.
+  if (!Common::FrameProfiler::IsEnabled() ||
+      m_gpu_timer_queries_pending == NUM_GPU_TIMER_QUERIES)
+  {
+    return;
+  }
+
+  glBeginQuery(GL_TIME_ELAPSED, m_gpu_timer_queries[m_gpu_timer_query_head]);
+  m_gpu_timer_query_head = (m_gpu_timer_query_head + 1) % NUM_GPU_TIMER_QUERIES;
+  m_gpu_timer_active = true;
+}
+
 void OGLGfx::OnConfigChanged(u32 bits)
 {
   AbstractGfx::OnConfigChanged(bits);
@@ -102,6 +102,10 @@ private:
   void ApplyDepthState(const DepthState state);
   void ApplyBlendingState(const BlendingState state);
 
+  // Measures the GPU time of each frame for the frame profiler, and reports the measurements that
+  // are ready without waiting for the GPU.
+  void UpdateGPUTimer();
+
   std::unique_ptr<GLContext> m_main_gl_context;
   std::unique_ptr<OGLFramebuffer> m_system_framebuffer;
   std::array<const OGLTexture*, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> m_bound_textures{};
@@ -114,6 +118,13 @@ private:
   u32 m_shared_read_framebuffer = 0;
   u32 m_shared_draw_framebuffer = 0;
   float m_backbuffer_scale;
+
+  static constexpr u32 NUM_GPU_TIMER_QUERIES = 4;
+  std::array<u32, NUM_GPU_TIMER_QUERIES> m_gpu_timer_queries{};
+  u32 m_gpu_timer_query_head = 0;
+  u32 m_gpu_timer_queries_pending = 0;
+  bool m_gpu_timer_active = false;
+  bool m_supports_gpu_timer = false;
 };
 
 inline OGLGfx* GetOGLGfx()
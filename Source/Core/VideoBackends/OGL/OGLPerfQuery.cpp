@@ -27,7 +27,7 @@ std::unique_ptr<PerfQueryBase> GetPerfQuery(bool is_gles)
 
 PerfQuery::PerfQuery() : m_query_read_pos()
 {
-  ResetQuery();
+  ClearQueries();
 }
 
 void PerfQuery::EnableQuery(PerfQueryGroup group)
@@ -53,6 +53,24 @@ void PerfQuery::FlushResults()
 
 void PerfQuery::ResetQuery()
 {
+  if (!ShouldDefer())
+  {
+    ClearQueries();
+    return;
+  }
+
+  // Keep the pending queries, and read back the ones that have completed without waiting. Only if
+  // the GPU is so far behind that the previous period is still pending, wait for it.
+  WeakFlush();
+  if (GetPendingPeriodQueryCount() != 0)
+    FlushResults();
+
+  EndQueryPeriod(m_query_count.load(std::memory_order_relaxed));
+}
+
+void PerfQuery::ClearQueries()
+{
+  ResetQueryPeriods();
   m_query_count.store(0, std::memory_order_relaxed);
   for (auto& result : m_results)
     result.store(0, std::memory_order_relaxed);
@@ -171,7 +189,7 @@ void PerfQueryGL::FlushOne()
   if (g_ActiveConfig.iMultisamples > 1)
     result /= g_ActiveConfig.iMultisamples;
 
-  m_results[entry.query_group].fetch_add(result, std::memory_order_relaxed);
+  AddQueryResult(entry.query_group, result);
 
   m_query_read_pos = (m_query_read_pos + 1) % m_query_buffer.size();
   m_query_count.fetch_sub(1, std::memory_order_relaxed);
@@ -267,8 +285,7 @@ void PerfQueryGLESNV::FlushOne()
   const u64 native_res_result =
       static_cast<u64>(result) * EFB_WIDTH * EFB_HEIGHT /
       (g_framebuffer_manager->GetEFBWidth() * g_framebuffer_manager->GetEFBHeight());
-  m_results[entry.query_group].fetch_add(static_cast<u32>(native_res_result),
-                                         std::memory_order_relaxed);
+  AddQueryResult(entry.query_group, static_cast<u32>(native_res_result));
 
   m_query_read_pos = (m_query_read_pos + 1) % m_query_buffer.size();
   m_query_count.fetch_sub(1, std::memory_order_relaxed);
@@ -27,6 +27,11 @@ public:
   bool IsFlushed() const override;
 
 protected:
+  bool SupportsDeferredResults() const override { return true; }
+
+  // Reads back the queries that have completed, without waiting.
+  virtual void WeakFlush() {}
+
   struct ActiveQuery
   {
     GLuint query_id;
@@ -41,6 +46,8 @@ protected:
   u32 m_query_read_pos;
 
 private:
+  void ClearQueries();
+
   // Implementation
   std::unique_ptr<PerfQuery> m_query;
 };
@@ -57,7 +64,7 @@ public:
   void FlushResults() override;
 
 private:
-  void WeakFlush();
+  void WeakFlush() override;
   // Only use when non-empty
   void FlushOne();
 
@@ -75,7 +82,7 @@ public:
   void FlushResults() override;
 
 private:
-  void WeakFlush();
+  void WeakFlush() override;
   // Only use when non-empty
   void FlushOne();
 };
@@ -3,11 +3,18 @@
 
 #include "VideoBackends/OGL/OGLStreamBuffer.h"
 
+#include <string>
+#include <string_view>
+
 #include "Common/Align.h"
+#include "Common/Config/Config.h"
 #include "Common/GL/GLUtil.h"
+#include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/MemoryUtil.h"
 
+#include "Core/Config/GraphicsSettings.h"
+
 #include "VideoBackends/OGL/OGLConfig.h"
 
 #include "VideoCommon/DriverDetails.h"
@@ -345,17 +352,61 @@ public:
   u8* m_pointer;
 };
 
+template <typename T>
+static std::unique_ptr<StreamBuffer> MakeStreamBuffer(std::string_view name, u32 type, u32 size)
+{
+  INFO_LOG_FMT(VIDEO, "Using {} for stream buffer {:#x} of {} bytes", name, type, size);
+  return std::make_unique<T>(type, size);
+}
+
+// Creates the streaming method named by GFX_OGL_STREAM_BUFFER_TYPE, if the driver supports it.
+static std::unique_ptr<StreamBuffer> CreateForcedType(std::string_view name, u32 type, u32 size)
+{
+  if (name == "BufferSubData")
+    return MakeStreamBuffer<BufferSubData>(name, type, size);
+  if (name == "BufferData")
+    return MakeStreamBuffer<BufferData>(name, type, size);
+
+  // The others need basevertex support, see below.
+  if (!g_ogl_config.bSupportsGLBaseVertex)
+    return nullptr;
+  if (name == "MapAndOrphan")
+    return MakeStreamBuffer<MapAndOrphan>(name, type, size);
+
+  if (!g_ogl_config.bSupportsGLSync)
+    return nullptr;
+  if (name == "MapAndSync")
+    return MakeStreamBuffer<MapAndSync>(name, type, size);
+  if (name == "BufferStorage" && g_ogl_config.bSupportsGLBufferStorage)
+    return MakeStreamBuffer<BufferStorage>(name, type, size);
+  if (name == "PinnedMemory" && g_ogl_config.bSupportsGLPinnedMemory)
+    return MakeStreamBuffer<PinnedMemory>(name, type, size);
+
+  return nullptr;
+}
+
 // Chooses the best streaming method based on the supported extensions and known issues
 std::unique_ptr<StreamBuffer> StreamBuffer::Create(u32 type, u32 size)
 {
+  // Detecting the fastest method per driver doesn't always work out, so allow overriding it.
+  const std::string forced_type = Config::Get(Config::GFX_OGL_STREAM_BUFFER_TYPE);
+  if (!forced_type.empty())
+  {
+    if (auto stream_buffer = CreateForcedType(forced_type, type, size))
+      return stream_buffer;
+
+    WARN_LOG_FMT(VIDEO, "Stream buffer type {} is not supported by the driver, ignoring it",
+                 forced_type);
+  }
+
   // without basevertex support, only streaming methods whith uploads everything to zero works fine:
   if (!g_ogl_config.bSupportsGLBaseVertex)
   {
     if (!DriverDetails::HasBug(DriverDetails::BUG_BROKEN_BUFFER_STREAM))
-      return std::make_unique<BufferSubData>(type, size);
+      return MakeStreamBuffer<BufferSubData>("BufferSubData", type, size);
 
     // BufferData is by far the worst way, only use it if needed
-    return std::make_unique<BufferData>(type, size);
+    return MakeStreamBuffer<BufferData>("BufferData", type, size);
   }
 
   // Prefer the syncing buffers over the orphaning one
@@ -364,7 +415,7 @@ std::unique_ptr<StreamBuffer> StreamBuffer::Create(u32 type, u32 size)
     // pinned memory is much faster than buffer storage on AMD cards
     if (g_ogl_config.bSupportsGLPinnedMemory &&
         !(DriverDetails::HasBug(DriverDetails::BUG_BROKEN_PINNED_MEMORY)))
-      return std::make_unique<PinnedMemory>(type, size);
+      return MakeStreamBuffer<PinnedMemory>("PinnedMemory", type, size);
 
     // buffer storage works well in most situations
     if (g_ogl_config.bSupportsGLBufferStorage &&
@@ -372,23 +423,23 @@ std::unique_ptr<StreamBuffer> StreamBuffer::Create(u32 type, u32 size)
           type == GL_ARRAY_BUFFER) &&
         !(DriverDetails::HasBug(DriverDetails::BUG_INTEL_BROKEN_BUFFER_STORAGE) &&
           type == GL_ELEMENT_ARRAY_BUFFER))
-      return std::make_unique<BufferStorage>(type, size);
+      return MakeStreamBuffer<BufferStorage>("BufferStorage", type, size);
 
     // don't fall back to MapAnd* for Nvidia drivers
     if (DriverDetails::HasBug(DriverDetails::BUG_BROKEN_UNSYNC_MAPPING))
     {
       if (DriverDetails::HasBug(DriverDetails::BUG_BROKEN_BUFFER_STREAM))
-        return std::make_unique<BufferData>(type, size);
+        return MakeStreamBuffer<BufferData>("BufferData", type, size);
       else
-        return std::make_unique<BufferSubData>(type, size);
+        return MakeStreamBuffer<BufferSubData>("BufferSubData", type, size);
     }
 
     // mapping fallback
     if (g_ogl_config.bSupportsGLSync)
-      return std::make_unique<MapAndSync>(type, size);
+      return MakeStreamBuffer<MapAndSync>("MapAndSync", type, size);
   }
 
   // default fallback, should work everywhere, but isn't the best way to do this job
-  return std::make_unique<MapAndOrphan>(type, size);
+  return MakeStreamBuffer<MapAndOrphan>("MapAndOrphan", type, size);
 }
 }  // namespace OGL
@@ -5,12 +5,19 @@
 
 #include <algorithm>
 #include <cstring>
+#include <latch>
+#include <memory>
+#include <utility>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 
 #include "VideoBackends/Software/NativeVertexFormat.h"
+#include "VideoBackends/Software/SWBoundingBox.h"
 #include "VideoBackends/Software/SWEfbInterface.h"
 #include "VideoBackends/Software/Tev.h"
 #include "VideoCommon/BPFunctions.h"
@@ -18,6 +25,7 @@
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 
 namespace Rasterizer
@@ -95,16 +103,64 @@ struct Slope
   }
 };
 
-static Slope ZSlope;
-static Slope WSlope;
-static Slope ColorSlopes[2][4];
-static Slope TexSlopes[8][3];
+// Every rasterizer thread works on its own copy of these.
+static thread_local Slope ZSlope;
+static thread_local Slope WSlope;
+static thread_local Slope ColorSlopes[2][4];
+static thread_local Slope TexSlopes[8][3];
+
+static thread_local Tev tev;
+static thread_local RasterBlock rasterBlock;
 
-static Tev tev;
-static RasterBlock rasterBlock;
+// Pixel statistics and bounding box of what the thread drew in the current batch of triangles,
+// added to the global ones once the batch is done.
+struct DrawCounts
+{
+  u32 rasterized_pixels = 0;
+  u32 tev_pixels_in = 0;
+  u32 tev_pixels_out = 0;
+  u16 bbox_left = 0xFFFF;
+  u16 bbox_right = 0;
+  u16 bbox_top = 0xFFFF;
+  u16 bbox_bottom = 0;
+};
+static thread_local DrawCounts drawCounts;
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
+// With rasterizer threads, the triangles of a draw are queued and rasterized at the end of it.
+// The EFB is split into bands of rows, interleaved between the threads, and every thread goes
+// through all the triangles in order but only draws the pixels in its bands. Pixels only depend
+// on earlier pixels at the same position, so this gives the same result as drawing the triangles
+// one by one. All of them are drawn with the same BP state, since changing it ends the draw.
+static constexpr int BAND_HEIGHT = 8;
+static constexpr size_t MAX_QUEUED_TRIANGLES = 4096;
+// Below this many pixels (of the bounding rectangles), waking up the threads costs more than it
+// saves.
+static constexpr u32 PARALLEL_MIN_PIXELS = 4096;
+
+struct QueuedTriangle
+{
+  OutputVertexData v0;
+  OutputVertexData v1;
+  OutputVertexData v2;
+  BPFunctions::ScissorRect scissor;
+  // zfreeze makes the z slope depend on earlier triangles, even culled ones.
+  Slope z_slope;
+};
+
+struct BandJob
+{
+  int band;
+  int band_count;
+  DrawCounts* counts;
+  std::latch* done;
+};
+
+static std::vector<QueuedTriangle> queuedTriangles;
+static u32 queuedPixels = 0;
+static std::vector<std::unique_ptr<Common::WorkQueueThreadSP<BandJob>>> rasterizerThreads;
+
 void Init()
 {
   // The other slopes are set each for each primitive drawn, but zfreeze means that the z slope
@@ -148,7 +204,7 @@ void SetTevKonstColors()
 
 static void Draw(s32 x, s32 y, s32 xi, s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  drawCounts.rasterized_pixels++;
 
   s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
 
@@ -201,7 +257,18 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
     tev.TextureLinear[i] = rasterBlock.TextureLinear[i];
   }
 
-  tev.Draw();
+  drawCounts.tev_pixels_in++;
+  if (!tev.Draw())
+    return;
+
+  drawCounts.tev_pixels_out++;
+
+  // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
+  // extents of these groups, rather than the exact pixel.
+  drawCounts.bbox_left = std::min(drawCounts.bbox_left, static_cast<u16>(x & ~1));
+  drawCounts.bbox_right = std::max(drawCounts.bbox_right, static_cast<u16>(x | 1));
+  drawCounts.bbox_top = std::min(drawCounts.bbox_top, static_cast<u16>(y & ~1));
+  drawCounts.bbox_bottom = std::max(drawCounts.bbox_bottom, static_cast<u16>(y | 1));
 }
 
 static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
@@ -317,14 +384,11 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
   }
 }
 
-static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
-                                  const OutputVertexData* v2,
-                                  const BPFunctions::ScissorRect& scissor)
+// Draws the pixels of the triangle in the rows of the given band, see QueuedTriangle.
+static void RasterizeTriangle(const OutputVertexData* v0, const OutputVertexData* v1,
+                              const OutputVertexData* v2, const BPFunctions::ScissorRect& scissor,
+                              int band, int band_count)
 {
-  // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
-  // zfreeze depends on it
-  UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
-
   // adapted from http://devmaster.net/posts/6145/advanced-rasterization
 
   // 28.4 fixed-point coordinates. rounded to nearest and adjusted to match hardware output
@@ -419,6 +483,9 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   // Loop through blocks
   for (s32 y = block_miny & ~(BLOCK_SIZE - 1); y < maxy; y += BLOCK_SIZE)
   {
+    if (band_count > 1 && (y / BAND_HEIGHT) % band_count != band)
+      continue;
+
     for (s32 x = block_minx; x < maxx; x += BLOCK_SIZE)
     {
       s32 x1_ = (x + BLOCK_SIZE - 1);
@@ -503,12 +570,104 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
   }
 }
 
+static void UpdateRasterizerThreads()
+{
+  const size_t thread_count = static_cast<size_t>(std::max(g_ActiveConfig.iSWRasterizerThreads, 0));
+  if (rasterizerThreads.size() == thread_count)
+    return;
+
+  rasterizerThreads.clear();
+  for (size_t i = 0; i < thread_count; ++i)
+  {
+    rasterizerThreads.push_back(std::make_unique<Common::WorkQueueThreadSP<BandJob>>(
+        fmt::format("SW Rasterizer {}", i), [](BandJob job) {
+          tev.SetKonstColors();
+          for (const QueuedTriangle& triangle : queuedTriangles)
+          {
+            ZSlope = triangle.z_slope;
+            RasterizeTriangle(&triangle.v0, &triangle.v1, &triangle.v2, triangle.scissor, job.band,
+                              job.band_count);
+          }
+          *job.counts = std::exchange(drawCounts, {});
+          job.done->count_down();
+        }));
+  }
+}
+
+static void AddDrawCounts(const DrawCounts& counts)
+{
+  ADDSTAT(g_stats.this_frame.rasterized_pixels, counts.rasterized_pixels);
+  ADDSTAT(g_stats.this_frame.tev_pixels_in, counts.tev_pixels_in);
+  ADDSTAT(g_stats.this_frame.tev_pixels_out, counts.tev_pixels_out);
+  if (counts.tev_pixels_out != 0)
+  {
+    BBoxManager::Update(counts.bbox_left, counts.bbox_right, counts.bbox_top,
+                        counts.bbox_bottom);
+  }
+}
+
+void Flush()
+{
+  if (!queuedTriangles.empty())
+  {
+    // Perf queries count in an order-dependent way, so they keep everything on this thread.
+    const bool parallel = queuedPixels >= PARALLEL_MIN_PIXELS && !rasterizerThreads.empty() &&
+                          !PerfQueryBase::ShouldEmulate();
+    const int band_count = parallel ? static_cast<int>(rasterizerThreads.size()) + 1 : 1;
+    std::vector<DrawCounts> thread_counts(band_count - 1);
+    std::latch done(band_count - 1);
+    for (int i = 0; i < band_count - 1; ++i)
+      rasterizerThreads[i]->Push({i + 1, band_count, &thread_counts[i], &done});
+
+    const Slope z_slope = ZSlope;
+    for (const QueuedTriangle& triangle : queuedTriangles)
+    {
+      ZSlope = triangle.z_slope;
+      RasterizeTriangle(&triangle.v0, &triangle.v1, &triangle.v2, triangle.scissor, 0,
+                        band_count);
+    }
+    ZSlope = z_slope;
+    done.wait();
+
+    for (const DrawCounts& counts : thread_counts)
+      AddDrawCounts(counts);
+    queuedTriangles.clear();
+    queuedPixels = 0;
+  }
+
+  AddDrawCounts(std::exchange(drawCounts, {}));
+}
+
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2)
 {
   INCSTAT(g_stats.this_frame.num_triangles_drawn);
 
+  UpdateRasterizerThreads();
+
   for (const auto& scissor : scissors)
-    DrawTriangleFrontFace(v0, v1, v2, scissor);
+  {
+    // The zslope should be updated now, even if the triangle is rejected by the scissor test, as
+    // zfreeze depends on it
+    UpdateZSlope(v0, v1, v2, scissor.x_off, scissor.y_off);
+
+    if (rasterizerThreads.empty())
+    {
+      RasterizeTriangle(v0, v1, v2, scissor, 0, 1);
+      continue;
+    }
+
+    queuedTriangles.push_back({*v0, *v1, *v2, scissor, ZSlope});
+
+    const auto [min_x, max_x] = std::minmax(
+        {v0->screenPosition.x, v1->screenPosition.x, v2->screenPosition.x});
+    const auto [min_y, max_y] = std::minmax(
+        {v0->screenPosition.y, v1->screenPosition.y, v2->screenPosition.y});
+    queuedPixels += static_cast<u32>(std::min(max_x - min_x, float(EFB_WIDTH)) *
+                                     std::min(max_y - min_y, float(EFB_HEIGHT)));
+  }
+
+  if (queuedTriangles.size() >= MAX_QUEUED_TRIANGLES)
+    Flush();
 }
 }  // namespace Rasterizer
@@ -16,6 +16,9 @@ void UpdateZSlope(const OutputVertexData* v0, const OutputVertexData* v1,
                   const OutputVertexData* v2, s32 x_off, s32 y_off);
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2);
+// Rasterizes the triangles still queued for the rasterizer threads. Has to be called at the end
+// of every draw.
+void Flush();
 
 void SetTevKonstColors();
 
@@ -726,6 +726,10 @@ void IncPerfCounterQuadCount(PerfQueryType type)
   // Current software renderer architecture works on pixels though, so
   // we have this "quad" hack here to only increment the registers on
   // every fourth rendered pixel
+  // Nobody reads the counters then, and several rasterizer threads may be drawing.
+  if (!PerfQueryBase::ShouldEmulate())
+    return;
+
   static u32 quad[PQ_NUM_MEMBERS];
   if (++quad[type] != 3)
     return;
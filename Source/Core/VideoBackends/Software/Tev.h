@@ -231,5 +231,6 @@ public:
   };
 
   void SetKonstColors();
-  void Draw();
+  // Returns whether the pixel made it to blending.
+  bool Draw();
 };
@@ -14,6 +14,10 @@
 #include "VideoCommon/Constants.h"
 #include "vulkan/vulkan_core.h"
 
+#ifdef DOLPHIN_LIBRETRO
+#include "VideoBackends/Vulkan/VKLibretro.h"
+#endif
+
 namespace Vulkan
 {
 CommandBufferManager::CommandBufferManager(bool use_threaded_submission)
@@ -286,9 +290,40 @@ void CommandBufferManager::WaitForCommandBufferCompletion(u32 index)
   if (res != VK_SUCCESS)
     LOG_VULKAN_ERROR(res, "vkWaitForFences failed: ");
 
+  CleanupCompletedCommandBuffers(resources.fence_counter);
+}
+
+void CommandBufferManager::CheckCompletedCommandBuffers()
+{
+  // Command buffers complete in submission order, so stop at the first one still in flight.
+  u64 now_completed_counter = m_completed_fence_counter;
+  u32 index = (m_current_cmd_buffer + 1) % NUM_COMMAND_BUFFERS;
+  while (index != m_current_cmd_buffer)
+  {
+    CmdBufferResources& resources = m_command_buffers[index];
+    if (resources.fence_counter > m_completed_fence_counter)
+    {
+      // The fence can't be queried while the worker thread may still be submitting with it.
+      if (resources.waiting_for_submit.load(std::memory_order_acquire) ||
+          vkGetFenceStatus(g_vulkan_context->GetDevice(), resources.fence) != VK_SUCCESS)
+      {
+        break;
+      }
+
+      now_completed_counter = resources.fence_counter;
+    }
+
+    index = (index + 1) % NUM_COMMAND_BUFFERS;
+  }
+
+  if (now_completed_counter != m_completed_fence_counter)
+    CleanupCompletedCommandBuffers(now_completed_counter);
+}
+
+void CommandBufferManager::CleanupCompletedCommandBuffers(u64 now_completed_counter)
+{
   // Clean up any resources for command buffers between the last known completed buffer and this
   // now-completed command buffer. If we use >2 buffers, this may be more than one buffer.
-  const u64 now_completed_counter = resources.fence_counter;
   u32 cleanup_index = (m_current_cmd_buffer + 1) % NUM_COMMAND_BUFFERS;
   while (cleanup_index != m_current_cmd_buffer)
   {
@@ -344,6 +379,10 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
       WaitForCommandBufferCompletion(m_current_cmd_buffer);
   }
 
+  // Pick up whatever the GPU finished in the meantime, so that stream buffers and queries see
+  // it before they have to wait for a fence.
+  CheckCompletedCommandBuffers();
+
   if (advance_to_next_frame)
   {
     m_current_frame = (m_current_frame + 1) % NUM_FRAMES_IN_FLIGHT;
@@ -427,8 +466,14 @@ void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
     submit_info.pSignalSemaphores = &m_present_semaphores[present_image_index];
   }
 
+#ifdef DOLPHIN_LIBRETRO
+  Libretro::LockQueue();
+#endif
   VkResult res =
       vkQueueSubmit(g_vulkan_context->GetGraphicsQueue(), 1, &submit_info, resources.fence);
+#ifdef DOLPHIN_LIBRETRO
+  Libretro::UnlockQueue();
+#endif
   if (res != VK_SUCCESS)
   {
     LOG_VULKAN_ERROR(res, "vkQueueSubmit failed: ");
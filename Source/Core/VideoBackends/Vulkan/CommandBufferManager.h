@@ -76,6 +76,10 @@ public:
   // Also invokes callbacks for completion.
   void WaitForFenceCounter(u64 fence_counter);
 
+  // Advances the completed fence counter past the command buffers the GPU has already finished,
+  // without waiting for any of them. Also invokes callbacks for completion.
+  void CheckCompletedCommandBuffers();
+
   void SubmitCommandBuffer(bool submit_on_worker_thread, bool wait_for_completion,
                            bool advance_to_next_frame = false,
                            VkSwapchainKHR present_swap_chain = VK_NULL_HANDLE,
@@ -100,6 +104,7 @@ private:
   bool CreateSubmitThread();
 
   void WaitForCommandBufferCompletion(u32 command_buffer_index);
+  void CleanupCompletedCommandBuffers(u64 now_completed_counter);
   void SubmitCommandBuffer(u32 command_buffer_index, VkSwapchainKHR present_swap_chain,
                            u32 present_image_index);
   void BeginCommandBuffer();
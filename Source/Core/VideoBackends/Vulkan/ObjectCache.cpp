@@ -9,9 +9,12 @@
 
 #include "Common/Assert.h"
 #include "Common/CommonFuncs.h"
+#include "Common/Contains.h"
 #include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/LinearDiskCache.h"
 #include "Common/MsgHandler.h"
+#include "Common/Thread.h"
 
 #include "Core/ConfigManager.h"
 
@@ -32,6 +35,8 @@ ObjectCache::ObjectCache() = default;
 
 ObjectCache::~ObjectCache()
 {
+  StopPipelineCacheSaveThread();
+  DestroyPipelineLibraries();
   DestroyPipelineCache();
   DestroySamplers();
   DestroyPipelineLayouts();
@@ -63,6 +68,13 @@ bool ObjectCache::Initialize()
   {
     if (!LoadPipelineCache())
       return false;
+
+    // Saving only at shutdown would lose everything the driver compiled if Dolphin crashes.
+    m_pipeline_cache_save_thread = std::thread([this] {
+      Common::SetCurrentThreadName("Vulkan pipeline cache saver");
+      while (!m_pipeline_cache_save_thread_stop.WaitFor(PIPELINE_CACHE_SAVE_INTERVAL))
+        SavePipelineCache();
+    });
   }
   else
   {
@@ -75,10 +87,61 @@ bool ObjectCache::Initialize()
 
 void ObjectCache::Shutdown()
 {
+  StopPipelineCacheSaveThread();
   if (g_ActiveConfig.bShaderCache && m_pipeline_cache != VK_NULL_HANDLE)
     SavePipelineCache();
 }
 
+void ObjectCache::StopPipelineCacheSaveThread()
+{
+  if (!m_pipeline_cache_save_thread.joinable())
+    return;
+
+  m_pipeline_cache_save_thread_stop.Set();
+  m_pipeline_cache_save_thread.join();
+}
+
+VkPipeline ObjectCache::GetPipelineLibrary(const PipelineLibraryKey& key,
+                                           const std::function<VkPipeline()>& create)
+{
+  {
+    std::lock_guard lk(m_pipeline_library_lock);
+    const auto it = m_pipeline_libraries.find(key);
+    if (it != m_pipeline_libraries.end())
+      return it->second;
+  }
+
+  // Pipelines compiled on other threads can keep linking while this one is created. If one of
+  // them created the same library meanwhile, theirs is kept.
+  const VkPipeline library = create();
+  if (library == VK_NULL_HANDLE)
+    return VK_NULL_HANDLE;
+
+  std::lock_guard lk(m_pipeline_library_lock);
+  const auto [it, inserted] = m_pipeline_libraries.try_emplace(key, library);
+  if (!inserted)
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), library, nullptr);
+  return it->second;
+}
+
+void ObjectCache::DestroyPipelineLibraries(u64 object)
+{
+  std::lock_guard lk(m_pipeline_library_lock);
+  std::erase_if(m_pipeline_libraries, [object](const auto& it) {
+    if (!Common::Contains(it.first.objects, object))
+      return false;
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), it.second, nullptr);
+    return true;
+  });
+}
+
+void ObjectCache::DestroyPipelineLibraries()
+{
+  for (const auto& it : m_pipeline_libraries)
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), it.second, nullptr);
+  m_pipeline_libraries.clear();
+}
+
 void ObjectCache::ClearSamplerCache()
 {
   for (const auto& it : m_sampler_cache)
@@ -543,6 +606,7 @@ bool ObjectCache::CreatePipelineCache()
       nullptr                                        // const void*                pInitialData
   };
 
+  m_saved_pipeline_cache_size = 0;
   VkResult res =
       vkCreatePipelineCache(g_vulkan_context->GetDevice(), &info, nullptr, &m_pipeline_cache);
   if (res == VK_SUCCESS)
@@ -582,7 +646,10 @@ bool ObjectCache::LoadPipelineCache()
   VkResult res =
       vkCreatePipelineCache(g_vulkan_context->GetDevice(), &info, nullptr, &m_pipeline_cache);
   if (res == VK_SUCCESS)
+  {
+    m_saved_pipeline_cache_size = disk_data.size();
     return true;
+  }
 
   // Failed to create pipeline cache, try with it empty.
   LOG_VULKAN_ERROR(res, "vkCreatePipelineCache failed, trying empty cache: ");
@@ -660,6 +727,12 @@ void ObjectCache::DestroyPipelineCache()
 }
 
 void ObjectCache::SavePipelineCache()
+{
+  std::lock_guard lk(m_pipeline_cache_lock);
+  SavePipelineCacheLocked();
+}
+
+void ObjectCache::SavePipelineCacheLocked()
 {
   size_t data_size;
   VkResult res =
@@ -670,6 +743,10 @@ void ObjectCache::SavePipelineCache()
     return;
   }
 
+  // Drivers only add to the cache, so the same size means there's nothing new to save.
+  if (data_size == m_saved_pipeline_cache_size)
+    return;
+
   std::vector<u8> data(data_size);
   res = vkGetPipelineCacheData(g_vulkan_context->GetDevice(), m_pipeline_cache, &data_size,
                                data.data());
@@ -679,22 +756,34 @@ void ObjectCache::SavePipelineCache()
     return;
   }
 
-  // Delete the old cache and re-create.
-  File::Delete(m_pipeline_cache_filename);
+  // Other instances of Dolphin may share the cache directory. If one of them is saving the cache
+  // right now, it gets to replace it, and this one saves again next time.
+  File::IOFile lock_file(m_pipeline_cache_filename + ".lock", "ab", File::SharedAccess::ReadWrite);
+  if (!lock_file.TryLock())
+    return;
+
+  // Write a new cache next to the old one and replace it, so that the old one survives a crash
+  // while writing.
+  const std::string temp_filename = m_pipeline_cache_filename + ".tmp";
+  File::Delete(temp_filename);
 
   // We write a single key of 1, with the entire pipeline cache data.
   // Not ideal, but our disk cache class does not support just writing a single blob
   // of data without specifying a key.
   Common::LinearDiskCache<u32, u8> disk_cache;
   PipelineCacheReadIgnoreCallback callback;
-  disk_cache.OpenAndRead(m_pipeline_cache_filename, callback);
+  disk_cache.OpenAndRead(temp_filename, callback);
   disk_cache.Append(1, data.data(), static_cast<u32>(data.size()));
   disk_cache.Close();
+
+  if (File::Rename(temp_filename, m_pipeline_cache_filename))
+    m_saved_pipeline_cache_size = data_size;
 }
 
 void ObjectCache::ReloadPipelineCache()
 {
-  SavePipelineCache();
+  std::lock_guard lk(m_pipeline_cache_lock);
+  SavePipelineCacheLocked();
 
   if (g_ActiveConfig.bShaderCache)
     LoadPipelineCache();
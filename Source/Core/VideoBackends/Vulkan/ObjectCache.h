@@ -4,14 +4,19 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <cstddef>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
 #include "Common/LinearDiskCache.h"
 
 #include "VideoBackends/Vulkan/Constants.h"
@@ -69,12 +74,36 @@ public:
   // WARNING: Ensure none of the objects from here are in use when calling
   void ClearSamplerCache();
 
-  // Saves the pipeline cache to disk. Call when shutting down.
+  // How often the pipeline cache is saved while running, if the driver added to it.
+  static constexpr std::chrono::minutes PIPELINE_CACHE_SAVE_INTERVAL{1};
+
+  // Saves the pipeline cache to disk, if it changed since it was last saved or loaded.
   void SavePipelineCache();
 
   // Reload pipeline cache. Call when host config changes.
   void ReloadPipelineCache();
 
+  // Parts of pipelines created with VK_EXT_graphics_pipeline_library, which pipelines are linked
+  // from. The objects are the shader modules or vertex format a part was created with, and the
+  // states are whatever else it depends on.
+  struct PipelineLibraryKey
+  {
+    u32 part;
+    std::array<u64, 2> objects;
+    std::array<u32, 3> states;
+
+    auto operator<=>(const PipelineLibraryKey&) const = default;
+  };
+
+  // Returns the library for the key, calling create to create it if there isn't one yet.
+  // Returns VK_NULL_HANDLE if creating it failed. Can be called from any thread.
+  VkPipeline GetPipelineLibrary(const PipelineLibraryKey& key,
+                                const std::function<VkPipeline()>& create);
+
+  // Destroys the libraries created with a shader module or vertex format. Call before it is
+  // destroyed, so that a new object at the same address doesn't get its libraries.
+  void DestroyPipelineLibraries(u64 object);
+
 private:
   bool CreateDescriptorSetLayouts();
   void DestroyDescriptorSetLayouts();
@@ -87,6 +116,9 @@ private:
   bool LoadPipelineCache();
   bool ValidatePipelineCache(const u8* data, size_t data_length);
   void DestroyPipelineCache();
+  void SavePipelineCacheLocked();
+  void StopPipelineCacheSaveThread();
+  void DestroyPipelineLibraries();
 
   std::array<VkDescriptorSetLayout, NUM_DESCRIPTOR_SET_LAYOUTS> m_descriptor_set_layouts = {};
   std::array<VkPipelineLayout, NUM_PIPELINE_LAYOUTS> m_pipeline_layouts = {};
@@ -108,6 +140,16 @@ private:
   // pipeline cache
   VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
   std::string m_pipeline_cache_filename;
+
+  // The driver's pipeline cache is internally synchronized, this only keeps the save thread from
+  // seeing the handle or the file change while it saves.
+  std::mutex m_pipeline_cache_lock;
+  size_t m_saved_pipeline_cache_size = 0;
+  std::thread m_pipeline_cache_save_thread;
+  Common::Event m_pipeline_cache_save_thread_stop;
+
+  std::mutex m_pipeline_library_lock;
+  std::map<PipelineLibraryKey, VkPipeline> m_pipeline_libraries;
 };
 
 extern std::unique_ptr<ObjectCache> g_object_cache;
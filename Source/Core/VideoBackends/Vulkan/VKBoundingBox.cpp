@@ -37,7 +37,7 @@ bool VKBoundingBox::Initialize()
   return true;
 }
 
-std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+void VKBoundingBox::CopyToReadbackBuffer()
 {
   // Can't be done within a render pass.
   StateTracker::GetInstance()->EndRenderPass();
@@ -63,6 +63,11 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
       VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
   m_readback_buffer->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
                                    VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+}
+
+std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+{
+  CopyToReadbackBuffer();
 
   // Wait until these commands complete.
   VKGfx::GetInstance()->ExecuteCommandBuffer(false, true);
@@ -77,6 +82,25 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
   return values;
 }
 
+bool VKBoundingBox::BeginReadback()
+{
+  // The copy runs whenever the current command buffer is submitted, usually at the end of the
+  // frame.
+  CopyToReadbackBuffer();
+  m_readback_fence_counter = g_command_buffer_mgr->GetCurrentFenceCounter();
+  return true;
+}
+
+bool VKBoundingBox::PollReadback(std::span<BBoxType, NUM_BBOX_VALUES> values)
+{
+  if (g_command_buffer_mgr->GetCompletedFenceCounter() < m_readback_fence_counter)
+    return false;
+
+  m_readback_buffer->InvalidateCPUCache();
+  m_readback_buffer->Read(0, values.data(), BUFFER_SIZE, false);
+  return true;
+}
+
 void VKBoundingBox::Write(u32 index, std::span<const BBoxType> values)
 {
   // We can't issue vkCmdUpdateBuffer within a render pass.
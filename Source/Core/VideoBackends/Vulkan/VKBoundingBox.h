@@ -27,10 +27,13 @@ public:
 protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
+  bool BeginReadback() override;
+  bool PollReadback(std::span<BBoxType, NUM_BBOX_VALUES> values) override;
 
 private:
   bool CreateGPUBuffer();
   bool CreateReadbackBuffer();
+  void CopyToReadbackBuffer();
 
   VkBuffer m_gpu_buffer = VK_NULL_HANDLE;
   VmaAllocation m_gpu_allocation = VK_NULL_HANDLE;
@@ -38,6 +41,9 @@ private:
   static constexpr size_t BUFFER_SIZE = sizeof(BBoxType) * NUM_BBOX_VALUES;
 
   std::unique_ptr<StagingBuffer> m_readback_buffer;
+
+  // The fence counter of the command buffer which copies to m_readback_buffer for BeginReadback.
+  u64 m_readback_fence_counter = 0;
 };
 
 }  // namespace Vulkan
@@ -26,6 +26,10 @@
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/VideoConfig.h"
 
+#ifdef DOLPHIN_LIBRETRO
+#include "VideoBackends/Vulkan/VKLibretro.h"
+#endif
+
 namespace Vulkan
 {
 VKGfx::VKGfx(std::unique_ptr<SwapChain> swap_chain, float backbuffer_scale)
@@ -44,6 +48,10 @@ VKGfx::~VKGfx() = default;
 
 bool VKGfx::IsHeadless() const
 {
+#ifdef DOLPHIN_LIBRETRO
+  if (Libretro::IsActive())
+    return false;
+#endif
   return m_swap_chain == nullptr;
 }
 
@@ -223,6 +231,19 @@ bool VKGfx::BindBackbuffer(const ClearColor& clear_color)
 
   g_command_buffer_mgr->WaitForWorkerThreadIdle();
 
+#ifdef DOLPHIN_LIBRETRO
+  if (Libretro::IsActive())
+  {
+    VKFramebuffer* framebuffer =
+        Libretro::AcquireBackFrame(g_command_buffer_mgr->GetCurrentCommandBuffer());
+    if (!framebuffer)
+      return false;
+
+    SetAndClearFramebuffer(framebuffer, ClearColor{{0.0f, 0.0f, 0.0f, 1.0f}});
+    return true;
+  }
+#endif
+
   // Handle host window resizes.
   CheckForSurfaceChange();
   CheckForSurfaceResize();
@@ -311,6 +332,18 @@ void VKGfx::PresentBackbuffer()
   // End drawing to backbuffer
   StateTracker::GetInstance()->EndRenderPass();
 
+#ifdef DOLPHIN_LIBRETRO
+  if (Libretro::IsActive())
+  {
+    // The frontend samples the image directly, so it only has to be readable once submitted.
+    Libretro::FinishBackFrame(g_command_buffer_mgr->GetCurrentCommandBuffer());
+    g_command_buffer_mgr->SubmitCommandBuffer(false, false, true);
+    Libretro::PublishBackFrame();
+    StateTracker::GetInstance()->InvalidateCachedState();
+    return;
+  }
+#endif
+
   if (m_swap_chain->IsCurrentImageValid())
   {
     // Transition the backbuffer to PRESENT_SRC to ensure all commands drawing
@@ -617,6 +650,13 @@ void VKGfx::DispatchComputeShader(const AbstractShader* shader, u32 groupsize_x,
 
 SurfaceInfo VKGfx::GetSurfaceInfo() const
 {
+#ifdef DOLPHIN_LIBRETRO
+  if (Libretro::IsActive())
+  {
+    return {Libretro::GetBackbufferWidth(), Libretro::GetBackbufferHeight(), m_backbuffer_scale,
+            AbstractTextureFormat::RGBA8};
+  }
+#endif
   return {m_swap_chain ? m_swap_chain->GetWidth() : 1u,
           m_swap_chain ? m_swap_chain->GetHeight() : 0u, m_backbuffer_scale,
           m_swap_chain ? m_swap_chain->GetTextureFormat() : AbstractTextureFormat::Undefined};
@@ -0,0 +1,246 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/Vulkan/VKLibretro.h"
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "Common/Logging/Log.h"
+#include "VideoBackends/Vulkan/VKTexture.h"
+#include "VideoBackends/Vulkan/VulkanContext.h"
+#include "VideoCommon/TextureConfig.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace Vulkan::Libretro
+{
+namespace
+{
+struct Frame
+{
+  std::unique_ptr<VKTexture> texture;
+  std::unique_ptr<VKFramebuffer> framebuffer;
+};
+
+// The video thread owns s_frames[s_back_frame], the frontend owns s_frames[s_front_frame], and the
+// remaining frame is handed over through s_middle_frame. FRAME_READY_BIT is set there while it
+// holds a completed frame the frontend hasn't taken yet; an untaken frame is simply overwritten.
+//
+// No semaphores are needed: all work is submitted to the frontend's queue, so the layout
+// transitions in AcquireBackFrame() and FinishBackFrame() order our rendering against the
+// frontend's sampling.
+constexpr u32 FRAME_READY_BIT = 0x100;
+std::array<Frame, 3> s_frames;
+std::atomic<u32> s_middle_frame{1};
+u32 s_back_frame = 0;
+u32 s_front_frame = 2;
+
+std::unique_ptr<VulkanContext> s_context;
+std::atomic<bool> s_active{false};
+HostCallbacks s_callbacks;
+}  // namespace
+
+bool CreateDevice(VkInstance instance, VkPhysicalDevice gpu, VkSurfaceKHR surface,
+                  PFN_vkGetInstanceProcAddr get_instance_proc_addr,
+                  std::span<const char* const> required_extensions,
+                  const VkPhysicalDeviceFeatures* required_features, CreatedDevice* out_device)
+{
+  if (!LoadVulkanLibrary(get_instance_proc_addr, instance))
+  {
+    ERROR_LOG_FMT(VIDEO, "Libretro Vulkan: Failed to load the frontend's Vulkan functions");
+    return false;
+  }
+
+  if (gpu == VK_NULL_HANDLE)
+  {
+    const VulkanContext::GPUList gpu_list = VulkanContext::EnumerateGPUs(instance);
+    if (gpu_list.empty())
+    {
+      ERROR_LOG_FMT(VIDEO, "Libretro Vulkan: No Vulkan physical devices available");
+      UnloadVulkanLibrary();
+      return false;
+    }
+
+    const size_t adapter = static_cast<size_t>(g_Config.iAdapter);
+    gpu = gpu_list[adapter < gpu_list.size() ? adapter : 0];
+  }
+
+  // Creating the context assumes these were populated.
+  VulkanContext::PopulateBackendInfo(&g_backend_info);
+  VulkanContext::PopulateBackendInfoAdapters(&g_backend_info, {gpu});
+
+  s_context = VulkanContext::CreateWithExternalInstance(
+      instance, gpu, surface,
+      std::vector<std::string>(required_extensions.begin(), required_extensions.end()),
+      required_features, VK_API_VERSION_1_0);
+  if (!s_context)
+  {
+    ERROR_LOG_FMT(VIDEO, "Libretro Vulkan: Failed to create a device for the frontend");
+    UnloadVulkanLibrary();
+    return false;
+  }
+
+  out_device->gpu = s_context->GetPhysicalDevice();
+  out_device->device = s_context->GetDevice();
+  out_device->queue = s_context->GetGraphicsQueue();
+  out_device->queue_family_index = s_context->GetGraphicsQueueFamilyIndex();
+  if (s_context->GetPresentQueue() != VK_NULL_HANDLE)
+  {
+    out_device->present_queue = s_context->GetPresentQueue();
+    out_device->present_queue_family_index = s_context->GetPresentQueueFamilyIndex();
+  }
+  else
+  {
+    out_device->present_queue = out_device->queue;
+    out_device->present_queue_family_index = out_device->queue_family_index;
+  }
+
+  s_active.store(true);
+  return true;
+}
+
+void ReleaseDevice()
+{
+  s_active.store(false);
+  s_callbacks = {};
+  s_context.reset();
+}
+
+void DestroyDevice()
+{
+  ReleaseDevice();
+  UnloadVulkanLibrary();
+}
+
+void SetHostCallbacks(const HostCallbacks& callbacks)
+{
+  s_callbacks = callbacks;
+}
+
+bool TakeFrontFrame(PresentedFrame* frame)
+{
+  if (!(s_middle_frame.load() & FRAME_READY_BIT))
+    return false;
+
+  s_front_frame = s_middle_frame.exchange(s_front_frame) & ~FRAME_READY_BIT;
+  const VKTexture* texture = s_frames[s_front_frame].texture.get();
+  if (!texture)
+    return false;
+
+  frame->view = texture->GetView();
+  frame->view_info = {VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+                      nullptr,
+                      0,
+                      texture->GetImage(),
+                      VK_IMAGE_VIEW_TYPE_2D,
+                      texture->GetVkFormat(),
+                      {VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY,
+                       VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY},
+                      {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1}};
+  frame->layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+  frame->width = texture->GetWidth();
+  frame->height = texture->GetHeight();
+  return true;
+}
+
+bool IsActive()
+{
+  return s_active.load();
+}
+
+const VulkanContext* GetContext()
+{
+  return s_context.get();
+}
+
+std::unique_ptr<VulkanContext> TakeContext()
+{
+  return std::move(s_context);
+}
+
+void ReturnContext(std::unique_ptr<VulkanContext> context)
+{
+  s_context = std::move(context);
+}
+
+void LockQueue()
+{
+  if (s_callbacks.lock_queue)
+    s_callbacks.lock_queue(s_callbacks.handle);
+}
+
+void UnlockQueue()
+{
+  if (s_callbacks.unlock_queue)
+    s_callbacks.unlock_queue(s_callbacks.handle);
+}
+
+u32 GetBackbufferWidth()
+{
+  return s_callbacks.base_width ? s_callbacks.base_width : 640;
+}
+
+u32 GetBackbufferHeight()
+{
+  return s_callbacks.base_height ? s_callbacks.base_height : 528;
+}
+
+VKFramebuffer* AcquireBackFrame(VkCommandBuffer command_buffer)
+{
+  Frame& frame = s_frames[s_back_frame];
+  const u32 width = GetBackbufferWidth();
+  const u32 height = GetBackbufferHeight();
+  if (!frame.texture || frame.texture->GetWidth() != width || frame.texture->GetHeight() != height)
+  {
+    frame.framebuffer.reset();
+    frame.texture = VKTexture::Create(TextureConfig(width, height, 1, 1, 1,
+                                                    AbstractTextureFormat::RGBA8,
+                                                    AbstractTextureFlag_RenderTarget,
+                                                    AbstractTextureType::Texture_2D),
+                                      "Libretro frame");
+    if (!frame.texture)
+      return nullptr;
+
+    frame.framebuffer = VKFramebuffer::Create(frame.texture.get(), nullptr, {});
+    if (!frame.framebuffer)
+    {
+      frame.texture.reset();
+      return nullptr;
+    }
+  }
+
+  // Transitioning from the shader read layout also waits for the frontend's sampling of it.
+  frame.texture->TransitionToLayout(command_buffer, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+  return frame.framebuffer.get();
+}
+
+void FinishBackFrame(VkCommandBuffer command_buffer)
+{
+  Frame& frame = s_frames[s_back_frame];
+  if (frame.texture)
+    frame.texture->TransitionToLayout(command_buffer, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+}
+
+void PublishBackFrame()
+{
+  if (!s_frames[s_back_frame].texture)
+    return;
+
+  s_back_frame = s_middle_frame.exchange(s_back_frame | FRAME_READY_BIT) & ~FRAME_READY_BIT;
+}
+
+void DestroyFrames()
+{
+  for (Frame& frame : s_frames)
+  {
+    frame.framebuffer.reset();
+    frame.texture.reset();
+  }
+
+  s_back_frame = 0;
+  s_middle_frame.store(1);
+  s_front_frame = 2;
+}
+}  // namespace Vulkan::Libretro
@@ -0,0 +1,87 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Support for running the Vulkan backend on a device shared with a libretro frontend.
+//
+// The frontend calls CreateDevice() while it sets up its context, so the device is created with
+// the extensions and features the backend wants. The backend then borrows that context for the
+// duration of a game instead of creating its own instance and device. Frames are rendered into a
+// queue of three core-owned images; the newest completed one is handed to the frontend by
+// TakeFrontFrame(), which the frontend samples directly, so there is no extra copy.
+
+#include <memory>
+#include <span>
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/Vulkan/VulkanLoader.h"
+
+namespace Vulkan
+{
+class VKFramebuffer;
+class VulkanContext;
+
+namespace Libretro
+{
+struct HostCallbacks
+{
+  void* handle = nullptr;
+  // The frontend shares its queue with us, so every submission has to hold its lock.
+  void (*lock_queue)(void* handle) = nullptr;
+  void (*unlock_queue)(void* handle) = nullptr;
+  u32 base_width = 0;
+  u32 base_height = 0;
+};
+
+struct PresentedFrame
+{
+  VkImageView view;
+  VkImageViewCreateInfo view_info;
+  VkImageLayout layout;
+  u32 width;
+  u32 height;
+};
+
+struct CreatedDevice
+{
+  VkPhysicalDevice gpu;
+  VkDevice device;
+  VkQueue queue;
+  u32 queue_family_index;
+  VkQueue present_queue;
+  u32 present_queue_family_index;
+};
+
+// Frontend thread.
+bool CreateDevice(VkInstance instance, VkPhysicalDevice gpu, VkSurfaceKHR surface,
+                  PFN_vkGetInstanceProcAddr get_instance_proc_addr,
+                  std::span<const char* const> required_extensions,
+                  const VkPhysicalDeviceFeatures* required_features, CreatedDevice* out_device);
+// Frees everything that was created on the device, which the frontend destroys itself.
+void ReleaseDevice();
+// Called once the frontend destroyed the device.
+void DestroyDevice();
+void SetHostCallbacks(const HostCallbacks& callbacks);
+// Returns the newest frame completed since the last call, without waiting for the video thread.
+bool TakeFrontFrame(PresentedFrame* frame);
+
+// Video thread.
+bool IsActive();
+// Returns the context while it isn't borrowed by the backend.
+const VulkanContext* GetContext();
+std::unique_ptr<VulkanContext> TakeContext();
+void ReturnContext(std::unique_ptr<VulkanContext> context);
+void LockQueue();
+void UnlockQueue();
+u32 GetBackbufferWidth();
+u32 GetBackbufferHeight();
+// Returns the framebuffer the next frame should be drawn to, transitioned for rendering.
+VKFramebuffer* AcquireBackFrame(VkCommandBuffer command_buffer);
+// Transitions the drawn frame for sampling. Must be called before the command buffer is submitted.
+void FinishBackFrame(VkCommandBuffer command_buffer);
+// Makes the finished frame available to TakeFrontFrame(). Must be called after the submission.
+void PublishBackFrame();
+void DestroyFrames();
+}  // namespace Libretro
+}  // namespace Vulkan
@@ -11,6 +11,9 @@
 #include "VideoBackends/Vulkan/StateTracker.h"
 #include "VideoBackends/Vulkan/VKBoundingBox.h"
 #include "VideoBackends/Vulkan/VKGfx.h"
+#ifdef DOLPHIN_LIBRETRO
+#include "VideoBackends/Vulkan/VKLibretro.h"
+#endif
 #include "VideoBackends/Vulkan/VKPerfQuery.h"
 #include "VideoBackends/Vulkan/VKSwapChain.h"
 #include "VideoBackends/Vulkan/VKVertexManager.h"
@@ -27,6 +30,22 @@ namespace Vulkan
 {
 void VideoBackend::InitBackendInfo(const WindowSystemInfo& wsi)
 {
+#ifdef DOLPHIN_LIBRETRO
+  // Don't touch the frontend's loader, use the device that was created for it instead.
+  if (const VulkanContext* context = Libretro::GetContext())
+  {
+    VulkanContext::PopulateBackendInfo(&g_backend_info);
+    VulkanContext::PopulateBackendInfoAdapters(&g_backend_info, {context->GetPhysicalDevice()});
+    VulkanContext::PopulateBackendInfoFeatures(&g_backend_info, context->GetPhysicalDevice(),
+                                               context->GetDeviceInfo());
+    VulkanContext::PopulateBackendInfoMultisampleModes(
+        &g_backend_info, context->GetPhysicalDevice(), context->GetDeviceInfo());
+    g_backend_info.bSupportsUnrestrictedDepthRange =
+        context->SupportsDeviceExtension(VK_EXT_DEPTH_RANGE_UNRESTRICTED_EXTENSION_NAME);
+    return;
+  }
+#endif
+
   VulkanContext::PopulateBackendInfo(&g_backend_info);
 
   if (LoadVulkanLibrary())
@@ -88,7 +107,8 @@ static bool ShouldEnableDebugUtils(bool enable_validation_layers)
   return enable_validation_layers || IsHostGPULoggingEnabled();
 }
 
-bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
+// Creates the instance, surface and device of g_vulkan_context.
+static bool CreateContext(const WindowSystemInfo& wsi, VkSurfaceKHR* out_surface)
 {
   if (!LoadVulkanLibrary())
   {
@@ -176,6 +196,33 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
     return false;
   }
 
+  *out_surface = surface;
+  return true;
+}
+
+bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
+{
+  VkSurfaceKHR surface = VK_NULL_HANDLE;
+#ifdef DOLPHIN_LIBRETRO
+  if (wsi.type == WindowSystemType::Libretro)
+  {
+    // The device was created for the frontend in Libretro::CreateDevice(), we only borrow it for
+    // this session.
+    g_vulkan_context = Libretro::TakeContext();
+    if (!g_vulkan_context)
+    {
+      PanicAlertFmt("The libretro frontend did not provide a Vulkan device.");
+      return false;
+    }
+  }
+  else
+#endif
+  {
+    if (!CreateContext(wsi, &surface))
+      return false;
+  }
+  const bool enable_surface = surface != VK_NULL_HANDLE;
+
   // Since VulkanContext maintains a copy of the device features and properties, we can use this
   // to initialize the backend information, so that we don't need to enumerate everything again.
   VulkanContext::PopulateBackendInfoFeatures(&g_backend_info, g_vulkan_context->GetPhysicalDevice(),
@@ -241,6 +288,12 @@ void VideoBackend::Shutdown()
   if (g_vulkan_context)
     vkDeviceWaitIdle(g_vulkan_context->GetDevice());
 
+#ifdef DOLPHIN_LIBRETRO
+  const bool is_libretro_device = Libretro::IsActive();
+  if (is_libretro_device)
+    Libretro::DestroyFrames();
+#endif
+
   if (g_object_cache)
     g_object_cache->Shutdown();
 
@@ -249,6 +302,13 @@ void VideoBackend::Shutdown()
   g_object_cache.reset();
   StateTracker::DestroyInstance();
   g_command_buffer_mgr.reset();
+#ifdef DOLPHIN_LIBRETRO
+  if (is_libretro_device)
+  {
+    Libretro::ReturnContext(std::move(g_vulkan_context));
+    return;
+  }
+#endif
   g_vulkan_context.reset();
   UnloadVulkanLibrary();
 }
@@ -38,7 +38,7 @@ bool PerfQuery::Initialize()
   }
 
   // Vulkan requires query pools to be reset after creation
-  ResetQuery();
+  ResetQueryPool();
 
   return true;
 }
@@ -88,6 +88,24 @@ void PerfQuery::DisableQuery(PerfQueryGroup group)
 
 void PerfQuery::ResetQuery()
 {
+  if (!ShouldDefer())
+  {
+    ResetQueryPool();
+    return;
+  }
+
+  // Keep the pending queries, and read back the ones that have completed without waiting. Only if
+  // the GPU is so far behind that the previous period is still pending, wait for it.
+  ReadbackQueries();
+  if (GetPendingPeriodQueryCount() != 0)
+    PartialFlush(true);
+
+  EndQueryPeriod(m_query_count.load(std::memory_order_relaxed));
+}
+
+void PerfQuery::ResetQueryPool()
+{
+  ResetQueryPeriods();
   m_query_count.store(0, std::memory_order_relaxed);
   m_query_readback_pos = 0;
   m_query_next_pos = 0;
@@ -224,8 +242,7 @@ void PerfQuery::ReadbackQueries(u32 query_count)
                             g_framebuffer_manager->GetEFBHeight();
     if (g_ActiveConfig.iMultisamples > 1)
       native_res_result /= g_ActiveConfig.iMultisamples;
-    m_results[entry.query_group].fetch_add(static_cast<u32>(native_res_result),
-                                           std::memory_order_relaxed);
+    AddQueryResult(entry.query_group, static_cast<u32>(native_res_result));
   }
 
   m_query_readback_pos = (m_query_readback_pos + query_count) % PERF_QUERY_BUFFER_SIZE;
@@ -29,6 +29,9 @@ public:
   void FlushResults() override;
   bool IsFlushed() const override;
 
+protected:
+  bool SupportsDeferredResults() const override { return true; }
+
 private:
   // u32 is used for the sample counts.
   using PerfQueryDataType = u32;
@@ -45,6 +48,7 @@ private:
   };
 
   bool CreateQueryPool();
+  void ResetQueryPool();
   void ReadbackQueries();
   void ReadbackQueries(u32 query_count);
   void PartialFlush(bool blocking);
@@ -6,6 +6,7 @@
 #include <array>
 
 #include "Common/Assert.h"
+#include "Common/Contains.h"
 #include "Common/EnumMap.h"
 #include "Common/MsgHandler.h"
 
@@ -240,6 +241,119 @@ GetVulkanColorBlendState(const BlendingState& state,
   return vk_state;
 }
 
+static VkPipeline GetPipelineLibrary(const VkGraphicsPipelineCreateInfo& info,
+                                     VkGraphicsPipelineLibraryFlagsEXT part,
+                                     const std::array<u64, 2>& objects,
+                                     const std::array<u32, 3>& states)
+{
+  return g_object_cache->GetPipelineLibrary({part, objects, states}, [&] {
+    VkGraphicsPipelineLibraryCreateInfoEXT library_info = {
+        VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT, nullptr, part};
+    VkGraphicsPipelineCreateInfo library_pipeline_info = info;
+    library_pipeline_info.pNext = &library_info;
+    library_pipeline_info.flags = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+
+    VkPipeline library;
+    VkResult res = vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(),
+                                             g_object_cache->GetPipelineCache(), 1,
+                                             &library_pipeline_info, nullptr, &library);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines failed for a pipeline library: ");
+      return VkPipeline(VK_NULL_HANDLE);
+    }
+    return library;
+  });
+}
+
+// Links the pipeline from libraries of its parts, which are shared with every other pipeline that
+// has the same shaders and state for that part. Only recompiling the parts that changed is much
+// faster than creating the whole pipeline when e.g. just the blending state differs. Returns
+// VK_NULL_HANDLE if it couldn't be linked, in which case the whole pipeline should be created.
+static VkPipeline LinkPipeline(const AbstractPipelineConfig& config,
+                               const VkGraphicsPipelineCreateInfo& info)
+{
+  const auto shader_module = [](const AbstractShader* shader) {
+    return shader ? reinterpret_cast<u64>(static_cast<const VKShader*>(shader)->GetShaderModule()) :
+                    u64(0);
+  };
+  const u32 usage = static_cast<u32>(config.usage);
+  const u32 primitive = static_cast<u32>(config.rasterization_state.primitive.Value());
+
+  // The pixel shader is the last stage.
+  if (!config.pixel_shader)
+    return VK_NULL_HANDLE;
+  const u32 num_pre_rasterization_stages = info.stageCount - 1;
+
+  VkGraphicsPipelineCreateInfo vertex_input_info = {
+      VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+  vertex_input_info.pVertexInputState = info.pVertexInputState;
+  vertex_input_info.pInputAssemblyState = info.pInputAssemblyState;
+
+  VkGraphicsPipelineCreateInfo pre_rasterization_info = {
+      VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+  pre_rasterization_info.stageCount = num_pre_rasterization_stages;
+  pre_rasterization_info.pStages = info.pStages;
+  pre_rasterization_info.pViewportState = info.pViewportState;
+  pre_rasterization_info.pRasterizationState = info.pRasterizationState;
+  pre_rasterization_info.pDynamicState = info.pDynamicState;
+  pre_rasterization_info.layout = info.layout;
+  pre_rasterization_info.renderPass = info.renderPass;
+
+  VkGraphicsPipelineCreateInfo fragment_shader_info = {
+      VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+  fragment_shader_info.stageCount = 1;
+  fragment_shader_info.pStages = &info.pStages[num_pre_rasterization_stages];
+  fragment_shader_info.pMultisampleState = info.pMultisampleState;
+  fragment_shader_info.pDepthStencilState = info.pDepthStencilState;
+  fragment_shader_info.layout = info.layout;
+  fragment_shader_info.renderPass = info.renderPass;
+
+  VkGraphicsPipelineCreateInfo fragment_output_info = {
+      VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+  fragment_output_info.pMultisampleState = info.pMultisampleState;
+  fragment_output_info.pColorBlendState = info.pColorBlendState;
+  fragment_output_info.renderPass = info.renderPass;
+
+  // The render pass only depends on the framebuffer state.
+  const std::array<VkPipeline, 4> libraries = {
+      GetPipelineLibrary(vertex_input_info,
+                         VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+                         {reinterpret_cast<u64>(config.vertex_format), 0}, {primitive, 0, 0}),
+      GetPipelineLibrary(
+          pre_rasterization_info, VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+          {shader_module(config.vertex_shader), shader_module(config.geometry_shader)},
+          {config.rasterization_state.hex, config.framebuffer_state.hex, usage}),
+      GetPipelineLibrary(fragment_shader_info, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+                         {shader_module(config.pixel_shader), 0},
+                         {config.depth_state.hex, config.framebuffer_state.hex, usage}),
+      GetPipelineLibrary(fragment_output_info,
+                         VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, {0, 0},
+                         {config.blending_state.hex, config.framebuffer_state.hex, usage}),
+  };
+  if (Common::Contains(libraries, VkPipeline(VK_NULL_HANDLE)))
+    return VK_NULL_HANDLE;
+
+  const VkPipelineLibraryCreateInfoKHR library_info = {
+      VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR, nullptr,
+      static_cast<u32>(libraries.size()), libraries.data()};
+  VkGraphicsPipelineCreateInfo linked_info = {VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+  linked_info.pNext = &library_info;
+  linked_info.layout = info.layout;
+
+  VkPipeline pipeline;
+  VkResult res =
+      vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
+                                1, &linked_info, nullptr, &pipeline);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines failed to link a pipeline: ");
+    return VK_NULL_HANDLE;
+  }
+
+  return pipeline;
+}
+
 std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& config)
 {
   DEBUG_ASSERT(config.vertex_shader && config.pixel_shader);
@@ -423,6 +537,13 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
       -1                     // int32_t                                          basePipelineIndex
   };
 
+  if (g_vulkan_context->SupportsGraphicsPipelineLibrary())
+  {
+    const VkPipeline pipeline = LinkPipeline(config, pipeline_info);
+    if (pipeline != VK_NULL_HANDLE)
+      return std::make_unique<VKPipeline>(config, pipeline, pipeline_layout, config.usage);
+  }
+
   VkPipeline pipeline;
   VkResult res =
       vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
@@ -355,32 +355,7 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   width = std::max(1u, std::min(width, GetWidth() >> level));
   height = std::max(1u, std::min(height, GetHeight() >> level));
 
-  // We don't care about the existing contents of the texture, so we could the image layout to
-  // VK_IMAGE_LAYOUT_UNDEFINED here. However, under section 2.2.1, Queue Operation of the Vulkan
-  // specification, it states:
-  //
-  //   Command buffer submissions to a single queue must always adhere to command order and
-  //   API order, but otherwise may overlap or execute out of order.
-  //
-  // Therefore, if a previous frame's command buffer is still sampling from this texture, and we
-  // overwrite it without a pipeline barrier, a texture sample could occur in parallel with the
-  // texture upload/copy. I'm not sure if any drivers currently take advantage of this, but we
-  // should insert an explicit pipeline barrier just in case (done by TransitionToLayout).
-  //
-  // We transition to TRANSFER_DST, ready for the image copy, and leave the texture in this state.
-  // When the last mip level is uploaded, we transition to SHADER_READ_ONLY, ready for use. This is
-  // because we can't transition in a render pass, and we don't necessarily know when this texture
-  // is going to be used.
-  TransitionToLayout(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
-                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-
-  // For unaligned textures, we can save some memory in the transfer buffer by skipping the rows
-  // that lie outside of the texture's dimensions.
-  const u32 upload_alignment = static_cast<u32>(g_vulkan_context->GetBufferImageGranularity());
-  const u32 block_size = GetBlockSizeForFormat(GetFormat());
-  const u32 num_rows = Common::AlignUp(height, block_size) / block_size;
-  const u32 source_pitch = CalculateStrideForFormat(m_config.format, row_length);
-  const u32 upload_size = source_pitch * num_rows;
+  const u32 upload_size = GetLoadUploadSize(height, row_length);
   std::unique_ptr<StagingBuffer> temp_buffer;
   VkBuffer upload_buffer;
   VkDeviceSize upload_buffer_offset;
@@ -388,18 +363,10 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   // Does this texture data fit within the streaming buffer?
   if (upload_size <= STAGING_TEXTURE_UPLOAD_THRESHOLD)
   {
-    StreamBuffer* stream_buffer = g_object_cache->GetTextureUploadBuffer();
-    if (!stream_buffer->ReserveMemory(upload_size, upload_alignment))
-    {
-      // Execute the command buffer first.
-      WARN_LOG_FMT(VIDEO,
-                   "Executing command list while waiting for space in texture upload buffer");
-      VKGfx::GetInstance()->ExecuteCommandBuffer(false);
-
-      // Try allocating again. This may cause a fence wait.
-      if (!stream_buffer->ReserveMemory(upload_size, upload_alignment))
-        PanicAlertFmt("Failed to allocate space in texture upload buffer");
-    }
+    StreamBuffer* stream_buffer = ReserveTextureUploadMemory(upload_size);
+    if (!stream_buffer)
+      return;
+
     // Copy to the streaming buffer.
     upload_buffer = stream_buffer->GetBuffer();
     upload_buffer_offset = stream_buffer->GetCurrentOffset();
@@ -423,6 +390,97 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
     temp_buffer->Unmap();
   }
 
+  CopyFromUploadBuffer(upload_buffer, upload_buffer_offset, level, width, height, row_length,
+                       layer);
+}
+
+u8* VKTexture::MapLoadBuffer(u32 level, u32 width, u32 height, u32 row_length,
+                             size_t buffer_size, u32 layer)
+{
+  ASSERT(!m_pending_load);
+
+  width = std::max(1u, std::min(width, GetWidth() >> level));
+  height = std::max(1u, std::min(height, GetHeight() >> level));
+
+  // The caller writes all of buffer_size, even when only a part of it is copied to the image.
+  const u32 upload_size = GetLoadUploadSize(height, row_length);
+  const size_t reserve_size = std::max<size_t>(buffer_size, upload_size);
+  if (reserve_size > STAGING_TEXTURE_UPLOAD_THRESHOLD)
+    return nullptr;
+
+  StreamBuffer* stream_buffer = ReserveTextureUploadMemory(static_cast<u32>(reserve_size));
+  if (!stream_buffer)
+    return nullptr;
+
+  m_pending_load = PendingLoad{level, width, height, row_length, layer, upload_size};
+  return stream_buffer->GetCurrentHostPointer();
+}
+
+void VKTexture::CommitLoad()
+{
+  ASSERT(m_pending_load);
+  const PendingLoad load = *m_pending_load;
+  m_pending_load.reset();
+
+  StreamBuffer* stream_buffer = g_object_cache->GetTextureUploadBuffer();
+  const VkDeviceSize upload_buffer_offset = stream_buffer->GetCurrentOffset();
+  stream_buffer->CommitMemory(load.upload_size);
+  CopyFromUploadBuffer(stream_buffer->GetBuffer(), upload_buffer_offset, load.level, load.width,
+                       load.height, load.row_length, load.layer);
+}
+
+u32 VKTexture::GetLoadUploadSize(u32 height, u32 row_length) const
+{
+  // For unaligned textures, we can save some memory in the transfer buffer by skipping the rows
+  // that lie outside of the texture's dimensions.
+  const u32 block_size = GetBlockSizeForFormat(GetFormat());
+  const u32 num_rows = Common::AlignUp(height, block_size) / block_size;
+  const u32 source_pitch = CalculateStrideForFormat(m_config.format, row_length);
+  return source_pitch * num_rows;
+}
+
+StreamBuffer* VKTexture::ReserveTextureUploadMemory(u32 size)
+{
+  const u32 upload_alignment = static_cast<u32>(g_vulkan_context->GetBufferImageGranularity());
+  StreamBuffer* stream_buffer = g_object_cache->GetTextureUploadBuffer();
+  if (!stream_buffer->ReserveMemory(size, upload_alignment))
+  {
+    // Execute the command buffer first.
+    WARN_LOG_FMT(VIDEO, "Executing command list while waiting for space in texture upload buffer");
+    VKGfx::GetInstance()->ExecuteCommandBuffer(false);
+
+    // Try allocating again. This may cause a fence wait.
+    if (!stream_buffer->ReserveMemory(size, upload_alignment))
+    {
+      PanicAlertFmt("Failed to allocate space in texture upload buffer");
+      return nullptr;
+    }
+  }
+  return stream_buffer;
+}
+
+void VKTexture::CopyFromUploadBuffer(VkBuffer upload_buffer, VkDeviceSize upload_buffer_offset,
+                                     u32 level, u32 width, u32 height, u32 row_length, u32 layer)
+{
+  // We don't care about the existing contents of the texture, so we could the image layout to
+  // VK_IMAGE_LAYOUT_UNDEFINED here. However, under section 2.2.1, Queue Operation of the Vulkan
+  // specification, it states:
+  //
+  //   Command buffer submissions to a single queue must always adhere to command order and
+  //   API order, but otherwise may overlap or execute out of order.
+  //
+  // Therefore, if a previous frame's command buffer is still sampling from this texture, and we
+  // overwrite it without a pipeline barrier, a texture sample could occur in parallel with the
+  // texture upload/copy. I'm not sure if any drivers currently take advantage of this, but we
+  // should insert an explicit pipeline barrier just in case (done by TransitionToLayout).
+  //
+  // We transition to TRANSFER_DST, ready for the image copy, and leave the texture in this state.
+  // When the last mip level is uploaded, we transition to SHADER_READ_ONLY, ready for use. This is
+  // because we can't transition in a render pass, and we don't necessarily know when this texture
+  // is going to be used.
+  TransitionToLayout(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
   // Copy from the streaming buffer to the actual image.
   VkBufferImageCopy image_copy = {
       upload_buffer_offset,                          // VkDeviceSize             bufferOffset
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -15,6 +16,7 @@
 namespace Vulkan
 {
 class StagingBuffer;
+class StreamBuffer;
 class Texture2D;
 
 class VKTexture final : public AbstractTexture
@@ -48,6 +50,9 @@ public:
                           u32 layer, u32 level) override;
   void Load(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer, size_t buffer_size,
             u32 layer) override;
+  u8* MapLoadBuffer(u32 level, u32 width, u32 height, u32 row_length, size_t buffer_size,
+                    u32 layer) override;
+  void CommitLoad() override;
   void FinishedRendering() override;
 
   VkImage GetImage() const { return m_image; }
@@ -72,15 +77,34 @@ public:
   void PrepareForRenderPass(VkCommandBuffer command_buffer) const;
 
 private:
+  struct PendingLoad
+  {
+    u32 level;
+    u32 width;
+    u32 height;
+    u32 row_length;
+    u32 layer;
+    u32 upload_size;
+  };
+
   bool CreateView(VkImageViewType type);
 
+  u32 GetLoadUploadSize(u32 height, u32 row_length) const;
+  static StreamBuffer* ReserveTextureUploadMemory(u32 size);
+  void CopyFromUploadBuffer(VkBuffer upload_buffer, VkDeviceSize upload_buffer_offset, u32 level,
+                            u32 width, u32 height, u32 row_length, u32 layer);
+
   VmaAllocation m_alloc;
   VkImage m_image;
   VkImageView m_view = VK_NULL_HANDLE;
   mutable VkImageLayout m_layout = VK_IMAGE_LAYOUT_UNDEFINED;
   mutable ComputeImageLayout m_compute_layout = ComputeImageLayout::Undefined;
+
   mutable bool m_written_since_last_layout_change = false;
   std::string m_name;
+
+  // Set between MapLoadBuffer and CommitLoad.
+  std::optional<PendingLoad> m_pending_load;
 };
 
 class VKStagingTexture final : public AbstractStagingTexture
@@ -69,6 +69,12 @@ VertexFormat::VertexFormat(const PortableVertexDeclaration& vtx_decl) : NativeVe
   SetupInputState();
 }
 
+VertexFormat::~VertexFormat()
+{
+  if (g_object_cache)
+    g_object_cache->DestroyPipelineLibraries(reinterpret_cast<u64>(this));
+}
+
 const VkPipelineVertexInputStateCreateInfo& VertexFormat::GetVertexInputStateInfo() const
 {
   return m_input_state_info;
@@ -16,6 +16,7 @@ class VertexFormat : public ::NativeVertexFormat
 {
 public:
   VertexFormat(const PortableVertexDeclaration& vtx_decl);
+  ~VertexFormat() override;
 
   // Passed to pipeline state creation
   const VkPipelineVertexInputStateCreateInfo& GetVertexInputStateInfo() const;
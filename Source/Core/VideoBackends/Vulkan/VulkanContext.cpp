@@ -133,13 +133,14 @@ VulkanContext::~VulkanContext()
 {
   if (m_allocator != VK_NULL_HANDLE)
     vmaDestroyAllocator(m_allocator);
-  if (m_device != VK_NULL_HANDLE)
+  if (m_device != VK_NULL_HANDLE && !m_is_external)
     vkDestroyDevice(m_device, nullptr);
 
   if (m_debug_utils_messenger != VK_NULL_HANDLE)
     DisableDebugUtils();
 
-  vkDestroyInstance(m_instance, nullptr);
+  if (!m_is_external)
+    vkDestroyInstance(m_instance, nullptr);
 }
 
 bool VulkanContext::CheckValidationLayerAvailablility()
@@ -612,6 +613,32 @@ std::unique_ptr<VulkanContext> VulkanContext::Create(VkInstance instance, VkPhys
   return context;
 }
 
+std::unique_ptr<VulkanContext>
+VulkanContext::CreateWithExternalInstance(VkInstance instance, VkPhysicalDevice gpu,
+                                          VkSurfaceKHR surface,
+                                          std::vector<std::string> additional_extensions,
+                                          const VkPhysicalDeviceFeatures* additional_features,
+                                          u32 vk_api_version)
+{
+  std::unique_ptr<VulkanContext> context = std::make_unique<VulkanContext>(instance, gpu);
+  context->m_is_external = true;
+  context->m_additional_device_extensions = std::move(additional_extensions);
+  if (additional_features)
+    context->m_additional_device_features = *additional_features;
+  context->InitDriverDetails();
+
+  if (!context->CreateDevice(surface, false) || !context->CreateAllocator(vk_api_version))
+  {
+    // Nobody took over the device yet.
+    if (context->m_device != VK_NULL_HANDLE)
+      vkDestroyDevice(context->m_device, nullptr);
+    context->m_device = VK_NULL_HANDLE;
+    return nullptr;
+  }
+
+  return context;
+}
+
 bool VulkanContext::SelectDeviceExtensions(bool enable_surface)
 {
   u32 extension_count = 0;
@@ -674,6 +701,41 @@ bool VulkanContext::SelectDeviceExtensions(bool enable_surface)
         AddExtension(VK_EXT_DEPTH_RANGE_UNRESTRICTED_EXTENSION_NAME, false);
   }
 
+  // Only the fast linking of libraries is useful to us, since linking them any slower would cost
+  // more than creating the pipeline in one go.
+  if (vkGetPhysicalDeviceFeatures2 && m_device_info.apiVersion >= VK_API_VERSION_1_1 &&
+      AddExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME, false) &&
+      AddExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME, false))
+  {
+    VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT library_features = {};
+    library_features.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+    VkPhysicalDeviceFeatures2 features2 = {};
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    InsertIntoChain(&features2, &library_features);
+    vkGetPhysicalDeviceFeatures2(m_physical_device, &features2);
+
+    VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT library_properties = {};
+    library_properties.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+    VkPhysicalDeviceProperties2 properties2 = {};
+    properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    InsertIntoChain(&properties2, &library_properties);
+    vkGetPhysicalDeviceProperties2(m_physical_device, &properties2);
+
+    m_supports_graphics_pipeline_library =
+        library_features.graphicsPipelineLibrary &&
+        library_properties.graphicsPipelineLibraryFastLinking;
+    if (m_supports_graphics_pipeline_library)
+      INFO_LOG_FMT(VIDEO, "Using VK_EXT_graphics_pipeline_library to link pipelines.");
+  }
+
+  for (const std::string& name : m_additional_device_extensions)
+  {
+    if (!Common::Contains(m_device_extensions, name) && !AddExtension(name.c_str(), true))
+      return false;
+  }
+
   return true;
 }
 
@@ -806,6 +868,38 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   VkPhysicalDeviceFeatures device_features = m_device_info.features();
   device_info.pEnabledFeatures = &device_features;
 
+  if (m_additional_device_features)
+  {
+    // VkPhysicalDeviceFeatures is nothing but a list of VkBool32s.
+    constexpr size_t feature_count = sizeof(VkPhysicalDeviceFeatures) / sizeof(VkBool32);
+    VkPhysicalDeviceFeatures supported_features;
+    vkGetPhysicalDeviceFeatures(m_physical_device, &supported_features);
+    const auto* const required = reinterpret_cast<const VkBool32*>(&*m_additional_device_features);
+    const auto* const supported = reinterpret_cast<const VkBool32*>(&supported_features);
+    auto* const enabled = reinterpret_cast<VkBool32*>(&device_features);
+    for (size_t i = 0; i < feature_count; ++i)
+    {
+      if (!required[i])
+        continue;
+
+      if (!supported[i])
+      {
+        ERROR_LOG_FMT(VIDEO, "Vulkan: Required device feature {} is not supported.", i);
+        return false;
+      }
+      enabled[i] = VK_TRUE;
+    }
+  }
+
+  VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT library_features = {};
+  if (m_supports_graphics_pipeline_library)
+  {
+    library_features.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+    library_features.graphicsPipelineLibrary = VK_TRUE;
+    device_info.pNext = &library_features;
+  }
+
   // Enable debug layer on debug builds
   if (enable_validation_layer)
   {
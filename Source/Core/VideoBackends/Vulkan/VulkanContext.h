@@ -86,6 +86,15 @@ public:
                                                VkSurfaceKHR surface, bool enable_debug_utils,
                                                bool enable_validation_layer, u32 api_version);
 
+  // Creates a device on an instance that is owned by someone else, e.g. a libretro frontend that
+  // also takes over the device. additional_extensions and additional_features are enabled on top
+  // of the ones Dolphin selects, and creating the device fails if any of them is unsupported. The
+  // instance, the surface and the device are left alone when the context is destroyed.
+  static std::unique_ptr<VulkanContext>
+  CreateWithExternalInstance(VkInstance instance, VkPhysicalDevice gpu, VkSurfaceKHR surface,
+                             std::vector<std::string> additional_extensions,
+                             const VkPhysicalDeviceFeatures* additional_features, u32 api_version);
+
   // Enable/disable debug message runtime.
   bool EnableDebugUtils();
   void DisableDebugUtils();
@@ -108,6 +117,7 @@ public:
   bool SupportsPreciseOcclusionQueries() const { return m_device_info.occlusionQueryPrecise; }
   u32 GetShaderSubgroupSize() const { return m_device_info.subgroupSize; }
   bool SupportsShaderSubgroupOperations() const { return m_device_info.shaderSubgroupOperations; }
+  bool SupportsGraphicsPipelineLibrary() const { return m_supports_graphics_pipeline_library; }
 
   // Helpers for getting constants
   VkDeviceSize GetUniformBufferAlignment() const
@@ -153,10 +163,14 @@ private:
   VkQueueFamilyProperties m_graphics_queue_properties = {};
 
   VkDebugUtilsMessengerEXT m_debug_utils_messenger = VK_NULL_HANDLE;
+  bool m_is_external = false;
+  bool m_supports_graphics_pipeline_library = false;
 
   PhysicalDeviceInfo m_device_info;
 
   std::vector<std::string> m_device_extensions;
+  std::vector<std::string> m_additional_device_extensions;
+  std::optional<VkPhysicalDeviceFeatures> m_additional_device_features;
 };
 
 extern std::unique_ptr<VulkanContext> g_vulkan_context;
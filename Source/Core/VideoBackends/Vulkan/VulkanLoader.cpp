@@ -113,6 +113,27 @@ bool LoadVulkanLibrary(bool force_system_library)
   return true;
 }
 
+bool LoadVulkanLibrary(PFN_vkGetInstanceProcAddr get_instance_proc_addr, VkInstance instance)
+{
+  // Global commands can only be queried without an instance.
+#define VULKAN_MODULE_ENTRY_POINT(name, required)                                                  \
+  name = reinterpret_cast<PFN_##name>(get_instance_proc_addr(VK_NULL_HANDLE, #name));
+#include "VideoBackends/Vulkan/VulkanEntryPoints.inl"
+#undef VULKAN_MODULE_ENTRY_POINT
+
+  vkGetInstanceProcAddr = get_instance_proc_addr;
+  vkGetDeviceProcAddr = reinterpret_cast<PFN_vkGetDeviceProcAddr>(
+      get_instance_proc_addr(instance, "vkGetDeviceProcAddr"));
+  if (!vkGetDeviceProcAddr)
+  {
+    ERROR_LOG_FMT(VIDEO, "Vulkan: Failed to load required module function vkGetDeviceProcAddr");
+    ResetVulkanLibraryFunctionPointers();
+    return false;
+  }
+
+  return LoadVulkanInstanceFunctions(instance);
+}
+
 void UnloadVulkanLibrary()
 {
   s_vulkan_module.Close();
@@ -86,6 +86,9 @@
 namespace Vulkan
 {
 bool LoadVulkanLibrary(bool force_system_library = false);
+// Uses the loader of an existing instance instead of opening the Vulkan library ourselves, e.g.
+// the one of a libretro frontend. Loads the instance functions as well.
+bool LoadVulkanLibrary(PFN_vkGetInstanceProcAddr get_instance_proc_addr, VkInstance instance);
 bool LoadVulkanInstanceFunctions(VkInstance instance);
 bool LoadVulkanDeviceFunctions(VkDevice device);
 void UnloadVulkanLibrary();
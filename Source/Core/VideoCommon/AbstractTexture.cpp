@@ -25,6 +25,16 @@ AbstractTexture::operator ImTextureRef() const
   return ImTextureRef(reinterpret_cast<AbstractTexture::imgui_texture_id>(this));
 }
 
+u8* AbstractTexture::MapLoadBuffer(u32 level, u32 width, u32 height, u32 row_length,
+                                   size_t buffer_size, u32 layer)
+{
+  return nullptr;
+}
+
+void AbstractTexture::CommitLoad()
+{
+}
+
 void AbstractTexture::FinishedRendering()
 {
 }
@@ -32,6 +32,14 @@ public:
   virtual void Load(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer,
                     size_t buffer_size, u32 layer = 0) = 0;
 
+  // Lets the data of a Load be written directly into the backend's upload memory, saving the
+  // copy from a separate buffer. Returns where to write the buffer_size bytes, or nullptr if the
+  // backend can't do so for this upload, in which case Load has to be used. CommitLoad then
+  // uploads them, and has to be called before any other texture is loaded.
+  virtual u8* MapLoadBuffer(u32 level, u32 width, u32 height, u32 row_length, size_t buffer_size,
+                            u32 layer = 0);
+  virtual void CommitLoad();
+
   // Hints to the backend that we have finished rendering to this texture, and it will be used
   // as a shader resource and sampled. For Vulkan, this transitions the image layout.
   virtual void FinishedRendering();
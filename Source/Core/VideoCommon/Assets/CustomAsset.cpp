@@ -35,7 +35,12 @@ std::size_t CustomAsset::Unload()
 {
   std::lock_guard lk(m_info_lock);
   UnloadImpl();
-  return std::exchange(m_bytes_loaded, 0);
+  return m_bytes_loaded.exchange(0);
+}
+
+std::size_t CustomAsset::GetByteSize() const
+{
+  return m_bytes_loaded;
 }
 
 CustomAsset::TimeType CustomAsset::GetLastLoadedTime() const
@@ -35,6 +35,9 @@ public:
   // returns the number of bytes unloaded
   std::size_t Unload();
 
+  // Returns the number of bytes currently loaded, without waiting for a load in progress
+  std::size_t GetByteSize() const;
+
   // Returns the time that the data was last loaded
   TimeType GetLastLoadedTime() const;
 
@@ -56,7 +59,7 @@ private:
   std::size_t m_handle;
 
   mutable std::mutex m_info_lock;
-  std::size_t m_bytes_loaded = 0;
+  std::atomic<std::size_t> m_bytes_loaded = 0;
   std::atomic<TimeType> m_last_loaded_time = {};
 };
 
@@ -3,9 +3,14 @@
 
 #include "VideoCommon/Assets/CustomAssetCache.h"
 
+#include <algorithm>
+
+#include "Common/Config/Config.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
 
+#include "Core/Config/GraphicsSettings.h"
+
 #include "UICommon/UICommon.h"
 
 #include "VideoCommon/Assets/CustomAsset.h"
@@ -14,6 +19,9 @@
 
 namespace VideoCommon
 {
+// About a second at 60 frames per second.
+static constexpr u64 UNUSED_ASSET_UPDATE_COUNT = 60;
+
 void CustomAssetCache::Initialize()
 {
   // Use half of available system memory but leave at least 2GiB unused for system stability.
@@ -24,9 +32,16 @@ void CustomAssetCache::Initialize()
 
   m_max_ram_available = sys_mem - keep_unused_mem;
 
+  if (const int budget = Config::Get(Config::GFX_CUSTOM_RESOURCES_MEMORY_BUDGET); budget > 0)
+    m_max_ram_available = u64(budget) * 1024 * 1024;
+
   if (m_max_ram_available == 0)
     ERROR_LOG_FMT(VIDEO, "Not enough system memory for custom resources.");
 
+  m_max_unused_ram = m_max_ram_available / 4;
+  if (const int budget = Config::Get(Config::GFX_CUSTOM_RESOURCES_UNUSED_MEMORY_BUDGET); budget > 0)
+    m_max_unused_ram = std::min(u64(budget) * 1024 * 1024, m_max_ram_available);
+
   m_asset_loader.Initialize();
 }
 
@@ -43,6 +58,9 @@ void CustomAssetCache::Reset()
 
   m_active_assets = {};
   m_pending_assets = {};
+  m_pending_reloads = {};
+  m_asset_last_used.clear();
+  m_update_count = 0;
   m_asset_handle_to_data.clear();
   m_asset_id_to_handle.clear();
   m_dirty_assets.clear();
@@ -57,16 +75,36 @@ void CustomAssetCache::MarkAssetDirty(const CustomAssetLibrary::AssetID& asset_i
 
 void CustomAssetCache::MarkAssetPending(CustomAsset* asset)
 {
+  // Something is waiting for the asset now, so it can't wait behind the reloads.
+  m_pending_reloads.RemoveAsset(asset->GetHandle());
   m_pending_assets.MakeAssetHighestPriority(asset->GetHandle(), asset);
 }
 
 void CustomAssetCache::MarkAssetActive(CustomAsset* asset)
 {
   m_active_assets.MakeAssetHighestPriority(asset->GetHandle(), asset);
+  MarkAssetUsed(asset->GetHandle());
+}
+
+void CustomAssetCache::MarkAssetUsed(std::size_t asset_handle)
+{
+  if (asset_handle >= m_asset_last_used.size())
+    m_asset_last_used.resize(asset_handle + 1);
+
+  m_asset_last_used[asset_handle] = m_update_count;
+}
+
+bool CustomAssetCache::IsAssetUnused(std::size_t asset_handle) const
+{
+  const u64 last_used =
+      asset_handle < m_asset_last_used.size() ? m_asset_last_used[asset_handle] : 0;
+  return m_update_count - last_used > UNUSED_ASSET_UPDATE_COUNT;
 }
 
 void CustomAssetCache::Update()
 {
+  m_update_count++;
+
   ProcessDirtyAssets();
   ProcessLoadedAssets();
 
@@ -75,14 +113,17 @@ void CustomAssetCache::Update()
     RemoveAssetsUntilBelowMemoryLimit();
   }
 
-  if (m_pending_assets.IsEmpty())
+  RemoveUnusedAssetsUntilBelowMemoryLimit();
+
+  if (m_pending_assets.IsEmpty() && m_pending_reloads.IsEmpty())
     return;
 
   if (m_ram_used > m_max_ram_available)
     return;
 
   const u64 allowed_memory = m_max_ram_available - m_ram_used;
-  m_asset_loader.ScheduleAssetsToLoad(m_pending_assets.Elements(), allowed_memory);
+  m_asset_loader.ScheduleAssetsToLoad(m_pending_assets.Elements(), m_pending_reloads.Elements(),
+                                      allowed_memory);
 }
 
 void CustomAssetCache::ProcessDirtyAssets()
@@ -105,7 +146,8 @@ void CustomAssetCache::ProcessDirtyAssets()
       // Asset was reloaded, clear any errors we might have
       asset_data.has_load_error = false;
 
-      m_pending_assets.InsertAsset(it->second, asset_data.asset.get());
+      if (!m_pending_assets.Contains(asset_handle))
+        m_pending_reloads.InsertAsset(asset_handle, asset_data.asset.get());
 
       DEBUG_LOG_FMT(VIDEO, "Dirty asset pending reload: {}", asset_data.asset->GetAssetId());
     }
@@ -136,6 +178,7 @@ void CustomAssetCache::ProcessLoadedAssets()
       continue;
 
     m_pending_assets.RemoveAsset(handle);
+    m_pending_reloads.RemoveAsset(handle);
 
     asset_data.load_request_time = {};
     if (!load_successful)
@@ -144,7 +187,9 @@ void CustomAssetCache::ProcessLoadedAssets()
     }
     else
     {
-      m_active_assets.InsertAsset(handle, asset_data.asset.get());
+      // The asset was requested recently, so it doesn't count as unused until it goes unused.
+      m_active_assets.MakeAssetHighestPriority(handle, asset_data.asset.get());
+      MarkAssetUsed(handle);
       asset_data.load_status = AssetData::LoadStatus::LoadFinished;
     }
 
@@ -170,26 +215,47 @@ void CustomAssetCache::RemoveAssetsUntilBelowMemoryLimit()
   // Clear out least recently used resources until
   // we get safely in our threshold
   while (m_ram_used > threshold_ram && m_active_assets.Size() > 0)
+    UnloadAsset(m_active_assets.RemoveLowestPriorityAsset());
+}
+
+void CustomAssetCache::RemoveUnusedAssetsUntilBelowMemoryLimit()
+{
+  // The active assets are ordered by last use, so the unused ones are all at the back.
+  const auto& active_assets = m_active_assets.Elements();
+  u64 unused_ram = 0;
+  for (auto it = active_assets.rbegin(); it != active_assets.rend(); ++it)
+  {
+    if (!IsAssetUnused((*it)->GetHandle()))
+      break;
+    unused_ram += (*it)->GetByteSize();
+  }
+
+  while (unused_ram > m_max_unused_ram && m_active_assets.Size() > 0)
   {
     auto* const asset = m_active_assets.RemoveLowestPriorityAsset();
+    unused_ram -= std::min<u64>(asset->GetByteSize(), unused_ram);
+    UnloadAsset(asset);
+  }
+}
 
-    AssetData& asset_data = m_asset_handle_to_data[asset->GetHandle()];
+void CustomAssetCache::UnloadAsset(CustomAsset* asset)
+{
+  AssetData& asset_data = m_asset_handle_to_data[asset->GetHandle()];
 
-    for (const auto& listener : asset_data.listeners)
-    {
-      listener->AssetUnloaded();
-    }
+  for (const auto& listener : asset_data.listeners)
+  {
+    listener->AssetUnloaded();
+  }
 
-    // Remove the asset's copy
-    const std::size_t bytes_unloaded = asset_data.asset->Unload();
-    m_ram_used -= bytes_unloaded;
+  // Remove the asset's copy
+  const std::size_t bytes_unloaded = asset_data.asset->Unload();
+  m_ram_used -= bytes_unloaded;
 
-    asset_data.load_status = AssetData::LoadStatus::Unloaded;
-    asset_data.load_request_time = {};
+  asset_data.load_status = AssetData::LoadStatus::Unloaded;
+  asset_data.load_request_time = {};
 
-    INFO_LOG_FMT(VIDEO, "Unloading asset: {} ({})", asset_data.asset->GetAssetId(),
-                 UICommon::FormatSize(bytes_unloaded));
-  }
+  INFO_LOG_FMT(VIDEO, "Unloading asset: {} ({})", asset_data.asset->GetAssetId(),
+               UICommon::FormatSize(bytes_unloaded));
 }
 
 }  // namespace VideoCommon
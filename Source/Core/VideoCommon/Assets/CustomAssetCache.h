@@ -20,9 +20,12 @@ namespace VideoCommon
 {
 // The asset cache manages custom assets (textures, shaders, meshes).
 // These assets are loaded using a priority system,
-// where assets requested more often gets loaded first.  This system
+// where assets requested more often gets loaded first, and assets something is
+// waiting for get loaded before reloads of assets that are still usable.  This system
 // also tracks memory usage and if memory usage goes over a calculated limit,
 // then assets will be purged with older assets being targeted first.
+// Assets that haven't been used recently are also purged once they hold more
+// than their own, smaller limit.
 class CustomAssetCache
 {
 public:
@@ -99,6 +102,11 @@ private:
   void ProcessDirtyAssets();
   void ProcessLoadedAssets();
   void RemoveAssetsUntilBelowMemoryLimit();
+  void RemoveUnusedAssetsUntilBelowMemoryLimit();
+  void UnloadAsset(CustomAsset* asset);
+
+  void MarkAssetUsed(std::size_t asset_handle);
+  bool IsAssetUnused(std::size_t asset_handle) const;
 
   // Maintains a priority-sorted list of assets.
   // Used to figure out which assets to load or unload first.
@@ -161,6 +169,12 @@ private:
       }
     }
 
+    bool Contains(u64 asset_handle) const
+    {
+      return asset_handle < m_iterator_lookup.size() &&
+             m_iterator_lookup[asset_handle] != m_assets.end();
+    }
+
     bool IsEmpty() const { return m_assets.empty(); }
 
     std::size_t Size() const { return m_assets.size(); }
@@ -176,11 +190,17 @@ private:
   // Assets that are currently active in memory, in order of most recently used by the game.
   AssetPriorityQueue m_active_assets;
 
-  // Assets that need to be loaded.
-  // e.g. Because the game tried to use them or because they changed on disk.
+  // Assets that need to be loaded because the game tried to use them.
   // Ordered by most recently used.
   AssetPriorityQueue m_pending_assets;
 
+  // Assets that changed on disk, whose previous data is still usable until they are reloaded.
+  AssetPriorityQueue m_pending_reloads;
+
+  // The Update during which each asset, indexed by handle, was last used.
+  std::vector<u64> m_asset_last_used;
+  u64 m_update_count = 0;
+
   std::map<std::size_t, AssetData> m_asset_handle_to_data;
   std::map<CustomAssetLibrary::AssetID, std::size_t> m_asset_id_to_handle;
 
@@ -190,6 +210,9 @@ private:
   // A calculated amount of memory to avoid exceeding.
   u64 m_max_ram_available = 0;
 
+  // How much of m_max_ram_available assets that aren't being used may keep.
+  u64 m_max_unused_ram = 0;
+
   std::mutex m_dirty_mutex;
   std::set<CustomAssetLibrary::AssetID> m_dirty_assets;
 
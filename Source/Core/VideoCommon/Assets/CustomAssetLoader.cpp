@@ -3,18 +3,30 @@
 
 #include "VideoCommon/Assets/CustomAssetLoader.h"
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
+#include "Common/CPUDetect.h"
+#include "Common/Config/Config.h"
 #include "Common/Logging/Log.h"
 #include "Common/Thread.h"
 
+#include "Core/Config/GraphicsSettings.h"
+
 #include "UICommon/UICommon.h"
 
 namespace VideoCommon
 {
 void CustomAssetLoader::Initialize()
 {
-  ResizeWorkerThreads(2);
+  const int num_threads = Config::Get(Config::GFX_CUSTOM_ASSET_LOADER_THREADS);
+
+  // Automatic number. Loading is mostly decoding, so use more threads on bigger machines, but
+  // leave the emulation and GPU threads their cores.
+  const int num_auto_threads = std::clamp(cpu_info.num_cores - 3, 2, 4);
+
+  ResizeWorkerThreads(static_cast<u32>(num_threads > 0 ? num_threads : num_auto_threads));
 }
 
 void CustomAssetLoader::Shutdown()
@@ -72,8 +84,7 @@ void CustomAssetLoader::WorkerThreadRun(u32 thread_index)
   std::unique_lock load_lock(m_assets_to_load_lock);
   while (true)
   {
-    m_worker_thread_wake.wait(load_lock,
-                              [&] { return !m_assets_to_load.empty() || m_exit_flag.IsSet(); });
+    m_worker_thread_wake.wait(load_lock, [&] { return HasAssetsToLoad() || m_exit_flag.IsSet(); });
 
     if (m_exit_flag.IsSet())
       return;
@@ -82,12 +93,12 @@ void CustomAssetLoader::WorkerThreadRun(u32 thread_index)
     //  until the next ScheduleAssetsToLoad from Manager.
     if (m_change_in_memory > m_allowed_memory)
     {
-      m_assets_to_load.clear();
+      m_urgent_assets_to_load.clear();
+      m_background_assets_to_load.clear();
       continue;
     }
 
-    auto* const item = m_assets_to_load.front();
-    m_assets_to_load.pop_front();
+    auto* const item = TakeNextAssetToLoad();
 
     // Make sure another thread isn't loading this handle.
     if (!m_handles_in_progress.insert(item->GetHandle()).second)
@@ -112,29 +123,47 @@ void CustomAssetLoader::WorkerThreadRun(u32 thread_index)
 
       // Make sure no other threads try to re-process this item.
       // Manager will take the handles and re-ScheduleAssetsToLoad based on timestamps if needed.
-      std::erase(m_assets_to_load, item);
+      std::erase(m_urgent_assets_to_load, item);
+      std::erase(m_background_assets_to_load, item);
     }
 
     m_handles_in_progress.erase(item->GetHandle());
   }
 }
 
+bool CustomAssetLoader::HasAssetsToLoad() const
+{
+  return !m_urgent_assets_to_load.empty() || !m_background_assets_to_load.empty();
+}
+
+CustomAsset* CustomAssetLoader::TakeNextAssetToLoad()
+{
+  auto& assets_to_load =
+      m_urgent_assets_to_load.empty() ? m_background_assets_to_load : m_urgent_assets_to_load;
+
+  auto* const item = assets_to_load.front();
+  assets_to_load.pop_front();
+  return item;
+}
+
 auto CustomAssetLoader::TakeLoadResults() -> LoadResults
 {
   std::lock_guard guard(m_assets_loaded_lock);
   return {std::move(m_asset_handles_loaded), m_change_in_memory.exchange(0)};
 }
 
-void CustomAssetLoader::ScheduleAssetsToLoad(std::list<CustomAsset*> assets_to_load,
+void CustomAssetLoader::ScheduleAssetsToLoad(std::list<CustomAsset*> urgent_assets,
+                                             std::list<CustomAsset*> background_assets,
                                              u64 allowed_memory)
 {
-  if (assets_to_load.empty()) [[unlikely]]
+  if (urgent_assets.empty() && background_assets.empty()) [[unlikely]]
     return;
 
   // There's new assets to process, notify worker threads
   std::lock_guard guard(m_assets_to_load_lock);
   m_allowed_memory = allowed_memory;
-  m_assets_to_load = std::move(assets_to_load);
+  m_urgent_assets_to_load = std::move(urgent_assets);
+  m_background_assets_to_load = std::move(background_assets);
   m_worker_thread_wake.notify_all();
 }
 
@@ -143,7 +172,8 @@ void CustomAssetLoader::Reset(bool restart_worker_threads)
   const std::size_t worker_thread_count = m_worker_threads.size();
   StopWorkerThreads();
 
-  m_assets_to_load.clear();
+  m_urgent_assets_to_load.clear();
+  m_background_assets_to_load.clear();
   m_asset_handles_loaded.clear();
   m_allowed_memory = 0;
   m_change_in_memory = 0;
@@ -46,7 +46,9 @@ public:
 
   // Schedule assets to load on the worker threads
   //  and set how much memory is available for loading these additional assets.
-  void ScheduleAssetsToLoad(std::list<CustomAsset*> assets_to_load, u64 allowed_memory);
+  // The worker threads only pick up background assets once every urgent asset has been taken.
+  void ScheduleAssetsToLoad(std::list<CustomAsset*> urgent_assets,
+                            std::list<CustomAsset*> background_assets, u64 allowed_memory);
 
   void Reset(bool restart_worker_threads = true);
 
@@ -58,12 +60,16 @@ private:
 
   void WorkerThreadRun(u32 thread_index);
 
+  bool HasAssetsToLoad() const;
+  CustomAsset* TakeNextAssetToLoad();
+
   Common::Flag m_exit_flag;
 
   std::vector<std::thread> m_worker_threads;
 
   std::mutex m_assets_to_load_lock;
-  std::list<CustomAsset*> m_assets_to_load;
+  std::list<CustomAsset*> m_urgent_assets_to_load;
+  std::list<CustomAsset*> m_background_assets_to_load;
 
   std::condition_variable m_worker_thread_wake;
 
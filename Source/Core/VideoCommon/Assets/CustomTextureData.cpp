@@ -10,9 +10,11 @@
 #include <functional>
 
 #include "Common/Align.h"
+#include "Common/Assert.h"
 #include "Common/IOFile.h"
 #include "Common/Image.h"
 #include "Common/Logging/Log.h"
+#include "Common/MappedFile.h"
 #include "VideoCommon/VideoConfig.h"
 
 namespace
@@ -256,7 +258,42 @@ static void ConvertTexture_R8G8B8(VideoCommon::CustomTextureData::ArraySlice::Le
   level->data = std::move(new_data);
 }
 
-static bool ParseDDSHeader(File::IOFile& file, DDSLoadInfo* info)
+// Reads a DDS file that's already in memory, with the subset of the File::IOFile interface the
+// loaders below use.
+class MemoryReader
+{
+public:
+  explicit MemoryReader(std::span<const u8> buffer) : m_buffer(buffer) {}
+
+  bool ReadBytes(void* data, size_t length)
+  {
+    if (length > m_buffer.size() - m_position)
+      return false;
+
+    std::memcpy(data, m_buffer.data() + m_position, length);
+    m_position += length;
+    return true;
+  }
+
+  bool Seek(s64 offset, File::SeekOrigin origin)
+  {
+    ASSERT(origin == File::SeekOrigin::Begin);
+    if (offset < 0 || static_cast<u64>(offset) > m_buffer.size())
+      return false;
+
+    m_position = static_cast<size_t>(offset);
+    return true;
+  }
+
+  u64 GetSize() const { return m_buffer.size(); }
+
+private:
+  std::span<const u8> m_buffer;
+  size_t m_position = 0;
+};
+
+template <typename Reader>
+static bool ParseDDSHeader(Reader& file, DDSLoadInfo* info)
 {
   // Exit as early as possible for non-DDS textures, since all extensions are currently
   // passed through this function.
@@ -456,10 +493,10 @@ static bool ParseDDSHeader(File::IOFile& file, DDSLoadInfo* info)
   return true;
 }
 
-static bool ReadMipLevel(VideoCommon::CustomTextureData::ArraySlice::Level* level,
-                         File::IOFile& file, const std::string& filename, u32 mip_level,
-                         const DDSLoadInfo& info, u32 width, u32 height, u32 row_length,
-                         size_t size)
+template <typename Reader>
+static bool ReadMipLevel(VideoCommon::CustomTextureData::ArraySlice::Level* level, Reader& file,
+                         const std::string& filename, u32 mip_level, const DDSLoadInfo& info,
+                         u32 width, u32 height, u32 row_length, size_t size)
 {
   // D3D11 cannot handle block compressed textures where the first mip level is
   // not a multiple of the block size.
@@ -489,17 +526,10 @@ static bool ReadMipLevel(VideoCommon::CustomTextureData::ArraySlice::Level* leve
   return true;
 }
 
-}  // namespace
-
-namespace VideoCommon
-{
-bool LoadDDSTexture(CustomTextureData* texture, const std::string& filename)
+template <typename Reader>
+static bool ReadDDSTexture(VideoCommon::CustomTextureData* texture, Reader& file,
+                           const std::string& filename)
 {
-  File::IOFile file;
-  file.Open(filename, "rb");
-  if (!file.IsOpen())
-    return false;
-
   DDSLoadInfo info;
   if (!ParseDDSHeader(file, &info))
     return false;
@@ -511,7 +541,7 @@ bool LoadDDSTexture(CustomTextureData* texture, const std::string& filename)
   {
     auto& slice = texture->m_slices.emplace_back();
     // Read first mip level, as it may have a custom pitch.
-    CustomTextureData::ArraySlice::Level first_level;
+    VideoCommon::CustomTextureData::ArraySlice::Level first_level;
     if (!ReadMipLevel(&first_level, file, filename, 0, info, info.width, info.height,
                       info.first_mip_row_length, info.first_mip_size))
     {
@@ -534,7 +564,7 @@ bool LoadDDSTexture(CustomTextureData* texture, const std::string& filename)
       u32 blocks_high = GetBlockCount(mip_height, info.block_size);
       u32 mip_row_length = blocks_wide * info.block_size;
       size_t mip_size = blocks_wide * static_cast<size_t>(info.bytes_per_block) * blocks_high;
-      CustomTextureData::ArraySlice::Level level;
+      VideoCommon::CustomTextureData::ArraySlice::Level level;
       if (!ReadMipLevel(&level, file, filename, i, info, mip_width, mip_height, mip_row_length,
                         mip_size))
         break;
@@ -546,15 +576,11 @@ bool LoadDDSTexture(CustomTextureData* texture, const std::string& filename)
   return true;
 }
 
-bool LoadDDSTexture(CustomTextureData::ArraySlice::Level* level, const std::string& filename,
-                    u32 mip_level)
+template <typename Reader>
+static bool ReadDDSTexture(VideoCommon::CustomTextureData::ArraySlice::Level* level, Reader& file,
+                           const std::string& filename, u32 mip_level)
 {
   // Only loading a single mip level.
-  File::IOFile file;
-  file.Open(filename, "rb");
-  if (!file.IsOpen())
-    return false;
-
   DDSLoadInfo info;
   if (!ParseDDSHeader(file, &info))
     return false;
@@ -563,17 +589,53 @@ bool LoadDDSTexture(CustomTextureData::ArraySlice::Level* level, const std::stri
                       info.first_mip_row_length, info.first_mip_size);
 }
 
+}  // namespace
+
+namespace VideoCommon
+{
+bool LoadDDSTexture(CustomTextureData* texture, const std::string& filename)
+{
+  Common::MappedFile file;
+  if (!file.Open(filename))
+    return false;
+
+  return LoadDDSTexture(texture, file.GetData(), filename);
+}
+
+bool LoadDDSTexture(CustomTextureData* texture, std::span<const u8> buffer,
+                    const std::string& name)
+{
+  MemoryReader reader(buffer);
+  return ReadDDSTexture(texture, reader, name);
+}
+
+bool LoadDDSTexture(CustomTextureData::ArraySlice::Level* level, const std::string& filename,
+                    u32 mip_level)
+{
+  Common::MappedFile file;
+  if (!file.Open(filename))
+    return false;
+
+  return LoadDDSTexture(level, file.GetData(), filename, mip_level);
+}
+
+bool LoadDDSTexture(CustomTextureData::ArraySlice::Level* level, std::span<const u8> buffer,
+                    const std::string& name, u32 mip_level)
+{
+  MemoryReader reader(buffer);
+  return ReadDDSTexture(level, reader, name, mip_level);
+}
+
 bool LoadPNGTexture(CustomTextureData::ArraySlice::Level* level, const std::string& filename)
 {
   if (!level) [[unlikely]]
     return false;
 
-  File::IOFile file;
-  file.Open(filename, "rb");
-  Common::UniqueBuffer<u8> buffer(file.GetSize());
-  file.ReadBytes(buffer.data(), file.GetSize());
+  Common::MappedFile file;
+  if (!file.Open(filename))
+    return false;
 
-  return LoadPNGTexture(level, buffer);
+  return LoadPNGTexture(level, file.GetData());
 }
 
 bool LoadPNGTexture(CustomTextureData::ArraySlice::Level* level, std::span<const u8> buffer)
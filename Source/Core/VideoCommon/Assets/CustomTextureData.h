@@ -31,8 +31,13 @@ public:
 };
 
 bool LoadDDSTexture(CustomTextureData* texture, const std::string& filename);
+// name is only used in error messages.
+bool LoadDDSTexture(CustomTextureData* texture, std::span<const u8> buffer,
+                    const std::string& name);
 bool LoadDDSTexture(CustomTextureData::ArraySlice::Level* level, const std::string& filename,
                     u32 mip_level);
+bool LoadDDSTexture(CustomTextureData::ArraySlice::Level* level, std::span<const u8> buffer,
+                    const std::string& name, u32 mip_level);
 bool LoadPNGTexture(CustomTextureData::ArraySlice::Level* level, const std::string& filename);
 bool LoadPNGTexture(CustomTextureData::ArraySlice::Level* level, std::span<const u8> buffer);
 }  // namespace VideoCommon
@@ -4,15 +4,14 @@
 #include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
 
 #include <algorithm>
-#include <vector>
 
 #include <fmt/std.h>
 
 #include "Common/CommonPaths.h"
 #include "Common/FileUtil.h"
-#include "Common/IOFile.h"
 #include "Common/JsonUtil.h"
 #include "Common/Logging/Log.h"
+#include "Common/MappedFile.h"
 #include "Common/StringUtil.h"
 #include "Core/System.h"
 #include "VideoCommon/Assets/MaterialAsset.h"
@@ -25,22 +24,6 @@
 
 namespace VideoCommon
 {
-namespace
-{
-std::size_t GetAssetSize(const CustomTextureData& data)
-{
-  std::size_t total = 0;
-  for (const auto& slice : data.m_slices)
-  {
-    for (const auto& level : slice.m_levels)
-    {
-      total += level.data.size();
-    }
-  }
-  return total;
-}
-}  // namespace
-
 CustomAssetLibrary::LoadInfo
 DirectFilesystemAssetLibrary::LoadRasterSurfaceShader(const AssetID& asset_id,
                                                       RasterSurfaceShaderData* data)
@@ -269,18 +252,15 @@ CustomAssetLibrary::LoadInfo DirectFilesystemAssetLibrary::LoadMesh(const AssetI
   }
   const auto approx_mem_size = metadata_size + mesh_size;
 
-  File::IOFile file(PathToString(mesh->second), "rb");
-  if (!file.IsOpen())
+  Common::MappedFile file;
+  if (!file.Open(PathToString(mesh->second)))
   {
     ERROR_LOG_FMT(VIDEO, "Asset '{}' error - failed to open mesh file '{}'!", asset_id,
                   PathToString(mesh->second));
     return {};
   }
 
-  std::vector<u8> bytes;
-  bytes.reserve(file.GetSize());
-  file.ReadBytes(bytes.data(), file.GetSize());
-  if (!MeshData::FromDolphinMesh(bytes, data))
+  if (!MeshData::FromDolphinMesh(file.GetData(), data))
   {
     ERROR_LOG_FMT(VIDEO, "Asset '{}' error -  failed to load the mesh file '{}'!", asset_id,
                   PathToString(mesh->second));
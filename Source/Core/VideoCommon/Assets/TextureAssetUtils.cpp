@@ -184,6 +184,19 @@ bool ValidateTextureData(const CustomAssetLibrary::AssetID& asset_id, const Cust
   return true;
 }
 
+std::size_t GetAssetSize(const CustomTextureData& data)
+{
+  std::size_t total = 0;
+  for (const auto& slice : data.m_slices)
+  {
+    for (const auto& level : slice.m_levels)
+    {
+      total += level.data.size();
+    }
+  }
+  return total;
+}
+
 bool PurgeInvalidMipsFromTextureData(const CustomAssetLibrary::AssetID& asset_id,
                                      CustomTextureData* data)
 {
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <filesystem>
 
 #include "VideoCommon/Assets/CustomAssetLibrary.h"
@@ -20,4 +21,7 @@ bool ValidateTextureData(const CustomAssetLibrary::AssetID& asset_id, const Cust
 
 bool PurgeInvalidMipsFromTextureData(const CustomAssetLibrary::AssetID& asset_id,
                                      CustomTextureData* data);
+
+// The memory taken by the levels of every slice
+std::size_t GetAssetSize(const CustomTextureData& data);
 }  // namespace VideoCommon
@@ -0,0 +1,379 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TexturePack.h"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+#include <fmt/format.h>
+#include <mz.h>
+#include <mz_zip.h>
+#include <mz_zip_rw.h>
+#include <xxhash.h>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/ScopeGuard.h"
+#include "Common/StringUtil.h"
+
+namespace VideoCommon
+{
+namespace
+{
+u64 GetNameHash(std::string_view name)
+{
+  return XXH3_64bits(name.data(), name.size());
+}
+
+std::optional<TexturePack::PayloadType> GetPayloadType(std::string extension)
+{
+  Common::ToLower(&extension);
+  if (extension == ".png")
+    return TexturePack::PayloadType::PNG;
+  if (extension == ".dds")
+    return TexturePack::PayloadType::DDS;
+  return std::nullopt;
+}
+
+#pragma pack(push, 1)
+struct ZipLocalFileHeader
+{
+  u32 signature;
+  u16 version_needed;
+  u16 flags;
+  u16 compression_method;
+  u16 modified_time;
+  u16 modified_date;
+  u32 crc32;
+  u32 compressed_size;
+  u32 uncompressed_size;
+  u16 name_size;
+  u16 extra_field_size;
+};
+#pragma pack(pop)
+static_assert(sizeof(ZipLocalFileHeader) == 30);
+
+constexpr u32 ZIP_LOCAL_FILE_HEADER_SIGNATURE = 0x04034b50;
+}  // namespace
+
+std::unique_ptr<TexturePack> TexturePack::Open(const std::string& path)
+{
+  auto pack = std::make_unique<TexturePack>();
+  if (!pack->m_file.Open(path, "rb"))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to open texture pack '{}'", path);
+    return nullptr;
+  }
+
+  const u64 file_size = pack->m_file.GetSize();
+
+  Header header;
+  if (!pack->m_file.ReadArray(&header, 1) || header.magic != MAGIC)
+  {
+    ERROR_LOG_FMT(VIDEO, "'{}' is not a texture pack", path);
+    return nullptr;
+  }
+  if (header.version != VERSION)
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' has unsupported version {}", path, header.version);
+    return nullptr;
+  }
+
+  const u64 payloads_offset =
+      sizeof(Header) + u64{header.entry_count} * sizeof(Entry) + header.names_size;
+  if (payloads_offset > file_size)
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' is truncated", path);
+    return nullptr;
+  }
+
+  pack->m_entries.resize(header.entry_count);
+  pack->m_names.resize(header.names_size);
+  if (!pack->m_file.ReadArray(pack->m_entries.data(), pack->m_entries.size()) ||
+      !pack->m_file.ReadBytes(pack->m_names.data(), pack->m_names.size()))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to read texture pack '{}'", path);
+    return nullptr;
+  }
+
+  for (const Entry& entry : pack->m_entries)
+  {
+    if (u64{entry.name_offset} + entry.name_size > header.names_size ||
+        entry.payload_offset < payloads_offset || entry.payload_size > file_size ||
+        entry.payload_offset > file_size - entry.payload_size)
+    {
+      ERROR_LOG_FMT(VIDEO, "Texture pack '{}' is corrupted", path);
+      return nullptr;
+    }
+  }
+
+  // Find relies on the order.
+  if (!std::ranges::is_sorted(pack->m_entries, {}, [&pack](const Entry& entry) {
+        return std::pair(entry.name_hash, pack->GetName(entry));
+      }))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' is not sorted", path);
+    return nullptr;
+  }
+
+  return pack;
+}
+
+std::unique_ptr<TexturePack> TexturePack::OpenZip(const std::string& path,
+                                                  const std::vector<std::string>& directories)
+{
+  auto pack = std::make_unique<TexturePack>();
+  if (!pack->m_file.Open(path, "rb"))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to open '{}'", path);
+    return nullptr;
+  }
+
+  const u64 file_size = pack->m_file.GetSize();
+
+  void* zip_reader = mz_zip_reader_create();
+  if (!zip_reader)
+    return nullptr;
+  Common::ScopeGuard zip_guard{[&] { mz_zip_reader_delete(&zip_reader); }};
+
+  if (mz_zip_reader_open_file(zip_reader, path.c_str()) != MZ_OK)
+  {
+    ERROR_LOG_FMT(VIDEO, "'{}' is not a zip file", path);
+    return nullptr;
+  }
+
+  struct Texture
+  {
+    std::string name;
+    u64 name_hash;
+    u64 order;
+    Entry entry;
+  };
+
+  // The index is built from the central directory, which minizip reads once when opening the
+  // archive. Only the local header of each texture is read besides that, to find its data.
+  std::vector<Texture> textures;
+  u64 skipped_count = 0;
+  for (int result = mz_zip_reader_goto_first_entry(zip_reader); result == MZ_OK;
+       result = mz_zip_reader_goto_next_entry(zip_reader))
+  {
+    mz_zip_file* info;
+    if (mz_zip_reader_entry_get_info(zip_reader, &info) != MZ_OK ||
+        mz_zip_reader_entry_is_dir(zip_reader) == MZ_OK)
+    {
+      continue;
+    }
+
+    const std::string_view zip_path = info->filename;
+    if (std::ranges::none_of(directories, [zip_path](const std::string& directory) {
+          return zip_path.starts_with(directory);
+        }))
+    {
+      continue;
+    }
+
+    const size_t name_start = zip_path.rfind('/') + 1;
+    const size_t extension_start = zip_path.rfind('.');
+    if (extension_start == std::string_view::npos || extension_start < name_start)
+      continue;
+    const std::optional<PayloadType> type =
+        GetPayloadType(std::string(zip_path.substr(extension_start)));
+    if (!type)
+      continue;
+
+    if (info->compression_method != MZ_COMPRESS_METHOD_STORE ||
+        (info->flag & MZ_ZIP_FLAG_ENCRYPTED) != 0 || info->disk_number != 0)
+    {
+      ++skipped_count;
+      continue;
+    }
+
+    ZipLocalFileHeader header;
+    if (!pack->m_file.Seek(info->disk_offset, File::SeekOrigin::Begin) ||
+        !pack->m_file.ReadArray(&header, 1) ||
+        header.signature != ZIP_LOCAL_FILE_HEADER_SIGNATURE)
+    {
+      ERROR_LOG_FMT(VIDEO, "'{}' in '{}' is corrupted", zip_path, path);
+      continue;
+    }
+
+    Texture& texture = textures.emplace_back();
+    texture.name = zip_path.substr(name_start, extension_start - name_start);
+    texture.name_hash = GetNameHash(texture.name);
+    texture.order = textures.size();
+    texture.entry.payload_offset = info->disk_offset + sizeof(ZipLocalFileHeader) +
+                                   header.name_size + header.extra_field_size;
+    texture.entry.payload_size = info->uncompressed_size;
+    texture.entry.type = *type;
+    texture.entry.padding = 0;
+
+    if (texture.name.size() > std::numeric_limits<u16>::max() ||
+        texture.entry.payload_size > file_size ||
+        texture.entry.payload_offset > file_size - texture.entry.payload_size)
+    {
+      ERROR_LOG_FMT(VIDEO, "'{}' in '{}' is corrupted", zip_path, path);
+      textures.pop_back();
+    }
+  }
+
+  if (skipped_count != 0)
+  {
+    WARN_LOG_FMT(VIDEO, "Skipped {} compressed textures of '{}', which can't be read in place",
+                 skipped_count, path);
+  }
+
+  std::ranges::sort(textures, {}, [](const Texture& texture) {
+    return std::tie(texture.name_hash, texture.name, texture.order);
+  });
+  const auto [first, last] = std::ranges::unique(
+      textures, [](const Texture& a, const Texture& b) { return a.name == b.name; });
+  textures.erase(first, last);
+
+  pack->m_entries.reserve(textures.size());
+  for (Texture& texture : textures)
+  {
+    texture.entry.name_hash = texture.name_hash;
+    texture.entry.name_offset = static_cast<u32>(pack->m_names.size());
+    texture.entry.name_size = static_cast<u16>(texture.name.size());
+    pack->m_entries.push_back(texture.entry);
+    pack->m_names += texture.name;
+  }
+
+  return pack;
+}
+
+bool TexturePack::Write(const std::string& path, const std::vector<std::string>& texture_paths,
+                        std::string* error_message)
+{
+  struct Texture
+  {
+    std::string path;
+    std::string name;
+    u64 name_hash;
+    u64 size;
+    PayloadType type;
+  };
+
+  std::vector<Texture> textures;
+  textures.reserve(texture_paths.size());
+  for (const std::string& texture_path : texture_paths)
+  {
+    Texture& texture = textures.emplace_back();
+    texture.path = texture_path;
+
+    std::string extension;
+    SplitPath(texture_path, nullptr, &texture.name, &extension);
+    const std::optional<PayloadType> type = GetPayloadType(std::move(extension));
+    if (!type)
+    {
+      *error_message = fmt::format("'{}' is neither a .png nor a .dds file", texture_path);
+      return false;
+    }
+    texture.type = *type;
+
+    if (texture.name.size() > std::numeric_limits<u16>::max())
+    {
+      *error_message = fmt::format("The name of '{}' is too long", texture_path);
+      return false;
+    }
+
+    texture.name_hash = GetNameHash(texture.name);
+    texture.size = File::GetSize(texture_path);
+  }
+
+  std::ranges::sort(textures, {}, [](const Texture& texture) {
+    return std::tie(texture.name_hash, texture.name);
+  });
+
+  const auto duplicate = std::ranges::adjacent_find(
+      textures, [](const Texture& a, const Texture& b) { return a.name == b.name; });
+  if (duplicate != textures.end())
+  {
+    *error_message = fmt::format("'{}' and '{}' have the same name", duplicate->path,
+                                 std::next(duplicate)->path);
+    return false;
+  }
+
+  std::string names;
+  std::vector<Entry> entries;
+  entries.reserve(textures.size());
+  for (const Texture& texture : textures)
+  {
+    Entry& entry = entries.emplace_back();
+    entry.name_hash = texture.name_hash;
+    entry.payload_size = texture.size;
+    entry.name_offset = static_cast<u32>(names.size());
+    entry.name_size = static_cast<u16>(texture.name.size());
+    entry.type = texture.type;
+    entry.padding = 0;
+    names += texture.name;
+  }
+
+  u64 payload_offset = sizeof(Header) + entries.size() * sizeof(Entry) + names.size();
+  for (Entry& entry : entries)
+  {
+    entry.payload_offset = payload_offset;
+    payload_offset += entry.payload_size;
+  }
+
+  const Header header{MAGIC, VERSION, static_cast<u32>(entries.size()),
+                      static_cast<u32>(names.size())};
+
+  File::IOFile file(path, "wb");
+  if (!file.WriteArray(&header, 1) || !file.WriteArray(entries.data(), entries.size()) ||
+      !file.WriteBytes(names.data(), names.size()))
+  {
+    *error_message = fmt::format("Failed to write '{}'", path);
+    return false;
+  }
+
+  Common::UniqueBuffer<u8> payload;
+  for (const Texture& texture : textures)
+  {
+    payload.reset(texture.size);
+    File::IOFile texture_file(texture.path, "rb");
+    if (!texture_file.ReadBytes(payload.data(), payload.size()))
+    {
+      *error_message = fmt::format("Failed to read '{}'", texture.path);
+      return false;
+    }
+    if (!file.WriteBytes(payload.data(), payload.size()))
+    {
+      *error_message = fmt::format("Failed to write '{}'", path);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::string_view TexturePack::GetName(const Entry& entry) const
+{
+  return std::string_view(m_names).substr(entry.name_offset, entry.name_size);
+}
+
+const TexturePack::Entry* TexturePack::Find(std::string_view name) const
+{
+  const u64 name_hash = GetNameHash(name);
+  const auto it = std::ranges::lower_bound(
+      m_entries, std::pair(name_hash, name), {},
+      [this](const Entry& entry) { return std::pair(entry.name_hash, GetName(entry)); });
+  if (it == m_entries.end() || it->name_hash != name_hash || GetName(*it) != name)
+    return nullptr;
+
+  return &*it;
+}
+
+bool TexturePack::ReadPayload(const Entry& entry, Common::UniqueBuffer<u8>* payload)
+{
+  payload->reset(entry.payload_size);
+
+  std::lock_guard lk(m_file_lock);
+  return m_file.Seek(entry.payload_offset, File::SeekOrigin::Begin) &&
+         m_file.ReadBytes(payload->data(), payload->size());
+}
+}  // namespace VideoCommon
@@ -0,0 +1,89 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+
+namespace VideoCommon
+{
+// A set of custom textures packed into a single .dtp file by "dolphin-tool packtextures", so that
+// they are found without scanning a directory tree, and looked up by a binary search.
+//
+// The file starts with a Header, followed by entry_count Entries sorted by the hash of their name
+// and then by the name itself, and then by the names. The rest of the file is the payloads, which
+// are the contents of the .png and .dds files that were packed, unchanged.
+class TexturePack
+{
+public:
+  static constexpr u32 MAGIC = 0x4B505444;  // "DTPK"
+  static constexpr u32 VERSION = 1;
+  static constexpr std::string_view FILE_EXTENSION = ".dtp";
+
+  enum class PayloadType : u8
+  {
+    PNG = 0,
+    DDS = 1,
+  };
+
+#pragma pack(push, 1)
+  struct Header
+  {
+    u32 magic;
+    u32 version;
+    u32 entry_count;
+    u32 names_size;
+  };
+
+  struct Entry
+  {
+    // XXH3 64 of the name.
+    u64 name_hash;
+    u64 payload_offset;
+    u64 payload_size;
+    u32 name_offset;
+    u16 name_size;
+    PayloadType type;
+    u8 padding;
+  };
+#pragma pack(pop)
+
+  static std::unique_ptr<TexturePack> Open(const std::string& path);
+
+  // Indexes the .png and .dds files of a .zip file (like a resource pack) that are in one of the
+  // given directories of the archive or below them, so that they are read from the archive like
+  // the payloads of a .dtp file. Only stored files can be read in place, compressed ones are
+  // skipped. A texture that is in the archive more than once is read from its first copy.
+  static std::unique_ptr<TexturePack> OpenZip(const std::string& path,
+                                              const std::vector<std::string>& directories);
+
+  // Packs the given .png and .dds files, each named after its file name without the extension.
+  // On failure, error_message is set to the reason.
+  static bool Write(const std::string& path, const std::vector<std::string>& texture_paths,
+                    std::string* error_message);
+
+  const std::vector<Entry>& GetEntries() const { return m_entries; }
+  std::string_view GetName(const Entry& entry) const;
+
+  // Returns nullptr if the pack doesn't have a texture with this name.
+  const Entry* Find(std::string_view name) const;
+
+  // Safe from any thread.
+  bool ReadPayload(const Entry& entry, Common::UniqueBuffer<u8>* payload);
+
+private:
+  std::vector<Entry> m_entries;
+  std::string m_names;
+
+  std::mutex m_file_lock;
+  File::IOFile m_file;
+};
+}  // namespace VideoCommon
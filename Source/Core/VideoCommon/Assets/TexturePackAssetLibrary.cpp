@@ -0,0 +1,147 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
+
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/Buffer.h"
+#include "Common/Logging/Log.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/Assets/TextureAssetUtils.h"
+#include "VideoCommon/RenderState.h"
+
+namespace VideoCommon
+{
+namespace
+{
+bool LoadLevel(TexturePack* pack, const TexturePack::Entry& entry, u32 mip_level,
+               CustomTextureData::ArraySlice::Level* level)
+{
+  Common::UniqueBuffer<u8> payload;
+  if (!pack->ReadPayload(entry, &payload))
+    return false;
+
+  if (entry.type == TexturePack::PayloadType::DDS)
+    return LoadDDSTexture(level, payload, std::string(pack->GetName(entry)), mip_level);
+
+  return LoadPNGTexture(level, payload);
+}
+
+bool LoadTextureData(const CustomAssetLibrary::AssetID& asset_id, TexturePack* pack,
+                     const TexturePack::Entry& entry, CustomTextureData* data)
+{
+  const std::string name(pack->GetName(entry));
+  if (entry.type == TexturePack::PayloadType::DDS)
+  {
+    Common::UniqueBuffer<u8> payload;
+    if (!pack->ReadPayload(entry, &payload) || !LoadDDSTexture(data, payload, name))
+    {
+      ERROR_LOG_FMT(VIDEO, "Asset '{}' error - could not load dds texture!", asset_id);
+      return false;
+    }
+
+    if (data->m_slices.empty()) [[unlikely]]
+      data->m_slices.emplace_back();
+  }
+  else
+  {
+    auto& slice = data->m_slices.emplace_back();
+    if (!LoadLevel(pack, entry, 0, &slice.m_levels.emplace_back()))
+    {
+      ERROR_LOG_FMT(VIDEO, "Asset '{}' error - could not load png texture!", asset_id);
+      return false;
+    }
+  }
+
+  // Load additional mip levels until the pack doesn't have the next one
+  auto& slice = data->m_slices[0];
+  for (u32 mip_level = static_cast<u32>(slice.m_levels.size());; mip_level++)
+  {
+    const std::string mip_name = name + fmt::format("_mip{}", mip_level);
+    const TexturePack::Entry* mip_entry = pack->Find(mip_name);
+    if (!mip_entry)
+      return true;
+
+    CustomTextureData::ArraySlice::Level level;
+    if (mip_entry->type != entry.type || !LoadLevel(pack, *mip_entry, mip_level, &level))
+    {
+      ERROR_LOG_FMT(VIDEO, "Custom mipmap '{}' failed to load", mip_name);
+      return false;
+    }
+
+    slice.m_levels.push_back(std::move(level));
+  }
+}
+}  // namespace
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                                  TextureAndSamplerData* data)
+{
+  data->sampler = RenderState::GetLinearSamplerState();
+  data->type = AbstractTextureType::Texture_2D;
+  return LoadTexture(asset_id, &data->texture_data);
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                                  CustomTextureData* data)
+{
+  PackedTexture texture;
+  {
+    std::lock_guard lk(m_textures_lock);
+    const auto it = m_textures.find(asset_id);
+    if (it == m_textures.end())
+    {
+      ERROR_LOG_FMT(VIDEO, "Asset '{}' error - not found in any texture pack!", asset_id);
+      return {};
+    }
+    texture = it->second;
+  }
+
+  if (!LoadTextureData(asset_id, texture.pack.get(), *texture.entry, data))
+    return {};
+  if (!PurgeInvalidMipsFromTextureData(asset_id, data))
+    return {};
+
+  return LoadInfo{GetAssetSize(*data)};
+}
+
+CustomAssetLibrary::LoadInfo
+TexturePackAssetLibrary::LoadRasterSurfaceShader(const AssetID& asset_id,
+                                                 RasterSurfaceShaderData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs only contain textures!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadMaterial(const AssetID& asset_id,
+                                                                   MaterialData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs only contain textures!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadMesh(const AssetID& asset_id, MeshData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs only contain textures!", asset_id);
+  return {};
+}
+
+void TexturePackAssetLibrary::AddTexture(const AssetID& asset_id,
+                                         std::shared_ptr<TexturePack> pack,
+                                         const TexturePack::Entry* entry)
+{
+  std::lock_guard lk(m_textures_lock);
+  m_textures.insert_or_assign(asset_id, PackedTexture{std::move(pack), entry});
+}
+
+bool TexturePackAssetLibrary::HasTexture(const AssetID& asset_id) const
+{
+  std::lock_guard lk(m_textures_lock);
+  return m_textures.contains(asset_id);
+}
+}  // namespace VideoCommon
@@ -0,0 +1,41 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "VideoCommon/Assets/CustomAssetLibrary.h"
+#include "VideoCommon/Assets/TexturePack.h"
+
+namespace VideoCommon
+{
+// This class implements 'CustomAssetLibrary' and loads raw textures from TexturePacks
+class TexturePackAssetLibrary final : public CustomAssetLibrary
+{
+public:
+  LoadInfo LoadTexture(const AssetID& asset_id, TextureAndSamplerData* data) override;
+  LoadInfo LoadTexture(const AssetID& asset_id, CustomTextureData* data) override;
+  LoadInfo LoadRasterSurfaceShader(const AssetID& asset_id, RasterSurfaceShaderData* data) override;
+  LoadInfo LoadMaterial(const AssetID& asset_id, MaterialData* data) override;
+  LoadInfo LoadMesh(const AssetID& asset_id, MeshData* data) override;
+
+  // Makes the asset id refer to the texture of the given entry of the pack. Its mipmaps are the
+  // entries of the same pack named like it with a "_mip<N>" suffix.
+  void AddTexture(const AssetID& asset_id, std::shared_ptr<TexturePack> pack,
+                  const TexturePack::Entry* entry);
+  bool HasTexture(const AssetID& asset_id) const;
+
+private:
+  struct PackedTexture
+  {
+    std::shared_ptr<TexturePack> pack;
+    const TexturePack::Entry* entry;
+  };
+
+  mutable std::mutex m_textures_lock;
+  std::map<AssetID, PackedTexture, std::less<>> m_textures;
+};
+}  // namespace VideoCommon
@@ -3,6 +3,7 @@
 
 #include "VideoCommon/AsyncShaderCompiler.h"
 
+#include <algorithm>
 #include <thread>
 
 #include "Common/Assert.h"
@@ -28,15 +29,20 @@ AsyncShaderCompiler::~AsyncShaderCompiler()
 void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
 {
   // If no worker threads are available, compile synchronously.
+  const auto queue_time = std::chrono::steady_clock::now();
   if (!HasWorkerThreads())
   {
     item->Compile();
     m_completed_work.push_back(std::move(item));
+
+    std::lock_guard guard(m_pending_work_lock);
+    RecordCompiled(priority, queue_time);
   }
   else
   {
     std::lock_guard guard(m_pending_work_lock);
-    m_pending_work.emplace(priority, std::move(item));
+    m_pending_work.emplace(priority, PendingWorkItem{std::move(item), queue_time});
+    m_stats[priority].pending++;
     m_worker_thread_wake.notify_one();
   }
 }
@@ -73,6 +79,8 @@ void AsyncShaderCompiler::ClearAllWork()
   {
     std::lock_guard guard(m_pending_work_lock);
     m_pending_work.clear();
+    for (auto& [priority, stats] : m_stats)
+      stats.pending = 0;
   }
 
   {
@@ -81,6 +89,23 @@ void AsyncShaderCompiler::ClearAllWork()
   }
 }
 
+std::map<u32, AsyncShaderCompiler::PriorityStats> AsyncShaderCompiler::GetStats()
+{
+  std::lock_guard guard(m_pending_work_lock);
+  return m_stats;
+}
+
+void AsyncShaderCompiler::RecordCompiled(u32 priority,
+                                         std::chrono::steady_clock::time_point queue_time)
+{
+  const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - queue_time);
+  PriorityStats& stats = m_stats[priority];
+  stats.compiled++;
+  stats.total_latency += latency;
+  stats.max_latency = std::max(stats.max_latency, latency);
+}
+
 bool AsyncShaderCompiler::WaitUntilCompletion(
     const std::function<void(size_t, size_t)>& progress_callback)
 {
@@ -235,8 +260,11 @@ void AsyncShaderCompiler::WorkerThreadRun()
     {
       m_busy_workers++;
       auto iter = m_pending_work.begin();
-      WorkItemPtr item(std::move(iter->second));
+      const u32 priority = iter->first;
+      const auto queue_time = iter->second.queue_time;
+      WorkItemPtr item(std::move(iter->second.item));
       m_pending_work.erase(iter);
+      m_stats[priority].pending--;
       pending_lock.unlock();
 
       if (item->Compile())
@@ -246,6 +274,7 @@ void AsyncShaderCompiler::WorkerThreadRun()
       }
 
       pending_lock.lock();
+      RecordCompiled(priority, queue_time);
       m_busy_workers--;
     }
   }
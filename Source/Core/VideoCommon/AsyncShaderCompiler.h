@@ -4,6 +4,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <functional>
@@ -33,6 +34,16 @@ public:
 
   using WorkItemPtr = std::unique_ptr<WorkItem>;
 
+  struct PriorityStats
+  {
+    // Work items waiting for a worker thread.
+    size_t pending = 0;
+    size_t compiled = 0;
+    // Time from queueing a work item until it was compiled.
+    std::chrono::microseconds total_latency{0};
+    std::chrono::microseconds max_latency{0};
+  };
+
   AsyncShaderCompiler();
   virtual ~AsyncShaderCompiler();
 
@@ -52,6 +63,9 @@ public:
   // Clears both pending and completed work
   void ClearAllWork();
 
+  // Returns the statistics of every priority work has been queued with (lowest first).
+  std::map<u32, PriorityStats> GetStats();
+
   // Calls progress_callback periodically, with completed_items, and total_items.
   // Returns false if interrupted.
   bool WaitUntilCompletion(const std::function<void(size_t, size_t)>& progress_callback);
@@ -77,10 +91,20 @@ private:
   std::vector<std::thread> m_worker_threads;
   std::atomic_bool m_worker_thread_start_result{false};
 
+  struct PendingWorkItem
+  {
+    WorkItemPtr item;
+    std::chrono::steady_clock::time_point queue_time;
+  };
+
+  void RecordCompiled(u32 priority, std::chrono::steady_clock::time_point queue_time);
+
   // A multimap is used to store the work items. We can't use a priority_queue here, because
   // there's no way to obtain a non-const reference, which we need for the unique_ptr.
-  std::multimap<u32, WorkItemPtr> m_pending_work;
+  std::multimap<u32, PendingWorkItem> m_pending_work;
   std::mutex m_pending_work_lock;
+  // Guarded by m_pending_work_lock.
+  std::map<u32, PriorityStats> m_stats;
   std::condition_variable m_worker_thread_wake;
   std::atomic_size_t m_busy_workers{0};
 
@@ -76,7 +76,7 @@ bool ScissorResult::IsWorse(const ScissorRect& lhs, const ScissorRect& rhs) cons
 
 namespace
 {
-using RangeList = Common::SmallVector<ScissorRange, 9>;
+using RangeList = Common::SmallVector<ScissorRange, MAX_SCISSOR_RANGES>;
 
 static RangeList ComputeScissorRanges(int start, int end, int offset, int efb_dim)
 {
@@ -131,8 +131,6 @@ ScissorResult::ScissorResult(ScissorPos scissor_top_left, ScissorPos scissor_bot
   RangeList x_ranges = ComputeScissorRanges(left, right, x_off, EFB_WIDTH);
   RangeList y_ranges = ComputeScissorRanges(top, bottom, y_off, EFB_HEIGHT);
 
-  rectangles.reserve(x_ranges.size() * y_ranges.size());
-
   // Now we need to form actual rectangles from the x and y ranges,
   // which is a simple Cartesian product of x_ranges_clamped and y_ranges_clamped.
   // Each rectangle is also a Cartesian product of x_range and y_range, with
@@ -184,6 +182,7 @@ void SetScissorAndViewport(FramebufferManager* frame_buffer_manager, ScissorPos
   const auto result = BPFunctions::ComputeScissorRects(scissor_top_left, scissor_bottom_right,
                                                        scissor_offset, viewport);
   auto native_rc = result.Best();
+  frame_buffer_manager->SetEFBScissorRect(native_rc.rect);
 
   auto target_rc = frame_buffer_manager->ConvertEFBRectangle(native_rc.rect);
   auto converted_rc = g_gfx->ConvertFramebufferRectangle(target_rc, g_gfx->GetCurrentFramebuffer());
@@ -8,9 +8,9 @@
 #pragma once
 
 #include <utility>
-#include <vector>
 
 #include "Common/MathUtil.h"
+#include "Common/SmallVector.h"
 #include "VideoCommon/BPMemory.h"
 
 class FramebufferManager;
@@ -18,6 +18,10 @@ struct Viewport;
 
 namespace BPFunctions
 {
+// The scissor offsets that ComputeScissorRanges tries per axis, which bounds how many ranges and
+// rectangles a ScissorResult can have.
+constexpr size_t MAX_SCISSOR_RANGES = 9;
+
 struct ScissorRange
 {
   constexpr ScissorRange() = default;
@@ -124,7 +128,8 @@ struct ScissorResult
   float viewport_top;
   float viewport_bottom;
 
-  std::vector<ScissorRect> rectangles;
+  // Computed whenever the scissor or viewport changes, so kept off the heap
+  Common::SmallVector<ScissorRect, MAX_SCISSOR_RANGES * MAX_SCISSOR_RANGES> rectangles;
 
   ScissorRect Best() const;
 
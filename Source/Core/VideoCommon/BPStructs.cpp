@@ -4,6 +4,7 @@
 #include "VideoCommon/BPStructs.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <string>
 
@@ -52,6 +53,19 @@ void BPInit()
   bpmem.bpMask = 0xFFFFFF;
 }
 
+// Registers that do something whenever they're written, rather than just holding state.
+static constexpr auto s_bp_command_registers = [] {
+  std::array<bool, 0x100> registers{};
+  for (const u8 reg :
+       {BPMEM_TRIGGER_EFB_COPY, BPMEM_CLEARBBOX1, BPMEM_CLEARBBOX2, BPMEM_SETDRAWDONE,
+        BPMEM_PE_TOKEN_ID, BPMEM_PE_TOKEN_INT_ID, BPMEM_LOADTLUT0, BPMEM_LOADTLUT1,
+        BPMEM_TEXINVALIDATE, BPMEM_PRELOAD_MODE, BPMEM_CLEAR_PIXEL_PERF})
+  {
+    registers[reg] = true;
+  }
+  return registers;
+}();
+
 static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager& xf_state_manager,
                       GeometryShaderManager& geometry_shader_manager, const BPCmd& bp,
                       int cycles_into_future)
@@ -77,18 +91,8 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
   ----------------------------------------------------------------------------------------------------------------
   */
 
-  if (((s32*)&bpmem)[bp.address] == bp.newvalue)
-  {
-    if (!(bp.address == BPMEM_TRIGGER_EFB_COPY || bp.address == BPMEM_CLEARBBOX1 ||
-          bp.address == BPMEM_CLEARBBOX2 || bp.address == BPMEM_SETDRAWDONE ||
-          bp.address == BPMEM_PE_TOKEN_ID || bp.address == BPMEM_PE_TOKEN_INT_ID ||
-          bp.address == BPMEM_LOADTLUT0 || bp.address == BPMEM_LOADTLUT1 ||
-          bp.address == BPMEM_TEXINVALIDATE || bp.address == BPMEM_PRELOAD_MODE ||
-          bp.address == BPMEM_CLEAR_PIXEL_PERF))
-    {
-      return;
-    }
-  }
+  if (((s32*)&bpmem)[bp.address] == bp.newvalue && !s_bp_command_registers[bp.address])
+    return;
 
   FlushPipeline();
 
@@ -334,10 +338,19 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
                     bpmem.copyTexSrcWH.x + 1, destStride, height, yScale);
 
       bool is_depth_copy = bpmem.zcontrol.pixel_format == PixelFormat::Z24;
-      g_texture_cache->CopyRenderTargetToTexture(
-          destAddr, EFBCopyFormat::XFB, copy_width, height, destStride, is_depth_copy, srcRect,
-          false, false, yScale, s_gammaLUT[PE_copy.gamma], bpmem.triggerEFBCopy.clamp_top,
-          bpmem.triggerEFBCopy.clamp_bottom, bpmem.copyfilter.GetCoefficients());
+      // Frames that the VI skip drops are neither copied nor presented.
+      const bool drop_copy = g_presenter->DropXFBCopy(destAddr, destStride * height);
+      const bool present_efb =
+          !drop_copy && g_texture_cache->CanPresentXFBCopyFromEFB(
+                            is_depth_copy, yScale, s_gammaLUT[PE_copy.gamma],
+                            bpmem.copyfilter.GetCoefficients());
+      if (!drop_copy && !present_efb)
+      {
+        g_texture_cache->CopyRenderTargetToTexture(
+            destAddr, EFBCopyFormat::XFB, copy_width, height, destStride, is_depth_copy, srcRect,
+            false, false, yScale, s_gammaLUT[PE_copy.gamma], bpmem.triggerEFBCopy.clamp_top,
+            bpmem.triggerEFBCopy.clamp_bottom, bpmem.copyfilter.GetCoefficients());
+      }
 
       auto& system = Core::System::GetInstance();
 
@@ -356,10 +369,16 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
       //       Might also clean up some issues with games doing XFB copies they don't intend to
       //       display.
 
-      if (g_ActiveConfig.bImmediateXFB)
+      if (present_efb)
+      {
+        // Present before the EFB is cleared below, which saves a full XFB copy at high IRs.
+        g_presenter->ImmediateSwapEFB(srcRect);
+      }
+      else if (g_ActiveConfig.bImmediateXFB)
       {
         // below div two to convert from bytes to pixels - it expects width, not stride
-        g_presenter->ImmediateSwap(destAddr, destStride / 2, destStride, height);
+        if (!drop_copy)
+          g_presenter->ImmediateSwap(destAddr, destStride / 2, destStride, height);
       }
       else
       {
@@ -412,6 +431,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
         (1 << bpmem.tmem_config.tlut_dest.tmem_line_count.NumBits()) * TMEM_LINE_SIZE;
     static_assert(MAX_LOADABLE_TMEM_ADDR + MAX_TMEM_LINE_COUNT < TMEM_SIZE);
 
+    g_texture_cache->FlushEFBCopiesInRange(addr, tmem_transfer_count);
     auto& memory = system.GetMemory();
     memory.CopyFromEmu(s_tex_mem.data() + tmem_addr, addr, tmem_transfer_count);
 
@@ -601,6 +621,10 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
       u32 bytes_read = 0;
       u32 tmem_addr_even = tmem_cfg.preload_tmem_even * TMEM_LINE_SIZE;
 
+      // RGBA8 preloads read twice the line count.
+      g_texture_cache->FlushEFBCopiesInRange(src_addr,
+                                             tmem_cfg.preload_tile_info.count * TMEM_LINE_SIZE * 2);
+
       if (tmem_cfg.preload_tile_info.type != 3)
       {
         if (tmem_addr_even < TMEM_SIZE)
@@ -833,6 +857,13 @@ void LoadBPRegPreprocess(u8 reg, u32 value, int cycles_into_future)
   case BPMEM_PE_TOKEN_INT_ID:  // Pixel Engine Interrupt Token ID
     system.GetPixelEngine().SetToken(newval & 0xffff, true, cycles_into_future);
     break;
+  case BPMEM_TRIGGER_EFB_COPY:
+  {
+    const UPE_Copy copy{.Hex = newval};
+    if (copy.copy_to_xfb ? !g_ActiveConfig.bSkipXFBCopyToRam : !g_ActiveConfig.bSkipEFBCopyToRam)
+      system.GetFifo().OnCopyToRAMPreprocessed();
+    break;
+  }
   }
 }
 
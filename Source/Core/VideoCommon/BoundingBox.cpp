@@ -72,6 +72,31 @@ void BoundingBox::Readback()
   m_is_valid = true;
 }
 
+void BoundingBox::DeferredReadback()
+{
+  // Instead of waiting for the GPU, keep returning the last values that came back until a newer
+  // readback completes. Games that read the bounding box to size effects can live with values
+  // that are a frame old, and this avoids a GPU sync on every read.
+  std::array<BBoxType, NUM_BBOX_VALUES> read_values;
+  if (m_readback_pending && PollReadback(read_values))
+  {
+    for (u32 i = 0; i < NUM_BBOX_VALUES; i++)
+    {
+      if (!m_dirty[i])
+        m_values[i] = read_values[i];
+    }
+
+    m_readback_pending = false;
+  }
+
+  if (!m_readback_pending)
+  {
+    m_readback_pending = BeginReadback();
+    if (!m_readback_pending)
+      Readback();
+  }
+}
+
 u16 BoundingBox::Get(u32 index)
 {
   ASSERT(index < NUM_BBOX_VALUES);
@@ -80,7 +105,12 @@ u16 BoundingBox::Get(u32 index)
     return m_bounding_box_fallback[index];
 
   if (!m_is_valid)
-    Readback();
+  {
+    if (g_ActiveConfig.bBBoxDeferredReadback)
+      DeferredReadback();
+    else
+      Readback();
+  }
 
   return static_cast<u16>(m_values[index]);
 }
@@ -112,6 +142,8 @@ void BoundingBox::DoState(PointerWrap& p)
   p.DoArray(m_values);
   p.DoArray(m_dirty);
   p.Do(m_is_valid);
+  if (p.IsReadMode())
+    m_readback_pending = false;
 
   // We handle saving the backend values specially rather than using Readback() and Flush() so that
   // we don't mess up the current cache state
@@ -41,14 +41,22 @@ protected:
   virtual std::vector<BBoxType> Read(u32 index, u32 length) = 0;
   virtual void Write(u32 index, std::span<const BBoxType> values) = 0;
 
+  // Deferred readback: BeginReadback queues a copy of all the values to the CPU without waiting
+  // for it, and returns false if the backend can't do that. PollReadback returns true and writes
+  // the values once the copy has completed.
+  virtual bool BeginReadback() { return false; }
+  virtual bool PollReadback(std::span<BBoxType, NUM_BBOX_VALUES>) { return false; }
+
 private:
   void Readback();
+  void DeferredReadback();
 
   bool m_is_active = false;
 
   std::array<BBoxType, NUM_BBOX_VALUES> m_values = {};
   std::array<bool, NUM_BBOX_VALUES> m_dirty = {};
   bool m_is_valid = true;
+  bool m_readback_pending = false;
 
   // Nintendo's SDK seems to write "default" bounding box values before every draw (1023 0 1023 0
   // are the only values encountered so far, which happen to be the extents allowed by the BP
@@ -151,6 +151,8 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
     m_transform_buffer_size = new_size;
     m_transform_buffer.reset(static_cast<TransformedVertex*>(
         Common::AllocateAlignedMemory(new_size * sizeof(TransformedVertex), 32)));
+    m_soa_buffer.reset(
+        static_cast<float*>(Common::AllocateAlignedMemory(new_size * 3 * sizeof(float), 32)));
   }
 
   // transform functions need the projection matrix to tranform to clip space
@@ -166,7 +168,10 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
   const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
   transform(m_transform_buffer.get(), src, stride, count);
   const CullFunction cull = m_cull_table[primitive][cull_mode];
-  return cull(m_transform_buffer.get(), count);
+  float* const soa = m_soa_buffer.get();
+  return cull(m_transform_buffer.get(), {soa, soa + m_transform_buffer_size,
+                                         soa + m_transform_buffer_size * 2},
+              count);
 }
 
 template <typename T>
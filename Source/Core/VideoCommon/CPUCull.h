@@ -20,8 +20,17 @@ public:
     float x, y, z, w;
   };
 
+  // The transformed vertices transposed into separate arrays, for culling several triangles at
+  // once.
+  struct SoAVertices
+  {
+    float* x;
+    float* y;
+    float* w;
+  };
+
   using TransformFunction = void (*)(void*, const void*, u32, int);
-  using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
+  using CullFunction = bool (*)(const CPUCull::TransformedVertex*, const SoAVertices&, int);
 
 private:
   template <typename T>
@@ -30,6 +39,7 @@ private:
     void operator()(T* ptr);
   };
   std::unique_ptr<TransformedVertex[], BufferDeleter<TransformedVertex>> m_transform_buffer{};
+  std::unique_ptr<float[], BufferDeleter<float>> m_soa_buffer{};
   u32 m_transform_buffer_size = 0;
   std::array<std::array<TransformFunction, 2>, 2> m_transform_table{};
   Common::EnumMap<Common::EnumMap<CullFunction, CullMode::All>,
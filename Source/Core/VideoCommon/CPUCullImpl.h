@@ -653,9 +653,296 @@ ATTR_TARGET DOLPHIN_FORCE_INLINE static bool CullTriangle(const CPUCull::Transfo
   return cull;
 }
 
+#ifndef NO_SIMD
+// Several triangles at once, one per lane, for the primitives whose triangles use consecutive
+// vertices.  The vertices are first transposed into separate x, y and w arrays.
+#if defined(USE_AVX)
+typedef __m256 WideVector;
+typedef __m256 WideMask;
+constexpr int WIDE_LANES = 8;
+#elif defined(USE_SSE)
+typedef __m128 WideVector;
+typedef __m128 WideMask;
+constexpr int WIDE_LANES = 4;
+#elif defined(USE_NEON)
+typedef float32x4_t WideVector;
+typedef uint32x4_t WideMask;
+constexpr int WIDE_LANES = 4;
+#endif
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static WideVector WideLoad(const float* data)
+{
+#if defined(USE_AVX)
+  return _mm256_loadu_ps(data);
+#elif defined(USE_SSE)
+  return _mm_loadu_ps(data);
+#elif defined(USE_NEON)
+  return vld1q_f32(data);
+#endif
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static WideVector WideBroadcast(float value)
+{
+#if defined(USE_AVX)
+  return _mm256_set1_ps(value);
+#elif defined(USE_SSE)
+  return _mm_set1_ps(value);
+#elif defined(USE_NEON)
+  return vdupq_n_f32(value);
+#endif
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static WideVector WideAdd(WideVector a, WideVector b)
+{
+#if defined(USE_AVX)
+  return _mm256_add_ps(a, b);
+#elif defined(USE_SSE)
+  return _mm_add_ps(a, b);
+#elif defined(USE_NEON)
+  return vaddq_f32(a, b);
+#endif
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static WideVector WideSub(WideVector a, WideVector b)
+{
+#if defined(USE_AVX)
+  return _mm256_sub_ps(a, b);
+#elif defined(USE_SSE)
+  return _mm_sub_ps(a, b);
+#elif defined(USE_NEON)
+  return vsubq_f32(a, b);
+#endif
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static WideVector WideMul(WideVector a, WideVector b)
+{
+#if defined(USE_AVX)
+  return _mm256_mul_ps(a, b);
+#elif defined(USE_SSE)
+  return _mm_mul_ps(a, b);
+#elif defined(USE_NEON)
+  return vmulq_f32(a, b);
+#endif
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static WideVector WideNeg(WideVector a)
+{
+#if defined(USE_AVX)
+  return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f));
+#elif defined(USE_SSE)
+  return _mm_xor_ps(a, _mm_set1_ps(-0.0f));
+#elif defined(USE_NEON)
+  return vnegq_f32(a);
+#endif
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static WideMask WideLess(WideVector a, WideVector b)
+{
+#if defined(USE_AVX)
+  return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+#elif defined(USE_SSE)
+  return _mm_cmplt_ps(a, b);
+#elif defined(USE_NEON)
+  return vcltq_f32(a, b);
+#endif
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static WideMask WideLessEqual(WideVector a, WideVector b)
+{
+#if defined(USE_AVX)
+  return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+#elif defined(USE_SSE)
+  return _mm_cmple_ps(a, b);
+#elif defined(USE_NEON)
+  return vcleq_f32(a, b);
+#endif
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static WideMask WideEqual(WideVector a, WideVector b)
+{
+#if defined(USE_AVX)
+  return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+#elif defined(USE_SSE)
+  return _mm_cmpeq_ps(a, b);
+#elif defined(USE_NEON)
+  return vceqq_f32(a, b);
+#endif
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static WideMask WideAnd(WideMask a, WideMask b)
+{
+#if defined(USE_AVX)
+  return _mm256_and_ps(a, b);
+#elif defined(USE_SSE)
+  return _mm_and_ps(a, b);
+#elif defined(USE_NEON)
+  return vandq_u32(a, b);
+#endif
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static WideMask WideOr(WideMask a, WideMask b)
+{
+#if defined(USE_AVX)
+  return _mm256_or_ps(a, b);
+#elif defined(USE_SSE)
+  return _mm_or_ps(a, b);
+#elif defined(USE_NEON)
+  return vorrq_u32(a, b);
+#endif
+}
+
+ATTR_TARGET DOLPHIN_FORCE_INLINE static bool WideAllSet(WideMask mask)
+{
+#if defined(USE_AVX)
+  return _mm256_movemask_ps(mask) == 0xff;
+#elif defined(USE_SSE)
+  return _mm_movemask_ps(mask) == 0xf;
+#elif defined(USE_NEON)
+  return vminvq_u32(mask) == 0xFFFFFFFF;
+#endif
+}
+
+// Takes b where the lane is odd, and a where it is even.
+ATTR_TARGET DOLPHIN_FORCE_INLINE static WideVector WideSelectOdd(WideVector a, WideVector b)
+{
+#if defined(USE_AVX)
+  return _mm256_blend_ps(a, b, 0xaa);
+#elif defined(USE_SSE41)
+  return _mm_blend_ps(a, b, 0xa);
+#elif defined(USE_SSE)
+  const __m128 odd = _mm_castsi128_ps(_mm_setr_epi32(0, -1, 0, -1));
+  return _mm_or_ps(_mm_and_ps(odd, b), _mm_andnot_ps(odd, a));
+#elif defined(USE_NEON)
+  const uint32x4_t odd = vreinterpretq_u32_u64(vdupq_n_u64(0xFFFFFFFF00000000ULL));
+  return vbslq_f32(odd, b, a);
+#endif
+}
+
+ATTR_TARGET static void TransposeVertices(const CPUCull::TransformedVertex* transformed,
+                                          const CPUCull::SoAVertices& soa, int count)
+{
+  int i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+#if defined(USE_SSE)
+    const Vector* vsource = reinterpret_cast<const Vector*>(&transformed[i]);
+    Vector x = vsource[0];
+    Vector y = vsource[1];
+    Vector z = vsource[2];
+    Vector w = vsource[3];
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+    _mm_storeu_ps(&soa.x[i], x);
+    _mm_storeu_ps(&soa.y[i], y);
+    _mm_storeu_ps(&soa.w[i], w);
+#elif defined(USE_NEON)
+    float32x4x4_t ld = vld4q_f32(reinterpret_cast<const float*>(&transformed[i]));
+    vst1q_f32(&soa.x[i], ld.val[0]);
+    vst1q_f32(&soa.y[i], ld.val[1]);
+    vst1q_f32(&soa.w[i], ld.val[3]);
+#endif
+  }
+  for (; i < count; i++)
+  {
+    soa.x[i] = transformed[i].x;
+    soa.y[i] = transformed[i].y;
+    soa.w[i] = transformed[i].w;
+  }
+}
+
+// The same tests as CullTriangle, on WIDE_LANES triangles.
+template <CullMode Mode>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static bool
+CullTriangles(WideVector ax, WideVector ay, WideVector aw,  //
+              WideVector bx, WideVector by, WideVector bw,  //
+              WideVector cx, WideVector cy, WideVector cw)
+{
+  const WideVector normal_z_dir =
+      WideAdd(WideAdd(WideMul(WideSub(WideMul(cw, ax), WideMul(aw, cx)), by),
+                      WideMul(WideSub(WideMul(cx, ay), WideMul(ax, cy)), bw)),
+              WideMul(WideSub(WideMul(cy, aw), WideMul(ay, cw)), bx));
+  const WideVector zero = WideBroadcast(0.0f);
+
+  WideMask cull;
+  switch (Mode)
+  {
+  case CullMode::None:
+    cull = WideEqual(normal_z_dir, zero);
+    break;
+  case CullMode::Front:
+    cull = WideLessEqual(normal_z_dir, zero);
+    break;
+  case CullMode::Back:
+  default:
+    cull = WideLessEqual(zero, normal_z_dir);
+    break;
+  }
+  if (WideAllSet(cull))
+    return true;
+
+  const WideVector anw = WideNeg(aw);
+  const WideVector bnw = WideNeg(bw);
+  const WideVector cnw = WideNeg(cw);
+  const WideMask x_lt_nw =
+      WideAnd(WideAnd(WideLess(ax, anw), WideLess(bx, bnw)), WideLess(cx, cnw));
+  const WideMask y_lt_nw =
+      WideAnd(WideAnd(WideLess(ay, anw), WideLess(by, bnw)), WideLess(cy, cnw));
+  const WideMask x_gt_pw = WideAnd(WideAnd(WideLess(aw, ax), WideLess(bw, bx)), WideLess(cw, cx));
+  const WideMask y_gt_pw = WideAnd(WideAnd(WideLess(aw, ay), WideLess(bw, by)), WideLess(cw, cy));
+  cull = WideOr(WideOr(cull, WideOr(x_lt_nw, y_lt_nw)), WideOr(x_gt_pw, y_gt_pw));
+  return WideAllSet(cull);
+}
+
+// These cull WIDE_LANES triangles at a time, and return the last vertex of the first triangle
+// left over for CullTriangle, or -1 if one of them is visible.
+template <CullMode Mode>
+ATTR_TARGET static int CullTriangleStripWide(const CPUCull::SoAVertices& soa, int count)
+{
+  int i = 2;
+  for (; i + WIDE_LANES <= count; i += WIDE_LANES)
+  {
+    // The winding flips every triangle, and i - 2 is even at the start of every batch, so the
+    // odd lanes take their last two vertices in the other order.
+    const WideVector x1 = WideLoad(&soa.x[i - 1]);
+    const WideVector y1 = WideLoad(&soa.y[i - 1]);
+    const WideVector w1 = WideLoad(&soa.w[i - 1]);
+    const WideVector x2 = WideLoad(&soa.x[i]);
+    const WideVector y2 = WideLoad(&soa.y[i]);
+    const WideVector w2 = WideLoad(&soa.w[i]);
+    if (!CullTriangles<Mode>(WideLoad(&soa.x[i - 2]), WideLoad(&soa.y[i - 2]),
+                             WideLoad(&soa.w[i - 2]),  //
+                             WideSelectOdd(x1, x2), WideSelectOdd(y1, y2), WideSelectOdd(w1, w2),
+                             WideSelectOdd(x2, x1), WideSelectOdd(y2, y1), WideSelectOdd(w2, w1)))
+    {
+      return -1;
+    }
+  }
+  return i;
+}
+
+template <CullMode Mode>
+ATTR_TARGET static int CullTriangleFanWide(const CPUCull::SoAVertices& soa, int count)
+{
+  const WideVector ax = WideBroadcast(soa.x[0]);
+  const WideVector ay = WideBroadcast(soa.y[0]);
+  const WideVector aw = WideBroadcast(soa.w[0]);
+  int i = 2;
+  for (; i + WIDE_LANES <= count; i += WIDE_LANES)
+  {
+    if (!CullTriangles<Mode>(ax, ay, aw,  //
+                             WideLoad(&soa.x[i - 1]), WideLoad(&soa.y[i - 1]),
+                             WideLoad(&soa.w[i - 1]),  //
+                             WideLoad(&soa.x[i]), WideLoad(&soa.y[i]), WideLoad(&soa.w[i])))
+    {
+      return -1;
+    }
+  }
+  return i;
+}
+#endif
+
 template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
 ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* transformed,
-                                             int count)
+                                             const CPUCull::SoAVertices& soa, int count)
 {
   switch (Primitive)
   {
@@ -687,8 +974,18 @@ ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* t
     break;
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP:
   {
-    bool wind = false;
-    for (int i = 2; i < count; ++i)
+    int i = 2;
+#ifndef NO_SIMD
+    if (Mode != CullMode::All && count >= WIDE_LANES + 2)
+    {
+      TransposeVertices(transformed, soa, count);
+      i = CullTriangleStripWide<Mode>(soa, count);
+      if (i < 0)
+        return false;
+    }
+#endif
+    bool wind = (i & 1) != 0;
+    for (; i < count; ++i)
     {
       if (!CullTriangle<Mode>(transformed[i - 2], transformed[i - !wind], transformed[i - wind]))
         return false;
@@ -697,13 +994,25 @@ ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* t
     break;
   }
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN:
-    for (int i = 2; i < count; ++i)
+  {
+    int i = 2;
+#ifndef NO_SIMD
+    if (Mode != CullMode::All && count >= WIDE_LANES + 2)
+    {
+      TransposeVertices(transformed, soa, count);
+      i = CullTriangleFanWide<Mode>(soa, count);
+      if (i < 0)
+        return false;
+    }
+#endif
+    for (; i < count; ++i)
     {
       if (!CullTriangle<Mode>(transformed[0], transformed[i - 1], transformed[i]))
         return false;
     }
     break;
   }
+  }
 
   return true;
 }
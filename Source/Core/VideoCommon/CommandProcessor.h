@@ -171,7 +171,9 @@ public:
 
   void SetCPStatusFromGPU();
   void SetCPStatusFromCPU();
-  void GatherPipeBursted();
+  // Publishes the given number of bursts the CPU has written to the FIFO since the last call, with
+  // one update of the read/write distance and one wakeup of the GPU thread.
+  void GatherPipeBursted(u32 bursts);
   void UpdateInterrupts(u64 userdata);
   void UpdateInterruptsFromVideoBackend(u64 userdata);
 
@@ -15,6 +15,7 @@
 #include "Core/System.h"
 
 #include "VideoCommon/AsyncRequests.h"
+#include "VideoCommon/Fifo.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/PixelEngine.h"
 #include "VideoCommon/Statistics.h"
@@ -67,11 +68,15 @@ u32 EFBInterfaceBase::PeekColor(u16 x, u16 y)
   if (ShouldSkipAccess(x, y))
     return 0;
 
+  // In deterministic GPU thread mode, what a peek sees mustn't depend on how far the GPU thread
+  // got with the commands sent before it.
+  auto& system = Core::System::GetInstance();
+  system.GetFifo().SyncGPU(Fifo::SyncGPUReason::EFBPoke);
+
   u32 color = PeekColorInternal(x, y);
 
   // check what to do with the alpha channel (GX_PokeAlphaRead)
-  PixelEngine::AlphaReadMode alpha_read_mode =
-      Core::System::GetInstance().GetPixelEngine().GetAlphaReadMode();
+  PixelEngine::AlphaReadMode alpha_read_mode = system.GetPixelEngine().GetAlphaReadMode();
 
   if (alpha_read_mode == PixelEngine::AlphaReadMode::ReadNone)
   {
@@ -127,6 +132,9 @@ u32 EFBInterfaceBase::PeekDepth(u16 x, u16 y)
   if (ShouldSkipAccess(x, y))
     return 0;
 
+  auto& system = Core::System::GetInstance();
+  system.GetFifo().SyncGPU(Fifo::SyncGPUReason::EFBPoke);
+
   return PeekDepthInternal(x, y);
 }
 
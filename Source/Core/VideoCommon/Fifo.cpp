@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <cstring>
+#include <utility>
 
 #include "Common/Assert.h"
 #include "Common/BlockingLoop.h"
@@ -148,6 +149,20 @@ void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
 {
   if (m_use_deterministic_gpu_thread)
   {
+    // Swaps only sync to move the buffers back to their start, which the emulated console can't
+    // see, so the GPU thread may stay up to one swap behind rather than stall the CPU thread every
+    // frame. Everything the console can see from the GPU thread is either produced by the CPU
+    // thread while preprocessing, or read back through a sync that does wait. The exception is
+    // copies to RAM, which the CPU may read without a sync, so swaps wait for those.
+    if (reason == SyncGPUReason::Swap && !m_gpu_mainloop.IsDone() &&
+        static_cast<size_t>(m_video_buffer_write_ptr - m_video_buffer) < FIFO_SIZE / 2 &&
+        (!m_video_buffer_swap_ptr || m_video_buffer_seen_ptr >= m_video_buffer_swap_ptr) &&
+        (!m_video_buffer_copy_ptr || m_video_buffer_seen_ptr >= m_video_buffer_copy_ptr))
+    {
+      m_video_buffer_swap_ptr = m_video_buffer_write_ptr;
+      return;
+    }
+
     m_gpu_mainloop.Wait();
     if (!m_gpu_mainloop.IsRunning())
       return;
@@ -178,6 +193,8 @@ void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
       m_video_buffer_pp_read_ptr = m_video_buffer;
       m_video_buffer_read_ptr = m_video_buffer;
       m_video_buffer_seen_ptr = write_ptr;
+      m_video_buffer_swap_ptr = nullptr;
+      m_video_buffer_copy_ptr = nullptr;
     }
   }
 }
@@ -267,6 +284,8 @@ void FifoManager::ReadDataFromFifoOnCPU(u32 read_ptr)
   memory.CopyFromEmu(m_video_buffer_write_ptr, read_ptr, GPFifo::GATHER_PIPE_SIZE);
   m_video_buffer_pp_read_ptr = OpcodeDecoder::RunFifo<true>(
       DataReader(m_video_buffer_pp_read_ptr, write_ptr + GPFifo::GATHER_PIPE_SIZE), nullptr);
+  if (std::exchange(m_copy_to_ram_preprocessed, false))
+    m_video_buffer_copy_ptr = write_ptr + GPFifo::GATHER_PIPE_SIZE;
   // This would have to be locked if the GPU thread didn't spin.
   m_video_buffer_write_ptr = write_ptr + GPFifo::GATHER_PIPE_SIZE;
 }
@@ -277,6 +296,9 @@ void FifoManager::ResetVideoBuffer()
   m_video_buffer_write_ptr = m_video_buffer;
   m_video_buffer_seen_ptr = m_video_buffer;
   m_video_buffer_pp_read_ptr = m_video_buffer;
+  m_video_buffer_swap_ptr = nullptr;
+  m_video_buffer_copy_ptr = nullptr;
+  m_copy_to_ram_preprocessed = false;
   m_fifo_aux_write_ptr = m_fifo_aux_data;
   m_fifo_aux_read_ptr = m_fifo_aux_data;
 }
@@ -65,6 +65,10 @@ public:
   // In dual core mode, this synchronizes with the GPU thread.
   void SyncGPUForRegisterAccess();
 
+  // Called while preprocessing in deterministic GPU thread mode, for EFB and XFB copies that are
+  // written to RAM. Swaps wait for the GPU thread until it made them.
+  void OnCopyToRAMPreprocessed() { m_copy_to_ram_preprocessed = true; }
+
   void PushFifoAuxBuffer(const void* ptr, size_t size);
   void* PopFifoAuxBuffer(size_t size);
 
@@ -107,6 +111,13 @@ private:
   std::atomic<u8*> m_video_buffer_write_ptr = nullptr;
   std::atomic<u8*> m_video_buffer_seen_ptr = nullptr;
   u8* m_video_buffer_pp_read_ptr = nullptr;
+  // In deterministic GPU thread mode, the write_ptr at the last swap that didn't wait for the GPU
+  // thread, or nullptr if the last one did.
+  u8* m_video_buffer_swap_ptr = nullptr;
+  // In deterministic GPU thread mode, the write_ptr after the last copy to RAM, or nullptr if the
+  // GPU thread has been waited for since.
+  u8* m_video_buffer_copy_ptr = nullptr;
+  bool m_copy_to_ram_preprocessed = false;
   // The read_ptr is always owned by the GPU thread.  In normal mode, so is the
   // write_ptr, despite it being atomic.  In deterministic GPU thread mode,
   // things get a bit more complicated:
@@ -18,6 +18,7 @@ extern "C" {
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
 #include <libavutil/error.h>
+#include <libavutil/hwcontext.h>
 #include <libavutil/log.h>
 #include <libavutil/mathematics.h>
 #include <libavutil/opt.h>
@@ -50,6 +51,10 @@ struct FrameDumpContext
   AVFrame* scaled_frame = nullptr;
   SwsContext* sws = nullptr;
 
+  // For encoders that only take frames in GPU memory, scaled_frame is uploaded to hw_frame.
+  AVBufferRef* hw_device = nullptr;
+  AVFrame* hw_frame = nullptr;
+
   s64 last_pts = AV_NOPTS_VALUE;
 
   int width = 0;
@@ -163,6 +168,72 @@ std::string AVErrorString(int error)
   return fmt::format("{:8x} {}", (u32)error, &msg[0]);
 }
 
+// Whether the encoder can only be given frames in GPU memory, like the VAAPI ones. Encoders like
+// NVENC, AMF and VideoToolbox also take frames in memory and are given those.
+bool TakesOnlyHardwareFrames(const AVCodec* codec)
+{
+  if (!codec->pix_fmts || codec->pix_fmts[0] == AV_PIX_FMT_NONE)
+    return false;
+
+  for (const AVPixelFormat* pix_fmt = codec->pix_fmts; *pix_fmt != AV_PIX_FMT_NONE; ++pix_fmt)
+  {
+    const AVPixFmtDescriptor* const desc = av_pix_fmt_desc_get(*pix_fmt);
+    if (!desc || !(desc->flags & AV_PIX_FMT_FLAG_HWACCEL))
+      return false;
+  }
+  return true;
+}
+
+// Creates the device and the frames the images are uploaded to for such an encoder. The images
+// are converted to sw_pix_fmt before uploading them.
+bool InitHardwareFrames(FrameDumpContext& context, const AVCodec* codec, AVPixelFormat sw_pix_fmt)
+{
+  const AVCodecHWConfig* hw_config = nullptr;
+  for (int i = 0; const AVCodecHWConfig* const config = avcodec_get_hw_config(codec, i); ++i)
+  {
+    if (config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_FRAMES_CTX)
+    {
+      hw_config = config;
+      break;
+    }
+  }
+  if (!hw_config)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Encoder {} can't be given frames", codec->name);
+    return false;
+  }
+
+  if (const int error =
+          av_hwdevice_ctx_create(&context.hw_device, hw_config->device_type, nullptr, nullptr, 0))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not create {} device: {}",
+                  av_hwdevice_get_type_name(hw_config->device_type), AVErrorString(error));
+    return false;
+  }
+
+  AVBufferRef* frames_ref = av_hwframe_ctx_alloc(context.hw_device);
+  if (!frames_ref)
+    return false;
+
+  auto* const frames = reinterpret_cast<AVHWFramesContext*>(frames_ref->data);
+  frames->format = hw_config->pix_fmt;
+  frames->sw_format = sw_pix_fmt;
+  frames->width = context.width;
+  frames->height = context.height;
+  if (const int error = av_hwframe_ctx_init(frames_ref))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not create hardware frames: {}", AVErrorString(error));
+    av_buffer_unref(&frames_ref);
+    return false;
+  }
+
+  // The codec context takes over the reference.
+  context.codec->hw_frames_ctx = frames_ref;
+  context.codec->pix_fmt = hw_config->pix_fmt;
+  context.hw_frame = av_frame_alloc();
+  return context.hw_frame != nullptr;
+}
+
 }  // namespace
 
 bool FFMpegFrameDump::Start(int w, int h, u64 start_ticks)
@@ -298,6 +369,16 @@ bool FFMpegFrameDump::CreateVideoFile()
 
   m_context->codec->pix_fmt = pix_fmt;
 
+  if (TakesOnlyHardwareFrames(codec))
+  {
+    // These take NV12 rather than planar YUV.
+    if (pixel_format_string.empty())
+      pix_fmt = AV_PIX_FMT_NV12;
+
+    if (!InitHardwareFrames(*m_context, codec, pix_fmt))
+      return false;
+  }
+
   if (m_context->codec->codec_id == AV_CODEC_ID_UTVIDEO)
     av_opt_set_int(m_context->codec->priv_data, "pred", 3, 0);  // median
 
@@ -313,7 +394,7 @@ bool FFMpegFrameDump::CreateVideoFile()
   m_context->src_frame = av_frame_alloc();
   m_context->scaled_frame = av_frame_alloc();
 
-  m_context->scaled_frame->format = m_context->codec->pix_fmt;
+  m_context->scaled_frame->format = pix_fmt;
   m_context->scaled_frame->width = m_context->width;
   m_context->scaled_frame->height = m_context->height;
 
@@ -399,17 +480,36 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
   // Convert image from RGBA to desired pixel format.
   m_context->sws = sws_getCachedContext(
       m_context->sws, frame.width, frame.height, pix_fmt, m_context->width, m_context->height,
-      m_context->codec->pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
+      static_cast<AVPixelFormat>(m_context->scaled_frame->format), SWS_BICUBIC, nullptr, nullptr,
+      nullptr);
   if (m_context->sws)
   {
     sws_scale(m_context->sws, m_context->src_frame->data, m_context->src_frame->linesize, 0,
               frame.height, m_context->scaled_frame->data, m_context->scaled_frame->linesize);
   }
 
+  AVFrame* encoded_frame = m_context->scaled_frame;
+  if (m_context->hw_frame)
+  {
+    av_frame_unref(m_context->hw_frame);
+    if (const int error =
+            av_hwframe_get_buffer(m_context->codec->hw_frames_ctx, m_context->hw_frame, 0))
+    {
+      ERROR_LOG_FMT(FRAMEDUMP, "Could not get hardware frame: {}", AVErrorString(error));
+      return;
+    }
+    if (const int error = av_hwframe_transfer_data(m_context->hw_frame, encoded_frame, 0))
+    {
+      ERROR_LOG_FMT(FRAMEDUMP, "Could not upload frame: {}", AVErrorString(error));
+      return;
+    }
+    encoded_frame = m_context->hw_frame;
+  }
+
   m_context->last_pts = pts;
-  m_context->scaled_frame->pts = pts;
+  encoded_frame->pts = pts;
 
-  if (const int error = avcodec_send_frame(m_context->codec, m_context->scaled_frame))
+  if (const int error = avcodec_send_frame(m_context->codec, encoded_frame))
   {
     ERROR_LOG_FMT(FRAMEDUMP, "Error while encoding video: {}", AVErrorString(error));
     return;
@@ -482,8 +582,10 @@ void FFMpegFrameDump::CloseVideoFile()
 {
   av_frame_free(&m_context->src_frame);
   av_frame_free(&m_context->scaled_frame);
+  av_frame_free(&m_context->hw_frame);
 
   avcodec_free_context(&m_context->codec);
+  av_buffer_unref(&m_context->hw_device);
 
   if (m_context->format)
     avio_closep(&m_context->format->pb);
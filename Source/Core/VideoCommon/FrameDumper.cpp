@@ -20,6 +20,9 @@
 // The video encoder needs the image to be a multiple of x samples.
 static constexpr int VIDEO_ENCODER_LCM = 4;
 
+// Number of frames a readback is left to complete before it is mapped.
+static constexpr size_t FRAME_DUMP_READBACK_LATENCY = 2;
+
 static bool DumpFrameToPNG(const FrameData& frame, const std::string& file_name)
 {
   return Common::ConvertRGBAToRGBAndSavePNG(file_name, frame.data, frame.width, frame.height,
@@ -30,7 +33,9 @@ static bool DumpFrameToPNG(const FrameData& frame, const std::string& file_name)
 FrameDumper::FrameDumper()
 {
   m_frame_end_handle =
-      GetVideoEvents().after_frame_event.Register([this](Core::System&) { FlushFrameDump(); });
+      GetVideoEvents().after_frame_event.Register([this](Core::System&) {
+        FlushFrameDumpReadbacks(IsFrameDumping() ? FRAME_DUMP_READBACK_LATENCY : 0);
+      });
 }
 
 FrameDumper::~FrameDumper()
@@ -61,13 +66,14 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  std::unique_ptr<AbstractStagingTexture> readback =
+      GetFrameDumpReadbackTexture(target_width, target_height);
+  if (!readback)
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_ffmpeg_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  readback->CopyFromTexture(src_texture, copy_rect, 0, 0, readback->GetRect());
+  m_frame_dump_pending_readbacks.push_back(
+      {std::move(readback), m_ffmpeg_dump.FetchState(ticks, frame_number)});
 }
 
 bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -98,48 +104,60 @@ bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_heigh
   return true;
 }
 
-bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+std::unique_ptr<AbstractStagingTexture>
+FrameDumper::GetFrameDumpReadbackTexture(u32 target_width, u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
-  if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
-    return true;
-
-  rbtex.reset();
-  rbtex = g_gfx->CreateStagingTexture(StagingTextureType::Readback,
-                                      TextureConfig(target_width, target_height, 1, 1, 1,
-                                                    AbstractTextureFormat::RGBA8, 0,
-                                                    AbstractTextureType::Texture_2DArray));
-  if (!rbtex)
-    return false;
+  while (!m_frame_dump_free_readback_textures.empty())
+  {
+    std::unique_ptr<AbstractStagingTexture> rbtex =
+        std::move(m_frame_dump_free_readback_textures.back());
+    m_frame_dump_free_readback_textures.pop_back();
+    if (rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
+      return rbtex;
+  }
 
-  return true;
+  return g_gfx->CreateStagingTexture(StagingTextureType::Readback,
+                                     TextureConfig(target_width, target_height, 1, 1, 1,
+                                                   AbstractTextureFormat::RGBA8, 0,
+                                                   AbstractTextureType::Texture_2DArray));
 }
 
 void FrameDumper::FlushFrameDump()
 {
-  if (!m_frame_dump_needs_flush)
-    return;
-
-  // Ensure dumping thread is done with output texture before swapping.
-  FinishFrameData();
+  FlushFrameDumpReadbacks(0);
+}
 
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+void FrameDumper::FlushFrameDumpReadbacks(size_t frames_to_keep)
+{
+  if (m_frame_dump_pending_readbacks.size() <= frames_to_keep)
+    return;
 
-  // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
-  output->Flush();
-  if (output->Map())
-  {
-    DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
-  }
-  else
+  while (m_frame_dump_pending_readbacks.size() > frames_to_keep)
   {
-    ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    // Ensure dumping thread is done with output texture before replacing it.
+    FinishFrameData();
+
+    PendingReadback readback = std::move(m_frame_dump_pending_readbacks.front());
+    m_frame_dump_pending_readbacks.pop_front();
+    if (m_frame_dump_output_texture)
+      m_frame_dump_free_readback_textures.push_back(std::move(m_frame_dump_output_texture));
+    m_frame_dump_output_texture = std::move(readback.texture);
+
+    // Queue encoding of the oldest frame dumped.
+    auto& output = m_frame_dump_output_texture;
+    output->Flush();
+    if (output->Map())
+    {
+      DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
+                    output->GetConfig().height, static_cast<int>(output->GetMappedStride()),
+                    readback.state);
+    }
+    else
+    {
+      ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    }
   }
 
-  m_frame_dump_needs_flush = false;
-
   // Shutdown frame dumping if it is no longer active.
   if (!IsFrameDumping())
     ShutdownFrameDumping();
@@ -164,13 +182,14 @@ void FrameDumper::ShutdownFrameDumping()
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
   m_frame_dump_output_texture.reset();
+  m_frame_dump_free_readback_textures.clear();
 }
 
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
+void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride,
+                                const FrameState& state)
 {
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
+  m_frame_dump_data = FrameData{data, w, h, stride, state};
 
   if (!m_frame_dump_thread_running.IsSet())
   {
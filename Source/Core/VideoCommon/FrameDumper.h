@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <deque>
+#include <memory>
+#include <vector>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
@@ -49,14 +53,18 @@ private:
 
   void ShutdownFrameDumping();
 
+  // Queues the encoding of the frames read back, except for the last frames_to_keep ones.
+  void FlushFrameDumpReadbacks(size_t frames_to_keep);
+
   // Checks that the frame dump render texture exists and is the correct size.
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
-  // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  // Returns a free readback texture of the given size, creating one if needed.
+  std::unique_ptr<AbstractStagingTexture> GetFrameDumpReadbackTexture(u32 target_width,
+                                                                      u32 target_height);
 
   // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  void DumpFrameData(const u8* data, int w, int h, int stride, const FrameState& state);
 
   // Ensures all encoded frames have been written to the output file.
   void FinishFrameData();
@@ -70,9 +78,6 @@ private:
   // Set by frame dump thread on frame completion.
   Common::Event m_frame_dump_done;
 
-  // Holds emulation state during the last swap when dumping.
-  FrameState m_last_frame_state;
-
   // Communication of frame between video and dump threads.
   FrameData m_frame_dump_data;
 
@@ -80,11 +85,20 @@ private:
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
+  struct PendingReadback
+  {
+    std::unique_ptr<AbstractStagingTexture> texture;
+    // Emulation state during the swap of the frame.
+    FrameState state;
+  };
+
+  // Frames being copied to readback textures, oldest first. They are only mapped a few frames
+  // later, by when the GPU is done with the copy, so that dumping doesn't stall the video thread.
+  std::deque<PendingReadback> m_frame_dump_pending_readbacks;
+  // Texture mapped for the dump thread.
   std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
+  // Readback textures to reuse.
+  std::vector<std::unique_ptr<AbstractStagingTexture>> m_frame_dump_free_readback_textures;
   // Set when thread is processing output texture.
   bool m_frame_dump_frame_running = false;
 
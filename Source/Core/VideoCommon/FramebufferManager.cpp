@@ -567,47 +567,89 @@ void FramebufferManager::RefreshPeekCache()
 
 void FramebufferManager::InvalidatePeekCache(bool forced)
 {
-  if (forced || m_efb_color_cache.out_of_date)
-  {
-    if (m_efb_color_cache.has_active_tiles)
+  auto invalidate = [&](EFBCacheData& data) {
+    if (!forced && !data.out_of_date)
+      return;
+
+    if (data.has_active_tiles)
     {
-      for (u32 i = 0; i < m_efb_color_cache.tiles.size(); i++)
+      // Tiles which weren't drawn to stay valid, so that a draw to one corner of the EFB doesn't
+      // force reading back the tiles peeked elsewhere again.
+      const MathUtil::Rectangle<int>& dirty = data.dirty_rect;
+      bool any_present = false;
+      for (u32 i = 0; i < data.tiles.size(); i++)
       {
-        m_efb_color_cache.tiles[i].present = false;
+        if (!data.tiles[i].present)
+          continue;
+
+        const MathUtil::Rectangle<int> rect = GetEFBCacheTileRect(i);
+        if (forced || (rect.left < dirty.right && dirty.left < rect.right &&
+                       rect.top < dirty.bottom && dirty.top < rect.bottom))
+        {
+          data.tiles[i].present = false;
+          data.needs_refresh = true;
+        }
+        else
+        {
+          any_present = true;
+        }
       }
-
-      m_efb_color_cache.needs_refresh = true;
+      data.has_active_tiles = any_present;
     }
 
-    m_efb_color_cache.has_active_tiles = false;
-    m_efb_color_cache.out_of_date = false;
-  }
-  if (forced || m_efb_depth_cache.out_of_date)
+    data.out_of_date = false;
+    data.dirty_rect = {};
+  };
+  invalidate(m_efb_color_cache);
+  invalidate(m_efb_depth_cache);
+}
+
+void FramebufferManager::FlagPeekCacheAsOutOfDate(const MathUtil::Rectangle<int>& rc, bool color,
+                                                  bool depth)
+{
+  // The tiles are indexed the way PeekEFBColor/PeekEFBDepth look them up, so flip the rectangle
+  // for backends with a lower-left origin.
+  MathUtil::Rectangle<int> tile_rc = rc;
+  tile_rc.ClampUL(0, 0, EFB_WIDTH, EFB_HEIGHT);
+  if (g_backend_info.bUsesLowerLeftOrigin)
   {
-    if (m_efb_depth_cache.has_active_tiles)
-    {
-      for (u32 i = 0; i < m_efb_depth_cache.tiles.size(); i++)
-      {
-        m_efb_depth_cache.tiles[i].present = false;
-      }
+    tile_rc.top = EFB_HEIGHT - rc.bottom;
+    tile_rc.bottom = EFB_HEIGHT - rc.top;
+    tile_rc.ClampUL(0, 0, EFB_WIDTH, EFB_HEIGHT);
+  }
+  if (tile_rc.GetWidth() <= 0 || tile_rc.GetHeight() <= 0)
+    return;
+
+  auto flag = [&](EFBCacheData& data) {
+    if (!data.has_active_tiles)
+      return;
 
-      m_efb_depth_cache.needs_refresh = true;
+    if (!data.out_of_date)
+    {
+      data.dirty_rect = tile_rc;
+      data.out_of_date = true;
+    }
+    else
+    {
+      data.dirty_rect.left = std::min(data.dirty_rect.left, tile_rc.left);
+      data.dirty_rect.top = std::min(data.dirty_rect.top, tile_rc.top);
+      data.dirty_rect.right = std::max(data.dirty_rect.right, tile_rc.right);
+      data.dirty_rect.bottom = std::max(data.dirty_rect.bottom, tile_rc.bottom);
     }
+  };
+  if (color)
+    flag(m_efb_color_cache);
+  if (depth)
+    flag(m_efb_depth_cache);
 
-    m_efb_depth_cache.has_active_tiles = false;
-    m_efb_depth_cache.out_of_date = false;
-  }
+  // Not forced, so that only the tiles in the dirty rectangle are dropped.
+  if (!g_ActiveConfig.bEFBAccessDeferInvalidation)
+    InvalidatePeekCache(false);
 }
 
 void FramebufferManager::FlagPeekCacheAsOutOfDate()
 {
-  if (m_efb_color_cache.has_active_tiles)
-    m_efb_color_cache.out_of_date = true;
-  if (m_efb_depth_cache.has_active_tiles)
-    m_efb_depth_cache.out_of_date = true;
-
-  if (!g_ActiveConfig.bEFBAccessDeferInvalidation)
-    InvalidatePeekCache();
+  FlagPeekCacheAsOutOfDate(MathUtil::Rectangle<int>(0, 0, EFB_WIDTH, EFB_HEIGHT), true, true);
 }
 
 void FramebufferManager::EndOfFrame()
@@ -805,8 +847,8 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async
   if (GetEFBScale() != 1 || force_intermediate_copy)
   {
     // Downsample from internal resolution to 1x.
-    // TODO: This won't produce correct results at IRs above 2x. More samples are required.
-    // This is the same issue as with EFB copies.
+    // TODO: This won't produce correct results at IRs above 2x. More samples are required, like
+    // the box filter of EFB copies to VRAM.
     g_gfx->BeginUtilityDrawing();
     src_texture->FinishedRendering();
 
@@ -860,7 +902,7 @@ void FramebufferManager::ClearEFB(const MathUtil::Rectangle<int>& rc, bool color
                                   PixelFormat pixel_format)
 {
   FlushEFBPokes();
-  FlagPeekCacheAsOutOfDate();
+  FlagPeekCacheAsOutOfDate(rc, color_enable || alpha_enable, z_enable);
 
   // Native -> EFB coordinates
   MathUtil::Rectangle<int> target_rc = ConvertEFBRectangle(rc);
@@ -17,6 +17,7 @@
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/TextureConfig.h"
+#include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoEvents.h"
 
 class NativeVertexFormat;
@@ -120,6 +121,8 @@ public:
   void SetEFBCacheTileSize(u32 size);
   void InvalidatePeekCache(bool forced = true);
   void RefreshPeekCache();
+  // Marks the tiles in rc (native EFB coordinates) as stale, for the caches which were written.
+  void FlagPeekCacheAsOutOfDate(const MathUtil::Rectangle<int>& rc, bool color, bool depth);
   void FlagPeekCacheAsOutOfDate();
   void EndOfFrame();
 
@@ -128,6 +131,9 @@ public:
   void PokeEFBDepth(u32 x, u32 y, float depth);
   void FlushEFBPokes();
 
+  void SetEFBScissorRect(const MathUtil::Rectangle<int>& rc) { m_efb_scissor_rect = rc; }
+  const MathUtil::Rectangle<int>& GetEFBScissorRect() const { return m_efb_scissor_rect; }
+
   // Save state load/save.
   void DoState(PointerWrap& p);
 
@@ -158,6 +164,8 @@ protected:
     bool has_active_tiles;
     bool needs_refresh;
     bool needs_flush;
+    // Area drawn to since the last invalidation, in the coordinates of the tiles.
+    MathUtil::Rectangle<int> dirty_rect;
   };
 
   bool CreateEFBFramebuffer(int efb_scale);
@@ -226,6 +234,8 @@ protected:
   u32 m_efb_cache_tile_row_stride = 1;
   EFBCacheData m_efb_color_cache = {};
   EFBCacheData m_efb_depth_cache = {};
+  // The native scissor rectangle of the current draws, outside of which the EFB isn't touched.
+  MathUtil::Rectangle<int> m_efb_scissor_rect{0, 0, EFB_WIDTH, EFB_HEIGHT};
 
   // EFB clear pipelines
   // Indexed by [color_write_enabled][alpha_write_enabled][depth_write_enabled]
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <xxh3.h>
+
 #include "VideoCommon/GeometryShaderGen.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/PixelShaderGen.h"
@@ -44,6 +46,45 @@ struct GXPipelineUid
     return std::memcmp(this, &rhs, sizeof(*this)) == 0;
   }
 };
+// Hash of a GXPipelineUid, kept as the hashes of its parts so that it can be updated when only
+// some of them change, instead of hashing the whole UID again.
+struct GXPipelineUidHash
+{
+  u64 vertex_format = 0;
+  u64 vs_uid = 0;
+  u64 gs_uid = 0;
+  u64 ps_uid = 0;
+  u32 rasterization_state = 0;
+  u32 depth_state = 0;
+  u32 blending_state = 0;
+  u32 padding = 0;
+
+  void SetVertexFormat(const NativeVertexFormat* format)
+  {
+    vertex_format = static_cast<u64>(reinterpret_cast<uintptr_t>(format));
+  }
+  template <typename Uid>
+  static u64 HashShaderUid(const Uid& uid)
+  {
+    return XXH3_64bits(uid.GetUidDataRaw(), uid.GetUidDataSize());
+  }
+  void SetVertexShader(const VertexShaderUid& uid) { vs_uid = HashShaderUid(uid); }
+  void SetGeometryShader(const GeometryShaderUid& uid) { gs_uid = HashShaderUid(uid); }
+  void SetPixelShader(const PixelShaderUid& uid) { ps_uid = HashShaderUid(uid); }
+
+  explicit GXPipelineUidHash(const GXPipelineUid& uid)
+      : rasterization_state(uid.rasterization_state.hex), depth_state(uid.depth_state.hex),
+        blending_state(uid.blending_state.hex)
+  {
+    SetVertexFormat(uid.vertex_format);
+    SetVertexShader(uid.vs_uid);
+    SetGeometryShader(uid.gs_uid);
+    SetPixelShader(uid.ps_uid);
+  }
+
+  u64 Get() const { return XXH3_64bits(this, sizeof(*this)); }
+};
+
 struct GXUberPipelineUid
 {
   const NativeVertexFormat* vertex_format;
@@ -0,0 +1,80 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModAction.h"
+
+// The actions of every target of one kind, sorted by the hash of the target's key. Most lookups
+// don't match any target, so a bitset indexed by the hash rejects those with a single test before
+// the table is searched.
+template <typename Key>
+class GraphicsModActionTable
+{
+public:
+  void Add(u64 hash, const Key& key, GraphicsModAction* action)
+  {
+    m_filter.set(hash % FILTER_SIZE);
+
+    auto it = LowerBound(hash);
+    for (; it != m_entries.end() && it->hash == hash; ++it)
+    {
+      if (it->key == key)
+      {
+        it->actions.push_back(action);
+        return;
+      }
+    }
+
+    m_entries.insert(it, Entry{hash, key, {action}});
+  }
+
+  // Returns nullptr if no target matches.
+  template <typename KeyView>
+  const std::vector<GraphicsModAction*>* Find(u64 hash, const KeyView& key) const
+  {
+    if (!m_filter.test(hash % FILTER_SIZE))
+      return nullptr;
+
+    for (auto it = LowerBound(hash); it != m_entries.end() && it->hash == hash; ++it)
+    {
+      if (it->key == key)
+        return &it->actions;
+    }
+
+    return nullptr;
+  }
+
+  bool Empty() const { return m_entries.empty(); }
+
+  void Clear()
+  {
+    m_filter.reset();
+    m_entries.clear();
+  }
+
+private:
+  static constexpr size_t FILTER_SIZE = 4096;
+
+  struct Entry
+  {
+    u64 hash;
+    Key key;
+    std::vector<GraphicsModAction*> actions;
+  };
+
+  auto LowerBound(u64 hash) { return std::ranges::lower_bound(m_entries, hash, {}, &Entry::hash); }
+  auto LowerBound(u64 hash) const
+  {
+    return std::ranges::lower_bound(m_entries, hash, {}, &Entry::hash);
+  }
+
+  std::bitset<FILTER_SIZE> m_filter;
+  std::vector<Entry> m_entries;
+};
@@ -7,6 +7,8 @@
 #include <string_view>
 #include <variant>
 
+#include <xxhash.h>
+
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "Common/VariantUtil.h"
@@ -102,86 +104,72 @@ bool GraphicsModManager::Initialize()
   return true;
 }
 
+u64 GraphicsModManager::HashTextureName(std::string_view texture_name)
+{
+  return XXH3_64bits(texture_name.data(), texture_name.size());
+}
+
 const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetProjectionActions(ProjectionType projection_type) const
+GraphicsModManager::FindActions(const TextureActionTable& table, std::string_view texture_name)
 {
-  if (const auto it = m_projection_target_to_actions.find(projection_type);
-      it != m_projection_target_to_actions.end())
-  {
-    return it->second;
-  }
+  // Skip hashing the name when there is nothing to find.
+  if (table.Empty())
+    return m_default;
+
+  const auto* actions = table.Find(HashTextureName(texture_name), texture_name);
+  return actions ? *actions : m_default;
+}
 
-  return m_default;
+const std::vector<GraphicsModAction*>& GraphicsModManager::FindActions(const FBActionTable& table,
+                                                                       const FBInfo& fb_info)
+{
+  if (table.Empty())
+    return m_default;
+
+  const auto* actions = table.Find(fb_info.CalculateHash(), fb_info);
+  return actions ? *actions : m_default;
+}
+
+const std::vector<GraphicsModAction*>&
+GraphicsModManager::GetProjectionActions(ProjectionType projection_type) const
+{
+  return m_projection_target_to_actions[static_cast<u32>(projection_type)];
 }
 
 const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
                                                 const std::string& texture_name) const
 {
-  const auto lookup = fmt::format("{}_{}", texture_name, static_cast<int>(projection_type));
-  if (const auto it = m_projection_texture_target_to_actions.find(lookup);
-      it != m_projection_texture_target_to_actions.end())
-  {
-    return it->second;
-  }
-
-  return m_default;
+  return FindActions(m_projection_texture_target_to_actions[static_cast<u32>(projection_type)],
+                     texture_name);
 }
 
 const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetDrawStartedActions(const std::string& texture_name) const
 {
-  if (const auto it = m_draw_started_target_to_actions.find(texture_name);
-      it != m_draw_started_target_to_actions.end())
-  {
-    return it->second;
-  }
-
-  return m_default;
+  return FindActions(m_draw_started_target_to_actions, texture_name);
 }
 
 const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetTextureLoadActions(const std::string& texture_name) const
 {
-  if (const auto it = m_load_texture_target_to_actions.find(texture_name);
-      it != m_load_texture_target_to_actions.end())
-  {
-    return it->second;
-  }
-
-  return m_default;
+  return FindActions(m_load_texture_target_to_actions, texture_name);
 }
 
 const std::vector<GraphicsModAction*>&
 GraphicsModManager::GetTextureCreateActions(const std::string& texture_name) const
 {
-  if (const auto it = m_create_texture_target_to_actions.find(texture_name);
-      it != m_create_texture_target_to_actions.end())
-  {
-    return it->second;
-  }
-
-  return m_default;
+  return FindActions(m_create_texture_target_to_actions, texture_name);
 }
 
 const std::vector<GraphicsModAction*>& GraphicsModManager::GetEFBActions(const FBInfo& efb) const
 {
-  if (const auto it = m_efb_target_to_actions.find(efb); it != m_efb_target_to_actions.end())
-  {
-    return it->second;
-  }
-
-  return m_default;
+  return FindActions(m_efb_target_to_actions, efb);
 }
 
 const std::vector<GraphicsModAction*>& GraphicsModManager::GetXFBActions(const FBInfo& xfb) const
 {
-  if (const auto it = m_efb_target_to_actions.find(xfb); it != m_efb_target_to_actions.end())
-  {
-    return it->second;
-  }
-
-  return m_default;
+  return FindActions(m_xfb_target_to_actions, xfb);
 }
 
 void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
@@ -260,43 +248,48 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
         std::visit(
             overloaded{
                 [&](const DrawStartedTextureTarget& the_target) {
-                  m_draw_started_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  const auto& name = the_target.m_texture_info_string;
+                  m_draw_started_target_to_actions.Add(HashTextureName(name), name,
+                                                       m_actions.back().get());
                 },
                 [&](const LoadTextureTarget& the_target) {
-                  m_load_texture_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  const auto& name = the_target.m_texture_info_string;
+                  m_load_texture_target_to_actions.Add(HashTextureName(name), name,
+                                                       m_actions.back().get());
                 },
                 [&](const CreateTextureTarget& the_target) {
-                  m_create_texture_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  const auto& name = the_target.m_texture_info_string;
+                  m_create_texture_target_to_actions.Add(HashTextureName(name), name,
+                                                         m_actions.back().get());
                 },
                 [&](const EFBTarget& the_target) {
                   FBInfo info;
                   info.m_height = the_target.m_height;
                   info.m_width = the_target.m_width;
                   info.m_texture_format = the_target.m_texture_format;
-                  m_efb_target_to_actions[info].push_back(m_actions.back().get());
+                  m_efb_target_to_actions.Add(info.CalculateHash(), info, m_actions.back().get());
                 },
                 [&](const XFBTarget& the_target) {
                   FBInfo info;
                   info.m_height = the_target.m_height;
                   info.m_width = the_target.m_width;
                   info.m_texture_format = the_target.m_texture_format;
-                  m_xfb_target_to_actions[info].push_back(m_actions.back().get());
+                  m_xfb_target_to_actions.Add(info.CalculateHash(), info, m_actions.back().get());
                 },
                 [&](const ProjectionTarget& the_target) {
+                  const u32 type = static_cast<u32>(the_target.m_projection_type);
+                  if (type >= NUM_PROJECTION_TYPES)
+                    return;
+
                   if (the_target.m_texture_info_string)
                   {
-                    const auto lookup = fmt::format("{}_{}", *the_target.m_texture_info_string,
-                                                    static_cast<int>(the_target.m_projection_type));
-                    m_projection_texture_target_to_actions[lookup].push_back(
-                        m_actions.back().get());
+                    const auto& name = *the_target.m_texture_info_string;
+                    m_projection_texture_target_to_actions[type].Add(HashTextureName(name), name,
+                                                                     m_actions.back().get());
                   }
                   else
                   {
-                    m_projection_target_to_actions[the_target.m_projection_type].push_back(
-                        m_actions.back().get());
+                    m_projection_target_to_actions[type].push_back(m_actions.back().get());
                   }
                 },
             },
@@ -359,11 +352,13 @@ void GraphicsModManager::Reset()
 {
   m_actions.clear();
   m_groups.clear();
-  m_projection_target_to_actions.clear();
-  m_projection_texture_target_to_actions.clear();
-  m_draw_started_target_to_actions.clear();
-  m_load_texture_target_to_actions.clear();
-  m_create_texture_target_to_actions.clear();
-  m_efb_target_to_actions.clear();
-  m_xfb_target_to_actions.clear();
+  for (auto& actions : m_projection_target_to_actions)
+    actions.clear();
+  for (auto& table : m_projection_texture_target_to_actions)
+    table.Clear();
+  m_draw_started_target_to_actions.Clear();
+  m_load_texture_target_to_actions.Clear();
+  m_create_texture_target_to_actions.Clear();
+  m_efb_target_to_actions.Clear();
+  m_xfb_target_to_actions.Clear();
 }
@@ -3,15 +3,18 @@
 
 #pragma once
 
+#include <array>
 #include <list>
 #include <memory>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
+#include "Common/CommonTypes.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModAction.h"
+#include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionTable.h"
 #include "VideoCommon/TextureInfo.h"
 #include "VideoCommon/VideoEvents.h"
 #include "VideoCommon/XFMemory.h"
@@ -43,18 +46,26 @@ private:
 
   class DecoratedAction;
 
+  using TextureActionTable = GraphicsModActionTable<std::string>;
+  using FBActionTable = GraphicsModActionTable<FBInfo>;
+
+  static u64 HashTextureName(std::string_view texture_name);
+  static const std::vector<GraphicsModAction*>& FindActions(const TextureActionTable& table,
+                                                            std::string_view texture_name);
+  static const std::vector<GraphicsModAction*>& FindActions(const FBActionTable& table,
+                                                            const FBInfo& fb_info);
+
+  static constexpr size_t NUM_PROJECTION_TYPES = 2;
+
   static inline const std::vector<GraphicsModAction*> m_default = {};
   std::list<std::unique_ptr<GraphicsModAction>> m_actions;
-  std::unordered_map<ProjectionType, std::vector<GraphicsModAction*>>
-      m_projection_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>>
-      m_projection_texture_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>> m_draw_started_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>> m_load_texture_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>>
-      m_create_texture_target_to_actions;
-  std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_efb_target_to_actions;
-  std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_xfb_target_to_actions;
+  std::array<std::vector<GraphicsModAction*>, NUM_PROJECTION_TYPES> m_projection_target_to_actions;
+  std::array<TextureActionTable, NUM_PROJECTION_TYPES> m_projection_texture_target_to_actions;
+  TextureActionTable m_draw_started_target_to_actions;
+  TextureActionTable m_load_texture_target_to_actions;
+  TextureActionTable m_create_texture_target_to_actions;
+  FBActionTable m_efb_target_to_actions;
+  FBActionTable m_xfb_target_to_actions;
 
   std::unordered_set<std::string> m_groups;
 
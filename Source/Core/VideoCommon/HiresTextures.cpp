@@ -4,10 +4,14 @@
 #include "VideoCommon/HiresTextures.h"
 
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <thread>
 #include <unordered_map>
 #include <utility>
@@ -26,6 +30,8 @@
 #include "Core/System.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
+#include "VideoCommon/Assets/TexturePack.h"
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/Resources/CustomResourceManager.h"
 #include "VideoCommon/VideoConfig.h"
@@ -36,9 +42,122 @@ static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_hires_te
 static std::unordered_map<std::string, bool> s_hires_texture_id_to_arbmipmap;
 
 static auto s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
+static auto s_pack_library = std::make_shared<VideoCommon::TexturePackAssetLibrary>();
+
+static std::mutex s_mounted_resource_packs_lock;
+static std::vector<std::string> s_mounted_resource_packs;
 
 namespace
 {
+constexpr std::string_view TEXTURE_INDEX_HEADER = "Dolphin hires texture index 1";
+
+std::string GetTextureIndexPath(const std::string& texture_directory)
+{
+  return fmt::format("{}HiresTextures" DIR_SEP "{:016x}.txt", File::GetUserPath(D_CACHE_IDX),
+                     XXH3_64bits(texture_directory.data(), texture_directory.size()));
+}
+
+std::optional<s64> GetDirectoryModificationTime(const std::string& path)
+{
+  std::error_code error;
+  const auto time = std::filesystem::last_write_time(StringToPath(path), error);
+  if (error)
+    return std::nullopt;
+  return static_cast<s64>(time.time_since_epoch().count());
+}
+
+// Scanning a large texture pack takes long, so the textures found in a directory are kept in an
+// index in the cache directory. It also lists every directory in there with its modification
+// time. Adding, removing or renaming a file changes the time of its directory, so the index is
+// still valid as long as none of them changed, which only takes a look at the directories.
+std::optional<std::vector<std::string>> ReadTextureIndex(const std::string& texture_directory)
+{
+  std::ifstream file;
+  File::OpenFStream(file, GetTextureIndexPath(texture_directory), std::ios_base::in);
+
+  std::string line;
+  if (!std::getline(file, line) || line != TEXTURE_INDEX_HEADER)
+    return std::nullopt;
+  if (!std::getline(file, line) || line != texture_directory)
+    return std::nullopt;
+
+  std::vector<std::string> texture_paths;
+  while (std::getline(file, line))
+  {
+    if (line.starts_with("D "))
+    {
+      const size_t separator = line.find(' ', 2);
+      s64 time;
+      if (separator == std::string::npos || !TryParse(line.substr(2, separator - 2), &time) ||
+          GetDirectoryModificationTime(line.substr(separator + 1)) != time)
+      {
+        return std::nullopt;
+      }
+    }
+    else if (line.starts_with("F "))
+    {
+      texture_paths.push_back(line.substr(2));
+    }
+    else
+    {
+      return std::nullopt;
+    }
+  }
+
+  return texture_paths;
+}
+
+void WriteTextureIndex(const std::string& texture_directory,
+                       const std::vector<std::string>& texture_paths)
+{
+  std::vector<std::pair<std::string, s64>> directories;
+  const auto add_directory = [&directories](std::string path) {
+    const std::optional<s64> time = GetDirectoryModificationTime(path);
+    if (time)
+      directories.emplace_back(std::move(path), *time);
+    return time.has_value();
+  };
+
+  if (!add_directory(texture_directory))
+    return;
+
+  std::error_code error;
+  for (auto it = std::filesystem::recursive_directory_iterator(StringToPath(texture_directory),
+                                                               error);
+       !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+  {
+    if (it->is_directory(error) && !add_directory(PathToString(it->path())))
+      return;
+  }
+  if (error)
+    return;
+
+  const std::string index_path = GetTextureIndexPath(texture_directory);
+  File::CreateFullPath(index_path);
+
+  std::ofstream file;
+  File::OpenFStream(file, index_path, std::ios_base::out | std::ios_base::trunc);
+  file << TEXTURE_INDEX_HEADER << '\n' << texture_directory << '\n';
+  for (const auto& [path, time] : directories)
+    file << "D " << time << ' ' << path << '\n';
+  for (const std::string& path : texture_paths)
+    file << "F " << path << '\n';
+
+  if (!file)
+    WARN_LOG_FMT(VIDEO, "Failed to write the custom texture index '{}'", index_path);
+}
+
+std::vector<std::string> GetTexturePaths(const std::string& texture_directory)
+{
+  if (std::optional<std::vector<std::string>> texture_paths = ReadTextureIndex(texture_directory))
+    return std::move(*texture_paths);
+
+  const std::vector<std::string> texture_paths =
+      Common::DoFileSearch({texture_directory}, {".png", ".dds"}, /*recursive*/ true);
+  WriteTextureIndex(texture_directory, texture_paths);
+  return texture_paths;
+}
+
 std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
 {
   if (s_hires_texture_id_to_arbmipmap.empty())
@@ -75,6 +194,33 @@ std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
 
   return {"", false};
 }
+
+void AddPackedTextures(const std::shared_ptr<VideoCommon::TexturePack>& pack)
+{
+  for (const auto& entry : pack->GetEntries())
+  {
+    std::string name(pack->GetName(entry));
+    if (!name.starts_with(s_format_prefix))
+      continue;
+
+    const size_t arb_index = name.rfind("_arb");
+    const bool has_arbitrary_mipmaps = arb_index != std::string::npos;
+    if (has_arbitrary_mipmaps)
+      name.erase(arb_index, 4);
+
+    if (!s_hires_texture_id_to_arbmipmap.try_emplace(name, has_arbitrary_mipmaps).second)
+      continue;
+
+    s_pack_library->AddTexture(name, pack, &entry);
+
+    if (g_ActiveConfig.bCacheHiresTextures)
+    {
+      auto hires_texture = std::make_shared<HiresTexture>(has_arbitrary_mipmaps, std::move(name));
+      static_cast<void>(hires_texture->LoadTexture());
+      s_hires_texture_cache.try_emplace(hires_texture->GetId(), hires_texture);
+    }
+  }
+}
 }  // namespace
 
 void HiresTexture::Shutdown()
@@ -93,15 +239,13 @@ void HiresTexture::Update()
   const std::string& game_id = SConfig::GetInstance().GetGameID();
   const std::set<std::string> texture_directories =
       GetTextureDirectoriesWithGameId(File::GetUserPath(D_HIRESTEXTURES_IDX), game_id);
-  const std::vector<std::string> extensions{".png", ".dds"};
 
   for (const auto& texture_directory : texture_directories)
   {
     // Watch this directory for any texture reloads
     s_file_library->Watch(texture_directory);
 
-    const auto texture_paths =
-        Common::DoFileSearch({texture_directory}, extensions, /*recursive*/ true);
+    const auto texture_paths = GetTexturePaths(texture_directory);
 
     bool failed_insert = false;
     for (auto& path : texture_paths)
@@ -145,6 +289,40 @@ void HiresTexture::Update()
       ERROR_LOG_FMT(VIDEO, "One or more textures at path '{}' were already inserted",
                     texture_directory);
     }
+
+    // Loose files take precedence over packed ones, so that single textures of a pack can be
+    // replaced without rebuilding it.
+    const auto pack_paths = Common::DoFileSearch(
+        {texture_directory}, {std::string(VideoCommon::TexturePack::FILE_EXTENSION)},
+        /*recursive*/ false);
+    for (const auto& pack_path : pack_paths)
+    {
+      std::shared_ptr<VideoCommon::TexturePack> pack = VideoCommon::TexturePack::Open(pack_path);
+      if (pack)
+        AddPackedTextures(pack);
+    }
+  }
+
+  // Resource packs that are mounted rather than extracted come last, as their extracted textures
+  // would have.
+  std::vector<std::string> mounted_resource_packs;
+  {
+    std::lock_guard lk(s_mounted_resource_packs_lock);
+    mounted_resource_packs = s_mounted_resource_packs;
+  }
+  for (const auto& pack_path : mounted_resource_packs)
+  {
+    // Like GetTextureDirectoriesWithGameId, but the gameid .txt files of other directories aren't
+    // looked for.
+    std::shared_ptr<VideoCommon::TexturePack> pack =
+        VideoCommon::TexturePack::OpenZip(pack_path, {fmt::format("textures/{}/", game_id)});
+    if (pack && pack->GetEntries().empty())
+    {
+      pack = VideoCommon::TexturePack::OpenZip(
+          pack_path, {fmt::format("textures/{}/", game_id.substr(0, 3))});
+    }
+    if (pack)
+      AddPackedTextures(pack);
   }
 
   if (g_ActiveConfig.bCacheHiresTextures)
@@ -159,11 +337,18 @@ void HiresTexture::Update()
   }
 }
 
+void HiresTexture::SetMountedResourcePacks(std::vector<std::string> paths)
+{
+  std::lock_guard lk(s_mounted_resource_packs_lock);
+  s_mounted_resource_packs = std::move(paths);
+}
+
 void HiresTexture::Clear()
 {
   s_hires_texture_cache.clear();
   s_hires_texture_id_to_arbmipmap.clear();
   s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
+  s_pack_library = std::make_shared<VideoCommon::TexturePackAssetLibrary>();
 }
 
 std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_info)
@@ -196,6 +381,8 @@ VideoCommon::TextureDataResource* HiresTexture::LoadTexture() const
 {
   auto& system = Core::System::GetInstance();
   auto& custom_resource_manager = system.GetCustomResourceManager();
+  if (s_pack_library->HasTexture(m_id))
+    return custom_resource_manager.GetTextureDataFromAsset(m_id, s_pack_library);
   return custom_resource_manager.GetTextureDataFromAsset(m_id, s_file_library);
 }
 
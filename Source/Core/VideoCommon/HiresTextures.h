@@ -26,6 +26,10 @@ public:
   static void Update();
   static void Clear();
   static void Shutdown();
+
+  // Sets the resource packs whose textures are read from the archive instead of being extracted,
+  // highest priority first. Safe from any thread, and takes effect on the next Update.
+  static void SetMountedResourcePacks(std::vector<std::string> paths);
   static std::shared_ptr<HiresTexture> Search(const TextureInfo& texture_info);
 
   HiresTexture(bool has_arbitrary_mipmaps, std::string id);
@@ -3,21 +3,27 @@
 
 #include "VideoCommon/IndexGenerator.h"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstring>
 
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/VideoConfig.h"
 
+#ifdef _M_ARM_64
+#include <arm_neon.h>
+#endif
+
 namespace
 {
 constexpr u16 s_primitive_restart = UINT16_MAX;
 
 template <bool pr>
-u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
+constexpr u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 {
   *index_ptr++ = index1;
   *index_ptr++ = index2;
@@ -27,14 +33,142 @@ u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
   return index_ptr;
 }
 
-template <bool pr>
-u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
+/*
+ * Index patterns
+ *
+ * Most draws are small, and the indices of a primitive only depend on the vertex count and on
+ * the index of the first vertex. So the indices of the first PATTERN_PRIMITIVES primitives of
+ * each type are generated at compile time for a first index of 0, and a draw copies as many of
+ * them as it needs while adding its own first index. Apart from fans, the patterns repeat, as
+ * the next PATTERN_PRIMITIVES primitives just have their indices moved up by the vertices of the
+ * pattern.
+ */
+constexpr u32 PATTERN_PRIMITIVES = 256;
+
+template <size_t Size, typename Generator>
+constexpr std::array<u16, Size> MakePattern(Generator generator)
 {
-  for (u32 i = 2; i < num_verts; i += 3)
+  std::array<u16, Size> pattern{};
+  generator(pattern.data());
+  return pattern;
+}
+
+template <bool pr>
+constexpr auto s_list_pattern = MakePattern<PATTERN_PRIMITIVES * (pr ? 4 : 3)>([](u16* index_ptr) {
+  for (u32 i = 2; i < PATTERN_PRIMITIVES * 3; i += 3)
+    index_ptr = WriteTriangle<pr>(index_ptr, i - 2, i - 1, i);
+  return index_ptr;
+});
+
+constexpr auto s_strip_pattern = MakePattern<PATTERN_PRIMITIVES * 3>([](u16* index_ptr) {
+  bool wind = false;
+  for (u32 i = 2; i < PATTERN_PRIMITIVES + 2; ++i)
   {
-    index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - 1, index + i);
+    index_ptr = WriteTriangle<false>(index_ptr, i - 2, i - !wind, i - wind);
+    wind ^= true;
   }
   return index_ptr;
+});
+
+constexpr auto s_sequence_pattern = MakePattern<PATTERN_PRIMITIVES>([](u16* index_ptr) {
+  for (u32 i = 0; i < PATTERN_PRIMITIVES; ++i)
+    *index_ptr++ = i;
+  return index_ptr;
+});
+
+// For primitive restart, three triangles (one group) at a time, see AddFan.
+template <bool pr>
+constexpr auto s_fan_pattern = MakePattern<PATTERN_PRIMITIVES * (pr ? 6 : 3)>([](u16* index_ptr) {
+  for (u32 i = 2; i < (pr ? PATTERN_PRIMITIVES * 3 : PATTERN_PRIMITIVES) + 2; i += pr ? 3 : 1)
+  {
+    if constexpr (pr)
+    {
+      *index_ptr++ = i - 1;
+      *index_ptr++ = i + 0;
+      *index_ptr++ = 0;
+      *index_ptr++ = i + 1;
+      *index_ptr++ = i + 2;
+      *index_ptr++ = s_primitive_restart;
+    }
+    else
+    {
+      index_ptr = WriteTriangle<false>(index_ptr, 0, i - 1, i);
+    }
+  }
+  return index_ptr;
+});
+
+template <bool pr>
+constexpr auto s_quad_pattern = MakePattern<PATTERN_PRIMITIVES * (pr ? 5 : 6)>([](u16* index_ptr) {
+  for (u32 i = 3; i < PATTERN_PRIMITIVES * 4; i += 4)
+  {
+    if constexpr (pr)
+    {
+      *index_ptr++ = i - 2;
+      *index_ptr++ = i - 1;
+      *index_ptr++ = i - 3;
+      *index_ptr++ = i - 0;
+      *index_ptr++ = s_primitive_restart;
+    }
+    else
+    {
+      index_ptr = WriteTriangle<false>(index_ptr, i - 3, i - 2, i - 1);
+      index_ptr = WriteTriangle<false>(index_ptr, i - 3, i - 1, i - 0);
+    }
+  }
+  return index_ptr;
+});
+
+// Copies count indices of a pattern, adding index to all but the primitive restarts.
+u16* CopyPattern(u16* index_ptr, const u16* pattern, u32 count, u32 index)
+{
+  u32 i = 0;
+#if defined(_M_X86_64)
+  const __m128i base = _mm_set1_epi16(static_cast<s16>(index));
+  const __m128i restart = _mm_set1_epi16(-1);
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i indices = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern + i));
+    const __m128i is_restart = _mm_cmpeq_epi16(indices, restart);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr + i),
+                     _mm_or_si128(_mm_add_epi16(indices, base), is_restart));
+  }
+#elif defined(_M_ARM_64)
+  const uint16x8_t base = vdupq_n_u16(static_cast<u16>(index));
+  const uint16x8_t restart = vdupq_n_u16(s_primitive_restart);
+  for (; i + 8 <= count; i += 8)
+  {
+    const uint16x8_t indices = vld1q_u16(pattern + i);
+    const uint16x8_t is_restart = vceqq_u16(indices, restart);
+    vst1q_u16(index_ptr + i, vorrq_u16(vaddq_u16(indices, base), is_restart));
+  }
+#endif
+  for (; i < count; ++i)
+    index_ptr[i] = pattern[i] == s_primitive_restart ? s_primitive_restart : pattern[i] + index;
+  return index_ptr + count;
+}
+
+// Writes the indices of num_primitives primitives from a repeating pattern, whose primitives
+// together use pattern_vertices vertices.
+template <size_t Size>
+u16* AddFromPattern(u16* index_ptr, const std::array<u16, Size>& pattern, u32 pattern_vertices,
+                    u32 num_primitives, u32 index)
+{
+  constexpr u32 indices_per_primitive = Size / PATTERN_PRIMITIVES;
+  while (num_primitives > PATTERN_PRIMITIVES)
+  {
+    index_ptr = CopyPattern(index_ptr, pattern.data(), Size, index);
+    num_primitives -= PATTERN_PRIMITIVES;
+    index += pattern_vertices;
+  }
+  return CopyPattern(index_ptr, pattern.data(), num_primitives * indices_per_primitive, index);
+}
+
+template <bool pr>
+u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
+{
+  return AddFromPattern(index_ptr, s_list_pattern<pr>, PATTERN_PRIMITIVES * 3, num_verts / 3,
+                        index);
 }
 
 template <bool pr>
@@ -42,21 +176,14 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
   if constexpr (pr)
   {
-    for (u32 i = 0; i < num_verts; ++i)
-    {
-      *index_ptr++ = index + i;
-    }
+    index_ptr = AddFromPattern(index_ptr, s_sequence_pattern, PATTERN_PRIMITIVES, num_verts, index);
     *index_ptr++ = s_primitive_restart;
   }
-  else
+  else if (num_verts > 2)
   {
-    bool wind = false;
-    for (u32 i = 2; i < num_verts; ++i)
-    {
-      index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - !wind, index + i - wind);
-
-      wind ^= true;
-    }
+    // PATTERN_PRIMITIVES is even, so the winding of the pattern doesn't change when it repeats.
+    index_ptr =
+        AddFromPattern(index_ptr, s_strip_pattern, PATTERN_PRIMITIVES, num_verts - 2, index);
   }
   return index_ptr;
 }
@@ -85,6 +212,15 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 {
   u32 i = 2;
 
+  // Every triangle uses the first vertex, so the pattern can't be repeated.
+  if (num_verts > 2)
+  {
+    const u32 num_patterned = std::min((num_verts - 2) / (pr ? 3 : 1), PATTERN_PRIMITIVES);
+    index_ptr = CopyPattern(index_ptr, s_fan_pattern<pr>.data(), num_patterned * (pr ? 6 : 3),
+                            index);
+    i += num_patterned * (pr ? 3 : 1);
+  }
+
   if constexpr (pr)
   {
     for (; i + 3 <= num_verts; i += 3)
@@ -134,26 +270,11 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 template <bool pr>
 u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
 {
-  u32 i = 3;
-  for (; i < num_verts; i += 4)
-  {
-    if constexpr (pr)
-    {
-      *index_ptr++ = index + i - 2;
-      *index_ptr++ = index + i - 1;
-      *index_ptr++ = index + i - 3;
-      *index_ptr++ = index + i - 0;
-      *index_ptr++ = s_primitive_restart;
-    }
-    else
-    {
-      index_ptr = WriteTriangle<pr>(index_ptr, index + i - 3, index + i - 2, index + i - 1);
-      index_ptr = WriteTriangle<pr>(index_ptr, index + i - 3, index + i - 1, index + i - 0);
-    }
-  }
+  index_ptr =
+      AddFromPattern(index_ptr, s_quad_pattern<pr>, PATTERN_PRIMITIVES * 4, num_verts / 4, index);
 
   // three vertices remaining, so render a triangle
-  if (i == num_verts)
+  if (num_verts % 4 == 3)
   {
     index_ptr = WriteTriangle<pr>(index_ptr, index + num_verts - 3, index + num_verts - 2,
                                   index + num_verts - 1);
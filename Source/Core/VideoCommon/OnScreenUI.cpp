@@ -33,6 +33,7 @@
 
 #include <inttypes.h>
 #include <mutex>
+#include <optional>
 
 #include <imgui.h>
 #include <implot.h>
@@ -213,7 +214,7 @@ void OnScreenUI::BeginImGuiFrameUnlocked(u32 width, u32 height)
 void OnScreenUI::DrawImGui()
 {
   ImDrawData* draw_data = ImGui::GetDrawData();
-  if (!draw_data)
+  if (!draw_data || draw_data->TotalVtxCount == 0 || draw_data->TotalIdxCount == 0)
     return;
 
   g_gfx->SetViewport(0.0f, 0.0f, static_cast<float>(m_backbuffer_width),
@@ -232,33 +233,79 @@ void OnScreenUI::DrawImGui()
   g_gfx->SetSamplerState(0, RenderState::GetPointSamplerState());
   g_vertex_manager->UploadUtilityUniforms(&ubo, sizeof(ubo));
 
-  for (int i = 0; i < draw_data->CmdListsCount; i++)
+  // Upload every draw list at once, unless they don't fit in the buffers together. The indices of
+  // each list stay relative to its own vertices, so each list keeps its own base vertex.
+  const bool upload_at_once =
+      draw_data->TotalVtxCount * sizeof(ImDrawVert) <= VertexManagerBase::MAXVBUFFERSIZE &&
+      static_cast<u32>(draw_data->TotalIdxCount) <= VertexManagerBase::MAXIBUFFERSIZE;
+  u32 base_vertex = 0;
+  u32 base_index = 0;
+  if (upload_at_once)
+  {
+    m_imgui_vertices.clear();
+    m_imgui_indices.clear();
+    for (const ImDrawList* cmdlist : draw_data->CmdLists)
+    {
+      const auto* vertices = reinterpret_cast<const u8*>(cmdlist->VtxBuffer.Data);
+      m_imgui_vertices.insert(m_imgui_vertices.end(), vertices,
+                              vertices + cmdlist->VtxBuffer.size_in_bytes());
+      m_imgui_indices.insert(m_imgui_indices.end(), cmdlist->IdxBuffer.begin(),
+                             cmdlist->IdxBuffer.end());
+    }
+    g_vertex_manager->UploadUtilityVertices(
+        m_imgui_vertices.data(), sizeof(ImDrawVert), draw_data->TotalVtxCount,
+        m_imgui_indices.data(), draw_data->TotalIdxCount, &base_vertex, &base_index);
+  }
+
+  // Consecutive commands often share their clip rectangle and texture.
+  std::optional<MathUtil::Rectangle<int>> current_clip_rect;
+  const AbstractTexture* current_texture = nullptr;
+  for (const ImDrawList* cmdlist : draw_data->CmdLists)
   {
-    const ImDrawList* cmdlist = draw_data->CmdLists[i];
     if (cmdlist->VtxBuffer.empty() || cmdlist->IdxBuffer.empty())
-      return;
+      continue;
 
-    u32 base_vertex, base_index;
-    g_vertex_manager->UploadUtilityVertices(cmdlist->VtxBuffer.Data, sizeof(ImDrawVert),
-                                            cmdlist->VtxBuffer.Size, cmdlist->IdxBuffer.Data,
-                                            cmdlist->IdxBuffer.Size, &base_vertex, &base_index);
+    if (!upload_at_once)
+    {
+      g_vertex_manager->UploadUtilityVertices(cmdlist->VtxBuffer.Data, sizeof(ImDrawVert),
+                                              cmdlist->VtxBuffer.Size, cmdlist->IdxBuffer.Data,
+                                              cmdlist->IdxBuffer.Size, &base_vertex, &base_index);
+    }
 
+    u32 index = base_index;
     for (const ImDrawCmd& cmd : cmdlist->CmdBuffer)
     {
       if (cmd.UserCallback)
       {
         cmd.UserCallback(cmdlist, &cmd);
+        current_clip_rect.reset();
+        current_texture = nullptr;
         continue;
       }
 
-      g_gfx->SetScissorRect(g_gfx->ConvertFramebufferRectangle(
-          MathUtil::Rectangle<int>(
-              static_cast<int>(cmd.ClipRect.x), static_cast<int>(cmd.ClipRect.y),
-              static_cast<int>(cmd.ClipRect.z), static_cast<int>(cmd.ClipRect.w)),
-          g_gfx->GetCurrentFramebuffer()));
-      g_gfx->SetTexture(0, reinterpret_cast<const AbstractTexture*>(cmd.GetTexID()));
-      g_gfx->DrawIndexed(base_index, cmd.ElemCount, base_vertex);
-      base_index += cmd.ElemCount;
+      const MathUtil::Rectangle<int> clip_rect(
+          static_cast<int>(cmd.ClipRect.x), static_cast<int>(cmd.ClipRect.y),
+          static_cast<int>(cmd.ClipRect.z), static_cast<int>(cmd.ClipRect.w));
+      if (clip_rect != current_clip_rect)
+      {
+        g_gfx->SetScissorRect(
+            g_gfx->ConvertFramebufferRectangle(clip_rect, g_gfx->GetCurrentFramebuffer()));
+        current_clip_rect = clip_rect;
+      }
+      const auto* texture = reinterpret_cast<const AbstractTexture*>(cmd.GetTexID());
+      if (texture != current_texture)
+      {
+        g_gfx->SetTexture(0, texture);
+        current_texture = texture;
+      }
+      g_gfx->DrawIndexed(index, cmd.ElemCount, base_vertex);
+      index += cmd.ElemCount;
+    }
+
+    if (upload_at_once)
+    {
+      base_vertex += cmdlist->VtxBuffer.Size;
+      base_index += cmdlist->IdxBuffer.Size;
     }
   }
 
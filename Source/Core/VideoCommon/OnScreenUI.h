@@ -70,6 +70,9 @@ private:
   std::vector<std::unique_ptr<AbstractTexture>> m_imgui_textures;
   std::unique_ptr<AbstractPipeline> m_imgui_pipeline;
   std::map<u32, int> m_dolphin_to_imgui_map;
+  // The draw lists of a frame, put together so that they can be uploaded at once.
+  std::vector<u8> m_imgui_vertices;
+  std::vector<u16> m_imgui_indices;
   std::mutex m_imgui_mutex;
   u64 m_imgui_last_frame_time = 0;
 
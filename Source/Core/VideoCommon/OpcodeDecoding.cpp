@@ -15,6 +15,7 @@
 #include "VideoCommon/OpcodeDecoding.h"
 
 #include "Common/Assert.h"
+#include "Common/FrameProfiler.h"
 #include "Common/Logging/Log.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
 #include "Core/HW/Memmap.h"
@@ -34,8 +35,9 @@
 namespace OpcodeDecoder
 {
 bool g_record_fifo_data = false;
+bool g_skip_gx_processing = false;
 
-template <bool is_preprocess>
+template <bool is_preprocess, bool skip_gx = false>
 class RunCallback final : public Callback
 {
 public:
@@ -43,7 +45,7 @@ public:
   {
     m_cycles += 18 + 6 * count;
 
-    if constexpr (!is_preprocess)
+    if constexpr (!is_preprocess && !skip_gx)
     {
       LoadXFReg(address, count, data);
 
@@ -109,6 +111,12 @@ public:
     {
       LoadBPRegPreprocess(command, value, m_cycles);
     }
+    else if constexpr (skip_gx)
+    {
+      // With the deterministic GPU thread, the preprocessing already did this.
+      if (!Core::System::GetInstance().GetFifo().UseDeterministicGPUThread())
+        LoadBPRegPreprocess(command, value, m_cycles);
+    }
     else
     {
       LoadBPReg(command, value, m_cycles);
@@ -120,20 +128,34 @@ public:
     m_cycles += 6;
 
     if constexpr (is_preprocess)
+    {
       PreprocessIndexedXF(array, index, address, size);
+    }
+    else if constexpr (skip_gx)
+    {
+      // Keep up with the data the preprocessing pushed.
+      auto& fifo = Core::System::GetInstance().GetFifo();
+      if (fifo.UseDeterministicGPUThread())
+        fifo.PopFifoAuxBuffer(size * sizeof(u32));
+    }
     else
+    {
       LoadIndexedXF(array, index, address, size);
+    }
   }
   OPCODE_CALLBACK(void OnPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat,
                                           u32 vertex_size, u16 num_vertices, const u8* vertex_data))
   {
-    // load vertices
-    const u32 size = vertex_size * num_vertices;
+    if constexpr (!skip_gx)
+    {
+      // load vertices
+      const u32 size = vertex_size * num_vertices;
 
-    const u32 bytes =
-        VertexLoaderManager::RunVertices<is_preprocess>(vat, primitive, num_vertices, vertex_data);
+      const u32 bytes = VertexLoaderManager::RunVertices<is_preprocess>(vat, primitive,
+                                                                        num_vertices, vertex_data);
 
-    ASSERT(bytes == size);
+      ASSERT(bytes == size);
+    }
 
     // 4 GPU ticks per vertex, 3 CPU ticks per GPU tick
     m_cycles += num_vertices * 4 * 3 + 6;
@@ -257,10 +279,10 @@ public:
   bool m_in_display_list = false;
 };
 
-template <bool is_preprocess>
-u8* RunFifo(DataReader src, u32* cycles)
+template <bool is_preprocess, bool skip_gx>
+static u8* RunFifoWithCallback(DataReader src, u32* cycles)
 {
-  using CallbackT = RunCallback<is_preprocess>;
+  using CallbackT = RunCallback<is_preprocess, skip_gx>;
   auto callback = CallbackT{};
   u32 size = Run(src.GetPointer(), static_cast<u32>(src.size()), callback);
 
@@ -271,6 +293,22 @@ u8* RunFifo(DataReader src, u32* cycles)
   return src.GetPointer();
 }
 
+template <bool is_preprocess>
+u8* RunFifo(DataReader src, u32* cycles)
+{
+  if constexpr (is_preprocess)
+  {
+    return RunFifoWithCallback<true, false>(src, cycles);
+  }
+  else
+  {
+    Common::FrameProfiler::Scope profiler_scope(Common::FrameProfiler::Stage::FifoDecode);
+    if (g_skip_gx_processing && !g_record_fifo_data)
+      return RunFifoWithCallback<false, true>(src, cycles);
+    return RunFifoWithCallback<false, false>(src, cycles);
+  }
+}
+
 template u8* RunFifo<true>(DataReader src, u32* cycles);
 template u8* RunFifo<false>(DataReader src, u32* cycles);
 
@@ -21,6 +21,12 @@ namespace OpcodeDecoder
 // Global flag to signal if FifoRecorder is active.
 extern bool g_record_fifo_data;
 
+// Set by the Null backend for headless runs that only need the CPU side. The FIFO is then only
+// decoded far enough to keep its position and to service PE tokens and draw done, and nothing is
+// loaded, drawn or copied. Ignored while recording the FIFO, since the recording needs the memory
+// updates of every command.
+extern bool g_skip_gx_processing;
+
 enum class Opcode
 {
   GX_NOP = 0x00,
@@ -5,6 +5,8 @@
 
 #include <memory>
 
+#include "Common/Assert.h"
+
 #include "VideoCommon/VideoConfig.h"
 
 std::unique_ptr<PerfQueryBase> g_perf_query;
@@ -13,3 +15,74 @@ bool PerfQueryBase::ShouldEmulate()
 {
   return g_ActiveConfig.bPerfQueriesEnable;
 }
+
+bool PerfQueryBase::ShouldDefer() const
+{
+  return !g_ActiveConfig.bPerfQueriesExact && SupportsDeferredResults();
+}
+
+u32 PerfQueryBase::GetDeferredQueryResult(PerfQueryType type) const
+{
+  return GetQueryResult(m_deferred_results, type);
+}
+
+u32 PerfQueryBase::GetQueryResult(const std::array<std::atomic<u32>, PQG_NUM_MEMBERS>& results,
+                                  PerfQueryType type)
+{
+  u32 result = 0;
+  if (type == PQ_ZCOMP_INPUT_ZCOMPLOC || type == PQ_ZCOMP_OUTPUT_ZCOMPLOC)
+  {
+    result = results[PQG_ZCOMP_ZCOMPLOC].load(std::memory_order_relaxed);
+  }
+  else if (type == PQ_ZCOMP_INPUT || type == PQ_ZCOMP_OUTPUT)
+  {
+    result = results[PQG_ZCOMP].load(std::memory_order_relaxed);
+  }
+  else if (type == PQ_BLEND_INPUT)
+  {
+    result = results[PQG_ZCOMP].load(std::memory_order_relaxed) +
+             results[PQG_ZCOMP_ZCOMPLOC].load(std::memory_order_relaxed);
+  }
+  else if (type == PQ_EFB_COPY_CLOCKS)
+  {
+    result = results[PQG_EFB_COPY_CLOCKS].load(std::memory_order_relaxed);
+  }
+
+  return result / 4;
+}
+
+void PerfQueryBase::AddQueryResult(PerfQueryGroup group, u32 value)
+{
+  if (m_period_pending_queries == 0)
+  {
+    m_results[group].fetch_add(value, std::memory_order_relaxed);
+    return;
+  }
+
+  m_period_results[group] += value;
+  if (--m_period_pending_queries == 0)
+    PublishPeriodResults();
+}
+
+void PerfQueryBase::EndQueryPeriod(u32 pending_queries)
+{
+  ASSERT(m_period_pending_queries == 0);
+
+  for (size_t i = 0; i < m_results.size(); ++i)
+    m_period_results[i] = m_results[i].exchange(0, std::memory_order_relaxed);
+
+  m_period_pending_queries = pending_queries;
+  if (pending_queries == 0)
+    PublishPeriodResults();
+}
+
+void PerfQueryBase::PublishPeriodResults()
+{
+  for (size_t i = 0; i < m_deferred_results.size(); ++i)
+    m_deferred_results[i].store(m_period_results[i], std::memory_order_relaxed);
+}
+
+void PerfQueryBase::ResetQueryPeriods()
+{
+  m_period_pending_queries = 0;
+}
@@ -64,9 +64,42 @@ public:
   // NOTE: Called from CPU thread
   virtual bool IsFlushed() const { return true; }
 
+  // Unless exact results are requested in the gameini configuration, backends that support it
+  // keep the queries that are still pending when the game resets the counters, and GetQueryResult
+  // is replaced by GetDeferredQueryResult. That returns the final results of the last period
+  // between two resets that has been read back completely, usually the previous frame, so reading
+  // the counters doesn't have to wait for the GPU.
+  // NOTE: Called from CPU+GPU thread
+  bool ShouldDefer() const;
+  // NOTE: Called from CPU thread
+  u32 GetDeferredQueryResult(PerfQueryType type) const;
+
 protected:
+  virtual bool SupportsDeferredResults() const { return false; }
+
+  // Called with the result of every query, in the order they were started.
+  void AddQueryResult(PerfQueryGroup group, u32 value);
+
+  // Called by ResetQuery when deferring results, with the number of queries still pending. Their
+  // results go to the period that ends here.
+  void EndQueryPeriod(u32 pending_queries);
+  // The number of queries of the last period that are still pending. If a period ends before the
+  // one before it has been read back, the backend has to wait for these first.
+  u32 GetPendingPeriodQueryCount() const { return m_period_pending_queries; }
+  // Forgets about the periods, for when the pending queries are dropped.
+  void ResetQueryPeriods();
+
   std::atomic<u32> m_query_count;
   std::array<std::atomic<u32>, PQG_NUM_MEMBERS> m_results;
+
+private:
+  static u32 GetQueryResult(const std::array<std::atomic<u32>, PQG_NUM_MEMBERS>& results,
+                            PerfQueryType type);
+  void PublishPeriodResults();
+
+  u32 m_period_pending_queries = 0;
+  std::array<u32, PQG_NUM_MEMBERS> m_period_results = {};
+  std::array<std::atomic<u32>, PQG_NUM_MEMBERS> m_deferred_results = {};
 };
 
 extern std::unique_ptr<PerfQueryBase> g_perf_query;
@@ -4,15 +4,36 @@
 #include "VideoCommon/PerformanceMetrics.h"
 
 #include <algorithm>
+#include <ctime>
+#include <string>
 
+#include <fmt/chrono.h>
+#include <fmt/format.h>
 #include <imgui.h>
 #include <implot.h>
 
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/TimeUtil.h"
 #include "Core/Config/GraphicsSettings.h"
+#include "Core/ConfigManager.h"
+#include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoConfig.h"
 
 PerformanceMetrics g_perf_metrics;
 
+static std::string GetFrameTimingTracePath()
+{
+  const auto local_time = Common::LocalTime(std::time(nullptr));
+  const std::string dump_dir = File::GetUserPath(D_DUMPFRAMES_IDX);
+  File::CreateFullPath(dump_dir);
+
+  if (!local_time)
+    return fmt::format("{}{}_timings.json", dump_dir, SConfig::GetInstance().GetGameID());
+  return fmt::format("{}{}_{:%Y-%m-%d_%H-%M-%S}_timings.json", dump_dir,
+                     SConfig::GetInstance().GetGameID(), *local_time);
+}
+
 void PerformanceMetrics::Reset()
 {
   m_fps_counter.Reset();
@@ -25,11 +46,51 @@ void PerformanceMetrics::Reset()
   m_max_speed = 0;
 
   m_frame_presentation_offset = DT{};
+  m_audio_latency = DT{};
+
+  m_frame_timings_ms = {};
 }
 
 void PerformanceMetrics::CountFrame()
 {
   m_fps_counter.Count();
+
+  UpdateFrameTimings();
+}
+
+void PerformanceMetrics::UpdateFrameTimings()
+{
+  namespace FrameProfiler = Common::FrameProfiler;
+
+  const bool tracing = g_ActiveConfig.bTraceFrameTimings;
+  const bool keep_recent = g_ActiveConfig.bKeepRecentFrameTimings;
+  FrameProfiler::SetEnabled(g_ActiveConfig.bShowFrameTimings || tracing || keep_recent);
+  FrameProfiler::SetKeepingRecentEvents(keep_recent);
+  if (tracing && !FrameProfiler::IsTracing())
+    FrameProfiler::StartTrace();
+  else if (!tracing && FrameProfiler::IsTracing())
+    FrameProfiler::StopTrace(GetFrameTimingTracePath());
+
+  // Smooth over roughly the last 20 frames, so that the overlay stays readable.
+  constexpr double smoothing = 0.05;
+  const FrameProfiler::FrameTimes frame_times = FrameProfiler::TakeFrameTimes();
+  for (u32 i = 0; i < FrameProfiler::NUM_STAGES; ++i)
+    m_frame_timings_ms[i] += smoothing * (DT_ms(frame_times[i]).count() - m_frame_timings_ms[i]);
+}
+
+void PerformanceMetrics::DumpRecentFrameTimings()
+{
+  if (!Common::FrameProfiler::IsKeepingRecentEvents())
+  {
+    OSD::AddMessage("Enable keeping recent frame timings to dump them");
+    return;
+  }
+
+  const std::string path = GetFrameTimingTracePath();
+  if (Common::FrameProfiler::DumpRecentEvents(path, RECENT_FRAME_TIMINGS_DURATION))
+    OSD::AddMessage(fmt::format("Dumped recent frame timings to \"{}\"", path));
+  else
+    OSD::AddMessage("Failed to dump recent frame timings");
 }
 
 void PerformanceMetrics::CountVBlank()
@@ -37,10 +98,14 @@ void PerformanceMetrics::CountVBlank()
   m_vps_counter.Count();
 }
 
-void PerformanceMetrics::OnEmulationStateChanged([[maybe_unused]] Core::State state)
+void PerformanceMetrics::OnEmulationStateChanged(Core::State state)
 {
   m_fps_counter.InvalidateLastTime();
   m_vps_counter.InvalidateLastTime();
+
+  // Don't lose a trace that is still recording when the game stops.
+  if (state == Core::State::Stopping && Common::FrameProfiler::IsTracing())
+    Common::FrameProfiler::StopTrace(GetFrameTimingTracePath());
 }
 
 void PerformanceMetrics::CountThrottleSleep(DT sleep)
@@ -100,11 +165,31 @@ double PerformanceMetrics::GetMaxSpeed() const
   return m_max_speed.load(std::memory_order_relaxed);
 }
 
+DT PerformanceMetrics::GetAudioLatency() const
+{
+  return m_audio_latency.load(std::memory_order_relaxed);
+}
+
+DT PerformanceMetrics::GetBootTime() const
+{
+  return m_boot_time.load(std::memory_order_relaxed);
+}
+
 void PerformanceMetrics::SetLatestFramePresentationOffset(DT offset)
 {
   m_frame_presentation_offset.store(offset, std::memory_order_relaxed);
 }
 
+void PerformanceMetrics::SetAudioLatency(DT latency)
+{
+  m_audio_latency.store(latency, std::memory_order_relaxed);
+}
+
+void PerformanceMetrics::SetBootTime(DT boot_time)
+{
+  m_boot_time.store(boot_time, std::memory_order_relaxed);
+}
+
 void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
 {
   m_vps_counter.UpdateStats();
@@ -274,6 +359,12 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
       clamp_window_position();
       ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Speed:%4.0lf%%", 100.0 * speed);
       ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Max:%6.0lf%%", 100.0 * GetMaxSpeed());
+      const DT audio_latency = GetAudioLatency();
+      if (audio_latency != DT{})
+      {
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Audio:%3.0lfms",
+                           DT_ms(audio_latency).count());
+      }
     }
     ImGui::End();
   }
@@ -336,5 +427,31 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
     ImGui::End();
   }
 
+  if (g_ActiveConfig.bShowFrameTimings)
+  {
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), set_next_position_condition,
+                            ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (ImGui::Begin("FrameTimings", nullptr, imgui_flags))
+    {
+      if (stack_vertically)
+        window_y += ImGui::GetWindowHeight() + window_padding;
+      else
+        window_x -= ImGui::GetWindowWidth() + window_padding;
+      clamp_window_position();
+      for (u32 i = 0; i < Common::FrameProfiler::NUM_STAGES; ++i)
+      {
+        const auto stage = static_cast<Common::FrameProfiler::Stage>(i);
+        ImGui::Text("%-20s%6.2lfms", Common::FrameProfiler::GetStageName(stage),
+                    m_frame_timings_ms[i]);
+      }
+      if (Common::FrameProfiler::IsTracing())
+        ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "Recording trace");
+    }
+    ImGui::End();
+  }
+
   ImGui::PopStyleVar(2);
 }
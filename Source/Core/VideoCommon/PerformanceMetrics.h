@@ -3,10 +3,13 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <deque>
 
 #include "Common/CommonTypes.h"
+#include "Common/FrameProfiler.h"
 #include "Core/Core.h"
 #include "VideoCommon/PerformanceTracker.h"
 
@@ -42,14 +45,28 @@ public:
   double GetVPS() const;
   double GetSpeed() const;
   double GetMaxSpeed() const;
+  DT GetAudioLatency() const;
+  // How long the last boot took, from the start of the emu thread until the CPU thread started.
+  DT GetBootTime() const;
 
   // Call from any thread.
   void SetLatestFramePresentationOffset(DT offset);
+  // How long the audio pushed by the emulated DSP takes to be played.
+  void SetAudioLatency(DT latency);
+  void SetBootTime(DT boot_time);
+  // Writes the last RECENT_FRAME_TIMINGS_DURATION of profiled scopes to the frame dump directory,
+  // if they are being kept.
+  void DumpRecentFrameTimings();
+
+  static constexpr DT RECENT_FRAME_TIMINGS_DURATION = std::chrono::seconds(10);
 
   // ImGui Functions
   void DrawImGuiStats(const float backbuffer_scale);
 
 private:
+  // Call from GPU thread, once per presented frame.
+  void UpdateFrameTimings();
+
   PerformanceTracker m_fps_counter{"render_times.txt"};
   PerformanceTracker m_vps_counter{"vblank_times.txt"};
 
@@ -59,6 +76,9 @@ private:
   std::atomic<double> m_max_speed{};
 
   std::atomic<DT> m_frame_presentation_offset{};
+  std::atomic<DT> m_audio_latency{};
+  // Not cleared by Reset, which only happens once the game is running.
+  std::atomic<DT> m_boot_time{};
 
   struct PerfSample
   {
@@ -69,6 +89,9 @@ private:
 
   std::deque<PerfSample> m_samples;
   DT m_time_sleeping{};
+
+  // Smoothed time of each profiler stage per frame, in milliseconds.
+  std::array<double, Common::FrameProfiler::NUM_STAGES> m_frame_timings_ms{};
 };
 
 extern PerformanceMetrics g_perf_metrics;
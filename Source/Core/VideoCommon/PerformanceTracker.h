@@ -57,8 +57,8 @@ private:
   std::atomic<bool> m_is_last_time_sane = false;
 
   // Push'd from Count()
-  //  and Pop'd from UpdateStats()
-  Common::SPSCQueue<DT> m_raw_dts;
+  //  and Pop'd from UpdateStats(), which runs every frame. Samples past the capacity are dropped.
+  Common::RingSPSCQueue<DT, 256> m_raw_dts;
   std::atomic<DT> m_last_raw_dt = DT::zero();
 
   // Amount of time to sample dt's over (defaults to config)
@@ -3,6 +3,7 @@
 
 #include "VideoCommon/PostProcessing.h"
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -39,6 +40,9 @@ static const char s_default_pixel_shader_name[] = "default_pre_post_process";
 // Keep the highest quality possible to avoid losing quality on subtle gamma conversions.
 // RGBA16F should have enough quality even if we store colors in gamma space on it.
 static const AbstractTextureFormat s_intermediary_buffer_format = AbstractTextureFormat::RGBA16F;
+// How many intermediary targets are kept around, and for how many blits an unused one survives.
+static constexpr size_t MAX_INTERMEDIARY_TARGETS = 3;
+static constexpr u64 INTERMEDIARY_TARGET_LIFETIME = 300;
 
 static bool LoadShaderFromFile(const std::string& shader, const std::string& sub_dir,
                                std::string& out_code)
@@ -119,6 +123,7 @@ void PostProcessingConfiguration::LoadOptions(const std::string& code)
   size_t configuration_end = code.find(config_end_delimiter);
 
   m_options.clear();
+  m_input_scale = 1.0f;
   m_any_options_dirty = true;
 
   if (configuration_start == std::string::npos || configuration_end == std::string::npos)
@@ -182,6 +187,18 @@ void PostProcessingConfiguration::LoadOptions(const std::string& code)
 
   for (const auto& it : option_strings)
   {
+    // Settings of the pass itself rather than an option
+    if (it.m_type == "Pass")
+    {
+      for (const auto& [key, value] : it.m_options)
+      {
+        float input_scale;
+        if (key == "InputScale" && TryParse(value, &input_scale) && input_scale > 0.0f)
+          m_input_scale = std::min(input_scale, 1.0f);
+      }
+      continue;
+    }
+
     ConfigurationOption option;
     option.m_dirty = true;
 
@@ -498,6 +515,9 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
       g_ActiveConfig.output_resampling_mode > OutputResamplingMode::Default;
   const bool needs_intermediary_buffer = NeedsIntermediaryBuffer();
   const bool needs_default_pipeline = needs_color_correction || needs_resampling;
+  // The user shader asked for a lower resolution input, the default pass does the downscaling
+  const float input_scale = needs_intermediary_buffer ? m_config.GetInputScale() : 1.0f;
+  const bool needs_downscaling = input_scale < 1.0f;
   const AbstractPipeline* final_pipeline = m_pipeline.get();
   std::vector<u8>* uniform_staging_buffer = &m_default_uniform_staging_buffer;
   bool default_uniform_staging_buffer = true;
@@ -509,7 +529,9 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
   // -Keep quality for gamma and gamut conversions, and HDR output
   //  (low bit depths lose too much quality with gamma conversions)
   // -Keep the post process phase in linear space, to better operate with colors
-  if (m_default_pipeline && needs_default_pipeline && needs_intermediary_buffer)
+  // -Run the user shader at the lower resolution it asked for
+  if (m_default_pipeline && (needs_default_pipeline || needs_downscaling) &&
+      needs_intermediary_buffer)
   {
     AbstractFramebuffer* const previous_framebuffer = g_gfx->GetCurrentFramebuffer();
 
@@ -519,28 +541,15 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
     // so it would be a waste to allocate two layers (see "bUsesExplictQuadBuffering").
     const u32 target_layers = copy_all_layers ? src_tex->GetLayers() : 1;
 
+    const MathUtil::Rectangle<int> base_rect = needs_resampling ? present_rect : src_rect;
     const u32 target_width =
-        needs_resampling ? present_rect.GetWidth() : static_cast<u32>(src_rect.GetWidth());
+        std::max(static_cast<u32>(static_cast<float>(base_rect.GetWidth()) * input_scale), 1u);
     const u32 target_height =
-        needs_resampling ? present_rect.GetHeight() : static_cast<u32>(src_rect.GetHeight());
+        std::max(static_cast<u32>(static_cast<float>(base_rect.GetHeight()) * input_scale), 1u);
 
-    if (!m_intermediary_frame_buffer || !m_intermediary_color_texture ||
-        m_intermediary_color_texture->GetWidth() != target_width ||
-        m_intermediary_color_texture->GetHeight() != target_height ||
-        m_intermediary_color_texture->GetLayers() != target_layers)
-    {
-      const TextureConfig intermediary_color_texture_config(
-          target_width, target_height, 1, target_layers, src_tex->GetSamples(),
-          s_intermediary_buffer_format, AbstractTextureFlag_RenderTarget,
-          AbstractTextureType::Texture_2DArray);
-      m_intermediary_color_texture = g_gfx->CreateTexture(intermediary_color_texture_config,
-                                                          "Intermediary post process texture");
-
-      m_intermediary_frame_buffer =
-          g_gfx->CreateFramebuffer(m_intermediary_color_texture.get(), nullptr);
-    }
-
-    g_gfx->SetFramebuffer(m_intermediary_frame_buffer.get());
+    IntermediaryTarget* const target =
+        GetIntermediaryTarget(target_width, target_height, target_layers, src_tex->GetSamples());
+    g_gfx->SetFramebuffer(target->framebuffer.get());
 
     FillUniformBuffer(src_rect, src_tex, src_layer, g_gfx->GetCurrentFramebuffer()->GetRect(),
                       present_rect, uniform_staging_buffer->data(), !default_uniform_staging_buffer,
@@ -549,16 +558,16 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
                                             static_cast<u32>(uniform_staging_buffer->size()));
 
     g_gfx->SetViewportAndScissor(g_gfx->ConvertFramebufferRectangle(
-        m_intermediary_color_texture->GetRect(), m_intermediary_frame_buffer.get()));
+        target->texture->GetRect(), target->framebuffer.get()));
     g_gfx->SetPipeline(m_default_pipeline.get());
     g_gfx->Draw(0, 3);
 
     g_gfx->SetFramebuffer(previous_framebuffer);
-    src_rect = m_intermediary_color_texture->GetRect();
-    src_tex = m_intermediary_color_texture.get();
+    src_rect = target->texture->GetRect();
+    src_tex = target->texture.get();
     g_gfx->SetTexture(0, src_tex);
     g_gfx->SetTexture(1, src_tex);
-    // The "m_intermediary_color_texture" has already copied
+    // The intermediary texture has already copied
     // from the specified source layer onto its first one.
     // If we query for a layer that the source texture doesn't have,
     // it will fall back on the first one anyway.
@@ -580,11 +589,10 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
       uniform_staging_buffer = &m_uniform_staging_buffer;
       default_uniform_staging_buffer = false;
     }
-
-    m_intermediary_frame_buffer.reset();
-    m_intermediary_color_texture.reset();
   }
 
+  ReleaseUnusedIntermediaryTargets();
+
   // TODO: ideally we'd do the user selected post process pass in the intermediary buffer in linear
   // space (instead of gamma space), so the shaders could act more accurately (and sample in linear
   // space), though that would break the look of some of current post processes we have, and thus is
@@ -606,6 +614,45 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
   }
 }
 
+PostProcessing::IntermediaryTarget*
+PostProcessing::GetIntermediaryTarget(u32 width, u32 height, u32 layers, u32 samples)
+{
+  const auto it = std::ranges::find_if(m_intermediary_targets, [&](const auto& target) {
+    const TextureConfig& config = target.texture->GetConfig();
+    return config.width == width && config.height == height && config.layers == layers &&
+           config.samples == samples;
+  });
+  if (it != m_intermediary_targets.end())
+  {
+    it->last_used = m_blit_count;
+    return &*it;
+  }
+
+  // Replace the least recently used target when the pool is full
+  if (m_intermediary_targets.size() >= MAX_INTERMEDIARY_TARGETS)
+  {
+    m_intermediary_targets.erase(std::ranges::min_element(
+        m_intermediary_targets, {}, [](const auto& target) { return target.last_used; }));
+  }
+
+  const TextureConfig config(width, height, 1, layers, samples, s_intermediary_buffer_format,
+                             AbstractTextureFlag_RenderTarget,
+                             AbstractTextureType::Texture_2DArray);
+  IntermediaryTarget target;
+  target.texture = g_gfx->CreateTexture(config, "Intermediary post process texture");
+  target.framebuffer = g_gfx->CreateFramebuffer(target.texture.get(), nullptr);
+  target.last_used = m_blit_count;
+  return &m_intermediary_targets.emplace_back(std::move(target));
+}
+
+void PostProcessing::ReleaseUnusedIntermediaryTargets()
+{
+  m_blit_count++;
+  std::erase_if(m_intermediary_targets, [this](const auto& target) {
+    return m_blit_count - target.last_used > INTERMEDIARY_TARGET_LIFETIME;
+  });
+}
+
 std::string PostProcessing::GetUniformBufferHeader(bool user_post_process) const
 {
   std::ostringstream ss;
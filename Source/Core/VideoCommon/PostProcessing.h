@@ -77,6 +77,9 @@ public:
   const ConfigMap& GetOptions() const { return m_options; }
   ConfigMap& GetOptions() { return m_options; }
   const ConfigurationOption& GetOption(const std::string& option) { return m_options[option]; }
+  // The fraction of the output resolution the shader wants its input at, from the [Pass]
+  // section of its configuration. Shaders that are mostly blurs can run at a fraction of the cost.
+  float GetInputScale() const { return m_input_scale; }
   // For updating option's values
   void SetOptionf(const std::string& option, int index, float value);
   void SetOptioni(const std::string& option, int index, s32 value);
@@ -88,6 +91,7 @@ private:
   std::string m_current_shader;
   std::string m_current_shader_code;
   ConfigMap m_options;
+  float m_input_scale = 1.0f;
 
   void LoadOptions(const std::string& code);
   void LoadOptionsConfiguration();
@@ -125,6 +129,17 @@ protected:
   bool CompilePixelShader();
   bool CompilePipeline();
 
+  struct IntermediaryTarget
+  {
+    std::unique_ptr<AbstractTexture> texture;
+    std::unique_ptr<AbstractFramebuffer> framebuffer;
+    u64 last_used = 0;
+  };
+
+  // Returns a render target of this size from the pool, creating one if needed.
+  IntermediaryTarget* GetIntermediaryTarget(u32 width, u32 height, u32 layers, u32 samples);
+  void ReleaseUnusedIntermediaryTargets();
+
   size_t CalculateUniformsSize(bool user_post_process) const;
   void FillUniformBuffer(const MathUtil::Rectangle<int>& src, const AbstractTexture* src_tex,
                          int src_layer, const MathUtil::Rectangle<int>& dst,
@@ -139,8 +154,10 @@ protected:
   std::unique_ptr<AbstractShader> m_default_vertex_shader;
   std::unique_ptr<AbstractShader> m_default_pixel_shader;
   std::unique_ptr<AbstractPipeline> m_default_pipeline;
-  std::unique_ptr<AbstractFramebuffer> m_intermediary_frame_buffer;
-  std::unique_ptr<AbstractTexture> m_intermediary_color_texture;
+  // Kept across frames so that toggling between a few sizes (e.g. windowed and fullscreen, or
+  // resampling on and off) doesn't reallocate them every time.
+  std::vector<IntermediaryTarget> m_intermediary_targets;
+  u64 m_blit_count = 0;
   std::vector<u8> m_default_uniform_staging_buffer;
   // User post process:
   PostProcessingConfiguration m_config;
@@ -3,6 +3,8 @@
 
 #include "VideoCommon/Present.h"
 
+#include <algorithm>
+
 #include "Common/ChunkFile.h"
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/Config/MainSettings.h"
@@ -28,6 +30,25 @@ std::unique_ptr<VideoCommon::Presenter> g_presenter;
 
 namespace VideoCommon
 {
+static std::atomic<bool> s_presentation_suppressed_request{false};
+static std::atomic<bool> s_presentation_suppressed{false};
+
+void SetPresentationSuppressed(bool suppressed)
+{
+  s_presentation_suppressed_request.store(suppressed, std::memory_order_relaxed);
+}
+
+void LatchPresentationSuppressed()
+{
+  s_presentation_suppressed.store(s_presentation_suppressed_request.load(std::memory_order_relaxed),
+                                  std::memory_order_relaxed);
+}
+
+bool IsPresentationSuppressed()
+{
+  return s_presentation_suppressed.load(std::memory_order_relaxed);
+}
+
 // Stretches the native/internal analog resolution aspect ratio from ~4:3 to ~16:9
 static float SourceAspectRatioToWidescreen(float source_aspect)
 {
@@ -145,6 +166,7 @@ bool Presenter::FetchXFB(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_heigh
   {
     // Game is blanking the screen
     m_xfb_entry.reset();
+    m_xfb_texture = nullptr;
     m_xfb_rect = MathUtil::Rectangle<int>();
     m_last_xfb_id = std::numeric_limits<u64>::max();
   }
@@ -152,6 +174,7 @@ bool Presenter::FetchXFB(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_heigh
   {
     m_xfb_entry =
         g_texture_cache->GetXFBTexture(xfb_addr, fb_width, fb_height, fb_stride, &m_xfb_rect);
+    m_xfb_texture = m_xfb_entry->texture.get();
     m_last_xfb_id = m_xfb_entry->id;
 
     m_xfb_entry->AcquireContentLock();
@@ -165,9 +188,49 @@ bool Presenter::FetchXFB(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_heigh
   return old_xfb_id == m_last_xfb_id;
 }
 
+void Presenter::FetchEFB(const MathUtil::Rectangle<int>& efb_rect, u64 ticks)
+{
+  ReleaseXFBContentLock();
+  m_xfb_entry.reset();
+
+  // Pokes are expected to be included, just like in an EFB copy.
+  g_framebuffer_manager->FlushEFBPokes();
+  m_xfb_rect = g_gfx->ConvertFramebufferRectangle(
+      g_framebuffer_manager->ConvertEFBRectangle(efb_rect),
+      g_framebuffer_manager->GetEFBFramebuffer());
+  m_xfb_texture = g_framebuffer_manager->ResolveEFBColorTexture(m_xfb_rect);
+  m_xfb_texture->FinishedRendering();
+
+  // There is no XFB in memory to compare with the next one, or to display again after loading a
+  // state.
+  m_last_xfb_id = std::numeric_limits<u64>::max();
+  m_last_xfb_addr = 0;
+  m_last_xfb_ticks = ticks;
+  m_last_xfb_width = efb_rect.GetWidth();
+  m_last_xfb_stride = 0;
+  m_last_xfb_height = efb_rect.GetHeight();
+}
+
 void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks,
-                       TimePoint presentation_time)
+                       TimePoint presentation_time, bool suppressed)
 {
+  if (suppressed)
+  {
+    m_present_count++;
+    m_frame_count++;
+    return;
+  }
+
+  const u32 xfb_end = xfb_addr + fb_stride * fb_height;
+  if (std::ranges::any_of(m_dropped_xfb_ranges, [&](const auto& range) {
+        return range.first < xfb_end && xfb_addr < range.second;
+      }))
+  {
+    // The texture cache doesn't have the frame, so this counts as presenting the last one again.
+    m_present_count++;
+    return;
+  }
+
   bool is_duplicate = FetchXFB(xfb_addr, fb_width, fb_stride, fb_height, ticks);
 
   PresentInfo present_info{
@@ -220,17 +283,66 @@ void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height,
 }
 
 void Presenter::ImmediateSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height)
+{
+  if (!BeginImmediateSwap())
+    return;
+
+  const u64 ticks = m_next_swap_estimated_ticks;
+  FetchXFB(xfb_addr, fb_width, fb_stride, fb_height, ticks);
+  PresentImmediateSwap(ticks);
+}
+
+void Presenter::ImmediateSwapEFB(const MathUtil::Rectangle<int>& efb_rect)
+{
+  if (!BeginImmediateSwap())
+    return;
+
+  const u64 ticks = m_next_swap_estimated_ticks;
+  FetchEFB(efb_rect, ticks);
+  PresentImmediateSwap(ticks);
+
+  // The game draws the next frame over the EFB, so it can't be presented again.
+  m_xfb_texture = nullptr;
+}
+
+bool Presenter::DropXFBCopy(u32 xfb_addr, u32 size)
+{
+  const u32 end = xfb_addr + size;
+  std::erase_if(m_dropped_xfb_ranges, [&](const auto& range) {
+    return range.first < end && xfb_addr < range.second;
+  });
+
+  // Copies that are written to RAM have to be made, as the game could read them back.
+  if (!g_ActiveConfig.bSkipXFBCopyToRam ||
+      !Core::System::GetInstance().GetCoreTiming().GetVISkip())
+  {
+    return false;
+  }
+
+  m_dropped_xfb_ranges.emplace_back(xfb_addr, end);
+  return true;
+}
+
+bool Presenter::BeginImmediateSwap()
 {
   if (m_immediate_swap_happened_this_field.exchange(true, std::memory_order_relaxed) &&
       Config::Get(Config::GFX_HACK_CAP_IMMEDIATE_XFB))
   {
-    return;
+    return false;
   }
 
-  const u64 ticks = m_next_swap_estimated_ticks;
+  if (IsPresentationSuppressed())
+  {
+    m_present_count++;
+    m_frame_count++;
+    return false;
+  }
 
-  FetchXFB(xfb_addr, fb_width, fb_stride, fb_height, ticks);
+  return true;
+}
 
+void Presenter::PresentImmediateSwap(u64 ticks)
+{
   PresentInfo present_info{
       .frame_count = m_frame_count++,
       .present_count = m_present_count++,
@@ -257,7 +369,7 @@ void Presenter::SetNextSwapEstimatedTime(u64 ticks, TimePoint host_time)
 
 void Presenter::ProcessFrameDumping(u64 ticks) const
 {
-  if (g_frame_dumper->IsFrameDumping() && m_xfb_entry)
+  if (g_frame_dumper->IsFrameDumping() && m_xfb_texture)
   {
     MathUtil::Rectangle<int> target_rect;
     switch (Config::Get(Config::GFX_FRAME_DUMPS_RESOLUTION_TYPE))
@@ -315,7 +427,7 @@ void Presenter::ProcessFrameDumping(u64 ticks) const
 
     // TODO: any scaling done by this won't be gamma corrected,
     // we should either apply post processing as well, or port its gamma correction code
-    g_frame_dumper->DumpCurrentFrame(m_xfb_entry->texture.get(), m_xfb_rect, target_rect, ticks,
+    g_frame_dumper->DumpCurrentFrame(m_xfb_texture, m_xfb_rect, target_rect, ticks,
                                      m_frame_count);
   }
 }
@@ -467,7 +579,7 @@ float Presenter::CalculateDrawAspectRatio(bool allow_stretch) const
     else if (aspect_mode == AspectMode::Raw)
     {
       resulting_aspect_ratio =
-          m_xfb_entry ? (static_cast<float>(m_last_xfb_width) / m_last_xfb_height) : 1.f;
+          m_xfb_texture ? (static_cast<float>(m_last_xfb_width) / m_last_xfb_height) : 1.f;
     }
     else
     {
@@ -725,7 +837,7 @@ void Presenter::UpdateDrawRectangle()
   int int_draw_width;
   int int_draw_height;
 
-  if (g_ActiveConfig.aspect_mode != AspectMode::Raw || !m_xfb_entry)
+  if (g_ActiveConfig.aspect_mode != AspectMode::Raw || !m_xfb_texture)
   {
     // Find the best integer resolution: the closest aspect ratio with the least black bars.
     // This should have no influence if "AspectMode::Stretch" is active.
@@ -850,16 +962,16 @@ void Presenter::Present(PresentInfo* present_info)
 {
   m_present_count++;
 
-  if (g_gfx->IsHeadless() || (!m_onscreen_ui && !m_xfb_entry))
+  if (g_gfx->IsHeadless() || (!m_onscreen_ui && !m_xfb_texture))
     return;
 
   if (!g_gfx->SupportsUtilityDrawing())
   {
     // Video Software doesn't support drawing a UI or doing post-processing
     // So just show the XFB
-    if (m_xfb_entry)
+    if (m_xfb_texture)
     {
-      g_gfx->ShowImage(m_xfb_entry->texture.get(), m_xfb_rect);
+      g_gfx->ShowImage(m_xfb_texture, m_xfb_rect);
 
       // Update the window size based on the frame that was just rendered.
       // Due to depending on guest state, we need to call this every frame.
@@ -879,14 +991,14 @@ void Presenter::Present(PresentInfo* present_info)
   const bool backbuffer_bound = g_gfx->BindBackbuffer({{0.0f, 0.0f, 0.0f, 1.0f}});
 
   // Render the XFB to the screen.
-  if (backbuffer_bound && m_xfb_entry)
+  if (backbuffer_bound && m_xfb_texture)
   {
     // Adjust the source rectangle instead of using an oversized viewport to render the XFB.
     auto render_target_rc = GetTargetRectangle();
     auto render_source_rc = m_xfb_rect;
     AdjustRectanglesToFitBounds(&render_target_rc, &render_source_rc, m_backbuffer_width,
                                 m_backbuffer_height);
-    RenderXFBToScreen(render_target_rc, m_xfb_entry->texture.get(), render_source_rc);
+    RenderXFBToScreen(render_target_rc, m_xfb_texture, render_source_rc);
   }
 
   if (m_onscreen_ui)
@@ -914,7 +1026,7 @@ void Presenter::Present(PresentInfo* present_info)
     g_gfx->PresentBackbuffer();
   }
 
-  if (m_xfb_entry)
+  if (m_xfb_texture)
   {
     // Update the window size based on the frame that was just rendered.
     // Due to depending on guest state, we need to call this every frame.
@@ -988,6 +1100,10 @@ void Presenter::DoState(PointerWrap& p)
   p.Do(m_last_xfb_stride);
   p.Do(m_last_xfb_height);
 
+  // The copies of the state have all been made.
+  if (p.IsReadMode())
+    m_dropped_xfb_ranges.clear();
+
   // If we're loading and there is a last XFB, re-display it.
   if (p.IsReadMode() && m_last_xfb_stride != 0)
   {
@@ -15,6 +15,8 @@
 #include <memory>
 #include <mutex>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 class AbstractTexture;
 struct SurfaceInfo;
@@ -35,9 +37,18 @@ public:
   Presenter();
   virtual ~Presenter();
 
+  // A suppressed swap is counted but not fetched, presented or dumped.
   void ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks,
-              TimePoint presentation_time);
+              TimePoint presentation_time, bool suppressed = false);
   void ImmediateSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height);
+  // Presents the region of the EFB that an XFB copy would have copied, instead of the copy. Only
+  // valid for copies that don't change the image, and only until the EFB is drawn to again.
+  void ImmediateSwapEFB(const MathUtil::Rectangle<int>& efb_rect);
+
+  // Whether the XFB copy to size bytes at xfb_addr should be skipped, which is the case while the
+  // VI skip drops frames because emulation is behind. The fields that scan out a skipped copy
+  // present nothing, which leaves the last frame on screen.
+  bool DropXFBCopy(u32 xfb_addr, u32 size);
 
   void SetNextSwapEstimatedTime(u64 ticks, TimePoint host_time);
 
@@ -104,6 +115,11 @@ private:
   // Fetches the XFB texture from the texture cache.
   // Returns true the contents have changed since last time
   bool FetchXFB(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks);
+  void FetchEFB(const MathUtil::Rectangle<int>& efb_rect, u64 ticks);
+
+  // Returns false if this immediate swap shouldn't be presented.
+  bool BeginImmediateSwap();
+  void PresentImmediateSwap(u64 ticks);
 
   void ProcessFrameDumping(u64 ticks) const;
 
@@ -143,12 +159,18 @@ private:
   u32 m_auto_resolution_scale = 1;
 
   RcTcacheEntry m_xfb_entry;
+  // The texture of m_xfb_entry, or the EFB when it is presented without an XFB copy.
+  AbstractTexture* m_xfb_texture = nullptr;
   // Internal resolution multiplier scaled XFB size
   MathUtil::Rectangle<int> m_xfb_rect{0, 0, MAX_XFB_WIDTH, MAX_XFB_HEIGHT};
 
   // Tracking of XFB textures so we don't render duplicate frames.
   u64 m_last_xfb_id = std::numeric_limits<u64>::max();
 
+  // The [begin, end) guest memory ranges of the XFB copies that were dropped, until the game
+  // copies over them again.
+  std::vector<std::pair<u32, u32>> m_dropped_xfb_ranges;
+
   // These will be set on the first call to SetSuggestedWindowSize.
   int m_last_window_request_width = 0;
   int m_last_window_request_height = 0;
@@ -186,6 +208,15 @@ private:
   std::atomic_bool m_immediate_swap_happened_this_field{};
 };
 
+// While set, XFB swaps are counted but not fetched, presented or dumped. Used for frames that are
+// emulated but never shown, e.g. speculative frames when a libretro frontend runs ahead. Safe from
+// any thread, and takes effect from the next emulated field, so that a field is never split.
+void SetPresentationSuppressed(bool suppressed);
+// Called by the CPU thread at every field boundary to apply the last SetPresentationSuppressed.
+void LatchPresentationSuppressed();
+// Whether the field being emulated is suppressed.
+bool IsPresentationSuppressed();
+
 }  // namespace VideoCommon
 
 extern std::unique_ptr<VideoCommon::Presenter> g_presenter;
@@ -6,7 +6,9 @@
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
+#include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
+#include "Common/FrameProfiler.h"
 #include "Common/MsgHandler.h"
 #include "Core/ConfigManager.h"
 
@@ -29,6 +31,10 @@ std::unique_ptr<VideoCommon::ShaderCache> g_shader_cache;
 
 namespace VideoCommon
 {
+// The header of the pipeline UID cache, which also serves as the format of shared UID bundles.
+constexpr u32 UID_CACHE_MAGIC = 0x44495550;  // PUID
+constexpr size_t UID_CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
 ShaderCache::ShaderCache() : m_api_type{APIType::Nothing}
 {
 }
@@ -61,6 +67,7 @@ void ShaderCache::InitializeShaderCache()
   {
     LoadCaches();
     LoadPipelineUIDCache();
+    ImportPipelineUIDBundles();
   }
 
   // Queue ubershader precompiling if required.
@@ -118,11 +125,48 @@ void ShaderCache::Shutdown()
   ClosePipelineUIDCache();
 }
 
+ShaderCache::PipelineLookupCacheEntry*
+ShaderCache::FindInPipelineLookupCache(const GXPipelineUid& uid, u64 uid_hash)
+{
+  PipelineLookupCacheEntry& entry = m_pipeline_lookup_cache[uid_hash % PIPELINE_LOOKUP_CACHE_SIZE];
+  if (entry.uid && entry.uid_hash == uid_hash && *entry.uid == uid)
+    return &entry;
+  return nullptr;
+}
+
+void ShaderCache::AddToPipelineLookupCache(const GXPipelineUid& uid, u64 uid_hash,
+                                           const AbstractPipeline* pipeline)
+{
+  // Pipelines which failed to compile aren't cached, as a pending duplicate may still succeed.
+  if (!pipeline)
+    return;
+
+  const auto it = m_gx_pipeline_cache.find(uid);
+  if (it == m_gx_pipeline_cache.end())
+    return;
+
+  m_pipeline_lookup_cache[uid_hash % PIPELINE_LOOKUP_CACHE_SIZE] = {uid_hash, &it->first, pipeline};
+}
+
 const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
+  return GetPipelineForUid(uid, GXPipelineUidHash(uid).Get());
+}
+
+const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid, u64 uid_hash)
+{
+  if (const PipelineLookupCacheEntry* cached = FindInPipelineLookupCache(uid, uid_hash))
+    return cached->pipeline;
+
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end() && !it->second.second)
+  {
+    AddToPipelineLookupCache(uid, uid_hash, it->second.first.get());
     return it->second.first.get();
+  }
+
+  // The draw can't continue until the pipeline is compiled.
+  Common::FrameProfiler::Scope profiler_scope(Common::FrameProfiler::Stage::ShaderCompileWait);
 
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
   std::unique_ptr<AbstractPipeline> pipeline;
@@ -131,19 +175,35 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
   if (g_ActiveConfig.bShaderCache && !exists_in_cache)
     AppendGXPipelineUID(uid);
-  return InsertGXPipeline(uid, std::move(pipeline));
+  const AbstractPipeline* const result = InsertGXPipeline(uid, std::move(pipeline));
+  AddToPipelineLookupCache(uid, uid_hash, result);
+  return result;
 }
 
 std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
 {
+  return GetPipelineForUidAsync(uid, GXPipelineUidHash(uid).Get());
+}
+
+std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid,
+                                                                           u64 uid_hash)
+{
+  if (const PipelineLookupCacheEntry* cached = FindInPipelineLookupCache(uid, uid_hash))
+    return cached->pipeline;
+
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
     // .second is the pending flag, i.e. compiling in the background.
     if (!it->second.second)
+    {
+      AddToPipelineLookupCache(uid, uid_hash, it->second.first.get());
       return it->second.first.get();
-    else
-      return {};
+    }
+
+    if (m_shader_cache_pending_pipelines.erase(uid) != 0)
+      QueuePipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
+    return {};
   }
 
   AppendGXPipelineUID(uid);
@@ -157,6 +217,8 @@ const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineU
   if (it != m_gx_uber_pipeline_cache.end() && !it->second.second)
     return it->second.first.get();
 
+  Common::FrameProfiler::Scope profiler_scope(Common::FrameProfiler::Stage::ShaderCompileWait);
+
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
@@ -164,6 +226,22 @@ const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineU
   return InsertGXUberPipeline(uid, std::move(pipeline));
 }
 
+std::optional<const AbstractPipeline*>
+ShaderCache::GetUberPipelineForUidAsync(const GXUberPipelineUid& uid)
+{
+  auto it = m_gx_uber_pipeline_cache.find(uid);
+  if (it != m_gx_uber_pipeline_cache.end())
+  {
+    // .second is the pending flag, i.e. compiling in the background.
+    if (!it->second.second)
+      return it->second.first.get();
+    return {};
+  }
+
+  QueueUberPipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
+  return {};
+}
+
 void ShaderCache::WaitForAsyncCompiler()
 {
   bool running = true;
@@ -329,7 +407,7 @@ void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyTyp
   // driver version, or system configuration. In this case, when the UID cache picks up the pipeline
   // later on, we'll write a duplicate entry to the pipeline cache. There's also no point in keeping
   // the old cache data around, so discard and recreate the disk cache.
-  if (reader.AnyFailed())
+  if (reader.AnyFailed() && disk_cache.IsWritable())
   {
     WARN_LOG_FMT(VIDEO, "Failed to load one or more pipelines from cache '{}'. Discarding.",
                  filename);
@@ -388,6 +466,8 @@ void ShaderCache::LoadCaches()
 void ShaderCache::ClearCaches()
 {
   ClearPipelineCache(m_gx_pipeline_cache, m_gx_pipeline_disk_cache);
+  m_pipeline_lookup_cache.fill({});
+  m_shader_cache_pending_pipelines.clear();
   ClearShaderCache(m_vs_cache);
   ClearShaderCache(m_gs_cache);
   ClearShaderCache(m_ps_cache);
@@ -744,6 +824,7 @@ const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& confi
 {
   auto& entry = m_gx_pipeline_cache[config];
   entry.second = false;
+  m_shader_cache_pending_pipelines.erase(config);
   if (!entry.first && pipeline)
   {
     entry.first = std::move(pipeline);
@@ -792,28 +873,34 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
 
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
-  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
   std::string filename =
       File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
-  if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
+  // Other instances of Dolphin may share the cache directory, so only the one holding the lock of
+  // the file writes to it. The others read the UIDs it has, but don't append any.
+  bool locked = false;
+  bool needs_header = false;
+  if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+", File::SharedAccess::ReadWrite))
   {
+    locked = m_gx_pipeline_uid_cache_file.TryLock();
+
     // If an existing case exists, validate the version before reading entries.
     u32 existing_magic;
     u32 existing_version;
     bool uid_file_valid = false;
     if (m_gx_pipeline_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
         m_gx_pipeline_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
-        existing_magic == CACHE_FILE_MAGIC && existing_version == GX_PIPELINE_UID_VERSION)
+        existing_magic == UID_CACHE_MAGIC && existing_version == GX_PIPELINE_UID_VERSION)
     {
       // Ensure the expected size matches the actual size of the file. If it doesn't, it means
       // the cache file may be corrupted, and we should not proceed with loading potentially
       // garbage or invalid UIDs.
       const u64 file_size = m_gx_pipeline_uid_cache_file.GetSize();
       const size_t uid_count =
-          static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedGXPipelineUid);
-      const size_t expected_size = uid_count * sizeof(SerializedGXPipelineUid) + CACHE_HEADER_SIZE;
-      uid_file_valid = file_size == expected_size;
+          static_cast<size_t>(file_size - UID_CACHE_HEADER_SIZE) / sizeof(SerializedGXPipelineUid);
+      const size_t expected_size =
+          uid_count * sizeof(SerializedGXPipelineUid) + UID_CACHE_HEADER_SIZE;
+      // Files that are being written to may end with a partial UID, which isn't read.
+      uid_file_valid = file_size == expected_size || !locked;
       if (uid_file_valid)
       {
         for (size_t i = 0; i < uid_count; i++)
@@ -837,50 +924,121 @@ void ShaderCache::LoadPipelineUIDCache()
         uid_file_valid = m_gx_pipeline_uid_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
     }
 
-    // If the file is invalid, close it. We re-open and truncate it below.
-    if (!uid_file_valid)
+    // If the file is invalid, truncate it. The header is written again below.
+    if (!locked)
+    {
+      m_gx_pipeline_uid_cache_file.Close();
+    }
+    else if (!uid_file_valid)
+    {
+      m_gx_pipeline_uid_cache_file.ClearError();
+      needs_header = m_gx_pipeline_uid_cache_file.Resize(0) &&
+                     m_gx_pipeline_uid_cache_file.Seek(0, File::SeekOrigin::Begin);
+      if (!needs_header)
+        m_gx_pipeline_uid_cache_file.Close();
+    }
+  }
+  // If the file couldn't be opened, it means it didn't exist.
+  else if (m_gx_pipeline_uid_cache_file.Open(filename, "wb", File::SharedAccess::ReadWrite))
+  {
+    needs_header = m_gx_pipeline_uid_cache_file.TryLock();
+    if (!needs_header)
       m_gx_pipeline_uid_cache_file.Close();
   }
 
-  // If the file is not open, it means it was either corrupted or didn't exist.
-  if (!m_gx_pipeline_uid_cache_file.IsOpen())
+  if (needs_header)
   {
-    if (m_gx_pipeline_uid_cache_file.Open(filename, "wb"))
-    {
-      // Write the version identifier.
-      m_gx_pipeline_uid_cache_file.WriteBytes(&CACHE_FILE_MAGIC, sizeof(GX_PIPELINE_UID_VERSION));
-      m_gx_pipeline_uid_cache_file.WriteBytes(&GX_PIPELINE_UID_VERSION,
-                                              sizeof(GX_PIPELINE_UID_VERSION));
-
-      // Write any current UIDs out to the file.
-      // This way, if we load a UID cache where the data was incomplete (e.g. Dolphin crashed),
-      // we don't lose the existing UIDs which were previously at the beginning.
-      for (const auto& it : m_gx_pipeline_cache)
-        AppendGXPipelineUID(it.first);
-    }
+    // Write the version identifier.
+    m_gx_pipeline_uid_cache_file.WriteBytes(&UID_CACHE_MAGIC, sizeof(GX_PIPELINE_UID_VERSION));
+    m_gx_pipeline_uid_cache_file.WriteBytes(&GX_PIPELINE_UID_VERSION,
+                                            sizeof(GX_PIPELINE_UID_VERSION));
+
+    // Write any current UIDs out to the file.
+    // This way, if we load a UID cache where the data was incomplete (e.g. Dolphin crashed),
+    // we don't lose the existing UIDs which were previously at the beginning.
+    for (const auto& it : m_gx_pipeline_cache)
+      AppendGXPipelineUID(it.first);
   }
 
   INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", m_gx_pipeline_cache.size(), filename);
 }
 
+void ShaderCache::ImportPipelineUIDBundles()
+{
+  const std::string directory =
+      File::GetUserPath(D_SHADERUIDS_IDX) + SConfig::GetInstance().GetGameID();
+  if (!File::IsDirectory(directory))
+    return;
+
+  for (const std::string& filename : Common::DoFileSearch({directory}, {".uidcache"}))
+  {
+    const size_t imported = ImportPipelineUIDBundle(filename);
+    INFO_LOG_FMT(VIDEO, "Imported {} new pipeline UIDs from {}", imported, filename);
+  }
+}
+
+size_t ShaderCache::ImportPipelineUIDBundle(const std::string& filename)
+{
+  // A bundle is a UID cache file exported from another install, sharing its magic and version.
+  // UIDs not known yet are appended to our own UID cache, and compiled with the rest of it.
+  File::IOFile file(filename, "rb");
+  u32 magic;
+  u32 version;
+  if (!file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)) ||
+      magic != UID_CACHE_MAGIC)
+  {
+    WARN_LOG_FMT(VIDEO, "{} is not a pipeline UID bundle", filename);
+    return 0;
+  }
+  if (version != GX_PIPELINE_UID_VERSION)
+  {
+    WARN_LOG_FMT(VIDEO, "Pipeline UID bundle {} has version {}, expected {}", filename, version,
+                 GX_PIPELINE_UID_VERSION);
+    return 0;
+  }
+
+  const u64 file_size = file.GetSize();
+  if ((file_size - UID_CACHE_HEADER_SIZE) % sizeof(SerializedGXPipelineUid) != 0)
+  {
+    WARN_LOG_FMT(VIDEO, "Pipeline UID bundle {} is truncated", filename);
+    return 0;
+  }
+
+  size_t imported = 0;
+  SerializedGXPipelineUid serialized_uid;
+  while (file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
+  {
+    if (!AddSerializedGXPipelineUID(serialized_uid))
+      continue;
+
+    GXPipelineUid uid;
+    UnserializePipelineUid(serialized_uid, uid);
+    AppendGXPipelineUID(uid);
+    imported++;
+  }
+
+  return imported;
+}
+
 void ShaderCache::ClosePipelineUIDCache()
 {
   // This is left as a method in case we need to append extra data to the file in the future.
   m_gx_pipeline_uid_cache_file.Close();
 }
 
-void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
+bool ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
 {
   GXPipelineUid real_uid;
   UnserializePipelineUid(uid, real_uid);
 
   auto iter = m_gx_pipeline_cache.find(real_uid);
   if (iter != m_gx_pipeline_cache.end())
-    return;
+    return false;
 
   // Flag it as empty with a null pipeline object, for later compilation.
   auto& entry = m_gx_pipeline_cache[real_uid];
   entry.second = false;
+  return true;
 }
 
 void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
@@ -921,7 +1079,9 @@ void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 prior
     VertexShaderUid uid;
   };
 
-  m_vs_cache.shader_map[uid].pending = true;
+  auto& entry = m_vs_cache.shader_map[uid];
+  entry.pending = true;
+  entry.priority = priority;
   auto wi = m_async_shader_compiler->CreateWorkItem<VertexShaderWorkItem>(this, uid);
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
 }
@@ -950,7 +1110,9 @@ void ShaderCache::QueueVertexUberShaderCompile(const UberShader::VertexShaderUid
     UberShader::VertexShaderUid uid;
   };
 
-  m_uber_vs_cache.shader_map[uid].pending = true;
+  auto& entry = m_uber_vs_cache.shader_map[uid];
+  entry.pending = true;
+  entry.priority = priority;
   auto wi = m_async_shader_compiler->CreateWorkItem<VertexUberShaderWorkItem>(this, uid);
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
 }
@@ -979,7 +1141,9 @@ void ShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid, u32 priorit
     PixelShaderUid uid;
   };
 
-  m_ps_cache.shader_map[uid].pending = true;
+  auto& entry = m_ps_cache.shader_map[uid];
+  entry.pending = true;
+  entry.priority = priority;
   auto wi = m_async_shader_compiler->CreateWorkItem<PixelShaderWorkItem>(this, uid);
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
 }
@@ -1008,7 +1172,9 @@ void ShaderCache::QueuePixelUberShaderCompile(const UberShader::PixelShaderUid&
     UberShader::PixelShaderUid uid;
   };
 
-  m_uber_ps_cache.shader_map[uid].pending = true;
+  auto& entry = m_uber_ps_cache.shader_map[uid];
+  entry.pending = true;
+  entry.priority = priority;
   auto wi = m_async_shader_compiler->CreateWorkItem<PixelUberShaderWorkItem>(this, uid);
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
 }
@@ -1033,18 +1199,26 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
 
       GXPipelineUid actual_uid = ApplyDriverBugs(uid);
 
+      // Stages still pending at a later priority are queued again, as the pipeline would
+      // otherwise wait for them anyway.
       auto vs_it = shader_cache->m_vs_cache.shader_map.find(actual_uid.vs_uid);
       stages_ready &= vs_it != shader_cache->m_vs_cache.shader_map.end() && !vs_it->second.pending;
-      if (vs_it == shader_cache->m_vs_cache.shader_map.end())
+      if (vs_it == shader_cache->m_vs_cache.shader_map.end() ||
+          (vs_it->second.pending && vs_it->second.priority > priority))
+      {
         shader_cache->QueueVertexShaderCompile(actual_uid.vs_uid, priority);
+      }
 
       PixelShaderUid ps_uid = actual_uid.ps_uid;
       ClearUnusedPixelShaderUidBits(shader_cache->m_api_type, shader_cache->m_host_config, &ps_uid);
 
       auto ps_it = shader_cache->m_ps_cache.shader_map.find(ps_uid);
       stages_ready &= ps_it != shader_cache->m_ps_cache.shader_map.end() && !ps_it->second.pending;
-      if (ps_it == shader_cache->m_ps_cache.shader_map.end())
+      if (ps_it == shader_cache->m_ps_cache.shader_map.end() ||
+          (ps_it->second.pending && ps_it->second.priority > priority))
+      {
         shader_cache->QueuePixelShaderCompile(ps_uid, priority);
+      }
 
       return stages_ready;
     }
@@ -1062,9 +1236,10 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
       {
         shader_cache->InsertGXPipeline(uid, std::move(pipeline));
       }
-      else
+      else if (const auto it = shader_cache->m_gx_pipeline_cache.find(uid);
+               it != shader_cache->m_gx_pipeline_cache.end() && it->second.second)
       {
-        // Re-queue for next frame.
+        // Re-queue for next frame, unless a work item queued on demand already finished it.
         auto wi = shader_cache->m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(
             shader_cache, uid, priority);
         shader_cache->m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
@@ -1083,6 +1258,8 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
   auto wi = m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(this, uid, priority);
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
   m_gx_pipeline_cache[uid].second = true;
+  if (priority >= COMPILE_PRIORITY_SHADERCACHE_PIPELINE)
+    m_shader_cache_pending_pipelines.insert(uid);
 }
 
 void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 priority)
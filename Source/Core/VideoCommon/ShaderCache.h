@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -62,13 +63,37 @@ public:
   // Retrieves all pending shaders/pipelines from the async compiler.
   void RetrieveAsyncShaders();
 
-  // Accesses ShaderGen shader caches
+  // Accesses ShaderGen shader caches. uid_hash is GXPipelineUidHash(uid).Get(), which callers
+  // looking up pipelines on every state change can keep up to date as the state changes.
   const AbstractPipeline* GetPipelineForUid(const GXPipelineUid& uid);
+  const AbstractPipeline* GetPipelineForUid(const GXPipelineUid& uid, u64 uid_hash);
   const AbstractPipeline* GetUberPipelineForUid(const GXUberPipelineUid& uid);
+  // Queues the ubershader pipeline for compilation if it isn't compiled yet, and returns it if
+  // it is ready.
+  std::optional<const AbstractPipeline*> GetUberPipelineForUidAsync(const GXUberPipelineUid& uid);
 
   // Accesses ShaderGen shader caches asynchronously.
   // The optional will be empty if this pipeline is now background compiling.
   std::optional<const AbstractPipeline*> GetPipelineForUidAsync(const GXPipelineUid& uid);
+  std::optional<const AbstractPipeline*> GetPipelineForUidAsync(const GXPipelineUid& uid,
+                                                                u64 uid_hash);
+
+  // Priorities for compiling. The lower the value, the sooner the pipeline is compiled.
+  // The shader cache is compiled last, as it is the least likely to be required. On demand
+  // shaders are always compiled before pending ubershaders, as we want to use the ubershader
+  // for as few frames as possible, otherwise we risk framerate drops.
+  enum : u32
+  {
+    COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
+    COMPILE_PRIORITY_UBERSHADER_PIPELINE = 200,
+    COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
+  };
+
+  // Queue depth and latency of the background compiles, by priority.
+  std::map<u32, AsyncShaderCompiler::PriorityStats> GetAsyncCompilerStats() const
+  {
+    return m_async_shader_compiler->GetStats();
+  }
 
   // Shared shaders
   const AbstractShader* GetScreenQuadVertexShader() const
@@ -122,6 +147,9 @@ private:
   void ClearCaches();
   void LoadPipelineUIDCache();
   void ClosePipelineUIDCache();
+  // Adds the UIDs of the bundles in Load/ShaderUIDs/<game id>/ to the UID cache.
+  void ImportPipelineUIDBundles();
+  size_t ImportPipelineUIDBundle(const std::string& filename);
   void CompileMissingPipelines();
   void QueueUberShaderPipelines();
   bool CompileSharedPipelines();
@@ -159,7 +187,8 @@ private:
                                            std::unique_ptr<AbstractPipeline> pipeline);
   const AbstractPipeline* InsertGXUberPipeline(const GXUberPipelineUid& config,
                                                std::unique_ptr<AbstractPipeline> pipeline);
-  void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
+  // Returns false if the pipeline was already known.
+  bool AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
   void AppendGXPipelineUID(const GXPipelineUid& config);
 
   // ASync Compiler Methods
@@ -181,17 +210,6 @@ private:
   template <typename T, typename Y>
   void ClearPipelineCache(T& cache, Y& disk_cache);
 
-  // Priorities for compiling. The lower the value, the sooner the pipeline is compiled.
-  // The shader cache is compiled last, as it is the least likely to be required. On demand
-  // shaders are always compiled before pending ubershaders, as we want to use the ubershader
-  // for as few frames as possible, otherwise we risk framerate drops.
-  enum : u32
-  {
-    COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
-    COMPILE_PRIORITY_UBERSHADER_PIPELINE = 200,
-    COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
-  };
-
   // Configuration bits.
   APIType m_api_type;
   ShaderHostConfig m_host_config = {};
@@ -214,6 +232,8 @@ private:
     {
       std::unique_ptr<AbstractShader> shader;
       bool pending = false;
+      // Of the queued compile, while pending.
+      u32 priority = 0;
     };
     std::map<Uid, Shader> shader_map;
     Common::LinearDiskCache<Uid, u8> disk_cache;
@@ -228,6 +248,23 @@ private:
   std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
   std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
       m_gx_uber_pipeline_cache;
+  // Direct-mapped cache of the last compiled pipelines looked up, in front of m_gx_pipeline_cache.
+  // The UID points to the key in the map, which stays valid until the caches are cleared.
+  struct PipelineLookupCacheEntry
+  {
+    u64 uid_hash = 0;
+    const GXPipelineUid* uid = nullptr;
+    const AbstractPipeline* pipeline = nullptr;
+  };
+  static constexpr size_t PIPELINE_LOOKUP_CACHE_SIZE = 256;
+  PipelineLookupCacheEntry* FindInPipelineLookupCache(const GXPipelineUid& uid, u64 uid_hash);
+  void AddToPipelineLookupCache(const GXPipelineUid& uid, u64 uid_hash,
+                                const AbstractPipeline* pipeline);
+  std::array<PipelineLookupCacheEntry, PIPELINE_LOOKUP_CACHE_SIZE> m_pipeline_lookup_cache{};
+
+  // Pending pipelines queued from the shader cache. They are queued again on demand when a draw
+  // needs them, instead of waiting behind the rest of the shader cache.
+  std::set<GXPipelineUid> m_shader_cache_pending_pipelines;
   File::IOFile m_gx_pipeline_uid_cache_file;
   Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
@@ -13,6 +13,7 @@
 #include "Core/System.h"
 
 #include "VideoCommon/BPFunctions.h"
+#include "VideoCommon/ShaderCache.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/VideoEvents.h"
@@ -106,6 +107,25 @@ void Statistics::Display() const
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
   draw_statistic("Tokens:", "%d/%d", this_frame.num_token, this_frame.num_token_int);
 
+  if (g_shader_cache)
+  {
+    for (const auto& [priority, stats] : g_shader_cache->GetAsyncCompilerStats())
+    {
+      const char* name = "Compiles (other)";
+      if (priority == VideoCommon::ShaderCache::COMPILE_PRIORITY_ONDEMAND_PIPELINE)
+        name = "Compiles (on demand)";
+      else if (priority == VideoCommon::ShaderCache::COMPILE_PRIORITY_UBERSHADER_PIPELINE)
+        name = "Compiles (ubershaders)";
+      else if (priority == VideoCommon::ShaderCache::COMPILE_PRIORITY_SHADERCACHE_PIPELINE)
+        name = "Compiles (shader cache)";
+
+      const double average_ms =
+          stats.compiled != 0 ? stats.total_latency.count() / 1000.0 / stats.compiled : 0.0;
+      draw_statistic(name, "%zu queued, %zu done, %.1f/%.1f ms", stats.pending, stats.compiled,
+                     average_ms, stats.max_latency.count() / 1000.0);
+    }
+  }
+
   ImGui::Columns(1);
 
   ImGui::End();
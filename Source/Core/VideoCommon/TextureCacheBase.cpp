@@ -23,6 +23,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/EnumUtils.h"
 #include "Common/FileUtil.h"
+#include "Common/FrameProfiler.h"
 #include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
@@ -66,6 +67,28 @@ static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
 
 static int xfb_count = 0;
 
+// Has decode write a level of the texture directly into the backend's upload memory where it can,
+// or else into temp_buffer, which is then loaded. keep_decoded forces the latter, for when the
+// decoded data is read again afterwards.
+template <typename DecodeFunc>
+static void DecodeAndLoad(AbstractTexture* texture, u32 level, u32 width, u32 height,
+                          u32 row_length, u8* temp_buffer, size_t size, bool keep_decoded,
+                          DecodeFunc decode)
+{
+  if (!keep_decoded)
+  {
+    if (u8* const upload_buffer = texture->MapLoadBuffer(level, width, height, row_length, size))
+    {
+      decode(upload_buffer);
+      texture->CommitLoad();
+      return;
+    }
+  }
+
+  decode(temp_buffer);
+  texture->Load(level, width, height, row_length, temp_buffer, size);
+}
+
 std::unique_ptr<TextureCacheBase> g_texture_cache;
 
 TCacheEntry::TCacheEntry(std::unique_ptr<AbstractTexture> tex,
@@ -109,11 +132,14 @@ void TextureCacheBase::Shutdown()
 {
   // Clear pending EFB copies first, so we don't try to flush them.
   m_pending_efb_copies.clear();
+  m_pending_ram_only_efb_copies.clear();
 
   HiresTexture::Shutdown();
 
   // For correctness, we need to invalidate textures before the gpu context starts shutting down.
   Invalidate();
+
+  TexDecoder_SetDecodeThreads(0);
 }
 
 TextureCacheBase::~TextureCacheBase()
@@ -130,6 +156,7 @@ bool TextureCacheBase::Initialize()
     return false;
   }
 
+  TexDecoder_SetDecodeThreads(g_ActiveConfig.iTextureDecoderThreads);
   return true;
 }
 
@@ -163,6 +190,7 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
       config.bTexFmtOverlayCenter != m_backup_config.texfmt_overlay_center ||
       config.bHiresTextures != m_backup_config.hires_textures ||
       config.bEnableGPUTextureDecoding != m_backup_config.gpu_texture_decoding ||
+      config.bAutoGPUTextureDecoding != m_backup_config.auto_gpu_texture_decoding ||
       config.bDisableCopyToVRAM != m_backup_config.disable_vram_copies ||
       config.bArbitraryMipmapDetection != m_backup_config.arbitrary_mipmap_detection ||
       config.bGraphicMods != m_backup_config.graphics_mods ||
@@ -172,6 +200,8 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
   }
 
+  TexDecoder_SetDecodeThreads(config.iTextureDecoderThreads);
+
   SetBackupConfig(config);
 }
 
@@ -255,6 +285,7 @@ void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
   m_backup_config.stereo_3d = config.stereo_mode != StereoMode::Off;
   m_backup_config.efb_mono_depth = config.bStereoEFBMonoDepth;
   m_backup_config.gpu_texture_decoding = config.bEnableGPUTextureDecoding;
+  m_backup_config.auto_gpu_texture_decoding = config.bAutoGPUTextureDecoding;
   m_backup_config.disable_vram_copies = config.bDisableCopyToVRAM;
   m_backup_config.arbitrary_mipmap_detection = config.bArbitraryMipmapDetection;
   m_backup_config.graphics_mods = config.bGraphicMods;
@@ -1338,6 +1369,9 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
                                                             MemoryUpdate::Type::TextureMap);
   }
 
+  if (!texture_info.IsFromTmem())
+    FlushEFBCopiesInRange(texture_info.GetRawAddress(), texture_info.GetFullLevelSize());
+
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
   base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
@@ -1647,6 +1681,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   }
   else
   {
+    Common::FrameProfiler::Scope profiler_scope(Common::FrameProfiler::Stage::TextureDecode);
+
     const u32 texLevels = no_mips ? 1 : texture_info.GetLevelCount();
     const u32 expanded_width = texture_info.GetExpandedWidth();
     const u32 expanded_height = texture_info.GetExpandedHeight();
@@ -1660,16 +1696,19 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     if (!entry) [[unlikely]]
       return entry;
 
-    // We can decode on the GPU if it is a supported format and the flag is enabled.
+    // We can decode on the GPU if it is a supported format and the flag is enabled, or if the
+    // texture is large enough for it to pay off.
     // Currently we don't decode RGBA8 textures from TMEM, as that would require copying from both
     // banks, and if we're doing an copy we may as well just do the whole thing on the CPU, since
     // there's no conversion between formats. In the future this could be extended with a separate
     // shader, however.
     const bool decode_on_gpu =
-        g_ActiveConfig.UseGPUTextureDecoding() &&
+        g_ActiveConfig.ShouldDecodeTextureOnGPU(expanded_width, expanded_height) &&
         !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8);
 
     ArbitraryMipmapDetector arbitrary_mip_detector;
+    // The detector reads the decoded levels again, which is slow from upload memory.
+    const bool keep_decoded = texLevels > 1 && g_ActiveConfig.bArbitraryMipmapDetection;
 
     // Initialized to null because only software loading uses this buffer
     u8* dst_buffer = nullptr;
@@ -1701,20 +1740,23 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
 
       CheckTempSize(total_texture_size);
       dst_buffer = m_temp;
-      if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
-      {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
-      }
-      else
-      {
-        TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
-                                       texture_info.GetTmemOddAddress(), expanded_width,
-                                       expanded_height);
-      }
-
-      entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
+      DecodeAndLoad(entry->texture.get(), 0, width, height, expanded_width, dst_buffer,
+                    decoded_texture_size, keep_decoded, [&](u8* dst) {
+                      if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 &&
+                            texture_info.IsFromTmem()))
+                      {
+                        TexDecoder_Decode(dst, texture_info.GetData(), expanded_width,
+                                          expanded_height, texture_info.GetTextureFormat(),
+                                          texture_info.GetTlutAddress(),
+                                          texture_info.GetTlutFormat());
+                      }
+                      else
+                      {
+                        TexDecoder_DecodeRGBA8FromTmem(dst, texture_info.GetData(),
+                                                       texture_info.GetTmemOddAddress(),
+                                                       expanded_width, expanded_height);
+                      }
+                    });
 
       arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
 
@@ -1739,11 +1781,15 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         const u32 decoded_mip_size =
             mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
-        entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                             mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
+        DecodeAndLoad(entry->texture.get(), level, mip_level->GetRawWidth(),
+                      mip_level->GetRawHeight(), mip_level->GetExpandedWidth(), dst_buffer,
+                      decoded_mip_size, keep_decoded, [&](u8* dst) {
+                        TexDecoder_Decode(dst, mip_level->GetData(), mip_level->GetExpandedWidth(),
+                                          mip_level->GetExpandedHeight(),
+                                          texture_info.GetTextureFormat(),
+                                          texture_info.GetTlutAddress(),
+                                          texture_info.GetTlutFormat());
+                      });
 
         arbitrary_mip_detector.AddLevel(mip_level->GetRawWidth(), mip_level->GetRawHeight(),
                                         mip_level->GetExpandedWidth(), dst_buffer);
@@ -1816,6 +1862,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
 {
   // Compute total texture size. XFB textures aren't tiled, so this is simple.
   const u32 total_size = height * stride;
+  FlushEFBCopiesInRange(address, total_size);
 
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
@@ -1856,14 +1903,14 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
   entry->is_custom_tex = false;
   entry->may_have_overlapping_textures = false;
   entry->frameCount = FRAMECOUNT_INVALID;
-  if (!g_ActiveConfig.UseGPUTextureDecoding() ||
+  if (!g_ActiveConfig.ShouldDecodeTextureOnGPU(width, height) ||
       !DecodeTextureOnGPU(entry, 0, src_data, total_size, entry->format.texfmt, width, height,
                           width, height, stride, s_tex_mem.data(), entry->format.tlutfmt))
   {
     const u32 decoded_size = width * height * sizeof(u32);
     CheckTempSize(decoded_size);
-    TexDecoder_DecodeXFB(m_temp, src_data, width, height, stride);
-    entry->texture->Load(0, width, height, width, m_temp, decoded_size);
+    DecodeAndLoad(entry->texture.get(), 0, width, height, width, m_temp, decoded_size, false,
+                  [&](u8* dst) { TexDecoder_DecodeXFB(dst, src_data, width, height, stride); });
   }
 
   // Stitch any VRAM copies into the new RAM copy.
@@ -2121,6 +2168,28 @@ bool TextureCacheBase::CopyFilterCanOverflow(const std::array<u32, 3>& coefficie
   return coefficients[0] + coefficients[1] + coefficients[2] >= 128;
 }
 
+bool TextureCacheBase::CanPresentXFBCopyFromEFB(
+    bool is_depth_copy, float y_scale, float gamma,
+    const CopyFilterCoefficients::Values& filter_coefficients) const
+{
+  // Graphics mods and XFB dumping identify the frame by the XFB copy.
+  if (!g_ActiveConfig.bImmediateXFB || !g_ActiveConfig.bSkipXFBCopyToRam ||
+      !g_backend_info.bSupportsCopyToVram || g_ActiveConfig.bDisableCopyToVRAM ||
+      g_ActiveConfig.bDumpXFBTarget || g_ActiveConfig.bGraphicMods ||
+      !g_gfx->SupportsUtilityDrawing())
+  {
+    return false;
+  }
+
+  // Without scaling, gamma or a copy filter, the copy only differs from the EFB in its alpha,
+  // which is set to 1, and which the presenter doesn't show.
+  if (is_depth_copy || y_scale != 1.0f || gamma != 1.0f)
+    return false;
+
+  constexpr std::array<u32, 3> identity_filter = {0, 64, 0};
+  return GetVRAMCopyFilterCoefficients(filter_coefficients) == identity_filter;
+}
+
 void TextureCacheBase::CopyRenderTargetToTexture(
     u32 dstAddr, EFBCopyFormat dstFormat, u32 width, u32 height, u32 dstStride, bool is_depth_copy,
     const MathUtil::Rectangle<int>& srcRect, bool isIntensity, bool scaleByHalf, float y_scale,
@@ -2289,8 +2358,8 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   }
 
   // We also linear filtering for both box filtering and downsampling higher resolutions to 1x.
-  // TODO: This only produces perfect downsampling for 2x IR, other resolutions will need more
-  //       complex down filtering to average all pixels and produce the correct result.
+  // This only produces perfect downsampling for 2x IR, so copies to VRAM that are downscaled
+  // further average all of the texels in the copy shader instead.
   const bool linear_filter =
       !is_depth_copy &&
       (scaleByHalf || g_framebuffer_manager->GetEFBScale() != 1 || y_scale > 1.0f);
@@ -2374,16 +2443,24 @@ void TextureCacheBase::CopyRenderTargetToTexture(
       CopyEFB(staging_texture.get(), format, tex_w, bytes_per_row, num_blocks_y, dstStride, srcRect,
               scaleByHalf, linear_filter, y_scale, gamma, clamp_top, clamp_bottom, coefficients);
 
-      // We can't defer if there is no VRAM copy (since we need to update the hash).
-      if (!copy_to_vram || !g_ActiveConfig.bDeferEFBCopies)
+      if (!g_ActiveConfig.bDeferEFBCopies)
       {
         // Immediately flush it.
         WriteEFBCopyToRAM(dst, bytes_per_row / sizeof(u32), num_blocks_y, dstStride,
                           std::move(staging_texture));
       }
+      else if (!entry)
+      {
+        // There is no entry whose hash needs updating, so the copy only has to reach RAM before
+        // anything reads it.
+        DeferRAMOnlyEFBCopy(dstAddr, bytes_per_row / sizeof(u32), num_blocks_y, dstStride,
+                            std::move(staging_texture));
+      }
       else
       {
         // Defer the flush until later.
+        if (!m_pending_ram_only_efb_copies.empty())
+          FlushEFBCopies();
         entry->pending_efb_copy = std::move(staging_texture);
         entry->pending_efb_copy_width = bytes_per_row / sizeof(u32);
         entry->pending_efb_copy_height = num_blocks_y;
@@ -2490,6 +2567,18 @@ void TextureCacheBase::CopyRenderTargetToTexture(
 
 void TextureCacheBase::FlushEFBCopies()
 {
+  if (!m_pending_ram_only_efb_copies.empty())
+  {
+    auto& memory = Core::System::GetInstance().GetMemory();
+    for (PendingRAMOnlyEFBCopy& copy : m_pending_ram_only_efb_copies)
+    {
+      u8* const dst = memory.GetPointerForRange(copy.addr, copy.height * copy.stride);
+      WriteEFBCopyToRAM(dst, copy.width, copy.height, copy.stride,
+                        std::move(copy.staging_texture));
+    }
+    m_pending_ram_only_efb_copies.clear();
+  }
+
   if (m_pending_efb_copies.empty())
     return;
 
@@ -2498,6 +2587,38 @@ void TextureCacheBase::FlushEFBCopies()
   m_pending_efb_copies.clear();
 }
 
+void TextureCacheBase::FlushEFBCopiesInRange(u32 address, u32 size)
+{
+  const bool overlaps =
+      std::ranges::any_of(m_pending_ram_only_efb_copies, [&](const PendingRAMOnlyEFBCopy& copy) {
+        return copy.addr < address + size && address < copy.addr + copy.height * copy.stride;
+      });
+  if (overlaps)
+    FlushEFBCopies();
+}
+
+void TextureCacheBase::DeferRAMOnlyEFBCopy(u32 dst_addr, u32 width, u32 height, u32 stride,
+                                           std::unique_ptr<AbstractStagingTexture> staging_texture)
+{
+  if (!m_pending_efb_copies.empty())
+    FlushEFBCopies();
+
+  // Like for the copies with an entry, pending copies which this one writes over completely
+  // don't need to be flushed at all.
+  std::erase_if(m_pending_ram_only_efb_copies, [&](PendingRAMOnlyEFBCopy& copy) {
+    if (copy.addr != dst_addr || copy.stride != stride || copy.width > width ||
+        copy.height > height)
+    {
+      return false;
+    }
+    ReleaseEFBCopyStagingTexture(std::move(copy.staging_texture));
+    return true;
+  });
+
+  m_pending_ram_only_efb_copies.push_back(
+      {dst_addr, width, height, stride, std::move(staging_texture)});
+}
+
 void TextureCacheBase::FlushStaleBinds()
 {
   for (u32 i = 0; i < m_bound_textures.size(); i++)
@@ -2821,22 +2942,31 @@ void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_c
   // Flush EFB pokes first, as they're expected to be included.
   g_framebuffer_manager->FlushEFBPokes();
 
+  const auto scaled_src_rect = g_framebuffer_manager->ConvertEFBRectangle(src_rect);
+  const auto framebuffer_rect = g_gfx->ConvertFramebufferRectangle(
+      scaled_src_rect, g_framebuffer_manager->GetEFBFramebuffer());
+
+  // The copy shader reads the multisampled EFB directly, and averages every EFB texel that ends up
+  // in a texel of the copy when it is downscaled by more than the 2x a bilinear sample covers. This
+  // avoids resolving the EFB into another texture first, then reading that texture again.
+  const u32 box_width = std::max<u32>(framebuffer_rect.GetWidth() / entry->GetWidth(), 1);
+  const u32 box_height = std::max<u32>(framebuffer_rect.GetHeight() / entry->GetHeight(), 1);
+  const u32 efb_samples = g_framebuffer_manager->GetEFBSamples();
+  const bool box_filter = linear_filter && (box_width > 2 || box_height > 2);
+
   // Get the pipeline which we will be using. If the compilation failed, this will be null.
-  const AbstractPipeline* copy_pipeline = g_shader_cache->GetEFBCopyToVRAMPipeline(
-      TextureConversionShaderGen::GetShaderUid(dst_format, is_depth_copy, is_intensity,
-                                               scale_by_half, 1.0f / gamma, filter_coefficients));
+  const AbstractPipeline* copy_pipeline =
+      g_shader_cache->GetEFBCopyToVRAMPipeline(TextureConversionShaderGen::GetShaderUid(
+          dst_format, is_depth_copy, is_intensity, scale_by_half, 1.0f / gamma, filter_coefficients,
+          efb_samples, box_filter));
   if (!copy_pipeline)
   {
     WARN_LOG_FMT(VIDEO, "Skipping EFB copy to VRAM due to missing pipeline.");
     return;
   }
 
-  const auto scaled_src_rect = g_framebuffer_manager->ConvertEFBRectangle(src_rect);
-  const auto framebuffer_rect = g_gfx->ConvertFramebufferRectangle(
-      scaled_src_rect, g_framebuffer_manager->GetEFBFramebuffer());
-  AbstractTexture* src_texture =
-      is_depth_copy ? g_framebuffer_manager->ResolveEFBDepthTexture(framebuffer_rect) :
-                      g_framebuffer_manager->ResolveEFBColorTexture(framebuffer_rect);
+  AbstractTexture* src_texture = is_depth_copy ? g_framebuffer_manager->GetEFBDepthTexture() :
+                                                 g_framebuffer_manager->GetEFBColorTexture();
 
   g_gfx->BeginUtilityDrawing();
   src_texture->FinishedRendering();
@@ -2850,7 +2980,9 @@ void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_c
     float clamp_top;
     float clamp_bottom;
     float pixel_height;
-    u32 padding;
+    u32 box_width;
+    u32 box_height;
+    std::array<u32, 3> padding;
   };
   Uniforms uniforms;
   const float rcp_efb_width = 1.0f / static_cast<float>(g_framebuffer_manager->GetEFBWidth());
@@ -2872,7 +3004,9 @@ void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_c
   const u32 bottom_coord = (clamp_bottom ? framebuffer_rect.bottom : efb_height) - 1;
   uniforms.clamp_bottom = (static_cast<float>(bottom_coord) + .5f) * rcp_efb_height;
   uniforms.pixel_height = g_ActiveConfig.bCopyEFBScaled ? rcp_efb_height : 1.0f / EFB_HEIGHT;
-  uniforms.padding = 0;
+  uniforms.box_width = box_width;
+  uniforms.box_height = box_height;
+  uniforms.padding = {};
   g_vertex_manager->UploadUtilityUniforms(&uniforms, sizeof(uniforms));
 
   // Use the copy pipeline to render the VRAM copy.
@@ -291,11 +291,21 @@ public:
                                  bool clamp_bottom,
                                  const CopyFilterCoefficients::Values& filter_coefficients);
 
+  // Returns true if the XFB copy would only be presented, and would be identical to the EFB, so
+  // the EFB can be presented directly with ImmediateXFB. The copy isn't kept in the texture cache
+  // then, so this requires that XFB copies are not stored in RAM either.
+  bool CanPresentXFBCopyFromEFB(bool is_depth_copy, float y_scale, float gamma,
+                                const CopyFilterCoefficients::Values& filter_coefficients) const;
+
   void ScaleTextureCacheEntryTo(RcTcacheEntry& entry, u32 new_width, u32 new_height);
 
   // Flushes all pending EFB copies to emulated RAM.
   void FlushEFBCopies();
 
+  // Flushes all pending EFB copies if one without a VRAM copy writes to the given range, before
+  // the GPU reads it from emulated RAM.
+  void FlushEFBCopiesInRange(u32 address, u32 size);
+
   // Flush any Bound textures that can't be reused
   void FlushStaleBinds();
 
@@ -397,6 +407,10 @@ private:
                          std::unique_ptr<AbstractStagingTexture> staging_texture);
   void FlushEFBCopy(TCacheEntry* entry);
 
+  // Defers an EFB copy which has no VRAM copy, and so no cache entry to hang it off.
+  void DeferRAMOnlyEFBCopy(u32 dst_addr, u32 width, u32 height, u32 stride,
+                           std::unique_ptr<AbstractStagingTexture> staging_texture);
+
   // Returns a staging texture of the maximum EFB copy size.
   std::unique_ptr<AbstractStagingTexture> GetEFBCopyStagingTexture();
 
@@ -434,6 +448,7 @@ private:
     bool stereo_3d;
     bool efb_mono_depth;
     bool gpu_texture_decoding;
+    bool auto_gpu_texture_decoding;
     bool disable_vram_copies;
     bool arbitrary_mipmap_detection;
     bool graphics_mods;
@@ -456,6 +471,19 @@ private:
   // It's valid for textures to live be in here after they've been invalidated
   std::vector<RcTcacheEntry> m_pending_efb_copies;
 
+  // Pending EFB copies without a VRAM copy. These go to RAM at the same points as the ones above,
+  // or earlier if the GPU reads from their range. Only one of the two lists is ever non-empty,
+  // so that the order in which the copies were issued is kept when flushing them.
+  struct PendingRAMOnlyEFBCopy
+  {
+    u32 addr;
+    u32 width;
+    u32 height;
+    u32 stride;
+    std::unique_ptr<AbstractStagingTexture> staging_texture;
+  };
+  std::vector<PendingRAMOnlyEFBCopy> m_pending_ram_only_efb_copies;
+
   // Staging texture used for readbacks.
   // We store this in the class so that the same staging texture can be used for multiple
   // readbacks, saving the overhead of allocating a new buffer every time.
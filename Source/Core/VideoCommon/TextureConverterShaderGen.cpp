@@ -14,7 +14,8 @@ namespace TextureConversionShaderGen
 {
 TCShaderUid GetShaderUid(EFBCopyFormat dst_format, bool is_depth_copy, bool is_intensity,
                          bool scale_by_half, float gamma_rcp,
-                         const std::array<u32, 3>& filter_coefficients)
+                         const std::array<u32, 3>& filter_coefficients, u32 efb_samples,
+                         bool box_filter)
 {
   TCShaderUid out;
 
@@ -49,6 +50,9 @@ TCShaderUid GetShaderUid(EFBCopyFormat dst_format, bool is_depth_copy, bool is_i
   uid_data->copy_filter_can_overflow = TextureCacheBase::CopyFilterCanOverflow(filter_coefficients);
   // If the gamma is needed, then include that too.
   uid_data->apply_gamma = gamma_rcp != 1.0f;
+  uid_data->efb_samples = efb_samples;
+  // Depth copies are point sampled.
+  uid_data->box_filter = box_filter && !is_depth_copy;
 
   return out;
 }
@@ -61,6 +65,8 @@ static void WriteHeader(APIType api_type, ShaderCode& out)
             "  float gamma_rcp;\n"
             "  float2 clamp_tb;\n"
             "  float pixel_height;\n"
+            "  uint box_width;\n"
+            "  uint box_height;\n"
             "}};\n");
 }
 
@@ -96,6 +102,66 @@ ShaderCode GenerateVertexShader(APIType api_type)
   return out;
 }
 
+// Reads the EFB texels with texelFetch, so that the MSAA resolve and the downscale to the size of
+// the copy happen in the copy shader, without going through an intermediate texture.
+static void WriteFetchEFB(ShaderCode& out, const UidData* uid_data, bool mono_depth)
+{
+  const bool multisampled = uid_data->efb_samples > 1;
+  out.Write("SAMPLER_BINDING(0) uniform {} samp0;\n",
+            multisampled ? "sampler2DMSArray" : "sampler2DArray");
+
+  out.Write("float4 FetchEFB(int3 coords) {{\n");
+  if (!multisampled)
+  {
+    out.Write("  return texelFetch(samp0, coords, 0);\n");
+  }
+  else if (uid_data->is_depth_copy)
+  {
+    // Take the minimum of all depth samples, like the depth resolve shader.
+    out.Write("  float4 value = texelFetch(samp0, coords, 0);\n"
+              "  for (int i = 1; i < {}; i++)\n"
+              "    value.x = min(value.x, texelFetch(samp0, coords, i).x);\n"
+              "  return value;\n",
+              uid_data->efb_samples);
+  }
+  else
+  {
+    out.Write("  float4 value = float4(0.0, 0.0, 0.0, 0.0);\n"
+              "  for (int i = 0; i < {}; i++)\n"
+              "    value += texelFetch(samp0, coords, i);\n"
+              "  return value / {}.0;\n",
+              uid_data->efb_samples, uid_data->efb_samples);
+  }
+  out.Write("}}\n");
+
+  out.Write("uint4 SampleEFB(float3 uv, float y_offset) {{\n"
+            "  int2 efb_size = textureSize(samp0{}).xy;\n"
+            "  float2 center = float2(uv.x, uv.y + (y_offset * pixel_height)) * float2(efb_size);\n"
+            "  int2 clamp_rows = int2(clamp_tb * float(efb_size.y));\n"
+            "  int layer = {};\n",
+            multisampled ? "" : ", 0", mono_depth ? "0" : "int(uv.z)");
+  if (uid_data->box_filter)
+  {
+    out.Write("  int2 first = int2(floor(center - float2(box_width, box_height) * 0.5 + 0.5));\n"
+              "  float4 tex_sample = float4(0.0, 0.0, 0.0, 0.0);\n"
+              "  for (uint y = 0u; y < box_height; y++) {{\n"
+              "    int row = clamp(first.y + int(y), clamp_rows.x, clamp_rows.y);\n"
+              "    for (uint x = 0u; x < box_width; x++) {{\n"
+              "      int column = clamp(first.x + int(x), 0, efb_size.x - 1);\n"
+              "      tex_sample += FetchEFB(int3(column, row, layer));\n"
+              "    }}\n"
+              "  }}\n"
+              "  tex_sample /= float(box_width * box_height);\n");
+  }
+  else
+  {
+    out.Write("  int2 texel = int2(floor(center));\n"
+              "  float4 tex_sample = FetchEFB(int3(clamp(texel.x, 0, efb_size.x - 1),\n"
+              "                                    clamp(texel.y, clamp_rows.x, clamp_rows.y),\n"
+              "                                    layer));\n");
+  }
+}
+
 ShaderCode GeneratePixelShader(APIType api_type, const UidData* uid_data)
 {
   const bool mono_depth = uid_data->is_depth_copy && g_ActiveConfig.bStereoEFBMonoDepth;
@@ -103,11 +169,18 @@ ShaderCode GeneratePixelShader(APIType api_type, const UidData* uid_data)
   ShaderCode out;
   WriteHeader(api_type, out);
 
-  out.Write("SAMPLER_BINDING(0) uniform sampler2DArray samp0;\n");
-  out.Write("uint4 SampleEFB(float3 uv, float y_offset) {{\n"
-            "  float4 tex_sample = texture(samp0, float3(uv.x, clamp(uv.y + (y_offset * "
-            "pixel_height), clamp_tb.x, clamp_tb.y), {}));\n",
-            mono_depth ? "0.0" : "uv.z");
+  if (uid_data->efb_samples > 1 || uid_data->box_filter)
+  {
+    WriteFetchEFB(out, uid_data, mono_depth);
+  }
+  else
+  {
+    out.Write("SAMPLER_BINDING(0) uniform sampler2DArray samp0;\n");
+    out.Write("uint4 SampleEFB(float3 uv, float y_offset) {{\n"
+              "  float4 tex_sample = texture(samp0, float3(uv.x, clamp(uv.y + (y_offset * "
+              "pixel_height), clamp_tb.x, clamp_tb.y), {}));\n",
+              mono_depth ? "0.0" : "uv.z");
+  }
   if (uid_data->is_depth_copy)
   {
     if (!g_backend_info.bSupportsReversedDepthRange)
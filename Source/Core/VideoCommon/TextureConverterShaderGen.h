@@ -28,6 +28,11 @@ struct UidData
   u32 all_copy_filter_coefs_needed : 1;
   u32 copy_filter_can_overflow : 1;
   u32 apply_gamma : 1;
+  // Resolves the EFB samples in the copy shader, instead of copying from a resolved texture.
+  u32 efb_samples : 5;
+  // Averages all of the EFB texels covered by each texel of the copy, instead of taking one
+  // bilinear sample, which loses texels when downscaling by more than 2x.
+  u32 box_filter : 1;
 };
 #pragma pack()
 
@@ -38,7 +43,8 @@ ShaderCode GeneratePixelShader(APIType api_type, const UidData* uid_data);
 
 TCShaderUid GetShaderUid(EFBCopyFormat dst_format, bool is_depth_copy, bool is_intensity,
                          bool scale_by_half, float gamma_rcp,
-                         const std::array<u32, 3>& filter_coefficients);
+                         const std::array<u32, 3>& filter_coefficients, u32 efb_samples,
+                         bool box_filter);
 
 }  // namespace TextureConversionShaderGen
 
@@ -57,9 +63,11 @@ struct fmt::formatter<TextureConversionShaderGen::UidData>
     return fmt::format_to(ctx.out(),
                           "dst_format: {}, efb_has_alpha: {}, is_depth_copy: {}, is_intensity: {}, "
                           "scale_by_half: {}, all_copy_filter_coefs_needed: {}, "
-                          "copy_filter_can_overflow: {}, apply_gamma: {}",
+                          "copy_filter_can_overflow: {}, apply_gamma: {}, efb_samples: {}, "
+                          "box_filter: {}",
                           dst_format, uid.efb_has_alpha, uid.is_depth_copy, uid.is_intensity,
                           uid.scale_by_half, uid.all_copy_filter_coefs_needed,
-                          uid.copy_filter_can_overflow, uid.apply_gamma);
+                          uid.copy_filter_can_overflow, uid.apply_gamma, uid.efb_samples,
+                          uid.box_filter);
   }
 };
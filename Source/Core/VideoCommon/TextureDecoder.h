@@ -203,6 +203,10 @@ void TexDecoder_DecodeXFB(u8* dst, const u8* src, u32 width, u32 height, u32 str
 
 void TexDecoder_SetTexFmtOverlayOptions(bool enable, bool center);
 
+// Large textures are split into block rows and decoded by this many threads along with the one
+// calling TexDecoder_Decode. TexDecoder_Decode must then only be called from one thread at a time.
+void TexDecoder_SetDecodeThreads(int num_threads);
+
 /* Internal method, implemented by TextureDecoder_Generic and TextureDecoder_x64. */
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt);
@@ -5,12 +5,18 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <latch>
+#include <memory>
 #include <span>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
 #include "Common/SpanUtils.h"
 #include "Common/Swap.h"
+#include "Common/WorkQueueThread.h"
 
 #include "VideoCommon/LookUpTables.h"
 #include "VideoCommon/TextureDecoder.h"
@@ -20,6 +26,23 @@
 static bool TexFmt_Overlay_Enable = false;
 static bool TexFmt_Overlay_Center = false;
 
+// Textures with fewer texels than this are decoded by the calling thread alone.
+constexpr int PARALLEL_DECODE_MIN_TEXELS = 256 * 256;
+
+struct PartialDecode
+{
+  u32* dst;
+  const u8* src;
+  int width;
+  int height;
+  TextureFormat texformat;
+  const u8* tlut;
+  TLUTFormat tlutfmt;
+  std::latch* done;
+};
+
+static std::vector<std::unique_ptr<Common::WorkQueueThreadSP<PartialDecode>>> s_decode_threads;
+
 // TRAM
 // STATE_TO_SAVE
 alignas(16) std::array<u8, TMEM_SIZE> s_tex_mem;
@@ -298,10 +321,60 @@ static void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat
   }
 }
 
+void TexDecoder_SetDecodeThreads(int num_threads)
+{
+  const size_t thread_count = static_cast<size_t>(std::max(num_threads, 0));
+  if (s_decode_threads.size() == thread_count)
+    return;
+
+  s_decode_threads.clear();
+  for (size_t i = 0; i < thread_count; ++i)
+  {
+    s_decode_threads.push_back(std::make_unique<Common::WorkQueueThreadSP<PartialDecode>>(
+        fmt::format("Texture Decoder {}", i), [](PartialDecode decode) {
+          _TexDecoder_DecodeImpl(decode.dst, decode.src, decode.width, decode.height,
+                                 decode.texformat, decode.tlut, decode.tlutfmt);
+          decode.done->count_down();
+        }));
+  }
+}
+
+// The encoded texture is stored block row by block row, so every thread decodes a range of them.
+static void DecodeInParallel(u32* dst, const u8* src, int width, int height,
+                             TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
+{
+  const int block_height = TexDecoder_GetBlockHeightInTexels(texformat);
+  const int block_rows = (height + block_height - 1) / block_height;
+  const int part_count = std::min(static_cast<int>(s_decode_threads.size()) + 1, block_rows);
+  const int rows_per_part = (block_rows + part_count - 1) / part_count * block_height;
+  const int thread_parts = (height - 1) / rows_per_part;
+
+  std::latch done(thread_parts);
+  for (int i = 0; i < thread_parts; ++i)
+  {
+    const int first_row = (i + 1) * rows_per_part;
+    const int part_height = std::min(rows_per_part, height - first_row);
+    s_decode_threads[i]->Push({dst + first_row * width,
+                               src + TexDecoder_GetTextureSizeInBytes(width, first_row, texformat),
+                               width, part_height, texformat, tlut, tlutfmt, &done});
+  }
+
+  _TexDecoder_DecodeImpl(dst, src, width, std::min(rows_per_part, height), texformat, tlut,
+                         tlutfmt);
+  done.wait();
+}
+
 void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
                        const u8* tlut, TLUTFormat tlutfmt)
 {
-  _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
+  if (!s_decode_threads.empty() && width * height >= PARALLEL_DECODE_MIN_TEXELS)
+  {
+    DecodeInParallel((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
+  }
+  else
+  {
+    _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
+  }
 
   if (TexFmt_Overlay_Enable)
     TexDecoder_DrawOverlay(dst, width, height, texformat);
@@ -36,6 +36,13 @@ PixelShaderUid GetPixelShaderUid()
   return out;
 }
 
+PixelShaderUid GetStageSpecializedPixelShaderUid(const PixelShaderUid& uid)
+{
+  PixelShaderUid out = uid;
+  out.GetUidData()->num_tev_stages = bpmem.genMode.numtevstages + 1;
+  return out;
+}
+
 void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& host_config,
                                    PixelShaderUid* uid)
 {
@@ -573,8 +580,16 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
   out.Write("void main()\n{{\n");
   out.Write("  float4 rawpos = gl_FragCoord;\n");
 
-  out.Write("  uint num_stages = {};\n\n",
-            BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  // A constant number of stages lets the compiler unroll the TEV loop and fold the stage indices.
+  if (uid_data->num_tev_stages != 0)
+  {
+    out.Write("  const uint num_stages = {}u;\n\n", uid_data->num_tev_stages - 1);
+  }
+  else
+  {
+    out.Write("  uint num_stages = {};\n\n",
+              BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  }
 
   if (use_framebuffer_fetch)
   {
@@ -19,6 +19,9 @@ struct pixel_ubershader_uid_data
   u32 per_pixel_depth : 1;
   u32 uint_output : 1;
   u32 no_dual_src : 1;
+  // 0 reads the number of TEV stages from the uniforms, otherwise the number of stages the shader
+  // is specialized for.
+  u32 num_tev_stages : 5;
 
   u32 NumValues() const { return sizeof(pixel_ubershader_uid_data); }
 };
@@ -27,6 +30,10 @@ struct pixel_ubershader_uid_data
 using PixelShaderUid = ShaderUid<pixel_ubershader_uid_data>;
 
 PixelShaderUid GetPixelShaderUid();
+// Returns the ubershader specialized for the current number of TEV stages, in addition to the
+// number of texgens. Its TEV loop has a constant bound, which makes it much cheaper on the GPU
+// than the full ubershader, while it still compiles quickly. Not part of the precompiled set.
+PixelShaderUid GetStageSpecializedPixelShaderUid(const PixelShaderUid& uid);
 
 ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
                           const pixel_ubershader_uid_data* uid_data);
@@ -44,7 +51,8 @@ struct fmt::formatter<UberShader::pixel_ubershader_uid_data>
   auto format(const UberShader::pixel_ubershader_uid_data& uid, FormatContext& ctx) const
   {
     return fmt::format_to(
-        ctx.out(), "Pixel UberShader for {} texgens{}{}{}{}", uid.num_texgens,
+        ctx.out(), "Pixel UberShader for {} texgens{}{}{}{}{}", uid.num_texgens,
+        uid.num_tev_stages != 0 ? fmt::format(", {} TEV stages", uid.num_tev_stages) : "",
         uid.early_depth ? ", early-depth" : "", uid.per_pixel_depth ? ", per-pixel depth" : "",
         uid.uint_output ? ", uint output" : "", uid.no_dual_src ? ", no dual-source blending" : "");
   }
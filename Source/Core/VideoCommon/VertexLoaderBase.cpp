@@ -239,8 +239,13 @@ u32 VertexLoaderBase::GetVertexComponents(const TVtxDesc& vtx_desc, const VAT& v
 std::unique_ptr<VertexLoaderBase> VertexLoaderBase::CreateVertexLoader(const TVtxDesc& vtx_desc,
                                                                        const VAT& vtx_attr)
 {
-  const VertexLoaderType loader_type = g_ActiveConfig.vertex_loader_type;
+  return CreateVertexLoader(vtx_desc, vtx_attr, g_ActiveConfig.vertex_loader_type);
+}
 
+std::unique_ptr<VertexLoaderBase> VertexLoaderBase::CreateVertexLoader(const TVtxDesc& vtx_desc,
+                                                                       const VAT& vtx_attr,
+                                                                       VertexLoaderType loader_type)
+{
   if (loader_type == VertexLoaderType::Software)
   {
     return std::make_unique<VertexLoader>(vtx_desc, vtx_attr);
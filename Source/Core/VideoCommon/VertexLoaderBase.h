@@ -10,6 +10,8 @@
 
 #include "Common/CommonTypes.h"
 #include "VideoCommon/CPMemory.h"
+
+enum class VertexLoaderType : int;
 #include "VideoCommon/NativeVertexFormat.h"
 
 class VertexLoaderUID
@@ -28,10 +30,29 @@ public:
     vid[4] = vat.g2.Hex;
     hash = CalculateHash();
   }
+  explicit VertexLoaderUID(const std::array<u32, 5>& data) : vid(data) { hash = CalculateHash(); }
 
   bool operator==(const VertexLoaderUID& rh) const { return vid == rh.vid; }
   size_t GetHash() const { return hash; }
 
+  // The raw words of the uid, for the on-disk cache.
+  const std::array<u32, 5>& GetData() const { return vid; }
+  TVtxDesc GetVtxDesc() const
+  {
+    TVtxDesc vtx_desc;
+    vtx_desc.low.Hex = vid[0];
+    vtx_desc.high.Hex = vid[1];
+    return vtx_desc;
+  }
+  VAT GetVAT() const
+  {
+    VAT vat;
+    vat.g0.Hex = vid[2];
+    vat.g1.Hex = vid[3];
+    vat.g2.Hex = vid[4];
+    return vat;
+  }
+
 private:
   size_t CalculateHash() const
   {
@@ -59,9 +80,18 @@ public:
   static u32 GetVertexComponents(const TVtxDesc& vtx_desc, const VAT& vtx_attr);
   static std::unique_ptr<VertexLoaderBase> CreateVertexLoader(const TVtxDesc& vtx_desc,
                                                               const VAT& vtx_attr);
+  // Safe off the GPU thread, as it doesn't read the active config.
+  static std::unique_ptr<VertexLoaderBase>
+  CreateVertexLoader(const TVtxDesc& vtx_desc, const VAT& vtx_attr, VertexLoaderType loader_type);
   virtual ~VertexLoaderBase() {}
   virtual int RunVertices(const u8* src, u8* dst, int count) = 0;
 
+  // Like RunVertices, but leaves the caches of the last vertices and m_numLoadedVertices alone, so
+  // that other threads can load the start of a draw while RunVertices loads its end. Only usable
+  // if SupportsPartialLoading returns true.
+  virtual bool SupportsPartialLoading() const { return false; }
+  virtual int RunVerticesWithoutCaches(const u8* src, u8* dst, int count) { return 0; }
+
   // per loader public state
   PortableVertexDeclaration m_native_vtx_decl{};
   const u32 m_vertex_size;  // number of bytes of a raw GC vertex
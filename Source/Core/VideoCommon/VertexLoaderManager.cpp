@@ -4,19 +4,31 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <iterator>
+#include <latch>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/FileUtil.h"
+#include "Common/FrameProfiler.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#include "Common/WorkQueueThread.h"
 
+#include "Core/ConfigManager.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -53,6 +65,12 @@ static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
 // TODO - change into array of pointers. Keep a map of all seen so far.
 
+// The uids of every loader created for the game, appended to as they are created. Guarded by
+// s_vertex_loader_map_lock.
+static File::IOFile s_loader_uid_cache_file;
+static std::thread s_precompile_thread;
+static std::atomic<bool> s_stop_precompiling;
+
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
 
 BitSet8 g_main_vat_dirty;
@@ -62,6 +80,21 @@ std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_main_vertex_loaders;
 std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_preprocess_vertex_loaders;
 bool g_needs_cp_xf_consistency_check;
 
+// Draws with fewer vertices than this are loaded on the GPU thread alone.
+constexpr int PARALLEL_LOADING_MIN_VERTICES = 2048;
+
+struct PartialLoad
+{
+  VertexLoaderBase* loader;
+  const u8* src;
+  u8* dst;
+  int count;
+  int* num_loaded;
+  std::latch* done;
+};
+
+static std::vector<std::unique_ptr<Common::WorkQueueThreadSP<PartialLoad>>> s_loader_threads;
+
 void Init()
 {
   MarkAllDirty();
@@ -72,11 +105,145 @@ void Init()
 
 void Clear()
 {
+  s_loader_threads.clear();
+
+  if (s_precompile_thread.joinable())
+  {
+    s_stop_precompiling.store(true, std::memory_order_relaxed);
+    s_precompile_thread.join();
+  }
+
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  s_loader_uid_cache_file.Close();
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
 }
 
+static void AppendLoaderUID(const VertexLoaderUID& uid)
+{
+  if (!s_loader_uid_cache_file.IsOpen())
+    return;
+
+  if (!s_loader_uid_cache_file.WriteArray(uid.GetData()))
+  {
+    WARN_LOG_FMT(VIDEO, "Writing vertex loader UID to cache failed, closing file.");
+    s_loader_uid_cache_file.Close();
+  }
+}
+
+static void PrecompileLoaders(std::vector<VertexLoaderUID> uids, VertexLoaderType loader_type)
+{
+  Common::SetCurrentThreadName("Vertex loader precompiler");
+
+  for (const VertexLoaderUID& uid : uids)
+  {
+    if (s_stop_precompiling.load(std::memory_order_relaxed))
+      break;
+
+    {
+      std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+      if (s_vertex_loader_map.contains(uid))
+        continue;
+    }
+
+    // Compile outside of the lock, so that the GPU thread only waits for the loaders it needs.
+    // The native vertex format is left for the GPU thread to create when the loader is first used.
+    auto loader = VertexLoaderBase::CreateVertexLoader(uid.GetVtxDesc(), uid.GetVAT(), loader_type);
+
+    std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+    if (s_vertex_loader_map.try_emplace(uid, std::move(loader)).second)
+      INCSTAT(g_stats.num_vertex_loaders);
+  }
+
+  INFO_LOG_FMT(VIDEO, "Precompiled {} vertex loaders", uids.size());
+}
+
+void InitializeLoaderCache()
+{
+  if (!g_ActiveConfig.bShaderCache)
+    return;
+
+  constexpr u32 CACHE_FILE_MAGIC = 0x44554c56;  // VLUD
+  constexpr u32 CACHE_FILE_VERSION = 1;
+  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+  using SerializedUID = std::array<u32, 5>;
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".vtxuidcache";
+
+  std::vector<VertexLoaderUID> uids;
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  // Other instances of Dolphin may share the cache directory, so only the one holding the lock of
+  // the file writes to it.
+  bool locked = false;
+  bool needs_header = false;
+  if (s_loader_uid_cache_file.Open(filename, "rb+", File::SharedAccess::ReadWrite))
+  {
+    locked = s_loader_uid_cache_file.TryLock();
+
+    u32 existing_magic;
+    u32 existing_version;
+    bool uid_file_valid = false;
+    if (s_loader_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
+        s_loader_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
+        existing_magic == CACHE_FILE_MAGIC && existing_version == CACHE_FILE_VERSION)
+    {
+      // A file that was cut off in the middle of a uid is treated as corrupted.
+      const u64 file_size = s_loader_uid_cache_file.GetSize();
+      const size_t uid_count =
+          static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedUID);
+      const size_t expected_size = uid_count * sizeof(SerializedUID) + CACHE_HEADER_SIZE;
+      uid_file_valid = file_size == expected_size || !locked;
+      if (uid_file_valid)
+      {
+        std::vector<SerializedUID> serialized_uids(uid_count);
+        uid_file_valid = s_loader_uid_cache_file.ReadArray(serialized_uids.data(), uid_count);
+        uids.reserve(uid_count);
+        for (const SerializedUID& serialized_uid : serialized_uids)
+          uids.emplace_back(serialized_uid);
+      }
+
+      // We open the file for reading and writing, so we must seek to the end before writing.
+      if (uid_file_valid)
+        uid_file_valid = s_loader_uid_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
+    }
+
+    if (!uid_file_valid)
+    {
+      uids.clear();
+      s_loader_uid_cache_file.ClearError();
+      needs_header = locked && s_loader_uid_cache_file.Resize(0) &&
+                     s_loader_uid_cache_file.Seek(0, File::SeekOrigin::Begin);
+    }
+    if (!locked || (!uid_file_valid && !needs_header))
+      s_loader_uid_cache_file.Close();
+  }
+  else if (s_loader_uid_cache_file.Open(filename, "wb", File::SharedAccess::ReadWrite))
+  {
+    needs_header = s_loader_uid_cache_file.TryLock();
+    if (!needs_header)
+      s_loader_uid_cache_file.Close();
+  }
+
+  if (needs_header)
+  {
+    s_loader_uid_cache_file.WriteBytes(&CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC));
+    s_loader_uid_cache_file.WriteBytes(&CACHE_FILE_VERSION, sizeof(CACHE_FILE_VERSION));
+
+    // Keep the loaders that were created before the cache was opened.
+    for (const auto& it : s_vertex_loader_map)
+      AppendLoaderUID(it.first);
+  }
+
+  INFO_LOG_FMT(VIDEO, "Read {} vertex loader UIDs from {}", uids.size(), filename);
+
+  if (!uids.empty())
+  {
+    s_stop_precompiling.store(false, std::memory_order_relaxed);
+    s_precompile_thread =
+        std::thread(PrecompileLoaders, std::move(uids), g_ActiveConfig.vertex_loader_type);
+  }
+}
+
 void UpdateVertexArrayPointers()
 {
   // Anything to update?
@@ -236,6 +403,7 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
         VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]));
     loader = it->second.get();
     INCSTAT(g_stats.num_vertex_loaders);
+    AppendLoaderUID(uid);
   }
   if (check_for_native_format)
   {
@@ -373,6 +541,63 @@ static void CheckCPConfiguration(int vtx_attr_group)
   }
 }
 
+static void UpdateLoaderThreads()
+{
+  const size_t thread_count = static_cast<size_t>(std::max(g_ActiveConfig.iVertexLoaderThreads, 0));
+  if (s_loader_threads.size() == thread_count)
+    return;
+
+  s_loader_threads.clear();
+  for (size_t i = 0; i < thread_count; ++i)
+  {
+    s_loader_threads.push_back(std::make_unique<Common::WorkQueueThreadSP<PartialLoad>>(
+        fmt::format("Vertex Loader {}", i), [](PartialLoad load) {
+          *load.num_loaded = load.loader->RunVerticesWithoutCaches(load.src, load.dst, load.count);
+          load.done->count_down();
+        }));
+  }
+}
+
+// Large draws are split into one part per loader thread plus one for the GPU thread. The GPU
+// thread loads the last part, so that the caches of the last vertices are set like when loading
+// the whole draw at once, and the parts are moved together afterwards if vertices were skipped.
+static int LoadVertices(VertexLoaderBase* loader, const u8* src, u8* dst, int count, int stride)
+{
+  if (count < PARALLEL_LOADING_MIN_VERTICES || !loader->SupportsPartialLoading())
+    return loader->RunVertices(src, dst, count);
+
+  UpdateLoaderThreads();
+  if (s_loader_threads.empty())
+    return loader->RunVertices(src, dst, count);
+
+  const int part_count = static_cast<int>(s_loader_threads.size()) + 1;
+  const int part_size = count / part_count;
+  std::vector<int> num_loaded(part_count);
+  std::latch done(part_count - 1);
+  for (int i = 0; i < part_count - 1; ++i)
+  {
+    s_loader_threads[i]->Push({loader, src + i * part_size * loader->m_vertex_size,
+                               dst + i * part_size * stride, part_size, &num_loaded[i], &done});
+  }
+
+  const int last_start = (part_count - 1) * part_size;
+  num_loaded.back() = loader->RunVertices(src + last_start * loader->m_vertex_size,
+                                          dst + last_start * stride, count - last_start);
+  loader->m_numLoadedVertices += last_start;
+  done.wait();
+
+  int total_loaded = 0;
+  for (int i = 0; i < part_count; ++i)
+  {
+    u8* const part_dst = dst + i * part_size * stride;
+    u8* const loaded_end = dst + total_loaded * stride;
+    if (part_dst != loaded_end)
+      std::memmove(loaded_end, part_dst, num_loaded[i] * stride);
+    total_loaded += num_loaded[i];
+  }
+  return total_loaded;
+}
+
 static bool CanSplit(OpcodeDecoder::Primitive primitive)
 {
   // Splitting is currently only implemented for the easy cases (individual lines/points/triangles)
@@ -437,6 +662,8 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
     const bool cullall = (bpmem.genMode.cull_mode == CullMode::All &&
                           primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES);
 
+    Common::FrameProfiler::Scope profiler_scope(Common::FrameProfiler::Stage::VertexLoading);
+
     const int stride = loader->m_native_vtx_decl.stride;
     do
     {
@@ -446,7 +673,7 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
       DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, run, stride,
                                                                   cullall || can_cpu_cull);
 
-      const int num_loaded = loader->RunVertices(src, dst.GetPointer(), run);
+      const int num_loaded = LoadVertices(loader, src, dst.GetPointer(), run, stride);
       src += loader->m_vertex_size * max_vertices;
 
       if (can_cpu_cull && !cullall)
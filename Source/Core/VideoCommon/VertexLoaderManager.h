@@ -28,6 +28,10 @@ using NativeVertexFormatMap =
 void Init();
 void Clear();
 
+// Opens the per-game cache of the vertex loaders seen in earlier sessions, and compiles them on a
+// worker thread. New loaders are appended to it until Clear.
+void InitializeLoaderCache();
+
 void MarkAllDirty();
 
 // Creates or obtains a pointer to a VertexFormat representing decl.
@@ -46,9 +46,16 @@ static OpArg MPIC(const void* ptr)
 VertexLoaderX64::VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att)
     : VertexLoaderBase(vtx_desc, vtx_att)
 {
-  AllocCodeSpace(4096);
+  AllocCodeSpace(8192);
   ClearCodeSpace();
   GenerateVertexLoader();
+
+  // The same loader without the zfreeze and normal caches, for RunVerticesWithoutCaches.
+  m_src_ofs = 0;
+  m_dst_ofs = 0;
+  m_store_caches = false;
+  m_no_caches_loader = AlignCode16();
+  GenerateVertexLoader();
   WriteProtect(true);
 
   Common::JitRegister::Register(region, GetCodePtr(), "VertexLoaderX64\nVtx desc: \n{}\nVAT:\n{}",
@@ -126,6 +133,9 @@ void VertexLoaderX64::ReadVertex(OpArg data, VertexComponentFormat attribute,
   X64Reg coords = XMM0;
 
   const auto write_zfreeze = [&] {  // zfreeze
+    if (!m_store_caches)
+      return;
+
     if (native_format == &m_native_vtx_decl.position)
     {
       CMP(32, R(remaining_reg), Imm8(3));
@@ -449,11 +459,15 @@ void VertexLoaderX64::GenerateVertexLoader()
     MOV(32, MDisp(dst_reg, m_dst_ofs), R(scratch1));
 
     // zfreeze
-    CMP(32, R(remaining_reg), Imm8(3));
-    FixupBranch dont_store = J_CC(CC_AE);
-    MOV(32, MPIC(VertexLoaderManager::position_matrix_index_cache.data(), remaining_reg, SCALE_4),
-        R(scratch1));
-    SetJumpTarget(dont_store);
+    if (m_store_caches)
+    {
+      CMP(32, R(remaining_reg), Imm8(3));
+      FixupBranch dont_store = J_CC(CC_AE);
+      MOV(32,
+          MPIC(VertexLoaderManager::position_matrix_index_cache.data(), remaining_reg, SCALE_4),
+          R(scratch1));
+      SetJumpTarget(dont_store);
+    }
 
     m_native_vtx_decl.posmtx.components = 4;
     m_native_vtx_decl.posmtx.enable = true;
@@ -612,3 +626,9 @@ int VertexLoaderX64::RunVertices(const u8* src, u8* dst, int count)
   return ((int (*)(const u8* src, u8* dst, int count, const void* base))region)(src, dst, count,
                                                                                 memory_base_ptr);
 }
+
+int VertexLoaderX64::RunVerticesWithoutCaches(const u8* src, u8* dst, int count)
+{
+  return ((int (*)(const u8* src, u8* dst, int count, const void* base))m_no_caches_loader)(
+      src, dst, count, memory_base_ptr);
+}
@@ -19,10 +19,14 @@ public:
 
 protected:
   int RunVertices(const u8* src, u8* dst, int count) override;
+  bool SupportsPartialLoading() const override { return true; }
+  int RunVerticesWithoutCaches(const u8* src, u8* dst, int count) override;
 
 private:
   u32 m_src_ofs = 0;
   u32 m_dst_ofs = 0;
+  bool m_store_caches = true;
+  const u8* m_no_caches_loader = nullptr;
   Gen::FixupBranch m_skip_vertex;
   Gen::OpArg GetVertexAddr(CPArray array, VertexComponentFormat attribute);
   void ReadVertex(Gen::OpArg data, VertexComponentFormat attribute, ComponentFormat format,
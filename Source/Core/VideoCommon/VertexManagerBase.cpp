@@ -5,12 +5,14 @@
 
 #include <array>
 #include <cmath>
+#include <cstring>
 #include <memory>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Contains.h"
 #include "Common/EnumMap.h"
+#include "Common/FrameProfiler.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/SmallVector.h"
@@ -127,6 +129,7 @@ bool VertexManagerBase::Initialize()
   m_index_generator.Init();
   m_custom_shader_cache = std::make_unique<CustomShaderCache>();
   m_cpu_cull.Init();
+  m_uploaded_constants_valid = false;
   return true;
 }
 
@@ -348,6 +351,8 @@ void VertexManagerBase::CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 nu
 
 void VertexManagerBase::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_vertex)
 {
+  Common::FrameProfiler::Scope profiler_scope(Common::FrameProfiler::Stage::BackendSubmit);
+
   // If bounding box is enabled, we need to flush any changes first, then invalidate what we have.
   if (g_bounding_box->IsEnabled() && g_ActiveConfig.bBBoxEnable && g_backend_info.bSupportsBBox)
   {
@@ -370,6 +375,41 @@ void VertexManagerBase::InvalidateConstants()
   vertex_shader_manager.dirty = true;
   geometry_shader_manager.dirty = true;
   pixel_shader_manager.dirty = true;
+  m_uploaded_constants_valid = false;
+}
+
+template <typename T>
+static void SkipUnchangedUpload(bool& dirty, const T& constants, T& uploaded_constants)
+{
+  if (!dirty)
+    return;
+
+  if (std::memcmp(&constants, &uploaded_constants, sizeof(T)) == 0)
+    dirty = false;
+  else
+    std::memcpy(&uploaded_constants, &constants, sizeof(T));
+}
+
+void VertexManagerBase::SkipUnchangedConstantUploads(VertexShaderManager& vertex_shader_manager,
+                                                     GeometryShaderManager& geometry_shader_manager,
+                                                     PixelShaderManager& pixel_shader_manager)
+{
+  if (!m_uploaded_constants_valid)
+  {
+    // Whatever is not dirty has been uploaded already, so all of it is what the GPU sees next.
+    m_uploaded_vertex_constants = vertex_shader_manager.constants;
+    m_uploaded_geometry_constants = geometry_shader_manager.constants;
+    m_uploaded_pixel_constants = pixel_shader_manager.constants;
+    m_uploaded_constants_valid = true;
+    return;
+  }
+
+  SkipUnchangedUpload(vertex_shader_manager.dirty, vertex_shader_manager.constants,
+                      m_uploaded_vertex_constants);
+  SkipUnchangedUpload(geometry_shader_manager.dirty, geometry_shader_manager.constants,
+                      m_uploaded_geometry_constants);
+  SkipUnchangedUpload(pixel_shader_manager.dirty, pixel_shader_manager.constants,
+                      m_uploaded_pixel_constants);
 }
 
 void VertexManagerBase::UploadUtilityUniforms(const void* uniforms, u32 uniforms_size)
@@ -560,7 +600,7 @@ void VertexManagerBase::Flush()
   CalculateNormals(VertexLoaderManager::GetCurrentVertexFormat());
   // Calculate ZSlope for zfreeze
   const auto used_textures = UsedTextures();
-  std::vector<std::string> texture_names;
+  Common::SmallVector<std::string, 8> texture_names;
   Common::SmallVector<u32, 8> texture_units;
   std::array<SamplerState, 8> samplers;
   if (!m_cull_all)
@@ -667,8 +707,11 @@ void VertexManagerBase::Flush()
     // Even if we skip the draw, emulated state should still be impacted
     OnDraw();
 
-    // The EFB cache is now potentially stale.
-    g_framebuffer_manager->FlagPeekCacheAsOutOfDate();
+    // The EFB cache is now potentially stale, where the draw could have written to it.
+    g_framebuffer_manager->FlagPeekCacheAsOutOfDate(
+        g_framebuffer_manager->GetEFBScissorRect(),
+        bpmem.blendmode.color_update || bpmem.blendmode.alpha_update,
+        bpmem.zmode.test_enable && bpmem.zmode.update_enable);
   }
 
   if (xfmem.numTexGen.numTexGens != bpmem.genMode.numtexgens)
@@ -802,6 +845,7 @@ void VertexManagerBase::UpdatePipelineConfig()
   if (vertex_format != m_current_pipeline_config.vertex_format)
   {
     m_current_pipeline_config.vertex_format = vertex_format;
+    m_current_pipeline_uid_hash.SetVertexFormat(vertex_format);
     m_current_uber_pipeline_config.vertex_format =
         VertexLoaderManager::GetUberVertexFormat(vertex_format->GetVertexDeclaration());
     m_pipeline_config_changed = true;
@@ -811,6 +855,7 @@ void VertexManagerBase::UpdatePipelineConfig()
   if (vs_uid != m_current_pipeline_config.vs_uid)
   {
     m_current_pipeline_config.vs_uid = vs_uid;
+    m_current_pipeline_uid_hash.SetVertexShader(vs_uid);
     m_current_uber_pipeline_config.vs_uid = UberShader::GetVertexShaderUid();
     m_pipeline_config_changed = true;
   }
@@ -819,6 +864,7 @@ void VertexManagerBase::UpdatePipelineConfig()
   if (ps_uid != m_current_pipeline_config.ps_uid)
   {
     m_current_pipeline_config.ps_uid = ps_uid;
+    m_current_pipeline_uid_hash.SetPixelShader(ps_uid);
     m_current_uber_pipeline_config.ps_uid = UberShader::GetPixelShaderUid();
     m_pipeline_config_changed = true;
   }
@@ -827,6 +873,7 @@ void VertexManagerBase::UpdatePipelineConfig()
   if (gs_uid != m_current_pipeline_config.gs_uid)
   {
     m_current_pipeline_config.gs_uid = gs_uid;
+    m_current_pipeline_uid_hash.SetGeometryShader(gs_uid);
     m_current_uber_pipeline_config.gs_uid = gs_uid;
     m_pipeline_config_changed = true;
   }
@@ -840,6 +887,7 @@ void VertexManagerBase::UpdatePipelineConfig()
     if (new_rs != m_current_pipeline_config.rasterization_state)
     {
       m_current_pipeline_config.rasterization_state = new_rs;
+      m_current_pipeline_uid_hash.rasterization_state = new_rs.hex;
       m_current_uber_pipeline_config.rasterization_state = new_rs;
       m_pipeline_config_changed = true;
     }
@@ -854,6 +902,7 @@ void VertexManagerBase::UpdatePipelineConfig()
     if (new_ds != m_current_pipeline_config.depth_state)
     {
       m_current_pipeline_config.depth_state = new_ds;
+      m_current_pipeline_uid_hash.depth_state = new_ds.hex;
       m_current_uber_pipeline_config.depth_state = new_ds;
       m_pipeline_config_changed = true;
     }
@@ -868,6 +917,7 @@ void VertexManagerBase::UpdatePipelineConfig()
     if (new_bs != m_current_pipeline_config.blending_state)
     {
       m_current_pipeline_config.blending_state = new_bs;
+      m_current_pipeline_uid_hash.blending_state = new_bs.hex;
       m_current_uber_pipeline_config.blending_state = new_bs;
       m_pipeline_config_changed = true;
     }
@@ -887,7 +937,8 @@ void VertexManagerBase::UpdatePipelineObject()
   case ShaderCompilationMode::Synchronous:
   {
     // Ubershaders disabled? Block and compile the specialized shader.
-    m_current_pipeline_object = g_shader_cache->GetPipelineForUid(m_current_pipeline_config);
+    m_current_pipeline_object = g_shader_cache->GetPipelineForUid(
+        m_current_pipeline_config, m_current_pipeline_uid_hash.Get());
   }
   break;
 
@@ -903,7 +954,8 @@ void VertexManagerBase::UpdatePipelineObject()
   case ShaderCompilationMode::AsynchronousSkipRendering:
   {
     // Can we background compile shaders? If so, get the pipeline asynchronously.
-    auto res = g_shader_cache->GetPipelineForUidAsync(m_current_pipeline_config);
+    auto res = g_shader_cache->GetPipelineForUidAsync(m_current_pipeline_config,
+                                                      m_current_pipeline_uid_hash.Get());
     if (res)
     {
       // Specialized shaders are ready, prefer these.
@@ -913,7 +965,23 @@ void VertexManagerBase::UpdatePipelineObject()
 
     if (g_ActiveConfig.iShaderCompilationMode == ShaderCompilationMode::AsynchronousUberShaders)
     {
-      // Specialized shaders not ready, use the ubershaders.
+      // Specialized shaders not ready, use the ubershaders specialized for the number of TEV
+      // stages if they are, as they are much cheaper on the GPU than the full ubershaders.
+      if (g_ActiveConfig.bStageSpecializedUberShaders)
+      {
+        VideoCommon::GXUberPipelineUid stage_uber_pipeline_config = m_current_uber_pipeline_config;
+        stage_uber_pipeline_config.ps_uid =
+            UberShader::GetStageSpecializedPixelShaderUid(m_current_uber_pipeline_config.ps_uid);
+        if (auto uber_res = g_shader_cache->GetUberPipelineForUidAsync(stage_uber_pipeline_config);
+            uber_res && *uber_res)
+        {
+          m_current_pipeline_object = *uber_res;
+          // Switch to the specialized shaders once they are ready.
+          m_pipeline_config_changed = true;
+          return;
+        }
+      }
+
       m_current_pipeline_object =
           g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
     }
@@ -1070,6 +1138,8 @@ void VertexManagerBase::RenderDrawCall(
     pixel_shader_manager.custom_constants_dirty = true;
   }
   pixel_shader_manager.custom_constants = custom_pixel_shader_uniforms;
+  SkipUnchangedConstantUploads(Core::System::GetInstance().GetVertexShaderManager(),
+                               geometry_shader_manager, pixel_shader_manager);
   UploadUniforms();
 
   g_gfx->SetPipeline(current_pipeline);
@@ -10,6 +10,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
 #include "VideoCommon/CPUCull.h"
+#include "VideoCommon/ConstantManager.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/ShaderCache.h"
@@ -23,6 +24,7 @@ class NativeVertexFormat;
 class PixelShaderManager;
 class PointerWrap;
 struct PortableVertexDeclaration;
+class VertexShaderManager;
 
 struct Slope
 {
@@ -173,7 +175,7 @@ public:
 
 protected:
   // When utility uniforms are used, the GX uniforms need to be re-written afterwards.
-  static void InvalidateConstants();
+  void InvalidateConstants();
 
   // Prepares the buffer for the next batch of vertices.
   virtual void ResetBuffer(u32 vertex_stride);
@@ -207,6 +209,7 @@ protected:
   Slope m_zslope = {};
 
   VideoCommon::GXPipelineUid m_current_pipeline_config;
+  VideoCommon::GXPipelineUidHash m_current_pipeline_uid_hash{m_current_pipeline_config};
   VideoCommon::GXUberPipelineUid m_current_uber_pipeline_config;
   const AbstractPipeline* m_current_pipeline_object = nullptr;
   PrimitiveType m_current_primitive_type = PrimitiveType::Points;
@@ -231,6 +234,12 @@ private:
   void UpdatePipelineConfig();
   void UpdatePipelineObject();
 
+  // Clears the dirty flag of the constants which are the same as the last ones uploaded, games
+  // often rewrite registers with the values they already hold.
+  void SkipUnchangedConstantUploads(VertexShaderManager& vertex_shader_manager,
+                                    GeometryShaderManager& geometry_shader_manager,
+                                    PixelShaderManager& pixel_shader_manager);
+
   const AbstractPipeline*
   GetCustomPipeline(const CustomPixelShaderContents& custom_pixel_shader_contents,
                     const VideoCommon::GXPipelineUid& current_pipeline_config,
@@ -251,6 +260,12 @@ private:
   std::unique_ptr<CustomShaderCache> m_custom_shader_cache;
   u64 m_ticks_elapsed = 0;
 
+  // Copies of the GX constants last uploaded, only meaningful while valid.
+  VertexShaderConstants m_uploaded_vertex_constants = {};
+  GeometryShaderConstants m_uploaded_geometry_constants = {};
+  PixelShaderConstants m_uploaded_pixel_constants = {};
+  bool m_uploaded_constants_valid = false;
+
   Common::EventHook m_frame_end_event;
   Common::EventHook m_after_present_event;
 };
@@ -106,8 +106,11 @@ void VideoBackendBase::Video_OutputXFB(u32 xfb_addr, u32 fb_width, u32 fb_stride
     system.GetFifo().SyncGPU(Fifo::SyncGPUReason::Swap);
 
     const TimePoint presentation_time = core_timing.GetTargetHostTime(ticks);
+    // Read here rather than on the GPU thread, which may already be behind the next field.
+    const bool suppressed = VideoCommon::IsPresentationSuppressed();
     AsyncRequests::GetInstance()->PushEvent([=] {
-      g_presenter->ViSwap(xfb_addr, fb_width, fb_stride, fb_height, ticks, presentation_time);
+      g_presenter->ViSwap(xfb_addr, fb_width, fb_stride, fb_height, ticks, presentation_time,
+                          suppressed);
     });
   }
 
@@ -133,6 +136,9 @@ u32 VideoBackendBase::Video_GetQueryResult(PerfQueryType type)
     return 0;
   }
 
+  if (g_perf_query->ShouldDefer())
+    return g_perf_query->GetDeferredQueryResult(type);
+
   auto& system = Core::System::GetInstance();
   system.GetFifo().SyncGPU(Fifo::SyncGPUReason::PerfQuery);
 
@@ -409,6 +415,7 @@ bool VideoBackendBase::InitializeShared(std::unique_ptr<AbstractGfx> gfx,
   }
 
   g_shader_cache->InitializeShaderCache();
+  VertexLoaderManager::InitializeLoaderCache();
   system.GetCustomResourceManager().Initialize();
 
   return true;
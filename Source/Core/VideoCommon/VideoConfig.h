@@ -251,6 +251,9 @@ struct VideoConfig final
   bool bShowGraphs = false;
   bool bShowSpeed = false;
   bool bShowSpeedColors = false;
+  bool bShowFrameTimings = false;
+  bool bTraceFrameTimings = false;
+  bool bKeepRecentFrameTimings = false;
   int iPerfSampleUSec = 0;
   bool bOverlayStats = false;
   bool bOverlayProjStats = false;
@@ -273,6 +276,8 @@ struct VideoConfig final
   bool bDumpXFBTarget = false;
   bool bBorderlessFullscreen = false;
   bool bEnableGPUTextureDecoding = false;
+  // Decode large textures on the GPU even if bEnableGPUTextureDecoding is off.
+  bool bAutoGPUTextureDecoding = false;
   bool bPreferVSForLinePointExpansion = false;
   bool bGraphicMods = false;
   std::optional<GraphicsModGroupConfig> graphics_mod_config;
@@ -281,7 +286,9 @@ struct VideoConfig final
   bool bEFBAccessEnable = false;
   bool bEFBAccessDeferInvalidation = false;
   bool bPerfQueriesEnable = false;
+  bool bPerfQueriesExact = false;
   bool bBBoxEnable = false;
+  bool bBBoxDeferredReadback = false;
   bool bCPUCull = false;
 
   bool bEFBEmulateFormatChanges = false;
@@ -335,6 +342,9 @@ struct VideoConfig final
   // Shader compilation settings.
   bool bWaitForShadersBeforeStarting = false;
   ShaderCompilationMode iShaderCompilationMode{};
+  // With hybrid ubershaders, compile ubershaders specialized for the number of TEV stages on
+  // demand, and prefer them over the full ubershaders while the specialized shaders compile.
+  bool bStageSpecializedUberShaders = false;
 
   // Number of shader compiler threads.
   // 0 disables background compilation.
@@ -342,6 +352,17 @@ struct VideoConfig final
   int iShaderCompilerThreads = 0;
   int iShaderPrecompilerThreads = 0;
 
+  // Number of extra threads loading the vertices of large draws. 0 loads them all on the GPU
+  // thread.
+  int iVertexLoaderThreads = 0;
+
+  // Number of extra threads decoding large textures. 0 decodes them on the GPU thread.
+  int iTextureDecoderThreads = 0;
+
+  // Number of extra threads rasterizing for the software renderer. 0 rasterizes on the GPU
+  // thread.
+  int iSWRasterizerThreads = 0;
+
   // Loading custom drivers on Android
   std::string customDriverLibraryName;
 
@@ -366,6 +387,15 @@ struct VideoConfig final
   {
     return g_backend_info.bSupportsGPUTextureDecoding && bEnableGPUTextureDecoding;
   }
+  // Small textures are faster to decode on the CPU than to upload raw and dispatch a shader for.
+  // Arbitrary mipmap detection needs the decoded texels on the CPU.
+  bool ShouldDecodeTextureOnGPU(u32 width, u32 height) const
+  {
+    constexpr u32 AUTO_GPU_TEXTURE_DECODING_MIN_TEXELS = 256 * 256;
+    return UseGPUTextureDecoding() ||
+           (g_backend_info.bSupportsGPUTextureDecoding && bAutoGPUTextureDecoding &&
+            !bArbitraryMipmapDetection && width * height >= AUTO_GPU_TEXTURE_DECODING_MIN_TEXELS);
+  }
   bool UseVertexRounding() const { return bVertexRounding && iEFBScale != 1; }
   bool ManualTextureSamplingWithCustomTextureSizes() const
   {
@@ -3,6 +3,7 @@
 
 #include "VideoCommon/XFStructs.h"
 
+#include <array>
 #include <bit>
 
 #include "Common/CommonTypes.h"
@@ -22,12 +23,23 @@
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/XFStateManager.h"
 
+// Registers whose handling depends on more than their previous value, so they're handled even when
+// written with the value they already have.
+static constexpr auto s_xf_always_handled_registers = [] {
+  std::array<bool, XFMEM_REGISTERS_END - XFMEM_REGISTERS_START> registers{};
+  for (const u32 address : {XFMEM_VTXSPECS, XFMEM_SETMATRIXINDA, XFMEM_SETMATRIXINDB})
+    registers[address - XFMEM_REGISTERS_START] = true;
+  return registers;
+}();
+
 static void XFMemWritten(XFStateManager& xf_state_manager, u32 transferSize, u32 baseAddress)
 {
   g_vertex_manager->Flush();
   xf_state_manager.InvalidateXFRange(baseAddress, baseAddress + transferSize);
 }
 
+// Only called for registers that were written with a different value, and the ones in
+// s_xf_always_handled_registers. xfmem still holds the previous value.
 static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager, u32 address,
                          u32 value)
 {
@@ -68,27 +80,15 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
 
     case XFMEM_SETCHAN0_AMBCOLOR:  // Channel Ambient Color
     case XFMEM_SETCHAN1_AMBCOLOR:
-    {
-      u8 chan = address - XFMEM_SETCHAN0_AMBCOLOR;
-      if (xfmem.ambColor[chan] != value)
-      {
-        g_vertex_manager->Flush();
-        xf_state_manager.SetMaterialColorChanged(chan);
-      }
+      g_vertex_manager->Flush();
+      xf_state_manager.SetMaterialColorChanged(address - XFMEM_SETCHAN0_AMBCOLOR);
       break;
-    }
 
     case XFMEM_SETCHAN0_MATCOLOR:  // Channel Material Color
     case XFMEM_SETCHAN1_MATCOLOR:
-    {
-      u8 chan = address - XFMEM_SETCHAN0_MATCOLOR;
-      if (xfmem.matColor[chan] != value)
-      {
-        g_vertex_manager->Flush();
-        xf_state_manager.SetMaterialColorChanged(chan + 2);
-      }
+      g_vertex_manager->Flush();
+      xf_state_manager.SetMaterialColorChanged(address - XFMEM_SETCHAN0_MATCOLOR + 2);
       break;
-    }
 
     case XFMEM_SETCHAN0_COLOR:  // Channel Color
     case XFMEM_SETCHAN1_COLOR:
@@ -232,12 +232,20 @@ void LoadXFReg(u16 base_address, u8 transfer_size, const u8* data)
       base_address = XFMEM_REGISTERS_START;
     }
 
-    XFMemWritten(xf_state_manager, xf_mem_transfer_size, xf_mem_base);
+    // Games often load the same matrices again for every object, there is no need to end the
+    // batch for those.
+    u32* const curr_data = reinterpret_cast<u32*>(&xfmem) + xf_mem_base;
     for (u32 i = 0; i < xf_mem_transfer_size; i++)
     {
-      ((u32*)&xfmem)[xf_mem_base + i] = Common::swap32(data);
-      data += 4;
+      if (curr_data[i] != Common::swap32(data + i * 4))
+      {
+        XFMemWritten(xf_state_manager, xf_mem_transfer_size, xf_mem_base);
+        for (u32 j = 0; j < xf_mem_transfer_size; j++)
+          curr_data[j] = Common::swap32(data + j * 4);
+        break;
+      }
     }
+    data += xf_mem_transfer_size * 4;
   }
 
   // write to XF regs
@@ -247,8 +255,13 @@ void LoadXFReg(u16 base_address, u8 transfer_size, const u8* data)
     {
       const u32 value = Common::swap32(data);
 
-      XFRegWritten(system, xf_state_manager, address, value);
-      ((u32*)&xfmem)[address] = value;
+      // Games write most registers again with the values they already have all the time.
+      u32& reg = reinterpret_cast<u32*>(&xfmem)[address];
+      if (reg != value || s_xf_always_handled_registers[address - XFMEM_REGISTERS_START])
+      {
+        XFRegWritten(system, xf_state_manager, address, value);
+        reg = value;
+      }
 
       data += 4;
     }
@@ -0,0 +1,110 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Common/FileUtil.h"
+#include "Common/FrameProfiler.h"
+
+using namespace std::chrono_literals;
+namespace FrameProfiler = Common::FrameProfiler;
+using FrameProfiler::Stage;
+
+TEST(FrameProfiler, TakeFrameTimes)
+{
+  FrameProfiler::TakeFrameTimes();
+
+  FrameProfiler::AddTime(Stage::FifoDecode, 2ms);
+  FrameProfiler::AddTime(Stage::FifoDecode, 3ms);
+  const TimePoint start = Clock::now();
+  FrameProfiler::AddTime(Stage::HostGPU, start, start + 1ms);
+
+  FrameProfiler::FrameTimes times = FrameProfiler::TakeFrameTimes();
+  EXPECT_EQ(times[static_cast<u32>(Stage::FifoDecode)], DT(5ms));
+  EXPECT_EQ(times[static_cast<u32>(Stage::HostGPU)], DT(1ms));
+  EXPECT_EQ(times[static_cast<u32>(Stage::JitCompile)], DT::zero());
+
+  // Taking the times starts counting again.
+  times = FrameProfiler::TakeFrameTimes();
+  EXPECT_EQ(times[static_cast<u32>(Stage::FifoDecode)], DT::zero());
+}
+
+TEST(FrameProfiler, ScopeOnlyCountsWhileEnabled)
+{
+  FrameProfiler::TakeFrameTimes();
+
+  FrameProfiler::SetEnabled(false);
+  {
+    FrameProfiler::Scope scope(Stage::TextureDecode);
+  }
+  EXPECT_EQ(FrameProfiler::TakeFrameTimes()[static_cast<u32>(Stage::TextureDecode)], DT::zero());
+
+  FrameProfiler::SetEnabled(true);
+  const TimePoint start = Clock::now();
+  {
+    FrameProfiler::Scope scope(Stage::TextureDecode);
+    while (Clock::now() == start)
+    {
+    }
+  }
+  FrameProfiler::SetEnabled(false);
+  EXPECT_GT(FrameProfiler::TakeFrameTimes()[static_cast<u32>(Stage::TextureDecode)], DT::zero());
+}
+
+TEST(FrameProfiler, Trace)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+  const std::string path = directory + "/trace.json";
+
+  EXPECT_FALSE(FrameProfiler::IsTracing());
+  FrameProfiler::StartTrace();
+  EXPECT_TRUE(FrameProfiler::IsTracing());
+
+  const TimePoint start = Clock::now();
+  FrameProfiler::AddTime(Stage::VertexLoading, start, start + 1ms);
+  // Durations without a start aren't traced.
+  FrameProfiler::AddTime(Stage::HostGPU, 1ms);
+
+  EXPECT_TRUE(FrameProfiler::StopTrace(path));
+  EXPECT_FALSE(FrameProfiler::IsTracing());
+
+  std::string json;
+  EXPECT_TRUE(File::ReadFileToString(path, json));
+  EXPECT_NE(json.find("\"name\":\"Vertex Loading\""), std::string::npos);
+  EXPECT_NE(json.find("\"dur\":1000.000"), std::string::npos);
+  EXPECT_EQ(json.find("Host GPU"), std::string::npos);
+
+  File::DeleteDirRecursively(directory);
+  FrameProfiler::TakeFrameTimes();
+}
+
+TEST(FrameProfiler, DumpRecentEvents)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+  const std::string path = directory + "/recent.json";
+
+  FrameProfiler::SetKeepingRecentEvents(true);
+  const TimePoint now = Clock::now();
+  FrameProfiler::AddTime(Stage::DVDRead, now - 1min, now - 1min + 1ms);
+  FrameProfiler::AddTime(Stage::AudioMix, now - 1s, now - 1s + 2ms);
+  FrameProfiler::SetKeepingRecentEvents(false);
+  // Not kept anymore.
+  FrameProfiler::AddTime(Stage::NetPlayPacket, now, now + 1ms);
+
+  EXPECT_TRUE(FrameProfiler::DumpRecentEvents(path, 10s));
+
+  std::string json;
+  EXPECT_TRUE(File::ReadFileToString(path, json));
+  EXPECT_NE(json.find("\"name\":\"Audio Mix\""), std::string::npos);
+  EXPECT_NE(json.find("\"dur\":2000.000"), std::string::npos);
+  EXPECT_EQ(json.find("DVD Read"), std::string::npos);
+  EXPECT_EQ(json.find("NetPlay Packet"), std::string::npos);
+
+  File::DeleteDirRecursively(directory);
+  FrameProfiler::TakeFrameTimes();
+}
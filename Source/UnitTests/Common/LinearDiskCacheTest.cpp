@@ -0,0 +1,129 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/LinearDiskCache.h"
+
+namespace
+{
+using Entry = std::pair<u64, std::string>;
+
+class Reader final : public Common::LinearDiskCacheReader<u64, u8>
+{
+public:
+  void Read(const u64& key, const u8* value, u32 value_size) override
+  {
+    entries.emplace_back(key, std::string(reinterpret_cast<const char*>(value), value_size));
+  }
+
+  std::vector<Entry> entries;
+};
+
+void Append(Common::LinearDiskCache<u64, u8>& cache, u64 key, const std::string& value)
+{
+  cache.Append(key, reinterpret_cast<const u8*>(value.data()), static_cast<u32>(value.size()));
+}
+}  // namespace
+
+class LinearDiskCacheTest : public testing::Test
+{
+protected:
+  LinearDiskCacheTest() : m_directory(File::CreateTempDir()), m_path(m_directory + "/cache") {}
+  ~LinearDiskCacheTest() override { File::DeleteDirRecursively(m_directory); }
+
+  std::string m_directory;
+  std::string m_path;
+};
+
+TEST_F(LinearDiskCacheTest, ReadsAppendedEntries)
+{
+  Common::LinearDiskCache<u64, u8> cache;
+  Reader reader;
+  EXPECT_EQ(cache.OpenAndRead(m_path, reader), 0u);
+  Append(cache, 1, "first");
+  Append(cache, 2, "");
+  cache.Close();
+
+  // Appending continues after the entries that were read.
+  EXPECT_EQ(cache.OpenAndRead(m_path, reader), 2u);
+  Append(cache, 3, "third");
+  cache.Close();
+
+  reader.entries.clear();
+  EXPECT_EQ(cache.OpenAndRead(m_path, reader), 3u);
+  cache.Close();
+  EXPECT_EQ(reader.entries, (std::vector<Entry>{{1, "first"}, {2, ""}, {3, "third"}}));
+}
+
+TEST_F(LinearDiskCacheTest, DropsPartialEntry)
+{
+  Common::LinearDiskCache<u64, u8> cache;
+  Reader reader;
+  cache.OpenAndRead(m_path, reader);
+  Append(cache, 1, "first");
+  Append(cache, 2, "second");
+  cache.Close();
+
+  // Cut the second entry short, as if writing it had been interrupted.
+  {
+    File::IOFile file(m_path, "r+b");
+    ASSERT_TRUE(file.Resize(file.GetSize() - 3));
+  }
+
+  EXPECT_EQ(cache.OpenAndRead(m_path, reader), 1u);
+  Append(cache, 4, "fourth");
+  cache.Close();
+
+  reader.entries.clear();
+  EXPECT_EQ(cache.OpenAndRead(m_path, reader), 2u);
+  cache.Close();
+  EXPECT_EQ(reader.entries, (std::vector<Entry>{{1, "first"}, {4, "fourth"}}));
+}
+
+TEST_F(LinearDiskCacheTest, RecreatesFileWithBadHeader)
+{
+  ASSERT_TRUE(File::WriteStringToFile(m_path, "not a cache"));
+
+  Common::LinearDiskCache<u64, u8> cache;
+  Reader reader;
+  EXPECT_EQ(cache.OpenAndRead(m_path, reader), 0u);
+  Append(cache, 1, "first");
+  cache.Close();
+
+  EXPECT_EQ(cache.OpenAndRead(m_path, reader), 1u);
+  cache.Close();
+  EXPECT_EQ(reader.entries, (std::vector<Entry>{{1, "first"}}));
+}
+
+TEST_F(LinearDiskCacheTest, OnlyOneCacheWritesToFile)
+{
+  Common::LinearDiskCache<u64, u8> first;
+  Reader reader;
+  first.OpenAndRead(m_path, reader);
+  Append(first, 1, "first");
+  first.Sync();
+  EXPECT_TRUE(first.IsWritable());
+
+  // Another instance sharing the file reads its entries, but leaves it to the first one.
+  Common::LinearDiskCache<u64, u8> second;
+  EXPECT_EQ(second.OpenAndRead(m_path, reader), 1u);
+  EXPECT_FALSE(second.IsWritable());
+  Append(second, 2, "second");
+  Append(first, 3, "third");
+  first.Close();
+  second.Close();
+
+  reader.entries.clear();
+  EXPECT_EQ(second.OpenAndRead(m_path, reader), 2u);
+  EXPECT_TRUE(second.IsWritable());
+  second.Close();
+  EXPECT_EQ(reader.entries, (std::vector<Entry>{{1, "first"}, {3, "third"}}));
+}
@@ -0,0 +1,93 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/MPSCQueue.h"
+
+TEST(MPSCQueue, Simple)
+{
+  Common::MPSCQueue<u32> q;
+  EXPECT_TRUE(q.Empty());
+
+  q.Push(1);
+  EXPECT_FALSE(q.Empty());
+
+  std::vector<u32> values;
+  q.PopAll([&](u32 v) { values.push_back(v); });
+  EXPECT_EQ(values, std::vector<u32>{1});
+  EXPECT_TRUE(q.Empty());
+
+  // Test the FIFO order.
+  for (u32 i = 0; i < 1000; ++i)
+    q.Push(i);
+  values.clear();
+  q.PopAll([&](u32 v) { values.push_back(v); });
+  ASSERT_EQ(values.size(), 1000u);
+  for (u32 i = 0; i < 1000; ++i)
+    EXPECT_EQ(i, values[i]);
+  EXPECT_TRUE(q.Empty());
+
+  for (u32 i = 0; i < 1000; ++i)
+    q.Push(i);
+  EXPECT_FALSE(q.Empty());
+  q.Clear();
+  EXPECT_TRUE(q.Empty());
+}
+
+TEST(MPSCQueue, MultiThreaded)
+{
+  struct Foo
+  {
+    std::shared_ptr<int> ptr;
+    u32 producer;
+    u32 i;
+  };
+
+  // A shared_ptr held by every element in the queue.
+  auto sptr = std::make_shared<int>(0);
+
+  auto queue_ptr = std::make_unique<Common::MPSCQueue<Foo>>();
+  auto& q = *queue_ptr;
+
+  constexpr u32 producers = 4;
+  constexpr u32 reps = 100000;
+
+  std::vector<std::thread> producer_threads;
+  for (u32 producer = 0; producer != producers; ++producer)
+  {
+    producer_threads.emplace_back([&, producer] {
+      for (u32 i = 0; i != reps; ++i)
+        q.Push({sptr, producer, i});
+    });
+  }
+
+  // The values of every producer have to come out in the order it pushed them.
+  std::array<u32, producers> next{};
+  u32 popped = 0;
+  while (popped != producers * reps)
+  {
+    q.PopAll([&](Foo&& foo) {
+      EXPECT_EQ(next[foo.producer], foo.i);
+      next[foo.producer] = foo.i + 1;
+      ++popped;
+    });
+  }
+
+  for (std::thread& thread : producer_threads)
+    thread.join();
+
+  EXPECT_TRUE(q.Empty());
+  EXPECT_EQ(sptr.use_count(), 1);
+
+  q.Push({sptr, 0, 0});
+  EXPECT_EQ(sptr.use_count(), 2);
+  queue_ptr.reset();
+  EXPECT_EQ(sptr.use_count(), 1);
+}
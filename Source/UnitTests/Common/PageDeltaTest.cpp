@@ -0,0 +1,88 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "Common/PageDelta.h"
+
+using Common::PageDelta::PAGE_SIZE;
+
+TEST(PageDelta, FindChangedPages)
+{
+  std::vector<u8> reference(PAGE_SIZE * 4, 0);
+  std::vector<u8> current = reference;
+  current[PAGE_SIZE * 1 + 7] = 1;
+  current[PAGE_SIZE * 3] = 2;
+
+  std::vector<u32> pages;
+  Common::PageDelta::FindChangedPages(reference, current, &pages);
+  EXPECT_EQ(pages, (std::vector<u32>{1, 3}));
+}
+
+TEST(PageDelta, LongerImageCountsAsChanged)
+{
+  std::vector<u8> reference(PAGE_SIZE * 2, 0);
+  std::vector<u8> current(PAGE_SIZE * 3 + 10, 0);
+
+  std::vector<u32> pages;
+  Common::PageDelta::FindChangedPages(reference, current, &pages);
+  EXPECT_EQ(pages, (std::vector<u32>{2, 3}));
+}
+
+TEST(PageDelta, RoundTrip)
+{
+  const size_t image_size = PAGE_SIZE * 5 + 100;
+  std::vector<u8> reference(image_size);
+  for (size_t i = 0; i < image_size; ++i)
+    reference[i] = static_cast<u8>(i);
+
+  std::vector<u8> current = reference;
+  current[PAGE_SIZE * 1] ^= 0xFF;
+  current[PAGE_SIZE * 2 + 5] ^= 0xFF;
+  current[image_size - 1] ^= 0xFF;
+
+  std::vector<u32> pages;
+  Common::PageDelta::FindChangedPages(reference, current, &pages);
+  ASSERT_EQ(pages, (std::vector<u32>{1, 2, 5}));
+
+  const size_t encoded_size = Common::PageDelta::GetEncodedSize(image_size, pages);
+  EXPECT_EQ(encoded_size, 2 * sizeof(Common::PageDelta::RunHeader) + 2 * PAGE_SIZE + 100);
+
+  std::vector<u8> delta(encoded_size);
+  ASSERT_EQ(Common::PageDelta::Encode(current, pages, delta), encoded_size);
+
+  std::vector<u8> target = reference;
+  std::vector<u32> applied_pages;
+  ASSERT_TRUE(Common::PageDelta::Apply(delta, target, &applied_pages));
+  EXPECT_EQ(target, current);
+  EXPECT_EQ(applied_pages, pages);
+
+  Common::PageDelta::CopyPages(reference, target, applied_pages);
+  EXPECT_EQ(target, reference);
+}
+
+TEST(PageDelta, EncodeRejectsSmallBuffer)
+{
+  std::vector<u8> image(PAGE_SIZE, 0);
+  const std::vector<u32> pages{0};
+  std::vector<u8> delta(PAGE_SIZE);
+  EXPECT_EQ(Common::PageDelta::Encode(image, pages, delta), 0u);
+}
+
+TEST(PageDelta, ApplyRejectsMalformedDelta)
+{
+  std::vector<u8> target(PAGE_SIZE * 2, 0);
+
+  const Common::PageDelta::RunHeader out_of_range{2, 1};
+  std::vector<u8> delta(sizeof(out_of_range) + PAGE_SIZE);
+  std::memcpy(delta.data(), &out_of_range, sizeof(out_of_range));
+  EXPECT_FALSE(Common::PageDelta::Apply(delta, target));
+
+  const Common::PageDelta::RunHeader truncated{0, 2};
+  delta.assign(sizeof(truncated) + PAGE_SIZE, 0);
+  std::memcpy(delta.data(), &truncated, sizeof(truncated));
+  EXPECT_FALSE(Common::PageDelta::Apply(delta, target));
+}
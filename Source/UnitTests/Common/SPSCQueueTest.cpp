@@ -3,6 +3,7 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <memory>
 #include <thread>
 
@@ -89,3 +90,84 @@ TEST(SPSCQueue, MultiThreaded)
   queue_ptr.reset();
   EXPECT_EQ(sptr.use_count(), 1);
 }
+
+TEST(RingSPSCQueue, Simple)
+{
+  Common::RingSPSCQueue<u32, 4> q;
+
+  EXPECT_TRUE(q.Empty());
+  for (u32 i = 0; i < 4; ++i)
+    EXPECT_TRUE(q.Push(i));
+  // Full.
+  EXPECT_FALSE(q.Push(4));
+  EXPECT_EQ(4u, q.Size());
+
+  u32 v;
+  EXPECT_TRUE(q.Pop(v));
+  EXPECT_EQ(0u, v);
+  EXPECT_EQ(1u, q.Front());
+  q.Pop();
+
+  // Wraps around, and only pushes what fits.
+  const std::array<u32, 3> values{4, 5, 6};
+  EXPECT_EQ(2u, q.PushN(values));
+  EXPECT_EQ(4u, q.Size());
+
+  std::array<u32, 8> results{};
+  EXPECT_EQ(4u, q.PopN(results));
+  EXPECT_EQ(2u, results[0]);
+  EXPECT_EQ(3u, results[1]);
+  EXPECT_EQ(4u, results[2]);
+  EXPECT_EQ(5u, results[3]);
+  EXPECT_TRUE(q.Empty());
+  EXPECT_FALSE(q.Pop(v));
+  EXPECT_EQ(0u, q.PopN(results));
+
+  q.Push(7);
+  q.Clear();
+  EXPECT_TRUE(q.Empty());
+}
+
+TEST(RingSPSCQueue, MultiThreaded)
+{
+  // A shared_ptr held by every element in the queue.
+  auto sptr = std::make_shared<int>(0);
+
+  auto queue_ptr = std::make_unique<Common::WaitableRingSPSCQueue<std::shared_ptr<int>, 16>>();
+  auto& q = *queue_ptr;
+
+  constexpr u32 reps = 100000;
+
+  auto inserter = [&] {
+    for (u32 i = 0; i != reps;)
+    {
+      if (q.Push(sptr))
+        ++i;
+      else
+        std::this_thread::yield();
+    }
+
+    q.WaitForEmpty();
+    EXPECT_EQ(sptr.use_count(), 1);
+    q.Push(sptr);
+  };
+
+  auto popper = [&] {
+    for (u32 i = 0; i != reps; ++i)
+    {
+      q.WaitForData();
+      EXPECT_EQ(sptr, q.Front());
+      q.Pop();
+    }
+  };
+
+  std::thread popper_thread(popper);
+  std::thread inserter_thread(inserter);
+
+  popper_thread.join();
+  inserter_thread.join();
+
+  EXPECT_EQ(sptr.use_count(), 2);
+  queue_ptr.reset();
+  EXPECT_EQ(sptr.use_count(), 1);
+}
@@ -0,0 +1,48 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Common/WirePacket.h"
+
+namespace
+{
+enum class TestMessage : u8
+{
+  Value = 0x60,
+};
+
+std::vector<u8> GetBytes(const Common::WirePacket& packet)
+{
+  const std::span<const u8> data = packet.GetData();
+  return {data.begin(), data.end()};
+}
+}  // namespace
+
+TEST(WirePacket, WritesLikeSfPacket)
+{
+  Common::WirePacket packet;
+  packet << TestMessage::Value << true << s8{-2} << u16{0x1234} << u32{0x12345678}
+         << u64{0x0123456789abcdef};
+
+  // Integers are big endian, bools are a single byte.
+  const std::vector<u8> expected{0x60, 0x01, 0xfe, 0x12, 0x34, 0x12, 0x34, 0x56, 0x78,
+                                 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef};
+  EXPECT_TRUE(packet.IsValid());
+  EXPECT_EQ(GetBytes(packet), expected);
+}
+
+TEST(WirePacket, OverflowInvalidatesPacket)
+{
+  Common::WirePacket packet;
+  for (size_t i = 0; i < Common::WirePacket::CAPACITY / sizeof(u32); ++i)
+    packet << u32{0};
+  EXPECT_TRUE(packet.IsValid());
+  EXPECT_EQ(packet.GetData().size(), Common::WirePacket::CAPACITY);
+
+  packet << u8{0};
+  EXPECT_FALSE(packet.IsValid());
+  EXPECT_EQ(packet.GetData().size(), Common::WirePacket::CAPACITY);
+}
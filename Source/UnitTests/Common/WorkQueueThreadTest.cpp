@@ -51,3 +51,16 @@ TEST(WorkQueueThread, Simple)
   // Still running after cancelation.
   EXPECT_EQ(x, 2);
 }
+
+TEST(WorkQueueThread, BackgroundPriority)
+{
+  Common::AsyncWorkThread worker("test worker", Common::ThreadPriority::Background);
+
+  int x = 0;
+  worker.Push([&] { x = 1; });
+  worker.WaitForCompletion();
+  EXPECT_EQ(x, 1);
+
+  worker.PushBlocking([&] { x = 2; });
+  EXPECT_EQ(x, 2);
+}
@@ -0,0 +1,114 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPHLE/UCodes/ZeldaMixing.h"
+
+namespace ZeldaMixing = DSP::HLE::ZeldaMixing;
+
+namespace
+{
+// Enough for a full mixing buffer and a partial vector after it.
+constexpr size_t MAX_COUNT = 0x53;
+
+std::vector<s16> RandomSamples(std::mt19937& rng, size_t count)
+{
+  // Mostly full scale samples, with the extremes showing up often enough to be tested.
+  std::uniform_int_distribution<int> dist(-0x8000, 0x7FFF);
+  std::uniform_int_distribution<int> extreme(0, 7);
+  std::vector<s16> samples(count);
+  for (s16& sample : samples)
+  {
+    switch (extreme(rng))
+    {
+    case 0:
+      sample = -0x8000;
+      break;
+    case 1:
+      sample = 0x7FFF;
+      break;
+    default:
+      sample = static_cast<s16>(dist(rng));
+      break;
+    }
+  }
+  return samples;
+}
+}  // namespace
+
+TEST(ZeldaMixing, ApplyVolumeInPlaceMatchesGeneric)
+{
+  std::mt19937 rng(0);
+  static constexpr std::array<u16, 5> edge_volumes = {0, 0x1000, 0x7FFF, 0x8000, 0xFFFF};
+  for (u32 fraction_bits : {12, 15})
+  {
+    for (size_t count = 0; count <= MAX_COUNT; ++count)
+    {
+      for (size_t j = 0; j < edge_volumes.size() + 4; ++j)
+      {
+        const u16 vol = j < edge_volumes.size() ? edge_volumes[j] : static_cast<u16>(rng());
+        std::vector<s16> expected = RandomSamples(rng, count);
+        std::vector<s16> actual = expected;
+
+        ZeldaMixing::Generic::ApplyVolumeInPlace(expected.data(), count, vol, fraction_bits);
+        ZeldaMixing::ApplyVolumeInPlace(actual.data(), count, vol, fraction_bits);
+        EXPECT_EQ(actual, expected) << "count " << count << " volume " << vol;
+      }
+    }
+  }
+}
+
+TEST(ZeldaMixing, AddBuffersWithVolumeMatchesGeneric)
+{
+  std::mt19937 rng(1);
+  static constexpr std::array<u16, 4> edge_volumes = {0, 0x7FFF, 0x8000, 0xFFFF};
+  for (size_t count = 0; count <= MAX_COUNT; ++count)
+  {
+    for (size_t j = 0; j < edge_volumes.size() + 4; ++j)
+    {
+      const u16 vol = j < edge_volumes.size() ? edge_volumes[j] : static_cast<u16>(rng());
+      const std::vector<s16> src = RandomSamples(rng, count);
+      std::vector<s16> expected = RandomSamples(rng, count);
+      std::vector<s16> actual = expected;
+
+      ZeldaMixing::Generic::AddBuffersWithVolume(expected.data(), src.data(), count, vol);
+      ZeldaMixing::AddBuffersWithVolume(actual.data(), src.data(), count, vol);
+      EXPECT_EQ(actual, expected) << "count " << count << " volume " << vol;
+    }
+  }
+}
+
+TEST(ZeldaMixing, AddBuffersWithVolumeRampMatchesGeneric)
+{
+  std::mt19937 rng(2);
+  // Volumes are s16 values shifted up by 16, and ramp over 0x50 samples at most.
+  std::uniform_int_distribution<s32> volume_dist(-0x8000, 0x7FFF);
+  for (size_t count = 0; count <= MAX_COUNT; ++count)
+  {
+    for (int j = 0; j < 8; ++j)
+    {
+      const s32 start = volume_dist(rng);
+      const s32 end = j == 0 ? -0x8000 : j == 1 ? 0x7FFF : volume_dist(rng);
+      const s32 vol = start << 16;
+      const s32 step = static_cast<s32>((s64{end - start} << 16) / s64{MAX_COUNT});
+
+      const std::vector<s16> src = RandomSamples(rng, count);
+      std::vector<s16> expected = RandomSamples(rng, count);
+      std::vector<s16> actual = expected;
+
+      const s32 expected_vol =
+          ZeldaMixing::Generic::AddBuffersWithVolumeRamp(expected.data(), src.data(), count, vol,
+                                                         step);
+      const s32 actual_vol =
+          ZeldaMixing::AddBuffersWithVolumeRamp(actual.data(), src.data(), count, vol, step);
+      EXPECT_EQ(actual, expected) << "count " << count << " volume " << vol << " step " << step;
+      EXPECT_EQ(actual_vol, expected_vol);
+    }
+  }
+}
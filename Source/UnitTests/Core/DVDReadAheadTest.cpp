@@ -0,0 +1,72 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "Common/FileUtil.h"
+#include "Core/HW/DVD/DVDReadAhead.h"
+
+using DVD::ReadAheadTrace;
+
+namespace
+{
+ReadAheadTrace::Read MakeRead(u64 offset)
+{
+  return ReadAheadTrace::Read{0, offset, 0x8000};
+}
+
+ReadAheadTrace MakeTrace(const std::vector<u64>& offsets)
+{
+  ReadAheadTrace trace;
+  for (u64 offset : offsets)
+    trace.Record(MakeRead(offset));
+  return trace;
+}
+}  // namespace
+
+TEST(DVDReadAheadTrace, PredictsFollowingReads)
+{
+  ReadAheadTrace trace = MakeTrace({0x1000, 0x2000, 0x3000, 0x4000});
+
+  EXPECT_EQ(trace.Predict(MakeRead(0x1000), 2),
+            (std::vector<ReadAheadTrace::Read>{MakeRead(0x2000), MakeRead(0x3000)}));
+  EXPECT_EQ(trace.Predict(MakeRead(0x3000), 2),
+            std::vector<ReadAheadTrace::Read>{MakeRead(0x4000)});
+  EXPECT_TRUE(trace.Predict(MakeRead(0x4000), 2).empty());
+  EXPECT_TRUE(trace.Predict(MakeRead(0x5000), 2).empty());
+
+  // The length is part of the read.
+  EXPECT_TRUE(trace.Predict(ReadAheadTrace::Read{0, 0x1000, 0x20}, 2).empty());
+}
+
+TEST(DVDReadAheadTrace, FollowsRepeatedReadsInOrder)
+{
+  ReadAheadTrace trace = MakeTrace({0x1000, 0x2000, 0x1000, 0x3000});
+
+  using Reads = std::vector<ReadAheadTrace::Read>;
+  EXPECT_EQ(trace.Predict(MakeRead(0x1000), 1), Reads{MakeRead(0x2000)});
+  EXPECT_EQ(trace.Predict(MakeRead(0x1000), 1), Reads{MakeRead(0x3000)});
+
+  // Past the last occurrence, it starts over.
+  EXPECT_EQ(trace.Predict(MakeRead(0x1000), 1), Reads{MakeRead(0x2000)});
+}
+
+TEST(DVDReadAheadTrace, SavesAndLoads)
+{
+  const std::string directory = File::CreateTempDir() + "/";
+  const std::string path = directory + "trace";
+  const ReadAheadTrace trace = MakeTrace({0x1000, 0x2000});
+  ASSERT_TRUE(trace.Save(path));
+
+  ReadAheadTrace loaded;
+  ASSERT_TRUE(loaded.Load(path));
+  EXPECT_EQ(loaded.GetReads(), trace.GetReads());
+  EXPECT_EQ(loaded.Predict(MakeRead(0x1000), 1),
+            std::vector<ReadAheadTrace::Read>{MakeRead(0x2000)});
+
+  EXPECT_FALSE(loaded.Load(path + "missing"));
+  File::DeleteDirRecursively(directory);
+}
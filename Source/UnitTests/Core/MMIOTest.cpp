@@ -3,6 +3,7 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <memory>
 #include <unordered_set>
 
@@ -139,3 +140,39 @@ TEST_F(MappingTest, ReadWriteComplex)
   EXPECT_TRUE(read_called);
   EXPECT_TRUE(write_called);
 }
+
+TEST_F(MappingTest, ConvertDirect)
+{
+  u32 target = 0x12345678;
+  constexpr u32 addr = 0x0C001000;
+
+  m_mapping->Register(addr, MMIO::DirectRead<u16>(MMIO::Utils::HighPart(&target)),
+                      MMIO::DirectWrite<u16>(MMIO::Utils::HighPart(&target)));
+  m_mapping->Register(addr + 2, MMIO::DirectRead<u16>(MMIO::Utils::LowPart(&target)),
+                      MMIO::DirectWrite<u16>(MMIO::Utils::LowPart(&target)));
+  m_mapping->Register(addr, MMIO::ReadToSmaller<u32>(m_mapping.get(), addr, addr + 2),
+                      MMIO::WriteToSmaller<u32>(m_mapping.get(), addr, addr + 2));
+  m_mapping->RegisterRead(addr, MMIO::ReadToLarger<u8>(m_mapping.get(), addr, 8));
+  m_mapping->RegisterRead(addr + 1, MMIO::ReadToLarger<u8>(m_mapping.get(), addr, 0));
+
+  // The converters forward to direct handlers, so they are direct handlers themselves.
+  struct DirectVisitor : public MMIO::ReadHandlingMethodVisitor<u32>
+  {
+    void VisitConstant(u32) override {}
+    void VisitDirect(const u32* direct_addr, u32) override { addr = direct_addr; }
+    void VisitComplex(const std::function<u32(Core::System&, u32)>*) override {}
+
+    const u32* addr = nullptr;
+  };
+  DirectVisitor visitor;
+  m_mapping->GetHandlerForRead<u32>(addr).Visit(visitor);
+  EXPECT_EQ(&target, visitor.addr);
+
+  EXPECT_EQ(0x12345678u, m_mapping->Read<u32>(*m_system, addr));
+  EXPECT_EQ(0x12, m_mapping->Read<u8>(*m_system, addr));
+  EXPECT_EQ(0x34, m_mapping->Read<u8>(*m_system, addr + 1));
+
+  m_mapping->Write<u32>(*m_system, addr, 0xdeadbeef);
+  EXPECT_EQ(0xdeadbeefu, target);
+  EXPECT_EQ(0xde, m_mapping->Read<u8>(*m_system, addr));
+}
@@ -0,0 +1,137 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <xxh3.h>
+
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Core/MovieInputLog.h"
+
+using namespace Movie;
+
+namespace
+{
+// Polls of two controllers that change every few frames.
+std::vector<u8> MakeInputs(size_t polls)
+{
+  std::vector<u8> inputs;
+  for (size_t i = 0; i < polls; ++i)
+  {
+    for (u8 byte = 0; byte < 16; ++byte)
+      inputs.push_back(static_cast<u8>(byte < 8 ? (i / 7) * byte : 0x80 + byte));
+  }
+  return inputs;
+}
+
+std::vector<u8> ReadAll(InputLog& log)
+{
+  std::vector<u8> data(log.GetSize());
+  EXPECT_TRUE(log.Read(0, data));
+  return data;
+}
+}  // namespace
+
+TEST(MovieInputLog, EncodesChunks)
+{
+  const std::vector<u8> inputs = MakeInputs(1000);
+  const u8 distance = FindDeltaDistance(inputs);
+  EXPECT_EQ(distance, 16);
+
+  const std::vector<u8> encoded = EncodeChunk(inputs, distance);
+  EXPECT_LT(encoded.size() * 10, inputs.size());
+  EXPECT_EQ(DecodeChunk(encoded, distance, static_cast<u32>(inputs.size())), inputs);
+
+  EXPECT_FALSE(DecodeChunk(encoded, distance, static_cast<u32>(inputs.size()) + 1).has_value());
+  EXPECT_FALSE(DecodeChunk(std::vector<u8>{0x05, 0x01}, 0, 6).has_value());
+
+  const std::vector<u8> literal{0x00, 0x01, 0x00, 0x00, 0x00, 0x02};
+  EXPECT_EQ(DecodeChunk(EncodeChunk(literal, 0), 0, static_cast<u32>(literal.size())), literal);
+}
+
+TEST(MovieInputLog, AppendsAndReads)
+{
+  const std::vector<u8> inputs = MakeInputs(3000);
+
+  InputLog log;
+  for (size_t i = 0; i < inputs.size(); i += 8)
+    log.Append(std::span(inputs).subspan(i, 8));
+  ASSERT_EQ(log.GetSize(), inputs.size());
+  EXPECT_EQ(ReadAll(log), inputs);
+
+  std::vector<u8> across(16);
+  ASSERT_TRUE(log.Read(InputLog::CHUNK_SIZE - 8, across));
+  EXPECT_TRUE(std::equal(across.begin(), across.end(), inputs.begin() + InputLog::CHUNK_SIZE - 8));
+  EXPECT_FALSE(log.Read(inputs.size() - 8, across));
+
+  const u64 seed = 1234;
+  EXPECT_EQ(log.GetHash(seed), XXH3_64bits_withSeed(inputs.data(), inputs.size(), seed));
+}
+
+TEST(MovieInputLog, TruncatesIntoSealedChunks)
+{
+  const std::vector<u8> inputs = MakeInputs(3000);
+  InputLog log;
+  log.Append(inputs);
+
+  const u64 size = InputLog::CHUNK_SIZE + 100;
+  log.Truncate(size);
+  ASSERT_EQ(log.GetSize(), size);
+  const std::vector<u8> more{1, 2, 3, 4};
+  log.Append(more);
+
+  std::vector<u8> expected(inputs.begin(), inputs.begin() + size);
+  expected.insert(expected.end(), more.begin(), more.end());
+  EXPECT_EQ(ReadAll(log), expected);
+
+  InputLog other;
+  other.Append(expected);
+  EXPECT_FALSE(log.FindMismatch(other, expected.size()).has_value());
+  log.Truncate(50);
+  log.Append(more);
+  EXPECT_EQ(log.FindMismatch(other, log.GetSize()), 50u);
+}
+
+TEST(MovieInputLog, WritesAndReadsFiles)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+
+  const std::vector<u8> inputs = MakeInputs(3000);
+  const std::string spill_path = directory + "/spill";
+  {
+    InputLog log;
+    ASSERT_TRUE(log.SpillTo(spill_path));
+    log.Append(inputs);
+    EXPECT_TRUE(File::Exists(spill_path));
+    EXPECT_EQ(ReadAll(log), inputs);
+
+    for (const bool encoded : {false, true})
+    {
+      const std::string path = directory + (encoded ? "/encoded" : "/raw");
+      {
+        File::IOFile file(path, "wb");
+        EXPECT_TRUE(encoded ? log.WriteEncoded(file) : log.WriteRaw(file));
+      }
+
+      File::IOFile file(path, "rb");
+      InputLog read;
+      EXPECT_TRUE(encoded ? read.ReadEncoded(file, file.GetSize()) :
+                            read.ReadRaw(file, file.GetSize()));
+      EXPECT_EQ(ReadAll(read), inputs);
+      if (encoded)
+        EXPECT_LT(file.GetSize() * 10, inputs.size());
+      else
+        EXPECT_EQ(file.GetSize(), inputs.size());
+    }
+  }
+  EXPECT_FALSE(File::Exists(spill_path));
+
+  File::DeleteDirRecursively(directory);
+}
@@ -0,0 +1,64 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "Core/NetPlayBufferTuner.h"
+
+using NetPlay::BufferTuner;
+
+TEST(NetPlayBufferTuner, RequiredSizeFollowsTwoSlowestPlayers)
+{
+  BufferTuner tuner;
+  tuner.AddSample(1, 0);
+  tuner.AddSample(2, 50);
+  tuner.AddSample(3, 100);
+
+  // (100 + 50) / 2 = 75 ms is 4.5 frames at 60 fps, rounded up plus one frame of margin.
+  EXPECT_EQ(tuner.GetRequiredBufferSize(60.0), 6u);
+}
+
+TEST(NetPlayBufferTuner, UsesHighPercentile)
+{
+  BufferTuner tuner;
+  for (size_t i = 0; i < BufferTuner::SAMPLE_COUNT - 1; ++i)
+    tuner.AddSample(2, 10);
+  tuner.AddSample(2, 200);
+
+  // A single spike among 16 samples is above the 95th percentile.
+  EXPECT_EQ(tuner.GetRequiredBufferSize(60.0), 2u);
+
+  tuner.AddSample(2, 200);
+  EXPECT_EQ(tuner.GetRequiredBufferSize(60.0), 7u);
+}
+
+TEST(NetPlayBufferTuner, GrowsImmediatelyAndShrinksWithHysteresis)
+{
+  BufferTuner tuner;
+  EXPECT_EQ(tuner.Update(5, 60.0), std::nullopt);
+
+  tuner.AddSample(2, 200);
+  EXPECT_EQ(tuner.Update(5, 60.0), 7u);
+
+  for (size_t i = 0; i < BufferTuner::SAMPLE_COUNT; ++i)
+    tuner.AddSample(2, 20);
+
+  for (u32 i = 1; i < BufferTuner::SHRINK_DELAY; ++i)
+    EXPECT_EQ(tuner.Update(7, 60.0), std::nullopt);
+  EXPECT_EQ(tuner.Update(7, 60.0), 6u);
+
+  // One frame above what's required is close enough to stay.
+  for (u32 i = 0; i < BufferTuner::SHRINK_DELAY * 2; ++i)
+    EXPECT_EQ(tuner.Update(3, 60.0), std::nullopt);
+}
+
+TEST(NetPlayBufferTuner, ClampsToLimits)
+{
+  BufferTuner tuner;
+  tuner.AddSample(2, 5000);
+  EXPECT_EQ(tuner.GetRequiredBufferSize(60.0), BufferTuner::MAX_BUFFER_SIZE);
+
+  tuner.RemovePlayer(2);
+  tuner.AddSample(3, 0);
+  EXPECT_EQ(tuner.GetRequiredBufferSize(60.0), BufferTuner::MIN_BUFFER_SIZE);
+}
@@ -0,0 +1,80 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "Common/FileUtil.h"
+#include "Core/NetPlayChunkedDataCache.h"
+
+using namespace NetPlay;
+
+namespace
+{
+Common::SHA1::Digest MakeDigest(u8 value)
+{
+  Common::SHA1::Digest digest{};
+  digest.fill(value);
+  return digest;
+}
+}  // namespace
+
+TEST(NetPlayChunkedDataCache, FindsStoredData)
+{
+  ChunkedDataCache cache;
+  EXPECT_TRUE(cache.Find(MakeDigest(1)).empty());
+
+  const std::vector<u8> partial{1, 2, 3};
+  cache.Store(MakeDigest(1), partial, false);
+  EXPECT_TRUE(std::ranges::equal(cache.Find(MakeDigest(1)), partial));
+  EXPECT_TRUE(cache.Find(MakeDigest(2)).empty());
+
+  // The complete data replaces the start of it.
+  const std::vector<u8> complete{1, 2, 3, 4, 5};
+  cache.Store(MakeDigest(1), complete, false);
+  EXPECT_TRUE(std::ranges::equal(cache.Find(MakeDigest(1)), complete));
+  EXPECT_EQ(cache.GetSize(), complete.size());
+}
+
+TEST(NetPlayChunkedDataCache, DropsOldestData)
+{
+  ChunkedDataCache cache;
+  const std::vector<u8> data(ChunkedDataCache::MAX_SIZE / 2);
+  cache.Store(MakeDigest(1), data, false);
+  cache.Store(MakeDigest(2), data, false);
+  cache.Store(MakeDigest(3), data, false);
+
+  EXPECT_TRUE(cache.Find(MakeDigest(1)).empty());
+  EXPECT_EQ(cache.Find(MakeDigest(2)).size(), data.size());
+  EXPECT_EQ(cache.Find(MakeDigest(3)).size(), data.size());
+  EXPECT_LE(cache.GetSize(), ChunkedDataCache::MAX_SIZE);
+}
+
+TEST(NetPlayChunkedDataCache, KeepsCompleteDataOnDisk)
+{
+  const std::string directory = File::CreateTempDir() + "/";
+  const std::vector<u8> complete{1, 2, 3, 4, 5};
+  const std::vector<u8> partial{6, 7};
+  const Common::SHA1::Digest digest = Common::SHA1::CalculateDigest(complete);
+  const Common::SHA1::Digest partial_digest = Common::SHA1::CalculateDigest(partial);
+  {
+    ChunkedDataCache cache(directory);
+    cache.Store(digest, complete, true);
+    cache.Store(partial_digest, partial, false);
+  }
+
+  ChunkedDataCache cache(directory);
+  EXPECT_TRUE(std::ranges::equal(cache.Find(digest), complete));
+  EXPECT_TRUE(cache.Find(partial_digest).empty());
+
+  // A file that doesn't match its digest isn't used.
+  const Common::SHA1::Digest wrong_digest = MakeDigest(1);
+  ASSERT_TRUE(File::CopyRegularFile(directory + Common::SHA1::DigestToString(digest),
+                                    directory + Common::SHA1::DigestToString(wrong_digest)));
+  EXPECT_TRUE(cache.Find(wrong_digest).empty());
+  EXPECT_FALSE(File::Exists(directory + Common::SHA1::DigestToString(wrong_digest)));
+
+  File::DeleteDirRecursively(directory);
+}
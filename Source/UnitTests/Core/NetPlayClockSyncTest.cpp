@@ -0,0 +1,37 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "Core/NetPlayClockSync.h"
+
+using namespace NetPlay;
+
+TEST(NetPlayClockSync, UsesShortestRoundTrip)
+{
+  ClockSync sync;
+  EXPECT_FALSE(sync.GetOffset());
+
+  // The server is 5000us ahead. The first reply was held up on the way back.
+  sync.AddSample(1000, 6500, 3000);
+  sync.AddSample(10000, 15100, 10200);
+  ASSERT_TRUE(sync.GetOffset());
+  EXPECT_EQ(*sync.GetOffset(), 5000);
+  EXPECT_EQ(*sync.ToLocalTime(105000), 100000u);
+
+  // A server behind the own clock.
+  sync.Reset();
+  sync.AddSample(50000, 20050, 50100);
+  EXPECT_EQ(*sync.GetOffset(), -30000);
+  EXPECT_EQ(*sync.ToLocalTime(20000), 50000u);
+}
+
+TEST(NetPlayClockSync, ForgetsOldSamples)
+{
+  ClockSync sync;
+  sync.AddSample(0, 1000, 10);
+  for (u64 i = 1; i <= ClockSync::SIZE; ++i)
+    sync.AddSample(i * 1000, i * 1000 + 2000 + 50, i * 1000 + 100);
+
+  EXPECT_EQ(*sync.GetOffset(), 2000);
+}
@@ -0,0 +1,39 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "Core/NetPlayConnectionStats.h"
+
+using namespace NetPlay;
+
+TEST(NetPlayConnectionStats, RttPercentiles)
+{
+  RttHistory history;
+  EXPECT_EQ(history.GetPercentile(50), 0u);
+
+  for (u32 rtt = 1; rtt <= 100; ++rtt)
+    history.Push(rtt);
+
+  // Only the newest RttHistory::SIZE samples count.
+  EXPECT_EQ(history.GetPercentile(0), 101 - RttHistory::SIZE);
+  EXPECT_EQ(history.GetPercentile(50), 70u);
+  EXPECT_EQ(history.GetPercentile(99), 99u);
+  EXPECT_EQ(history.GetPercentile(100), 100u);
+}
+
+TEST(NetPlayConnectionStats, FormatsOneLinePerPlayer)
+{
+  ConnectionStats stats;
+  stats.players.push_back({1, "host", 20, 20, 25, 30, 2, 0.5f});
+  stats.players.push_back({2, "guest", 40, 40, 45, 50, 4, 0});
+  stats.stalled_frames = 3;
+  stats.bytes_sent_per_second = {1024, 0, 1024};
+
+  const std::string text = FormatConnectionStats(stats, " | ");
+  EXPECT_NE(text.find("host: ping 20 ms (p50 20 / p95 25 / p99 30), jitter 2 ms, loss 50.0% | "),
+            std::string::npos);
+  EXPECT_NE(text.find("guest: ping 40 ms"), std::string::npos);
+  EXPECT_NE(text.find("stalled 3 frames/s, up 2.0 KiB/s"), std::string::npos);
+  EXPECT_EQ(text.find('\n'), std::string::npos);
+}
@@ -0,0 +1,38 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "Core/NetPlayHostInputPacer.h"
+
+using namespace NetPlay;
+
+TEST(NetPlayHostInputPacer, RunsNormallyOnTarget)
+{
+  HostInputPacer pacer;
+  EXPECT_FLOAT_EQ(pacer.Update(4, 4), 1.0f);
+
+  // Jitter around the target averages out.
+  for (int i = 0; i < 100; ++i)
+    EXPECT_FLOAT_EQ(pacer.Update(i % 2 ? 3 : 5, 4), 1.0f);
+}
+
+TEST(NetPlayHostInputPacer, SlewsTowardsTarget)
+{
+  HostInputPacer pacer;
+  EXPECT_FLOAT_EQ(pacer.Update(6, 4), 1.04f);
+
+  // A burst barely moves the average.
+  EXPECT_LT(pacer.Update(30, 4), 1.07f);
+
+  // Further behind, it catches up faster, but only up to MAX_SPEED.
+  for (int i = 0; i < 300; ++i)
+    pacer.Update(30, 4);
+  EXPECT_FLOAT_EQ(pacer.Update(30, 4), static_cast<float>(HostInputPacer::MAX_SPEED));
+
+  // Too close to the host, it slows down.
+  pacer.Reset();
+  EXPECT_FLOAT_EQ(pacer.Update(2, 4), 0.96f);
+  pacer.Reset();
+  EXPECT_FLOAT_EQ(pacer.Update(0, 10), static_cast<float>(HostInputPacer::MIN_SPEED));
+}
@@ -0,0 +1,87 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "Core/NetPlayLateJoin.h"
+
+using namespace NetPlay;
+
+namespace
+{
+GCPadStatus MakeStatus(u32 input)
+{
+  GCPadStatus status;
+  status.button = static_cast<u16>(input);
+  status.stickX = static_cast<u8>(input * 3);
+  return status;
+}
+}  // namespace
+
+TEST(NetPlayLateJoin, StartsWithTheRemainingPrerollInputs)
+{
+  LateJoinInputs inputs;
+  inputs.Reset(3);
+  for (u32 i = 0; i < 5; ++i)
+    inputs.Push(MakeStatus(i));
+
+  const auto after = inputs.GetInputsAfter(1);
+  ASSERT_TRUE(after.has_value());
+  ASSERT_EQ(after->size(), 7u);
+  EXPECT_EQ((*after)[0].button, 0);
+  EXPECT_EQ((*after)[0].stickX, GCPadStatus::MAIN_STICK_CENTER_X);
+  EXPECT_EQ((*after)[1].stickX, GCPadStatus::MAIN_STICK_CENTER_X);
+  for (u32 i = 0; i < 5; ++i)
+    EXPECT_EQ((*after)[i + 2].button, MakeStatus(i).button);
+}
+
+TEST(NetPlayLateJoin, SkipsTheInputsThatWereRead)
+{
+  LateJoinInputs inputs;
+  inputs.Reset(2);
+  for (u32 i = 0; i < 10; ++i)
+    inputs.Push(MakeStatus(i));
+
+  const auto after = inputs.GetInputsAfter(7);
+  ASSERT_TRUE(after.has_value());
+  ASSERT_EQ(after->size(), 5u);
+  EXPECT_EQ(after->front().button, MakeStatus(5).button);
+  EXPECT_EQ(after->back().stickX, MakeStatus(9).stickX);
+
+  const auto none = inputs.GetInputsAfter(12);
+  ASSERT_TRUE(none.has_value());
+  EXPECT_TRUE(none->empty());
+
+  EXPECT_FALSE(inputs.GetInputsAfter(13).has_value());
+}
+
+TEST(NetPlayLateJoin, OnlyKeepsTheNewestInputs)
+{
+  LateJoinInputs inputs;
+  inputs.Reset(0);
+  for (u32 i = 0; i < LateJoinInputs::SIZE + 10; ++i)
+    inputs.Push(MakeStatus(i));
+
+  EXPECT_FALSE(inputs.GetInputsAfter(9).has_value());
+
+  const auto after = inputs.GetInputsAfter(10);
+  ASSERT_TRUE(after.has_value());
+  ASSERT_EQ(after->size(), LateJoinInputs::SIZE);
+  EXPECT_EQ(after->front().button, MakeStatus(10).button);
+}
+
+TEST(NetPlayLateJoin, CountsThePushedInputs)
+{
+  LateJoinInputs inputs;
+  inputs.Reset(4);
+  EXPECT_EQ(inputs.GetEnd(), 0u);
+  for (u32 i = 0; i < 3; ++i)
+    inputs.Push(GetNeutralPadStatus());
+  EXPECT_EQ(inputs.GetEnd(), 3u);
+
+  const auto after = inputs.GetInputsAfter(4);
+  ASSERT_TRUE(after.has_value());
+  ASSERT_EQ(after->size(), 3u);
+  EXPECT_EQ(after->front().stickX, GCPadStatus::MAIN_STICK_CENTER_X);
+  EXPECT_EQ(after->front().substickY, GCPadStatus::C_STICK_CENTER_Y);
+}
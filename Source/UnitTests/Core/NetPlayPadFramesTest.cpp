@@ -0,0 +1,142 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Core/NetPlayPadFrames.h"
+
+using namespace NetPlay;
+
+namespace
+{
+GCPadStatus MakeStatus(u32 frame)
+{
+  GCPadStatus status;
+  status.button = static_cast<u16>(frame / 4);
+  status.stickX = static_cast<u8>(frame);
+  status.triggerLeft = 0x20;
+  return status;
+}
+
+void ExpectEqual(const GCPadStatus& a, const GCPadStatus& b)
+{
+  EXPECT_EQ(a.button, b.button);
+  EXPECT_EQ(a.analogA, b.analogA);
+  EXPECT_EQ(a.analogB, b.analogB);
+  EXPECT_EQ(a.stickX, b.stickX);
+  EXPECT_EQ(a.stickY, b.stickY);
+  EXPECT_EQ(a.substickX, b.substickX);
+  EXPECT_EQ(a.substickY, b.substickY);
+  EXPECT_EQ(a.triggerLeft, b.triggerLeft);
+  EXPECT_EQ(a.triggerRight, b.triggerRight);
+  EXPECT_EQ(a.isConnected, b.isConnected);
+}
+}  // namespace
+
+TEST(NetPlayPadFrames, RedundantFramesRoundTrip)
+{
+  PadFrameHistory history;
+  for (u32 frame = 0; frame < 20; ++frame)
+    history.Push(MakeStatus(frame));
+
+  sf::Packet packet;
+  WriteRedundantPadFrames(packet, 2, history);
+
+  // Only the first input is sent as a whole, the others just the fields that changed.
+  EXPECT_LT(packet.getDataSize(), 8 * (sizeof(u16) + 10));
+
+  PadFrames frames;
+  ASSERT_TRUE(ReadPadFrames(packet, &frames));
+  EXPECT_TRUE(packet.endOfPacket());
+  EXPECT_EQ(frames.map, 2);
+  EXPECT_EQ(frames.first_frame, 20 - PAD_FRAME_REDUNDANCY);
+  ASSERT_EQ(frames.count, PAD_FRAME_REDUNDANCY);
+  for (u32 i = 0; i < frames.count; ++i)
+    ExpectEqual(frames.statuses[i], MakeStatus(frames.first_frame + i));
+}
+
+TEST(NetPlayPadFrames, ReceiverDropsDuplicatesAndDetectsGaps)
+{
+  PadFrameHistory history;
+  PadFrameReceiver receiver;
+  std::vector<GCPadStatus> received;
+  const auto push = [&](const GCPadStatus& status) { received.push_back(status); };
+
+  const auto receive_newest = [&] {
+    sf::Packet packet;
+    WriteRedundantPadFrames(packet, 0, history);
+    PadFrames frames;
+    EXPECT_TRUE(ReadPadFrames(packet, &frames));
+    return receiver.Receive(frames, push);
+  };
+
+  for (u32 frame = 0; frame < 5; ++frame)
+  {
+    history.Push(MakeStatus(frame));
+    EXPECT_TRUE(receive_newest());
+  }
+  EXPECT_EQ(received.size(), 5u);
+  EXPECT_EQ(receiver.GetNextFrame(), 5u);
+
+  // Losing fewer packets than the redundancy covers doesn't lose any inputs.
+  for (u32 frame = 5; frame < 5 + PAD_FRAME_REDUNDANCY; ++frame)
+    history.Push(MakeStatus(frame));
+  EXPECT_TRUE(receive_newest());
+  EXPECT_TRUE(receive_newest());
+  ASSERT_EQ(received.size(), 5 + PAD_FRAME_REDUNDANCY);
+  for (u32 frame = 0; frame < received.size(); ++frame)
+    ExpectEqual(received[frame], MakeStatus(frame));
+
+  // Losing more has to be requested, once.
+  for (u32 frame = 0; frame < PAD_FRAME_REDUNDANCY + 1; ++frame)
+    history.Push(MakeStatus(history.GetEnd()));
+  EXPECT_FALSE(receive_newest());
+  EXPECT_TRUE(receiver.ShouldRequestMissingFrames());
+  EXPECT_FALSE(receive_newest());
+  EXPECT_FALSE(receiver.ShouldRequestMissingFrames());
+
+  sf::Packet packet;
+  ASSERT_TRUE(WriteMissingPadFrames(packet, 0, history, receiver.GetNextFrame()));
+  PadFrames frames;
+  ASSERT_TRUE(ReadPadFrames(packet, &frames));
+  EXPECT_TRUE(receiver.Receive(frames, push));
+  EXPECT_EQ(receiver.GetNextFrame(), history.GetEnd());
+  ASSERT_EQ(received.size(), history.GetEnd());
+  for (u32 frame = 0; frame < received.size(); ++frame)
+    ExpectEqual(received[frame], MakeStatus(frame));
+}
+
+TEST(NetPlayPadFrames, MissingFramesSpanSeveralBlocks)
+{
+  PadFrameHistory history;
+  for (u32 frame = 0; frame < PadFrameHistory::SIZE + 10; ++frame)
+    history.Push(MakeStatus(frame));
+
+  sf::Packet packet;
+  EXPECT_FALSE(WriteMissingPadFrames(packet, 1, history, 0));
+  ASSERT_TRUE(WriteMissingPadFrames(packet, 1, history, history.GetBegin()));
+
+  u32 count = 0;
+  PadFrames frames;
+  while (!packet.endOfPacket())
+  {
+    ASSERT_TRUE(ReadPadFrames(packet, &frames));
+    EXPECT_LE(frames.count, MAX_PAD_FRAMES_PER_BLOCK);
+    count += frames.count;
+  }
+  EXPECT_EQ(count, PadFrameHistory::SIZE);
+}
+
+TEST(NetPlayPadFrames, RejectsMalformedBlocks)
+{
+  sf::Packet bad_map;
+  bad_map << static_cast<PadIndex>(4) << u32{0} << u8{0};
+  PadFrames frames;
+  EXPECT_FALSE(ReadPadFrames(bad_map, &frames));
+
+  sf::Packet truncated;
+  truncated << static_cast<PadIndex>(0) << u32{0} << u8{3};
+  EXPECT_FALSE(ReadPadFrames(truncated, &frames));
+}
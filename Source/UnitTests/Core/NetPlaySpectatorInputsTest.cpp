@@ -0,0 +1,68 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "Core/NetPlaySpectatorInputs.h"
+
+using namespace NetPlay;
+
+namespace
+{
+GCPadStatus MakeStatus(u32 input)
+{
+  GCPadStatus status;
+  status.button = static_cast<u16>(input);
+  return status;
+}
+}  // namespace
+
+TEST(NetPlaySpectatorInputs, HoldsBackTheDelay)
+{
+  SpectatorInputs inputs;
+  inputs.Reset(5);
+  for (u32 i = 0; i < 5 + SpectatorInputs::BATCH_SIZE - 1; ++i)
+    inputs.Push(0, MakeStatus(i));
+  EXPECT_TRUE(inputs.TakeBatch(false).empty());
+
+  inputs.Push(0, MakeStatus(100));
+  const auto batch = inputs.TakeBatch(false);
+  ASSERT_EQ(batch.size(), SpectatorInputs::BATCH_SIZE);
+  for (u32 i = 0; i < SpectatorInputs::BATCH_SIZE; ++i)
+  {
+    EXPECT_EQ(batch[i].first, 0);
+    EXPECT_EQ(batch[i].second.button, MakeStatus(i).button);
+  }
+  EXPECT_TRUE(inputs.TakeBatch(false).empty());
+}
+
+TEST(NetPlaySpectatorInputs, FlushTakesEverything)
+{
+  SpectatorInputs inputs;
+  inputs.Reset(5);
+  for (u32 i = 0; i < 5 + SpectatorInputs::BATCH_SIZE; ++i)
+    inputs.Push(1, MakeStatus(i));
+  inputs.Push(3, MakeStatus(200));
+  ASSERT_EQ(inputs.TakeBatch(false).size(), SpectatorInputs::BATCH_SIZE);
+
+  const auto batch = inputs.TakeBatch(true);
+  ASSERT_EQ(batch.size(), 6u);
+  for (u32 i = 0; i < 5; ++i)
+  {
+    EXPECT_EQ(batch[i].first, 1);
+    EXPECT_EQ(batch[i].second.button, MakeStatus(SpectatorInputs::BATCH_SIZE + i).button);
+  }
+  EXPECT_EQ(batch[5].first, 3);
+  EXPECT_EQ(batch[5].second.button, 200);
+
+  EXPECT_TRUE(inputs.TakeBatch(true).empty());
+}
+
+TEST(NetPlaySpectatorInputs, ResetDropsTheQueuedInputs)
+{
+  SpectatorInputs inputs;
+  inputs.Reset(0);
+  inputs.Push(2, MakeStatus(1));
+  inputs.Reset(0);
+  EXPECT_TRUE(inputs.TakeBatch(true).empty());
+}
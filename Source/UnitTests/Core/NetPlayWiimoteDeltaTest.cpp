@@ -0,0 +1,87 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "Core/NetPlayWiimoteDelta.h"
+
+using namespace NetPlay;
+using WiimoteEmu::SerializedWiimoteState;
+
+namespace
+{
+SerializedWiimoteState MakeState(u8 length, u8 seed)
+{
+  SerializedWiimoteState state{};
+  state.length = length;
+  for (u8 i = 0; i < length; ++i)
+    state.data[i] = static_cast<u8>(seed + i);
+  return state;
+}
+
+SerializedWiimoteState RoundTrip(const SerializedWiimoteState& previous,
+                                 const SerializedWiimoteState& state, size_t* size)
+{
+  sf::Packet packet;
+  WriteWiimoteStateDelta(packet, WiimoteStateDelta::Make(previous, state));
+  *size = packet.getDataSize();
+
+  WiimoteStateDelta delta;
+  EXPECT_TRUE(ReadWiimoteStateDelta(packet, &delta));
+  EXPECT_TRUE(packet.endOfPacket());
+  return delta.Apply(previous);
+}
+
+void ExpectEqual(const SerializedWiimoteState& a, const SerializedWiimoteState& b)
+{
+  ASSERT_EQ(a.length, b.length);
+  EXPECT_TRUE(std::equal(a.data.begin(), a.data.begin() + a.length, b.data.begin()));
+}
+}  // namespace
+
+TEST(NetPlayWiimoteDelta, SendsOnlyChangedBytes)
+{
+  const SerializedWiimoteState previous = MakeState(24, 0);
+  SerializedWiimoteState state = previous;
+  state.data[3] ^= 0xff;
+  state.data[20] ^= 0xff;
+
+  size_t size;
+  ExpectEqual(RoundTrip(previous, state, &size), state);
+  // The length, 3 mask bytes and the 2 bytes that changed.
+  EXPECT_EQ(size, 1u + 3 + 2);
+
+  ExpectEqual(RoundTrip(state, state, &size), state);
+  EXPECT_EQ(size, 1u + 3);
+}
+
+TEST(NetPlayWiimoteDelta, SendsWholeStateWhenLengthChanges)
+{
+  const SerializedWiimoteState previous = MakeState(18, 0);
+  const SerializedWiimoteState state = MakeState(30, 0);
+
+  size_t size;
+  ExpectEqual(RoundTrip(previous, state, &size), state);
+  EXPECT_EQ(size, 1u + 4 + 30);
+
+  ExpectEqual(RoundTrip(SerializedWiimoteState{}, previous, &size), previous);
+}
+
+TEST(NetPlayWiimoteDelta, RejectsMalformedDeltas)
+{
+  WiimoteStateDelta delta;
+
+  sf::Packet too_long;
+  too_long << u8{31};
+  EXPECT_FALSE(ReadWiimoteStateDelta(too_long, &delta));
+
+  sf::Packet mask_beyond_length;
+  mask_beyond_length << u8{4} << u8{0x10};
+  EXPECT_FALSE(ReadWiimoteStateDelta(mask_beyond_length, &delta));
+
+  sf::Packet truncated;
+  truncated << u8{8} << u8{0x03} << u8{1};
+  EXPECT_FALSE(ReadWiimoteStateDelta(truncated, &delta));
+}
@@ -0,0 +1,206 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/Buffer.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "VideoCommon/Assets/TexturePack.h"
+
+using namespace std::string_view_literals;
+using VideoCommon::TexturePack;
+
+class TexturePackTest : public testing::Test
+{
+protected:
+  TexturePackTest() : m_directory(File::CreateTempDir()) {}
+  ~TexturePackTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_directory.empty())
+      FAIL() << "Failed to create the temporary directory";
+  }
+
+  std::string WriteTexture(const std::string& file_name, std::string_view contents)
+  {
+    const std::string path = m_directory + '/' + file_name;
+    EXPECT_TRUE(File::WriteStringToFile(path, contents));
+    return path;
+  }
+
+  static std::string ReadPayload(TexturePack* pack, const TexturePack::Entry& entry)
+  {
+    Common::UniqueBuffer<u8> payload;
+    EXPECT_TRUE(pack->ReadPayload(entry, &payload));
+    return std::string(reinterpret_cast<const char*>(payload.data()), payload.size());
+  }
+
+  struct ZipFile
+  {
+    std::string path;
+    std::string_view contents;
+    bool compressed = false;
+    std::string_view extra_field = {};
+  };
+
+  // Writes a zip file by hand, so that the data of the files is where the test expects it. The
+  // contents of "compressed" files aren't really compressed, only marked to be.
+  std::string WriteZip(const std::vector<ZipFile>& files)
+  {
+    const auto append = [](std::string* out, u32 value, int size) {
+      for (int i = 0; i < size; ++i)
+        out->push_back(static_cast<char>(value >> (i * 8)));
+    };
+    const auto append_header = [&](std::string* out, const ZipFile& file) {
+      append(out, 20, 2);                       // Version needed
+      append(out, 0, 2);                        // Flags
+      append(out, file.compressed ? 8 : 0, 2);  // Compression method
+      append(out, 0, 4);                        // Modification time and date
+      append(out, 0, 4);                        // CRC-32, which isn't checked
+      append(out, static_cast<u32>(file.contents.size()), 4);
+      append(out, static_cast<u32>(file.contents.size()), 4);
+      append(out, static_cast<u32>(file.path.size()), 2);
+    };
+
+    std::string zip;
+    std::string central_directory;
+    for (const ZipFile& file : files)
+    {
+      const u32 offset = static_cast<u32>(zip.size());
+      append(&zip, 0x04034b50, 4);
+      append_header(&zip, file);
+      append(&zip, static_cast<u32>(file.extra_field.size()), 2);
+      zip += file.path;
+      zip += file.extra_field;
+      zip += file.contents;
+
+      append(&central_directory, 0x02014b50, 4);
+      append(&central_directory, 20, 2);  // Version made by
+      append_header(&central_directory, file);
+      append(&central_directory, 0, 2);  // Extra field size
+      append(&central_directory, 0, 2);  // Comment size
+      append(&central_directory, 0, 2);  // Disk number
+      append(&central_directory, 0, 2);  // Internal attributes
+      append(&central_directory, 0, 4);  // External attributes
+      append(&central_directory, offset, 4);
+      central_directory += file.path;
+    }
+
+    const u32 central_directory_offset = static_cast<u32>(zip.size());
+    zip += central_directory;
+    append(&zip, 0x06054b50, 4);
+    append(&zip, 0, 4);  // Disk numbers
+    append(&zip, static_cast<u32>(files.size()), 2);
+    append(&zip, static_cast<u32>(files.size()), 2);
+    append(&zip, static_cast<u32>(central_directory.size()), 4);
+    append(&zip, central_directory_offset, 4);
+    append(&zip, 0, 2);  // Comment size
+
+    return WriteTexture("pack.zip", zip);
+  }
+
+  std::string m_directory;
+};
+
+TEST_F(TexturePackTest, WriteAndFind)
+{
+  const std::vector<std::string> texture_paths{
+      WriteTexture("tex1_8x8_0000000000000001_0.png", "first"),
+      WriteTexture("tex1_8x8_0000000000000002_0.dds", "second"),
+      WriteTexture("tex1_8x8_0000000000000002_0_mip1.dds", ""),
+      WriteTexture("tex1_8x8_0000000000000003_0_arb.png", "third"),
+  };
+
+  const std::string pack_path = m_directory + "/pack.dtp";
+  std::string error_message;
+  ASSERT_TRUE(TexturePack::Write(pack_path, texture_paths, &error_message)) << error_message;
+
+  const std::unique_ptr<TexturePack> pack = TexturePack::Open(pack_path);
+  ASSERT_NE(pack, nullptr);
+  EXPECT_EQ(pack->GetEntries().size(), texture_paths.size());
+
+  const TexturePack::Entry* first = pack->Find("tex1_8x8_0000000000000001_0");
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first->type, TexturePack::PayloadType::PNG);
+  EXPECT_EQ(ReadPayload(pack.get(), *first), "first");
+
+  const TexturePack::Entry* second = pack->Find("tex1_8x8_0000000000000002_0");
+  ASSERT_NE(second, nullptr);
+  EXPECT_EQ(second->type, TexturePack::PayloadType::DDS);
+  EXPECT_EQ(ReadPayload(pack.get(), *second), "second");
+
+  const TexturePack::Entry* mip = pack->Find("tex1_8x8_0000000000000002_0_mip1");
+  ASSERT_NE(mip, nullptr);
+  EXPECT_EQ(ReadPayload(pack.get(), *mip), "");
+
+  const TexturePack::Entry* third = pack->Find("tex1_8x8_0000000000000003_0_arb");
+  ASSERT_NE(third, nullptr);
+  EXPECT_EQ(pack->GetName(*third), "tex1_8x8_0000000000000003_0_arb");
+  EXPECT_EQ(ReadPayload(pack.get(), *third), "third");
+
+  EXPECT_EQ(pack->Find("tex1_8x8_0000000000000003_0"), nullptr);
+  EXPECT_EQ(pack->Find(""), nullptr);
+}
+
+TEST_F(TexturePackTest, RejectsDuplicateNames)
+{
+  const std::vector<std::string> texture_paths{
+      WriteTexture("tex1_8x8_0000000000000001_0.png", "png"),
+      WriteTexture("tex1_8x8_0000000000000001_0.dds", "dds"),
+  };
+
+  std::string error_message;
+  EXPECT_FALSE(TexturePack::Write(m_directory + "/pack.dtp", texture_paths, &error_message));
+  EXPECT_FALSE(error_message.empty());
+}
+
+TEST_F(TexturePackTest, RejectsOtherFiles)
+{
+  const std::string path = WriteTexture("pack.dtp", "not a texture pack");
+  EXPECT_EQ(TexturePack::Open(path), nullptr);
+  EXPECT_EQ(TexturePack::Open(m_directory + "/missing.dtp"), nullptr);
+}
+
+TEST_F(TexturePackTest, OpenZip)
+{
+  const std::string path = WriteZip({
+      {"manifest.json", "{}"},
+      {"textures/GALE01/tex1_8x8_0000000000000001_0.png", "first", false,
+       "\x99\x99\x02\x00" "ab"sv},
+      {"textures/GALE01/sub/tex1_8x8_0000000000000002_0.DDS", "second"},
+      {"textures/GALE01/tex1_8x8_0000000000000001_0.png", "duplicate"},
+      {"textures/GALE01/tex1_8x8_0000000000000003_0.png", "compressed", true},
+      {"textures/GALE01/readme.txt", "not a texture"},
+      {"textures/GALE/tex1_8x8_0000000000000004_0.png", "other game"},
+  });
+
+  const std::unique_ptr<TexturePack> pack = TexturePack::OpenZip(path, {"textures/GALE01/"});
+  ASSERT_NE(pack, nullptr);
+  EXPECT_EQ(pack->GetEntries().size(), 2u);
+
+  const TexturePack::Entry* first = pack->Find("tex1_8x8_0000000000000001_0");
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first->type, TexturePack::PayloadType::PNG);
+  EXPECT_EQ(ReadPayload(pack.get(), *first), "first");
+
+  const TexturePack::Entry* second = pack->Find("tex1_8x8_0000000000000002_0");
+  ASSERT_NE(second, nullptr);
+  EXPECT_EQ(second->type, TexturePack::PayloadType::DDS);
+  EXPECT_EQ(ReadPayload(pack.get(), *second), "second");
+
+  EXPECT_EQ(pack->Find("tex1_8x8_0000000000000003_0"), nullptr);
+  EXPECT_EQ(pack->Find("tex1_8x8_0000000000000004_0"), nullptr);
+
+  EXPECT_EQ(TexturePack::OpenZip(m_directory + "/missing.zip", {"textures/GALE01/"}), nullptr);
+}